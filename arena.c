@@ -0,0 +1,117 @@
+/* Arena (bump) allocator for objects that live for one replication, such
+   as queue nodes.  Memory is carved from large chunks by advancing a
+   pointer, and everything allocated is released at once by rewinding the
+   arena, typically in initialize().  The chunks are kept and reused, so
+   after the longest replication so far the arena allocates nothing more,
+   and it never fragments.  The header file arena.h must be included in the
+   calling program (#include "arena.h") before using these functions.
+
+   Usage:
+
+   1. To create an empty arena that takes memory "chunk" bytes at a time,
+      execute
+          a = arena_create(chunk);
+      and release it and all its memory with arena_destroy(a) when done.
+
+   2. To allocate n bytes, suitably aligned for any type, execute
+          p = arena_alloc(a, n);
+      The memory cannot be freed on its own.
+
+   3. To release everything allocated from the arena at once, execute
+          arena_reset(a);
+      Pointers obtained earlier must not be used afterwards. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "arena.h"
+
+#define ARENA_ALIGN 16  /* Alignment of every allocation. */
+
+typedef struct chunk {
+    struct chunk *next;
+    size_t        size;  /* Bytes usable after the header. */
+} chunk_t;
+
+/* Bytes taken by the chunk header, rounded up so that the data after it
+   is aligned. */
+#define CHUNK_HEADER \
+    ((sizeof(chunk_t) + ARENA_ALIGN - 1) & ~(size_t) (ARENA_ALIGN - 1))
+
+struct arena {
+    size_t   chunk;  /* Default size of a new chunk. */
+    chunk_t *first;  /* Chunks, in the order they are filled. */
+    chunk_t *cur;    /* Chunk being filled, or NULL if none yet. */
+    size_t   used;   /* Bytes used in cur. */
+};
+
+
+arena_t *arena_create(size_t chunk)
+{
+    arena_t *a = malloc(sizeof(arena_t));
+
+    if (a == NULL) {
+        fprintf(stderr, "\narena: out of memory\n");
+        exit(3);
+    }
+    a->chunk = chunk;
+    a->first = NULL;
+    a->cur   = NULL;
+    a->used  = 0;
+    return a;
+}
+
+
+void arena_destroy(arena_t *a)
+{
+    chunk_t *c, *next;
+
+    for (c = a->first; c != NULL; c = next) {
+        next = c->next;
+        free(c);
+    }
+    free(a);
+}
+
+
+void arena_reset(arena_t *a)
+{
+    a->cur  = a->first;
+    a->used = 0;
+}
+
+
+void *arena_alloc(arena_t *a, size_t n)
+{
+    chunk_t *c;
+    size_t   size;
+
+    n = (n + ARENA_ALIGN - 1) & ~(size_t) (ARENA_ALIGN - 1);
+
+    /* Move on to the next chunk, reusing it if it is large enough and
+       otherwise inserting a new one, until n bytes fit. */
+    while (a->cur == NULL || a->used + n > a->cur->size) {
+        c = a->cur == NULL ? a->first : a->cur->next;
+        if (c == NULL || n > c->size) {
+            size = n > a->chunk ? n : a->chunk;
+            c    = malloc(CHUNK_HEADER + size);
+            if (c == NULL) {
+                fprintf(stderr, "\narena: out of memory\n");
+                exit(3);
+            }
+            c->size = size;
+            if (a->cur == NULL) {
+                c->next  = a->first;
+                a->first = c;
+            }
+            else {
+                c->next      = a->cur->next;
+                a->cur->next = c;
+            }
+        }
+        a->cur  = c;
+        a->used = 0;
+    }
+
+    a->used += n;
+    return (char *) a->cur + CHUNK_HEADER + a->used - n;
+}
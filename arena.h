@@ -0,0 +1,11 @@
+/* Header file "arena.h" to be included by programs using the arena
+   allocator in arena.c.  See arena.c for a description of the functions. */
+
+#include <stddef.h>
+
+typedef struct arena arena_t;
+
+arena_t *arena_create(size_t chunk);
+void     arena_destroy(arena_t *a);
+void     arena_reset(arena_t *a);
+void    *arena_alloc(arena_t *a, size_t n);
@@ -0,0 +1,205 @@
+/* Benchmark of the future event list implementations against the linear
+   scan over time_next_event[] used originally by timing().  Each run is a
+   classic "hold" model: the list is filled with n pending events, then
+   every operation removes the earliest event and schedules a replacement
+   at the current time plus an exponential increment.  Reports nanoseconds
+   per hold operation as n grows, so the crossovers between the heap, the
+   calendar queue and the ladder queue can be read off the table.  A second
+   table repeats the heap and the bucketed lists with a skewed increment
+   distribution (mostly short exponential delays with occasional long
+   ones), the case where a fixed calendar width suffers.
+
+   A final table models customers in transit: n pending arrivals, each
+   replaced on removal by one uniform(2) minutes later, and reports the
+   events per second achieved by the heap and by the timing wheel.
+
+   Build: cc -O2 -o bench_evlist bench_evlist.c evlist.c twheel.c lcgrand.c -lm */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "evlist.h"
+#include "twheel.h"
+#include "lcgrand.h"
+
+#define NUM_HOLDS 2000000  /* Hold operations timed per configuration. */
+
+float sink;  /* Keeps the compiler from discarding the results. */
+
+
+double now_ns(void)  /* Monotonic wall-clock time in nanoseconds. */
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1.0e9 + ts.tv_nsec;
+}
+
+
+float expon(float mean)  /* Exponential variate generation function. */
+{
+    return -mean * log(lcgrand(1));
+}
+
+
+float increment(int skewed)  /* Hold-time increment. */
+{
+    if (skewed && lcgrand(2) < 0.05)
+        return expon(1000.0);
+    return expon(1.0);
+}
+
+
+/* Hold model on an array with one slot per event type, scanned linearly for
+   the minimum exactly as the original timing() did. */
+
+double hold_scan(int n)
+{
+    int    i, j, next;
+    float  min_time, sim_time = 0.0;
+    float *time_next_event = malloc((n + 1) * sizeof(float));
+    double start;
+
+    for (i = 1; i <= n; ++i)
+        time_next_event[i] = expon(1.0);
+
+    start = now_ns();
+    for (j = 0; j < NUM_HOLDS; ++j) {
+        min_time = 1.0e+29;
+        next     = 0;
+        for (i = 1; i <= n; ++i)
+            if (time_next_event[i] < min_time) {
+                min_time = time_next_event[i];
+                next     = i;
+            }
+        sim_time = min_time;
+        time_next_event[next] = sim_time + expon(1.0);
+    }
+    start = (now_ns() - start) / NUM_HOLDS;
+
+    sink += sim_time;
+    free(time_next_event);
+    return start;
+}
+
+
+/* Hold model on an evlist_t of the given kind, with exponential or
+   skewed increments. */
+
+double hold_evlist(int kind, int n, int skewed)
+{
+    int       i, j, type;
+    float     sim_time = 0.0;
+    evlist_t *el = evlist_create(kind);
+    double    start;
+
+    for (i = 1; i <= n; ++i)
+        evlist_schedule(el, i, increment(skewed));
+
+    start = now_ns();
+    for (j = 0; j < NUM_HOLDS; ++j) {
+        type = evlist_pop(el, &sim_time);
+        evlist_schedule(el, type, sim_time + increment(skewed));
+    }
+    start = (now_ns() - start) / NUM_HOLDS;
+
+    sink += sim_time;
+    evlist_destroy(el);
+    return start;
+}
+
+
+/* Transit model on a heap (wheel == 0) or a timing wheel; returns events
+   per second. */
+
+double transit_rate(int wheel, int n)
+{
+    int       i, j, type;
+    float     sim_time = 0.0;
+    evlist_t *el = evlist_create(EVLIST_HEAP);
+    twheel_t *w  = twheel_create(2.0 / 65536);
+    double    start;
+
+    for (i = 0; i < n; ++i) {
+        if (wheel)
+            twheel_schedule(w, 3, 2.0 * lcgrand(3));
+        else
+            evlist_schedule(el, 3, 2.0 * lcgrand(3));
+    }
+
+    start = now_ns();
+    for (j = 0; j < NUM_HOLDS; ++j) {
+        if (wheel) {
+            type = twheel_pop(w, &sim_time);
+            twheel_schedule(w, type, sim_time + 2.0 * lcgrand(3));
+        }
+        else {
+            type = evlist_pop(el, &sim_time);
+            evlist_schedule(el, type, sim_time + 2.0 * lcgrand(3));
+        }
+    }
+    start = NUM_HOLDS / ((now_ns() - start) * 1.0e-9);
+
+    sink += sim_time;
+    evlist_destroy(el);
+    twheel_destroy(w);
+    return start;
+}
+
+
+/* Cost of the hold loop's random-number generation alone, with exponential
+   or skewed increments, subtracted from the figures above so that they
+   reflect the event list only. */
+
+double hold_rng(int skewed)
+{
+    int    j;
+    float  sum = 0.0;
+    double start = now_ns();
+
+    for (j = 0; j < NUM_HOLDS; ++j)
+        sum += increment(skewed);
+    start = (now_ns() - start) / NUM_HOLDS;
+
+    sink += sum;
+    return start;
+}
+
+
+int main()
+{
+    static const int sizes[] = { 5, 50, 500, 5000, 50000, 500000 };
+    int    i, skewed;
+    double rng;
+
+    printf("Hold model, %d operations\n", NUM_HOLDS);
+
+    for (skewed = 0; skewed <= 1; ++skewed) {
+        rng = hold_rng(skewed);
+        printf("\n%s increments, RNG cost %.1f ns/op subtracted\n",
+               skewed ? "Skewed" : "Exponential", rng);
+        printf("%8s %12s %12s %12s %12s\n", "pending", "scan ns/op",
+               "heap ns/op", "cal ns/op", "ladder ns/op");
+        for (i = 0; i < 6; ++i) {
+            printf("%8d ", sizes[i]);
+            if (sizes[i] <= 5000 && !skewed)
+                printf("%12.1f ", hold_scan(sizes[i]) - rng);
+            else
+                printf("%12s ", "-");
+            printf("%12.1f %12.1f %12.1f\n",
+                   hold_evlist(EVLIST_HEAP, sizes[i], skewed) - rng,
+                   hold_evlist(EVLIST_CALENDAR, sizes[i], skewed) - rng,
+                   hold_evlist(EVLIST_LADDER, sizes[i], skewed) - rng);
+        }
+    }
+
+    printf("\nCustomers in transit, uniform(2) delays\n");
+    printf("%8s %16s %16s\n", "transit", "heap events/s", "wheel events/s");
+    for (i = 10; i <= 100000; i *= 10)
+        printf("%8d %16.3e %16.3e\n", i, transit_rate(0, i), transit_rate(1, i));
+
+    return sink == 0.0;
+}
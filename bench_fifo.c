@@ -0,0 +1,181 @@
+/* Benchmark of the FIFO queues in fifo.c against the arrays the simulators
+   used before, where every departure moved each waiting customer up one
+   place.  The queue is filled to a given length and then each operation
+   serves the customer at the head and adds an arrival at the tail, as a
+   busy station does, so the length stays fixed.  For queue lengths 10,
+   1000 and 100000, reports nanoseconds and cache misses per
+   departure/arrival pair for the shifting array and each kind of queue.
+   Cache misses are read from the hardware counters with perf_event_open
+   (Linux); where the counters are not available, "n/a" is shown.
+
+   Build: cc -O2 -o bench_fifo bench_fifo.c fifo.c arena.c */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "fifo.h"
+
+#define NUM_OPS 20000000  /* Operations timed on a FIFO per length. */
+
+float sink;             /* Keeps the compiler from discarding the results. */
+int   perf_fd = -1;     /* Cache-miss counter, or -1 if unavailable. */
+
+typedef struct {        /* Result of one timed run. */
+    double ns;          /* Nanoseconds per operation. */
+    double misses;      /* Cache misses per operation, or -1. */
+} result_t;
+
+
+double now_ns(void)  /* Monotonic wall-clock time in nanoseconds. */
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1.0e9 + ts.tv_nsec;
+}
+
+
+/* Open a counter of the cache misses of this thread in user mode. */
+
+void open_counter(void)
+{
+    struct perf_event_attr pe;
+
+    memset(&pe, 0, sizeof(pe));
+    pe.type           = PERF_TYPE_HARDWARE;
+    pe.size           = sizeof(pe);
+    pe.config         = PERF_COUNT_HW_CACHE_MISSES;
+    pe.disabled       = 1;
+    pe.exclude_kernel = 1;
+    pe.exclude_hv     = 1;
+    perf_fd = syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
+}
+
+
+/* Start timing and counting. */
+
+double start_run(void)
+{
+    if (perf_fd >= 0) {
+        ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    return now_ns();
+}
+
+
+/* Stop timing and counting, and return the costs per operation. */
+
+result_t end_run(double start, int ops)
+{
+    result_t  r;
+    long long count;
+
+    r.ns     = (now_ns() - start) / ops;
+    r.misses = -1.0;
+    if (perf_fd >= 0) {
+        ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(perf_fd, &count, sizeof(count)) == sizeof(count))
+            r.misses = (double) count / ops;
+    }
+    return r;
+}
+
+
+/* Shifting array as in the original queue1_departure(): entries 1..len,
+   head at index 1.  The work per operation grows with len, so fewer
+   operations are timed for long queues. */
+
+result_t ops_array(int len)
+{
+    int      i, j, ops = NUM_OPS / (1 + len / 10);
+    float    sim_time = 0.0, delay = 0.0;
+    float   *time_arrival = malloc((len + 2) * sizeof(float));
+    double   start;
+    result_t r;
+
+    for (i = 1; i <= len; ++i)
+        time_arrival[i] = sim_time++;
+
+    start = start_run();
+    for (j = 0; j < ops; ++j) {
+        delay += sim_time - time_arrival[1];
+        for (i = 1; i < len; ++i)
+            time_arrival[i] = time_arrival[i + 1];
+        time_arrival[len] = sim_time++;
+    }
+    r = end_run(start, ops);
+
+    sink += delay;
+    free(time_arrival);
+    return r;
+}
+
+
+result_t ops_fifo(int kind, int len)
+{
+    int      i, j;
+    float    sim_time = 0.0, delay = 0.0;
+    fifo_t  *q = fifo_create(kind, len);
+    double   start;
+    result_t r;
+
+    for (i = 0; i < len; ++i)
+        fifo_push(q, sim_time++);
+
+    start = start_run();
+    for (j = 0; j < NUM_OPS; ++j) {
+        delay += sim_time - fifo_pop(q);
+        fifo_push(q, sim_time++);
+    }
+    r = end_run(start, NUM_OPS);
+
+    sink += delay;
+    fifo_destroy(q);
+    return r;
+}
+
+
+void print_result(result_t r)
+{
+    if (r.misses < 0.0)
+        printf(" %9.1f %8s", r.ns, "n/a");
+    else
+        printf(" %9.1f %8.3f", r.ns, r.misses);
+}
+
+
+int main()
+{
+    static const int   lengths[] = { 10, 1000, 100000 };
+    static const int   kinds[]   = { FIFO_RING, FIFO_CHUNKED, FIFO_LIST };
+    static const char *names[]   = { "array", "ring", "chunked", "list" };
+    int i, k;
+
+    open_counter();
+
+    printf("%8s", "");
+    for (k = 0; k < 4; ++k)
+        printf(" %18s", names[k]);
+    printf("\n%8s", "length");
+    for (k = 0; k < 4; ++k)
+        printf(" %9s %8s", "ns/op", "miss/op");
+    printf("\n");
+
+    for (i = 0; i < 3; ++i) {
+        printf("%8d", lengths[i]);
+        print_result(ops_array(lengths[i]));
+        for (k = 0; k < 3; ++k)
+            print_result(ops_fifo(kinds[k], lengths[i]));
+        printf("\n");
+    }
+
+    return sink == 0.0;
+}
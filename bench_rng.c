@@ -0,0 +1,589 @@
+/* Benchmark and smoke test of the random-number generators and the
+   variate transforms the simulators use.  First checks that lcgrand_fill
+   and mrand_fill return exactly what successive calls to lcgrand and
+   mrand do, that the integer arithmetic of mrand gives exactly the
+   numbers of its former floating-point arithmetic on every stream of the
+   former seed table, that the lcg_t and mrg_t handles draw what the
+   functions taking a stream number do and save and restore their state,
+   and that philox4x32 gives the published known answers of
+   Philox4x32-10, and reports the nanoseconds per number of the two mrand
+   steps, each waiting on the one before.
+
+   Then, for each source in sources[] (a generator, a bulk form of one, or
+   an exponential transform), reports the nanoseconds per variate and
+   millions of variates per second on one thread, filling a buffer of
+   BUF_SIZE variates at a time as a simulator drawing ahead would, and
+   runs a fast smoke test on NUM_TEST variates: a chi-square test over
+   NUM_BINS equiprobable bins and a test of the lag-1 serial correlation,
+   rejecting at the 0.1% level.  Exponentials are tested through their
+   distribution function, which makes them U(0,1).  Finally reports the
+   total millions of variates per second with 1, 2, 4, ... threads, up to
+   the number of processors or the number given as the argument, each
+   thread drawing NUM_DRAWS variates from its own lcg_t, mrg_t or Philox
+   key, with the speedup over one thread.  The exit status is 1 if a
+   check fails or a test rejects.
+
+   Build: cc -O2 -pthread -o bench_rng bench_rng.c lcgrand.c mrand.c \
+              zigexp.c philox.c -lm */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "lcgrand.h"
+#include "mrand.h"
+#include "zigexp.h"
+#include "philox.h"
+
+#define NUM_DRAWS 20000000   /* Variates timed per source and thread. */
+#define BUF_SIZE  1024       /* Variates generated per fill. */
+#define NUM_TEST  1000000    /* Variates tested per source. */
+#define NUM_BINS  100        /* Bins of the chi-square test. */
+#define MAX_THREADS 64
+#define MRAND_STREAMS 10001  /* Streams of the former mrand seed table. */
+#define MRAND_STEPS   1000   /* Numbers compared per stream. */
+
+float sink;  /* Keeps the compiler from discarding the results. */
+
+
+double now_ns(void)  /* Monotonic wall-clock time in nanoseconds. */
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1.0e9 + ts.tv_nsec;
+}
+
+
+/* Compare lcgrand_fill against lcgrand for several lengths and streams,
+   including the final state of the stream.  Return 1 on a mismatch. */
+
+int check_lcgrand_fill(void)
+{
+    static const int lengths[] = { 0, 1, 7, 8, 9, 63, 64, 1000, BUF_SIZE };
+    float  one[BUF_SIZE], bulk[BUF_SIZE];
+    long   z_start, z_end;
+    int    i, k, stream;
+
+    for (stream = 1; stream <= 100; stream += 11)
+        for (k = 0; k < 9; ++k) {
+            z_start = lcgrandgt(stream);
+            for (i = 0; i < lengths[k]; ++i)
+                one[i] = lcgrand(stream);
+            z_end = lcgrandgt(stream);
+
+            lcgrandst(z_start, stream);
+            lcgrand_fill(bulk, lengths[k], stream);
+            if (lcgrandgt(stream) != z_end ||
+                memcmp(one, bulk, lengths[k] * sizeof(float)) != 0) {
+                printf("lcgrand_fill differs from lcgrand: stream %d, n %d\n",
+                       stream, lengths[k]);
+                return 1;
+            }
+        }
+    return 0;
+}
+
+
+/* The same for mrand_fill against mrand. */
+
+int check_mrand_fill(void)
+{
+    static const int lengths[] = { 0, 1, 7, 8, 9, 63, 64, 1000, BUF_SIZE };
+    double one[BUF_SIZE], bulk[BUF_SIZE], z_start[6], z_end[6], z[6];
+    int    i, k, stream;
+
+    for (stream = 1; stream <= 10000; stream += 1111)
+        for (k = 0; k < 9; ++k) {
+            mrandgt(z_start, stream);
+            for (i = 0; i < lengths[k]; ++i)
+                one[i] = mrand(stream);
+            mrandgt(z_end, stream);
+
+            mrandst(z_start, stream);
+            mrand_fill(bulk, lengths[k], stream);
+            mrandgt(z, stream);
+            if (memcmp(z, z_end, sizeof(z)) != 0 ||
+                memcmp(one, bulk, lengths[k] * sizeof(double)) != 0) {
+                printf("mrand_fill differs from mrand: stream %d, n %d\n",
+                       stream, lengths[k]);
+                return 1;
+            }
+        }
+    return 0;
+}
+
+
+/* One step of mrand as it was computed before, in floating point, on the
+   state z[0..5]. */
+
+double mrand_fp(double *z)
+{
+    const double m1 = 4294967087.0, m2 = 4294944443.0,
+                 norm = 2.328306549295728e-10;
+    long   k;
+    double p,
+           s10 = z[0], s11 = z[1], s12 = z[2],
+           s20 = z[3], s21 = z[4], s22 = z[5];
+
+    p = 1403580.0 * s11 - 810728.0 * s10;
+    k = p / m1;  p -= k*m1;  if (p < 0.0) p += m1;
+    s10 = s11;   s11 = s12;  s12 = p;
+
+    p = 527612.0 * s22 - 1370589.0 * s20;
+    k = p / m2;  p -= k*m2;  if (p < 0.0) p += m2;
+    s20 = s21;   s21 = s22;  s22 = p;
+
+    z[0] = s10;  z[1] = s11;  z[2] = s12;
+    z[3] = s20;  z[4] = s21;  z[5] = s22;
+
+    if (s12 <= s22) return ((s12 - s22 + m1) * norm);
+    else return ((s12 - s22) * norm);
+}
+
+
+/* Compare mrand against mrand_fp for MRAND_STEPS numbers of each stream
+   0 through MRAND_STREAMS-1, and the states they leave.  Return 1 on a
+   mismatch. */
+
+int check_mrand_int(void)
+{
+    double z_fp[6], z[6], u;
+    int    i, stream;
+
+    for (stream = 0; stream < MRAND_STREAMS; ++stream) {
+        mrandgt(z_fp, stream);
+        for (i = 0; i < MRAND_STEPS; ++i) {
+            u = mrand(stream);
+            if (u != mrand_fp(z_fp)) {
+                printf("mrand differs from its floating-point form: "
+                       "stream %d, number %d\n", stream, i + 1);
+                return 1;
+            }
+        }
+        mrandgt(z, stream);
+        if (memcmp(z, z_fp, sizeof(z)) != 0) {
+            printf("mrand leaves a different state: stream %d\n", stream);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/* Compare handles, one allocated and one in an array, against the
+   wrappers on a few streams, saving and restoring the allocated ones half
+   way.  Return 1 on a mismatch. */
+
+int check_handles(void)
+{
+    lcg_t  lcg_local[2], *lcg;
+    mrg_t  mrg_local[2], *mrg;
+    long   z;
+    float  u;
+    double v, zm[6];
+    int    i, stream;
+
+    for (stream = 1; stream <= 100; stream += 33) {
+        lcg = lcg_create(stream);
+        mrg = mrg_create(stream);
+        lcg_seed(&lcg_local[1], stream);
+        mrg_seed(&mrg_local[1], stream);
+        if ((unsigned long) lcg % 64 != 0 || (unsigned long) mrg % 64 != 0 ||
+            (unsigned long) &lcg_local[1] % 64 != 0 ||
+            (unsigned long) &mrg_local[1] % 64 != 0) {
+            printf("a handle is not aligned to a cache line\n");
+            return 1;
+        }
+
+        /* The wrappers' streams have been drawn from already. */
+        lcgrandst(lcg_save(lcg), stream);
+        mrg_save(mrg, zm);
+        mrandst(zm, stream);
+
+        for (i = 0; i < 1000; ++i) {
+            if (i == 500) {
+                z = lcg_save(lcg);
+                mrg_save(mrg, zm);
+                lcg_draw(lcg);
+                mrg_draw(mrg);
+                lcg_restore(lcg, z);
+                mrg_restore(mrg, zm);
+            }
+            u = lcgrand(stream);
+            v = mrand(stream);
+            if (lcg_draw(lcg) != u || lcg_draw(&lcg_local[1]) != u ||
+                mrg_draw(mrg) != v || mrg_draw(&mrg_local[1]) != v) {
+                printf("a handle differs from its wrapper: stream %d\n",
+                       stream);
+                return 1;
+            }
+        }
+        lcg_destroy(lcg);
+        mrg_destroy(mrg);
+    }
+    return 0;
+}
+
+
+/* Known-answer tests of Philox4x32-10 from its authors' Random123
+   library. */
+
+int check_philox(void)
+{
+    static const unsigned int ctr[3][4] = {
+        { 0, 0, 0, 0 },
+        { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+        { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 } };
+    static const unsigned int key[3][2] = {
+        { 0, 0 }, { 0xffffffff, 0xffffffff }, { 0xa4093822, 0x299f31d0 } };
+    static const unsigned int answer[3][4] = {
+        { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 },
+        { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd },
+        { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 } };
+    unsigned int out[4];
+    int          k;
+
+    for (k = 0; k < 3; ++k) {
+        philox4x32(ctr[k], key[k], out);
+        if (memcmp(out, answer[k], sizeof(out)) != 0) {
+            printf("philox4x32 fails known-answer test %d\n", k + 1);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/* Nanoseconds per number of mrand and of mrand_fp, one after another. */
+
+double latency_mrand(void)
+{
+    double sum = 0.0, start;
+    int    i;
+
+    start = now_ns();
+    for (i = 0; i < NUM_DRAWS; ++i)
+        sum += mrand(1);
+    sink += sum;
+    return (now_ns() - start) / NUM_DRAWS;
+}
+
+
+double latency_mrand_fp(void)
+{
+    double sum = 0.0, start, z[6];
+    int    i;
+
+    mrandgt(z, 1);
+    start = now_ns();
+    for (i = 0; i < NUM_DRAWS; ++i)
+        sum += mrand_fp(z);
+    sink += sum;
+    return (now_ns() - start) / NUM_DRAWS;
+}
+
+
+/* The state a source draws from, one per thread.  Thread t uses stream
+   t+1 of lcgrand and mrand and Philox key t+1.  Each lcg_t and mrg_t has a
+   cache line of its own, and so has each state. */
+
+typedef struct {
+    lcg_t              lcg;
+    mrg_t              mrg;
+    unsigned int       key;      /* Philox stream. */
+    unsigned long long counter;  /* Next Philox counter. */
+} state_t;
+
+/* A source of variates: fill(s, x, n) puts the next n, n <= BUF_SIZE,
+   into x[0..n-1]. */
+
+typedef struct {
+    const char *name;
+    int         expon;  /* 1 for exponentials with mean 1, 0 for U(0,1). */
+    void      (*fill)(state_t *s, double *x, int n);
+} source_t;
+
+
+void seed_state(state_t *s, int t)
+{
+    lcg_seed(&s->lcg, t + 1);
+    mrg_seed(&s->mrg, t + 1);
+    s->key     = t + 1;
+    s->counter = 0;
+}
+
+
+void fill_lcgrand(state_t *s, double *x, int n)
+{
+    int i;
+
+    for (i = 0; i < n; ++i)
+        x[i] = lcg_draw(&s->lcg);
+}
+
+
+void fill_lcgrand_bulk(state_t *s, double *x, int n)
+{
+    float u[BUF_SIZE];
+    int   i;
+
+    lcg_fill(&s->lcg, u, n);
+    for (i = 0; i < n; ++i)
+        x[i] = u[i];
+}
+
+
+void fill_mrand(state_t *s, double *x, int n)
+{
+    int i;
+
+    for (i = 0; i < n; ++i)
+        x[i] = mrg_draw(&s->mrg);
+}
+
+
+void fill_mrand_bulk(state_t *s, double *x, int n)
+{
+    mrg_fill(&s->mrg, x, n);
+}
+
+
+void fill_philox(state_t *s, double *x, int n)
+{
+    int i;
+
+    for (i = 0; i < n; ++i)
+        x[i] = philox_u01(s->key, 0, s->counter++);
+}
+
+
+void fill_philox_bulk(state_t *s, double *x, int n)
+{
+    philox_fill(x, n, s->key, 0, s->counter);
+    s->counter += n;
+}
+
+
+void fill_log_lcgrand(state_t *s, double *x, int n)  /* The simulators'
+                                                        expon(). */
+{
+    int i;
+
+    for (i = 0; i < n; ++i)
+        x[i] = -log(lcg_draw(&s->lcg));
+}
+
+
+void fill_log_bulk(state_t *s, double *x, int n)  /* With -DRNG_PRESAMPLE. */
+{
+    float u[BUF_SIZE];
+    int   i;
+
+    lcg_fill(&s->lcg, u, n);
+    for (i = 0; i < n; ++i)
+        x[i] = -log(u[i]);
+}
+
+
+void fill_zig(state_t *s, double *x, int n)  /* With -DFAST_EXPON. */
+{
+    int i;
+
+    for (i = 0; i < n; ++i)
+        x[i] = zig_unit(&s->lcg);
+}
+
+
+void fill_log_philox(state_t *s, double *x, int n)  /* With -DRNG_PHILOX. */
+{
+    int i;
+
+    for (i = 0; i < n; ++i)
+        x[i] = -log(philox_u01(s->key, 0, s->counter++));
+}
+
+
+const source_t sources[] = {
+    { "lcgrand",        0, fill_lcgrand },
+    { "lcgrand_fill",   0, fill_lcgrand_bulk },
+    { "mrand",          0, fill_mrand },
+    { "mrand_fill",     0, fill_mrand_bulk },
+    { "philox_u01",     0, fill_philox },
+    { "philox_fill",    0, fill_philox_bulk },
+    { "log(lcgrand)",   1, fill_log_lcgrand },
+    { "log(fill)",      1, fill_log_bulk },
+    { "zig_expon",      1, fill_zig },
+    { "log(philox)",    1, fill_log_philox } };
+
+#define NUM_SOURCES (int) (sizeof(sources) / sizeof(sources[0]))
+
+
+/* Upper tail probability of the chi-square distribution with df degrees
+   of freedom at x, by the Wilson-Hilferty normal approximation. */
+
+double chi_square_p(double x, int df)
+{
+    double z = (pow(x / df, 1.0 / 3.0) - (1.0 - 2.0 / (9.0 * df))) /
+               sqrt(2.0 / (9.0 * df));
+
+    return 0.5 * erfc(z / sqrt(2.0));
+}
+
+
+/* Test NUM_TEST variates of src, print the results, and return 1 if
+   either test rejects at the 0.1% level.  Under independence the lag-1
+   serial correlation r times sqrt(NUM_TEST) is nearly standard normal. */
+
+int test_source(const source_t *src)
+{
+    static long count[NUM_BINS];
+    state_t     s;
+    double      x[BUF_SIZE], u, last = 0.0, sum = 0.0, sum_sq = 0.0,
+                sum_lag = 0.0, chi_sq = 0.0, expected, mean, r, p_chi,
+                p_serial;
+    int         i, j, bin;
+
+    seed_state(&s, 0);
+    for (bin = 0; bin < NUM_BINS; ++bin)
+        count[bin] = 0;
+    for (j = 0; j < NUM_TEST; j += BUF_SIZE) {
+        src->fill(&s, x, NUM_TEST - j < BUF_SIZE ? NUM_TEST - j : BUF_SIZE);
+        for (i = 0; i < BUF_SIZE && j + i < NUM_TEST; ++i) {
+            u        = src->expon ? -expm1(-x[i]) : x[i];
+            sum     += u;
+            sum_sq  += u * u;
+            sum_lag += u * last;
+            last     = u;
+            bin      = (int) (NUM_BINS * u);
+            ++count[bin < NUM_BINS ? bin : NUM_BINS - 1];
+        }
+    }
+
+    expected = (double) NUM_TEST / NUM_BINS;
+    for (bin = 0; bin < NUM_BINS; ++bin)
+        chi_sq += (count[bin] - expected) * (count[bin] - expected) / expected;
+    p_chi    = chi_square_p(chi_sq, NUM_BINS - 1);
+    mean     = sum / NUM_TEST;
+    r        = (sum_lag / (NUM_TEST - 1) - mean * mean) /
+               (sum_sq / NUM_TEST - mean * mean);
+    p_serial = erfc(fabs(r) * sqrt((double) NUM_TEST) / sqrt(2.0));
+
+    printf(" %10.2f %8.4f %9.5f %8.4f\n", chi_sq, p_chi, r, p_serial);
+    return p_chi < 0.001 || p_serial < 0.001;
+}
+
+
+/* One thread's share of a timing run. */
+
+typedef struct {
+    state_t         state;
+    const source_t *src;
+    double          sum;
+} job_t;
+
+
+void *run_job(void *arg)
+{
+    job_t *job = arg;
+    double x[BUF_SIZE], sum = 0.0;
+    int    j;
+
+    for (j = 0; j < NUM_DRAWS / BUF_SIZE; ++j) {
+        job->src->fill(&job->state, x, BUF_SIZE);
+        sum += x[j % BUF_SIZE];
+    }
+    job->sum = sum;
+    return NULL;
+}
+
+
+/* Total millions of variates per second of src on num_threads threads. */
+
+double rate_source(const source_t *src, int num_threads)
+{
+    static job_t job[MAX_THREADS];
+    pthread_t    thread[MAX_THREADS];
+    double       start, elapsed;
+    int          t;
+
+    for (t = 0; t < num_threads; ++t) {
+        seed_state(&job[t].state, t);
+        job[t].src = src;
+    }
+    start = now_ns();
+    for (t = 1; t < num_threads; ++t)
+        if (pthread_create(&thread[t], NULL, run_job, &job[t]) != 0) {
+            fprintf(stderr, "\nbench_rng: cannot start a thread\n");
+            exit(3);
+        }
+    run_job(&job[0]);
+    for (t = 1; t < num_threads; ++t)
+        pthread_join(thread[t], NULL);
+    elapsed = now_ns() - start;
+
+    for (t = 0; t < num_threads; ++t)
+        sink += job[t].sum;
+    return 1.0e3 * num_threads * (NUM_DRAWS / BUF_SIZE) * BUF_SIZE / elapsed;
+}
+
+
+int main(int argc, char *argv[])
+{
+    double one, bulk, rate[NUM_SOURCES];
+    int    rejected = 0, max_threads, num_threads, k;
+
+    max_threads = argc > 1 ? atoi(argv[1])
+                           : (int) sysconf(_SC_NPROCESSORS_ONLN);
+    if (max_threads < 1)
+        max_threads = 1;
+    if (max_threads > MAX_THREADS)
+        max_threads = MAX_THREADS;
+
+    if (check_lcgrand_fill() || check_mrand_fill() || check_mrand_int() ||
+        check_handles() || check_philox())
+        return 1;
+    printf("lcgrand_fill and mrand_fill match lcgrand and mrand exactly\n");
+    printf("mrand matches its floating-point form on streams 0-%d\n",
+           MRAND_STREAMS - 1);
+    printf("lcg_t and mrg_t handles match lcgrand and mrand\n");
+    printf("philox4x32 passes its known-answer tests\n\n");
+
+    printf("%-14s %10s %8s\n", "mrand step", "ns/number", "speedup");
+    one  = latency_mrand_fp();
+    bulk = latency_mrand();
+    printf("%-14s %10.2f %8.2f\n", "floating", one, 1.0);
+    printf("%-14s %10.2f %8.2f\n\n", "integer", bulk, one / bulk);
+
+    printf("%-14s %8s %8s %10s %8s %9s %8s\n", "source", "ns/var",
+           "M/sec", "chi-square", "p", "lag-1 r", "p");
+    for (k = 0; k < NUM_SOURCES; ++k) {
+        rate[k] = rate_source(&sources[k], 1);
+        printf("%-14s %8.2f %8.1f", sources[k].name, 1.0e3 / rate[k],
+               rate[k]);
+        rejected |= test_source(&sources[k]);
+    }
+
+    printf("\n%-14s", "M/sec, threads");
+    for (num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+        printf(" %8d %7s", num_threads, "speedup");
+    printf("\n");
+    for (k = 0; k < NUM_SOURCES; ++k) {
+        printf("%-14s", sources[k].name);
+        for (num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+            one = num_threads == 1 ? rate[k]
+                                   : rate_source(&sources[k], num_threads);
+            printf(" %8.1f %7.2f", one, one / rate[k]);
+        }
+        printf("\n");
+    }
+
+    if (rejected)
+        return 1;
+    return sink == 0.0;
+}
@@ -6,227 +6,501 @@
 #include <stdio.h>  
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
+#include "evlist.h"   /* Header file for the future event list. */
+#include "fifo.h"     /* Header file for the FIFO queues. */
+#include "twheel.h"   /* Header file for the timing wheel. */
 #include "lcgrand.h"  /* Header file for exponential random-number generator */
+#include "zigexp.h"   /* Header file for the ziggurat exponential generator. */
+#include "philox.h"   /* Header file for the counter-based generator. */
+#include "rngpipe.h"  /* Header file for the variate pipeline. */
+#include "presample.h" /* Header file for the pre-sampled variates. */
+#include "pool.h"     /* Header file for the pool of worker threads. */
+#include "reps.h"     /* Header file for the parallel replications. */
+#include "sweep.h"    /* Header file for the parameter sweeps. */
 #include "mrand.h"    /* Header file for uniform random-number generator */
 
-#define Q_LIMIT  150  /* Limit on queue length. */
+#ifndef Q_LIMIT
+#define Q_LIMIT    0  /* Limit on queue length, or 0 for none. */
+#endif
 #define BUSY       1  /* Mnemonics for server's being busy */
 #define IDLE       0  /* and idle. */
 
-int   next_event_type, num_custs_delayed, num_events, num_in_q[2], server_status[2],
-      num_in_transit, max_in_transit;
-float area_num_in_q[2], area_server_status[2], mean_interarrival, mean_service[2],
-      sim_time, time_end, time_last_event, time_next_event[6], total_of_delays[2], 
-      area_in_transit;
-FILE  *infile, *outfile, *debugfile;
-
-/* Define linked list node */
-typedef struct node {
-    float t;
-    struct node * next;
-} node_t;
-
-node_t * head1 = NULL;
-node_t * head2 = NULL;
-
-void  initialize(void);
-void  timing(void);
-void  queue1_arrival(void);
-void  queue1_departure(void);
-void  queue2_arrival(void);
-void  queue2_departure(void);
-void  report(void);
-void  update_time_avg_stats(void);
-void  enqueue(node_t * head, int t);
-float dequeue(node_t ** head);
-float expon(float mean);
-float uniform(int b);
-
-
+#define TRANSIT_TICK (2.0 / 65536)  /* Timing-wheel tick; the two lowest
+                                       levels span the longest transit. */
+
+#if defined(RNG_PIPELINE) && defined(RNG_PHILOX)
+#error "RNG_PIPELINE and RNG_PHILOX cannot be used together"
+#endif
+
+#if defined(RNG_PRESAMPLE) && (defined(RNG_PHILOX) || defined(RNG_PIPELINE))
+#error "RNG_PRESAMPLE cannot be used with RNG_PHILOX or RNG_PIPELINE"
+#endif
+
+#ifdef LOCKSTEP
+#error "LOCKSTEP is only available in tandem_system.c"
+#endif
+
+#if defined(LINDLEY) || defined(LINDLEY_CHECK)
+#error "LINDLEY is only available in tandem_system.c"
+#endif
+
+/* State of one simulation.  Everything a run reads or writes is kept here
+   rather than in file-scope variables and passed to every function below,
+   so that any number of simulations can run in one process, each with its
+   own sim_t.  The fields used on every event are grouped in the first two
+   cache lines. */
+
+typedef struct {
+    /* Clock, system state and time-average accumulators, used on every
+       event: the first cache line. */
+    _Alignas(64) float sim_time;
+    float time_last_event;
+    int   next_event_type, num_in_q[2], server_status[2], num_in_transit,
+          max_in_transit, num_custs_delayed;
+    float area_num_in_q[2], area_server_status[2], total_of_delays[2];
+
+    /* Future event list and the handle of the pending event of each
+       type, the times of arrival of the customers waiting in each queue,
+       and the debug file written on every event: the second.  Transit is
+       an infinite-server delay station: every customer in transit has its
+       own pending arrival (type 3) at the second queue.  Transit times are
+       bounded, so these are kept on a timing wheel. */
+    _Alignas(64) evlist_t *event_list;
+    int       event_handle[6];
+    fifo_t   *time_arrival[2];
+    twheel_t *transit_wheel;
+    FILE     *debugfile;
+
+    /* Parameters, the transit accumulator and the files. */
+    float mean_interarrival, mean_service[2], time_end, area_in_transit;
+    FILE  *infile, *outfile;
+#ifdef SWEEP
+    /* File report writes the result row to, and the point of the sweep
+       and replication the row belongs to. */
+    FILE  *rowfile;
+    int   point, rep;
+#endif
+
+    /* Random numbers: expon draws from stream 1 of lcgrand and uniform
+       from stream 1 of mrand, each held in a cache line of its own. */
+    lcg_t expon_rng;
+    mrg_t uniform_rng;
+#ifdef RNG_PHILOX
+    /* Counter-based streams (1 for expon, 2 for uniform): the replication
+       they belong to and the next counter of each. */
+    unsigned int       replication;
+    unsigned long long rng_counter[3];
+#endif
+#ifdef RNG_PIPELINE
+    /* Variates made ahead by a producer thread (see rngpipe.c), built
+       with -DRNG_PIPELINE -pthread: ring 0 holds exponentials of mean 1
+       for expon and ring 1 U(0,1) numbers for uniform. */
+    rngpipe_t *rng_pipe;
+#endif
+#ifdef RNG_PRESAMPLE
+    /* Variates sampled ahead of each replication (see presample.c), built
+       with -DRNG_PRESAMPLE: exponentials of mean 1 for expon and U(0,1)
+       numbers for uniform. */
+    presample_t *expon_sample, *uniform_sample;
+#endif
+} sim_t;
+
+void  setup(sim_t *sim, int stream);
+void  run_replication(sim_t *sim);
+void  teardown(sim_t *sim);
+#ifdef SWEEP
+void  sweep_point(const float *param, int point, int rep, FILE *rowfile);
+#endif
+#ifdef PARALLEL_REPS
+void  replicate(void *arg, int r, FILE *outfile, FILE *debugfile);
+#endif
+void  initialize(sim_t *sim);
+void  timing(sim_t *sim);
+void  schedule(sim_t *sim, int type, float time);
+void  cancel(sim_t *sim, int type);
+void  queue1_arrival(sim_t *sim);
+void  queue1_departure(sim_t *sim);
+void  queue2_arrival(sim_t *sim);
+void  queue2_departure(sim_t *sim);
+void  report(sim_t *sim);
+void  update_time_avg_stats(sim_t *sim);
+float expon(sim_t *sim, float mean);
+float uniform(sim_t *sim, int b);
+#ifdef RNG_PIPELINE
+double unit_expon(void *arg);
+double unit_uniform(void *arg);
+#endif
+#ifdef RNG_PRESAMPLE
+void  fill_expon(void *arg, double *x, int n);
+void  fill_uniform(void *arg, double *x, int n);
+#endif
+
+
+#ifdef SWEEP
+int main(int argc, char *argv[])  /* Main function of a parameter sweep.
+                                     argv[1], if given, is the number of
+                                     threads. */
+{
+    /* Run every replication of every point of dynamic.sweep, writing a row
+       for each to dynamic.sweep.out. */
+    sweep_run("dynamic",
+              "point,replication,mean_interarrival,mean_service1,"
+              "mean_service2,time_end,delay_system,delay_q1,"
+              "number_q1,delay_q2,number_q2,number_transit,"
+              "max_transit,util1,util2,end_time",
+              argc > 1 ? atoi(argv[1]) : 0, sweep_point);
+    return 0;
+}
+#else
+#ifdef PARALLEL_REPS
+int main(int argc, char *argv[])  /* Main function.  argv[1], if given, is
+                                     the number of threads. */
+#else
 int main()  /* Main function. */
+#endif
 {
-    /* Open input and output files. */
-    infile  = fopen("dynamic.in",  "r");
-    outfile = fopen("dynamic.out", "w");
-	debugfile = fopen("debug.out", "w");
+    sim_t sim;
+    int   replications = 10;
+#ifndef PARALLEL_REPS
+    int   i;
+#endif
 
-    /* Specify the number of events for the timing function. */
-    num_events = 5;
+    /* Open input and output files. */
+    sim.infile    = fopen("dynamic.in",  "r");
+    sim.outfile   = fopen("dynamic.out", "w");
+    sim.debugfile = fopen("debug.out", "w");
 
     /* Read input parameters. */
-    fscanf(infile, "%f %f %f %f", &mean_interarrival, &mean_service[0],
-           &mean_service[1], &time_end);
+    fscanf(sim.infile, "%f %f %f %f", &sim.mean_interarrival,
+           &sim.mean_service[0], &sim.mean_service[1], &sim.time_end);
 
     /* Write report heading and input parameters. */
-    fprintf(outfile, "Tandem-server queueing system\n\n");
-    fprintf(outfile, "Mean interarrival time%11.3f minutes\n\n",
-            mean_interarrival);
-    fprintf(outfile, "SRVR1 mean service time%16.3f minutes\n\n", mean_service[0]);
-	fprintf(outfile, "SRVR2 mean service time%16.3f minutes\n\n", mean_service[1]);
-    fprintf(outfile, "Length of the simulation%16.3f minutes\n\n", time_end);
+    fprintf(sim.outfile, "Tandem-server queueing system\n\n");
+    fprintf(sim.outfile, "Mean interarrival time%11.3f minutes\n\n",
+            sim.mean_interarrival);
+    fprintf(sim.outfile, "SRVR1 mean service time%16.3f minutes\n\n",
+            sim.mean_service[0]);
+    fprintf(sim.outfile, "SRVR2 mean service time%16.3f minutes\n\n",
+            sim.mean_service[1]);
+    fprintf(sim.outfile, "Length of the simulation%16.3f minutes\n\n",
+            sim.time_end);
+
+#ifdef PARALLEL_REPS
+    /* Run the ten replications on argv[1] threads, or one per processor,
+       each on its own streams. */
+    reps_run(replications, argc > 1 ? atoi(argv[1]) : 0, sim.outfile,
+             sim.debugfile, replicate, &sim);
+#else
+    /* Create the queues, the event list and the random-number streams. */
+    setup(&sim, 1);
+
+    /* Run simulation ten times total */
+    for (i = 0; i < replications; i++)
+        run_replication(&sim);
+
+    teardown(&sim);
+#endif
+    fclose(sim.infile);
+    fclose(sim.outfile);
+
+    return 0;
+}
+#endif
 
 
-    /* Initialize dynamic event lists */
-    head1 = malloc(sizeof(node_t));
-    head2 = malloc(sizeof(node_t));
+void setup(sim_t *sim, int stream)  /* Create the queues, the event list
+                                       and the random-number streams of sim,
+                                       which start at stream "stream". */
+{
+    sim->time_arrival[0] = fifo_create(FIFO_LIST, 0);
+    sim->time_arrival[1] = fifo_create(FIFO_LIST, 0);
+    fifo_limit(sim->time_arrival[0], Q_LIMIT);
+    fifo_limit(sim->time_arrival[1], Q_LIMIT);
+    sim->event_list = evlist_create(EVLIST_DEFAULT);
+    sim->transit_wheel = twheel_create(TRANSIT_TICK);
+
+    lcg_seed(&sim->expon_rng, stream);
+    mrg_seed(&sim->uniform_rng, stream);
+#ifdef RNG_PHILOX
+    /* The first replication is numbered "stream", which keys its streams. */
+    sim->replication = stream - 1;
+#endif
+#ifdef RNG_PIPELINE
+    {
+        static double (*const unit_gen[])(void *) = { unit_expon,
+                                                       unit_uniform };
 
-    if (head1 == NULL || head2 == NULL) {
-        return 1;
+        sim->rng_pipe = rngpipe_create(2, unit_gen, sim, 4096);
     }
+#endif
+#ifdef RNG_PRESAMPLE
+    sim->expon_sample   = presample_create(fill_expon, sim);
+    sim->uniform_sample = presample_create(fill_uniform, sim);
+#endif
+}
 
-    head1->t = 0.0;
-    head2->t = 0.0;
-    head1->next = NULL;
-    head2->next = NULL;
-
-    /* Replicate the simulation a total of ten times */
-    int replications = 10;
-
-	for (int i = 0; i < replications; i++) {
-        /* Initialize the simulation. */
-        initialize();
-
-        /* Run the simulation until the end time is reached */
-        do {
-            /* Determine the next event. */
-            timing();
-
-            /* Update time-average statistical accumulators. */
-            update_time_avg_stats();
-
-		    /* Log loop information to debug file */
-		    fprintf(debugfile, "\nCALL:%d    TIME:%f\n", next_event_type, sim_time);
-    	    fprintf(debugfile, "#Q1 :%d    #Q2 :%d\n", num_in_q[0], num_in_q[1]);
-    	    fprintf(debugfile, "SRV1:%d    SRV2:%d\n",
-                    server_status[0], server_status[1]);
-
-            /* Invoke the appropriate event function. */
-            switch (next_event_type) 
-            {
-                case 1:
-                    queue1_arrival();
-                    break;
-                case 2:
-                    queue1_departure();
-                    break;
-                case 3:
-                    queue2_arrival();
-                    break;
-                case 4:
-                    queue2_departure();
-                    break;
-                case 5:
-                    report();
-                    break;
-            }
-
-	    /* If the last event was not the end-simulation event, continue */
-	    } while (next_event_type != 5);
-	}
 
-    fclose(infile);
-    fclose(outfile);
+void run_replication(sim_t *sim)  /* Run one replication of sim, from
+                                     initialization to the end-simulation
+                                     event. */
+{
+    /* Initialize the simulation. */
+    initialize(sim);
+
+    /* Run the simulation until the end time is reached */
+    do {
+        /* Determine the next event. */
+        timing(sim);
+
+        /* Update time-average statistical accumulators. */
+        update_time_avg_stats(sim);
+
+        /* Log loop information to debug file */
+#ifndef SWEEP
+        fprintf(sim->debugfile, "\nCALL:%d    TIME:%f\n", sim->next_event_type,
+                sim->sim_time);
+        fprintf(sim->debugfile, "#Q1 :%d    #Q2 :%d\n", sim->num_in_q[0],
+                sim->num_in_q[1]);
+        fprintf(sim->debugfile, "SRV1:%d    SRV2:%d\n",
+                sim->server_status[0], sim->server_status[1]);
+#endif
+
+        /* Invoke the appropriate event function. */
+        switch (sim->next_event_type)
+        {
+            case 1:
+                queue1_arrival(sim);
+                break;
+            case 2:
+                queue1_departure(sim);
+                break;
+            case 3:
+                queue2_arrival(sim);
+                break;
+            case 4:
+                queue2_departure(sim);
+                break;
+            case 5:
+                report(sim);
+                break;
+        }
 
-    return 0;
+    /* If the last event was not the end-simulation event, continue */
+    } while (sim->next_event_type != 5);
 }
 
 
-void initialize(void)  /* Initialization function. */
+void teardown(sim_t *sim)  /* Free what setup() created. */
+{
+    evlist_destroy(sim->event_list);
+    fifo_destroy(sim->time_arrival[0]);
+    fifo_destroy(sim->time_arrival[1]);
+    twheel_destroy(sim->transit_wheel);
+#ifdef RNG_PIPELINE
+    rngpipe_destroy(sim->rng_pipe);
+#endif
+#ifdef RNG_PRESAMPLE
+    presample_destroy(sim->expon_sample);
+    presample_destroy(sim->uniform_sample);
+#endif
+}
+
+
+#ifdef SWEEP
+/* Parameter sweep, built with -DSWEEP -pthread, pool.c and sweep.c, over
+   the grid in dynamic.sweep (see sweep.c).  sweep_point() runs replication
+   rep of point "point" with the parameters param[0..3], from stream rep
+   so that the points are compared on common random numbers, and report
+   writes its row of results to rowfile. */
+
+void sweep_point(const float *param, int point, int rep, FILE *rowfile)
+{
+    sim_t sim;
+
+    sim.mean_interarrival = param[0];
+    sim.mean_service[0]   = param[1];
+    sim.mean_service[1]   = param[2];
+    sim.time_end          = param[3];
+    sim.point             = point;
+    sim.rep               = rep;
+
+    /* No debug log is kept, and errors go to stderr. */
+    sim.infile    = NULL;
+    sim.outfile   = stderr;
+    sim.debugfile = NULL;
+    sim.rowfile   = rowfile;
+
+    setup(&sim, rep);
+    run_replication(&sim);
+    teardown(&sim);
+}
+#endif
+
+
+#ifdef PARALLEL_REPS
+/* Parallel replications, built with -DPARALLEL_REPS -pthread and reps.c.
+   Replication r (r = 1, 2, ...) gets a sim_t of its own, set up to start
+   at stream r of each generator (lcgrand has 100) or, with RNG_PHILOX, to
+   be numbered r, so its results do not depend on which thread runs it or
+   when, and reps_run merges the reports and debug logs in replication
+   order: the output is the same for any number of threads.  replicate()
+   runs replication r of the simulation (sim_t *) arg, writing its report
+   to outfile and its debug log to debugfile. */
+
+void replicate(void *arg, int r, FILE *outfile, FILE *debugfile)
+{
+    sim_t sim = *(const sim_t *) arg;
+
+    sim.outfile   = outfile;
+    sim.debugfile = debugfile;
+    setup(&sim, r);
+    run_replication(&sim);
+    teardown(&sim);
+}
+#endif
+
+
+void initialize(sim_t *sim)  /* Initialization function. */
 {
 	int i;
 
     /* Initialize the simulation clock. */
-    sim_time = 0.0;
+    sim->sim_time = 0.0;
 
     /* Initialize the state variables and statistical counters. */
 	for (i = 0; i < 2; i++) {
-        server_status[i]      = IDLE;		
-        num_in_q[i]           = 0;
-        total_of_delays[i]    = 0.0;
-        area_num_in_q[i]      = 0.0;
-        area_server_status[i] = 0.0;
-        area_in_transit       = 0.0;
+        sim->server_status[i]      = IDLE;		
+        sim->num_in_q[i]           = 0;
+        sim->total_of_delays[i]    = 0.0;
+        sim->area_num_in_q[i]      = 0.0;
+        sim->area_server_status[i] = 0.0;
+        sim->area_in_transit       = 0.0;
+        fifo_clear(sim->time_arrival[i]);
 	}
 
-    num_in_transit     = 0;
-    max_in_transit     = 0;
-    num_custs_delayed  = 0;
-    time_last_event    = 0.0;
+    sim->num_in_transit     = 0;
+    sim->max_in_transit     = 0;
+    sim->num_custs_delayed  = 0;
+    sim->time_last_event    = 0.0;
+
+#ifdef RNG_PHILOX
+    /* Start the new replication's own streams from counter 0. */
+    ++sim->replication;
+    sim->rng_counter[1] = 0;
+    sim->rng_counter[2] = 0;
+#endif
+
+#ifdef RNG_PRESAMPLE
+    /* Sample what the replication is expected to use, with 5% to spare:
+       each customer takes an interarrival time and two service times, and
+       a transit time. */
+    presample_reserve(sim->expon_sample,
+                      (int) (3.15 * sim->time_end / sim->mean_interarrival)
+                      + 64);
+    presample_reserve(sim->uniform_sample,
+                      (int) (1.05 * sim->time_end / sim->mean_interarrival)
+                      + 64);
+#endif
 
     /* Initialize event list.  Since no customers are present, the departure
-       (service completion) and tandem switch events are eliminated from consideration. */
-    time_next_event[1] = sim_time + expon(mean_interarrival);
-    time_next_event[2] = 1.0e+30;
-    time_next_event[3] = 1.0e+30;
-    time_next_event[4] = 1.0e+30;
-    time_next_event[5] = time_end;
+       (service completion) and tandem switch events are not scheduled. */
+    evlist_clear(sim->event_list);
+    twheel_clear(sim->transit_wheel);
+    for (i = 1; i <= 5; ++i)
+        sim->event_handle[i] = EVLIST_NONE;
+
+    schedule(sim, 1, sim->sim_time + expon(sim, sim->mean_interarrival));
+    schedule(sim, 5, sim->time_end);
 }
 
 
-void timing(void)  /* Timing function. */
+void timing(sim_t *sim)  /* Timing function. */
 {
-    int   i;
-    float min_time_next_event = 1.0e+29;
-
-    next_event_type = 0;
-
-    /* Determine the event type of the next event to occur. */
-    for (i = 1; i <= num_events; ++i)
-        if (time_next_event[i] < min_time_next_event)
-        {   
-            min_time_next_event = time_next_event[i];
-            next_event_type     = i;
-        }
+    float time, wheel, list;
+
+    /* Remove the next event to occur from the event list, unless a
+       customer's transit ends sooner, or at the same time as an event of
+       a higher type: ties go to the lower type, as within the list. */
+    wheel = twheel_peek(sim->transit_wheel);
+    list  = evlist_peek(sim->event_list);
+    if (wheel < list
+        || (wheel == list && evlist_peek_type(sim->event_list) > 3))
+        sim->next_event_type = twheel_pop(sim->transit_wheel, &time);
+    else
+        sim->next_event_type = evlist_pop(sim->event_list, &time);
 
     /* Check to see whether the event list is empty. */
-    if (next_event_type == 0)
+    if (sim->next_event_type == 0)
     {
         /* The event list is empty, so stop the simulation. */
-        fprintf(outfile, "\nEvent list empty at time %f", sim_time);
+        fprintf(sim->outfile, "\nEvent list empty at time %f", sim->sim_time);
         exit(1);
     }
 
     /* The event list is not empty, so advance the simulation clock. */
-    sim_time = min_time_next_event;
+    sim->event_handle[sim->next_event_type] = EVLIST_NONE;
+    sim->sim_time = time;
 }
 
 
-void queue1_arrival(void)  /* Arrive in the system (queue one) */
+void schedule(sim_t *sim, int type, float time)  /* Schedule the pending
+                                                    event of type "type" to
+                                                    occur at time "time". */
+{
+    if (sim->event_handle[type] == EVLIST_NONE)
+        sim->event_handle[type] = evlist_schedule(sim->event_list, type, time);
+    else
+        sim->event_handle[type] = evlist_reschedule(sim->event_list,
+                                                    sim->event_handle[type],
+                                                    time);
+}
+
+
+void cancel(sim_t *sim, int type)  /* Remove the pending event of type
+                                      "type", if any. */
+{
+    if (sim->event_handle[type] != EVLIST_NONE) {
+        evlist_cancel(sim->event_list, sim->event_handle[type]);
+        sim->event_handle[type] = EVLIST_NONE;
+    }
+}
+
+
+void queue1_arrival(sim_t *sim)  /* Arrive in the system (queue one) */
 {
     float delay;
 
     /* Schedule next arrival. */
-    time_next_event[1] = sim_time + expon(mean_interarrival);
+    schedule(sim, 1, sim->sim_time + expon(sim, sim->mean_interarrival));
 
     /* Check to see whether server is busy. */
-    if (server_status[0] == BUSY) {
+    if (sim->server_status[0] == BUSY) {
         /* Server is busy, so increment number of customers in the first queue. */
-        ++num_in_q[0];
-
-        /* Check to see whether an overflow condition exists. */
-        if (num_in_q[0] > Q_LIMIT) {
-            /* The queue has overflowed, so stop the simulation. */
-            fprintf(outfile, "\nOverflow of the first array time_arrival at");
-            fprintf(outfile, " time %f \n\n", sim_time);
+        ++sim->num_in_q[0];
+
+        /* Enqueue the time of arrival of the arriving customer, unless the
+           queue has reached Q_LIMIT. */
+        if (fifo_push(sim->time_arrival[0], sim->sim_time)) {
+            /* The queue has reached Q_LIMIT, so stop the simulation. */
+            fprintf(sim->outfile,
+                    "\nOverflow of the first array time_arrival at");
+            fprintf(sim->outfile, " time %f \n\n", sim->sim_time);
             exit(2);
         }
-
-        /* There is still room in the queue, so enqueue time of arrival of the
-           arriving customer */
-        enqueue(head1, sim_time);
     }
 
     else {
         /* Server is idle, so arriving customer has a delay of zero.*/
         delay = 0.0;
-        total_of_delays[0] += delay;
+        sim->total_of_delays[0] += delay;
 
         /* Increment the number of customers delayed, and make server busy. */
-        ++num_custs_delayed;
-        server_status[0] = BUSY;
+        ++sim->num_custs_delayed;
+        sim->server_status[0] = BUSY;
 
         /* Schedule arrival at the second queue */
-        time_next_event[2] = sim_time + expon(mean_service[0]);
+        schedule(sim, 2, sim->sim_time + expon(sim, sim->mean_service[0]));
     }
 }
 
@@ -234,216 +508,277 @@ void queue1_arrival(void)  /* Arrive in the system (queue one) */
 /* Tandem-queue switching function. Removes the customer from the first service
    queue, then adds the customer to the second service queue and schedules departure */
 
-void queue1_departure(void) 
+void queue1_departure(sim_t *sim) 
 {
 	int i;
 	float delay;
 
+	/* The departing customer enters transit to the second queue. */
+	twheel_schedule(sim->transit_wheel, 3, sim->sim_time + uniform(sim, 2));
+	++sim->num_in_transit;
+
 	/* Check to see whether the first queue is empty */
-	if (num_in_q[0] == 0) {
+	if (sim->num_in_q[0] == 0) {
 		/* The first queue is empty so make the server idle */
-		server_status[0]   = IDLE;
-		time_next_event[2] = 1.0e+30;
+		sim->server_status[0]   = IDLE;
+		cancel(sim, 2);
 	}
 	
 	/* Decrement the number of customers in the first queue. */
 	else {
-		--num_in_q[0];
+		--sim->num_in_q[0];
 
         /* Dequeue the customer beginning service */
-        float head_val   = dequeue(&head1);
+        float head_val   = fifo_pop(sim->time_arrival[0]);
 
         /* Compute the delay for the customer and update the total 
            delay accumulator. */
-        delay            = sim_time - head_val;
-        total_of_delays[0] += delay;
+        delay            = sim->sim_time - head_val;
+        sim->total_of_delays[0] += delay;
 
 		/* Increment number of customers delayed */
-		++num_custs_delayed;
-		server_status[0] = BUSY;
+		++sim->num_custs_delayed;
+		sim->server_status[0] = BUSY;
 
 		/* Schedule next queue 1 departure */
-		time_next_event[2] = sim_time + expon(mean_service[0]);
-
-		
-        /* Schedule next arrival at queue 2 */
-        time_next_event[3] = sim_time + uniform(2);
-        num_in_transit++;	
+		schedule(sim, 2, sim->sim_time + expon(sim, sim->mean_service[0]));
 	}
 
 }
 
-void queue2_arrival(void) /* Arrive at the second queue */
+void queue2_arrival(sim_t *sim) /* Arrive at the second queue */
 {
 	float delay;
 
-	/* Wait for the next arrival afterward*/
-    if (num_in_transit == 0) {
-        time_next_event[3] = 1.0e30;
-    }
-    else {
-        num_in_transit--;    
-    }
+	/* The customer's transit is over. */
+    --sim->num_in_transit;
+
 	/* Check to see whether the second server is busy. */
-	if (server_status[1] == BUSY) {
+	if (sim->server_status[1] == BUSY) {
 		/* Second server is busy, so increment the number of customers in
 		 * the second queue. */
-		++num_in_q[1];
-
-		if (num_in_q[1] > Q_LIMIT) {
-			/* The second queue has overflowed; stop the simulation. */	
-            fprintf(outfile, "\nOverflow of the second array time_arrival at");
-            fprintf(outfile, " time %f \n\n", sim_time);
+		++sim->num_in_q[1];
+
+        /* Enqueue the time of arrival of the arriving customer, unless the
+           queue has reached Q_LIMIT. */
+		if (fifo_push(sim->time_arrival[1], sim->sim_time)) {
+			/* The second queue has reached Q_LIMIT; stop the simulation. */
+            fprintf(sim->outfile,
+                    "\nOverflow of the second array time_arrival at");
+            fprintf(sim->outfile, " time %f \n\n", sim->sim_time);
             exit(2);
 		}
-
-        /* There is still room in the queue, so enqueue time of arrival of the
-           arriving customer */
-        enqueue(head2, sim_time);
 	}
 
 	else {
 		/* Second server is idle; current customer has delay of 0 */
 		delay			 = 0.0;
-		total_of_delays[1] += delay;
+		sim->total_of_delays[1] += delay;
 
 		/* Make second server busy, but do not increment number of customers delayed */
-		server_status[1] = BUSY;
+		sim->server_status[1] = BUSY;
 
 		/* Schedule system departure for the current customer*/
-		time_next_event[4] = sim_time + expon(mean_service[1]);
+		schedule(sim, 4, sim->sim_time + expon(sim, sim->mean_service[1]));
 	}
 }
 
-void queue2_departure(void)  /* Departure event function. */
+void queue2_departure(sim_t *sim)  /* Departure event function. */
 {
     int   i;
     float delay;
 
     /* Check to see whether the queue is empty. */
-    if (num_in_q[1] == 0) {
+    if (sim->num_in_q[1] == 0) {
         /* The queue is empty so make the server idle and eliminate the
            departure (service completion) event from consideration. */
-        server_status[1]      = IDLE;
-        time_next_event[4]    = 1.0e+30;
+        sim->server_status[1]      = IDLE;
+        cancel(sim, 4);
     }
 
     else {
         /* The queue is nonempty, so decrement the number of customers in
            queue. */
-        --num_in_q[1];
+        --sim->num_in_q[1];
 
         /* Dequeue the customer who is beginning service */
-        float head_val = dequeue(&head2);
+        float head_val = fifo_pop(sim->time_arrival[1]);
 
         /* Compute the delay of the customer and update the total 
            delay accumulator. */
-        delay            = sim_time - head_val;
-        total_of_delays[1] += delay;
+        delay            = sim->sim_time - head_val;
+        sim->total_of_delays[1] += delay;
 
         /* Increment the number of customers delayed, and schedule departure. */
-        ++num_custs_delayed;
+        ++sim->num_custs_delayed;
 
 		/* Make server busy and schedule departure */
-		server_status[1]   = BUSY;
-        time_next_event[4] = sim_time + expon(mean_service[1]);
+		sim->server_status[1]   = BUSY;
+        schedule(sim, 4, sim->sim_time + expon(sim, sim->mean_service[1]));
     }
 }
 
 
-void report(void)  /* Report generator function. */
+void report(sim_t *sim)  /* Report generator function. */
 {
+#ifdef SWEEP
+    /* Write the estimates as one row of the sweep's results, whole and at
+       once, since other threads write rows to the same file. */
+    flockfile(sim->rowfile);
+    fprintf(sim->rowfile, "%d,%d,%g,%g,%g,%g,%.6g,%.6g,%.6g,%.6g,%.6g,"
+                          "%.6g,%d,%.6g,%.6g,%.6g\n",
+            sim->point, sim->rep, sim->mean_interarrival,
+            sim->mean_service[0], sim->mean_service[1], sim->time_end,
+            (sim->total_of_delays[0] + sim->total_of_delays[1])
+            / sim->num_custs_delayed,
+            sim->total_of_delays[0] / sim->num_custs_delayed,
+            sim->area_num_in_q[0] / sim->sim_time,
+            sim->total_of_delays[1] / sim->num_custs_delayed,
+            sim->area_num_in_q[1] / sim->sim_time,
+            sim->area_in_transit / sim->sim_time, sim->max_in_transit,
+            sim->area_server_status[0] / sim->sim_time,
+            sim->area_server_status[1] / sim->sim_time, sim->sim_time);
+    fflush(sim->rowfile);
+    funlockfile(sim->rowfile);
+#else
     /* Compute and write estimates of desired measures of performance. */
-    fprintf(outfile, "\n\nAverage delay in system:  %10.3f minutes\n\n",
-            (total_of_delays[0] + total_of_delays[1]) / num_custs_delayed);
-    fprintf(outfile, "Average delays in queue 1:%10.3f minutes\n",
-            total_of_delays[0] / num_custs_delayed);
-    fprintf(outfile, "Average number in queue 1:%10.3f customers\n\n",
-            area_num_in_q[0] / sim_time);
-    fprintf(outfile, "Average delays in queue 2:%10.3f minutes\n",
-            total_of_delays[1] / num_custs_delayed);
-    fprintf(outfile, "Average number in queue 2:%10.3f customers\n\n",
-            area_num_in_q[1] / sim_time);
-    fprintf(outfile, "Average number in transit:%10.3f customers\n", 
-            area_in_transit / sim_time);
-    fprintf(outfile, "Maximum number in transit:%10.3f customers\n\n",
-            (float) max_in_transit);
-    fprintf(outfile, "SERVER ONE utilization:   %7.3f\n",
-            area_server_status[0] / sim_time);
-    fprintf(outfile, "SERVER TWO utilization:   %7.3f\n\n",
-            area_server_status[1] / sim_time);
-    fprintf(outfile, "Simulation end time:      %10.3f minutes\n\n", sim_time);
+    fprintf(sim->outfile, "\n\nAverage delay in system:  %10.3f minutes\n\n",
+            (sim->total_of_delays[0] + sim->total_of_delays[1])
+            / sim->num_custs_delayed);
+    fprintf(sim->outfile, "Average delays in queue 1:%10.3f minutes\n",
+            sim->total_of_delays[0] / sim->num_custs_delayed);
+    fprintf(sim->outfile, "Average number in queue 1:%10.3f customers\n\n",
+            sim->area_num_in_q[0] / sim->sim_time);
+    fprintf(sim->outfile, "Average delays in queue 2:%10.3f minutes\n",
+            sim->total_of_delays[1] / sim->num_custs_delayed);
+    fprintf(sim->outfile, "Average number in queue 2:%10.3f customers\n\n",
+            sim->area_num_in_q[1] / sim->sim_time);
+    fprintf(sim->outfile, "Average number in transit:%10.3f customers\n", 
+            sim->area_in_transit / sim->sim_time);
+    fprintf(sim->outfile, "Maximum number in transit:%10.3f customers\n\n",
+            (float) sim->max_in_transit);
+    fprintf(sim->outfile, "SERVER ONE utilization:   %7.3f\n",
+            sim->area_server_status[0] / sim->sim_time);
+    fprintf(sim->outfile, "SERVER TWO utilization:   %7.3f\n\n",
+            sim->area_server_status[1] / sim->sim_time);
+    fprintf(sim->outfile, "Simulation end time:      %10.3f minutes\n\n",
+            sim->sim_time);
+#endif
 }
 
 
-void update_time_avg_stats(void)  /* Update area accumulators for time-average
-                                     statistics. */
+void update_time_avg_stats(sim_t *sim)  /* Update area accumulators for
+                                           time-average statistics. */
 {
 	int   i;
     float time_since_last_event;
 
     /* Compute time since last event, and update last-event-time marker. */
-    time_since_last_event = sim_time - time_last_event;
-    time_last_event       = sim_time;
+    time_since_last_event = sim->sim_time - sim->time_last_event;
+    sim->time_last_event  = sim->sim_time;
 
     /* Update area under number-in-queue and server-busy indicator function. */
 	for(i = 0; i < 2; i++) {
-    	area_num_in_q[i]      += num_in_q[i] * time_since_last_event;
-    	area_server_status[i] += server_status[i] * time_since_last_event;
-        area_in_transit       += num_in_transit * time_since_last_event;
+    	sim->area_num_in_q[i]      += sim->num_in_q[i] * time_since_last_event;
+    	sim->area_server_status[i] += sim->server_status[i]
+    	                              * time_since_last_event;
 	}
+    sim->area_in_transit += sim->num_in_transit * time_since_last_event;
 
     /* Update the maxium number of customers in transit*/
-    if (num_in_transit > max_in_transit) {
-        max_in_transit = num_in_transit;
+    if (sim->num_in_transit > sim->max_in_transit) {
+        sim->max_in_transit = sim->num_in_transit;
     }
 }
 
-/* Push to the queue */
-void enqueue(node_t * head, int t) {
-    /* Set temporary pointer to head's location */
-    node_t * tmp = head;
+float expon(sim_t *sim, float mean)  /* Exponential variate generation
+                                        function. */
+{
+    /* Return an exponential random variate with mean "mean". */
+#if defined(RNG_PIPELINE)
+    return mean * rngpipe_next(sim->rng_pipe, 0);
+#elif defined(RNG_PRESAMPLE)
+    return mean * presample_next(sim->expon_sample);
+#elif defined(RNG_PHILOX)
+    return -mean * log(philox_u01(1, sim->replication, sim->rng_counter[1]++));
+#elif defined(FAST_EXPON)
+    return zig_draw(&sim->expon_rng, mean);
+#else
+    return -mean * log(lcg_draw(&sim->expon_rng));
+#endif
+}
+
+ 
+float uniform(sim_t *sim, int b)  /* Uniform variate generation function */
+{
+    /* Return uniform variate on [0,1] */
+#if defined(RNG_PIPELINE)
+    return rngpipe_next(sim->rng_pipe, 1)*b;
+#elif defined(RNG_PRESAMPLE)
+    return presample_next(sim->uniform_sample)*b;
+#elif defined(RNG_PHILOX)
+    return philox_u01(2, sim->replication, sim->rng_counter[2]++)*b;
+#else
+    return mrg_draw(&sim->uniform_rng)*b;
+#endif
+}
+
 
-    /* Iterate to the end of the linked list */
-    while(tmp->next != NULL) {
-        tmp = tmp->next;
-    }
+#ifdef RNG_PIPELINE
+double unit_expon(void *arg)  /* Exponential variate of mean 1 for the sim_t
+                                 arg, which expon scales to exactly what it
+                                 would have made. */
+{
+    sim_t *sim = arg;
 
-    /* Add this node to the end of the list */
-    tmp->next       = malloc(sizeof(node_t));
-    tmp->next->t    = t;
-    tmp->next->next = NULL;
+#ifdef FAST_EXPON
+    return zig_unit(&sim->expon_rng);
+#else
+    return -log(lcg_draw(&sim->expon_rng));
+#endif
 }
 
-/* Pop from the queue and return the head's data */
-float dequeue(node_t ** head) {
-    float pop    = 0.0;
-    node_t * tmp = NULL;
-    
-    /* Check for null list */
-    if (head == NULL) {
-        return -1.0;
-    }
 
-    /* Free head data and assign head pointer to the next node in the queue */
-    tmp = (*head)->next;
-    pop = (*head)->t;
-    free(*head);
-    *head = tmp;
+double unit_uniform(void *arg)  /* U(0,1) variate for uniform. */
+{
+    sim_t *sim = arg;
 
-    /* Return data for the previous head */
-    return pop;
+    return mrg_draw(&sim->uniform_rng);
 }
+#endif
+
 
-float expon(float mean)  /* Exponential variate generation function. */
+#ifdef RNG_PRESAMPLE
+void fill_expon(void *arg, double *x, int n)  /* Fill x[0..n-1] with
+                                                 exponentials of mean 1 for
+                                                 the sim_t arg, as expon
+                                                 would make them. */
 {
-    /* Return an exponential random variate with mean "mean". */
-    return -mean * log(lcgrand(1));
+    sim_t *sim = arg;
+#ifdef FAST_EXPON
+    int    i;
+
+    for (i = 0; i < n; ++i)
+        x[i] = zig_unit(&sim->expon_rng);
+#else
+    float  u[256];
+    int    i, j, m;
+
+    for (i = 0; i < n; i += m) {
+        m = n - i < 256 ? n - i : 256;
+        lcg_fill(&sim->expon_rng, u, m);
+        for (j = 0; j < m; ++j)
+            x[i + j] = -log(u[j]);
+    }
+#endif
 }
 
- 
-float uniform(int b)  /* Uniform variate generation function */
+
+void fill_uniform(void *arg, double *x, int n)  /* Fill x[0..n-1] with U(0,1)
+                                                   numbers for uniform. */
 {
-    /* Return uniform variate on [0,1] */
-    return mrand(1)*b;
-}
\ No newline at end of file
+    sim_t *sim = arg;
+
+    mrg_fill(&sim->uniform_rng, x, n);
+}
+#endif
@@ -0,0 +1,841 @@
+/* Future event list for the discrete-event simulators.  Three
+   interchangeable implementations are provided behind the same functions:
+
+     EVLIST_HEAP      Indexed binary heap.  Every operation is O(log n) in
+                      the number n of pending events.
+
+     EVLIST_CALENDAR  Calendar queue (Brown, CACM 31(10), 1988).  Events are
+                      hashed by time into an array of "day" buckets, each a
+                      sorted list, and removed by sweeping the days of the
+                      current "year".  The number of buckets follows the
+                      population and the bucket width is re-estimated from
+                      the spacing of the earliest events on every resize,
+                      giving O(1) amortized hold time.
+
+     EVLIST_LADDER    Ladder queue (Tang, Goh and Thng, ACM TOMACS 15(3),
+                      2005).  New events go unsorted onto a "top" list or
+                      into the bucket of one of up to eight "rungs" of
+                      progressively finer buckets; a bucket is sorted into
+                      the short "bottom" list only when it reaches the
+                      head, and an over-full bucket is spread over a new
+                      rung instead.  Bucket widths are derived from the
+                      events themselves, so skewed or bursty event-time
+                      distributions still get O(1) amortized hold time.
+
+   Either way, events are removed in order of event time, with ties broken
+   in favour of the lower event type (the same order the original linear
+   scan over time_next_event[] produced).  The header file evlist.h must be
+   included in the calling program (#include "evlist.h") before using these
+   functions.
+
+   Usage:
+
+   1. To create an empty event list, execute
+          el = evlist_create(kind);
+      with kind one of the above (EVLIST_DEFAULT selects the build's
+      default), and release it with evlist_destroy(el) when done.
+      evlist_clear(el) empties the list (e.g., at the start of a
+      replication).
+
+   2. To schedule an event of type "type" (a positive int) at time "time",
+      execute
+          h = evlist_schedule(el, type, time);
+      The returned int handle identifies the pending event until it is
+      removed from the list.
+
+   3. To move a pending event to a new time, execute
+          h = evlist_reschedule(el, h, time);
+      and to remove it without executing it,
+          evlist_cancel(el, h);
+
+   4. To remove the next (earliest) event, execute
+          type = evlist_pop(el, &time);
+      which returns its type and stores its time in "time", or returns 0 if
+      the list is empty.  evlist_peek(el) returns the time of the next
+      event (1.0e+30 if none), evlist_peek_type(el) its type (0 if none),
+      and evlist_size(el) the number pending. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "evlist.h"
+
+#define EVLIST_INIT_CAP  16  /* Initial number of event slots. */
+#define CAL_MIN_BUCKETS   2  /* Smallest calendar. */
+#define CAL_MAX_SAMPLE   25  /* Most events sampled to estimate the width. */
+#define CAL_MAX_DAY   1.0e18 /* Clamp on day numbers of far-future events. */
+#define CAL_REMOVED      -2  /* prev of a node no longer on the calendar. */
+#define LADDER_TOP        0  /* List ids of the top and bottom of the */
+#define LADDER_BOTTOM     1  /* ladder; rung buckets follow. */
+#define LADDER_MAX_RUNGS  8  /* Deepest ladder. */
+#define LADDER_THRES     50  /* Larger buckets are split rather than sorted. */
+
+typedef struct {   /* Heap entry. */
+    float time;
+    int   type;
+    int   handle;
+} evlist_entry_t;
+
+typedef struct {   /* Calendar or ladder node, one per handle. */
+    float     time;
+    int       type;
+    int       prev, next;  /* Neighbours in the bucket list, or -1. */
+    long long day;         /* Calendar: virtual bucket, floor(time / width).
+                              Ladder: id of the list holding the node. */
+} evlist_node_t;
+
+typedef struct {   /* Ladder list: top, bottom or a rung bucket. */
+    int head;
+    int count;
+} evlist_list_t;
+
+typedef struct {   /* Ladder rung. */
+    double start;        /* Time at which bucket 0 begins. */
+    double width;        /* Bucket width. */
+    int    base;         /* List id of bucket 0. */
+    int    num_buckets;
+    int    cur;          /* First bucket not yet moved further down. */
+} evlist_rung_t;
+
+struct evlist {
+    int             kind;
+    int             size;          /* Number of pending events. */
+    int             cap;           /* Allocated per-handle slots. */
+    int             num_handles;   /* Handles ever handed out. */
+    int             num_free;      /* Handles available for reuse. */
+    int            *free_handles;  /* Stack of released handles. */
+
+    /* EVLIST_HEAP */
+    evlist_entry_t *heap;          /* heap[0 .. size-1], earliest first. */
+    int            *pos;           /* pos[handle] = index into heap. */
+
+    /* EVLIST_CALENDAR */
+    evlist_node_t  *node;          /* node[handle]. */
+    int            *bucket;        /* Head of each day's sorted list. */
+    int             num_buckets;   /* Always a power of two. */
+    double          width;         /* Length of a day. */
+    long long       today;         /* Day the sweep is currently on. */
+
+    /* EVLIST_LADDER (also uses node[]) */
+    evlist_list_t  *list;          /* list[LADDER_TOP], list[LADDER_BOTTOM],
+                                      then the buckets of each rung. */
+    int             list_cap;
+    evlist_rung_t   rung[LADDER_MAX_RUNGS];
+    int             num_rungs;
+    double          top_start;     /* Later events go onto the top list. */
+    evlist_entry_t *scratch;       /* Sort buffer for filling the bottom. */
+    int             scratch_cap;
+};
+
+
+static void *evlist_alloc(void *p, size_t n)  /* Checked realloc. */
+{
+    p = realloc(p, n);
+    if (p == NULL) {
+        fprintf(stderr, "\nevlist: out of memory\n");
+        exit(3);
+    }
+    return p;
+}
+
+
+/* Return nonzero if an event (ta, ya) must be executed before (tb, yb). */
+
+static int evlist_before(float ta, int ya, float tb, int yb)
+{
+    return ta < tb || (ta == tb && ya < yb);
+}
+
+
+/* Hand out a handle, growing the per-handle tables if all are in use. */
+
+static int evlist_new_handle(evlist_t *el)
+{
+    if (el->num_free > 0)
+        return el->free_handles[--el->num_free];
+
+    if (el->num_handles == el->cap) {
+        el->cap *= 2;
+        el->free_handles = evlist_alloc(el->free_handles, el->cap * sizeof(int));
+        if (el->kind != EVLIST_HEAP)
+            el->node = evlist_alloc(el->node, el->cap * sizeof(evlist_node_t));
+        else {
+            el->heap = evlist_alloc(el->heap, el->cap * sizeof(evlist_entry_t));
+            el->pos  = evlist_alloc(el->pos, el->cap * sizeof(int));
+        }
+    }
+    return el->num_handles++;
+}
+
+
+/* Link node h into the sorted list starting at *head. */
+
+static void evlist_link_sorted(evlist_t *el, int *head, int h)
+{
+    evlist_node_t *n = &el->node[h];
+    int prev = -1, next = *head;
+
+    while (next != -1 &&
+           !evlist_before(n->time, n->type, el->node[next].time, el->node[next].type)) {
+        prev = next;
+        next = el->node[next].next;
+    }
+
+    n->prev = prev;
+    n->next = next;
+    if (prev == -1)
+        *head = h;
+    else
+        el->node[prev].next = h;
+    if (next != -1)
+        el->node[next].prev = h;
+}
+
+
+/* Indexed binary heap. */
+
+static void heap_place(evlist_t *el, int i, evlist_entry_t e)
+{
+    el->heap[i]       = e;
+    el->pos[e.handle] = i;
+}
+
+
+static void heap_sift_up(evlist_t *el, int i)
+{
+    evlist_entry_t e = el->heap[i];
+
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!evlist_before(e.time, e.type,
+                           el->heap[parent].time, el->heap[parent].type))
+            break;
+        heap_place(el, i, el->heap[parent]);
+        i = parent;
+    }
+    heap_place(el, i, e);
+}
+
+
+static void heap_sift_down(evlist_t *el, int i)
+{
+    evlist_entry_t e = el->heap[i];
+
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= el->size)
+            break;
+        if (child + 1 < el->size &&
+            evlist_before(el->heap[child + 1].time, el->heap[child + 1].type,
+                          el->heap[child].time, el->heap[child].type))
+            ++child;
+        if (!evlist_before(el->heap[child].time, el->heap[child].type,
+                           e.time, e.type))
+            break;
+        heap_place(el, i, el->heap[child]);
+        i = child;
+    }
+    heap_place(el, i, e);
+}
+
+
+static void heap_insert(evlist_t *el, int handle, int type, float time)
+{
+    evlist_entry_t e;
+
+    e.time   = time;
+    e.type   = type;
+    e.handle = handle;
+    el->heap[el->size] = e;
+    el->pos[handle]    = el->size;
+    heap_sift_up(el, el->size++);
+}
+
+
+/* Remove the entry at heap index i and restore the heap order. */
+
+static void heap_remove_at(evlist_t *el, int i)
+{
+    if (--el->size > i) {
+        int moved = el->heap[el->size].handle;
+        heap_place(el, i, el->heap[el->size]);
+        heap_sift_down(el, i);
+        heap_sift_up(el, el->pos[moved]);
+    }
+}
+
+
+static void heap_reschedule(evlist_t *el, int handle, float time)
+{
+    int   i   = el->pos[handle];
+    float old = el->heap[i].time;
+
+    el->heap[i].time = time;
+    if (time < old)
+        heap_sift_up(el, i);
+    else
+        heap_sift_down(el, i);
+}
+
+
+/* Calendar queue. */
+
+static long long cal_day(evlist_t *el, float time)
+{
+    double day = floor(time / el->width);
+
+    return (long long) (day < CAL_MAX_DAY ? day : CAL_MAX_DAY);
+}
+
+
+/* Link node h into its day's bucket, keeping the bucket sorted. */
+
+static void cal_link(evlist_t *el, int h)
+{
+    evlist_link_sorted(el, &el->bucket[el->node[h].day & (el->num_buckets - 1)], h);
+}
+
+
+static void cal_unlink(evlist_t *el, int h)
+{
+    evlist_node_t *n = &el->node[h];
+
+    if (n->prev == -1)
+        el->bucket[n->day & (el->num_buckets - 1)] = n->next;
+    else
+        el->node[n->prev].next = n->next;
+    if (n->next != -1)
+        el->node[n->next].prev = n->prev;
+}
+
+
+/* Find the earliest event, advancing the sweep to its day.  The list must
+   not be empty. */
+
+static int cal_find_min(evlist_t *el)
+{
+    int i, b, h, best = -1;
+
+    /* Sweep through one year of days starting with today. */
+    for (i = 0; i < el->num_buckets; ++i) {
+        b = (int) ((el->today + i) & (el->num_buckets - 1));
+        h = el->bucket[b];
+        if (h != -1 && el->node[h].day <= el->today + i) {
+            el->today += i;
+            return h;
+        }
+    }
+
+    /* Nothing is due this year, so search every bucket directly. */
+    for (b = 0; b < el->num_buckets; ++b) {
+        h = el->bucket[b];
+        if (h != -1 && (best == -1 ||
+            evlist_before(el->node[h].time, el->node[h].type,
+                          el->node[best].time, el->node[best].type)))
+            best = h;
+    }
+    el->today = el->node[best].day;
+    return best;
+}
+
+
+/* Rebuild the calendar with num_buckets buckets, estimating a new day width
+   from the average spacing of the earliest events, as in Brown (1988). */
+
+static void cal_resize(evlist_t *el, int num_buckets)
+{
+    int    i, h, n, sample[CAL_MAX_SAMPLE];
+    double gap, sum = 0.0, avg, width = el->width;
+
+    /* Take the earliest few events off the calendar to measure their
+       spacing.  Their handles and times are not disturbed. */
+    n = el->size <= 5 ? el->size : 5 + el->size / 10;
+    if (n > CAL_MAX_SAMPLE)
+        n = CAL_MAX_SAMPLE;
+    for (i = 0; i < n; ++i) {
+        sample[i] = cal_find_min(el);
+        cal_unlink(el, sample[i]);
+    }
+
+    if (n > 1) {
+        for (i = 1; i < n; ++i)
+            sum += el->node[sample[i]].time - el->node[sample[i - 1]].time;
+        avg = sum / (n - 1);
+
+        /* Recompute the average ignoring unusually large separations. */
+        sum = 0.0;
+        h   = 0;
+        for (i = 1; i < n; ++i) {
+            gap = el->node[sample[i]].time - el->node[sample[i - 1]].time;
+            if (gap <= 2.0 * avg) {
+                sum += gap;
+                ++h;
+            }
+        }
+        if (h > 0 && sum > 0.0)
+            width = 3.0 * sum / h;
+    }
+
+    el->num_buckets = num_buckets;
+    el->width       = width;
+    el->bucket      = evlist_alloc(el->bucket, num_buckets * sizeof(int));
+    for (i = 0; i < num_buckets; ++i)
+        el->bucket[i] = -1;
+
+    /* Relink every pending event, including the sampled ones. */
+    for (h = 0; h < el->num_handles; ++h)
+        if (el->node[h].prev != CAL_REMOVED) {
+            el->node[h].day = cal_day(el, el->node[h].time);
+            cal_link(el, h);
+        }
+
+    el->today = n > 0 ? el->node[sample[0]].day : 0;
+}
+
+
+static void cal_insert(evlist_t *el, int handle, int type, float time)
+{
+    evlist_node_t *n = &el->node[handle];
+
+    n->time = time;
+    n->type = type;
+    n->day  = cal_day(el, time);
+    cal_link(el, handle);
+
+    /* An event earlier than the sweep position moves the sweep back. */
+    if (n->day < el->today)
+        el->today = n->day;
+
+    if (++el->size > 2 * el->num_buckets)
+        cal_resize(el, 2 * el->num_buckets);
+}
+
+
+static void cal_remove(evlist_t *el, int handle)
+{
+    cal_unlink(el, handle);
+    el->node[handle].prev = CAL_REMOVED;
+    if (--el->size < el->num_buckets / 2 && el->num_buckets > CAL_MIN_BUCKETS)
+        cal_resize(el, el->num_buckets / 2);
+}
+
+
+/* Ladder queue. */
+
+static void lad_push(evlist_t *el, int id, int h)  /* Push h onto list id. */
+{
+    evlist_node_t *n = &el->node[h];
+
+    n->day  = id;
+    n->prev = -1;
+    n->next = el->list[id].head;
+    if (n->next != -1)
+        el->node[n->next].prev = h;
+    el->list[id].head = h;
+    ++el->list[id].count;
+}
+
+
+static void lad_unlink(evlist_t *el, int h)
+{
+    evlist_node_t *n  = &el->node[h];
+    int            id = (int) n->day;
+
+    if (n->prev == -1)
+        el->list[id].head = n->next;
+    else
+        el->node[n->prev].next = n->next;
+    if (n->next != -1)
+        el->node[n->next].prev = n->prev;
+    --el->list[id].count;
+}
+
+
+/* Store the earliest and latest event times on list id in lo and hi. */
+
+static void lad_range(evlist_t *el, int id, float *lo, float *hi)
+{
+    int h = el->list[id].head;
+
+    *lo = *hi = el->node[h].time;
+    for (h = el->node[h].next; h != -1; h = el->node[h].next) {
+        if (el->node[h].time < *lo)
+            *lo = el->node[h].time;
+        if (el->node[h].time > *hi)
+            *hi = el->node[h].time;
+    }
+}
+
+
+/* Bucket of rung r that an event at "time" belongs in, or -1 if the event
+   precedes the rung. */
+
+static int lad_bucket(evlist_rung_t *r, float time)
+{
+    double b = floor((time - r->start) / r->width);
+
+    if (b < 0.0)
+        return -1;
+    return b < r->num_buckets ? (int) b : r->num_buckets - 1;
+}
+
+
+/* Spread every event on list id over a new, deepest rung spanning the
+   events' times lo to hi (lo < hi), one bucket per event. */
+
+static void lad_spawn(evlist_t *el, int id, float lo, float hi)
+{
+    int            i, h, next, n = el->list[id].count;
+    evlist_rung_t *r = &el->rung[el->num_rungs];
+
+    r->start       = lo;
+    r->width       = ((double) hi - lo) / n;
+    r->num_buckets = n + 1;
+    r->cur         = 0;
+    r->base        = el->num_rungs == 0 ? LADDER_BOTTOM + 1
+                   : r[-1].base + r[-1].num_buckets;
+    ++el->num_rungs;
+
+    if (r->base + r->num_buckets > el->list_cap) {
+        el->list_cap = 2 * (r->base + r->num_buckets);
+        el->list     = evlist_alloc(el->list, el->list_cap * sizeof(evlist_list_t));
+    }
+    for (i = 0; i < r->num_buckets; ++i) {
+        el->list[r->base + i].head  = -1;
+        el->list[r->base + i].count = 0;
+    }
+
+    for (h = el->list[id].head; h != -1; h = next) {
+        next = el->node[h].next;
+        lad_push(el, r->base + lad_bucket(r, el->node[h].time), h);
+    }
+    el->list[id].head  = -1;
+    el->list[id].count = 0;
+}
+
+
+static int lad_compare(const void *a, const void *b)  /* For qsort. */
+{
+    const evlist_entry_t *x = a, *y = b;
+
+    if (evlist_before(x->time, x->type, y->time, y->type))
+        return -1;
+    return evlist_before(y->time, y->type, x->time, x->type);
+}
+
+
+/* Sort the events on list id onto the empty bottom list. */
+
+static void lad_sort_to_bottom(evlist_t *el, int id)
+{
+    int i, h, n = el->list[id].count;
+
+    if (n > el->scratch_cap) {
+        el->scratch_cap = 2 * n;
+        el->scratch     = evlist_alloc(el->scratch, el->scratch_cap * sizeof(evlist_entry_t));
+    }
+    for (i = 0, h = el->list[id].head; h != -1; h = el->node[h].next, ++i) {
+        el->scratch[i].time   = el->node[h].time;
+        el->scratch[i].type   = el->node[h].type;
+        el->scratch[i].handle = h;
+    }
+    qsort(el->scratch, n, sizeof(evlist_entry_t), lad_compare);
+
+    el->list[id].head  = -1;
+    el->list[id].count = 0;
+    for (i = n - 1; i >= 0; --i)
+        lad_push(el, LADDER_BOTTOM, el->scratch[i].handle);
+}
+
+
+/* Refill the empty bottom list from the ladder.  The list must not be
+   empty. */
+
+static void lad_refill(evlist_t *el)
+{
+    int            id;
+    float          lo, hi;
+    evlist_rung_t *r;
+
+    for (;;) {
+        if (el->num_rungs == 0) {
+            /* Every remaining event is on top; start a new epoch. */
+            lad_range(el, LADDER_TOP, &lo, &hi);
+            el->top_start = hi;
+            if (lo == hi) {
+                lad_sort_to_bottom(el, LADDER_TOP);
+                return;
+            }
+            lad_spawn(el, LADDER_TOP, lo, hi);
+        }
+
+        /* Find the next nonempty bucket on the deepest rung, discarding the
+           rung once all its buckets have been used. */
+        r = &el->rung[el->num_rungs - 1];
+        while (r->cur < r->num_buckets && el->list[r->base + r->cur].count == 0)
+            ++r->cur;
+        if (r->cur == r->num_buckets) {
+            --el->num_rungs;
+            continue;
+        }
+        id = r->base + r->cur++;
+
+        /* Split a large bucket over a finer rung; sort a small one. */
+        if (el->list[id].count > LADDER_THRES && el->num_rungs < LADDER_MAX_RUNGS) {
+            lad_range(el, id, &lo, &hi);
+            if (lo < hi) {
+                lad_spawn(el, id, lo, hi);
+                continue;
+            }
+        }
+        lad_sort_to_bottom(el, id);
+        return;
+    }
+}
+
+
+static void lad_insert(evlist_t *el, int handle, int type, float time)
+{
+    int   i, b;
+    float lo, hi;
+
+    el->node[handle].time = time;
+    el->node[handle].type = type;
+    ++el->size;
+
+    if (time > el->top_start) {
+        lad_push(el, LADDER_TOP, handle);
+        return;
+    }
+
+    /* Use the coarsest rung whose unused buckets cover the event. */
+    for (i = 0; i < el->num_rungs; ++i) {
+        b = lad_bucket(&el->rung[i], time);
+        if (b >= el->rung[i].cur) {
+            lad_push(el, el->rung[i].base + b, handle);
+            return;
+        }
+    }
+
+    /* The event precedes every rung, so it belongs in the bottom.  If the
+       bottom grows too long, spread it over a new rung. */
+    evlist_link_sorted(el, &el->list[LADDER_BOTTOM].head, handle);
+    el->node[handle].day = LADDER_BOTTOM;
+    if (++el->list[LADDER_BOTTOM].count > LADDER_THRES &&
+        el->num_rungs < LADDER_MAX_RUNGS) {
+        lad_range(el, LADDER_BOTTOM, &lo, &hi);
+        if (lo < hi)
+            lad_spawn(el, LADDER_BOTTOM, lo, hi);
+    }
+}
+
+
+static int lad_find_min(evlist_t *el)  /* The list must not be empty. */
+{
+    if (el->list[LADDER_BOTTOM].count == 0)
+        lad_refill(el);
+    return el->list[LADDER_BOTTOM].head;
+}
+
+
+evlist_t *evlist_create(int kind)
+{
+    evlist_t *el = evlist_alloc(NULL, sizeof(evlist_t));
+
+    el->kind         = kind;
+    el->cap          = EVLIST_INIT_CAP;
+    el->free_handles = evlist_alloc(NULL, el->cap * sizeof(int));
+    el->heap         = NULL;
+    el->pos          = NULL;
+    el->node         = NULL;
+    el->bucket       = NULL;
+    el->list         = NULL;
+    el->list_cap     = 0;
+    el->scratch      = NULL;
+    el->scratch_cap  = 0;
+
+    if (kind == EVLIST_HEAP) {
+        el->heap = evlist_alloc(NULL, el->cap * sizeof(evlist_entry_t));
+        el->pos  = evlist_alloc(NULL, el->cap * sizeof(int));
+    }
+    else
+        el->node = evlist_alloc(NULL, el->cap * sizeof(evlist_node_t));
+
+    evlist_clear(el);
+    return el;
+}
+
+
+void evlist_destroy(evlist_t *el)
+{
+    free(el->free_handles);
+    free(el->heap);
+    free(el->pos);
+    free(el->node);
+    free(el->bucket);
+    free(el->list);
+    free(el->scratch);
+    free(el);
+}
+
+
+void evlist_clear(evlist_t *el)
+{
+    int i;
+
+    el->size        = 0;
+    el->num_handles = 0;
+    el->num_free    = 0;
+
+    switch (el->kind) {
+        case EVLIST_CALENDAR:
+            el->num_buckets = CAL_MIN_BUCKETS;
+            el->width       = 1.0;
+            el->today       = 0;
+            el->bucket      = evlist_alloc(el->bucket, CAL_MIN_BUCKETS * sizeof(int));
+            for (i = 0; i < CAL_MIN_BUCKETS; ++i)
+                el->bucket[i] = -1;
+            break;
+        case EVLIST_LADDER:
+            if (el->list_cap == 0) {
+                el->list_cap = LADDER_BOTTOM + 1;
+                el->list     = evlist_alloc(NULL, el->list_cap * sizeof(evlist_list_t));
+            }
+            el->list[LADDER_TOP].head    = el->list[LADDER_BOTTOM].head  = -1;
+            el->list[LADDER_TOP].count   = el->list[LADDER_BOTTOM].count = 0;
+            el->num_rungs = 0;
+            el->top_start = -1.0e+30;
+            break;
+    }
+}
+
+
+int evlist_schedule(evlist_t *el, int type, float time)
+{
+    int handle = evlist_new_handle(el);
+
+    switch (el->kind) {
+        case EVLIST_CALENDAR:
+            cal_insert(el, handle, type, time);
+            break;
+        case EVLIST_LADDER:
+            lad_insert(el, handle, type, time);
+            break;
+        default:
+            heap_insert(el, handle, type, time);
+            break;
+    }
+    return handle;
+}
+
+
+int evlist_reschedule(evlist_t *el, int handle, float time)
+{
+    switch (el->kind) {
+        case EVLIST_CALENDAR:
+            cal_unlink(el, handle);
+            --el->size;
+            cal_insert(el, handle, el->node[handle].type, time);
+            break;
+        case EVLIST_LADDER:
+            lad_unlink(el, handle);
+            --el->size;
+            lad_insert(el, handle, el->node[handle].type, time);
+            break;
+        default:
+            heap_reschedule(el, handle, time);
+            break;
+    }
+    return handle;
+}
+
+
+void evlist_cancel(evlist_t *el, int handle)
+{
+    switch (el->kind) {
+        case EVLIST_CALENDAR:
+            cal_remove(el, handle);
+            break;
+        case EVLIST_LADDER:
+            lad_unlink(el, handle);
+            --el->size;
+            break;
+        default:
+            heap_remove_at(el, el->pos[handle]);
+            break;
+    }
+    el->free_handles[el->num_free++] = handle;
+}
+
+
+int evlist_pop(evlist_t *el, float *time)
+{
+    int handle, type;
+
+    /* Check to see whether the event list is empty. */
+    if (el->size == 0)
+        return 0;
+
+    switch (el->kind) {
+        case EVLIST_CALENDAR:
+            handle = cal_find_min(el);
+            type   = el->node[handle].type;
+            *time  = el->node[handle].time;
+            cal_remove(el, handle);
+            break;
+        case EVLIST_LADDER:
+            handle = lad_find_min(el);
+            type   = el->node[handle].type;
+            *time  = el->node[handle].time;
+            lad_unlink(el, handle);
+            --el->size;
+            break;
+        default:
+            handle = el->heap[0].handle;
+            type   = el->heap[0].type;
+            *time  = el->heap[0].time;
+            heap_remove_at(el, 0);
+            break;
+    }
+
+    el->free_handles[el->num_free++] = handle;
+    return type;
+}
+
+
+float evlist_peek(evlist_t *el)
+{
+    if (el->size == 0)
+        return 1.0e+30;
+
+    switch (el->kind) {
+        case EVLIST_CALENDAR:
+            return el->node[cal_find_min(el)].time;
+        case EVLIST_LADDER:
+            return el->node[lad_find_min(el)].time;
+        default:
+            return el->heap[0].time;
+    }
+}
+
+
+int evlist_peek_type(evlist_t *el)
+{
+    if (el->size == 0)
+        return 0;
+
+    switch (el->kind) {
+        case EVLIST_CALENDAR:
+            return el->node[cal_find_min(el)].type;
+        case EVLIST_LADDER:
+            return el->node[lad_find_min(el)].type;
+        default:
+            return el->heap[0].type;
+    }
+}
+
+
+int evlist_size(evlist_t *el)
+{
+    return el->size;
+}
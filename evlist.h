@@ -0,0 +1,27 @@
+/* Header file "evlist.h" to be included by programs using the future event
+   list in evlist.c.  See evlist.c for a description of the functions. */
+
+#define EVLIST_HEAP      1  /* Indexed binary heap. */
+#define EVLIST_CALENDAR  2  /* Calendar queue with automatic resizing. */
+#define EVLIST_LADDER    3  /* Ladder queue with lazy sorting. */
+
+/* Kind of list the simulators create.  Select another at build time with,
+   e.g., -DEVLIST_DEFAULT=EVLIST_CALENDAR. */
+#ifndef EVLIST_DEFAULT
+#define EVLIST_DEFAULT EVLIST_HEAP
+#endif
+
+#define EVLIST_NONE     -1  /* Handle value meaning "no event scheduled". */
+
+typedef struct evlist evlist_t;
+
+evlist_t *evlist_create(int kind);
+void      evlist_destroy(evlist_t *el);
+void      evlist_clear(evlist_t *el);
+int       evlist_schedule(evlist_t *el, int type, float time);
+int       evlist_reschedule(evlist_t *el, int handle, float time);
+void      evlist_cancel(evlist_t *el, int handle);
+int       evlist_pop(evlist_t *el, float *time);
+float     evlist_peek(evlist_t *el);
+int       evlist_peek_type(evlist_t *el);
+int       evlist_size(evlist_t *el);
@@ -0,0 +1,331 @@
+/* First-in, first-out queue of times (e.g., the times of arrival of the
+   customers waiting in a queue).  Three interchangeable implementations
+   are provided behind the same functions, each adding at the tail and
+   removing from the head in O(1), with no shifting of the entries behind
+   and no allocation per entry:
+
+     FIFO_RING     Circular buffer.  The buffer doubles in size whenever it
+                   fills, so growth costs amortized O(1) per entry and the
+                   memory used follows the longest queue reached.
+
+     FIFO_CHUNKED  Linked list of blocks of FIFO_BLOCK entries.  The queue
+                   grows a block at a time without ever copying entries,
+                   and blocks emptied at the head are reused at the tail.
+
+     FIFO_LIST     Linked list of one node per entry, as the original
+                   dynamic.c used, with the nodes recycled through a free
+                   list.
+
+   The blocks and nodes are carved from an arena (see arena.c), so
+   fifo_clear() releases them all at once while keeping the memory for the
+   next replication.  Times are stored as fifo_time_t, which is float
+   unless fifo.h is compiled with, e.g., -DFIFO_TIME_T=double.  The header
+   file fifo.h must be included in the calling program (#include "fifo.h")
+   before using these functions.
+
+   Usage:
+
+   1. To create an empty queue with initial room for "cap" entries,
+      execute
+          q = fifo_create(kind, cap);
+      with kind one of the above (FIFO_DEFAULT selects the build's default),
+      and release it with fifo_destroy(q) when done.  fifo_clear(q) empties
+      the queue (e.g., at the start of a replication) but keeps its
+      storage.
+
+   2. To cap the queue at "limit" entries, execute
+          fifo_limit(q, limit);
+      A limit of 0 (the default) lets the queue grow until memory runs
+      out.
+
+   3. To add time t at the tail, execute
+          full = fifo_push(q, t);
+      which returns 0, or 1 (leaving the queue unchanged) if the queue is
+      at its limit.
+
+   4. To remove and return the time at the head, execute
+          t = fifo_pop(q);
+      The queue must not be empty; fifo_size(q) gives the number of
+      entries. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+#include "fifo.h"
+
+#define FIFO_BLOCK          64  /* Entries per block of a chunked queue. */
+#define FIFO_SLAB          256  /* Nodes carved at a time for a list queue. */
+#define FIFO_ARENA_CHUNK 16384  /* Bytes the arena takes at a time. */
+
+typedef struct fifo_block {  /* Block of a chunked queue. */
+    struct fifo_block *next;
+    fifo_time_t        t[FIFO_BLOCK];
+} fifo_block_t;
+
+typedef struct fifo_node {   /* Node of a list queue. */
+    struct fifo_node *next;
+    fifo_time_t       t;
+} fifo_node_t;
+
+struct fifo {
+    int           kind;
+    int           count;       /* Number of entries. */
+    int           limit;       /* Most entries allowed, or 0 for no limit. */
+
+    /* FIFO_RING */
+    fifo_time_t  *buf;         /* Ring of cap entries, cap a power of two. */
+    int           cap;
+    int           head;        /* Index of the oldest entry. */
+
+    /* FIFO_CHUNKED and FIFO_LIST */
+    arena_t      *arena;       /* Source of blocks and nodes. */
+    fifo_block_t *first_block; /* Block holding the oldest entry, */
+    fifo_block_t *last_block;  /* and the newest. */
+    fifo_block_t *free_blocks; /* Emptied blocks, for reuse. */
+    int           first_pos;   /* Index of the oldest entry in its block. */
+    int           last_pos;    /* Index after the newest in its block. */
+    fifo_node_t  *first_node;  /* Oldest and newest entries. */
+    fifo_node_t  *last_node;
+    fifo_node_t  *free_nodes;  /* Nodes not in the queue. */
+};
+
+
+static void fifo_out_of_memory(void)
+{
+    fprintf(stderr, "\nfifo: out of memory\n");
+    exit(3);
+}
+
+
+fifo_t *fifo_create(int kind, int cap)
+{
+    fifo_t *q = malloc(sizeof(fifo_t));
+    int     n = 1;
+
+    if (q == NULL)
+        fifo_out_of_memory();
+
+    q->kind  = kind;
+    q->limit = 0;
+    q->buf   = NULL;
+    q->arena = NULL;
+
+    switch (kind) {
+        case FIFO_RING:
+            /* Round the capacity up to a power of two so that indices wrap
+               with a mask. */
+            while (n < cap)
+                n *= 2;
+            q->cap = n;
+            q->buf = malloc(n * sizeof(fifo_time_t));
+            if (q->buf == NULL)
+                fifo_out_of_memory();
+            break;
+
+        case FIFO_CHUNKED:
+        case FIFO_LIST:
+            q->arena = arena_create(FIFO_ARENA_CHUNK);
+            break;
+
+        default:
+            fprintf(stderr, "\nfifo: unknown queue kind %d\n", kind);
+            exit(3);
+    }
+
+    fifo_clear(q);
+    return q;
+}
+
+
+void fifo_destroy(fifo_t *q)
+{
+    free(q->buf);
+    if (q->arena != NULL)
+        arena_destroy(q->arena);
+    free(q);
+}
+
+
+void fifo_clear(fifo_t *q)
+{
+    q->count = 0;
+    q->head  = 0;
+
+    /* Release every block and node at once; the arena keeps the memory. */
+    if (q->arena != NULL)
+        arena_reset(q->arena);
+    q->first_block = NULL;
+    q->last_block  = NULL;
+    q->free_blocks = NULL;
+    q->first_pos   = 0;
+    q->last_pos    = 0;
+    q->first_node  = NULL;
+    q->last_node   = NULL;
+    q->free_nodes  = NULL;
+}
+
+
+void fifo_limit(fifo_t *q, int limit)
+{
+    q->limit = limit;
+}
+
+
+/* Double the ring, moving the entries that wrapped around to the start of
+   the old buffer so that they follow the others. */
+
+static void ring_grow(fifo_t *q)
+{
+    int          wrapped = q->head + q->count - q->cap;
+    fifo_time_t *buf     = realloc(q->buf, 2 * q->cap * sizeof(fifo_time_t));
+
+    if (buf == NULL)
+        fifo_out_of_memory();
+    if (wrapped > 0)
+        memcpy(buf + q->cap, buf, wrapped * sizeof(fifo_time_t));
+
+    q->buf  = buf;
+    q->cap *= 2;
+}
+
+
+static void chunked_push(fifo_t *q, fifo_time_t t)
+{
+    fifo_block_t *b;
+
+    /* Start a new block if the newest one is full (or there is none). */
+    if (q->last_block == NULL || q->last_pos == FIFO_BLOCK) {
+        b = q->free_blocks;
+        if (b != NULL)
+            q->free_blocks = b->next;
+        else
+            b = arena_alloc(q->arena, sizeof(fifo_block_t));
+        b->next = NULL;
+
+        if (q->last_block == NULL)
+            q->first_block = b;
+        else
+            q->last_block->next = b;
+        q->last_block = b;
+        q->last_pos   = 0;
+    }
+
+    q->last_block->t[q->last_pos++] = t;
+}
+
+
+static fifo_time_t chunked_pop(fifo_t *q)
+{
+    fifo_block_t *b = q->first_block;
+    fifo_time_t   t = b->t[q->first_pos++];
+
+    if (q->count == 1) {
+        /* The queue is now empty, so start over at the front of the block. */
+        q->first_pos = 0;
+        q->last_pos  = 0;
+    }
+    else if (q->first_pos == FIFO_BLOCK) {
+        /* The oldest block is used up, so keep it for reuse. */
+        q->first_block = b->next;
+        q->first_pos   = 0;
+        b->next        = q->free_blocks;
+        q->free_blocks = b;
+    }
+    return t;
+}
+
+
+static void list_push(fifo_t *q, fifo_time_t t)
+{
+    fifo_node_t *n;
+    int          i;
+
+    /* Carve a new slab of nodes if none are free. */
+    if (q->free_nodes == NULL) {
+        q->free_nodes = arena_alloc(q->arena, FIFO_SLAB * sizeof(fifo_node_t));
+        for (i = 0; i < FIFO_SLAB - 1; ++i)
+            q->free_nodes[i].next = &q->free_nodes[i + 1];
+        q->free_nodes[FIFO_SLAB - 1].next = NULL;
+    }
+
+    n             = q->free_nodes;
+    q->free_nodes = n->next;
+    n->t          = t;
+    n->next       = NULL;
+
+    if (q->last_node == NULL)
+        q->first_node = n;
+    else
+        q->last_node->next = n;
+    q->last_node = n;
+}
+
+
+static fifo_time_t list_pop(fifo_t *q)
+{
+    fifo_node_t *n = q->first_node;
+
+    q->first_node = n->next;
+    if (q->first_node == NULL)
+        q->last_node = NULL;
+    n->next       = q->free_nodes;
+    q->free_nodes = n;
+    return n->t;
+}
+
+
+int fifo_push(fifo_t *q, fifo_time_t t)
+{
+    if (q->count == q->limit && q->limit > 0)
+        return 1;
+
+    switch (q->kind) {
+        case FIFO_RING:
+            if (q->count == q->cap)
+                ring_grow(q);
+            q->buf[(q->head + q->count) & (q->cap - 1)] = t;
+            break;
+
+        case FIFO_CHUNKED:
+            chunked_push(q, t);
+            break;
+
+        case FIFO_LIST:
+            list_push(q, t);
+            break;
+    }
+
+    ++q->count;
+    return 0;
+}
+
+
+fifo_time_t fifo_pop(fifo_t *q)
+{
+    fifo_time_t t = 0;
+
+    switch (q->kind) {
+        case FIFO_RING:
+            t       = q->buf[q->head];
+            q->head = (q->head + 1) & (q->cap - 1);
+            break;
+
+        case FIFO_CHUNKED:
+            t = chunked_pop(q);
+            break;
+
+        case FIFO_LIST:
+            t = list_pop(q);
+            break;
+    }
+
+    --q->count;
+    return t;
+}
+
+
+int fifo_size(fifo_t *q)
+{
+    return q->count;
+}
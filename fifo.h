@@ -0,0 +1,29 @@
+/* Header file "fifo.h" to be included by programs using the FIFO queues in
+   fifo.c.  See fifo.c for a description of the functions. */
+
+#define FIFO_RING     1  /* Circular buffer that doubles when full. */
+#define FIFO_CHUNKED  2  /* Linked blocks of entries. */
+#define FIFO_LIST     3  /* Linked nodes, one per entry. */
+
+/* Kind of queue the simulators create.  Select another at build time with,
+   e.g., -DFIFO_DEFAULT=FIFO_CHUNKED. */
+#ifndef FIFO_DEFAULT
+#define FIFO_DEFAULT FIFO_RING
+#endif
+
+/* Type of the times held in the queues.  fifo.c and its callers must be
+   built with the same setting. */
+#ifndef FIFO_TIME_T
+#define FIFO_TIME_T float
+#endif
+
+typedef FIFO_TIME_T fifo_time_t;
+typedef struct fifo fifo_t;
+
+fifo_t     *fifo_create(int kind, int cap);
+void        fifo_destroy(fifo_t *q);
+void        fifo_clear(fifo_t *q);
+void        fifo_limit(fifo_t *q, int limit);
+int         fifo_push(fifo_t *q, fifo_time_t t);
+fifo_time_t fifo_pop(fifo_t *q);
+int         fifo_size(fifo_t *q);
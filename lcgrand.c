@@ -1,88 +1,377 @@
-/* Prime modulus multiplicative linear congruential generator
-   Z[i] = (630360016 * Z[i-1]) (mod(pow(2,31) - 1)), based on Marse and Roberts'
-   portable FORTRAN random-number generator UNIRAN.  Multiple (100) streams are
-   supported, with seeds spaced 100,000 apart.  Throughout, input argument
-   "stream" must be an int giving the desired stream number.  The header file
-   lcgrand.h must be included in the calling program (#include "lcgrand.h")
-   before using these functions.
-
-   Usage: (Three functions)
-
-   1. To obtain the next U(0,1) random number from stream "stream," execute
-          u = lcgrand(stream);
-      where lcgrand is a float function.  The float variable u will contain the
-      next random number.
-
-   2. To set the seed for stream "stream" to a desired value zset, execute
-          lcgrandst(zset, stream);
-      where lcgrandst is a void function and zset must be a long set to the
-      desired seed, a number between 1 and 2147483646 (inclusive).  Default
-      seeds for all 100 streams are given in the code.
-
-   3. To get the current (most recently used) integer in the sequence being
-      generated for stream "stream" into the long variable zget, execute
-          zget = lcgrandgt(stream);
-      where lcgrandgt is a long function. */
-
-/* Define the constants. */
-
-#define MODLUS 2147483647
-#define MULT1       24112
-#define MULT2       26143
-
-/* Set the default seeds for all 100 streams. */
-
-static long zrng[] =
-{         1,
- 1973272912, 281629770,  20006270,1280689831,2096730329,1933576050,
-  913566091, 246780520,1363774876, 604901985,1511192140,1259851944,
-  824064364, 150493284, 242708531,  75253171,1964472944,1202299975,
-  233217322,1911216000, 726370533, 403498145, 993232223,1103205531,
-  762430696,1922803170,1385516923,  76271663, 413682397, 726466604,
-  336157058,1432650381,1120463904, 595778810, 877722890,1046574445,
-   68911991,2088367019, 748545416, 622401386,2122378830, 640690903,
- 1774806513,2132545692,2079249579,  78130110, 852776735,1187867272,
- 1351423507,1645973084,1997049139, 922510944,2045512870, 898585771,
-  243649545,1004818771, 773686062, 403188473, 372279877,1901633463,
-  498067494,2087759558, 493157915, 597104727,1530940798,1814496276,
-  536444882,1663153658, 855503735,  67784357,1432404475, 619691088,
-  119025595, 880802310, 176192644,1116780070, 277854671,1366580350,
- 1142483975,2026948561,1053920743, 786262391,1792203830,1494667770,
- 1923011392,1433700034,1244184613,1147297105, 539712780,1545929719,
-  190641742,1645390429, 264907697, 620389253,1502074852, 927711160,
-  364849192,2049576050, 638580085, 547070247 };
-
-/* Generate the next random number. */
-
-float lcgrand(int stream)
-{
-    long zi, lowprd, hi31;
-
-    zi     = zrng[stream];
-    lowprd = (zi & 65535) * MULT1;
-    hi31   = (zi >> 16) * MULT1 + (lowprd >> 16);
-    zi     = ((lowprd & 65535) - MODLUS) +
-             ((hi31 & 32767) << 16) + (hi31 >> 15);
-    if (zi < 0) zi += MODLUS;
-    lowprd = (zi & 65535) * MULT2;
-    hi31   = (zi >> 16) * MULT2 + (lowprd >> 16);
-    zi     = ((lowprd & 65535) - MODLUS) +
-             ((hi31 & 32767) << 16) + (hi31 >> 15);
-    if (zi < 0) zi += MODLUS;
-    zrng[stream] = zi;
-    return (zi >> 7 | 1) / 16777216.0;
-}
-
-
-void lcgrandst (long zset, int stream) /* Set the current zrng for stream
-                                          "stream" to zset. */
-{
-    zrng[stream] = zset;
-}
-
-
-long lcgrandgt (int stream) /* Return the current zrng for stream "stream". */
-{
-    return zrng[stream];
-}
-
+/* Prime modulus multiplicative linear congruential generator
+   Z[i] = (630360016 * Z[i-1]) (mod(pow(2,31) - 1)), based on Marse and Roberts'
+   portable FORTRAN random-number generator UNIRAN.  Multiple (100) streams are
+   supported, with seeds spaced 100,000 apart.  Throughout, input argument
+   "stream" must be an int giving the desired stream number.  The state of
+   a stream may also be held by the caller in an lcg_t, which occupies a
+   cache line of its own, and drawn from with the lcg_ functions below:
+   threads that each draw from their own lcg_t never touch a shared or a
+   falsely shared cache line.  The functions taking a stream number are
+   wrappers around these, with one lcg_t per stream kept here.  The header
+   file lcgrand.h must be included in the calling program
+   (#include "lcgrand.h") before using these functions.
+
+   Usage: (Six functions taking a stream number)
+
+   1. To obtain the next U(0,1) random number from stream "stream," execute
+          u = lcgrand(stream);
+      where lcgrand is a float function.  The float variable u will contain the
+      next random number.
+
+   2. To set the seed for stream "stream" to a desired value zset, execute
+          lcgrandst(zset, stream);
+      where lcgrandst is a void function and zset must be a long set to the
+      desired seed, a number between 1 and 2147483646 (inclusive).  Default
+      seeds for all 100 streams are given in the code.
+
+   3. To get the current (most recently used) integer in the sequence being
+      generated for stream "stream" into the long variable zget, execute
+          zget = lcgrandgt(stream);
+      where lcgrandgt is a long function.
+
+   4. To fill positions 0 through n-1 of the float array u with the next n
+      random numbers from stream "stream," execute
+          lcgrand_fill(u, n, stream);
+      The numbers are exactly those n successive calls to lcgrand would
+      return, and the stream is left in the same state, but they are
+      generated several at a time: the two multiplications of lcgrand
+      amount to one by MULT1 * MULT2 (mod MODLUS) = 630360016, so 8 lanes
+      can run 8 steps apart using the multipliers in jump[], and on
+      machines with AVX2 they do so in vector registers.
+
+   5. To obtain the next integer Z[i] in the sequence of stream "stream"
+      itself, between 1 and 2147483646 (inclusive), execute
+          zi = lcgrandz(stream);
+      where lcgrandz is a long function.  It advances the stream as lcgrand
+      does, for callers that want the bits rather than a U(0,1) number.
+
+   6. To obtain a pointer to the lcg_t holding stream "stream," for the
+      functions below, execute
+          g = lcgrand_state(stream);
+
+   Usage: (Handles)
+
+   1. To allocate an lcg_t g seeded with the default seed of stream
+      "stream," execute
+          g = lcg_create(stream);
+      and to free it, lcg_destroy(g).  An lcg_t declared by the caller,
+      e.g. as a local variable or in an array, is set the same way by
+          lcg_seed(g, stream);
+
+   2. To obtain the next U(0,1) random number, the next integer of the
+      sequence, or the next n random numbers in u[0..n-1] from g, execute
+          u  = lcg_draw(g);
+          zi = lcg_drawz(g);
+          lcg_fill(g, u, n);
+      which behave as lcgrand, lcgrandz and lcgrand_fill.
+
+   3. To save the state of g in the long z, e.g. at the end of a
+      replication, and later to restore it, execute
+          z = lcg_save(g);
+          lcg_restore(g, z);
+      The saved z is also a valid seed for lcgrandst.
+
+   4. To step many streams side by side, e.g. one for each of a block of
+      replications run in lockstep, keep their states in an int array
+      z[0..n-1], each set from lcg_save of a seeded lcg_t, and execute
+          lcg_draw_lanes(z, need, u, n);
+      For each i with need[i] nonzero, z[i] is advanced and u[i] set to
+      the next random number of that stream, exactly as lcg_draw would do;
+      the other z[i] and u[i] are left alone.  On machines with AVX2, 8
+      streams are stepped at a time, with need[] as a mask. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "lcgrand.h"
+
+/* Define the constants. */
+
+#define MODLUS 2147483647
+#define MULT1       24112
+#define MULT2       26143
+
+/* Set the default seeds for all 100 streams. */
+
+#define NUM_STREAMS 101
+
+static const long zseed[NUM_STREAMS] =
+{         1,
+ 1973272912, 281629770,  20006270,1280689831,2096730329,1933576050,
+  913566091, 246780520,1363774876, 604901985,1511192140,1259851944,
+  824064364, 150493284, 242708531,  75253171,1964472944,1202299975,
+  233217322,1911216000, 726370533, 403498145, 993232223,1103205531,
+  762430696,1922803170,1385516923,  76271663, 413682397, 726466604,
+  336157058,1432650381,1120463904, 595778810, 877722890,1046574445,
+   68911991,2088367019, 748545416, 622401386,2122378830, 640690903,
+ 1774806513,2132545692,2079249579,  78130110, 852776735,1187867272,
+ 1351423507,1645973084,1997049139, 922510944,2045512870, 898585771,
+  243649545,1004818771, 773686062, 403188473, 372279877,1901633463,
+  498067494,2087759558, 493157915, 597104727,1530940798,1814496276,
+  536444882,1663153658, 855503735,  67784357,1432404475, 619691088,
+  119025595, 880802310, 176192644,1116780070, 277854671,1366580350,
+ 1142483975,2026948561,1053920743, 786262391,1792203830,1494667770,
+ 1923011392,1433700034,1244184613,1147297105, 539712780,1545929719,
+  190641742,1645390429, 264907697, 620389253,1502074852, 927711160,
+  364849192,2049576050, 638580085, 547070247 };
+
+#define MULT      630360016LL  /* MULT1 * MULT2 (mod MODLUS). */
+#define FILL_LANES          8
+
+/* jump[j] = MULT to the power j+1 (mod MODLUS), for j = 0, ..., 7. */
+
+static const long long jump[FILL_LANES] =
+{ 630360016, 1549035330,  264620982,  529512731,
+ 1896697821, 2116530888, 1923129168, 1674201058 };
+
+/* The streams of the wrapper functions, seeded by zrng_setup(). */
+
+static lcg_t zrng[NUM_STREAMS];
+static int   zrng_ready = 0;
+
+/* Return z * a (mod MODLUS) for z and a below MODLUS, using the fact that
+   2^31 = 1 (mod MODLUS). */
+
+static long long mulmod(long long z, long long a)
+{
+    unsigned long long p = (unsigned long long) z * a;
+
+    p = (p & MODLUS) + (p >> 31);
+    return p >= MODLUS ? p - MODLUS : p;
+}
+
+
+lcg_t *lcg_create(int stream)
+{
+    lcg_t *g = aligned_alloc(sizeof(lcg_t), sizeof(lcg_t));
+
+    if (g == NULL) {
+        fprintf(stderr, "\nlcg_create: out of memory\n");
+        exit(3);
+    }
+    lcg_seed(g, stream);
+    return g;
+}
+
+
+void lcg_destroy(lcg_t *g)
+{
+    free(g);
+}
+
+
+void lcg_seed(lcg_t *g, int stream)  /* Set g to the default seed of
+                                        stream "stream". */
+{
+    g->z = zseed[stream];
+}
+
+
+/* Generate the next integer in the sequence.  The two multiplications by
+   MULT1 and MULT2 are done as one by MULT. */
+
+long lcg_drawz(lcg_t *g)
+{
+    g->z = mulmod(g->z, MULT);
+    return g->z;
+}
+
+
+/* Generate the next random number. */
+
+float lcg_draw(lcg_t *g)
+{
+    return (lcg_drawz(g) >> 7 | 1) / 16777216.0;
+}
+
+
+long lcg_save(const lcg_t *g)
+{
+    return g->z;
+}
+
+
+void lcg_restore(lcg_t *g, long z)
+{
+    g->z = z;
+}
+
+
+/* Seed the streams of the wrapper functions.  Under GCC this is done
+   before main, so that threads calling them on streams of their own never
+   race to do it. */
+
+#if defined(__GNUC__)
+__attribute__((constructor))
+#endif
+static void zrng_setup(void)
+{
+    int i;
+
+    for (i = 0; i < NUM_STREAMS; ++i)
+        lcg_seed(&zrng[i], i);
+    zrng_ready = 1;
+}
+
+
+lcg_t *lcgrand_state(int stream)
+{
+    if (!zrng_ready)
+        zrng_setup();
+    return &zrng[stream];
+}
+
+
+long lcgrandz(int stream)
+{
+    return lcg_drawz(lcgrand_state(stream));
+}
+
+
+float lcgrand(int stream)
+{
+    return lcg_draw(lcgrand_state(stream));
+}
+
+
+void lcgrandst (long zset, int stream) /* Set the current zrng for stream
+                                          "stream" to zset. */
+{
+    lcg_restore(lcgrand_state(stream), zset);
+}
+
+
+long lcgrandgt (int stream) /* Return the current zrng for stream "stream". */
+{
+    return lcg_save(lcgrand_state(stream));
+}
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+
+/* Vector form of mulmod() on 8 lanes of 32 bits.  The products of the even
+   and of the odd lanes are formed and reduced in 64-bit halves, then
+   interleaved again. */
+
+__attribute__((target("avx2")))
+static __m256i mulmod_avx2(__m256i z, __m256i a)
+{
+    const __m256i mod  = _mm256_set1_epi64x(MODLUS);
+    const __m256i mod1 = _mm256_set1_epi64x(MODLUS - 1);
+    __m256i pe = _mm256_mul_epu32(z, a);
+    __m256i po = _mm256_mul_epu32(_mm256_srli_epi64(z, 32),
+                                  _mm256_srli_epi64(a, 32));
+
+    pe = _mm256_add_epi64(_mm256_and_si256(pe, mod), _mm256_srli_epi64(pe, 31));
+    po = _mm256_add_epi64(_mm256_and_si256(po, mod), _mm256_srli_epi64(po, 31));
+    pe = _mm256_sub_epi64(pe, _mm256_and_si256(_mm256_cmpgt_epi64(pe, mod1), mod));
+    po = _mm256_sub_epi64(po, _mm256_and_si256(_mm256_cmpgt_epi64(po, mod1), mod));
+    return _mm256_blend_epi32(pe, _mm256_slli_epi64(po, 32), 0xAA);
+}
+
+
+/* Fill u[0..n-1], n a multiple of 8, starting after z; return the last z. */
+
+__attribute__((target("avx2")))
+static long long fill_avx2(float *u, int n, long long z)
+{
+    const __m256i one   = _mm256_set1_epi32(1);
+    const __m256  scale = _mm256_set1_ps(1.0f / 16777216.0f);
+    __m256i       lanes, step;
+    int           i, j;
+    int           z0[FILL_LANES];
+
+    for (j = 0; j < FILL_LANES; ++j)
+        z0[j] = (int) mulmod(z, jump[j]);
+    lanes = _mm256_loadu_si256((__m256i *) z0);
+    step  = _mm256_set1_epi32((int) jump[FILL_LANES - 1]);
+
+    for (i = 0; ; i += FILL_LANES) {
+        _mm256_storeu_ps(u + i, _mm256_mul_ps(_mm256_cvtepi32_ps(
+            _mm256_or_si256(_mm256_srli_epi32(lanes, 7), one)), scale));
+        if (i + FILL_LANES >= n)
+            break;
+        lanes = mulmod_avx2(lanes, step);
+    }
+
+    _mm256_storeu_si256((__m256i *) z0, lanes);
+    return z0[FILL_LANES - 1];
+}
+#endif
+
+
+void lcg_fill(lcg_t *g, float *u, int n)
+{
+    long long z = g->z;
+    int       i = 0;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if (n >= FILL_LANES && __builtin_cpu_supports("avx2")) {
+        i = n - n % FILL_LANES;
+        z = fill_avx2(u, i, z);
+    }
+#endif
+
+    /* Generate the rest one at a time. */
+    for (; i < n; ++i) {
+        z    = mulmod(z, MULT);
+        u[i] = (z >> 7 | 1) / 16777216.0;
+    }
+    g->z = z;
+}
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* Step the lanes of z[0..n-1], n a multiple of 8, whose need is nonzero. */
+
+__attribute__((target("avx2")))
+static void lanes_avx2(int *z, const int *need, float *u, int n)
+{
+    const __m256i zero  = _mm256_setzero_si256();
+    const __m256i mult  = _mm256_set1_epi32((int) MULT);
+    const __m256i one   = _mm256_set1_epi32(1);
+    const __m256  scale = _mm256_set1_ps(1.0f / 16777216.0f);
+    __m256i       zi, zn, idle;
+    __m256        un;
+    int           i;
+
+    for (i = 0; i < n; i += FILL_LANES) {
+        zi   = _mm256_loadu_si256((__m256i *) (z + i));
+        idle = _mm256_cmpeq_epi32(_mm256_loadu_si256((__m256i *) (need + i)),
+                                  zero);
+        zn   = mulmod_avx2(zi, mult);
+        un   = _mm256_mul_ps(_mm256_cvtepi32_ps(
+                   _mm256_or_si256(_mm256_srli_epi32(zn, 7), one)), scale);
+        _mm256_storeu_si256((__m256i *) (z + i),
+                            _mm256_blendv_epi8(zn, zi, idle));
+        _mm256_storeu_ps(u + i, _mm256_blendv_ps(un, _mm256_loadu_ps(u + i),
+                                                 _mm256_castsi256_ps(idle)));
+    }
+}
+#endif
+
+
+void lcg_draw_lanes(int *z, const int *need, float *u, int n)
+{
+    int i = 0;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if (n >= FILL_LANES && __builtin_cpu_supports("avx2")) {
+        i = n - n % FILL_LANES;
+        lanes_avx2(z, need, u, i);
+    }
+#endif
+
+    /* Step the rest one at a time. */
+    for (; i < n; ++i)
+        if (need[i]) {
+            z[i] = (int) mulmod(z[i], MULT);
+            u[i] = (z[i] >> 7 | 1) / 16777216.0;
+        }
+}
+
+
+void lcgrand_fill(float *u, int n, int stream)
+{
+    lcg_fill(lcgrand_state(stream), u, n);
+}
@@ -1,11 +1,31 @@
-/* The following 3 declarations are for use of the random-number generator
-   lcgrand and the associated functions lcgrandst and lcgrandgt for seed
-   management.  This file (named lcgrand.h) should be included in any program
-   using these functions by executing
-       #include "lcgrand.h"
-   before referencing the functions. */
-
-float lcgrand(int stream);
-void  lcgrandst(long zset, int stream);
-long  lcgrandgt(int stream);
-
+/* The following declarations are for use of the random-number generator
+   lcgrand, its bulk form lcgrand_fill, its integer form lcgrandz, and the
+   associated functions lcgrandst and lcgrandgt for seed management, and of
+   the lcg_ functions drawing from a stream held by the caller in an lcg_t.
+   This file (named lcgrand.h) should be included in any program using
+   these functions by executing
+       #include "lcgrand.h"
+   before referencing the functions. */
+
+/* The state of one stream, alone in a cache line of 64 bytes. */
+
+typedef struct {
+    _Alignas(64) long long z;
+} lcg_t;
+
+float  lcgrand(int stream);
+void   lcgrandst(long zset, int stream);
+long   lcgrandgt(int stream);
+void   lcgrand_fill(float *u, int n, int stream);
+long   lcgrandz(int stream);
+lcg_t *lcgrand_state(int stream);
+
+lcg_t *lcg_create(int stream);
+void   lcg_destroy(lcg_t *g);
+void   lcg_seed(lcg_t *g, int stream);
+float  lcg_draw(lcg_t *g);
+long   lcg_drawz(lcg_t *g);
+void   lcg_fill(lcg_t *g, float *u, int n);
+long   lcg_save(const lcg_t *g);
+void   lcg_restore(lcg_t *g, long z);
+void   lcg_draw_lanes(int *z, const int *need, float *u, int n);
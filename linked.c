@@ -1,84 +1,176 @@
-/* Implement and test FIFO queue for use in simulation */
-#include <stdio.h>  
+/* Test of the linked-list FIFO queue (FIFO_LIST) in fifo.c, which replaced
+   the list first written here.  The queue keeps head and tail pointers,
+   so enqueueing does not walk the list, and recycles its nodes, so a
+   queue that stays within the length it has already reached makes no
+   allocator calls.  After a mock sequence, the program times
+   dequeue/enqueue pairs at fixed queue lengths against the original list,
+   which walked to the tail and called malloc/free for every customer, and
+   reports the allocator calls each makes while timed.  The calls are
+   counted by wrapping malloc and free at link time, so the build needs the
+   --wrap options below.
+
+   Build: cc -O2 -o linked linked.c fifo.c arena.c \
+              -Wl,--wrap=malloc,--wrap=free,--wrap=realloc */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
+#include "fifo.h"
 
-/* Define linked list node */
+#define NUM_OPS 20000000  /* Operations timed on the pooled queue. */
+
+/* Define linked list node of the original list */
 typedef struct node {
     float t;
     struct node * next;
 } node_t;
 
+long  num_allocs = 0;  /* Calls made to malloc, realloc and free. */
+float sink;            /* Keeps the compiler from discarding results. */
 
-void  enqueue(node_t * head, int t);
-float dequeue(node_t ** head);
-void  print_list(node_t * head);
+void  *__real_malloc(size_t n);
+void  *__real_realloc(void * p, size_t n);
+void   __real_free(void * p);
+double now_ns(void);
+double ops_list(int len, long * allocs);
+double ops_pool(int len, long * allocs);
 
 int main() {
-	/* Initialize linked list */
-	node_t * head = NULL;
-	head = malloc(sizeof(node_t));
+	static const int lengths[] = { 10, 1000, 100000 };
+	long   list_allocs, pool_allocs;
+	double list_ns, pool_ns;
+	int    i;
+
+	/* Initialize the queue */
+	fifo_t * q = fifo_create(FIFO_LIST, 0);
 
-	if (head == NULL) {
-		return 1;
+	/* Mock enqueue/dequeue sequence */
+	fifo_push(q, 1.5);
+	fifo_push(q, 2.5);
+	fifo_pop(q);
+	fifo_push(q, 3.5);
+	fifo_pop(q);
+	fifo_push(q, 4.5);
+
+	/* Print queue contents, which should be 3.5 and 4.5 */
+	while (fifo_size(q) > 0)
+		fprintf(stdout, "%f\n", fifo_pop(q));
+	fifo_destroy(q);
+
+	/* Time the original and the pooled queues at several lengths */
+	printf("\n%8s %14s %14s %14s %14s\n", "length", "list ns/op",
+	       "list allocs", "pool ns/op", "pool allocs");
+	for (i = 0; i < 3; ++i) {
+		list_ns = ops_list(lengths[i], &list_allocs);
+		pool_ns = ops_pool(lengths[i], &pool_allocs);
+		printf("%8d %14.1f %14ld %14.1f %14ld\n", lengths[i],
+		       list_ns, list_allocs, pool_ns, pool_allocs);
 	}
 
-	head->t = 0.0;
-	head->next = NULL;
+	return sink == 0.0;
+}
+
+/* Count the allocator calls, wherever they are made */
+void * __wrap_malloc(size_t n) {
+    ++num_allocs;
+    return __real_malloc(n);
+}
 
-	/* Mock enqueue/dequeue sequence */
-	enqueue(head, 1);
-	enqueue(head, 2);
-	dequeue(&head);
-	enqueue(head, 3);
-	dequeue(&head);
-	enqueue(head, 4);
-
-	/* Print linked list contents and return */
-	print_list(head);
-	return 1;
+void * __wrap_realloc(void * p, size_t n) {
+    ++num_allocs;
+    return __real_realloc(p, n);
+}
+
+void __wrap_free(void * p) {
+    ++num_allocs;
+    __real_free(p);
 }
 
-/* Push to the queue */
-void enqueue(node_t * head, int t) {
-    /* Set temporary pointer to head's location */
+double now_ns(void) {  /* Monotonic wall-clock time in nanoseconds. */
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1.0e9 + ts.tv_nsec;
+}
+
+/* The original list: the head node is a sentinel, enqueue walks to the
+   tail and mallocs a node, and dequeue frees the sentinel. */
+
+void list_enqueue(node_t * head, float t) {
     node_t * tmp = head;
 
-    /* Iterate to the end of the linked list */
-    while(tmp->next != NULL) {
+    while (tmp->next != NULL)
         tmp = tmp->next;
-    }
 
-    /* Add this node to the end of the list */
     tmp->next       = malloc(sizeof(node_t));
     tmp->next->t    = t;
     tmp->next->next = NULL;
 }
 
-/* Pop from the queue and return the head's data */
-float dequeue(node_t ** head) {
-    float pop    = 0.0;
-    node_t * tmp = NULL;
-    
-    /* Check for null list */
-    if (head == NULL) {
-    	return -1.0;
-    }
+float list_dequeue(node_t ** head) {
+    node_t * tmp = (*head)->next;
+    float    pop = tmp->t;
 
-    /* Free head data and assign head pointer to the next node in the queue */
-    tmp = (*head)->next;
-    pop = (*head)->t;
     free(*head);
     *head = tmp;
-
-    /* Return data for the previous head */
     return pop;
 }
 
-/* Print the contents of the linked list */
-void print_list(node_t * head) {
-	node_t * tmp = head;
-	while (tmp != NULL) {
-		fprintf(stdout, "%f\n", tmp->t);
-		tmp = tmp->next;
-	}
-}
\ No newline at end of file
+/* Fill a queue to length len, then time pairs of a dequeue at the head and
+   an enqueue at the tail, counting the allocator calls made meanwhile.
+   The original list's work per operation grows with len, so it is timed
+   over fewer operations. */
+
+double ops_list(int len, long * allocs) {
+    int      i, j, ops = NUM_OPS / (1 + len / 10);
+    float    sim_time = 0.0, delay = 0.0;
+    node_t * head = malloc(sizeof(node_t));
+    node_t * tmp;
+    double   start;
+
+    head->next = NULL;
+    for (i = 0; i < len; ++i)
+        list_enqueue(head, sim_time++);
+
+    num_allocs = 0;
+    start = now_ns();
+    for (j = 0; j < ops; ++j) {
+        delay += sim_time - list_dequeue(&head);
+        list_enqueue(head, sim_time++);
+    }
+    start = (now_ns() - start) / ops;
+    *allocs = num_allocs;
+
+    while (head != NULL) {
+        tmp = head->next;
+        free(head);
+        head = tmp;
+    }
+    sink += delay;
+    return start;
+}
+
+double ops_pool(int len, long * allocs) {
+    int      i, j;
+    float    sim_time = 0.0, delay = 0.0;
+    fifo_t * q = fifo_create(FIFO_LIST, 0);
+    double   start;
+
+    for (i = 0; i < len; ++i)
+        fifo_push(q, sim_time++);
+
+    num_allocs = 0;
+    start = now_ns();
+    for (j = 0; j < NUM_OPS; ++j) {
+        delay += sim_time - fifo_pop(q);
+        fifo_push(q, sim_time++);
+    }
+    start = (now_ns() - start) / NUM_OPS;
+    *allocs = num_allocs;
+
+    fifo_destroy(q);
+    sink += delay;
+    return start;
+}
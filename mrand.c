@@ -1,76 +1,555 @@
-/* Combined MRG from Sec. 7.3.2, from L'Ecuyer (1999).  Multiple
-   (10,000) streams are supported, with seed vectors spaced
-   10,000,000,000,000,000 apart.  Throughout, input argument "stream"
-   must be an int giving the desired stream number.  The header file
-   mrand_seeds.h is included here, so must be available in the
-   appropriate directory.  The header file mrand.h must be included in
-   the calling program (#include "mrand.h") before using these
-   functions.
-
-   Usage: (Three functions)
-
-   1. To obtain the next U(0,1) random number from stream "stream,"
-      execute
-          u = mrand(stream); 
-      where mrand is a double function.  The double variable u will
-      contain the next random number.
-
-   2. To set the seed vector for stream "stream" to a desired 6-vector,
-      execute
-          mrandst(zset, stream);
-      where mrandst is a void function and zset must be a double
-      vector with positions 0 through 5 set to the desired
-      stream 6-vector, as described in Sec. 7.3.2.
-
-   3. To get the current (most recently used) 6-vector of integers in
-      the sequences (to use, e.g., as the seed for a subsequent
-      independent replication), into positions 0 through 5 of the
-      double vector zget, execute
-          mrandgt(zget, stream);
-      where mrandgt is void function.  */
-
-#include "mrand_seeds.h"
-#define norm   2.328306549295728e-10  /* 1.0/(m1+1) */
-#define norm2  2.328318825240738e-10  /* 1.0/(m2+1) */
-#define m1     4294967087.0
-#define m2     4294944443.0
-
-/* Generate the next random number. */
-
-double mrand(int stream)
-{
-    long k;
-    double p,
-           s10 = drng[stream][0], s11 = drng[stream][1], s12 = drng[stream][2],
-           s20 = drng[stream][3], s21 = drng[stream][4], s22 = drng[stream][5];
-
-    p = 1403580.0 * s11 - 810728.0 * s10;
-    k = p / m1;  p -= k*m1;  if (p < 0.0) p += m1;
-    s10 = s11;   s11 = s12;  s12 = p;
-
-    p = 527612.0 * s22 - 1370589.0 * s20;
-    k = p / m2;  p -= k*m2;  if (p < 0.0) p += m2;
-    s20 = s21;   s21 = s22;  s22 = p; 
-
-    drng[stream][0] = s10;  drng[stream][1] = s11;  drng[stream][2] = s12;
-    drng[stream][3] = s20;  drng[stream][4] = s21;  drng[stream][5] = s22;
-
-    if (s12 <= s22) return ((s12 - s22 + m1) * norm);
-    else return ((s12 - s22) * norm);
-}
-
-/* Set seed vector for stream "stream". */
-
-void mrandst(double* seed, int stream)
-{
-int i;
-    for (i = 0; i <= 5; ++i) drng[stream][i] = seed[i];
-}
-
-/* Get seed vector for stream "stream". */
-
-void mrandgt(double* seed, int stream)
-{
-int i;
-    for (i = 0; i <= 5; ++i) seed[i] = drng[stream][i];
-}
+/* Combined MRG from Sec. 7.3.2, from L'Ecuyer (1999).  Any nonnegative
+   int stream number is supported, with seed vectors spaced
+   10,000,000,000,000,000 apart: stream k starts from the seed of stream
+   0, (0, 0, 1, 0, 0, 1), advanced 10^16 * k steps.  That seed is computed
+   when the stream is first used, from the matrices that advance each
+   component 10^16 * 2^i steps, in O(log k) matrix-vector products.  The
+   seeds of streams 0 through 10,000 are those of the former table
+   mrand_seeds.h.  The state is kept as 64-bit integers and each step is
+   done in integer arithmetic: a product is reduced modulo m1 = 2^32 - 209
+   or m2 = 2^32 - 22853 by folding its high 32 bits back in times 209 or
+   22853, instead of dividing by m1 and m2 in floating point as the
+   original code did, with exactly the same results.  Throughout, input
+   argument "stream" must be an int giving the desired stream number.  The
+   state of a stream may also be held by the caller in an mrg_t, which
+   occupies a cache line of its own, and drawn from with the mrg_
+   functions below, so that threads drawing from their own mrg_t never
+   share a cache line; the functions taking a stream number are wrappers
+   around these.  The header file mrand.h must be included in the calling
+   program (#include "mrand.h") before using these functions.
+
+   Usage: (Six functions taking a stream number)
+
+   1. To obtain the next U(0,1) random number from stream "stream,"
+      execute
+          u = mrand(stream); 
+      where mrand is a double function.  The double variable u will
+      contain the next random number.
+
+   2. To set the seed vector for stream "stream" to a desired 6-vector,
+      execute
+          mrandst(zset, stream);
+      where mrandst is a void function and zset must be a double
+      vector with positions 0 through 5 set to the desired
+      stream 6-vector, as described in Sec. 7.3.2.
+
+   3. To get the current (most recently used) 6-vector of integers in
+      the sequences (to use, e.g., as the seed for a subsequent
+      independent replication), into positions 0 through 5 of the
+      double vector zget, execute
+          mrandgt(zget, stream);
+      where mrandgt is void function.
+
+   4. To fill positions 0 through n-1 of the double array u with the next
+      n random numbers from stream "stream," execute
+          mrand_fill(u, n, stream);
+      The numbers are exactly those n successive calls to mrand would
+      return, and the stream is left in the same state.  Each component of
+      the generator is a linear map of its last three values, so the next
+      8 values of a component are rows of the first 8 powers of that map
+      (the jump[] tables below) applied to the current three.  On machines
+      with AVX2 the 8 values of each component are computed at once in
+      vector registers, with the same folding as mrand; elsewhere the
+      state is simply kept in registers between steps.
+
+   5. To advance stream "stream" by n steps, as n calls to mrand would,
+      in O(log n) time, execute
+          mrandskip(stream, n);
+      where n is an unsigned long long.  This gives, e.g., substreams of
+      a stream for successive replications.
+
+   6. To obtain a pointer to the mrg_t holding stream "stream," for the
+      functions below, execute
+          g = mrand_state(stream);
+
+   Usage: (Handles)
+
+   1. To allocate an mrg_t g seeded with the seed vector of stream
+      "stream," execute
+          g = mrg_create(stream);
+      and to free it, mrg_destroy(g).  An mrg_t declared by the caller is
+      set the same way by
+          mrg_seed(g, stream);
+      Seeding takes O(log stream) matrix-vector products and touches no
+      memory but g and tables that are read only once set up, which under
+      GCC is done before main.
+
+   2. To obtain the next U(0,1) random number or the next n random
+      numbers in u[0..n-1] from g, or to advance g by n steps, execute
+          u = mrg_draw(g);
+          mrg_fill(g, u, n);
+          mrg_skip(g, n);
+      which behave as mrand, mrand_fill and mrandskip.
+
+   3. To save the state of g in positions 0 through 5 of the double
+      vector z and later to restore it, execute
+          mrg_save(g, z);
+          mrg_restore(g, z);
+      A saved z is also a valid seed vector for mrandst. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mrand.h"
+#define norm   2.328306549295728e-10  /* 1.0/(m1+1) */
+#define norm2  2.328318825240738e-10  /* 1.0/(m2+1) */
+#define m1     4294967087ULL
+#define m2     4294944443ULL
+#define fold1  209ULL                 /* 2^32 - m1 */
+#define fold2  22853ULL               /* 2^32 - m2 */
+#define LO32   0xffffffffULL
+
+#define FILL_STEPS 8
+#define SPACING    10000000000000000ULL  /* Steps between streams. */
+#define MAX_BITS   31                    /* Bits of a stream number. */
+
+/* The streams of the wrapper functions: state of each, or a first entry
+   of UNSEEDED if not yet seeded. */
+static mrg_t *zrng = NULL;
+static int num_streams = 0;       /* Streams with room in zrng. */
+#define UNSEEDED (~0ULL)
+
+/* span1[i] advances the first component 10^16 * 2^i steps, modulo m1;
+   span2[i] does the same for the second, modulo m2.  Set up by
+   spans_setup(). */
+static unsigned long long span1[MAX_BITS][3][3], span2[MAX_BITS][3][3];
+static int spans_ready = 0;
+
+/* jump1[i][j] is the coefficient of the (i+1)st of the last three values
+   of the first component (oldest first) in its value j+1 steps ahead,
+   modulo m1; jump2[i][j] is the same for the second component, modulo
+   m2. */
+
+static const long long jump1[3][FILL_STEPS] =
+{{4294156359LL,          0,  244671815,  149925673,
+  3782722441LL, 1527363550, 4072640363LL, 2064391165},
+ {   1403580, 4294156359LL, 2941890554LL,  489343630,
+  1831234280, 2758233149LL,  939574583, 3228066636LL},
+ {         0,    1403580, 4294156359LL, 2941890554LL,
+   489343630, 1831234280, 2758233149LL,  939574583}};
+
+static const long long jump2[3][FILL_STEPS] =
+{{4293573854LL, 2706407399LL, 1431525864,   97673890,
+  2680076935LL, 3405842137LL, 4035147174LL, 2623373296LL},
+ {         0, 4293573854LL, 2706407399LL, 1431525864,
+    97673890, 2680076935LL, 3405842137LL, 4035147174LL},
+ {    527612, 3497978192LL, 3281754271LL, 1673476130,
+  1430724370,  893509979, 3280220074LL,  361718588}};
+
+/* Matrix products and powers modulo m, for the maps that advance a
+   component: its last three values, oldest first, go to the values one
+   step later.  The result c may be the same array as an argument. */
+
+static void mat_mul(unsigned long long a[3][3], unsigned long long b[3][3],
+                    unsigned long long m, unsigned long long c[3][3])
+{
+    unsigned long long t[3][3];
+    int i, j, k;
+
+    for (i = 0; i < 3; ++i)
+        for (j = 0; j < 3; ++j) {
+            t[i][j] = 0;
+            for (k = 0; k < 3; ++k)
+                t[i][j] = (t[i][j] + a[i][k] * b[k][j] % m) % m;
+        }
+    for (i = 0; i < 3; ++i)
+        for (j = 0; j < 3; ++j)
+            c[i][j] = t[i][j];
+}
+
+
+static void mat_pow(unsigned long long a[3][3], unsigned long long n,
+                    unsigned long long m, unsigned long long c[3][3])
+{
+    unsigned long long p[3][3];
+    int i, j;
+
+    for (i = 0; i < 3; ++i)
+        for (j = 0; j < 3; ++j)
+            p[i][j] = a[i][j];
+    for (i = 0; i < 3; ++i)
+        for (j = 0; j < 3; ++j)
+            c[i][j] = i == j;
+    for (; n > 0; n >>= 1) {
+        if (n & 1)
+            mat_mul(c, p, m, c);
+        mat_mul(p, p, m, p);
+    }
+}
+
+
+/* Apply a to the three values in v, modulo m. */
+
+static void mat_apply(unsigned long long a[3][3], unsigned long long m,
+                      unsigned long long *v)
+{
+    unsigned long long x[3] = { v[0], v[1], v[2] }, y;
+    int i, k;
+
+    for (i = 0; i < 3; ++i) {
+        y = 0;
+        for (k = 0; k < 3; ++k)
+            y = (y + a[i][k] * x[k] % m) % m;
+        v[i] = y;
+    }
+}
+
+
+/* The one-step maps of the two components. */
+
+static void one_step(unsigned long long a1[3][3], unsigned long long a2[3][3])
+{
+    static const unsigned long long
+        s1[3][3] = {{0, 1, 0}, {0, 0, 1}, {4294156359ULL, 1403580, 0}},
+        s2[3][3] = {{0, 1, 0}, {0, 0, 1}, {4293573854ULL, 0, 527612}};
+    int i, j;
+
+    for (i = 0; i < 3; ++i)
+        for (j = 0; j < 3; ++j) {
+            a1[i][j] = s1[i][j];
+            a2[i][j] = s2[i][j];
+        }
+}
+
+
+/* Set up span1 and span2.  Under GCC this is done before main, so that
+   seeding from several threads only ever reads them. */
+
+#if defined(__GNUC__)
+__attribute__((constructor))
+#endif
+static void spans_setup(void)
+{
+    unsigned long long a1[3][3], a2[3][3];
+    int i;
+
+    one_step(a1, a2);
+    mat_pow(a1, SPACING, m1, span1[0]);
+    mat_pow(a2, SPACING, m2, span2[0]);
+    for (i = 1; i < MAX_BITS; ++i) {
+        mat_mul(span1[i - 1], span1[i - 1], m1, span1[i]);
+        mat_mul(span2[i - 1], span2[i - 1], m2, span2[i]);
+    }
+    spans_ready = 1;
+}
+
+
+mrg_t *mrg_create(int stream)
+{
+    mrg_t *g = aligned_alloc(sizeof(mrg_t), sizeof(mrg_t));
+
+    if (g == NULL) {
+        fprintf(stderr, "\nmrg_create: out of memory\n");
+        exit(3);
+    }
+    mrg_seed(g, stream);
+    return g;
+}
+
+
+void mrg_destroy(mrg_t *g)
+{
+    free(g);
+}
+
+
+/* Set g to the seed vector of stream "stream": start from the seed of
+   stream 0 and advance it 10^16 * stream steps, one set bit of "stream"
+   at a time. */
+
+void mrg_seed(mrg_t *g, int stream)
+{
+    int i;
+
+    if (!spans_ready)
+        spans_setup();
+    g->z[0] = 0;  g->z[1] = 0;  g->z[2] = 1;
+    g->z[3] = 0;  g->z[4] = 0;  g->z[5] = 1;
+    for (i = 0; i < MAX_BITS; ++i)
+        if (stream >> i & 1) {
+            mat_apply(span1[i], m1, g->z);
+            mat_apply(span2[i], m2, g->z + 3);
+        }
+}
+
+
+void mrg_save(const mrg_t *g, double *z)
+{
+    int i;
+
+    for (i = 0; i < 6; ++i) z[i] = g->z[i];
+}
+
+
+void mrg_restore(mrg_t *g, const double *z)
+{
+    int i;
+
+    for (i = 0; i < 6; ++i) g->z[i] = z[i];
+}
+
+
+/* Make room for stream "stream" in zrng and seed it.  The room is
+   allocated a cache line at a time, so it is copied rather than
+   reallocated when it grows. */
+
+static mrg_t *mrand_seed(int stream)
+{
+    mrg_t *grown;
+    int    i, n;
+
+    if (stream >= num_streams) {
+        n = num_streams < 16 ? 16 : num_streams;
+        while (n <= stream)
+            n = n < 1073741824 ? 2 * n : stream + 1;
+        grown = aligned_alloc(sizeof(mrg_t), n * sizeof(mrg_t));
+        if (grown == NULL) {
+            fprintf(stderr, "\nmrand: out of memory\n");
+            exit(3);
+        }
+        if (num_streams > 0)
+            memcpy(grown, zrng, num_streams * sizeof(mrg_t));
+        free(zrng);
+        zrng = grown;
+        for (i = num_streams; i < n; ++i)
+            zrng[i].z[0] = UNSEEDED;
+        num_streams = n;
+    }
+
+    mrg_seed(&zrng[stream], stream);
+    return &zrng[stream];
+}
+
+
+/* Return the state of stream "stream", seeding it on first use. */
+
+mrg_t *mrand_state(int stream)
+{
+    if (stream < num_streams && zrng[stream].z[0] != UNSEEDED)
+        return &zrng[stream];
+    return mrand_seed(stream);
+}
+
+
+/* Advance the state z[0..5] one step and return the new number.  Adding
+   810728 * m1 (or 1370589 * m2) makes the recurrence nonnegative and
+   keeps it below 2^54; two folds bring it below 2 * m1 (or 2 * m2), and
+   one subtraction below m1 (or m2). */
+
+static double mrand_next(unsigned long long *z)
+{
+    unsigned long long p, s12, s22;
+
+    p = 1403580ULL * z[1] + 810728ULL * (m1 - z[0]);
+    p = (p & LO32) + (p >> 32) * fold1;
+    p = (p & LO32) + (p >> 32) * fold1;
+    s12 = p >= m1 ? p - m1 : p;
+
+    p = 527612ULL * z[5] + 1370589ULL * (m2 - z[3]);
+    p = (p & LO32) + (p >> 32) * fold2;
+    p = (p & LO32) + (p >> 32) * fold2;
+    s22 = p >= m2 ? p - m2 : p;
+
+    z[0] = z[1];  z[1] = z[2];  z[2] = s12;
+    z[3] = z[4];  z[4] = z[5];  z[5] = s22;
+
+    if (s12 <= s22) return (double) (s12 - s22 + m1) * norm;
+    else return (double) (s12 - s22) * norm;
+}
+
+
+/* Generate the next random number. */
+
+double mrg_draw(mrg_t *g)
+{
+    return mrand_next(g->z);
+}
+
+
+double mrand(int stream)
+{
+    return mrand_next(mrand_state(stream)->z);
+}
+
+/* Set seed vector for stream "stream". */
+
+void mrandst(double* seed, int stream)
+{
+    mrg_restore(mrand_state(stream), seed);
+}
+
+/* Get seed vector for stream "stream". */
+
+void mrandgt(double* seed, int stream)
+{
+    mrg_save(mrand_state(stream), seed);
+}
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+
+/* Reduce 4 lanes below 2^49 modulo m = 2^32 - c, folding the high bits
+   down twice and then subtracting m while a lane is at least m. */
+
+__attribute__((target("avx2")))
+static __m256i fold_avx2(__m256i p, __m256i c, __m256i m)
+{
+    const __m256i lo = _mm256_set1_epi64x(0xffffffffLL);
+    __m256i       m_1 = _mm256_sub_epi64(m, _mm256_set1_epi64x(1));
+
+    p = _mm256_add_epi64(_mm256_and_si256(p, lo),
+                         _mm256_mul_epu32(_mm256_srli_epi64(p, 32), c));
+    p = _mm256_add_epi64(_mm256_and_si256(p, lo),
+                         _mm256_mul_epu32(_mm256_srli_epi64(p, 32), c));
+    p = _mm256_sub_epi64(p, _mm256_and_si256(_mm256_cmpgt_epi64(p, m_1), m));
+    return p;
+}
+
+
+/* Values 1-4 (or 5-8) steps ahead of one component, whose last three
+   values are broadcast in s0, s1, s2, from the matching columns of its
+   jump table. */
+
+__attribute__((target("avx2")))
+static __m256i ahead_avx2(__m256i s0, __m256i s1, __m256i s2,
+                          const long long *j0, const long long *j1,
+                          const long long *j2, __m256i c, __m256i m)
+{
+    const __m256i lo = _mm256_set1_epi64x(0xffffffffLL);
+    __m256i       p, sum;
+
+    /* Fold each 64-bit product once, so that the three sum below 2^49. */
+    p   = _mm256_mul_epu32(s0, _mm256_loadu_si256((const __m256i *) j0));
+    sum = _mm256_add_epi64(_mm256_and_si256(p, lo),
+                           _mm256_mul_epu32(_mm256_srli_epi64(p, 32), c));
+    p   = _mm256_mul_epu32(s1, _mm256_loadu_si256((const __m256i *) j1));
+    sum = _mm256_add_epi64(sum, _mm256_add_epi64(_mm256_and_si256(p, lo),
+                           _mm256_mul_epu32(_mm256_srli_epi64(p, 32), c)));
+    p   = _mm256_mul_epu32(s2, _mm256_loadu_si256((const __m256i *) j2));
+    sum = _mm256_add_epi64(sum, _mm256_add_epi64(_mm256_and_si256(p, lo),
+                           _mm256_mul_epu32(_mm256_srli_epi64(p, 32), c)));
+    return fold_avx2(sum, c, m);
+}
+
+
+/* Convert 4 lanes below 2^52 to double exactly. */
+
+__attribute__((target("avx2")))
+static __m256d to_double_avx2(__m256i x)
+{
+    const __m256i bits  = _mm256_set1_epi64x(0x4330000000000000LL);
+    const __m256d magic = _mm256_set1_pd(4503599627370496.0);  /* 2^52 */
+
+    return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(x, bits)), magic);
+}
+
+
+/* The 4 numbers mrand would return for component values x and y. */
+
+__attribute__((target("avx2")))
+static __m256d output_avx2(__m256i x, __m256i y)
+{
+    __m256d d = _mm256_sub_pd(to_double_avx2(x), to_double_avx2(y));
+
+    d = _mm256_add_pd(d, _mm256_and_pd(_mm256_cmp_pd(d, _mm256_setzero_pd(),
+                                                     _CMP_LE_OQ),
+                                       _mm256_set1_pd(m1)));
+    return _mm256_mul_pd(d, _mm256_set1_pd(norm));
+}
+
+
+/* Fill u[0..n-1], n a multiple of 8, from the state in s[0..5]. */
+
+__attribute__((target("avx2")))
+static void fill_avx2(double *u, int n, unsigned long long *s)
+{
+    const __m256i c1  = _mm256_set1_epi64x(fold1),
+                  c2  = _mm256_set1_epi64x(fold2),
+                  mm1 = _mm256_set1_epi64x((long long) m1),
+                  mm2 = _mm256_set1_epi64x((long long) m2);
+    __m256i x0 = _mm256_set1_epi64x((long long) s[0]),
+            x1 = _mm256_set1_epi64x((long long) s[1]),
+            x2 = _mm256_set1_epi64x((long long) s[2]),
+            y0 = _mm256_set1_epi64x((long long) s[3]),
+            y1 = _mm256_set1_epi64x((long long) s[4]),
+            y2 = _mm256_set1_epi64x((long long) s[5]),
+            xa, xb, ya, yb;
+    unsigned long long last[4];
+    int                i;
+
+    for (i = 0; i < n; i += FILL_STEPS) {
+        xa = ahead_avx2(x0, x1, x2, jump1[0], jump1[1], jump1[2], c1, mm1);
+        xb = ahead_avx2(x0, x1, x2, jump1[0] + 4, jump1[1] + 4, jump1[2] + 4,
+                        c1, mm1);
+        ya = ahead_avx2(y0, y1, y2, jump2[0], jump2[1], jump2[2], c2, mm2);
+        yb = ahead_avx2(y0, y1, y2, jump2[0] + 4, jump2[1] + 4, jump2[2] + 4,
+                        c2, mm2);
+
+        _mm256_storeu_pd(u + i,     output_avx2(xa, ya));
+        _mm256_storeu_pd(u + i + 4, output_avx2(xb, yb));
+
+        /* The new state is the values 6, 7 and 8 steps ahead. */
+        x0 = _mm256_permute4x64_epi64(xb, 0x55);
+        x1 = _mm256_permute4x64_epi64(xb, 0xaa);
+        x2 = _mm256_permute4x64_epi64(xb, 0xff);
+        y0 = _mm256_permute4x64_epi64(yb, 0x55);
+        y1 = _mm256_permute4x64_epi64(yb, 0xaa);
+        y2 = _mm256_permute4x64_epi64(yb, 0xff);
+    }
+
+    _mm256_storeu_si256((__m256i *) last, xb);
+    s[0] = last[1];  s[1] = last[2];  s[2] = last[3];
+    _mm256_storeu_si256((__m256i *) last, yb);
+    s[3] = last[1];  s[4] = last[2];  s[5] = last[3];
+}
+#endif
+
+/* Fill u[0..n-1] with the next n random numbers from g. */
+
+void mrg_fill(mrg_t *g, double *u, int n)
+{
+    int i = 0, j;
+    unsigned long long *z = g->z, s[6];
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if (n >= FILL_STEPS && __builtin_cpu_supports("avx2")) {
+        i = n - n % FILL_STEPS;
+        fill_avx2(u, i, z);
+    }
+#endif
+
+    /* Generate the rest one at a time, as mrand does, with the state in
+       local variables. */
+    for (j = 0; j < 6; ++j) s[j] = z[j];
+    for (; i < n; ++i)
+        u[i] = mrand_next(s);
+    for (j = 0; j < 6; ++j) z[j] = s[j];
+}
+
+
+void mrand_fill(double* u, int n, int stream)
+{
+    mrg_fill(mrand_state(stream), u, n);
+}
+
+
+/* Advance g by n steps. */
+
+void mrg_skip(mrg_t *g, unsigned long long n)
+{
+    unsigned long long a1[3][3], a2[3][3];
+    unsigned long long *z = g->z;
+
+    one_step(a1, a2);
+    mat_pow(a1, n, m1, a1);
+    mat_pow(a2, n, m2, a2);
+    mat_apply(a1, m1, z);
+    mat_apply(a2, m2, z + 3);
+}
+
+
+void mrandskip(int stream, unsigned long long n)
+{
+    mrg_skip(mrand_state(stream), n);
+}
@@ -1,5 +1,23 @@
-/* Header file "mrand.h" to be included by programs using mrand.c */
-
-double mrand(int stream);
-void mrandst(double* seed, int stream);
-void mrandgt(double* seed, int stream);
+/* Header file "mrand.h" to be included by programs using mrand.c */
+
+/* The state of one stream, alone in a cache line of 64 bytes. */
+
+typedef struct {
+    _Alignas(64) unsigned long long z[6];
+} mrg_t;
+
+double mrand(int stream);
+void mrandst(double* seed, int stream);
+void mrandgt(double* seed, int stream);
+void mrand_fill(double* u, int n, int stream);
+void mrandskip(int stream, unsigned long long n);
+mrg_t *mrand_state(int stream);
+
+mrg_t *mrg_create(int stream);
+void mrg_destroy(mrg_t *g);
+void mrg_seed(mrg_t *g, int stream);
+double mrg_draw(mrg_t *g);
+void mrg_fill(mrg_t *g, double *u, int n);
+void mrg_skip(mrg_t *g, unsigned long long n);
+void mrg_save(const mrg_t *g, double *z);
+void mrg_restore(mrg_t *g, const double *z);
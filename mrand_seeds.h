@@ -1,10006 +0,0 @@
-/* Header file "mrand_seeds.h" included by mrand.c */
-
-static double drng[][6] =
-{
-           0,           0,           1,           0,           0,           1, 
-  1772212344,  1374954571,  2377447708,   540628578,  1843308759,   549575061, 
-  2602294560,  1764491502,  3872775590,  4089362440,  2683806282,   437563332, 
-   376810349,  1545165407,  3443838735,  3650079346,  1898051052,  2606578666, 
-  1847817841,  3038743716,  2014183350,  2883836363,  3242147124,  1955620878, 
-  1075987441,  3468627582,  2694529948,   368150488,  2026479331,  2067041056, 
-   134547324,  4246812979,  1700384422,  2358888058,    83616724,  3045736624, 
-  2816844169,   885735878,  1824365395,  2629582008,  3405363962,  1835381773, 
-   675808621,   434584068,  4021752986,  3831444678,  4193349505,  2833414845, 
-  2876117643,  1466108979,   163986545,  1530526354,    68578399,  1111539974, 
-   411040508,   544377427,  2887694751,   702892456,   758163486,  2462939166, 
-  3631741414,  3388407961,  1205439229,   581001230,  3728119407,    94602786, 
-  4267066799,  3221182590,  2432930550,   813784585,  1980232156,  2376040999, 
-  1601564418,  2988901653,  4114588926,  2447029331,  4071707675,  3696447685, 
-  3878417653,  2549122180,  1351098226,  3888036970,  1344540382,  2430069028, 
-   197118588,  1885407936,   576504243,   439732583,   103559440,  3361573194, 
-  4024454184,  2530169746,  2135879297,  2516366026,   260078159,  2905856966, 
-  2331743881,  2059737664,   186644977,   401315249,    72328980,  1082588425, 
-   694808921,  2851138195,  1756125381,  1738505503,  2662188364,  3598740668, 
-  2834735415,  2017577369,  3257393066,  3823680297,  2315410613,   637316697, 
-  4132025555,  3700940887,   838767760,  2818574268,  1375004287,  2172829019, 
-  3489426225,  4112746453,  2594929844,  1633976546,  1583084490,  4147801476, 
-   226509369,   146935912,  3937833922,  1061829953,   813052180,  3597307501, 
-  3256044974,  3681783929,   575085515,  1457436746,  1015379089,   237144042, 
-  3893937255,  2700371479,  2540977187,   448868868,  2639602201,  3320881846, 
-  2151265850,  2125810247,  1191988643,  1600692767,   135550530,   395838860, 
-  3135267209,  3623600367,  2626505177,  4281737957,  2062913934,  2592194162, 
-   390422829,  1811400753,   322793407,  3490624807,  3235017317,   371104964, 
-  2656265790,  3996442108,  3386349306,  1626832241,  1574763932,  3706202892, 
-  3589952455,  1163511069,  2697607059,   534184903,  3766759256,   251252346, 
-  2882420196,  3003606956,  3629906612,  2537203610,  2746594184,  1661091636, 
-  1183183944,   583879472,  4255459700,   713754974,  2922254235,  1161913813, 
-  4132807367,  3628950852,   399250763,  3845478137,  1309889890,   213170736, 
-  3112893239,  1632688723,  1523209273,  1177690048,  3460621046,  2768883982, 
-  2661550465,  1554695591,  4025759551,  3938508444,  4250175274,  1555765950, 
-  2684621241,  1586910242,  3611689202,   206694063,     6969092,  1062099384, 
-   235778005,  1845387954,  3114888710,  2203759286,  3114065342,  2496367282, 
-  2441823102,  2650658691,  1337568664,  1857164665,  1915815707,   884425315, 
-  4101909040,  4166390745,  2860172669,  3497960192,  3577628224,  4213141252, 
-  3699546758,  3377270633,    68718870,  2774746460,  1020495218,  1575238977, 
-  1139564619,  2523670566,  3355096665,   495198678,  2395315759,   849476900, 
-   635963092,   311652233,   262540809,  3184560243,  2651025088,   789619078, 
-  1271360621,  4223486533,  1390580044,  2888955378,  3184629747,   630626237, 
-  1678221843,   231113094,  4130363024,  3852779467,  1604842289,  4212522078, 
-  2778593270,  1004903484,  2973098739,   665751699,  2332674775,   295462521, 
-  4198005471,   972878412,  1558189575,    55781237,  3893360589,  1732945031, 
-  1152796221,  1778239045,  1459562806,  3905398533,  3769475924,  2644342737, 
-  2510032067,  3734379515,   531296007,   701842463,  2074273193,  2292680950, 
-  2971989859,  2256121557,  2142214447,  3137353222,   773588230,  3902637774, 
-  4229774628,   121176046,  3728703289,  3849382323,  2003165682,  1467065642, 
-   323392186,  3824746296,  1629368039,   739902158,  1994020456,  1037183254, 
-   513283862,  2188379510,  1957928689,   813409383,  3806082123,   635316674, 
-   552826185,  2555996419,  2271338972,  3547921306,  1228993928,  2361559081, 
-  1295138976,  1495710207,   723074677,  3820787179,  3845682156,  4174822106, 
-  2521565200,    31792620,  3784456031,  1065580104,  3937944782,  4215959677, 
-  3400057703,  2744571285,  1393759441,  1601776871,  3165609536,   835804949, 
-  4088663797,   662403715,  1972116992,  2505435866,  3440128606,   777899473, 
-  3780961670,  2157269301,  1083414147,  2821221342,  3067184313,  2993244053, 
-  2795653207,  2163909033,  3809789650,  2585746232,  3313980374,  3096075721, 
-  2378158017,  3726102874,  2689185822,  2369776558,   432649940,  1111256897, 
-  3456908798,   495588917,  1480249157,  2815947509,  1071333363,  1928430914, 
-   717921372,  2683845918,   930457772,  2530097953,  2417205907,  3022951420, 
-  1689355612,  1039193903,  3613681802,  1080205242,  2013101883,  2468502905, 
-  2504068936,  3230484718,  1748896401,  1453957344,   848547757,   161200170, 
-  4201049117,   444124251,  2581583939,  1322446501,   681505596,  1663004988, 
-  2930586493,  3370079320,   198796253,  3012797217,  3840048005,   184999535, 
-  2532724791,  1241080524,  3800041958,  3303947134,  3174626846,  3073510302, 
-    14809834,  3618645306,  1942542077,   669052232,   651470251,  1391560038, 
-   995707287,  1759822820,  2501644613,  3721319358,  3968667126,  2535846961, 
-   979173856,  1997457820,  1968292063,  1380431809,  3055802991,   540373583, 
-  3681007982,  2977347732,   571110841,  2217121181,  2733362413,    32186934, 
-  1975286634,   958506122,    46451179,  3475987512,  2626451279,  3517401221, 
-   330144009,  1060219535,  1447223839,  3165226575,   599904263,  3911112835, 
-  2537161090,  3500106754,   926795530,   728440468,  1129037665,  2789187437, 
-  3793615118,  2750706029,  2156058298,  3079033430,  2780569996,  3936920391, 
-  1198120767,  2694820585,  2834525274,   188651758,   308670432,  1369385984, 
-  2702470127,    19874369,  4012779639,  3121258228,  1839121226,  3861314075, 
-  2554275712,   719378996,  2400430690,  1141204239,  1627924328,  1297183842, 
-   705258195,  4161016439,  1462878351,  3976713745,  1141257086,  3425581727, 
-  3358325932,  2544614576,  1863746614,  1124881023,  3147032679,  3087920200, 
-  2977113134,  3977111791,  4253114310,   142443885,   243603301,  3716506593, 
-  3431919302,  1245400869,  1324788929,  2860157607,   941144108,  3857335131, 
-  3906194044,  1681219081,  2843586309,  4089310580,  2176521638,   690520146, 
-  3745569546,   792495396,  1806539660,  4272439405,  1894505679,  1392532334, 
-   865747759,  3079408284,  1984574005,   613765073,  1551526411,  4256443592, 
-  2814963340,  2834960950,  2968542314,   309822219,  1823774832,  1839552557, 
-  2548640113,  2862571993,  4042326055,  2483508296,  2762715198,   593338793, 
-  2568040427,  2120166173,   942509028,  2137567779,  2626314860,  2259019634, 
-  1311709266,  3938696051,  1456683566,  3795230520,  1388639258,  2800468070, 
-  3117451406,   928974817,  2781895567,   321394107,   110152236,  2088746743, 
-  1875039110,  3442179808,  3890426888,  1777391452,  1835432708,   562722092, 
-  1448528649,  2330442989,  2407439339,  3707873573,  4196869323,  2107506543, 
-  2780921782,   358207338,  3529199325,  4247445586,  2383769411,  3241037506, 
-  1378002714,  2723574102,  1749215013,  2907202697,  2962834356,  1188034898, 
-   120313119,  1494806970,  2910978351,   722434700,  1419161042,  2517182236, 
-  1195864685,  3838840335,  1111591396,  3060365866,  2463752639,  3666213547, 
-  1333023911,  1979613259,  2132866392,  1394964690,  1264353313,  3231502632, 
-  3768306921,  1680121724,   805680272,  1951253770,  1486168061,  2955477946, 
-   109224445,  2861250694,  4196750427,   939526471,  1752437524,  1145799039, 
-   408306775,  2148819781,  3316724552,   137163319,  4180687869,   574961213, 
-  2386386992,  3078479797,   167075008,  1253465513,  4072841169,  2167533564, 
-  2315827434,  3392038067,  2279258261,  1432017357,   568998206,  1206469405, 
-  1678601670,  1150247641,  2499326926,   699715048,  1501364333,  1669290797, 
-  3957493358,  1670076821,   804110344,  2866685751,   836848697,  3107121052, 
-    19764713,  3522310913,    46276655,  1383766567,  2804181892,   581103203, 
-  2167472521,  2014671778,   682905578,   958597651,  1861637882,  2944058806, 
-  1385430895,  2356575885,   353068024,  2200078216,  3700934213,  2049244134, 
-  2833841811,  3185343708,  1090554308,   595830647,    11546156,   812414988, 
-   968812800,  3123207359,  2759640075,  2696848485,  1678403296,  3773995716, 
-   840236174,  3526637660,  4058538497,  3302218596,  3827979469,  2075185104, 
-  1134590412,   890326218,  1397678185,    17901169,  1636324160,   155684467, 
-  2417485870,  4187012752,  2471614778,  3401206287,  2236132104,  1925076677, 
-   409076633,   138200637,   534262654,   170693953,  3102340032,   186137910, 
-  1840875213,   879540625,   791467211,  2514136033,  2877359342,  2883634657, 
-  3505105649,   104133676,  1539837496,  2128875612,  3052052925,  4211889302, 
-   896923878,  3135723093,  1791043017,  3646191373,  3172519941,  2093781646, 
-  2222859505,   444924434,   196289768,  2499035230,  2869312181,   636886484, 
-  3730540589,  3232474660,  1781917564,  3720273469,  1292682041,  2824979855, 
-  2841888278,  2990967857,  2764821478,  1039953293,  1432962019,  2952732867, 
-  4222281370,  3776080821,  1110876229,    83862283,  1816657732,  4253577541, 
-  1208898880,  3446559293,  3884103245,  1092989712,   789761206,  2496084542, 
-  1362833465,  2902364806,  3962562565,  1584273191,  1581951512,   314212827, 
-  4034387952,  4212323873,  1215556249,  4114176610,   314477640,  1102481802, 
-  4216454304,  3097720081,  2100164655,  2111666470,  3168350541,   911341790, 
-   235086596,  3078069032,  2849850906,  4006268304,  3621689937,  1752818559, 
-  2561118695,  1359899900,   120233830,  1772699343,  3566372298,   190473233, 
-  1623940678,  3352345082,   588597541,  2642764851,  2212913553,  2827710582, 
-  3198409257,  1057617817,  2723637644,  4151165210,  3933857338,   153832659, 
-  2141448700,   931043448,  3972563106,   281421145,  4117387806,   635579188, 
-   572888822,  1755780990,  3644525073,  1593845110,  3182029115,  3500004183, 
-  2485774913,  3572825150,  2297437420,  2533946233,  3481175635,  3606142401, 
-  3988803528,  2149528350,  4227249907,  1091797855,  3353712884,  3140513565, 
-  1142068543,  3480780802,   365906160,  4145081757,  1526050176,  2476753123, 
-  3639467390,  2033633945,  3779796312,  1340589230,  2131693900,  2266655456, 
-  1066518541,  1552771636,  1776704296,  1161842314,  4112464213,  1989503814, 
-  3052278808,  2689306117,  4217824011,  3418061529,   452384302,   752057746, 
-   311084890,  4184322385,  1281084011,  3003732500,  3489203675,  3887682877, 
-    81451189,  2211072148,  1583364330,  1758485202,  3739249845,  3250830076, 
-  3491649208,   334377295,  2876443753,  2539957041,  2839687743,  1053747129, 
-   118851792,  1577867278,  2706390476,  2002398228,  4230039565,  1171407625, 
-  3370386313,  4002390230,  1876838840,  3692042219,  2633768909,   802495609, 
-  4152478315,    38010269,   354617674,  3951655610,  2172601062,  4032710847, 
-  3545462600,  4021035191,  2284997786,  2598491900,  2978248132,  2190117645, 
-  3874107424,  3007551560,  3913294741,  4068735802,   799750594,  1510855703, 
-  1076951717,   457487081,  3692466040,  1167649296,  2061830097,  2922935049, 
-  2001878545,  1789258674,  1731515798,  2805466112,  3541206508,  3233899833, 
-  1589586946,  2001884471,  1137588289,  2280875749,  1999638691,  3387977391, 
-  2914263047,  2489870434,  3626517924,  1198705539,  3019951509,  2749057096, 
-  2909236943,  4253566321,  3921285870,  1461143753,   780828816,  3406105822, 
-  1396568500,  3970621096,   937446184,   197425380,  3900572949,  3236731959, 
-  2172025159,  1724604777,   615287793,  2806607906,  1536758570,  2480798627, 
-   255465842,  2118848877,  2711113211,  3330713564,  2597768929,  3423805950, 
-   591451481,  3231728507,  3980702395,  3993399784,   582508070,   401882147, 
-  2979686056,  2605765598,  3261557424,  1704512361,  3581487583,  4163863918, 
-  3422392601,  1937976329,   897270108,  4200352002,   111503146,   217046658, 
-    26359120,  3598581019,  3214698794,  2917332688,  4234171206,  1747293565, 
-  3829144113,  4013113129,  4240547683,   183631880,  4104847387,   808861864, 
-  4266876338,  2162684321,  3675140194,   764153197,   667816904,   811631412, 
-  2222841939,  1214394911,  1826581449,  4088096456,  1002421216,  2952104700, 
-  1712318718,  3475060577,  2366902856,  1311661221,  2505880802,  3543401515, 
-  1842283581,  1287454151,  1575584930,  1965746823,   828326642,  2813487794, 
-  1755263989,  3085298219,  4010055946,  2379055856,  3708802031,  3842162166, 
-   238251413,   849842969,  4272531287,   230065166,  4166391919,  1752273912, 
-  2570979412,  2489401667,  2827424194,  1639576561,  1838038183,  1877037401, 
-  3737593581,  3462392385,  2506985965,  3181536328,  4179829346,  3983325072, 
-  4239290999,  3798734732,  3538954329,  1870087030,   982574470,  4087540638, 
-  2735208281,   968624674,    54276831,  2110888789,   123131433,  1867617091, 
-  1198324303,   280341691,  1824997801,  3673905886,  1282202773,  1344611900, 
-  1621192172,  2990750597,  3054555220,  1210666329,   811418816,  1711574946, 
-  2022315850,  2439159308,  1538427153,  1514324411,  3575594256,  3355141056, 
-   925334800,  1932043909,  1089095554,  3835127973,  1746395003,    82768221, 
-  4169860516,   579656085,  3373681510,   607474404,  2127826302,  2108007456, 
-   405749023,  3135257738,    51416753,  4271241087,   600855511,  4238445362, 
-   620002506,  3808724740,  3074071840,   160904792,   983878282,  3091672936, 
-  2023585183,  2993057483,  3773871083,  1772316345,  2395855450,  2518152131, 
-  3727459874,  2742644750,  1645862042,  2140075786,  2462073907,  4094228741, 
-   611775417,  3914081326,  3596279764,   557666006,  3571640840,  4184731077, 
-  2345402778,  1362357742,   541379425,  4238817167,  2871549417,  2413135225, 
-  2136342493,  2137322318,   154899576,   864498920,  1368926078,   446502369, 
-   699811199,  2984825878,    26380246,  2214574692,  2219375821,  1751210879, 
-  2608596783,  1026666630,   427870763,  3813291381,  2427476462,  1444772291, 
-  3946033260,  3501087782,  1504595973,  3866214422,  1383596619,  1228035908, 
-   111541610,  3083097308,  2713819108,   374226336,  4186460421,  4057366726, 
-  3410272764,  1676878042,  4142753837,  3250035416,  2223626124,   729498154, 
-  2325024221,   946438568,  1833289684,  3617603546,  1404121853,    44357093, 
-  2956911357,  1579562934,  1564406219,  3170152805,   273147292,  2723083005, 
-  2919313346,  1685759919,  2661579305,   413152734,  2547364072,   532666430, 
-   744419299,  3438698767,  1306761728,  4086240455,  2209655811,  2014926282, 
-  4170284595,   485716022,  1404716568,  2995939663,  3401309937,   372882569, 
-  3274132021,  3230904086,  3093094378,  3625250107,  3582135806,  3321050743, 
-  3376732916,  2577396175,  2013052075,  2230184544,   409731222,  3540505190, 
-  3087173712,   636223402,  4294718618,   941664589,    80154581,  2330755672, 
-   445846499,  2364389126,   324411596,   272980602,    84392226,  3427882894, 
-  1588072573,   152970339,  1443581049,  1610335781,  2425289002,  1205027785, 
-   224358076,   831166947,   545466829,   810405455,  4173514459,  1116677313, 
-  2016133737,  4149113369,   308366638,  2279229473,  1415032816,   624778491, 
-   975481440,  1462853282,   683229360,  3596466613,  3489184647,  1214646031, 
-  3918900295,  3126519944,  2010091123,  3348048606,  2768777628,  1352222609, 
-  3855567915,  2091985504,  1684665363,  3957002109,   556238500,  2791339222, 
-  2791520793,  3672631510,  3348461817,  1395495570,   440280353,  4201081795, 
-  2158664670,  1910957003,  1604470931,  2122592367,  2780663819,  3218620411, 
-  3990201382,  3702916744,   146535241,   754395735,  2188789611,  2061334392, 
-  2983374345,  2069861624,  3454365867,  2308179822,  1550664874,  2713593857, 
-   383335379,  3047456225,  2406417094,     5581877,  1158801481,  2171928479, 
-   615105607,  1699809558,  2571880736,  1781153536,  3252815941,    10000104, 
-  1517532602,  3704804288,  3176371836,  2960713102,  2451186198,   233067538, 
-  3509824805,   309235786,  1305263064,  2297004641,   997001495,  3989965351, 
-   398993329,   808031667,   648014403,  2162680551,  3430192660,  2434997262, 
-   305543687,   341168499,   614167274,     5924182,   505200342,  4162186830, 
-   830403782,  3725535740,  3735392573,    46280914,  2509967193,  1150811159, 
-  4041169203,  3330550407,  3358310343,  4238116147,  3332257516,   904827594, 
-  1663775260,  1828149028,   684157433,  1908485102,  1494388753,  2215953731, 
-  4066341710,  1159723440,   706477473,  2724146560,  4049882570,  1861492607, 
-  1507113305,  4122744504,  4023201007,  2941608697,  3643459770,   256027895, 
-  3437959508,  3945529552,  2535699018,  1010170421,  1111890338,  4213255087, 
-    51351560,  1448474471,  3362138304,   921302021,  2165726394,  1413007153, 
-  2362956170,  1953474118,  2067291089,  3191796005,  1182678870,  1547770487, 
-  2964679118,  4294936376,  2298769800,  2958490513,  1045751196,  3417908513, 
-   611803884,  2967145184,  3890677236,  2992585647,   906112965,  3008948634, 
-   683601493,  4195693143,   772385653,  3395118529,   274147372,  3225495984, 
-   217998383,  2802726542,  3032517757,  3621544176,  1892185497,  1250691886, 
-  2288242273,   461614178,  1505911367,  4282808335,  2991350834,  1901851980, 
-  4182929395,  2974049710,  1342084833,  2616067645,  2910189535,  2333035174, 
-   409107893,  1250323015,   991735478,  1635507703,  2997990758,  4077510189, 
-  2287231989,  2770866225,  3905237734,   876018837,  1561088818,  1715916623, 
-   541433109,  1239175828,   377516936,  1490550792,   757401495,   671496262, 
-  1474939093,   281598051,   496233723,  2957179272,  3355693007,   966758529, 
-  2703198080,  3869613817,  1097432793,  3511677476,  3457413678,  2309502762, 
-  3663265540,    62911645,  4061701595,  1762473338,  1557424464,  2886962682, 
-  3007706587,   634991523,   859351183,  3870579928,  3640242847,  1821161025, 
-  3831899017,  4249050617,  2379658721,  4094510906,  1421353832,  2643513234, 
-  2220935214,  2275884870,  1367704236,  3811303943,  3692637905,  3312498568, 
-  2521696298,   238704027,  3806682673,  2905750445,  4057434281,  2203176592, 
-  3309699653,  4054978521,  2682024238,   791034227,  3186855390,  2365378543, 
-  1066340011,  2613465018,  1831917712,  3000345087,   237790827,  1021932172, 
-  4165329598,  2094471500,  2617498899,  2331539528,  2816029426,  2105655799, 
-  2955107128,   676136222,   566342198,  3065144429,  2055390863,  2448495205, 
-  2786508769,   852515339,  2561906166,  2945736682,  3785107290,  2287634380, 
-   374195902,  3080550475,  2976346956,  1247640761,    47424566,  3756717051, 
-   780042638,  2591384150,  3521738735,  2647188561,  3719887166,  4025245963, 
-  2820853508,  1845533236,  2581796306,  4029076562,  2472518018,  4161726663, 
-  4243471629,  3507012777,  1519545812,   157728114,  2794679530,   440843850, 
-   935048399,   952398737,  2702572753,  3460269654,  1697550694,  4118512320, 
-   173007317,  3305245929,  3680434920,   163597484,  3801809562,   994055518, 
-  1758926776,   132682676,  1272780151,   298737618,  2593561818,   650749861, 
-   309040592,   708392313,   899408778,   851480398,  1852636786,  4059555852, 
-  4100040948,  2814548816,   520192873,  2403922563,  1767380582,   776922174, 
-   860821846,   785030883,  2464700462,  1350864505,  1804784573,  1316680017, 
-  1727559396,  3553321123,   815824435,  3663787675,  2691035188,  2476444397, 
-  2806215418,   887286905,  2918105512,  1731835134,   735717479,  1779822916, 
-  2254322003,  1278118267,   379892789,  3498718055,   711386936,  2544255524, 
-  1787274159,  1959223959,  3422937127,  2358481446,  1628953751,  3639338017, 
-  3697414233,  1652710380,  1565933463,  2793038560,  4090943763,   129183976, 
-  3498173141,   220657852,    36765628,  3385370800,  1815739863,  3095364298, 
-  1455144392,  3741765083,   669157916,  4101786422,   899626705,  2021114426, 
-  3132156767,    98659230,  3080787356,  1923746675,  3470812724,  3726618727, 
-   474425456,  4013621006,  1047529229,  2719529576,   739324835,  2964280517, 
-  3846086414,  4144204382,  2462138783,   640493707,  4231444747,  2103513315, 
-  1599766749,  3998116848,  2700345976,  1341589710,  2492528931,   943183680, 
-  1751752765,  3937131104,  2564737630,   554155808,  3651136126,  1661831764, 
-  3488377334,  3480892424,  3603332536,  2591152031,   898769702,  2314400761, 
-   217636294,  4040356155,  2963953664,  3147542327,  1458041433,  2936882537, 
-   917325919,  1657147477,  1822989395,  2667686084,  2314397821,   524240244, 
-  4258312883,  3249228875,  3690265181,  3231918317,  3248908033,  4175483801, 
-  4097165596,   638044916,  3309171874,  1023090023,   955916234,  3128215358, 
-  3989107470,  2012160720,  4228910949,   677424172,  1518238510,  2784791574, 
-   774032932,   216825336,  2324404952,   298697565,   189346321,   696475821, 
-  3590931823,  2733655278,   873609470,  3728907859,   185798784,   233777066, 
-    60354197,  1053791206,  1740694547,   215608054,  1803051825,  4143285974, 
-  4182563474,  3004814053,  1065358441,   956948394,  1208323792,  3041410466, 
-  2964883431,  4189223657,  3303249550,  3210423384,   492724532,  2786497119, 
-   835630634,  2079487870,  2309270924,   689312336,  3129782602,  2183027949, 
-   704232896,  1817127236,  2604447722,   514744760,  3950549012,  1124742047, 
-  2547534814,  1521199859,  3790503517,  1761783975,  3110637879,  2675575865, 
-  4223235379,  3357713619,  3461247314,  2659437806,  2293009224,  1622031596, 
-  1698989239,  2614196074,   829999936,  1435233341,   868325339,  4191145444, 
-   354198681,  3153738200,  3073776500,  1437588679,  1839158916,  3251003149, 
-  2518449426,   702334587,   621906864,  1559031378,   766037735,  3911487879, 
-  2469411816,   773792516,  2785267332,  2982394591,  2279701319,  1684009274, 
-  1616389177,  2313706694,  3090203790,  2993605763,  1078030359,   108206772, 
-  3761055605,  2097945658,   521605383,   274726761,  4004815786,  1107622343, 
-  2315274936,   430874703,  1971317032,  3922922963,  1468922792,  3212568968, 
-   370260924,   385670757,  3788831750,  1611797073,  4211146485,  3332693224, 
-  3150151661,  3506453073,  1189163844,  2903163552,  3886762756,  4058318124, 
-  1257885831,   805070203,   848551510,  1766570884,   269511643,  1103507799, 
-  1716475849,  1766199612,   987817456,   372524381,  1917460847,  3159771227, 
-  2584944599,  1529233331,  3651137134,  2754835904,   585607108,   911977787, 
-  2102093292,   746867494,   478174509,  2708275760,  1015483585,  2115637260, 
-  1880056352,  1242942158,  1767623966,  4283373052,   710716755,  2800274722, 
-   607212267,   191596576,  3701704053,  3918519762,  1534052467,   978380890, 
-   184514529,  3642023296,  3401702345,  1563519156,  2797103200,  2157628549, 
-  2235847215,  3933313224,  2912678223,  1277150064,  1572824159,  3301468609, 
-  2407512294,  2724487456,   727163470,  3088651203,  1803567391,   612480687, 
-  4025351628,   989109448,  3021005370,  1629801655,  2197377917,   936412320, 
-   862234353,  3666248869,  3096645255,    48852304,  2082543633,  1585050736, 
-   457598041,  2368693495,  1845198514,  3967460591,  1921199235,  1119054855, 
-  3502877770,  3218554188,   495466882,  3375063751,  3790376647,  3439929878, 
-  3378351361,  3914873510,  1540942107,  2280538189,  3451135939,  1654022939, 
-  1219220225,  4082019154,  4248890121,   887938377,  2166973234,  2944199012, 
-   574838418,  2541276019,   978624139,   734873475,  3701421938,   901623598, 
-   979468241,  3488263962,  2289231630,  2685124274,  2135997065,  2856912710, 
-   208304617,  2194644382,  2722974845,  1861153059,  3478462747,  1176975832, 
-  1585653749,   850508387,  3624934106,   496749173,  2875559173,  1047845504, 
-   496024850,  2097480248,  3778991590,  3468630095,  4179543721,  3179786169, 
-  3130340113,  1459717916,  2973180517,  2516743907,  2477550481,  2181019722, 
-   496623499,  3369197037,   556008904,    26358286,  2163698692,  3546141106, 
-   921741981,  1696362419,  2182552937,  1173674580,  3282689283,  2763534742, 
-  3303440940,  3943197046,  3392983188,  2410214222,  1318963484,  2461405512, 
-  3662093037,  4275279257,  1766532090,   890199553,  1825902791,  1746217195, 
-  4239403732,   768270443,  3140618850,  4049411929,   882154172,  4291645077, 
-  3353802681,  3636427113,  4228639008,  2686620678,  2328064202,  2834112899, 
-  1660344948,  2847107384,  2337080651,   816606479,   921004344,  2769121858, 
-   870326751,  2572258694,   477054607,  4067313461,  1690820844,  1170015238, 
-  1331526243,  2426256512,  1121307891,  3376612497,  3786898548,  3921074843, 
-  2807880121,  1347871884,  2592174351,  3764960905,  2791864538,   872066384, 
-   778777092,  3506874608,   886397267,   387258206,   219138949,  2542372807, 
-  1928414516,  2396824245,   645630180,  3995965011,   510673511,  3097655012, 
-  3405215658,  3238916026,  4282587058,  2019959799,  3962117019,  3137049772, 
-  1697061393,  2789539550,  2167221102,   265437606,  3095153341,  1710430180, 
-  3520460842,  4174890574,   667912908,  3403204068,  1078626684,  3382653317, 
-   894686482,   394689529,  3486421084,  4180727995,   260553745,  3391346314, 
-  2475494874,  1266125804,  1790458510,  3184156533,  3773661184,  2460863738, 
-  2120873615,  4246227286,  2638390908,  2564053473,  2131145046,  2839935336, 
-  3289827176,  3899103636,  3534099113,   944899400,  1560540084,  2747021321, 
-   493364452,  3457821687,  1155886205,   771075510,  2811994460,  3946681449, 
-  1271627776,  1831395823,  3784523804,   405092014,   219153108,  3941130228, 
-  3537686865,   475967558,  3991216388,   892894296,  1244140712,  3866520651, 
-  3754446750,  4177109197,  3173525781,  2566363264,   500648122,  3853849861, 
-  2647172379,  3106078474,  1711865087,  3521362744,  3331288165,  3955852857, 
-   459251751,  2408166022,   525051792,  2958911537,  4096835960,  1536236769, 
-  1892015158,   571434677,   963513144,  4230580175,  4129553252,  2661237074, 
-  3888730133,  1439269178,  1723494633,    79792079,  3299224630,  2678396603, 
-  3667832597,  1749263456,   880941457,  3202568157,    24048015,  4026341199, 
-  4052938886,  2041575005,   560645375,  2647046329,  1175543995,  3674495823, 
-  3708575532,  3927104212,  1996624657,  4043276139,  4171856794,  3040980617, 
-   935733324,  2940399632,  2451210275,  4219665213,  4129319088,  4004046749, 
-  3319430408,   813740643,    23211959,  3638088542,  1203993266,  3489506214, 
-  1657573126,  2329036248,  1993692945,  3564825861,  1751953490,  1413717665, 
-   311396372,  4167474549,    11593002,   459400952,  2591390965,  2221231583, 
-  1995442867,  3960271004,   365705672,  2779672063,   774186653,   595999554, 
-    65373103,  2883571773,  3196979068,  2554546012,  1253011134,  3203593632, 
-  3932066353,  2653328132,  1137455228,  4105114174,  4227114001,  2162507548, 
-   693372868,  2748811446,  3346444232,  1970820241,  2388509308,  1801975927, 
-   522074433,  1196927045,  1356406251,  2080462903,  1001516938,  1146436926, 
-   632410588,  3867022047,   822808702,  2874822183,  1270046688,  2926372247, 
-  2055320386,  2314917087,  3033718904,  3597773999,  1154119422,  2602169206, 
-  2708912286,   501300055,   534484316,  4093724526,     6305663,  4163446278, 
-  2898014693,  2524179783,  4197827077,  2280522701,  1027406293,  3703624257, 
-  1116968878,    27480951,  2791512369,  2445412139,  3853912456,  2400467234, 
-  3184802847,  1023718001,  1879341987,  2002053470,   119070868,   152924624, 
-  1733474304,  1425922260,  2695854674,  2140971999,  2661133335,  1120831067, 
-  2461028479,  3559681394,  2473328278,  2252693378,   783456649,  4247586618, 
-  3350420882,   531948838,  3726341792,  1445868848,  2734875225,  3311498410, 
-  2958438929,   757957743,  1917078255,  3839827393,   674849816,  4244988715, 
-  3228225902,  1277943361,  3671036453,  3999626837,   434498575,  2347878541, 
-  1665480906,  2820647557,   788474621,  4075235262,   883791883,  3448761858, 
-  2436636093,  2326041488,  2601261957,   878830691,  2002813591,  2938902486, 
-  3869954523,  1464281012,   946298350,   900532651,  3605913902,  3459967747, 
-  3145717266,  1026738920,   504595396,    77870740,    62871252,   433748767, 
-   368882840,  3164782374,  3581125249,  4111288130,  3854284536,  4176406184, 
-  1985496552,  1199879464,  1361115334,  3413908696,  1939612867,   741021744, 
-  1779191853,  3778884912,  2155838983,  3001310413,  3817320029,   671884541, 
-  2035583410,     5834639,  1223626779,   837729114,  3986715280,  2782550894, 
-  4285100654,  2634176126,  3095670574,  2177108895,   358031266,  1015859494, 
-  4243859916,  1335451790,   369234100,  1093507532,  2574497480,   490146059, 
-  1317083678,   894107200,  3556747866,  3697354510,  2426585595,    68899408, 
-  2038337627,  1634648536,    41710400,  3666376614,  3205300765,  1476518581, 
-   762319528,  1027350483,   781120318,  3471538224,  3114846045,  3195499659, 
-   512391997,  3440323500,  3838866093,   558597047,  1360413381,  2879566683, 
-   328333140,   531110160,  2133662516,  1425966932,  2776434571,  3061076140, 
-  3543143662,  1205815418,  1683718359,  2150991801,  3053071718,   752713911, 
-   514978484,  3718099054,   438926284,  3057923507,   481540774,  1723010769, 
-  3240556982,  2947456207,    73681456,  3655046184,    61258769,  3433005758, 
-   648835562,  2511412494,  1359699622,   984199533,  3532398415,  3242120926, 
-  2755835433,  2822493314,   959735899,  3957971875,  1704635981,   883115956, 
-   597201764,   697581867,   297469626,  4017209763,   983096400,  3323823478, 
-  3350734522,  1689878967,   702633904,  3506102594,  1756297801,  1012240914, 
-   706779828,  2126247113,   137820954,  4042509447,  1199158633,  3298148834, 
-   780511277,  1431212011,  2582403334,  2551842033,  1633535153,  1178660679, 
-   975283238,  2515726168,   927484858,   515696428,   165820356,  3579223861, 
-  2130449390,  2591912146,  1624506185,  1970844304,  3190833958,  3569949097, 
-  2073112010,   491909688,  2104728531,  2478155853,  3793401414,  3983586891, 
-    70227499,  3645621092,  3390615199,  1820357845,   361903187,  1178315090, 
-  3101305887,  2065010719,  4199041661,  3296297799,   595574010,  2188127450, 
-   697254325,  2312674440,  3984055733,  1851446389,   692535584,  2586985665, 
-   896406432,  3159528519,  3383047610,  3280691089,   491807807,  3854577941, 
-  3284838810,  2334715843,  4223440058,  2996835813,  1404409526,  2092265568, 
-  1188733246,  2820250139,  2335737080,  3473614803,  4070776669,  1592974782, 
-  3273124977,   597136971,   283956680,  1724733440,  3395521357,  1758513878, 
-   431092359,  3654728205,  2205692430,  3282206216,  2764015137,  3071429885, 
-  2867462571,  2488904041,  3923779510,  1696529154,  2178359027,  4227062560, 
-  1580562351,  1142729580,  2834429612,  1454646412,  2238698455,  3643519708, 
-   323588672,   644012546,  2769677549,  1490831684,   205249722,  3215463501, 
-  1709749207,   439634766,  3004708635,  3243518112,  4259604206,  3141615286, 
-  1092810524,  4279615548,  2919788782,  2293315573,  1355210556,  3539645077, 
-  1046087866,   663894942,  3956613139,   909598317,   182491630,    91001754, 
-  3052959252,   406696973,  3487659273,  3267970848,  1564135035,    84759787, 
-  2408432204,    67051670,  4119123331,  3346298622,  1421588183,  1630128223, 
-  2328374004,  3720625783,  2222024088,  3804531403,  4278214250,  2161304082, 
-  2989039182,  2611542570,  1983636093,  4099707429,  2772118363,  2569858116, 
-  2253777665,   261574327,  3135362236,  2888746648,  3516559664,  1178778887, 
-   490179773,  1263847769,  1160786654,  1665748929,  2405647082,  4272967417, 
-   578170449,  2332566948,  4142183141,  2086138273,  1628927376,  1687784496, 
-    37378718,  1685378884,  3997777590,   809732303,  2484355758,   482147025, 
-  2039544559,  2491454534,  1803007278,  1533432537,  3363994952,  2145917739, 
-  2714379320,   907922150,  1297354397,  1778032420,   967169951,  4222358458, 
-  3471659164,  3322914216,   733665209,  3114448096,  3399125604,  1819807657, 
-  1332230123,   408844243,  3115522991,  2031399933,  4280938447,   169682565, 
-  3541206330,   620438920,  3808147363,  2865295626,  3463206368,  1143622966, 
-  2688547450,  2503381652,  3935445875,  2663625400,  2674369069,   214904697, 
-    30588816,  3548406419,  2002429824,  2631025581,  2065030346,  1586614738, 
-  1862734522,   850813787,  2952305377,  3395986005,  1758032358,  2709875199, 
-   817397234,   876236925,  1007898955,   473480747,  3653916351,  3261906605, 
-  3617825528,  1006952382,  1614227921,  3729077744,  2015027702,  3413489435, 
-  2521881578,   791341771,  3592263487,   197844992,  2083900003,   729341849, 
-  2947871543,  4138758368,  1162477413,  3882746795,  3072595369,  1469601320, 
-   224164317,  1741639310,  1100673076,  4046903558,  3614671992,  4290813309, 
-  1491287780,  2964370798,   269586239,   620212614,  1478634164,  2073519575, 
-  2293330779,   273875331,  3307750864,  1053782557,  1957349311,  3502625114, 
-  1356157319,   540296324,   665731978,  3482076921,   566383459,  3094089668, 
-  2858021237,   130793867,  2576255171,   948143174,  3901676992,  4087606491, 
-  1971298392,  3932977295,   280584975,  1466729609,  1235426987,  1076108259, 
-  4202140759,  1946539432,  1312519770,  2644451726,  1879811522,  3231423542, 
-   457673982,  2236248030,  3105820763,  3274990908,   693452019,  4179695568, 
-  1576326285,  1174660987,  1081553298,  1770622640,  1880143350,  2180136792, 
-  3493158333,   381351548,  3722398631,  3170812445,  3948086972,  3311146874, 
-   943415813,   536930194,  2376144237,  3756048811,    36690196,  1207049254, 
-  3879756709,  1273965725,    81519952,  3095691445,  4008772377,  3638185813, 
-   610867270,   602285287,  3114250777,   302642633,  3918194829,  2862586595, 
-  3659923255,   811653063,  1173990556,  1397013773,  1739467663,  1012511771, 
-  1334841140,  2710980496,   343001587,  1116840915,   204973286,   488703167, 
-  1964027510,  3036159073,  2599602649,  3217980407,  2742360022,  2620096384, 
-  2380842024,  1073431651,  3079467914,  1280036602,  2950854820,   596150227, 
-  1853049745,  2211755692,  3258005809,  1918338777,  2733362972,   855756025, 
-  3187366567,  2868421455,   155357279,   276802036,  4150043075,   865059972, 
-  2167350347,  1754573985,  1469634802,  3857853188,  3994976057,  3316822813, 
-  3524263317,  2069175678,  1345341949,  2358618390,  1202394011,  1689037746, 
-  1950661684,  2115396210,   645819304,  2785281032,  3485959244,   908753562, 
-  3747755762,    36350720,   160107314,  2528533130,  1444026943,  3073058531, 
-  1335965137,  1206948792,  1039748416,  1476252507,  1445278836,   666771311, 
-  2218732278,  1937624419,   367300742,  2581494811,  3734034369,  3863159900, 
-  2183949921,  2932220193,  2547695839,  1095822111,  2862130765,  1597447862, 
-  4072403934,  3592137374,  2193590178,  3084421849,   826933902,  2242279503, 
-   757015986,  2514471579,  1424773558,  1467498273,  4195069947,  3907873219, 
-  1963724385,    30627962,  3065838614,  4204501505,  3917953055,  3656264755, 
-  1296636626,  1164343654,  2851760092,  4153581154,   993817986,  2279801525, 
-  3580169630,   272069484,  1437732972,  2180570120,  3135589465,  1408941827, 
-  2866694865,  2631147236,  3419464560,  2446828938,  1854655361,  2478692917, 
-  3579953856,  2891847983,  2443233908,  1681178474,  3314083667,  2932287298, 
-  3506584566,  4049636594,  2251619278,  1802247867,  3105875529,  2763826970, 
-  3613943962,  4081049231,  1822937757,  2901545875,  2822153515,  2997884495, 
-  3825993826,   910378393,  2386577761,  1481002796,  2964766154,  2001572127, 
-   760579433,  3883595783,  1440479714,  2282403897,  1084497195,  3039340888, 
-   406593406,  3795694277,  3988665171,  3897785732,   758976452,  1368182655, 
-  1375999683,  1394269372,  4137257030,  3299991144,  4020632842,  3925611980, 
-   302827950,  1161473494,  3473376536,  3916458328,  1884687314,  3919377451, 
-  3316752966,  4038430669,  3676187865,  3138417851,  3837924995,  3588031906, 
-   342707563,  2255792381,   609273682,  3647028885,  4188652101,   741779575, 
-  2533679329,  2659678944,  3038266358,  4046548541,  3661997294,   163537201, 
-  1975791621,   980794593,  2935170166,  4120430503,  3304380476,   763368418, 
-  1766118600,  2331351492,   459138742,  3208379076,  3936412458,  2771952879, 
-  1906375687,  2293416422,  3330428961,  1371091256,  3652010684,  2790271659, 
-  1829172204,  2618845283,  1195306909,  3885155791,  3965084106,  2311399104, 
-  3726235858,  3432588156,   567433306,  3931566864,  3603780552,  1755129119, 
-  3929119175,  1095656555,  1344688872,   111113225,  3392486852,  2787240561, 
-  1734777372,  3585627324,  2385921549,  2301138864,  1386639617,  1051765345, 
-  2149482103,  1506238199,  2568701072,  1485934179,  1570346223,   682963136, 
-  3861932997,  2027445149,   527512977,   111457107,   411737340,  2055494183, 
-  2183407138,   194540861,  4054753133,  1674314368,  3667841266,  2454329438, 
-  3056534854,  1049070589,  3931265367,  1380039381,  2246489711,  2731172848, 
-   896581586,  1682122627,  3264947845,  3239652647,  1803898683,  2406377897, 
-  1550609704,  2526621496,  1221709678,  1054990030,   195760519,  2387448031, 
-  1723510487,  2711073276,  2419886149,   335062880,  2719455181,  3566388212, 
-  2675624742,  1175583978,  2484185915,  1977085991,  1939809730,  1376546222, 
-  3864962505,  1594802606,  3338887418,  1941626562,  2778451431,  1571881715, 
-   930587815,    76549674,   709547485,  1421112056,   578884773,  1561464357, 
-  4008074493,  3241578146,  3710137804,  2246613164,  4106150556,  1329883107, 
-   506191570,  3559856952,  2449342670,  2458896112,  1271184768,  1829207532, 
-  3338866127,  3489362088,   915335142,  2880133927,  3880108565,  1045232408, 
-  2975225950,  1948636388,  4220417885,  1233292796,  1459249285,  1847726278, 
-  2139611814,  1993452897,    97659074,  2214558519,  2100642617,   723907613, 
-  1595027839,  3016369288,  4090350748,  1397524467,  2287636623,  3657354249, 
-  2955904802,   997531000,  1794712740,   297557644,   210049314,  4067192739, 
-  2509164209,  1194699966,   520666681,  1068226375,  1972512503,  2211614536, 
-  1677362697,  2496313827,  3900468367,   768322823,   906153429,  2371040664, 
-   433366604,  1297768519,  1280135779,   943607921,  1028141130,  3352521434, 
-  4218805705,  3184006518,  3484181986,  3563438297,  2180058949,  3728040939, 
-  4294624677,  4019054769,   762438968,  1887081412,  3689111826,   355069068, 
-   499912411,  4291949276,  2073313389,   644499083,  3222121745,  1686585513, 
-  1958428522,  2853908024,  2506392259,  2138811983,  2559384129,  3166534694, 
-   952946837,  3218686164,   795486796,  3960386347,  1592841597,  2445194191, 
-  2421988549,   548557611,  2940485866,  1315595703,  3746702905,   925508595, 
-   775304989,  4069577399,  3455843391,   645926927,  3761390688,  3074132443, 
-   417992798,  1652787384,  2052836875,   686081373,  1266207543,  1999164673, 
-  2101134047,   795746077,  3176835774,  3558239741,  1505855082,  2372825825, 
-   557112642,   462785059,   662558563,  2876201671,   209603477,  3310531797, 
-  3839331323,  4216222199,   470396437,  2736994396,  3782097997,  3055809907, 
-  2196276055,  2449016279,  1739346191,  2657401973,  4203998613,   124595117, 
-  3182814261,  2584496955,   764054046,  4100112835,    62252601,  1033760790, 
-  3082875875,   243767378,  3277032569,  1679473148,   872818337,   459916045, 
-  3136550366,  1797861747,   600795237,  1549971948,   670249295,  1036625892, 
-  1230999127,  2427745901,   506936081,  1463114006,  1892818246,  3896336159, 
-   926593376,  1037240084,  3491939230,  1735940185,  1538970736,  3512395771, 
-  2312333167,  2535898449,  2636818997,  1412141898,  1255708352,    74323987, 
-  2239879935,  2586759389,  1948327930,  1009125873,  4118658381,   485634932, 
-   790717849,  4023771212,  2096662679,   548101953,  3681301981,  2410912994, 
-  3047636090,  2108084832,  2259207593,   127904759,  1183234485,  2623534305, 
-  2719126452,  2602398841,  3791120914,    39871429,  2257404056,   245421341, 
-  2024838791,  3318577210,  2196114369,  1218928491,  1214839256,  2915260136, 
-   427970603,  2705438975,  4166607559,    73936928,  2761187549,  2024838887, 
-  1394201259,  3352536164,  2018444407,   891388821,   514763605,  2398313717, 
-  1878994154,  1635388022,   782291143,  3493975518,  2653838862,  2649117407, 
-  2566091064,  3400924711,  3219029076,  3007416149,   386186895,  2850811964, 
-  1500908753,  2903841039,   324120902,   112246674,  4224291739,  1901810739, 
-  2594435778,  3658528231,  4122669135,   161662797,  1800664329,  1378876961, 
-  1599358280,   606880307,  1380246345,  3680679167,  4005960287,  3501745211, 
-   636665129,    90410201,  2319960943,   248984017,   296718987,  1322357563, 
-  2464801490,  2520289868,  1192970767,  1597102074,  2540247503,  3933798810, 
-   750926262,  3060740700,  2745390842,  3110414378,  1747898821,  1226396631, 
-  1638302402,   150315895,  2248886292,  2329454833,   626537811,   747729322, 
-  2830735957,  3177690647,  2949817619,  2384672585,  3113320791,   202881651, 
-  1704422873,  2332628845,  2506884063,  4238295522,  2425437480,  3199379132, 
-   599893856,   245410909,  4253945086,  1131839135,  4183243454,     4734733, 
-  2614036169,  2014662000,  1710986591,  2226013138,  1308215442,   395046596, 
-  2900124805,   837428793,  3826504046,   109034536,  3918978317,  3569782931, 
-  1416086586,  3801831933,  3745331980,  3029446081,  1087828636,   385229264, 
-  3843028795,  3414441653,  2246685044,  1926083412,  3189873308,  3684583538, 
-  1622078024,   302280564,  3331035439,   857265883,   276676430,   646432038, 
-  3192705829,  3328000627,  1367259952,   232909995,  2735781021,  2210244043, 
-  2300392774,  2182149215,  2755104891,  1179722732,    48943679,  1794824371, 
-  3306684666,  2373310829,  4027499817,  1527759246,   968908793,  3134883238, 
-  3788567590,  3743906985,   472612175,  3531768213,  3177756740,  3682159777, 
-  2707114248,  1415310877,  3354532806,  3741931618,  4283869601,  1153307272, 
-   963238973,  2977287700,  3584355677,  4097481589,  3744330470,  3389387642, 
-  1236661449,  3310779395,  3539991542,  3920405830,  1840987195,  1123625214, 
-  3577501312,   677955387,   358643369,   757761212,  3174077244,   125866475, 
-   712679444,  2828720199,   791442259,  3040965992,    94496384,  4035514403, 
-  2264467607,   573577760,  1191331158,  1646858816,  3129123313,  2967515638, 
-  2101914991,  3934801650,  3279168330,  1825511857,  4092115730,  2439651682, 
-  1985037480,   176735210,  2475984386,   149549164,  3554501907,  1536467167, 
-   157356586,  4283923825,  2435835053,  3411548616,  3429304417,  1651550612, 
-   810712314,  1638716682,  2723484541,   943954469,   631181434,  1784646587, 
-  3897088041,  1167009179,  2822157811,   335949382,  2265796958,  1354795303, 
-  1687430443,  1462422143,  2203584015,   463081200,  1409985424,  3103718451, 
-  3947273352,  1468135609,   999231728,   126915011,   703874508,   154190332, 
-  2322300616,  2692504270,  4258936522,   950097035,  2563296628,  1239538008, 
-  2827864698,  1486653031,  1964009744,  3994124195,  2211899306,  1853690145, 
-   365789995,  1208148855,  4185243527,  2158674762,  1471867934,  3531848745, 
-  2121144846,  3971767579,  1485424898,  3312306485,  2713920058,   659565711, 
-  1048582560,  2812753478,   680113267,  4166687697,   528141392,  3750031566, 
-  3011874950,  1637254089,  1743524884,  1964321744,   316385141,  3125472028, 
-  1837559492,  4259772286,  2104018804,  3200782961,  3527123896,  1747966808, 
-  4025730731,  3021027332,   656056196,  2029822410,  3928795855,  2211492214, 
-   119645782,  3805577963,  3196799095,  3079020785,  3912268938,  3946305673, 
-  2746555910,  1299158008,  3631083784,    22920208,   407630148,  1751053192, 
-  3728913749,  3045251209,  2653525638,  3995304334,  3813007018,  3842294105, 
-  2087214040,  3584966699,  1563898398,  2646836282,  2678504239,   132469163, 
-  2956615562,   670881503,  1139948106,  3311609361,   282979086,  1651598644, 
-  3317319803,   923736041,  1978685976,  3409311280,  2339131995,  1291107667, 
-   964650728,  3036112070,  1851267314,  3897030115,  2911398790,  3937340534, 
-  3729351342,  3170763685,    78261390,  2749259641,  3189089669,  4168693808, 
-  1257691216,  3839447371,   824273463,  4012846570,  1485235043,   726158824, 
-  4145006426,  3159915862,  2449185602,   426559370,  3292974187,  4277016828, 
-  2696011898,  3830611569,  1974423865,  3659220708,  4198931032,   190310368, 
-  3285757554,  1364377607,  2780022850,  2819500973,    65850492,  3719694430, 
-  2117508624,  3762801140,  1382334168,  1512509376,  1624250487,    59699869, 
-  1712939903,   429777877,  3440770358,  3476038247,  3592592301,   675173582, 
-   678238337,  4134672027,  1329356631,   114103619,  1804533526,  4190799372, 
-  3289400255,  2076876769,  4060866872,  1127091083,  3055903873,   933314089, 
-  3416366535,   160239869,  3552343270,   716066963,  2922858612,    44617673, 
-  2922281114,  2135511791,  3579009290,   973383953,  3534044455,  3690953849, 
-  2453036976,  2402217467,   547038549,  2396247414,  3858721279,   563562029, 
-  3976143240,  3847461863,  1112440515,  2172716512,   147503768,   862440944, 
-  1349801270,  1951942367,  1115097822,  2406473540,  2640935199,  3115307465, 
-  1270548452,   833752842,  3285706507,   392177162,  1351352931,  1499604739, 
-  2163291595,  4265506137,  1489853226,  3595839014,  4123203502,  2100704638, 
-  4059239674,  3371058077,  2354937160,   923039043,   330518501,  2184971310, 
-  2853424377,   131132544,  3105140234,  3093709197,   796250811,  2772951365, 
-  2737648781,   846051715,  1384344840,   480256566,  4016993148,  3253150462, 
-    49127103,  3900912766,  2412434650,    83288075,  3305429211,   615159777, 
-  1409848108,  2284165699,  3840360762,   364189977,  3147946747,  1440728019, 
-  1977302310,   711255048,  2304235247,  4093452243,  2355445067,  1138810221, 
-  3660771010,  1444316910,  2681158250,  2817922801,  3017306327,   111517916, 
-   740032539,  2489742943,  3589849607,  3987325063,  4191563512,   831423783, 
-  1447688694,  1356440082,  3505429072,   363495856,  3599857640,  2733935526, 
-  2773988331,   900964049,   248046997,  3461391268,  1786546133,  1254879669, 
-  4023221803,   708524583,   984628957,  3866044400,  1273933425,  1546350355, 
-  2712812218,  2907521021,  2826562020,  3405026913,  4252196074,  3275360300, 
-  2701512781,  3810414220,   253772839,  4215972220,  1309921149,  1485222205, 
-  3852718449,  2540919844,   288345594,    22421155,  4232561385,  3367518526, 
-  1755437680,   834440075,  3408182754,  2480336187,  1975812732,  2379372496, 
-  2071679095,  1421908931,  3799505890,  1829906387,   918522661,  4166372114, 
-   374487170,  3943264405,  1784507077,  1263776286,  2434232236,  4239289231, 
-  1698153108,  3299180794,  3395666532,  2941356628,  1893041573,  4165677850, 
-  1251225414,  1495203188,    58444906,   118204736,   255975714,   478760437, 
-   836267831,   241729728,  1972926472,  1226212888,    26339619,   880914715, 
-  3819719381,  2082146224,  4083891640,   487753450,  2290543781,  2788622639, 
-   771730869,  1474997769,  3710710038,  3113096545,  1689279640,  2487360536, 
-  2534947103,  1426434582,  1060227510,   464596309,  1106901370,  1966154307, 
-  3615667231,   127598101,  1196714760,  3583625903,   539598731,  2049134156, 
-  2346843204,  3993921902,   542586641,  1445917368,  3468678212,   513142821, 
-  3063912136,  1892905082,  1242211666,  3839871591,   900391827,  2660984445, 
-   545065966,  3033651959,  3013705729,  2894115547,  3872636995,  1109196615, 
-  3369790534,   995794192,  3945439695,  3435287628,  4016088694,  3015278026, 
-  3203120682,   197627182,  3698815759,  3892525171,   259519064,  3548151831, 
-   639188016,  2996328022,  1430776248,   883353690,  3583684838,  3795798704, 
-  2558557365,  2326597204,  3178841477,  3946674679,  1641643977,  2195775221, 
-  2270108929,    45130451,   924513735,  3983577232,  3505124796,  3204001670, 
-  3963092955,   675076091,   387872275,  3174915529,   703155748,  3735941375, 
-  1282766273,  2005184803,  1512005708,  1006669928,   104759000,  2760230536, 
-  3440710164,  3517373083,  2964058051,  3503669260,  2190076032,  3358866419, 
-   421577268,  3059774762,  3864040814,  1455133296,   121145728,    79868541, 
-  1069134078,  2112918624,  2341118503,  2231278699,  2552435464,     7940893, 
-  3931422105,  2252222706,  3533885652,  2673623338,   979719302,  2997844467, 
-  4009398591,   844816994,  1268295037,   895451826,  1458333708,  3943691506, 
-   919455059,  2356663315,   476199971,  3460257248,    41280542,  3225242276, 
-  3754027883,  4272650516,  2420447171,  1835020781,  3303049092,  2617238059, 
-  3570105638,  3112615211,   386472175,  4152019421,  1632917856,  3561857464, 
-  3438767538,  1895446086,  4153827568,   211555557,   228067365,   569862207, 
-  2894498647,   964077364,   174624170,   868830362,  1548587578,  3747585975, 
-   312102746,  3042028755,  1731485598,  1084544568,  1795710822,   478705052, 
-  1476596895,  3798800058,  1766667114,  1388794644,  3711748953,  2425051700, 
-  3249723348,  1883467183,  3537616391,  3203959817,  3071330385,  1061039197, 
-  1591109104,  3916260841,  2521673048,  2211583442,  3977170551,   215618147, 
-  3284029037,   380330213,  1038631940,  3971774783,  3134220288,  2985905089, 
-  2729511246,   941931657,  3176986260,   543249567,  2360221763,  4144089110, 
-  2925173027,  3888895694,  1046260414,  1557481258,  1251278344,   246980014, 
-  1971672915,  2545247611,  3955247741,   825410128,   651708627,  4100794586, 
-  1799805017,  3593570210,  2235790993,  3447307171,   909105995,  1908887898, 
-  3834212973,  3212866342,  1202548768,   419841384,  1528847088,   164086107, 
-  2346973131,  1438170246,  1984316823,  3736585415,  1560252975,  4144246483, 
-  1002757653,  4243981276,  2994869533,  3614991267,   435687977,  2062403545, 
-  1750222753,  1405059162,  1852468904,  1038091096,  3237265275,  3756167358, 
-  3015257903,  3570573693,  3638829754,  1776546043,  1917351893,   328834873, 
-  1918266566,    43360708,  3341610134,  3599329772,   357510009,  1020230643, 
-  3304898416,  3392682623,  3589817113,  3314167291,  4091149539,  1730891472, 
-  3568940885,  2287802597,  2072598666,   394838690,  1126581598,  1580980837, 
-  1819629474,  2477448608,  2045303092,  1819668467,  3382800241,  1894970482, 
-  2363245421,  3376289895,  3221959146,  3918824969,  3013606951,  3333160178, 
-  2336311454,   459608044,  1786447464,  4181701878,  2267144579,  2600735839, 
-  2680688588,  3920156609,  3686699210,  3535607814,  3660450019,  3401755407, 
-  3378279524,   393467484,  2336259245,  2906604917,  1662723355,    77599252, 
-  1345205069,  1745267179,  3366688437,   985248864,  2907145468,   226207450, 
-   175662573,  3491333295,   927194231,  3836766724,   627874124,  3746399464, 
-  3928611081,  2754129462,  3863594069,   866905191,  3660458455,  3097170307, 
-  3604382434,   592310991,  4269107956,   474646343,  2198840612,  1466180791, 
-  1814181807,  2026960876,  1458396496,  2324006033,   809362542,  2574997194, 
-  2894734471,  3335047603,   192810783,   164953545,  1511201521,  2469249962, 
-  1144439261,  1613645595,  3247306214,   937495065,  3501083684,   383252305, 
-  2361076357,  3783913210,  1368098969,  4209431010,  2598004038,  1795293434, 
-  3438168776,  2025397589,  2854612598,  2426621401,  3349381634,  1505497383, 
-  1189588993,  3539427726,  3085496671,  1317047818,  1575546007,  2589524107, 
-  2222736806,  2056070218,  2368346898,  4018955188,  3857881072,  2946879896, 
-  3460687683,   330799309,  2643600178,     4908562,  2923287109,  3076656805, 
-  3939757160,   275680860,   476092446,  2473713497,   964792813,  1020264462, 
-  1417471977,   917904876,  1031231619,   406696853,  1515958834,  3932684533, 
-  3296009987,  3892605427,   510349534,  3044113499,  2556808155,  1887567057, 
-   959530980,  3772082718,  3950830163,   375565685,  3080889406,  1397022892, 
-   626126389,   494940974,  4247540858,   303982809,  2736814700,  1361617447, 
-  2988809732,  3196349657,   545165570,  1186717565,  2478650482,  1675415807, 
-  2754758582,  3557698222,  4248577887,  2510041255,  4120473192,  1818894755, 
-   374891193,  4187858060,   784764206,  3613751692,  4129027058,   776026931, 
-   306090264,  3691393887,  2996202210,   910750686,   698517586,   259771557, 
-   574682397,   530508911,  1551699609,  1594385772,  1792020530,  3397142310, 
-  3673128301,  3242488080,  2479806706,   875452026,  1660860609,  1966055746, 
-  2471172450,   757406246,  1290908713,  3732658730,  2136647411,  3543080659, 
-  4043610576,  3328599152,   290518978,  3577714590,  3940298562,  1974577087, 
-  2789306613,   582072601,  3271913199,  2899433282,  3744663506,  2288250049, 
-  1932039982,  2755913630,  3416190097,  3717560333,   899216905,  1082789907, 
-   157243374,  4050949535,   857131691,    54409521,  3079803745,  1647629051, 
-   717382393,  3910845888,   723527680,  1137735605,  3995454071,  2567593874, 
-   701835969,  1401353227,  3492684572,   449999405,  2645398929,  1617727643, 
-  1583797622,  2017371336,   694054003,  3112708931,  4103246757,   522682541, 
-  3748754174,  2762791288,  3026817598,  2321337938,  2004692436,  1459307607, 
-  2827453735,  3621819594,  2063701387,   267252276,  1402034536,  1138515566, 
-  1058512237,  1583870606,   156310691,   604692340,   155867023,  1847638999, 
-  3143965552,  2262685729,  2228010020,   592709836,  1481299849,  1276670282, 
-  3328365674,  3597123045,  1407655291,  2043050480,  2783256003,  2365164145, 
-  1798273071,   818779185,  4192991010,  2401216719,  3445478602,  2231771818, 
-   125225422,  2734267808,  1680793342,  2610031213,  3655240711,  2168062520, 
-  3421168219,  3152842809,   166124949,  1606608187,  3040027065,   578068172, 
-  2813810936,   536264974,  2745875232,  2063925861,  2433243638,  3659868910, 
-  2164942201,  3730900554,  1840533899,  1587085798,  1292258800,  2153278272, 
-  2498976819,  2237820748,  1642149404,  1272801838,  1361081867,   109342781, 
-   867704498,  3878779348,  2770390142,  1576447966,  3472419355,  1501096906, 
-  3347903685,   310644624,   878296386,   831951307,  1773336301,   683811200, 
-  3375653326,  2823613339,  3806122867,  1822798097,  1925570047,  2660555751, 
-  1416292996,   190049693,  1983947480,  3824949653,   237866024,    55246385, 
-  1776631305,  1052982846,  2130020160,  1986582816,   669087957,  1053613164, 
-  3706563258,   968024585,   266751704,     5824856,  2043640800,  3141405078, 
-   546235266,  2776401106,  2309054066,   667489374,   603689880,  1124604761, 
-   779239483,  2145996267,  1298768375,  2287649497,  2552161383,  1983419553, 
-  2202375653,  1944353990,  3395932847,  1215075056,  4047999383,  1597092882, 
-  1380992502,  3342504024,  1090143738,  3424391427,   929443758,  2242560868, 
-  2739879732,  3481808780,  3982082854,  3262952851,  1001725026,   986475083, 
-    74366059,  2621753897,  2239786352,   567432876,  1318783895,  1574847915, 
-  3772802452,  1345760228,  2788684691,  3719607866,   239290937,  1988735435, 
-  1114915176,  2275839777,  2740915090,  2255864964,  2293456269,   529015133, 
-  1953879823,   446400621,  1070316974,   514290538,  3772743686,    42189235, 
-  1380420656,  1164863081,  2193363783,  2673854900,  3593298571,   821639271, 
-  2430560122,  1723562297,  1712374561,  3585648363,  3051895369,  2499789205, 
-    96098110,  2948974272,  4058259452,  1181358091,   720670280,  1717555019, 
-  2575367896,  1154859763,  4106131178,   205202111,  2914373910,  1498845412, 
-  1528472610,  3074239904,  2049023360,  2103937359,  3539590189,  1497909459, 
-  3206271421,  3783460366,  2885364405,  1017876879,   472804824,   868787170, 
-  3179742125,   739900811,  4256835787,  1449429812,  1286087091,  4234664987, 
-  3932291744,  1431918183,  3927135208,  3070778739,  2487369521,  1277639962, 
-  2007924161,  3898312570,  3492544706,   661948036,   188074848,  1180736231, 
-  1966783721,  1732184909,  2739645690,  4103349508,  2345683442,  1350870302, 
-  1143468613,  4129215632,  1153100386,   727423497,  1457162995,  1261294355, 
-  3270673374,  1476080901,   155931797,   269946981,   195177541,  2104542004, 
-  3659580109,  4104079382,  3964140682,  3859867259,   138442909,  2671147650, 
-  1754198571,  3299469546,  4030299509,   591943882,  2719705211,  3719640699, 
-  3868040662,  2862413445,  1008822848,  3040824108,  4058526326,  3875119573, 
-   784448116,  2591692724,  2587976523,  1617742493,  3342204858,  3922325526, 
-  2517872130,  1465669777,   644042798,  3318649174,  4145104564,  2189919570, 
-  1818314460,   661040976,   374547713,  2373266321,  3724227403,  2310139872, 
-  3080171696,  4141524677,  2821018090,  3919776364,  1466175994,   995101497, 
-  2450387060,  3125728298,  1530942409,  1224073524,  1272624157,  3633806188, 
-  2998889889,  2964062834,  1732220126,   105570298,  2420959062,    63042461, 
-  2878446841,  2556891005,  3990454095,  2349100860,  3332479711,  1603122137, 
-  2810194956,  2023627393,  2151646312,  3562131899,  3188403688,  3431107207, 
-  2408750923,  1721866277,  1860889809,  1258781446,  4226072121,  3655895407, 
-  1313295259,  4140452696,  3979519087,  4010397215,  3399022198,   541466766, 
-  3584423517,   878321934,  2856511998,  1546915135,   656798531,   962839479, 
-  3508831422,  2469147981,   389054077,  2120395212,  1651093536,  1447895383, 
-  3185539766,  3913900083,  2935632770,  4007501541,  2656768423,  3278109046, 
-  2554179190,   488429883,  2688111513,  1169468981,  2593264802,  2651000938, 
-  3420534641,  1888177820,  3125948321,  2917216700,  2603517797,  3570263407, 
-  2199593167,  2454263769,  2674857744,  3697824802,  1561060945,   367723604, 
-  1282917741,   686305734,  2258879366,  2660837686,  2493219184,  4018951243, 
-  3700841133,  4291385626,  4128853316,   583590710,  3949708618,   105187250, 
-  3373058988,  2661411740,  3802596013,  2790221185,   182750137,   282912013, 
-  2749379671,  3897950413,  1452455314,  1361096918,  1380118192,  3397591607, 
-   619818315,   679974763,  1371487252,  4207622665,  4107355670,  2824382068, 
-  2456070462,  2979580418,  1821986542,  4123752545,  1703635703,  2485116403, 
-  3104884531,  1914057758,  1438590636,  1419225233,  1670593313,  2757973777, 
-   824072024,  2324045741,  3739698319,  1160474359,  3498472992,  3645127566, 
-  2052915764,   810441953,  2140837660,   769588020,  1960734962,  2545143698, 
-  2166773084,   504616422,   843438384,  2824783789,  1774257938,  2334398741, 
-  1796359330,   817872921,  2960304946,  1731170421,  2918648741,  1488800280, 
-  3051031145,  1560968772,  2839927594,  1702687300,  3580597255,  3547353606, 
-  3841826846,  2345834503,  3465628394,  1913303924,  1650545013,   309852309, 
-  3707825837,  1729234713,  3775985552,   635802664,  2558615490,  3399558229, 
-  3488240293,   495869477,  1116745103,   887763926,  1478091207,  1096926932, 
-   497542779,  4239464032,   459890838,  1501745183,  3253096946,  3535118222, 
-  3935786046,  2125030578,  4152705043,  1630786274,   353529772,   701946137, 
-  4050073742,  3069537401,   337186755,   959985923,   504310725,   625366219, 
-    38459803,  2777677578,  1041612393,  1987738572,  3827806355,  1963310358, 
-   160909608,  3006735104,  1285144810,  3163098071,  3003733615,  2671346733, 
-  2334332260,  3313974792,  2930095413,  3039879873,  1175158282,  3798216484, 
-  3405476757,  3221054515,   666222848,   106115259,  3321012397,   711303133, 
-  3541177677,  1858611401,  1801570097,  2547216280,  3877971452,  3254021416, 
-   475427659,  3208149678,   515697433,     6336215,  2150971657,  1475191215, 
-  3741719626,  1871380437,   424875589,  2580035485,  3576180675,  2230339851, 
-  1757004377,  3796034968,  2132690506,  2789713570,  2749071612,  1425787571, 
-   167230287,  3295488692,  2506723733,  3139922530,  3348861578,   890206013, 
-   965933575,  2515538465,   389198509,  3371039725,  4156508299,  2086820537, 
-   481619177,   702102795,  1540365281,   734287207,  1391640602,   372971125, 
-  1556231431,  1325354352,  3742569066,  2388133091,   127012724,  1722901821, 
-  2653203935,   172638827,  1772760414,  1619281742,  2816043332,  3120789522, 
-   311983172,  3080830458,  3915783376,  3023127061,  3727923819,  2333381207, 
-  2535825961,  3565768830,  2104906094,   520461369,  2738233679,  4220816534, 
-  3522824573,  1501039766,   399186463,  1659158739,   196937436,  3099936154, 
-  3851571594,   603926776,  1491766732,  2182219877,   713825488,  2077984676, 
-   427857893,  2864019086,   762773767,  2730069901,   340458503,  1775077678, 
-    48860050,  2822826115,   760614145,   569794832,   727782794,   546967098, 
-   354515285,   690803972,  2145610883,  3882808495,  3874777634,  3750271160, 
-  2187052938,  3015094609,  4144320409,  2393816683,   978156666,   579792181, 
-   248887432,  2347298647,  3769152547,     5879512,  1404063975,  2807707562, 
-   963435543,  1316041108,  4068055051,  3068914734,  3416771493,   622395372, 
-   875532540,  3419379739,  1344041882,   284895079,  3134684791,  2597189634, 
-  4262382164,   678928988,  2695265472,  2844094413,  1147954744,  2934872315, 
-  1646525225,  2305042523,  3539821524,  3982388931,  2400726312,   369866749, 
-  1483678346,   851341851,  3506036747,  3476194481,  3715291288,  2042559038, 
-  1788507301,  3616954535,   856672822,  1070387113,   734986292,  1971664177, 
-  3973917248,  1481934751,  2900515512,  3819067300,   312727573,  3861788283, 
-  2790394279,  2861882041,  1352933958,   459275474,  2042833667,  4016517955, 
-   101512932,   531672420,  3436818137,  2249302242,   727780165,  2824327196, 
-   586546686,  2682104494,   859468861,  1292446917,   313779827,  2581174047, 
-  2952077937,  3973841521,   856396652,  1716930264,  1368058163,  3734991105, 
-  3971705373,  3681757446,   445384400,  3208129614,  1141458470,  3518660202, 
-  2296764139,  1401342587,   464814013,  1710772997,  3126254272,  2714165693, 
-   668654652,  2164944656,   553836787,  1322811046,  3160993921,  2511460465, 
-  3096331974,   630085864,  4190706718,  1181554969,  3222723180,  3682306901, 
-  2424450436,  2306563147,  1177479914,  1074939332,  1566085976,   500947622, 
-  1867239182,  3116019482,  2651538318,  2877137410,  2767774929,   472034760, 
-   457083258,  2236949321,  1198699313,   633480849,  2526580196,  3880380315, 
-  2817630633,   159730064,  2114547888,  2156395709,  3899541685,  1895128920, 
-  1855365805,  3365978937,  2045614944,   155386100,  3889215270,   657283973, 
-  3914478894,  2607700489,  1983746192,  3777928290,  3322806618,  1549890270, 
-  1669472029,   907238566,  1327824649,  3890099561,  4063003374,  3493735111, 
-   256835775,  3994866849,   806335873,  3860653827,   776504711,  3057965516, 
-  1976724308,  3406609626,   573371251,  3444505461,  3817891583,   570139401, 
-  2774844702,  3530897139,  1555648851,  2398727420,  1286717660,  4219092269, 
-  1441038886,  4035548303,  4162192367,  3822216662,  1954277175,  1701364994, 
-  2551669303,  2560104049,   329407501,  3103563531,  2873255953,  3731788304, 
-   594168085,  3583259588,  1784687965,  1959389973,  2360155530,  3951084320, 
-  1166488219,  3787218176,  3773745128,   822317357,  3134286418,  1038317741, 
-   558498740,   577196957,  3739960830,  1649109129,   754851329,  1409196055, 
-   387714235,   727288974,  1843852986,  3730074520,  1108410800,  2055390024, 
-  4015148180,  4286720618,  3707070473,  2845434963,  3738832196,  2762474945, 
-  2581644847,  1834083422,  2305093963,  2661700741,  1640388755,   877849567, 
-  1857340958,   831087293,  3485402995,  2903610339,   192842860,   515990160, 
-  3738583048,  1572392019,  1411695798,  1292458008,  2655213628,  1784794616, 
-  2485265452,  1772449817,   722322970,   447239935,  1686002208,   484743376, 
-  3819085937,   184747241,   730322052,  3147709372,  3999212578,  1517561658, 
-  3159738720,  1840338430,   980831064,  1677903992,  3531612509,  4235616014, 
-  2366669762,  2267311715,  3540469267,  3630421866,  2974979723,  3556894163, 
-  1277362425,  1580899806,  2797362806,  2522542369,    89643764,  1804441521, 
-  2212938358,  1662724752,   646278538,  4123199914,  2286981036,   287717155, 
-   522845471,  3457384582,   686791445,   192448792,  2904628344,  2504995519, 
-  4239163137,  2576092985,  2912931976,   569555972,   865239390,  2804008398, 
-    34487546,   214609235,  1455893873,   723854130,  3624264305,  2161752341, 
-   792713844,  3845750312,  1242793335,  2484380369,  2586575810,  1955195342, 
-   839998727,  3610317081,  1281204134,    40736439,  2486836215,  3863732384, 
-  3929843526,    71087617,   828914744,   433169689,  2977070692,  2485054885, 
-  1935091106,  3698046112,  2824060928,  3406306995,  3468676826,  3125584707, 
-  1048593333,   477715603,   134333419,  3624141862,  1082406169,  3718480705, 
-  4185934201,  2788696106,  1226527377,  1426675202,  3298460155,   642315227, 
-   214031713,  3416835848,  2670869443,  4118545218,  3819176031,  1364504167, 
-  3047762460,  2155906489,  1987985570,  3830951237,  1760885615,  2565684806, 
-  2003015730,  4047667502,  1342606360,  1703682284,  1359357612,    85189994, 
-   530009889,   556055997,  1215605631,   195813232,  1371754242,  3412632655, 
-  2401492184,  3409031358,  4036291410,  3659790921,  3219581114,   381098330, 
-  3752820768,  4281966827,  3934385174,  1726125907,   212105905,   789902548, 
-  4037200340,  2799846979,  2856795179,  1939000120,    90508801,  1785302492, 
-  1006956764,  2005548996,   894237466,   952662483,  3131364307,  2921248225, 
-  2564945360,  3315121578,  1102640772,   984177240,   230353282,  1690680094, 
-  2130517467,  2895516400,  1927658229,   799017853,   922077826,  1212886314, 
-  2492105674,  2695744971,   577623467,  3323704710,  3485251603,  4291756139, 
-  1662273283,  3932731978,   713573438,  4190432913,  2492589927,  3124907688, 
-  2815820002,   759779673,  2274678413,   508804587,  2512666576,  1584704498, 
-  3627232604,  4270068254,  2284214551,   592373060,   431222513,  2237872941, 
-  1361243520,  2524016084,  2054282752,  3930564388,  2313551550,   266252853, 
-  2283961760,  2854415995,  1936587242,  1576617491,  1031176503,  1925253377, 
-  1357662633,  3013754745,  1257519495,  2721992109,  2479563009,  3457400215, 
-  1643292267,  1095866741,  2183381064,  3422706061,   902326621,  4124662023, 
-  1642841533,  1091816212,   687539656,  2822356543,  2656311320,  1819454307, 
-  4076438758,  3323797989,   835099836,  2045219094,  2792042181,  3789121325, 
-  2982876266,   707913880,  4016980369,   620694850,  3992183847,  1634705734, 
-   830531545,   201300506,  1862770266,   124324682,   773502721,  2756133611, 
-  2932659104,   367116337,  2836250783,  1286024277,  2075653621,  2516533043, 
-  2068190131,  1108905065,   423897500,   765920225,  3250369447,   177200602, 
-  3546585630,  1505515240,  2492145256,  3781671601,  2734008198,  3958365863, 
-  1323222485,  2915108942,  3722117362,  2125700628,   302312029,  3434938598, 
-   785823729,  4122683441,   127945213,  4027863270,   601542089,   228425014, 
-   384431398,  2302359481,   776265984,  3389872308,  2273744440,  2971913232, 
-  1240640620,  1974807391,  4167859680,   560976419,  1033168446,   187757472, 
-   713479125,  3656298210,   600326524,  1261221146,  3471027003,  2205178549, 
-   649990734,  2080047938,  3238027431,  1380161576,  1313008131,  2674252780, 
-  3769849572,  2655900150,  1262127394,   787530912,  1417813098,  3940573290, 
-  2953928257,  1616113922,   643770113,   830202947,  2256897230,  2145889798, 
-   467425048,  2247183390,   251473099,  2131511302,  2714526991,  3283019995, 
-  1471062276,  3316398874,  4231045749,   513622513,  1603893192,  1920966138, 
-  2117411318,  3543055031,  3160840785,     7524156,  1481056440,   543326558, 
-  1795146366,  2692875071,  4063138080,  2044703088,     5015581,  2576625618, 
-  2622666256,  3435462896,  2460608801,  3176873791,   116300819,  3895169601, 
-  2303334880,  2686068639,  2546759354,  1713396796,  3544405268,  3072568899, 
-  2015329872,  3616883183,  1707608024,  2805897352,   487592473,  3870764977, 
-  1936147912,  3843795870,  3027224341,  3498328048,  3389905665,  4068820209, 
-  4150668272,  2739002584,   621751123,  2557902002,  1476973116,  2929125411, 
-  3834199675,  1998190827,  2997474667,   685818951,   390157254,  1285687217, 
-  2628910765,  3170295524,  1707172338,  3625919756,  4120803870,  3171003084, 
-  2840932714,  3630499934,  3987013684,   435103324,  3324068532,  1887118237, 
-   690630023,  2246685770,  4282502632,  2989888007,  1984571946,  2679856869, 
-   514847476,  3266368797,  2078057213,  3872756048,   107931496,   498707606, 
-  3423686316,  2069754032,  3402137402,  1717558895,  3650002545,  4182177262, 
-  2108419797,  1460970916,  4223449670,   691175009,    94737812,   234350253, 
-  1146179843,   905330272,   445392863,  4213989544,  1269014575,  3201905209, 
-  2236136242,  2575596017,   168019016,  3301988485,   660295520,  1411655301, 
-  4026505257,  3770772541,  1068885638,  3093126572,  2665495669,   587524765, 
-  1037245641,  4259796041,   563992910,  3366363616,   591450478,  3945354719, 
-  1333448904,  1896811123,  3615788358,  4221382160,  3371987326,  3597413052, 
-   465153567,  1182676152,  2643126462,  4106415947,   178874206,  3089153340, 
-  2577537161,  1042368129,   615921090,  2175158851,   924025560,   221990750, 
-  3802762312,  1626571862,  1014749347,  2322530656,   168812238,  2741367366, 
-  2638222960,  2086246108,   920944010,  3216215215,   102793795,  1537606512, 
-   141627589,  1722985919,  3898198054,  2070609107,  3433855441,  3532997760, 
-  3445917235,  1556137249,   590581784,  1390391334,  1796208774,  4141634040, 
-  2314762335,  1404238630,  1596312496,  2639888545,  1837363605,   427152483, 
-  4031062452,  2051892894,  2447276219,   188591440,  2154065950,  2604747880, 
-  4290869371,   791873641,  2493565262,  1286347994,   785691046,  3431043513, 
-   386808698,  1216770620,  3244171310,  2611395215,  3039257091,  3205523803, 
-   363889885,  2471667630,  3358634389,  1991012893,  2772968524,  1817708668, 
-  1101125312,  3704075758,   374369723,  1604537477,  3985750830,  2591596740, 
-  2437753983,  2117875015,  3005853848,  4197797079,   849355209,  3692465442, 
-  4271703577,   529758675,  4066932948,  2360304651,   301549531,  1356846001, 
-   927262763,   350736435,  2230115785,  3814909566,  1148081065,   712822087, 
-  2339852627,  3225312594,  1709517728,   703227950,  2504291764,  1003005900, 
-  1817808574,  3056106358,    63043068,  2507200293,  2815611661,  2292707483, 
-  2836825453,  3088183077,  1826549253,  1108284653,  2714213025,   442554207, 
-   964882594,  1675034312,  3786763980,   949260645,   859286749,  3587445435, 
-  3133391369,   376948936,  2801513683,  1706522287,  2204598807,  3856946525, 
-  1185445736,  3385880258,  1631244907,   840642562,  1497307782,  1496167494, 
-   746972243,  3835724304,  3033070869,   482161449,   925449336,   214563064, 
-  4052989203,   720636275,  3764376542,  3214252564,  1329453269,  4096593253, 
-  3908819625,   381096490,   805124308,  1124074856,  3973730143,   918294338, 
-  3302650474,  1906685322,  3651660064,  1482430428,  1476811412,  2277564645, 
-  3640564210,  1720339892,    58869908,  1328178884,  3441431345,  3703094732, 
-  2899164963,  3377935227,  3063240540,  1487745837,   522057046,   507789632, 
-   638200397,  3809633458,  2378032875,  1685720145,  1683937007,   369214755, 
-  1103557442,  2451863986,   716423962,  2370045411,  4116082416,  1048881874, 
-  1344342950,  3360648321,  3639814106,  3469796975,  1398710541,  3676325202, 
-   453491600,   677236455,  1093669508,  1666742682,  3414479226,   582219386, 
-  3851968918,  3391770494,  2865385240,   830424933,  2690108250,  1261250229, 
-  3260856508,  1708685405,  3923846789,  2412205554,  1298823813,   539537621, 
-  2336324879,  1661058239,  1444219186,  1004540082,  3344407571,  3460943158, 
-  4256211616,  2204123773,  1102113943,   314353280,  2546493682,  2623768845, 
-  2629278519,  3382013372,   974759758,   411971849,  1799163989,    61963683, 
-  1061971126,  2544848168,  3253700697,  1264813608,  1423083416,  1943823560, 
-   189389625,  3369258661,  4263666645,  1601988537,  3047945954,  1686208872, 
-  2884897098,  2460518969,  2734242555,  3108618876,   702408698,   740831299, 
-  3010853246,  2356178876,   896419535,  4130744915,  1935750831,  2675985247, 
-   446524285,  4016134831,   808977916,  2642220729,  1087126948,  2669836522, 
-  2674959459,  3287454708,  4263652732,  1533027711,  3980987168,  2827551660, 
-    74554061,  2824517945,  3874343483,  3044247227,  3173043581,  1490755999, 
-  2513583460,  3799269873,   594971931,  3877593784,   916781956,   860769912, 
-  4245324544,  3190417753,  1013415511,   178045028,   376041699,   262497265, 
-   158943259,  1147821820,  2781070139,  3433230382,  3043130402,  1426554014, 
-  2553175978,  1547756901,  3806938838,  4013398194,  3615867237,   994533257, 
-  4179550182,  4222805604,  2055021902,   823637039,  2072006849,  2383590546, 
-  1825043245,  2707024816,  2744234571,  3405212016,  3424486264,   363938937, 
-  2106138043,  3284828474,  2751808383,  3052378712,  1481580743,  2083373145, 
-   875474387,  1569660974,   599920392,  3799995893,  1086661684,   923351817, 
-  2423916363,  4006595211,  2307954332,    95931750,  1692001437,  3367205758, 
-  1411352282,  3090401796,  3799686361,  1668698336,  2684595919,  1209094842, 
-  3549472958,  1109011053,  1301737395,    79543440,  4089984658,  2518194505, 
-  3006893888,  3683189005,  1967905134,  2877762587,  1205711468,   880514663, 
-  2577735701,   639760342,  2174160151,  3333223140,   676623147,  2928713743, 
-  2089223589,  1175705672,  2475147955,  2908417231,  1905317643,   807328116, 
-  2956373510,  1650262521,  3955820100,  4175264140,   673689246,  4222602044, 
-  3159843750,  3057414081,  4055074477,  1169260475,  2050888666,  2032369425, 
-  1537231987,   138840925,  1365780565,  2447210416,   340385689,  1726423165, 
-  2628355066,  2379693022,   789272512,  2914626324,  3028531285,  3447138868, 
-  1718812157,  3957580863,  1142688234,  4221024926,   918644913,  1395459370, 
-  2008177424,  1684004303,  2081174400,   906988048,  1916282394,  2511856310, 
-  4037239237,  3543703103,  2655386781,  2778501898,   887567630,  3047646563, 
-  1917206404,   620417382,  3166760422,   516472424,  2962221325,  3037316724, 
-   793973029,  3762084312,  3362302788,  1630951156,  2461242367,  4035957621, 
-  1205998699,  2672727459,  2387349947,  1325853371,    90567194,  3302776275, 
-  2086900653,  1278615296,  1001006543,  2766335970,   927493647,    28404253, 
-  3320918373,   665791390,  3970704223,  3833682299,  3926072013,  2690543350, 
-  1908182346,  3293552465,  1403238796,  3666837313,  2493039986,  3144707904, 
-  1153861511,   960366981,   673045862,  1839418881,  4278063535,  2517478638, 
-  3883951864,  2673469640,  3448277915,  4115175239,  2492531073,   654925257, 
-   126164991,  1812831808,  2822260110,  3364061114,  1870715947,  2516741635, 
-  3938486010,  1813788574,    68877634,  4275352522,  4069396698,    97943569, 
-   524328027,   712767034,  1570498852,  1155780944,  3700085823,  1253153056, 
-  3214275771,  1447655243,  3281522783,  1329462890,  3262099549,   917361975, 
-  2094002987,   694965734,  3973704529,  3736192263,  3439927961,  1232063626, 
-  3630847797,   113749099,   664926316,  2065817504,   517837445,  2517445225, 
-  3376453870,  2894073255,  2831754387,  1829986672,  1334409288,  2344835205, 
-  2916062262,  1382839699,  1464837792,  3026170895,  2878125041,  1602275244, 
-  4056550784,  1064398583,  1794879217,  3863790715,  3643183495,  1722844206, 
-  2293050067,  2366890883,   820048480,  1751623077,  4196918717,  2782948075, 
-  4094889702,  2367386113,  1226614071,  2614252116,  2337492063,    60897495, 
-  1316090099,  1562070084,  3553261911,  3917438653,  3565745298,   819151207, 
-  3183565799,  4080360835,  4180358364,  3978808435,  3933924475,  1002004103, 
-  3705232141,  2615527978,  2616202773,   637361995,  3957741924,  1058410913, 
-  3248591064,  2316893548,  4216722260,   710404084,  2331478832,  2393288906, 
-   214560618,  3002042555,  3743433821,   555697160,  4180052657,  1131663485, 
-   345591167,  1621223656,  3659549317,  3591788632,  2964510867,  1158739853, 
-  2797496429,   236189083,   754457120,  1950505881,   859284961,  2111980356, 
-  1133883882,  1579144488,  3887225292,  1056384264,  2082739616,  1682642147, 
-  1039174270,   150648999,   239004939,  3916085390,  3597079250,  1959639539, 
-  1474251005,  2794783243,  3808642638,  3493879884,  2608579278,  1279362878, 
-   463280288,  2922412597,  4109778262,  1914641424,  2461895447,  3840475151, 
-  3731487115,  4247084322,  2388886610,  1662143045,  3053537730,  2671842459, 
-  3712735553,  3562288611,   931409564,  3440466408,   883733661,  1718119340, 
-  1810782397,   949388712,  3270131454,  1223599407,  1182360112,  3060333338, 
-  3406876233,  3917500522,  4061980498,  1518261588,  1900592798,  2707737675, 
-  3300613447,  3367405309,  3475511180,  1943333771,  1388383187,  2966397782, 
-  2289683112,  2992756940,  3999559923,  3017179688,  3931267245,  3786525475, 
-   793950314,   956526370,  4125994829,  3947357625,  2222732828,   608269472, 
-  2502360887,  1746275810,   302498747,   100728009,   947045253,  3760103766, 
-  4210949989,  3021727916,  3321832908,   794714215,  3653041826,  2476525222, 
-  3841463995,   685055720,  3297280903,   363355641,  1451605295,  1867037655, 
-  2391024993,   846274184,  3855176146,  1775816238,  2809283032,  3647209774, 
-  3116474208,  3912062288,  2902776277,  1493372532,   757912778,  1453887028, 
-  2115400980,  1647967116,  3225950098,  1299725035,  3336206605,  3135723135, 
-   476317811,  3164581253,  1955303510,  2004492266,   275283320,  1034735572, 
-  1501179347,  1425390647,  2063279355,   908099494,  3986566941,   332845746, 
-  3036960874,  3692313574,  3283673352,   581979800,  2228942054,  1202668946, 
-  2045970074,  3409926254,  2818091895,  1956900784,  2330033239,   593683329, 
-  2394937388,  3734724665,  2850677782,  3953065836,  1220318002,  1368086568, 
-    84415415,  2125875789,  4196827142,  3548869917,  1030729819,   500314559, 
-  1294454304,  3547366227,  4083500441,  1683552200,  3206384695,  3286971682, 
-  4127016279,    73640752,  1922692498,  4109267340,   682756409,  3739277505, 
-   630852085,   880366569,  2578057829,  2709802453,  2270583513,   830767223, 
-  1393779770,   821540398,  3869799280,  3133175408,   625690641,  2351420930, 
-   937518929,  2089980356,  1436047621,  3177686628,  1184551763,  3420217733, 
-   749303508,  2388993665,  1097411062,  3968992511,  1354014696,  2683088380, 
-    49053389,  2531606356,  2493594629,  2685189395,   591365479,  1947206461, 
-  1278801887,  2444920325,  2410108486,  3450960298,  4149681195,  1342645392, 
-  2244219719,  2987017677,  3197846087,   136666163,  1161067622,  2856597232, 
-  3822033466,   453312659,    52256862,  3153923059,  3499450757,  3165646796, 
-  1137900679,   201725552,  1787545093,  2944535320,  3197591324,  4253395484, 
-  1125335971,  1326209863,  3510865122,  2642395959,   982418319,   382288416, 
-  2707393691,   383674632,  2457042934,  1489758497,  1651316920,   483355450, 
-  3506438428,  3204398189,   534820843,  1183384195,  3782209538,     5929112, 
-   912192389,  1099142284,  4238115678,  1494504615,  4222163915,  3897344535, 
-   389973482,  3362686412,  2739631916,  2959530236,  1355289549,  3776253376, 
-   225996343,  1342846650,  2202314243,  2832177710,  2269734499,  2397760107, 
-  2112130453,  3952568755,   520428088,  2464963836,  2520765397,  1565116569, 
-  1784636740,  4234408456,   629975689,  2923307921,  3995900265,  1096667699, 
-  2957390618,  1040787116,  3917187781,  1852543972,  3708156362,  2196885640, 
-  1357637645,  1059427249,   800951665,  1558460654,  1972949201,  3182661420, 
-  3998158503,  4141116611,  2023156682,  3526608661,  2523991336,  3387636868, 
-  1093849504,  1309662553,  4009252663,   546826189,    34275639,  2323354291, 
-   312071526,  3525634931,  1208894421,  2212683978,   467777307,   829671632, 
-  4014430127,  3398589352,  1905610209,   815302373,  2797955068,   225433702, 
-  2470529007,  2742077450,  2903370352,  2279067586,  4183721953,  2570380775, 
-   220433001,  1805334401,  1163418814,  4012960933,  2601029767,  3473883374, 
-  3895376704,   338307077,  1424927398,   850611535,   820786706,  1076134451, 
-  2645350199,  2078538111,   286753861,  3303436755,  3567737764,  2328346633, 
-  2280804143,   780473203,   419773954,  3950922182,  1142106655,  4160644851, 
-  1628685007,  1063201038,  2236318585,   393328534,  1917651040,  2801873919, 
-  4015613528,   241714117,  1821091341,  2774207363,  3499634683,  3920672099, 
-  4042497879,  3095878866,  1621427908,  3388638971,  2451773422,  3237433762, 
-   722612410,  3491742477,  2147243765,  4280202174,    15699144,  3363679888, 
-  3019382205,   532658712,  2535043792,   162224631,  3315889756,   715942485, 
-  3979802254,  1399729891,  2975290039,   390380154,  1945386615,   300425221, 
-  1390570267,   819404799,   182724483,  2718628059,   902023771,  3819012411, 
-   771859084,  3533409145,  3642221667,  1875647600,  2691768511,     7273915, 
-  1378825705,   420916698,  2902443294,   853379010,  1994323785,  1716919326, 
-   512404125,  3277123711,  2140732217,  3895553590,   484118713,  2880382320, 
-  1986926984,  3503859707,  1265397230,   371508658,    61326465,   674423784, 
-  3713634120,   574860231,  3327463734,    39720925,   794931529,  4199087598, 
-  2848643787,  2766217219,   153947045,  1546150119,  3217559502,   142438117, 
-  2232950603,  3850161013,  2440762006,  1886597635,  1699199851,  1200101543, 
-  2835384351,  3690743310,  1515576601,  1717987347,  1171350820,   455247175, 
-   795480799,  2304716934,   305112532,  3257719850,  2912938589,  4007733397, 
-  3574431616,  3667785792,   292332366,   351899707,  4246678661,  2575031882, 
-    24568515,  1125054058,  1702300735,  1342467819,  1853828667,   512470016, 
-  3228597633,  1546008254,  1285020192,  4240231592,  3234639716,   320278902, 
-  1973838575,  2150978165,  3386861112,  2002065523,  2524895393,  1481865126, 
-  3845636354,  4227105700,    13175204,  3660996809,   149193999,  2845497867, 
-  1866453538,  3589446496,   112894992,  3231615620,  1892506641,  1234188530, 
-  1506568107,  2537536410,   448366052,  3021229867,   309005572,  3023594497, 
-  2246165813,  1986866788,  1996836585,  2383988257,  1613243654,  1471884309, 
-  3392471085,  4012164235,   252964119,  2532916404,  1793051358,  1488738587, 
-  4226264233,  1796553184,  2981029367,   486252823,  4285175522,  3651163770, 
-  1616912473,  1136427239,  1262153412,  3062664654,  1810814732,  4117940624, 
-  3685915632,  3646437691,  1629093510,   136150006,  2694554587,  3751736522, 
-  2920365586,   942938198,  3026886243,   111126373,  3661275825,  3945265912, 
-  2341792553,  3019200730,  3733312199,  3904220600,  1167444872,  1950810724, 
-  1359941973,  2301105697,    86863405,  1571096017,    64806576,  1568072792, 
-  2329724356,  3559297371,   390819005,  2504835584,  3590740948,  3383386267, 
-  4160654753,  1128861829,  1035792454,  3996855286,  2570274492,  1999911892, 
-   224193516,   983114481,  1717848049,  2128517049,  3758416867,  1957579455, 
-  3209144212,  2040304769,  4021770133,  3429176785,    23465180,  3814367265, 
-  2755226927,  1093467790,   447473683,  2826309739,  2376413612,  3445970498, 
-  3778915285,  2159919199,  4271871841,  1562847320,   389934159,  1548223467, 
-  1933692533,   564440077,  2173497840,  1271115366,   792111669,   830164100, 
-  3957565857,  2747897526,  3043763722,  2172923297,  2617543444,  2643156396, 
-  1132255309,   918223784,  2029618827,  2066371144,  3896601058,  4280746204, 
-  3882156084,  3809071527,  4177245554,    52150356,   892780051,  1568658150, 
-  2537023983,  3367707355,  2393934434,  4041678129,   267435324,  1364637453, 
-  3621574350,   216586465,   784277516,  2642114764,  3627345145,  4199050884, 
-  3043430989,   628003812,  4086115780,  2528695761,  3473761127,  1854670667, 
-  1685584294,  1642823366,  2550295985,  2696608906,  3744813261,  3261276282, 
-  1429369762,  2672012338,  1678220368,  3929026536,   449101391,  1411384247, 
-  1424556661,  2835393992,  1079387545,  4043068108,   221545110,  3425511684, 
-  3511849505,   557734213,  3375669067,  1037571859,  2000330372,  3293742032, 
-  2974775026,   618589361,   248629096,  1897095187,   213258567,  2850566869, 
-   123010076,  3168881467,  4270557959,  3277882687,  3904911353,  1661026834, 
-  1113501408,  1920883563,  3066524694,  2293004472,  3992808035,   806427110, 
-  3070575088,   872882671,   225343703,    14803807,  3535480994,  2812430963, 
-  1634090455,  2373561109,  1790040002,  2326477211,  3233211251,  2725322514, 
-   533882407,   461538756,  2324849846,  3597305224,   760329569,  3461217933, 
-  3167648214,  1477282450,  1011253921,  3522886923,  1841373943,   924734344, 
-  2173934607,  2620401043,  1695683138,  2095465577,   609456815,   337796753, 
-  2078701897,   625190665,  2886060257,  1339354329,  3473617653,  2745203418, 
-  2247389467,   552761397,   440326645,  1982934677,   191527264,  1981471825, 
-  1945153909,  3750616525,  1557225134,  2794744418,   938364374,  2692101686, 
-  1734374882,  1493562975,  1684526689,  1768856665,  3223386985,   924747877, 
-   966226305,  3121286776,  1459119417,  3027878810,  1478314277,  1572937668, 
-  1572768799,  1750420014,   946434997,  2057964574,  3854236996,   542037518, 
-  3907932954,   670355561,  1299426881,  1365156140,  1890101317,  1803230813, 
-  1309761236,   129001915,  1806954360,   266311103,  2996377322,  1051459516, 
-  1203701038,    51763443,  3072311708,  3503474473,  1449529978,   192845484, 
-    61600411,  2325041834,  2921016636,  1667030798,  2236984967,   184636650, 
-  3617224200,  3792083355,    35156206,  2383315993,  3015225341,   163888461, 
-  4150991510,  2771167429,  2080490307,   106315553,  1024657984,   177873250, 
-  2948002559,  2274659720,  2807785919,  1293091859,  2516457567,  4158809521, 
-  3590783466,  3786116485,   149533631,  3715580621,   625296966,  1771906203, 
-    63072767,  4218799962,   809586800,  1810039753,  2228466115,  1516524354, 
-  4266551601,  2730840444,  2662668771,  4264395580,  3964912016,  4144538486, 
-   334999313,  3267635132,   557485107,  2344234158,  4026477910,  2966074428, 
-  3032631486,  3513248527,  1378540707,  3585876385,  2915718370,   158925076, 
-  3296710991,  2159873019,  2456821256,  2098138095,  1775109311,  2725326638, 
-   761188384,  3110437903,  1159636489,   639648728,  1158045951,   813331788, 
-  3246284376,  2157818773,  3103182352,  1588894935,  3870992167,   885742904, 
-  1096445056,  3747124721,  1615180658,   224989251,  3510883438,  2984865208, 
-  2481683706,  1194777252,  1389848809,   389944231,  2922133875,  1823475378, 
-  1478469257,   398603487,  3315217660,  2943271864,  2511271505,  2417566782, 
-  3347395521,  2645220967,  3599080981,  1557440924,  1613445476,   112437545, 
-  3859386867,  3516602932,  3053058843,   428716910,  2352408116,  1798096194, 
-  4143066721,  3648905581,   848525731,  4196319191,  1583484855,   101037345, 
-  1208241627,  2615490469,  2201332650,   721225763,  1553703903,  2990431689, 
-  2815213799,  1519349332,  3329760842,  3339931493,  1990924535,  3275951659, 
-   963348782,  3934179171,    82328057,  3977389503,  3456269628,  3097445772, 
-  2375313016,   477345675,  4143087187,  4128607062,  2583972357,  3700634984, 
-  3261265938,  3972499120,  2220112989,  2486390881,  1290991570,  1812415653, 
-  2678571413,  1257705934,  2757570191,  1029710253,  1522492879,  1639199874, 
-  3691772867,  3416867126,  3605051357,  1111089679,   559320312,  3280272948, 
-  2534196742,  4175116866,   278168710,   679494650,  1352422540,  3929720053, 
-  2694910961,  3186209469,  4178387292,  3537100969,  1306159384,   286049314, 
-  2420993588,  2814605416,   884861645,  2231364395,  2974900521,   543596196, 
-  3966413279,   461331329,  3647359062,  3628534112,  3075510747,   114837515, 
-   244061427,  2550886945,   298562010,  2626561704,   708428539,  4071792418, 
-  3298501469,  1620812492,  3326388753,  3859667690,  3449251520,  1232928752, 
-  2018009066,  1465290813,   183551583,  3741887125,    37819618,   546681764, 
-  2679853255,  2721861552,   318307993,  1109102540,  1912506921,  3676450673, 
-  2951352702,  3901629725,  1986582670,  4071208720,  1551470722,  3156860434, 
-  2819216524,  2422615478,  3501203766,  3315422349,   537850987,  2405149042, 
-  1727210587,  2748483914,  2247329035,   850288258,  1288168050,  2724962956, 
-  2061550877,  1360696751,  1949815229,  3397471178,  1238741267,  1385702878, 
-   113339143,   244958461,  1482022002,  4244065815,  2174783265,  2106108141, 
-  2796276430,  2056050089,  3362884746,  4148771754,  1675144389,  1713654328, 
-  2478307288,  2589078741,  3276272213,  3098065352,  4278461262,  1156480447, 
-    86720893,  2514044743,  3259686486,  3564661931,   449619585,  2679002862, 
-  1692597641,  3721702147,  3436902143,  3091897566,  3371258735,  1235748538, 
-  2284170677,   281108073,   754227622,  3292281668,   197597136,   325826358, 
-   452626395,  3477168842,   505964110,  3700576986,  1665210901,  3588918828, 
-  1016284317,  4034133504,  3737577060,  2641538680,  3618806772,    22917395, 
-  3676023857,  3907909237,  2582739133,  3162299026,  3104568053,  2034033453, 
-  2590620346,   540871879,    31316629,  2922815094,     9683552,  3385993217, 
-  2427228509,  3735852789,   437338521,  2318035354,  2886517830,  2052261078, 
-  4047563787,   669545800,  2365271848,  1547196049,  3754638158,  3114619425, 
-  1940378131,  4092000269,  3209099958,  1765847546,  3875313236,  1684036161, 
-  2150668563,  2554542791,  2331796267,  1221377190,  4131883508,  3027842335, 
-   581447715,   692316384,     2242682,  3040229118,   617663022,  4016391562, 
-  3237216993,   575649255,  2561136298,  3973360466,  2037080911,  3481530445, 
-   881023889,  4018794613,  3100936058,   635086266,  1029182128,    99158363, 
-  2692735254,  3509025503,  1865376276,  3494716816,  3075384422,   897331514, 
-   135932830,   296741664,  2652884657,  1421530080,  1942720661,  3865557958, 
-  1863813841,  3832491857,  2392590094,  2836046808,  1114234139,  1733126175, 
-   417123487,  3253459769,  3216171436,  1192112568,  1853962575,  2450895556, 
-  4287175088,  2177965046,  2735874264,  2674964856,  3870312030,  1593184401, 
-  4178161215,  3903536274,  3366105648,   789415878,   997793833,   960363034, 
-  1294916030,   817442000,  1849364312,  1775467944,  3997089641,  1307674098, 
-  4268866381,  1171422009,  2668024129,  2046262496,  3153459362,  1632677306, 
-  3965781330,  1813164283,  1878339129,  1686313921,  2135809733,  2480422534, 
-   144304918,  1541801330,  3140605725,  3194411781,  1065634094,  1192516953, 
-  1285422392,  1249395861,  2109060887,  4243687109,  1996982101,  3909027451, 
-  2312869333,  4020870096,  2900003681,  1218910679,  3105373821,  2498703922, 
-  3247532132,  3784885834,  3898740111,  3603709029,  2888446695,  4253557761, 
-   948278795,  3256504063,  1696263699,  3944579362,   461920514,  2232596665, 
-  2850239285,  3423295434,   477528514,  1387327256,  2588986506,   821197580, 
-  3791094948,  1186500674,  4127371176,  1817715881,   919092722,  4169899970, 
-  1248442132,  2375338236,   622256971,  2714925341,  2367151201,  2569205375, 
-   261820946,  3438573608,  2396564096,  1905720804,  4209151826,  3559978245, 
-  1455140527,  2236864831,  1781017489,  4195086773,   866208186,   754722391, 
-   594885609,   990282486,  1855714722,  3629351141,  3722373708,  2732700738, 
-  3615564765,  3520187496,  3322072505,  1530469526,   175503058,  1419753683, 
-  3473703911,  1827887573,  1355944039,   735234820,   769378979,  1625931060, 
-  3002502634,  1039278388,  2053981786,  3450965177,  3201623807,   304833304, 
-  4202975921,  1973867031,  1921248856,  4111769497,  3773655524,  1105942159, 
-  3052801214,  3847321960,    40265502,  3839570761,  1833915120,   374881510, 
-  2406292494,  2694919215,  1375290477,  3790755011,  1668500686,   865710218, 
-  1979961287,  1914825019,  2880181896,  2846876958,   742294576,  3384941091, 
-  2087612969,  1187442243,  2277011600,  1308785048,  1175602965,  3390412614, 
-  3666950930,  3052756460,   811247199,  2083123881,   743004310,  1680971595, 
-  2902709603,  2830923897,   636941821,  1155896593,  3808588640,   311814914, 
-  2123986446,  1611865251,  3693020331,  3423777837,  1933565870,  3960748770, 
-  2310813153,   171649951,  3413839061,  3233144835,   929160758,  2454228368, 
-   872656816,   798256202,  3310215220,  1876496785,  3706956142,  2215114825, 
-   674404995,  3431770830,  3371301676,  2985659974,  2304383770,  3063997628, 
-  2948005301,  3595834572,   840910982,   503750915,  4221029076,   737956564, 
-  3796714817,   228824735,   478161145,  3165762352,  3803304392,  4077989482, 
-  1459804638,  3323778632,  3948057296,  2269713387,  3545582432,  2489993648, 
-  3784658689,  1162895500,  2818450544,  1419511242,  3849252373,   175111074, 
-  3761949209,  1164367826,  4040148836,  1070887289,  1440571891,  2012124729, 
-  4213534017,   248881915,  2434783842,  2435407341,  3076073175,  1627211286, 
-  3821599262,  3170724147,   757610694,  1844975911,  1336341741,   949251781, 
-   480916687,  3129325213,  1565551450,  3739430588,   704531999,  3512131113, 
-   734836685,  2448226358,   679399491,   615484179,  4240278946,  1948097041, 
-  2478741117,  1493448050,  1889646068,  3014910488,  3033453083,  2539399932, 
-  3253565580,   630651950,   819154398,  1879132525,  1944606927,  2246561867, 
-  3691883051,  2797713177,   766775938,  2989387447,  1738209477,  3533536359, 
-  4000166088,  1897755601,  2317778885,    47328685,    34589653,  1637679201, 
-  2860814387,  2125180062,  2171873961,  3767049580,   972371577,  3085291476, 
-  2618898560,  3654803108,    67656281,  3251768857,   754406542,  2648598579, 
-  1820022713,  2031966536,  1317135539,  2527093431,  3748202911,  1344289648, 
-  2316309085,  3899512325,  3874539118,  3586524665,  1872019132,  1952239737, 
-  3333759598,  3442990099,   730837087,  2509215553,  2557605214,  2602973624, 
-  3739133523,  2481389698,  1692655481,  2703570720,  3156067668,  3060020439, 
-  2158191328,  3322058500,  1958317297,  1103337805,  4023883214,   173989942, 
-  2360721416,  1093094954,  1472966811,   303997241,  2947978102,  4283686694, 
-   341931398,   907515635,  3036274187,  3183105363,   457350171,   947005026, 
-  3489408723,  1182690233,  1312117203,  2924713728,  2570166702,  2237754052, 
-  3669965156,  3462473122,  3025414183,  4275260489,  2347434631,  1243690398, 
-    69784285,  2820616317,  4104376816,  3715749036,  2170340044,  2049561576, 
-  1370791019,    55078097,  2474717801,  2683688611,  4207981784,  1121328413, 
-  3430239749,  3004610368,  2111577448,  2295295037,  1280644728,  3068236427, 
-   402190716,  1402194956,  1800407529,  2393403651,  4265963775,  2577295540, 
-   754653313,  1330311666,  2969016268,  4154929462,   465971130,  1246460005, 
-  2805976979,  3061871948,  4104925094,  3910767104,   246469020,   833041322, 
-  3289364459,  3062223176,  2532745846,   661247884,  1791410822,  2074969138, 
-  1815042106,  3771713284,   641129323,   860926477,  3399719353,  1283107114, 
-  3885932255,  4105782144,  1607437353,   710405410,  2738437864,  2321253895, 
-  2868625013,  1752655281,   429035598,  3306912163,  3458741117,  1782771699, 
-  2815081779,   604871659,   679705338,   886969993,  1443522480,  1941118552, 
-  2466113206,  4183350983,  3748462302,  1290744280,   755455068,  3974106094, 
-  3802681885,  3395866348,  2150751313,  3192858927,    78423073,   134281861, 
-  2803509831,  2288442253,   216685897,  1222137989,  4077497835,  1369433217, 
-   513129057,  2920264543,  3966468028,   944020753,   406426307,    44850156, 
-  3357855851,  3551130050,  1741872826,   249490293,  3121078840,   494756116, 
-  2413881828,  1308392249,  1180493053,  1338397021,    45957709,  4232032635, 
-  2312050230,  1808659536,  2574134504,  1340315174,  3738107135,  3762288032, 
-  4236537141,  3631645096,   620566673,  2873260572,  2976933254,  1366676191, 
-  4272125932,  4101407821,   740591613,  1091766564,  1368399443,  3148718056, 
-  4008612308,  3711805878,  2231383985,  3497214380,  3593053610,  3075567419, 
-  4125160824,  1833994236,  3193103728,  3534382122,  1847804638,  1229202096, 
-  3308635340,  3712933434,    10914664,  3134633807,  2733489644,   335625566, 
-  3903685005,  3696230400,  1029693828,  1944528471,  1687646453,  3244660628, 
-  3747983073,  3525158604,  3606794650,  2018428933,   266445316,   772265295, 
-  3543202879,  3372117524,  4220975320,  1665351507,   237675804,  1527988743, 
-  1264428330,  4028305725,  3705710968,  3424507058,  2285682692,  1930663442, 
-  2944543490,   457388426,  2977244844,  3938374173,  2468002025,  1188837744, 
-  3616177956,  1568603476,   686722661,  3083183450,  3490690879,  3107955881, 
-  1179552763,  3923460181,  2555094339,   235001157,  3153297487,  1380414935, 
-  2333882385,   274170888,   521732782,   392964921,  1156479732,  3879323444, 
-   242427750,  1846036268,   520782718,  3488025339,  1478427476,  2761965531, 
-  1809163719,  4110361121,  2695850289,   280838514,   535482447,  3972332301, 
-  2523209739,  2917702627,  4174132865,   596380587,  2105446991,   223137983, 
-  1633253833,  2789034322,  4187177638,  4238056968,   980529831,   626246204, 
-  2072974215,  3446560429,  3778665220,  1527156941,   599516107,  3661253406, 
-  1720486371,   328929485,  2298451937,  1495384143,   492174205,   155369710, 
-  3496963728,  1433375233,   538678192,   282694420,  1214398294,  4040086039, 
-   166971678,  4084285457,  2919874696,   576155104,  2340906002,   476318133, 
-  1115356484,  1138064780,  1167781407,  3448378619,   792847718,   432399467, 
-   780118129,  4231712948,  3148318543,  1341794366,  2717210176,  3167330444, 
-   253606582,    87028619,   817318917,  4123827220,  2484825031,  1921921011, 
-  2492425678,    11310428,   443795827,  1620262483,  1215126786,  4081778885, 
-  4214411112,  3504199864,  2472485792,  3017486265,  3063274343,    71170270, 
-   446312954,  2496672739,  1384549093,  3609276977,  2121272059,  2191090178, 
-  3317582910,  1727393512,  2596162050,  3004143117,  2108506718,  3050075047, 
-  3166970607,  2268121115,  1965419447,  2725417795,  2112741307,  3374730363, 
-  3421551824,  2588553288,  4218312423,  1081929970,  2575158192,  1414475673, 
-  3997564164,  3652207945,  1634144775,   638390850,  2159042208,  2028687044, 
-  1470182885,  1236147127,    34608645,  3955996720,  3110070790,  1089898622, 
-   585649625,  3553100187,  3587932831,  1627481535,  2939411006,   259338906, 
-  2363950424,  2280019548,   542525236,  3305700659,  1887194565,  1663512370, 
-  1957030216,  3665488965,  2460339980,  4223721827,  4236428667,  3548933937, 
-   730973202,  3857452482,   700531921,  2625687178,  3057150595,   451121505, 
-  3092186035,  1086424909,  3402700407,  2455876291,  1037919945,   178730976, 
-    27913683,   742541173,  3568055641,  3320000072,  1318110048,  3936287067, 
-  3764662212,  1384305613,  2909311613,  3955434259,  3920490548,  2217517649, 
-  1240274141,  4066063612,  3037918887,   650083303,   647982008,   313802678, 
-  1585378044,  3636614630,  2060836709,  2696147400,   350587940,  2338203606, 
-   360865932,  2936100685,   528981564,  4140877684,  1901823577,  1613625480, 
-  3835285369,  1603943556,   115583460,   955434449,  4045764860,  1321839474, 
-  1191203687,  3799792331,   366900540,   849713132,   421998107,  2990574480, 
-  3136530196,  3229095555,  1156989776,   635434296,  3406338891,  1748652623, 
-    77621952,   903599621,    32308412,  2877039410,  1734251365,  1136193350, 
-  1995256521,  1668784493,  3190889844,  2768722798,  3907815168,   955633897, 
-   966235917,  3251097888,    64105153,  1946436621,  2786114295,  1885172442, 
-   780804517,  2119055356,  1895297162,  4118442786,  3024484746,  1817784649, 
-  1337040213,  2427842523,  1425121338,   178518171,  2796444895,  3746372962, 
-  1825293873,  1948031194,  3489199156,   428346890,  1543761352,   304271669, 
-  3203303476,  2287565489,  1614102649,   235351500,   859011517,  1370327452, 
-  2816747199,   681824589,  1865832145,  2358229826,   667165481,  1435167199, 
-  2555887337,  2213200835,   831100932,  2704447344,  3492492370,  4149597945, 
-  3309672017,  3221340723,  4243045174,  1190117444,   839257686,  3586634927, 
-  3747769644,  2155677142,  1639102377,  1826958443,  3984270882,  3149442914, 
-  3628362760,  1023794047,   284180830,  2735356793,  3201886739,  4134822768, 
-  3941694679,  3705732160,   743352873,  3807510250,   186847862,  3300684356, 
-   624550439,  4155199813,  2055399973,  1543482117,  1445800107,  3935281540, 
-  3218467373,   378568083,  4107842811,  2292299946,   442096658,  1090723867, 
-  1737505517,  4019921461,  3924539013,  3087167347,   800640012,   632732693, 
-  1809292402,  3801523877,  2890859998,   995508536,  1611966504,    19791834, 
-   263985792,   497993320,  3388393694,   123965099,  2201528696,  1124202493, 
-  3489904132,  2601166989,  2366687365,    90976697,  2627536647,   768033265, 
-  1621710195,   810706312,   508974881,  3111581106,  3708317300,   597488571, 
-  3217576450,  2462873977,  3423176702,  2672845134,  1524540038,  3091229998, 
-  1311794805,  2056003680,  1460345370,  1925793000,  1325650591,  4265129835, 
-  3460872130,  2127421765,  3431792979,  2682474984,  2562718293,  1913206306, 
-   354642280,  2413430525,  1358371847,  2712292483,   816997353,   522018177, 
-  2373835898,  1040257460,  4291646693,  1179717102,  2271660698,  4008988902, 
-   347395255,  2545845354,  1970409015,  1859200328,  3170714075,    95234952, 
-  3087050784,  4285923157,  3547675479,  3087350677,  2905072637,  2970665907, 
-  3343269336,  1570437129,   917836673,  1018696164,   676395215,  4205466914, 
-   614202721,  1487891962,  2400939055,  1136751445,  2667919416,  1698374879, 
-  1696127320,  4260656715,  4119085885,  1931646281,   542093772,  3177006185, 
-  2803568183,  4158072888,  4215914343,  2784188271,  1638225952,  3955431946, 
-   551592303,  3287227461,  1442662364,  2679020292,  2185283622,  2095975663, 
-  3217727216,  1629285805,    23370368,  4197892113,  3758982252,   677759078, 
-  1769772197,  3668120133,  2457416821,  3132893829,  3030066176,  3561198166, 
-   420078814,  3078161904,   755905684,  1003542006,  2714599653,  3180304590, 
-  2573598640,  1336185513,  2643853014,  1818211947,  2006324615,  2653663801, 
-  1667769531,  2144761963,  1926569392,  1293296445,  2040038284,    82673940, 
-  2934708459,  3074449991,  3115579199,  1006570378,  1074684393,  3565129762, 
-   472084288,  3695606413,   980948367,   679945848,  2137316457,  2188466941, 
-   422803169,  3254697624,  3947449413,  1588257806,  3411029124,  4001820465, 
-  2064271979,  3618405086,  1153882114,  1507429223,  1393793170,  3274232574, 
-  1135631228,  3311528052,  1354215698,  1990890148,  2316735778,  3030766542, 
-  1681211579,   642212850,   716287244,   223440915,  3118654312,  2511387140, 
-   437768332,  3461402588,   400814698,  1014558382,  3342907895,   189760650, 
-  2585193986,   128707521,   643337786,  2830150718,  2350081759,  3071139854, 
-  3270387311,   905429068,   461014650,  1541247911,  3878899645,  3505278198, 
-  2587464756,  2845431737,   704377296,   933869724,  3010713063,  3767766995, 
-  3504953061,  1957333753,  3097954869,  2994925625,  1008511647,  1960971436, 
-  1804810138,  2525274839,   498890962,   615649674,  2618190765,  2165613444, 
-  2141256314,  3636077037,    12617809,  3284601953,   452418830,  4236969641, 
-   959958822,  3208846570,  1453359087,  3788518697,  3633170503,  2870568157, 
-  2392275290,  3314305611,  1196430753,  2913728559,  1441862621,  2769461272, 
-  2744373764,  2320489417,    46464432,  3776446697,   546790471,  3216543502, 
-  1327498362,  1876508356,  2178396245,  2358650312,  3386823600,   729746175, 
-   904022174,  2431448039,  3896246127,  2766060002,  3638388340,  2834506124, 
-   660258206,  2885509075,  2936776630,  2922393112,  2818862634,  2041150316, 
-  2090499303,  2892406611,  4079869796,  1433596636,   246481117,  1479665190, 
-  1681933054,  3302163099,  1934913780,  2605471290,  3672441197,  2642949810, 
-  3580971475,  4105125235,  3083046251,  2927472630,  1325987440,  4004401489, 
-  3826729604,  2317058310,   888291187,  1170768687,  2439626019,  1648889540, 
-   685868122,    54380018,  1547257416,  1404864234,  2536769952,  1043655487, 
-  3834012639,   673324534,  2008979298,  1565552178,  1315189794,  1112301773, 
-   589795940,  1904149677,  3540126360,  4070366141,  2699061866,   773009906, 
-   561284183,   783006590,  4056249272,    29293956,  3750206822,  4238480447, 
-  3238293770,  2100070969,   175764708,  1733649014,  2892014343,   127775551, 
-    61730714,  1847608012,   686191135,   851203605,  1349450331,  2043047870, 
-  2666043109,   365297683,   698658867,   711763896,   858604354,   721089127, 
-   418721181,  4282236705,   710661785,  2490722725,   667013061,  3830950652, 
-  1053841795,  3080579697,  2176995433,  1487173489,  2025308116,  3441166572, 
-  2489572046,  3707163484,  2179618353,    16355077,  3834812199,  2741480774, 
-  4291624307,  2856083687,   981770298,  1113089038,  3632887847,   140270063, 
-   339493879,  1069609217,  1529917224,  1985179207,  2369809928,  1425996964, 
-  2994048606,    54114155,  2197368034,  3668117217,  2118736540,  3356336751, 
-  4051254083,   248416649,   621065165,  3950240219,  1676144225,  3533467636, 
-  1142958983,  4177245422,  1375782655,  2703165393,  2202891415,  1698382222, 
-   854600142,  1494272880,   418012223,  4091867510,  3742239438,  3253056314, 
-   926247678,   476657151,  3678164229,  2439033755,  4209181438,  2937804082, 
-  1908565119,  3082961425,  3686710674,  3904409851,  3621594353,  1882568263, 
-  3843620527,  3261707829,  2307072090,  3220873986,  2040895386,   896431136, 
-  3000689045,   607350576,  3474273467,   942378634,  1685652835,  3243536993, 
-  2308018543,  1523540496,  3098998184,  2179859923,   412734267,  3135234298, 
-   354762532,   381401582,  3544339265,  2252591632,  3442003481,  3991318796, 
-  1570201979,  1222406518,   285706678,  2846309643,   422021488,  3769929854, 
-  2934601814,  1784390375,   604605620,  2586820364,  2629569186,  1141043567, 
-   663512034,  2675259672,   758834230,  3616594283,  2845649249,  3007664252, 
-  4047610601,  3186821766,  3764912817,  4291750268,   999163557,   732645995, 
-  3833367863,  3389205624,  4174655076,  1811188337,  4162987920,  1452073693, 
-  2995737293,  3903501021,   456100953,  1881557563,  3619723751,   120243083, 
-  2101709691,   360345844,  3494029104,  1456891547,  1276301157,  3398777948, 
-  2059372183,  1381871280,  4167501893,   196990457,    41369377,  3110289657, 
-   688817078,  1339216056,  3105015008,  1860093223,  3586290543,  1746187488, 
-  2049866190,  2662434034,   499113486,  1433680478,   625832305,   809046623, 
-  4072367827,   405122264,  3015605829,  2884234088,   132243990,  3918967257, 
-  4017152785,  3607515897,  4192543814,  4131853919,  3099608005,  3079492147, 
-  2740895927,   299398873,  2516564535,  3058475146,  1399260622,  1427103984, 
-   375751364,    88670078,  3808065963,  1825967987,  1549319398,  3919242893, 
-  2209470006,  1406998841,    53216699,  3292617321,  1666156799,  1222388480, 
-   997645765,  3615180679,  1316112103,  2482637140,  1372093452,  2930911923, 
-   780333828,   908782183,  3655851883,  1793773044,  1983609693,  2425410108, 
-   224390731,   906149331,  3831027467,  4086567009,  2492825837,  1195254074, 
-  1732391726,  3035215421,   328852928,  4072348476,  2119323292,   382325543, 
-   175521675,  2594032323,  2066648725,  3818524644,  4260664534,  2325088774, 
-   532016175,  4258243999,  1412028376,  1710976373,  1653526038,   234838198, 
-   551193676,  2619154968,   789545790,  4269872382,  2483105744,   458008730, 
-  4006101655,  4132336478,  1558726784,  1271069535,   169206745,   454320584, 
-  2892824187,  4266049879,  3948777080,  1437960469,  1344945933,   988362170, 
-  2606969996,    22805034,  2961450120,  1102205205,  3690232126,  2935925829, 
-  3827253509,  2959428206,  2107314787,   565538878,  1255225069,  3048771427, 
-  3595132731,   569917765,  2708442497,  2081733321,  2261210601,   922978201, 
-  2714001392,   112727529,  3647213885,  2042188797,  3185880568,   369768032, 
-   415894737,  3382666963,  2305422522,  1916374899,   971762338,  1455722682, 
-   239531489,  2956180600,  3564624774,  3431744360,   539797141,  3942764895, 
-  2002035402,  2771499719,  3706572816,  1366604498,   965611999,  2209704610, 
-  2260311639,  1606053330,  3061146053,  2325383419,  3812589902,  1507738433, 
-  2812874171,  3993092866,  2971740494,  1171490896,  2732930263,  1453086862, 
-  1359381508,  3935175939,  2491230746,  1976357600,  2695147003,  3723238041, 
-    19441057,  3181052456,  3055392446,   623036216,  3527252341,  2694271778, 
-  1841395599,  2150253708,  4267634428,   589798617,  2243177229,  2352874624, 
-   887679554,  1213812899,  1097722518,  1718648455,  3633426174,  3952662798, 
-  1036318169,  1421002333,  2189904822,  3384653696,   377007241,  3111872397, 
-  2599261531,    97283155,  1593274823,  1286459747,  2398980822,   156850116, 
-  1720959837,  1647534759,  4289719553,  4209699452,   459410611,  2564458229, 
-  3837740535,  1521159090,   408927695,   647539571,   709148937,  3968751209, 
-  3224831351,  3489706627,  2164502044,  2065384752,  2136593368,  1788496721, 
-  1192070671,  3632962946,  2360506949,  1914092445,  2162184568,   787596077, 
-  2425108647,   487634590,  2402942990,  1192568312,  1126277034,  3545172769, 
-   226638442,   996910790,  1032375333,  2423848494,  1957103187,  1097987715, 
-   901729664,  3683395460,   331916379,  2421022332,  2451316637,  3221052518, 
-  2324283389,  3980402648,   909451590,  3456420597,   566308252,  1902340646, 
-   615969000,  2771832708,  2328296470,  1806431044,  1415459767,  3918182707, 
-  4052911379,  3157432919,  1825327506,   680164867,   248414550,   160830205, 
-  1059084110,  1229348625,  3526992272,  3440207737,  2123592348,  1140874543, 
-  2797750810,  2576550862,  3495867551,   129796626,  2615821741,   279981651, 
-  2098429018,   524458992,  3292198578,   206144230,  3229703947,  2499244371, 
-  1747825435,  1679948675,  2073102181,  1959056653,  1918190536,  3263200568, 
-   146970391,  1674670440,  1016122068,  2185419207,   688089328,  3066953320, 
-  1367937554,  1876085200,  4171762752,  3493554696,  3069847652,  4046335846, 
-   520844525,  1895273834,  3542193846,   823555528,  2980302988,  4019288529, 
-  2998178507,  3172234914,  1477098041,  3578587411,  3025777981,   150201297, 
-  1661291088,  1162982937,  1637913057,  2982053901,  4243689464,   456770151, 
-  3255648162,   986614143,  1089772993,  3795431309,  2044081907,  4207186261, 
-  3086952909,  1569332466,  3169815670,  3100275214,  3797570151,  3442621947, 
-  1552736556,  1863460449,  1437084759,  2032978763,  2239677225,  3604247601, 
-  3431582949,  3597845197,   774762778,  2334678352,   840913938,  1569425503, 
-   523018754,  1734195174,  1508156564,  3381507805,  1900364049,  1159618553, 
-   215718454,  3854307929,  2334483907,   194755556,   462053974,  2265431284, 
-   597275848,  1043464649,  3540507521,  1910271126,   993705870,  2605715060, 
-   631841639,  4071891103,   604990303,  3850140575,  1422599299,  1745432209, 
-  2355323195,  2484973764,  4125623561,  4051361193,  3234947283,  3593575506, 
-  3075287347,  3382171307,  1961405186,  1556108939,  2581446533,  4059057398, 
-  3883583698,  2787530639,  3122333247,  2741980732,  2165604692,   646339560, 
-  3966251155,   851317929,   993859047,   573590697,  3816376725,  4067211386, 
-  2610413257,  3570396023,   841185081,  2010877727,  3526806391,  4214235326, 
-   430003436,  3927889716,  4092607332,   250332455,  2747769194,  1995760412, 
-  4004384523,  2027139014,  3994516626,  1905396902,  2340624242,  1845513053, 
-  2776739518,  2604122827,  3983038365,   978256450,  4281283034,  2985436777, 
-  3451893752,   341679529,   110413624,    61417024,    81161927,  1450010958, 
-  3371171427,  3875924227,   663459451,  3158456520,  1844035116,  3514368491, 
-   765519491,    90406964,  3883234706,  4008161480,   339210539,  1631252192, 
-  2709925155,   693767897,  3282662224,  1388639618,  1320557009,   707863736, 
-  2857219003,  3273236629,  4287190998,  3185519270,   798865859,  2030332119, 
-  3907191082,  3503682581,   509870447,   557229396,  3416735337,  1473909066, 
-  3865909487,  4035481713,  2465031637,  1835256311,  1744823928,   159801523, 
-  1702721573,  3313413180,  3531266080,  3922801285,  1776115133,  2867154470, 
-  2103478132,  1236647437,  1765283307,  1266489395,  2722195814,   497218113, 
-   174517246,  2814908030,   888845120,   884919195,  2280848620,  3340501857, 
-  3484959538,   972583283,   204134582,   752735171,   468503134,  4158520466, 
-  4060267185,  4130204835,   848010871,  2693737437,  1828790349,  1134152794, 
-  3388392037,  1456324634,  3303461390,  2385789065,  1032722223,  2735739412, 
-  1203433202,  2000658706,   592015207,  1431489972,  2568907904,  1760163904, 
-  1492422071,  3857541410,  3777880045,  3093085151,   399925961,    96469405, 
-  1034887930,  2759194370,  1787104763,   513673623,  1613187598,   254936249, 
-  2618354976,   547809853,  4204056249,  3693104220,  3504381994,  2831436473, 
-    96597203,   115935429,  4074800889,   862093621,  1014938608,  3804611265, 
-   252469397,  3926882287,  3546816711,  1468336583,  2009444779,  3180032121, 
-  1029051394,  2494840565,  3299298569,  1005140694,   880499444,  4144740768, 
-  1151616738,   482441718,  2732220421,  1449067430,   146513841,  2065829258, 
-  1268655498,   392805478,   706313179,   177451975,  4043455551,  3473965499, 
-  1547068548,  2044799461,  2467220285,  4048941574,   185223972,  2218974081, 
-  1897045846,  2969407049,  2877661482,  3034874792,  2677910051,  1191420074, 
-  4278246830,  1603638499,  1974143135,  1915809085,  1933427111,  2270476332, 
-  3550027763,  1514045532,  1197604536,  2450158037,   335048344,  2273568814, 
-   717671560,  3022205005,  3591939652,  4286284267,  1704499688,  2891275904, 
-  2865027425,  3732113028,   843980930,  4149956098,    48734080,  2060375441, 
-  4128672356,  1028449721,  1454008962,  2971302374,  2191930586,  3003183700, 
-  1857885302,  1106023273,  3122055454,  3575446214,  1944736699,  2372449352, 
-  3575701843,  2446899093,  1031359921,  2846577537,  3461638684,    65219914, 
-  2016800348,  3446802271,  1787477793,  1911655672,  1058576660,  3258073924, 
-  2368730075,  3377892742,  2445813949,  3000434750,  1545333535,   282371052, 
-   400870596,   914449289,   842574592,  1678308818,   591512621,   928691462, 
-  1968000488,  4165300640,  1345335354,  1656560486,   835518118,  1781343518, 
-   481615375,   653668181,  2384997529,  1952422485,  2926734468,  2511187105, 
-   442631342,  2948564224,  2862384923,  2748420885,  3423694810,  2435246481, 
-  3926037395,  4220035382,  4143670493,  4256208585,  3936607653,  1986961273, 
-  2474020087,  3240601925,  4147163836,  3211373256,   677536109,  2380625689, 
-  3045914678,  3571509677,   680495893,  1027388512,    79291194,   139653507, 
-  1998188537,  1093937281,  3655107330,   856936721,  2693044819,  1204964681, 
-   339546720,   547066662,  2824017099,  1727967858,   291782288,  3043233409, 
-  3764037623,  4100257097,  4026981119,  1098389688,  1282447024,  2975137286, 
-  3809291573,  2589182731,  4133714152,   374069589,  1719299400,  4272410971, 
-  3460982520,  3712631620,  1685549493,   356359681,  2046322098,  1534714489, 
-  2628892730,  4065543510,  2035154617,  2269701028,  3454259021,  2790460553, 
-  2888604421,  3041284550,  2805363566,  1427843162,  3164249904,  1380885022, 
-  1022952503,  1213491063,  4119890047,  1600842347,  1380260081,  3442358983, 
-   280208579,  3464972468,  3867216077,  2938767599,  2082887834,  3980068864, 
-   482683331,   993087638,   183924741,  3736774473,  3566704865,  1420843651, 
-  1475198793,   454023038,  1482930972,  2883061746,  3344885012,  2617441405, 
-  3762278716,  4100103179,  3008834949,  3526245673,  2814709499,   469727333, 
-   155374651,  2558331448,  3814375778,  3927848687,  1084490880,  1555338120, 
-  2356061864,  3311546994,  2598878142,  3363447287,  1703101234,  3380337029, 
-  1222623725,  1458042381,  3581949955,   917225395,    96647823,   735263429, 
-  4270010676,  1679715909,  3572344381,  2364209803,  1596466315,  1683178719, 
-  1525141054,   658550394,   266032988,   212056330,  3433010580,  3177257727, 
-  3507764756,  2622899686,   264318059,  4053164876,  1671159436,  1710228570, 
-  3072884217,  4025935471,  3299405645,   418439401,   923922731,   810109373, 
-  1762683000,  3131506612,  1301510708,  1382295474,  2209255722,  2107027731, 
-    55207412,   986629658,  1013574708,  2894506056,  1418526744,  3708365694, 
-   460769466,  3439381825,   829350656,  1765310038,  2554009698,  2110488176, 
-  1731963341,  3732914459,   437270047,  2217539414,  2006659839,  2840411505, 
-  3413510838,  4019760697,   691459340,  2697358479,  2723509304,  3333705618, 
-  2689847613,  3084492531,  1483525736,  3085095710,  3897189930,  2475157971, 
-   920315545,  3872891220,  1562294601,  2100598038,  1898498096,  1635971653, 
-   124287625,   924708375,   499106954,  3519580831,  3439059487,  2089064656, 
-   861928611,  2985777343,  1715574021,  3824538434,  3121964376,   662616022, 
-  4166605906,  1213568619,   130400995,  3817611833,  1432030001,  1625018228, 
-  2309564582,  3824148991,  4110452211,  2968937403,  1436864987,  2818180022, 
-    53277469,  2050746366,  1190684105,  3620392621,  1174021157,  1297564239, 
-   259544375,  2495362455,  2292109159,  2420770768,  1452196454,  2251095118, 
-  3147621759,  2579260647,  1590135123,  1960508176,  4253474356,  1973252318, 
-  1353535813,  2577102344,  2595508638,  3703377944,  1760012535,  3081329726, 
-    45613269,  4061601437,  2153887707,  2300040992,   305240884,  2843207081, 
-    13170902,  1352363430,  3873489534,  1039224850,   970959573,   789153660, 
-   898500619,  2133759154,  1027572670,  2650039662,  1910797168,  3834389967, 
-   740365115,  2253537525,   245927719,   832344915,   266872903,  4288466966, 
-  1685052152,    56984267,  2269823543,  2821256539,  2315558218,  1718926869, 
-  1669394732,   935092351,  2429959990,   159381272,   937399832,  1932708422, 
-  2107137972,  1272873950,  1398801715,  1262487425,   740067435,   643760173, 
-  2550480027,  2609979401,  4119874049,  3053021395,  1021289445,  1375651143, 
-   569617913,  3141969398,   602111983,   712431250,  3140012235,  1428678896, 
-  1196175203,   571352285,   209171595,   301272739,  2187074915,   976036732, 
-  1402653976,  1950229651,  2192090853,  3975844156,  1320418474,  2409719473, 
-   805826623,   183935820,  2572316016,    52294047,  2240346752,   429875449, 
-  1857967218,   809875783,  2022474004,   293885463,  1300218327,  2801978291, 
-  4250326370,  2679794481,  2307603448,  2350889968,  1776367687,  2533713127, 
-   703768985,  3412541752,  1947484822,  4135249844,  1999135803,  1347345410, 
-  1804587745,  1870461371,  2898173619,  1790259354,  2810369689,  3019601491, 
-  1117351793,  2453115649,  3102867149,  3035898369,  2115947691,  1990115495, 
-   188316725,   908406105,  1302399975,  1272150459,    78386715,  2674052101, 
-  3231728036,  1268615984,   507536297,  1231483549,  2399851283,  2447769897, 
-  2711685840,  3240739382,  3663742827,  3001819987,  1520934352,  2282130483, 
-  1629480777,   222896208,  1871153374,   240174557,  4123235415,   949261981, 
-  3921755394,    59912809,  1849144305,  1642839474,  3854516285,  3500996304, 
-   912069179,  3740857494,  1197675000,  2447206670,  1223416237,  3424779063, 
-  3626403725,  3027194517,  3358410740,  2633027649,  1483536397,  2653964927, 
-  4065791251,   757745128,  3807114398,  3177069139,  2757763240,  3053293193, 
-   980821668,   479529118,  3183348499,  3592331249,  2166032144,  1340549251, 
-  2695296174,  2095267924,  4226326019,  2555852746,  1884062548,  3837645636, 
-  3811962369,  3489283991,   430217342,   922427569,   945684031,   913561568, 
-  2259964795,   339680350,  3255183293,  3148793277,  2715407180,  3604818524, 
-  2106957037,  2853964863,  4286378936,  3874678862,  2614915151,  3594724141, 
-  4098087505,  3521897929,   358965236,  2614341579,  2058081142,  1896240080, 
-  1603012900,  2505519949,  1989873337,  1991155884,  3980540891,  3173985019, 
-  2887340556,  3458303670,  2966950183,  1564518179,   590356968,  4265424224, 
-  3337685334,  2979226718,  2921380395,  2215406220,   758019991,   132264141, 
-  2539743722,  2228917896,  2009317274,  2747217902,  1437061773,  2072998246, 
-  3388832746,  2670979988,  1741473899,   163312994,  4180727808,  3924505267, 
-   126894862,   587396352,  3204858128,  2308638216,  2605472449,   952743754, 
-   863348361,  3339491891,  3295383006,  3296389500,  1394755600,  4215712310, 
-  1370605136,  1776238083,   258509350,  3309773228,  4085866992,  4027226619, 
-  2530898215,  2998217076,  2133534659,  1827132570,  4158274627,  3929104235, 
-  3921547100,  1650741805,  2209126124,  2222090438,  3284426794,   486659938, 
-  2141119088,  2361075083,   844982340,    45033792,  1762222371,   826544289, 
-  3209654076,   576171966,  3943660616,   143073079,  2928706025,    91365404, 
-  1750410264,   411393976,  3750573181,  4052554995,     4810686,  3812608354, 
-  1716989510,  1243973587,  2396087356,  1298732366,  4094249212,    64237519, 
-  1418493709,  2590338890,   400259683,  2393927150,  2940707361,  1160893245, 
-   915831788,  1194599191,  3033192379,  1027187163,  2713521321,   506497264, 
-  1548755803,  3613477944,  3579616040,  2727939905,  3082990798,  3918185518, 
-  3269716878,  2995827510,  1544049085,  3317561825,  2726824137,  4121808011, 
-   170744258,   122999768,  3888476012,  2600136064,  3526515722,  3204719217, 
-  1786394275,   798519663,  3128648388,  3458096950,  2104661436,   325412361, 
-  4283815304,  1666215302,  1824628686,    60100886,  3817040421,  3150410357, 
-  2603045593,  3848598084,  2867124929,   955564124,  2725228055,   759200657, 
-   538955518,  1491441689,  4241286260,   404307021,  2266837694,  2966437059, 
-  2345553770,  3955983118,  4072924114,  4219686151,   793988516,  2149901310, 
-  3285119841,   978085287,  2437418509,   698553072,  4265075641,   401195678, 
-   419356222,  3692808772,  2356099170,  4054270021,   802565345,  1539581088, 
-  2827646767,   587161146,  2472359027,  1631441228,   116664365,  3228388920, 
-  1778582143,   842200902,  3222199130,  1355242706,  1836170391,  3934246235, 
-  1106268458,  2417203817,  1836996572,  2765607616,  4190921629,  1498774480, 
-  4085778530,  3832471521,  3135038113,  2327628763,  3534722178,   742195806, 
-  2595973625,  3496541488,  2187803792,   728989702,  3925703759,    61606223, 
-   913656298,   585717211,  2883804960,  3735478284,  1250309879,  1144932009, 
-  2112526302,   357991456,  2889766155,  4179942762,  2625137844,   856878387, 
-  1491129423,  1976481785,   204841525,   205505136,  2096854621,  3853885651, 
-  3537912002,  1731144308,   104686169,  1719578938,  2167489412,  1805535806, 
-  2341193677,     8040761,   125290982,  2133819331,  1595409352,  3311983283, 
-  3266916695,  3587688705,  2939123499,  3571809967,  3340842405,   783600735, 
-  1889539332,   201767142,   528550293,  2258781927,  1969410485,  1327767609, 
-  1201675226,  1470829021,   741977235,  3567955795,  1201035276,   931222877, 
-  2164372833,   471916236,  4280905351,  2689204816,   334516392,  1363228581, 
-  2764811417,  2141561105,  2986541687,  1685714842,  1057462293,  3852143459, 
-  1336241185,   885653384,   660518496,  1561715588,  1300624555,  2148512109, 
-   752808441,  2177978375,  3306138292,  2010678661,  2919755958,  2618615223, 
-  4048081921,  3484009500,  1949064959,  1932583407,  3634728800,  2787358029, 
-  1984443821,  2050454418,  2807341789,  3573119766,  1508387008,  3078273723, 
-  3580644807,  3802081916,  3683230747,  2991397192,  1130205106,  3375075242, 
-  1208071309,  3300208080,  3800161277,  1478086925,   594488422,   416031362, 
-   490597718,   567003390,  2129073898,  3107470682,  1400055560,  2637846281, 
-   842549354,  1155051093,  2387048682,  2264394291,  3182400971,  2086926238, 
-  1227127400,  2907131449,  3680276913,  3096770496,  1832838218,  1036567153, 
-  4271164504,  3584807650,  1549531000,  1993324354,  1308268291,  1220746574, 
-  4207490525,  1446990099,  1318764264,  3698110890,  4139889328,  1081530696, 
-  3565814519,    37405859,  1342659998,  4137932617,  1406637334,  2578059597, 
-  3889089146,  2405310616,  1388071780,  1681074497,   541341833,   359514206, 
-   548493341,   169469761,  1767556968,  3634348953,    41993355,     8958559, 
-  2802113419,  4262788370,  2699317081,  2464418624,  4164879276,  2012183035, 
-  3228930236,  1665405565,  1258997729,   525196411,  2254099620,  3136698228, 
-  4253121568,  1464625822,  2285651864,  1153237097,  3418315374,  2913762488, 
-  2490882856,  1872015471,   400398539,  2021023813,  3000022741,  4224419523, 
-  2194300857,  3775832855,  1899556692,  1944957304,  1468238875,   672153511, 
-   672046322,   820582712,   264391574,   486260480,  3045152135,   763399660, 
-  2184576903,  1095034838,  1440531834,  1086260714,     7286182,  2473286756, 
-   220792801,  3055447631,   777385751,  1485574812,  2798920600,  4112518633, 
-  1569753459,  2606380909,   877018317,  3189589658,  1992596265,  3000892830, 
-  3629339019,  2127026291,   927706505,  3680936715,   719545368,  2111006163, 
-   193261752,  1937936386,   197188517,  3582557720,  3444940256,  3931420109, 
-  2453159923,  4269489256,  2770620361,   839983522,  4097838884,  3561777176, 
-  2392544407,  4181487087,  4019834438,  3266547286,  2175815234,  2117564740, 
-  1454423071,  1362099891,  1851051779,  2339436756,  3999739588,  1996481714, 
-  3945616759,  2014265589,  1098188816,  4159935748,   303752084,  1053462228, 
-   341540682,  3044464623,  4131623313,  3154509399,  2052584631,   718584169, 
-  2038886378,   342479659,  1182194875,  2112149134,  1723234457,  1340278217, 
-   335138650,  3998496137,   236783676,   221236008,  4079724732,   666789920, 
-  3517536000,   210304739,  4135370021,  3724537939,  1428709507,   818829823, 
-    80841250,  2290074301,  2385230050,  2336802711,   309871424,  2803341757, 
-  3089988559,  2675485217,  1575517685,  3710832975,  3202453218,  4233612613, 
-  1557506247,  4038525057,  1793219782,   226755336,  1368211140,   754628752, 
-    42168946,  2099016495,  1357662273,   626649190,  2057773384,   586725654, 
-  1452596134,  2943577138,  2743242467,   895053662,  3315430256,   792897896, 
-  2437236464,   366803881,   164225963,  3901274436,  3533452290,  1546872283, 
-  2538215319,   998134952,  3766105651,  3988608000,  1825673735,   100899709, 
-  4293813903,  1024453508,  2710589630,  1495918098,   190044641,   979892295, 
-   669139007,  3684983560,  3973553771,  2868228670,  3016324650,  4162636606, 
-  3662877890,  1766888794,  2655168170,   909934369,   204117075,  3097768254, 
-  3662892717,  2383298264,   125331424,  1198454997,  1659764294,  3417351342, 
-   618536139,  4247301859,  3488431321,   975423834,  1479014101,  2038999225, 
-   687801559,  2477245684,  2065646271,  2520538098,  3302823581,   852005760, 
-   905255898,    26877071,  2025649746,  2112891599,  3413236442,  3895635549, 
-   774390665,  3680975248,  1554450909,  3896618160,  3011411288,   408325973, 
-  3069902588,  3665343469,  2457949664,  3823835356,  3988762647,  2525158839, 
-    70956312,  3705342095,  3190355829,   777818523,  4271006387,   647973508, 
-  1313495673,   632375193,  1826436405,  1374190271,  3535484591,  4235241203, 
-   443485961,  2899888467,  1655132707,   657132163,  3053887839,  1509608723, 
-   924836440,  3764052598,  2125406462,  2650223574,   206983545,  1088756684, 
-  3680421100,  2719841777,   711108040,   301407494,  1265409427,  3367801378, 
-   799312102,  1508576427,  1144617016,   904415856,   214264502,   670860700, 
-  4207344021,  1633492082,  2190527467,   209420943,   402510252,  2832186742, 
-  3568028178,   788003568,  1245589707,  1907656666,  3098134788,  2312931987, 
-  3599384675,   895576675,  4285744318,  2115905609,  1790758469,  3646747890, 
-   301235444,  3866727950,  2688482580,  4207026792,  4101799802,  2371744032, 
-   259086409,  3693940131,  4151228693,  3959627149,  3437494300,  3975706634, 
-  2839429924,  1823402723,  3423265595,  1056225553,   961286311,   836885510, 
-  2117097429,  1382487478,  1120747837,  2836712118,  2440209921,  2013863408, 
-  1134659126,   816325893,  1559743535,   463907373,   663316292,  3793680287, 
-  3692066337,  2793230959,  4198297952,  4044029740,   695318325,  1848528970, 
-  4160320017,  2851319138,   560449290,  2985051850,  1217520232,  2886219097, 
-  4065037191,  4096297085,   126592509,  1882412498,  2071354840,  1970377376, 
-  3873027769,  2578067961,  2639417140,  3432685125,  2037805466,  3413879797, 
-  4220265305,  3348317323,  3151133583,  2706411106,   801810366,  1285771380, 
-  2749601016,   335663763,   545364835,   833856179,   716857454,  3216016393, 
-   718887888,  1072983414,   870381890,  3161181190,  3976603151,  1956228564, 
-  2964858801,  3380762279,  1206731251,  4143865064,   552056672,   459051192, 
-   366900116,    75634513,   588019354,  2379590462,  1753812071,   482084766, 
-   386211099,  3713902130,   792273695,   874158135,  1854240145,  2650815831, 
-  2054822600,  3904416398,  2140018275,  1000519663,   881117828,  2238656145, 
-  2612770866,  1225290197,  3088526307,   933459653,  3472274959,  2776290834, 
-  2022714530,  1896135065,  3769055279,  2454834725,  1452571079,  3880603426, 
-  3638337222,  3243510637,   739316519,   909083000,   734964160,  3793734958, 
-  2491911246,  2347837334,  3704097999,  3533586623,  3556053494,   819329607, 
-  2143103893,   152932167,   473989616,   527585409,   526430141,  2061345668, 
-  3202727548,  1756570413,   679136752,  2603754615,  3863142794,  2683474662, 
-  3940245782,  3479508524,   575090152,  1440616260,  4226268927,  3566389959, 
-  1392733994,  1385146392,  3200158079,  3817289090,  4057306129,  3273250234, 
-  3916516281,   613574737,  2443670180,  1151502533,  1988810425,   155453358, 
-  1982988420,  1080074901,   968723726,  2008812289,  3360633744,  1146831236, 
-  2316578745,  1799862296,  3613126107,  3567498513,  2712136397,  1733971179, 
-    76663369,  3006626271,  3850093345,   460604696,  1855142155,   529261557, 
-  1996556284,  2072997810,  4186688907,  1351133266,  1814792319,  1177139001, 
-  2125379217,  2029708318,  2864225687,   650607046,   274878679,  3069906495, 
-  3351770935,  2497821508,  4153354304,   679697685,  3960356966,   806767248, 
-   328275939,  4043309408,  2139479233,   913605882,  1693238811,  2683234253, 
-   380077906,  1328178088,    11606151,  2800482042,  1843301390,  3925503590, 
-  2618561243,   226120259,  3457819092,  3615977369,  1202142717,  1705039221, 
-  4030097477,  3210652147,  1892930308,  1916375784,  3440899958,  2966392172, 
-  3620514038,  1550579228,  3041900106,   170383556,  2340063251,   907922599, 
-   342331034,   721896856,    49489263,  1527262159,  1683589584,  4072820963, 
-  3634418905,  3115483114,  3717354509,  3748911941,  1796294008,   152541531, 
-  3750452105,  2581846506,  2072260273,    33869140,  1174907909,   597713778, 
-  1140624162,  2366089057,  1212969052,  3994457001,  2926284005,  2201992238, 
-  2710153095,  3308966806,  3862486221,   657572409,  2469838038,   964983877, 
-  1025288875,  3845649407,  2004678764,  1891851531,   455205008,  1082108689, 
-   253887316,  2415871445,  2535095644,   443125686,  2138319878,   192138499, 
-  1019852901,  3567211075,  2218760129,  1686112565,  1215446710,  1372583128, 
-   275635795,  2525796717,  3357334668,  1334571285,  1606242654,  2048010768, 
-  3738308504,   212746549,   853589850,  1232168251,   987865447,  2672697680, 
-    18232095,   729561267,  1746889182,  1816525473,   536898351,  3990216981, 
-  2025808804,   575240417,  2941565985,   436656809,  1251600019,  3504284350, 
-   221795598,  1430590601,    32668395,  2237734419,  3150860496,  2286918144, 
-   173084365,  3003153596,  1764525642,  2804758294,  3445052269,  3258770616, 
-   875506370,   361180796,  4024641362,  2902171621,  4203523326,  1763622838, 
-  2053041216,   330471618,  1446024502,  3411931835,  1068273930,  3524430250, 
-  2969651630,  3981945698,  1380182238,  3503548794,   451428015,  1371476558, 
-  3135341649,  3689534504,   724929318,  1925197828,  2954226488,     2659962, 
-   828848754,  2424147921,     4157349,  2948836916,  3034493100,  1114276668, 
-  1397088472,   350692162,     3926047,  3257645132,  2302645930,  4224998125, 
-   252555652,  1300165905,  1724886312,  3692826907,  1460437471,  3903941668, 
-  3899639446,   329291111,  2284041738,  2369173843,  2398407564,  3592128991, 
-  3911760323,    67404161,  2703385757,   405197951,   355745561,   934213039, 
-   339406964,  3919218018,   452781237,  2217131507,  4047987121,   192337036, 
-  2141273417,  1182317733,   211129007,   617546987,  4243939530,  3631681660, 
-    35415814,   668069683,  2731793510,  3117145487,  2167020187,  1037117336, 
-   674861329,  4285936971,   338248962,  3885635135,   766323643,  2283389594, 
-   138295915,  4100488513,  1539171013,  1191862364,  2969269347,   846654610, 
-  3414917819,  3125357083,   426896464,  1319326733,  3144437607,  2237643079, 
-  3916233621,  1316686135,  3567000364,  1376637793,  4064896238,  1487622375, 
-  3396501263,  2702246970,   517420869,  1982160101,  1911576239,  3040512731, 
-   975916361,  3840375836,  1377635861,   327976008,  1519799713,  3796911237, 
-  2667885453,   952833842,  3973401078,  2321614175,  3927613410,  1882773529, 
-  1858388566,  3473161415,  3878435469,  1941871412,    81437505,   278073407, 
-    44607612,  3585127385,  2286785599,  1886785267,   137087961,  1312413515, 
-     2853552,  4226575141,  2979917656,  2317044457,  1156462950,  2088949409, 
-  2291169357,  1194583012,  2398179939,  2232603151,   838198405,   876041396, 
-  3730214556,  1206987976,  3907608341,  4206671908,  2844820458,  2787086158, 
-  3257973679,    75931331,  3480413505,  3292621230,  3390987037,  2046625271, 
-  3014960136,  3598182239,   157240612,  3828626184,  2480449890,   218383527, 
-  2767715168,  4222411133,  2398772484,  3228404615,  1700927124,  3750609595, 
-  3921044119,  1023739032,   235449781,  3827931787,  3687984289,  3265994925, 
-  2949785917,   736829015,  3971922352,   247039178,   781168969,  4272501799, 
-    49619975,   542562335,  3440470607,   770770984,  1385616801,  1682159693, 
-  2438924802,  1356910355,  4205189097,   368016018,  3246845157,  2708413187, 
-  4082746617,  3489083555,  1048521898,   399496371,  2905414448,  1044426862, 
-  3686266046,  2655063472,  3794015862,  1616841653,  1522666056,   965303896, 
-  3041512368,   251088762,  1407818751,  4215298264,   236571642,  1775698649, 
-  3187573443,  3435426300,   138116255,  1436074100,   592366168,  2376300388, 
-   937497413,   528067409,  3638590080,  1698640842,  3989536545,   273487526, 
-  4152974794,  1223526522,  3848565958,   941356982,   487383062,  3813812115, 
-  3620043186,   606418829,  3927649897,  2045107014,  2927934814,   575242136, 
-  2021610455,  2888107390,   700884438,  2914318811,  2927380424,  2340497050, 
-   902187914,  1685143151,  1018470890,  3909016524,  3865650465,  1330771892, 
-  3587238159,   469485679,  3570895804,  2816339128,  1849808056,  1937454165, 
-  3953605274,  1079756443,  3654286954,  3932997106,  3509745013,  2826995467, 
-   463172901,  1329750417,  1438196059,  1584025653,  3838438430,  3835974245, 
-   742483575,  2159619872,  2022353159,  2034040494,   559391514,  1771770002, 
-  4071607449,   742024992,  3561031948,   206205801,  4222611337,  1650393411, 
-   790754142,   881698008,  3729424078,  1726979975,   532715111,  3206323947, 
-   912873123,  1565639663,  3752027491,  1039517658,  1961639064,  1883601778, 
-  1595966717,   340457380,  2798747289,  1674216059,   223238043,  2736647447, 
-  2567944628,  2661175267,  3615121012,  1147427951,   305360962,  3658335365, 
-  1731319553,  4074230034,  1600830035,  1155485058,  2955326229,  1957884631, 
-    34751419,  1410920034,  1266942305,  3229881786,  2255268652,  4001829083, 
-  1717356663,  3976635052,  3079829246,   560502686,   378379866,  4026625586, 
-  3791740801,   135928162,   208157951,  3229228999,  2780634559,  2799364795, 
-   560014396,   805640432,  3808468326,  2912139136,  2597870226,  2644698509, 
-   154419489,  3631616243,   565787138,  1009688330,  2003544513,  3949029015, 
-  2459638342,  2412512917,  4123086753,  2449476848,  2951034268,   459205217, 
-  1666652192,  3305640495,  2350375059,  2177771930,   175308270,  2442627874, 
-  1631862755,  1385929004,  1701719093,  2313771159,  1582910630,   308437136, 
-   309785861,  1676956909,   841870518,  2376716536,  1029027167,  2770599432, 
-  1600139901,  1688259906,  3442470989,   753443931,  2765425774,  4222432273, 
-  2864110312,  3412349106,  2332098414,   161812316,  3016815172,  1155563458, 
-  1475919033,   924914560,  1190795037,   880648498,  2714732168,  3575556783, 
-  1003310617,  2624651928,  1248296494,  2462169781,  1130938382,  4064038369, 
-  3923404447,   109193687,   506847966,  2666045981,   605447073,  2845543293, 
-  1684831353,   554147335,  1482590741,  1575774860,  3005600962,  1896112692, 
-  1233635589,  3113732664,  1291156930,  2492202062,   328275196,   448558622, 
-  1611392975,  3716363718,  3647206067,  2516205329,  1115125161,  1306154206, 
-  1674766264,  1725902475,  3122413824,  3924230673,  4106667633,   239889606, 
-   922499099,   476631254,  1221800623,    46144663,  3043651908,   143483096, 
-  1012566938,  3154961143,  3862149103,  4135099068,  1509201486,  1564090132, 
-  3465586898,   948951685,  3672185918,  3325449927,   973873633,  1049023334, 
-  3257421309,  2877780256,   813467566,  3501858764,  1997576745,  3590229374, 
-  3202929731,    80945692,   934103812,  3549909826,   726380441,  4273373728, 
-  4164353471,  3987157340,  3174868759,  1611943000,  3177386263,  3629674761, 
-  4183816795,  2902019293,  2365716110,   225863782,  1072847558,   493198979, 
-  1108896285,  4161876278,  3700749919,   685927902,  4000928258,  2898961112, 
-  2217785531,  3358269745,  4087462560,  3473059221,  4072201498,   223221415, 
-  1823394872,  3408714485,  3561405145,  3537138294,  1895326527,  1764093956, 
-  2224859942,  3660717568,  1196779658,  2436066745,  2380203953,  3342255421, 
-  2650742718,   257641768,  2734590084,   108075738,  2268433146,  3681142132, 
-   102576228,  1108797758,   249176619,  1534366276,   127742036,  2920315406, 
-  3157034688,  1720319517,  1134868518,  1362302192,  2684160176,  2493400373, 
-   800856361,   227972987,  2639093017,  1308866544,  2646508225,  1878578816, 
-  3100388318,  4082349401,   840959324,  2140123682,   626481926,  3309761643, 
-   156541266,  3646055642,  1161875321,   350931820,  3490675653,  3666546423, 
-   940812704,  4035431889,    47634163,  4275504712,  3443164610,  2807205828, 
-  1575072231,  4251049666,    30738011,   418516832,  2477568739,  2113489502, 
-  2853684078,  1322424102,  3100800041,  2325020940,  3326612985,  2597816481, 
-   150315423,  2573652172,  4204879551,  3583317422,   532282930,    54758504, 
-  2444191708,   950388981,  4160516285,  3296559506,   328581901,  2422061478, 
-   602623686,  2459729349,   530355197,  2042166092,  2014948925,  1888087790, 
-   173912029,   599877029,   503617183,  3953976703,  1007577791,   137034535, 
-   363309198,  1780232716,  3104543303,   667164308,  2378827100,  3721305488, 
-   355704322,  1852227058,   211484828,  3063551463,   732275239,  3096605917, 
-  4024621720,    13148195,   559189871,  3625972133,  2030679412,  3036822756, 
-   676562518,  4108672120,  2473047524,  2869935522,  3119887762,  4024469143, 
-  1356245534,  3857201075,  2090778396,  3614911045,  3366842023,  1665304285, 
-  3795981823,  1843728358,    50147585,   439131218,  3075726984,  2331959339, 
-  1825760219,  1661109469,  3816202640,  3886622211,  2645671458,  1084141374, 
-  2104572893,     2108065,  3213556248,  1181023784,  3109059677,  1166014137, 
-  2768315224,  3030192676,   534594904,  2144305967,  1003648204,   805075833, 
-   119945766,   906615824,  1371794667,   632776562,  3519468133,  3875004474, 
-   400665610,  1338113099,  3841628278,   684804488,  2295120188,  2168165476, 
-  1002871376,  3621425570,   990654593,  4240495814,  1415249048,  1410978155, 
-  3222595828,  2825045243,  2839371305,  2102078890,  2449367310,  3858204372, 
-   658705093,   906520540,  3953213772,  4203764777,  3194789004,  2064553893, 
-  2731707083,  3717776587,    23291848,  3089108901,  4058490881,  3909486350, 
-  2209794736,   467413584,  2494188640,   827968109,  1792755572,    53017533, 
-  1503922735,  4002893522,  2736680139,  4158140889,  1467482043,  4072006136, 
-  2392431891,   601953659,  3219154291,  3234858607,   790085427,   881336232, 
-  1443030683,  2114279284,  3006488008,  3113049819,  3954289894,  2564578536, 
-  1891688773,  3541837675,   868284835,  3727515342,  2338525064,  1382987991, 
-  3645206542,  2850049707,  2162839056,  3477142351,  3231919287,   405324806, 
-  3865070607,  1373576366,  3721834833,  1098065121,  1020009566,  3751271029, 
-  1831925035,  1151098489,  1181355311,  2304497855,  3996726109,  1578923925, 
-  3202821966,  3536901373,  1939729315,  3324876703,  2644202320,  3693427589, 
-  2864803986,  1449697071,   142357883,   184549756,  4191840590,  1495747550, 
-  2045388189,  3813386015,  2520796217,   489633824,   283362474,  4194353512, 
-   648785024,   522913844,   218500359,  1118892781,  2819272478,  2675064011, 
-  2606218301,   714964995,   780873730,  1321127762,  3410220371,   649654997, 
-  1085818775,  2289046968,   247021102,   121902909,  3671082761,   125220851, 
-  3158488526,  3332646984,  3123854412,  1522613692,   411521428,   890828270, 
-  1364319580,  4158242633,  4020086157,   586051057,   267499049,   265264851, 
-   776559096,   487417945,  2202852468,  3965731804,  3655571583,  2560757716, 
-  2816625301,   328738270,  3539345648,   492804286,  1395294106,  2736335470, 
-  2347030228,  3592929293,  3851375440,   648354798,   263217503,  2094945735, 
-   454402678,  3022482640,   169177069,  4014922399,  1606563699,   348034103, 
-  1631983834,   110594450,  3165399533,  2899716659,  1361226788,  3713828591, 
-  3753064148,   969704937,  4235496753,  3315245987,  1769567896,  1939890175, 
-  3297876753,  2691571272,  1149989297,  1151778625,  2824277537,   566466247, 
-  1580578023,   359456496,  3947795462,  2697837182,  4202709077,   398641125, 
-  3514976051,  3686609235,  4208386679,  2247401617,  2404432024,  1484441808, 
-   826332205,  2484170681,  4008106981,  3550851736,  1869181983,   466639668, 
-  2959249833,  1771825634,  1992815844,  1269335639,  1541667548,  2690256720, 
-  3835627970,  2464431299,  3671133951,  2535128315,  3027871134,  3840851596, 
-  2268166279,  4196349333,  3321662490,  2412317124,  3282771855,  1187053338, 
-   851576463,   727197958,  3295014790,  3101413878,  3840690368,  4213730423, 
-  2607267773,  2768039874,  2841565523,  2631539519,  3770130282,  2187405747, 
-  3948048986,   299195410,   150448660,  3447416400,  1700896422,   522354199, 
-  2338153357,  3875050103,  3970082531,  1992112530,  2552880842,  3655493552, 
-  1364171534,  3740469841,  4036142692,   960577659,   332446673,  2462424049, 
-    39826459,   414961065,   881211723,  1671262655,  1444286980,  2823657914, 
-  2689807133,  3763504446,  2884563578,  2371569627,  4239518145,  2669477411, 
-  1088911116,  1748464538,  2406087507,   404736873,  1412766446,  1271114228, 
-  2715252723,   614671152,  2256405951,  1642580042,  1280235855,  2013237271, 
-  4291244582,  2065513548,   357414554,    72314537,  1521797880,  4229590039, 
-   289822629,  1858524550,  2551362642,  3929910986,   591021101,   725096589, 
-  2228602338,  1501601277,  1801209803,   817139561,   542617767,  3869120651, 
-  2106520587,  3579649456,  4043194553,  3065776160,  3770637800,  3115860146, 
-  3555375906,  3954514282,  1339740583,  2373635792,  1857829930,  3447892220, 
-  2744594126,  1702680151,  2436317263,  1710048248,  4212638639,  3646375545, 
-  2933450767,   837640736,  1648414937,   120349420,   206152106,   917165111, 
-    63757594,  1690304431,  1778277108,   737329402,   811404566,   123133641, 
-  2912111644,  2064781979,  1150964767,    53517640,    97082602,   116299056, 
-  1778581732,   462259411,   174134249,  2370619530,  1859331115,  4164825910, 
-  1912362400,  3452761476,   148812929,  3691748398,  3911329993,  1849488786, 
-   319464087,  3710247034,   313013126,   980265177,  2143077963,  2461002573, 
-    34292898,  4283818282,  3376845258,  2683707083,  1497099913,   259962360, 
-  2332095109,  1005222066,  1688457612,  1856881962,  2236598571,  3237039144, 
-  2222172560,  3228543969,  1268308398,  3395870593,  2774968045,  1635052606, 
-  1769983676,  4203921251,  3519617065,  3514484203,  3303970926,  2194339053, 
-  4239517354,  1420835137,   934271248,  3632787570,  2144302951,  3804447685, 
-  2451516805,  1618179860,   656171869,  2358116882,  3353853540,   354117276, 
-   993008244,   765358621,   155558680,  4014354249,  1399407927,   151418145, 
-  2725452646,  1776717471,  1795452113,  1706910207,  2614450010,  3305797713, 
-   943451675,  4246330081,  2276019641,   838597681,  2934203491,  1096256515, 
-  2521366059,  2371663181,  3465002786,   711520860,  1861424419,  3986983720, 
-  3025454667,  1184264695,    29014050,  2499103476,  4251693706,  2556463452, 
-  3217691560,  1829677343,  3278310375,  2882981683,   203608937,  1191793123, 
-  1520800539,  3340481092,  1872122270,  2344433675,  3670699789,  2216594149, 
-  1545112286,   289038939,  1646477248,  3657337188,  3465800396,  2588112718, 
-  4064847440,  4155020667,  2001696075,  3650971042,  3912918350,  3208693956, 
-   508320857,   677582025,  3596469456,  1538367844,  1995142089,   959688004, 
-  2561715649,  3365184180,   487351422,  1419620498,  2032615574,  2031977821, 
-  1905776295,  1617474385,  1926736407,    74874969,  2035355454,   236488159, 
-   354917405,  1152662373,  1152533931,  1815514872,    80272301,  2195236034, 
-  2583921894,   361110061,  3464231955,  3709719223,  2431913133,  1383166387, 
-  2693631266,  3988989242,  3968629507,  2888788399,  1004503024,  1837965072, 
-  3802817798,  1357598444,   541685878,  2632379561,  1584292575,  1491407628, 
-  1307084709,   416794033,   435147316,  2946547720,  3114659023,  3745101393, 
-  2262686655,   175907340,  3285607005,  3419667304,  2537905120,  2812162725, 
-  3642460692,   701512209,   300867952,  3024764748,  3810995972,    13847386, 
-  1001548108,  3595659101,  3682901316,   289325870,  3949930016,  2145519510, 
-  3215515819,  1275438121,  2178243016,  4056061631,   418067955,  4097452959, 
-   240401725,  2514906495,  3201704390,  2355785155,  3078124355,  4102328367, 
-  3997915401,   285803244,  1983403260,  1915737158,  3527133025,  1459110174, 
-  1731353722,   504914355,  2349740919,   403022242,   830126596,   195798736, 
-  2494022354,  3784854990,   684325304,  4025684304,  1807437897,  2572046511, 
-  3979574302,  3252542398,   210104448,  2493387335,  1245875093,  1729639647, 
-  2578695481,   736373115,  3963448018,  2872945311,  3992112403,   232448876, 
-  4223169841,  3266229289,  3560130740,  1698220792,  3283152189,  1178309353, 
-  1312445669,  1549488905,  3295948038,   225833371,  4048567234,  4027414572, 
-  2730964715,  3605548430,  3076413851,   772128617,  1560683930,  3707889525, 
-   588426703,  2144736236,  2297959986,  3792914710,  1108801220,  1426552990, 
-   501966118,  2161161577,  2079467565,   942280015,  3976884119,   988100528, 
-  1910376305,  2377299592,  3177280725,  2028222569,   513775431,  1573509331, 
-  3060163832,  3858855669,  3061214393,  2852934365,   204616637,  1189047902, 
-  1443536928,  3103476049,   427461144,  1972105252,  1294476727,  1902297583, 
-  1456240830,  1569906230,  2029174798,  3368865920,   677888934,  1402871633, 
-  3198835222,  2756153809,  2834958291,  1445101600,   605392192,  2918228929, 
-  4057192295,  4283201940,  1839193471,  3720768801,   373153330,  4155348446, 
-  2992476201,  1326287101,  1730879103,  3412038809,   816993540,  1328916141, 
-  3441223166,  1047952770,  1794105559,   908598410,  1228303377,  1549151261, 
-   621507453,   293892679,  2725301469,  2209044092,  2159809464,  3617473289, 
-  3699758134,   245885702,    71566948,   172288583,  1206632557,  3881898334, 
-  1365887231,  4031985682,  4114670942,  1502182675,  2909871918,  2389911473, 
-  1264856785,  1955598158,  3021293075,   735493906,  1050862889,  2666056512, 
-  1948994686,   223672407,    50845899,  1548069551,  2822347580,  3914820921, 
-   713873097,  2321890666,  4223442268,  2363245535,  1492254324,  3648682778, 
-  1866294110,   471386005,  1249992293,  1079995645,   230776822,  2646341065, 
-   345729930,  2185499155,   807534163,  1245145330,  4156369303,   213715490, 
-  2803508401,  1840349668,  1618601425,   355090244,  1037601561,  3430913072, 
-  2332279297,  3383311239,  4160100927,  3589090811,  2505303737,  3128099896, 
-  1557668792,  1299013139,  4142579834,   195976112,   954148768,   263520176, 
-  2210750899,  2457673191,  1780640599,  1106153212,  3705632681,  3832235749, 
-  2353030640,  2732051708,  1916626474,   505286451,  4072602734,  4213115803, 
-  2065184564,  2967588282,   883875415,  3928950178,  3324430730,  2096092653, 
-   952021746,  1924140371,  1844376506,  1620178129,  2767368496,  1773485648, 
-   433744944,  3483996637,  2668603084,  2647820617,  3855154668,  1965279851, 
-  2271043754,  2269278823,  3667321032,  1580316805,  3979700263,  2823762679, 
-   908221332,    94221711,  1837232383,  1871247749,  3096344157,   608636440, 
-  3420976243,  2975003773,   989749631,  1418734380,  2467788586,  1527897877, 
-  2209825771,  1572547655,  3177821525,  3173061514,  1750252786,   259479732, 
-  1519663227,   844062440,  1932521758,  4081801030,  2192465142,  3454555422, 
-  2694465714,  2282340178,  3384785499,  4131682648,  2986367122,   959108623, 
-  1706485017,  1463759666,  2023173206,  3086422903,  1717235935,  2597652372, 
-  1801443079,  2767666193,  1927505618,  1815687312,   124574150,  3376693375, 
-  3709030405,  1063727650,  3047330418,  3068425322,  3182322520,  1170261704, 
-   430395700,   254985651,  2430924356,  2227912781,  3272615716,  4187458502, 
-  3720334436,  3900070063,  3848839912,  1237104608,    43892613,  1862188032, 
-  2015453068,  2726833859,  2875850689,  2926025058,  2193868293,  3504997579, 
-   877276936,  3911760132,  2203990810,  2073672178,  2498746520,  1625844912, 
-   654423869,   385723629,  1245907718,  2543175993,  3746085323,  1956549686, 
-  1413813593,  1889054794,  1301654450,  3966940706,  3137707050,   805329920, 
-   476123721,   299852541,  2046333302,  2193711135,   774714401,  3850024079, 
-  4165465629,  2233594952,  1448602077,  1584480705,  1287041465,  2312303889, 
-  3974350925,  2887000758,  3999458042,  3651583684,  2964828175,  3696975968, 
-  4280556419,  1714571933,  1547318652,  3187593448,  3085735118,   911626232, 
-  1847377166,  3369966758,  1226951495,  3036799115,  2401779360,  1848419943, 
-   824180055,   537616506,   271289891,  2361011023,  3398914203,  4009061411, 
-  2591442942,  1234448579,    65210257,  1806818537,  2677778111,   233252425, 
-  3409045643,  1439907708,  3526188399,  3551571626,   348049030,    25863675, 
-  1573087403,  2558892838,    15127901,   951512833,  3649284037,  3736112880, 
-  3051914898,  1822739196,  1400752760,  2900477268,  2273427708,  1781678971, 
-  3417722202,  3459517806,  2505527827,  3071791529,  2402133244,  1604585827, 
-    32296399,  1892853474,  2922113544,  3615662454,  1488512849,  3335971581, 
-  2323392532,  2795996478,  3300779040,  3259814265,  3409623806,  3508963631, 
-  1940941710,  3205266807,  1502126309,  1082456047,   646917022,  1153175460, 
-  2914577173,  3441152539,  2320429862,   991204559,  3996584637,   952896485, 
-  2012176824,  1282761839,  3696977818,   568119345,  3198475318,  2977776621, 
-  1928772469,  2612636952,  3833828880,   422523009,  2830339487,  2843290517, 
-   805203823,  3785349100,  1020713694,   522806840,  3589087826,    19217012, 
-  2921510456,  1434628919,   110645032,  4068894099,  2363728633,  3630658000, 
-  1974603863,  3509517332,  1575563848,  3965778514,  3208218884,  1870868735, 
-  2402565160,  3806828250,    53659458,  2711704346,  1224060326,   704192032, 
-  1431694897,  1408954604,  2398440125,   404993822,  1786364897,  2933251387, 
-  3539411898,   373156069,  2692010163,  2539116196,  3731674206,   449329687, 
-  2457994557,   260952524,  3715915213,   562612372,  3191710085,  1113406759, 
-  1420873065,  1591628970,  3994053581,  1677024211,  2420432858,   763107698, 
-   528136397,   863033195,  2872752762,   943465151,   852187401,  1735085040, 
-  2554395654,  1214476980,  1585446318,  4042709793,  2055017702,  2114361048, 
-  2601165663,  2458391399,  1487718863,  1934565920,  3007438529,  2630647615, 
-   725517790,  2033929568,   546143624,  2995612280,  2887634906,  3795937648, 
-  3587220502,  2061544406,  4271280956,  3647127476,  3949546543,   632564166, 
-  3258676056,  3261115994,  3695963563,  2918618842,   916969239,   956766011, 
-  2047534552,  3523191761,   699151303,  1079054508,  3490560415,  3371522923, 
-  3652519654,  2304564328,     1902289,  3540499625,  2185861735,    21477689, 
-   421455899,  1492975887,  3850646584,  4158090976,  1043049322,  1084212133, 
-  2140090363,  2200266359,  3825499575,  3657733728,  2249191217,  4015293854, 
-   963225561,   855930982,  1215710294,   857525843,  2159401098,    21562461, 
-  3930532036,  3639624189,  1786777340,  1658927304,  1118499359,  2208336372, 
-  1988943511,  1122783934,  4172615944,  2996530755,  2540627445,   375892957, 
-  2854766288,  2377718730,  2540410596,  1588817111,   125197325,  1086374928, 
-  2784792996,  2094120696,   434499210,  1061134874,  3155368228,  3643857729, 
-   514644319,  3182387605,  2180844467,  3716272299,  2429340156,  3104807852, 
-  3231595152,  2663096106,  3142338280,  2249704926,   435413672,     4231173, 
-   392842219,  3696433172,  3787909603,  3569391801,  4125819586,   788294685, 
-   801572172,  1990702051,  1800493297,  4259635763,  1745273559,  3420527356, 
-  2438882355,    23626643,  4049103849,  3241384680,  3770137368,  3307668090, 
-  3773544309,   628054196,  3478652853,   952980415,  1880726249,  1590749846, 
-  3134621915,   846275037,   860092510,  3793045180,   368601594,  1008278758, 
-  1031903829,  4190693725,  3402261813,  1648807391,  3879278722,  3972525024, 
-    64460803,  2872885172,   690766826,   624628461,   423936130,  1227139227, 
-   110417666,  3638473855,   388168519,  3501907411,  3620259332,  2053042622, 
-   341809244,    27062362,    83220725,  2673063224,  3139983449,  1651108474, 
-  1060816867,  2554714462,   347285697,  2438586890,  1278047345,  2841934312, 
-  2457284592,  2424247615,  1863718334,  2816440192,  2828228555,  2358120950, 
-  1600630138,  3447062548,   508473032,   103769053,  3252415671,  4016820095, 
-   565359697,  1300989564,  4135935591,  2367393593,  2404625573,  2691664588, 
-    35128370,   717050800,  1506118811,  1516433468,  1137794841,   114849944, 
-  2411831049,  3882264362,  2039694042,  1660483215,  2173256851,   163012303, 
-  4062155878,  2572047234,  4055350520,  2046482049,  3709258872,  2240517556, 
-  1558585674,  1510631275,  3571579038,  3087300690,   610693660,  3656813310, 
-  2391344883,  1583857051,  2032716713,  1839150830,  2839991548,  3308103414, 
-   157871016,   992879486,  2304473497,  2770732119,  4100819998,  2293860831, 
-   170076062,  2276333564,  2550585433,  2809427246,  3540550703,  3990775671, 
-  3729493426,  3436189421,  3966757194,  3536386678,  4261210185,   443061615, 
-   723732405,  1273332736,  1798292935,  2311841132,  3173996693,  1503950745, 
-  3744494445,  2532384211,  2579965073,  3660831416,  1552986971,  1586499013, 
-  3951246237,  2999264871,   375621756,  1981963738,  2868171975,  2750870214, 
-  3471359644,  1226378048,    77962622,  2399166590,  1184301495,  1014767066, 
-  1182704457,  1444356774,  2008569429,  3992138949,  2692434484,  3579762201, 
-  2972787021,  3747252346,  2901420499,  1972096160,  3861194916,   473302471, 
-  2348829265,  3400879148,  1449511377,  3882775042,  1236257266,  1425910415, 
-  3448125582,   380073388,  1976149744,  3990315901,  4153405061,  3189274879, 
-    16402553,  3683897759,  3628336277,  3129652400,  2104451579,  1306774521, 
-  3776272271,  2024097748,  3756854082,  1119187757,  1495326400,  3009948353, 
-  3439580044,  3742948329,   515958172,  2808089225,  3827512042,  1525933418, 
-  1812745673,    24675705,  2112742264,  1672302983,  2479219531,   580652740, 
-  1333648729,  1520723536,  3124417899,   824815035,  3078326789,  3997192658, 
-   238015980,  2214983251,  1463282285,  2194372735,   354710996,  1612745468, 
-  2190709979,  2713699555,  2829549349,  4049050111,  2761709193,  1742126939, 
-  1081452458,  3970228325,  3923908540,  4229864351,  1620241734,  4174495388, 
-   958877313,  2716273292,  1490821972,  1512855828,  3117580864,  2877650421, 
-   575447304,  2041728616,   870636716,  1606969901,  1687776097,  3855986532, 
-  3522456336,   340542851,  2995446397,  2892021011,  1786448484,  3192659897, 
-  1934887330,   234822802,   768026358,  3303075481,   612152138,   594028925, 
-  1235952726,  1187393632,  1140085867,  3626297353,   776675081,  1260419602, 
-  1315957875,  1703245371,  2559308629,  4262554615,  3661634319,   230344940, 
-  2885438066,  2421273343,   353132691,  3414144457,   653368038,  2950251837, 
-  4270006028,  2470295833,  2797956278,   579460535,  1935709849,  1029275961, 
-  3985169549,  2910247237,  3874427024,   568934189,   177803957,  2869105259, 
-  1644728832,  2700809923,  2580691174,  2397979267,  1571011718,  1837133370, 
-  4091537025,  4068960979,  3645659251,   513803584,    14595350,  1454854977, 
-  1746080821,  4177329455,  1440378394,   367907191,   439963765,  2184424777, 
-  2900606338,  4181897348,  1912116287,  4059096295,   676908354,  3471533733, 
-  1139897312,  2857301605,  1024883752,  2643117400,  2367013749,  3765944272, 
-  3054909116,  2582346311,   726577299,  2638639620,  1597460054,  1511559926, 
-   225839882,   577520503,  1087209177,  3030939581,  3967460193,  4163655838, 
-  3602621974,  2409918558,   679285988,  3515858510,  3845206939,   351691450, 
-   956808671,   307612197,    33068525,  2021094536,  1616736149,  2102061722, 
-  3965523847,  1970971935,  3344050373,  1957193737,   301113974,  2081587122, 
-  4068742734,  4076424137,  1946679892,  4052072953,   103765243,  2606323083, 
-   746769758,   453461761,  3150433109,  1616066665,  4135358697,  3959511446, 
-  2043696496,  2363333881,  2467076231,  2669485741,   381946711,  3974204177, 
-  1037108865,   256098363,   353250981,  1096677599,   182408492,  2070882081, 
-  1850156388,  3349600304,  2736046995,  2180674962,  3176354496,   718683919, 
-  2692184149,  2730751185,   612575739,  1719701369,  1242122814,  4236665779, 
-   194564680,  1408434052,  4191122883,  4279236229,   562143083,  3379555341, 
-  2622805439,  2818175705,   359655921,  1480645428,  2119933094,  2584230451, 
-   991639386,  1732519456,  2029496966,  3240670964,   458303266,  4250732173, 
-  1885879012,   112403534,  1033735558,  1600380020,  3475855094,  1522300383, 
-   919039871,   597966959,  2599019921,   731453973,  2633695456,  1860154390, 
-  2272800057,   833176498,   789393148,  1718895610,  1790998474,  1786272026, 
-  2545079144,  1852706581,  3901379122,  2257802722,  1553962884,  2217702260, 
-  3360743843,  2556601526,  3120995767,  2562248095,  3486119023,   741909412, 
-  2196205999,  2687485982,  3643291472,  3559759171,   820955755,  3101341175, 
-   480652817,  1220917669,  2187437637,  1053929260,   476469463,  1555680671, 
-  2303283506,  2440609811,  1007924550,  4158236147,  3885646554,  2030204528, 
-   852564840,  4213094959,  2023341462,   127425042,  1710319427,  2902265723, 
-  3833208559,   838844904,   843605579,   148977745,  3141206570,  2601517273, 
-  3920955154,  3193681240,  2571818932,   610897751,   244024861,  2495925589, 
-  1252765503,  3534313821,   812763473,  1838211176,    77040422,  2905958498, 
-   297168119,   687107789,  3247707908,  1347790682,  1508681630,    50382907, 
-  3035683389,  2681242220,  4128604192,  3420399696,  1832136012,   689099030, 
-  3294757638,  1048234280,  1030662054,  3000385976,    28728622,  1370766826, 
-  1903218766,  1557405363,  4286397395,  1786591548,  1809409443,  2373206953, 
-  3406294609,  3995115560,  1335412182,  1727483282,   794446489,  1685553908, 
-  2037673124,  2867607918,   823637526,  3660376916,  1372863164,  2218279269, 
-  1655365274,  3441446479,   654629236,  4044353702,  2039141339,  3715948261, 
-  3378011394,  3085621833,  2720053495,  2189774684,  1670062388,  1659654870, 
-   119960476,    98504844,   357225507,  3908665050,  3485455303,  3110142621, 
-  2094260076,   741120690,  1884431739,  1736030884,   159128004,   644473301, 
-  3768460970,  2665056116,  1681089599,  2169742064,  1683519768,  3812736678, 
-  2776001061,   332385395,  4071135937,  2482308918,  3489998951,  2932973700, 
-  2850183804,  1637636149,  3979155584,  1216216510,  1625858829,  4210764189, 
-  1015124227,   618065460,   403797600,  2988494993,  4048851102,  1759355481, 
-   387474096,  2255697144,  1696347623,  2688845034,  3913215514,  2338867552, 
-  4142135398,  3938985172,  1083704239,  4263185792,   231915478,   251250595, 
-   547403402,  1806745813,  3986894418,   839576063,  2233552566,  3966199414, 
-  3286846495,  1710933453,  1664652852,  1475139811,  2331365501,  3193972524, 
-  1922860603,  2554218530,   296624841,  1797449342,  1320269274,  2679089629, 
-   396708458,  2275749922,  2164686999,   995931184,    69047387,  4042631509, 
-  2762518717,   752497033,    87150137,  3419708261,  4224523903,  4257041589, 
-  2964370861,   699717565,  3942389898,   470646027,   882630079,  2192901909, 
-  1216496603,  3184224870,  2425105598,  2467813396,  3020901022,  1205651332, 
-   111167226,  1518628702,  3084199531,  1308122372,  1359075271,  1845991574, 
-  2021278526,  1671830034,  4145204117,  3696748870,  3415898824,  2411590709, 
-  3837392823,  3606899421,  3218271941,  1643189244,  3367381502,  3867249405, 
-  1771082314,  4008204927,  2708273633,   417864286,  1157202171,  4259905014, 
-   107293254,  2504995248,   133577306,  3697463455,   160736774,   555625392, 
-  1627152725,  1302086013,  1238130550,  3520208117,  4093685401,  1936303913, 
-  2960037621,  3817271852,  3498815920,  2731208621,  4038932090,  3479666508, 
-  1518701976,  1011321010,   254546552,   931677258,   989908232,   722110276, 
-  2042416595,   348550270,  4277731684,  2597485208,  2337336054,  4203635555, 
-  3381181560,  3683673498,   361115490,  3119326852,  2078480518,  2785446466, 
-  1131096525,  2447664930,  1778932823,  2594532001,  3181159082,  3517064492, 
-  1738920532,  3746695402,  1958309091,  4077227579,  4172236659,  2911300789, 
-  2235970092,   462861616,   666194102,   504180258,  1691827325,  3767344431, 
-   343901171,  1612748632,  2000293467,   863330277,  3944878675,  3903000915, 
-  2678972842,  2058296705,  2950958807,  3044146460,   651089143,  2178352703, 
-  2276568975,  1271770507,  2169102419,  2390853912,  3278227165,   211290327, 
-    62498159,   349657955,  2026368839,  3621153623,   658949577,   815356468, 
-   688767653,  2206840403,  2975912276,  4157808236,  2034622054,   696474470, 
-    68371579,  1538647905,  1575616890,  3660856173,   101453336,  3023261111, 
-   690592680,  2708799647,  2310707996,  2443881308,   646410687,  1008900620, 
-  4099000648,  3799876371,  1201670792,   346638718,  3162064545,  1949629719, 
-  2276640635,  4196213675,  2709503879,  4128817753,  3028354878,  2572142771, 
-   467884153,  3240051539,  4177724168,   931413589,  3825266900,  1973892227, 
-  2201982779,  1948404186,  3396436889,  4070398665,  1657303511,  2697046010, 
-  2856250923,  2851787742,  2776662357,  2821777065,  1190505663,   248723765, 
-  3059543094,  1465549006,   979652678,   808731671,  1247369961,  2221121903, 
-  2648774766,  1836017866,   109487550,  2022962442,  3129355995,  2917956914, 
-   494205130,   616710176,   117082747,  1430833735,   258896157,   899339445, 
-  2285948109,   317325437,  2419629689,  1459366235,  1298753730,  2605936862, 
-  2163277831,  1533114399,   272321480,  3511322538,  3639112198,   385773825, 
-    54287461,   427706488,  1942474761,  1617291762,  1937047881,  1826592826, 
-  3202541680,  2396312107,  3688517574,  1550745468,   427165940,  3953010221, 
-  2085304542,  2551570638,  2643945143,  1700372279,  1694603829,  3304757844, 
-  3628674567,  2348462162,  1720103334,  2119623819,  1997127213,  3878160329, 
-  2211049933,  1632601786,  1055930166,  1865776858,   885843946,  2371584232, 
-   822646323,  1133006254,  1339027076,   306246426,  2313431013,   641498767, 
-  2843639881,  4027756724,  1020247455,  3688578611,  1767531000,  3000951769, 
-   355510824,   835721622,   210725214,   879652041,  3777465980,  3171350607, 
-  4191819538,     1661430,  1298931436,  2019284504,  1079056621,  1908551162, 
-   502058475,   992173923,   601507738,  1380520875,  1025899230,  2242403940, 
-  4026932052,  1192995084,  1888726677,   578513856,   863104031,  1729481842, 
-  3156844430,   217975249,  1725641897,   823304334,  1916921848,  1484738621, 
-  3951399680,  3831384029,  3318728905,   875359560,  3335086454,  1666655402, 
-   686914365,   241955191,  1945062224,  3781269368,  4049463530,   321595552, 
-   295012893,    91497313,  3793893264,  1914237316,  2462563397,  3428192388, 
-  3446577451,  3853870938,  1980577126,  4084493542,  2024550974,  3569970789, 
-  4046700910,  3948812274,  4099495020,  1188353687,  4144122698,  4066250131, 
-   362444630,  1009970091,   328087548,  2133954496,    77133740,  2958080052, 
-  2094075468,  3756709809,   383747499,   696240287,  4106216887,  3283489998, 
-  2447892790,   662790023,   362679049,  1452023977,  1846685776,  3468176322, 
-  2390476621,   233718171,  1125235870,  1354813079,  1896491344,  1324449737, 
-  2610966822,  1293004557,  2895029878,   871464396,  1102735813,   580206280, 
-  3801588025,  2339457005,  3448015794,   729103650,  1253306428,  2158597937, 
-  1601011089,  2315980139,  1933390143,  3999643054,  4124549766,  3544463742, 
-   291677004,   716512120,  2080285385,  2564105186,  1590897706,  3624175636, 
-  3586316794,   899428730,  2690030804,   741710367,  1846389751,   123140847, 
-  1622685594,   452789133,   778161585,  1009118514,   230392880,  1049601388, 
-  2469691502,  1061432414,  3560627353,   654273832,  1168433553,   745865685, 
-  1937060019,  2076857497,   636874201,  3074893538,   292121193,  3027632281, 
-  2067854084,   267289430,  2396087410,  2860478480,  3153784479,  3971142098, 
-  4152658835,  1002638596,  2294972923,   792150240,   312199235,  1070305089, 
-  3991883447,   926407728,  2639247115,  2360404689,  3357285239,   539784406, 
-  3217104995,  2499685487,  3065422660,   328092347,  1813389907,  2326162062, 
-  1035172279,  1854440476,  2378291538,  2771669545,   969248910,  2181398473, 
-  2578410516,  2266491588,  1175329277,  3386597482,  3999003756,  2748121628, 
-   214471849,  2445670390,  1236484714,    81990191,    67530619,   864181942, 
-  3305059478,  2838609945,   701062711,  2937524943,  4087440238,  4187029331, 
-   437976686,  2325205697,  3378426426,   156521695,  2146018605,  1833482110, 
-  4165683319,  3507792048,   314969770,   619217928,    52609305,   803986622, 
-   790569346,  1387668877,  1398865313,  2952704854,  3441683728,  4178414213, 
-    49914019,  1243506309,  2248325612,    90304093,  4191832522,  2915035079, 
-   565112986,  1605312771,  1917063833,  1421510517,  3815983696,   686887048, 
-  1038165152,   783971069,  3749593134,    28721011,   743978338,  3609853208, 
-  2283330444,  3677399209,  4258482641,  2092540957,  2419618999,  2193382430, 
-  3128679248,  2030573774,  1820748762,  4255609355,   551681975,   482539585, 
-  2260098786,   774991608,  3413817151,  3357883555,   670289617,   844475729, 
-  3123307013,  3225360997,  3739352921,  2020994156,  2915551477,  1504755479, 
-  3183584567,  2456756963,  1508422394,   190954540,   774196732,   898821832, 
-  1578301801,  3040764375,  3291154343,  2289909083,   218113297,  1751833904, 
-  1903346913,  2662095715,  2508978384,  2272341515,  3986997391,  2819696192, 
-  3688660519,  1188838800,  1947357617,  3873952111,  1293164275,  3462356257, 
-  1360469642,   815484133,  2081668846,  2275151756,  1911511126,   655257249, 
-   114662836,   581330004,   256308013,  1911012397,  3206114939,   846573182, 
-  1224418027,   261956784,  1640969995,  3499008348,  4170841278,  4059545121, 
-   895184242,  4265612014,   234782847,   634952590,  2116546039,   144677064, 
-  3591235521,  3259422693,  2151925041,  3835522553,  1293822630,  2638938675, 
-  2553805010,   817346173,  1845699930,   833183645,  3348812642,   956126816, 
-  1732588111,  3399623935,  3316303506,  2322739669,  2036446267,  1092607929, 
-  3739343099,  1843931297,  2723077744,   383605368,   757438214,   367153551, 
-  4204698129,  2699509123,  3085097851,   810682242,   696565928,  4030989963, 
-  2152740438,  3830544926,  3899385922,  1457150762,   565623943,  2444425462, 
-   563853959,  1187438612,  2742325947,  1157867463,  1200331194,  1418821614, 
-  2477537293,  2003965046,  2509241796,  1501629512,  2343687373,    22201446, 
-  3511006954,   749048759,  3995960508,  1611577370,  2920444981,  2195947748, 
-  3017093548,  1776024119,   105534820,  1503048480,  2277095237,  1741204223, 
-  1445620263,  3894568014,  4045644770,   680899937,  1439254000,   630876692, 
-  1115997622,  1149685483,  3709637613,  2247655046,   227081137,   773037081, 
-  2367241129,  1055305731,  3288024328,  1519437099,  3073604101,  3714472420, 
-  3013429423,  1232499034,  2565558710,  3030770121,  1464771714,   105303172, 
-  1560146962,    71780533,  3147472276,  2910976077,  3146381895,  1676423852, 
-  2046326102,  1825223036,  3177843929,  2259910587,   345156584,   292855637, 
-  1957281545,  2367577944,   898442784,  1290144547,  3861835286,  1816577962, 
-  1701033139,  3948526938,  2568466346,  2210730673,  3799344368,   294208410, 
-   261668458,  1399558454,  3026852779,  2726331355,   662174791,   853753925, 
-  3618029189,  1477455548,   529460380,     2838086,  1087997982,  1140502304, 
-  1075588562,   436354947,  2767161561,  1992896927,  3046579187,   367573599, 
-  2138847227,   766100020,  1911969388,   438522792,  3127618478,  3664962617, 
-  2305809112,  3978169454,  2500883874,  4092276808,  1873417254,  2004518575, 
-  1014000451,  1438821595,  1505005707,  1618513397,  1499059618,  2369097636, 
-   326563609,  3453497996,  3362419903,  1494204182,  3117287735,  3180979141, 
-  2791752408,  3847683600,  1972454516,  4240304534,  2084548210,  1056552960, 
-  4101153924,  2013568880,   375529514,  2403575585,  2719763121,  3448973170, 
-   211794490,  3881683282,  3836333645,  4219635747,  1621001739,  3508193774, 
-  3541466629,  4070076543,  1678673417,  1137053206,  4033462199,  1604092152, 
-  1651023042,   392882331,  1417801809,  4228805251,   193955060,    57025169, 
-  1351457466,   204240942,  2760800833,   282638543,  1208077147,  2738902214, 
-   707538561,  3379065294,  1997955004,  4048342445,  4156168761,  2446392390, 
-  3564775823,  3003483090,   726714138,    30770141,  1463754794,  3858949773, 
-   887431398,  4045112452,  2215436317,  3150491757,  1848644255,  3351687320, 
-  2655562135,  1884592547,   406380062,  2066922611,  4170897985,  2426721632, 
-   459005753,  3792763028,  1419661268,  2899730289,  3477712924,  3788795854, 
-  4060140814,  2532581861,     7396554,  1106666905,   369079673,  4168008282, 
-   698355128,  3114122638,  2001402997,   702775313,  3974992235,  2211350416, 
-  3141804946,  1782649766,  1416783609,  4198005894,   943407172,  3271095496, 
-  2471511671,  2812439041,  3156391329,  2444565915,  2140061515,  1043205644, 
-  3155732377,   407267955,  2975165039,  1880027695,  3970387142,  3759516408, 
-  2313308263,    66441315,  3856470396,   916460872,  1731606722,   455312557, 
-  2929149001,  2697747215,   666259018,   497754360,  2239123186,   962577401, 
-  1775879272,   918361726,  1368421383,  3408458129,  3457954272,   229040794, 
-  1539770825,  2902639951,  1453605493,  2813338496,  2869566414,  3019841565, 
-  1454455388,   188744456,   185324663,  3792024518,  2585535097,  2673531844, 
-  2562806432,  1578036868,  2601037261,  4146063747,  3123181151,  2320413745, 
-   906013440,  3971064777,  3730667902,  2868724828,  2484012352,  1121833868, 
-  3011518202,  1647993193,  4123299959,  1507749457,  3853750661,  1700763184, 
-  1991324103,  2610386654,  2109108588,  4128104350,   206740014,  4083061251, 
-  3055685453,  2748579512,  2605480004,  2585788664,  2501655201,  1587094539, 
-  3624152424,  1851174249,  2773713717,   963384904,   803065115,  2000366979, 
-  1630210318,  2734148389,  1939259825,  1828210167,  2539784227,  1067048390, 
-  3561507049,  1069024299,  2011489533,   199357613,  4128553102,  1160699797, 
-  1949577807,  1387335805,   426675400,  3104105153,  2218128887,  3333480376, 
-  1005233226,  2000549759,  1910124690,  2492506731,  3029877737,  3228463037, 
-  2982060492,  1679425613,   837386790,   494068473,   909104330,  3851530426, 
-  1713269662,   615939898,  3995018871,  2806310394,  2180667195,  2671518723, 
-  4022708476,  2492596582,  3832921516,   763063303,   171419806,   962103701, 
-   648248970,  4146515956,  1605925119,  1799650893,  3736955032,  2685021637, 
-  3965400588,  1268171239,  4088161925,  3963622254,  1724049530,  1532699038, 
-  2089178970,   130137288,   258824018,  4103848002,  1773814214,  3907687907, 
-  2082675725,  3870049542,  2155062380,   114499548,  4184935324,   730359712, 
-  3607412515,  3052667100,  3836629392,  1619249958,   214803086,  1257113424, 
-  1865734823,  2842725192,  2224697011,  3075034734,  2220717737,  3542526778, 
-   143779692,  2198763846,  1018348840,  1365958644,  4215605744,    88060151, 
-  2216494414,  1857748418,   382188726,  3330809806,  4133934618,  2499436550, 
-  2760364708,  3464526166,  3709436398,  4286054568,   306139246,  1859457439, 
-  2875384041,  3806717617,  1601828489,  1171827373,  2604026953,  3105220406, 
-  1892610774,  4133555787,   251455191,  2297828033,  2474264480,   516388171, 
-  1638146395,   719843527,  3922593684,  3329706727,  1300201427,  1607267333, 
-  3970074734,  3519059230,   366670651,  2836078849,  2462031924,  1453845246, 
-  2967196830,  2330455889,  2441426786,  2950877178,  3381360409,  1850632387, 
-  1312805118,  2787946841,   549038355,  1648232945,  3758174268,   681094769, 
-   393259258,   965847587,  4147870976,  1277321726,  1477950092,  4111411640, 
-  1941576221,   802035422,  3089300531,  3510915920,   409311414,  2192133430, 
-  1430395818,   378192871,  1682841390,  1207649419,  2289732894,  3387350270, 
-  4019341366,  1731251770,  3054398556,  1264227545,    66997922,  1243272666, 
-  4113918341,  3891720050,  2113341678,  1936662128,  2573372122,  1206144108, 
-  2786314560,  2896427963,    24470553,  4227818054,  1685253772,  3475642491, 
-  1306078970,  1976890710,   282311664,   380994214,  2354751055,  1690601317, 
-  3674826005,  2916643385,   850017971,  2658880356,   930016159,    17374365, 
-    33339799,   222461849,  1391218423,   541679194,   180317300,   445348936, 
-  4000430580,  3480827844,  2549467307,   844057615,   125875520,  2353795375, 
-    32145223,   729724647,  2028326900,  2783294602,   919173141,  2521182469, 
-  3946726074,  3750177057,  2633886435,  1840269235,  2665133104,  4274734444, 
-  4147966843,  4263718503,  1263729289,  1310794282,  2793250847,  3792220410, 
-  3752208020,   490466794,   822595621,    20430974,  4147252687,  1448075590, 
-  3218520002,  3331661545,  3956469316,  3529272431,  2224007912,  2455003136, 
-   373999361,   757335274,  2087083704,  1595667724,  3666553262,  2319003926, 
-  3029767963,   619282446,    87910372,   229462490,  2557484952,  4180428569, 
-  1216472591,  3644285194,  2581958973,  1970618160,   343079275,   615850236, 
-  1281309237,   638456382,  1581461172,   948311396,  1647195633,  2499461989, 
-  3191082761,  2857406491,  1933297615,   437311268,  3211682572,  1164623954, 
-  3086787845,  3695011114,  4165746785,  2683565311,  3800785264,  1820638090, 
-   308420012,  2283869778,  2814059646,  1571099324,  1139208991,   945408853, 
-  2576502881,  1454311282,   661123613,   520679127,  4161385647,   135274425, 
-   834068215,  2853923401,  1260679251,  3502191266,  1444036547,  1526959985, 
-  1611235664,  2754659570,  3718197667,   545758038,  1738029045,  2835351736, 
-  3994382340,   362722131,  2216619401,   231712409,  1865804800,   741142353, 
-   391173291,  2874289473,  3070759462,  3858343620,  3865167498,   822257601, 
-  2088135050,   667103367,  2903668383,   320009008,  2205259684,   450553913, 
-  3200771586,  1347268577,   927327896,  3326750851,  1210155904,   959385059, 
-    79320544,   673721325,   849129233,   612640889,  3788739202,  3804034817, 
-  2056124302,   365988598,  2717509943,  2514267878,  2136643419,  1911979314, 
-  2383446192,  2495587440,  1361117242,   182630512,  3434024516,  1516294816, 
-  1650554215,  2747089528,    74564488,   386197913,  1144891481,  3219796649, 
-  3167029771,  4083896860,  1035149930,  3124863067,  3952023244,  4159182820, 
-  1493488528,  1707979159,  2634017609,   926893206,  3311352568,  3210719152, 
-  3013550987,  1423149062,  3353076747,  2685771849,  2886622417,  1816721282, 
-  1857783058,   812057785,   442910319,  2297458762,  2739963242,   272602023, 
-  1594936335,   586393721,  4255604774,  3260365296,  1087147248,  4073655052, 
-  3356292260,  3865319777,  1298063025,  1928201770,  2187927248,  3798771167, 
-  3614111429,  2485874757,  4147778996,  3886401658,  2271446373,  2254904535, 
-  1855660594,  3442311443,  1380457237,  1331249660,  3629567700,  1801747739, 
-  1329493890,  4188140622,   969157873,   724950879,  1231850132,  2611048614, 
-  2705796414,  4000738677,  3849497828,   618513940,  3121277542,  3211189217, 
-  3682143368,  3430718578,   274426937,   567120609,  1070297720,  2907628132, 
-  3938711658,  3161730185,  1111618479,   925192172,  1255016486,  3936413060, 
-   951365388,  2448073615,  1806206862,  3210466799,   813929449,   809303579, 
-  2374556300,  3041224749,  3418792295,   851354465,  1146760102,  2147682343, 
-  1538701221,  3594112321,   740822340,   471772910,  2646311604,  1781574951, 
-  1878113717,  3407947359,  3483543965,  1119471579,  2015768650,  3678325628, 
-   975218865,  3627467871,  4047426451,   375521531,   533548055,  2746491166, 
-  1898463583,  1867969104,  4272827890,   410432832,  3857833072,  1648475329, 
-   494350981,  3796167992,   778812394,   539883887,  2204344912,  2181145219, 
-  2344495428,   885319211,  3475637402,  2820481904,  1057658214,  1409702455, 
-   864619457,  3857487630,  3650786137,  2075610968,  3363507625,   648595635, 
-  1879790201,  1077387649,   278650271,  3842295326,  3333556866,  3232635556, 
-  1325731184,  1180279030,  2373635800,   997201206,   533038214,  2316180328, 
-  1758986282,  1487003118,  1389284419,  2157152653,  4060043372,  3983509941, 
-  3208481925,  3489515068,  2034440949,  4175255251,   190971661,  4003793134, 
-  3114976109,  2628681002,  3428340930,  3326819541,  3134448389,  3108569577, 
-  2394034094,  3410009125,  4168980888,  3580522405,  4127652894,  1678292877, 
-  3153633826,  4221867115,  1822871437,  1064335309,  3077284227,  2847000505, 
-   883390058,  3898391456,   750690469,  3085314883,  2391889717,   305192830, 
-  3146182387,  1906234537,   335755164,  3288870029,  2773141745,  1154895497, 
-  3051740165,  3773950751,  3142673957,  2390132087,  1634611710,   355540618, 
-  2257795463,  3872746777,  2938831622,  2957382853,   117216563,  1937476610, 
-  4031656478,   812617907,  1220909350,  2840902836,   873872038,  3425958505, 
-  3520850112,  3210992962,  2903502636,  3453352933,  3686494160,  1865904584, 
-   636427858,  1591191805,  1219883218,  1898068332,  2282553290,  1564238926, 
-  2699769744,   195962982,  3743253753,  4111985514,  1589683841,  2200761166, 
-  2526264744,  1360384934,  3207510446,   726353149,  3186022867,  2400987084, 
-  1991367270,  2021730781,   680957652,  4120789407,  2588542063,   560391480, 
-   997044056,  1655895285,   723770283,  3687798927,   415909598,  2428969234, 
-  2929045791,  4142356030,  3716821677,  3352421246,  4215153065,   878173859, 
-   607990555,  2209624846,   125003749,  2410842556,  4138748883,  2346180028, 
-  1025459594,  1837167365,  3905451082,  3131890638,  3121491463,  3479839207, 
-  4007474664,  1702267632,  2553331984,  3954075366,   411007203,  3753272872, 
-  1231168148,   418943129,   469914395,  2256565538,   919637177,  3291198937, 
-  2451208132,   643041459,  1090158389,    73417233,  1645232844,  3934337568, 
-  1203317804,  3913396839,  3500896885,   338299711,  1922257962,   297113675, 
-  1593676158,  2726926292,  1004173649,   469522972,  3477808487,  2808468295, 
-   362848566,   706875658,   596249628,  1078501532,  2623103345,    37648970, 
-  3585450089,   618392355,  3275353041,   469920518,  1887692678,  1540008830, 
-  1213360818,   339750154,   626906277,  2531709712,  2135509211,  2070174174, 
-  4154290293,  2311128314,  2302800062,   734061271,  3014211562,   597266484, 
-  3515299886,   750154901,  2848713605,  1707230167,  4280776053,  2922190013, 
-  3740526970,  1416534482,  1805199955,  1632107284,    76758730,  1306698732, 
-   736715675,  3604515024,  3913276940,  1448941348,  2061594392,  2993314849, 
-    21990054,  3555633077,  1655393655,  2080505944,   526843256,  4047129704, 
-  1199829776,  2677158595,  2880069776,  3424568513,  2586543273,  1379114946, 
-  1746752554,   604156489,  1952213395,   571236108,   929914046,  2442936742, 
-  4021712936,  3802943506,  2906160024,  3155003363,  4246762722,  4135986562, 
-   752902113,  1568309984,  3912760838,  1243602482,    33859783,  2260014722, 
-   623693102,  3044952107,   132905500,   562895363,  3443736310,  3143499501, 
-  3507043316,  3702754566,  1598554803,  3907998702,  2183373279,  2709807556, 
-  2968279611,  1634574979,  1948255869,  2098103783,  2589787960,  1395463516, 
-  1017063229,  3459215475,   402802801,  1047645063,   362916987,  2613562904, 
-  2273271511,  3513188226,  3097655420,  1149230632,  2198215417,  1618912853, 
-  2858772056,  2632419856,  1545860421,  1697297219,  3073817939,  3511943388, 
-  2978121168,  1417903961,  2621100770,  2806340700,   645031705,  2083344135, 
-   348505925,  3968884410,   605954152,  2255853333,  2886943007,  2553105773, 
-  4176086580,  1999933090,  2693626143,   193904526,  2630977491,  2431224844, 
-  3400408563,  2758557599,  3678875027,  3022889416,   106903382,  2945990402, 
-  2794378937,  3157727036,  1407042751,  1516541997,  3624666368,   641006048, 
-  2718044718,  3140165085,   826065119,  2225816381,  2441585764,  3285974947, 
-  1823959643,  2982735778,   519848581,  2167641357,   124617638,   239484483, 
-   886609818,  1402902873,  3024038923,  2632162504,  3618868514,   656173508, 
-  3065188430,  2379670704,   181571377,  1519751825,  1338614344,  2810082943, 
-  3620575492,  2527139177,  1842517951,   497086196,  4015093985,  3455143713, 
-  3040169296,  1974180099,  1194051259,   645227012,   234303399,   832158209, 
-  1150219260,  1895887738,   446683037,  3385609495,  1580297975,  2487099017, 
-  3771705008,  1070366519,  1958888974,  3493292676,  2123500706,  2862238808, 
-   184036801,  3535352595,  4130787480,  1940237844,  3890343440,  3399897879, 
-  2337862265,   483005702,  2321494215,  4291947063,  3578948250,  1450546643, 
-  2584191828,  1970675653,  3396067677,  1044117470,  1531132484,    63920922, 
-  1912472915,  3593730218,  1267296118,  3012137058,  3085823562,  2680389306, 
-  4088105641,  3855038768,  1214081585,  2235910914,  1383333989,  3095631019, 
-   838846627,   981025042,  3329919079,  1970095761,  1492668328,  2967911920, 
-  3329434762,  3143353625,  1186051204,  2738691001,  2346632698,   983739321, 
-  1049240065,  1326325416,  1117653434,  2890720087,  1534116402,  3565686393, 
-  2045252981,  2266158104,  2754657337,   416578368,   630884388,  1901382996, 
-  1401977694,  3727454222,  2510172708,  3250933808,  1348124931,  3704799596, 
-  4043208076,  1427559795,   514528721,  4222613871,  3539446135,  4211807042, 
-  1438424492,  2426211843,  3023442136,  1171345626,  1234122907,  1113073859, 
-  4038652000,   654874524,  2664244490,   938019115,   306764151,  3140898101, 
-  2986944169,     3058871,   472006329,   849460314,  2956078310,  1766345893, 
-   979204828,  3826017283,  3669919231,  1410755020,   692932151,  2593235289, 
-  2619204503,   294083249,   843577917,  2595716717,  2374151508,  1437082857, 
-  3687504246,  1100775517,  2529602841,  2023343204,   634162982,  1980321854, 
-  3924662011,  1292661074,  3284274836,  1286311561,  3005787522,  1547701340, 
-  2887648678,   941015534,  2044402319,  1492584244,  4029685803,   263251251, 
-  2950880439,   719411469,  1201169203,  3902287060,  2728045341,  2157490159, 
-  4091257345,  2174199978,  1954670084,  2099562210,  2630440434,  1492420389, 
-  1850558719,  1810657732,  3635173546,  4077463191,  3165475642,   671525659, 
-  3167197940,  2948103896,   545419878,   462997976,   426367406,  1844990602, 
-  1512581151,  2567987810,  1005918765,  2231578323,   772378986,  1756853371, 
-  3969044984,   237119804,    97015481,  3072336254,  3217422538,  2957331958, 
-  3220822283,    84225166,  1665035028,  3396600887,   550477786,   577378110, 
-   680584134,  3295892243,   116739218,  2019035578,  2411045488,  2335404920, 
-  2681110944,   236366772,   703002114,  2220804703,  4282440526,  3204734181, 
-   915622595,  3563377201,   747907116,  1286291436,  1121988635,  1905255063, 
-  2156368419,   225942243,  3177775986,  1180786577,  4107487401,  3039424053, 
-  2151225256,    99521082,    20077893,  2693654268,  1281809070,  1935012923, 
-  2852302489,  3023721639,  1926436790,  1293369211,  3409808201,  3646297614, 
-  2000004221,  1271767249,  1843590300,  3070393973,    59005696,  2351574885, 
-   218256804,  2404305653,  3876226504,  2060079860,  2026463919,  1800668180, 
-  2125126263,  2258441164,  1231975772,  2012370898,  3378646848,  3853631910, 
-  1783711326,   537836069,  3585088663,  3026168069,  3935118859,  1087782749, 
-   796474033,  3704970907,   868231337,  3716484929,  2035942082,  1645107992, 
-  2370706126,  3828722061,  2480151869,  3545980349,  4020480474,   200239836, 
-    13781446,  1334014194,  1990367057,   206911999,  4281351549,  2838259513, 
-  2386575646,   990505915,  2079986162,  2610083539,  3637464251,  2378049129, 
-  3104488457,   552374042,     8870181,  1351834183,  1672525056,  3654117177, 
-  2914701193,  2238169762,   152037533,  2390824175,  3446627549,  1653793529, 
-  1263985964,   433586593,  3250724524,   295822347,     5197580,  1391390843, 
-  2376752438,  2103738454,  2134443609,   213423219,  3727900220,   284005703, 
-   980239957,  4257630531,   762024150,  4220849566,  4039361546,  3530718001, 
-  3388804000,  1679190934,   281182362,  2074487173,  2202452364,  3572814882, 
-  3687310078,  1503600843,   528556687,  2197513812,   816777681,  1839746160, 
-  1421890099,  3315645585,   150399667,  3527887580,  2453649860,  3541863122, 
-  4251921193,  2731748662,  3413952115,  2372084075,   137966900,  1451311607, 
-  2124063998,   358978426,   167459763,  2545467601,   903853704,  2933096169, 
-  2348301762,  2816719901,  2660296974,  3209832471,  4087308284,   114371734, 
-  2440441096,   792543320,  1195215762,  1033560205,  2921016725,  3894074243, 
-  1429712698,   416734217,  2461072726,  1945123051,   723358767,  2772960707, 
-  1782167379,  1877409802,  3150768848,   369760652,  1883657545,  1630614969, 
-  4182690109,  1986762774,  2307108851,  3117482993,  2830662763,   923029658, 
-  3303310073,  4137778027,  1679281685,  2455499380,  4283576747,  3540694103, 
-   601807626,  3610375391,  3608272488,   435775416,  1289381875,  2068652335, 
-   142906369,  2371726124,  2226452590,  2480090794,  1889674836,  1301896837, 
-  1627279542,  2089649057,   461571916,  3448648564,  1308448871,  2781940396, 
-  3974418821,  1993597015,   178119060,  2486553252,  2101476701,   990317395, 
-   516138481,  2121297837,  2944636665,  2755167304,  3214664749,    41701255, 
-  2285455177,    31939243,  1720370080,  4083145452,   374602040,  1315527760, 
-  3944239631,  4256572981,  1580213919,  1758248265,  1953948781,  1620221514, 
-  3743172284,  1839885169,  1595188759,  1939921524,  1695725971,  3206211627, 
-  1856499978,  2359282907,  2230053305,   728322028,  3624889236,  1121342283, 
-  3474176651,   642115839,   986816028,  1593290007,  3907899432,   161437503, 
-  3813516253,  3290311163,  1194257043,  1239223424,  3306131802,  2659785303, 
-  1673072404,  2007878305,  2401284542,  2925117862,   216875043,  3410085753, 
-  3566391749,  3806310825,   432625343,  4108591705,  1219914761,  1184852570, 
-  3203602638,  2588561649,  1670176386,  3577275434,   212325279,  3533120767, 
-   812306969,  1368311594,   984632304,  2240356465,  3032051596,   270364861, 
-  3912434411,   551092173,  2020654125,   935165170,  3232167201,  2933478539, 
-  3765532793,  2324772389,  3986575091,   198450413,  3897836280,  1392686880, 
-  3248120067,  2751371520,  3398270952,  3167084296,   912653184,  3518075795, 
-  2712583471,  1604680127,  2379488081,  2497061624,   124298049,  2968323162, 
-   591752229,  1177280981,  3562206298,  1006258796,  2114636501,   784279967, 
-  2525878903,  1433591035,  4139762514,  4142762549,   594096332,  2659116976, 
-   537637647,   946639534,   832539086,  3789231707,  4127653553,  2769609920, 
-  3910134848,  1893161315,  2684814307,   965825786,  3439361602,  2135159126, 
-  2124893140,  2266050190,  2847893086,  1406014909,  2038384789,  2138950048, 
-  3875047320,  1753317281,  1478112058,  4010158947,  1308228850,  3738335775, 
-  1157485151,  1044322737,  2435611924,  3076240796,    49415776,  1955260326, 
-   537460794,  3972612648,  2061943982,   206902997,  2692756512,   365398428, 
-  3058489566,  2639871163,  4102655192,  2174132590,  3260379608,  1821418754, 
-  3148421689,  2178658638,  3394202501,  1854722115,  1662415751,  3811188669, 
-  1092506636,  2397964847,  2548681944,  4285250360,  1078464086,   838898094, 
-  1825776736,   236811546,  2418512191,  1732715330,  3988734323,  1115477693, 
-  1978710223,  2029797942,  1262457558,   138736599,   782067206,  3822359642, 
-  2713677643,  2350004492,  2562936484,  4211373947,   141593295,   298532295, 
-   343629107,  1639651924,  4104394586,   361217227,   717355678,  4291438790, 
-  1503714490,   685646909,  1323947849,  3051098246,  1768478811,  2251592309, 
-  3583966004,  1299295801,   850111942,  1173117585,   367595174,  1393538348, 
-   893152542,  4079346068,  4224882388,  2455118435,   107744075,   295112428, 
-  4195971484,  2325896169,  2491685316,   872217390,  2357503468,  4107951346, 
-   709970309,  2055261082,  3727627339,  3185697338,   599995436,  3040969129, 
-   517553865,  3529007056,  4234064208,  1795136394,   437362343,  1243686289, 
-  2467281061,  1843335836,   959977301,  3663960478,  3295680568,  1220111318, 
-  1256121560,  2170805270,   932223220,  1940892114,  3248013232,  1143721216, 
-  1628403462,  2550759174,  3469516388,  2267202956,  3601463491,  3036300569, 
-  4013880556,   692807401,  3536700507,  3675028178,  3628640905,  2002065654, 
-   279309957,   819681797,    18471754,  1005840268,  2052382528,  3813482387, 
-  2677825789,  1689982705,  3529889501,   828250601,  3685388381,   461853213, 
-  1360155133,    76095453,  4147885698,  2887575765,   644687158,  3252176954, 
-  2626247931,  3999042145,  3130532921,  2201953928,   101013345,  4144462019, 
-  1079862852,   872161486,   214140893,  3670836955,  3128744093,  3170703042, 
-  2026203619,  1380204694,   374734693,  3930915650,   175910514,  1914065434, 
-  1499103340,  2758712944,  3677866574,  1641975684,   135175570,   389740373, 
-  3356392068,   215619537,  1956024069,  2758704810,  3798544863,   173566810, 
-  2643381807,  1205175341,  3506310357,  4178224800,  1954220887,  1399727337, 
-  3077774475,  3296137610,  3749643486,  4266756025,  3040755889,  1119293335, 
-  3205739460,  4168168381,  4060694160,  1803917802,   120395458,  3026060153, 
-  1468384693,  1867117359,  1282288181,  2118919604,  1795945712,  3969518627, 
-  1975267109,   822161389,  1597672019,  1253771288,   725008833,  1774130515, 
-  2643613659,  3992773467,  3156114200,  2490113908,  2464177106,  1652598143, 
-  3773369068,   278154969,  2326042011,   654006332,   205864007,  3820087459, 
-  3379671484,  1403420474,   203615383,  2997481866,  2712817527,  1652864922, 
-  3154001197,   560195130,  1909210067,  1307947025,  2765650684,  2216265321, 
-  1948851828,  2724510847,   629787820,  2035164393,  2039389566,  1716969205, 
-  3745876102,  3298712727,   461686650,  1521041572,  3071508704,  2185687588, 
-   957287708,  1421220783,  1580606778,   976966711,  3738697743,  4091584593, 
-  1442474392,   254982732,   539993576,  3110578378,  2864040060,  2849057226, 
-  2157768647,  1845068482,   993363974,   878822599,  1358755837,  3413390641, 
-  1975337227,  1385654938,    15310447,   254135247,  3194178083,  1876859460, 
-  2163081594,  2370558731,  3121426393,  2858043872,  1946123726,   456358309, 
-  3768757425,   720909099,   228698708,   634059239,  4198335536,  2775297869, 
-  1187534212,  3087354806,  1525610881,   989323473,  2926447660,  1946440382, 
-  2298900050,   463277958,   129921185,  3905235203,   344886975,   544627964, 
-  1436564455,  1889421059,  2267352460,  3304356284,  3919435505,   310729807, 
-  1969129361,  1109205133,   139405046,  3054998234,  2502438104,  3866354590, 
-  1917362901,  2421419255,  2078561314,   716170641,   959802674,  4101159265, 
-  1095755712,  3652444283,  3503931688,  3470716390,  2191461950,    54132752, 
-  1226758241,  2209853206,  2407554646,   458143367,   354558580,  1348690609, 
-  3340734036,  3818414168,   680144284,   820895170,  2199983569,  1465362930, 
-   138017016,   258651923,  3213165960,  1318329202,  1891451106,    91231620, 
-  3627709721,  1768661153,   616867353,  4002934399,   640797387,  3128981572, 
-  3229424371,  2777836369,  4073897907,  3929360557,  2768954791,  1664026861, 
-    83376195,  3903376325,  3132538476,  1236127977,  1037931888,  4259962327, 
-  3910956753,   938846690,  4005345531,  1131684782,  1457781525,  3034038563, 
-  1661069363,   141651089,    17103236,  2959132776,  2917496390,  2368182856, 
-   531317850,   687102727,  1975524024,  4056338483,  2616937271,   982428716, 
-  4207626526,  1637358087,  4286278469,  3070151271,   403269671,  2713027755, 
-   197594296,  3254609581,  1279853484,   792279260,   714312077,  4247911233, 
-  2024926911,   362350318,  4202945966,  2578417820,  2129869314,   306601733, 
-  1621935175,   460333880,  2869155885,  2645036437,  2743338111,  3802859886, 
-  2918620113,  2938072269,  2971503660,  2911158076,  2068401360,   945049235, 
-  3627622028,  1182905204,   173639968,  4140856132,   671822239,  1324496115, 
-  3374351564,  3912102002,   717356921,   661838578,  3784326316,  1840303100, 
-  3468432670,   310558180,   220401180,  3383843974,  3514323626,  3681430202, 
-  2141992183,   795582685,  3018848318,  1156580491,  3270036212,  3768459311, 
-  1074890852,  2877252745,   194989881,   358730050,   857943550,  4166873155, 
-  2860872831,  1318371157,  3656627614,  2656491828,  1284868717,  3791141223, 
-   648423399,  1022976978,  1917004111,  1905787628,  3655676965,  3134603788, 
-  1202450346,  1259306680,  3423988913,  3929111434,  2480205813,  2163011261, 
-   438166295,  1212050269,  3749341747,  2308533560,  3264493178,  1603787934, 
-  4026314639,  1877230388,  1663864980,  3449741528,  3626482112,  2739363581, 
-  3043091588,   866157095,  1621686855,  2843519138,  1884568920,  2275014727, 
-  3931279016,   956055210,  1092609184,    17951877,  4201864256,  4002085909, 
-  2515523289,  3860934496,  1169232450,  1521726491,  1312321880,  1410973757, 
-  2520708557,  4097852537,  1857061807,  1174179386,  2340237319,  1561258180, 
-  1684531457,  2882048437,  1866494336,  2624798648,  2558739478,  3407069074, 
-   646262050,  1069675671,  3041915968,  1866592548,   183190493,  1542965184, 
-  1826535636,   152601405,  1847337570,  2821371539,  3717140841,  1779261103, 
-   110347001,   283435888,  3174857199,  2255612791,  1429797412,  1329202307, 
-  1590739398,  4089625156,  1812602151,  1275264644,  3202044849,  1198643014, 
-  2798479055,   425306992,  2904623343,   263848954,  4284340206,  3722548801, 
-  1091033939,  3070339685,  3198047913,  3902856078,  3158003673,   545981675, 
-  2985330633,   876633811,  1253109694,    94384154,   692272058,  1499179739, 
-  3422356137,  1891762461,  2672861204,  2780457479,    41756602,  2258917739, 
-  2881631614,  2789497977,  1362370570,  2364386401,  2195091218,   883464423, 
-   509056282,  2287950958,  3431278543,  2040886322,  2502387403,   627170051, 
-  4157092230,   458895514,  2922272334,  2104226278,   275121759,  1057098046, 
-  3948599161,  3376828589,  1356287724,  3812522164,  1760717776,  3305570284, 
-  2174092961,  4168346218,  2035102420,   635247782,  1443071356,  3454354077, 
-  2898020621,   973465026,   322614770,  3017334120,  1323968413,  1745065246, 
-  1164531860,  3163607642,  3343083085,  1078958985,  4065370615,  2495671873, 
-   161559833,  1882301569,  3941394172,  3232377855,  3890899276,   589480218, 
-  3723658030,  3452003864,  3215944754,   247296254,  1727189246,  3356103597, 
-  2566819624,  2039521907,  2998140334,   125853960,  3265495536,  3247603894, 
-  2902144093,   170827107,  3611288886,  2182496452,  3946276277,   541117591, 
-  3782566678,  1597683870,  1959164904,  1593236509,  1192840183,  1283252461, 
-   708785653,  3272926002,  3510158866,  3526351646,  1984209982,  1643324220, 
-  3389960803,  1826389465,   450952926,  1469614210,   470253699,  1712701636, 
-  1713536107,   497318578,  1357661837,  2561772492,  1187353452,  2356437111, 
-  1615415787,  3608067804,  3327898477,   995045003,  3852931840,  3745815533, 
-  3101997058,   472626923,  3225532859,   101198700,  2643839645,  2979461727, 
-  2941265708,   576651950,  2770180640,  2133151275,  3615937022,  3610931649, 
-  4243269232,  3212787160,  1450719644,  2310703033,  1606083822,   577675791, 
-   563383253,  3998142960,   566608556,   950267885,  2235941768,  2099421162, 
-  2223486676,  2630790429,   574729565,  3696121474,  2329517872,  2262109011, 
-  2945888604,  2303402062,  3471081346,   412239111,   509418044,  3622812395, 
-  3948944446,  3205737707,   461112612,  1316234148,  4116944080,  2151267776, 
-  4152655904,   299586480,  3732414451,  2123346511,  1321585473,   736199215, 
-  3774959441,  3651802824,   984762584,  1366575777,   396205291,   499719714, 
-  4151217473,  1796859843,   138906890,  1085900753,  1249491850,  3301852372, 
-  3716533529,  2523988687,  2863672870,  1583459868,  4197589766,  4099446559, 
-   385322472,  1059326647,  1926891416,  2248358096,  2595189040,  3547261828, 
-  3284519843,   571061449,  1440147225,  2453549923,  3330490869,  2739065397, 
-   961405520,  2958266746,  1551488605,  3022383479,  4270538036,   798278271, 
-   413628918,  2806357068,  3313833886,   435413329,  3250022608,  1799635445, 
-  1310174454,  3776161845,  3453971713,  2062218693,  1237267208,  1331528156, 
-  1947278967,  3490313591,  2860131282,   206588222,  1375048232,  3377757288, 
-   423345710,  1138422838,  1453689864,  2610734110,  4294159092,  2583470550, 
-  1758322879,  2992816089,  4272730678,  2174565771,  4055426224,   285661461, 
-  3360265204,   953998814,  4271815913,  3015229715,   805700956,  2403251621, 
-  1495697410,  4080356354,  2755011988,  3411345101,  3647976571,  1514585473, 
-  3050701528,  1104705845,   314819392,  3807875145,  1706877828,  1672823144, 
-  1948969849,  2643170025,  2880940020,  4168548980,  4099118348,   433537879, 
-  2985342541,  1850830094,  3916696257,  2785423110,  1733756687,   630337037, 
-  1140575343,  3375619882,  3975812032,   926379600,  2317706233,  3288521322, 
-  4260243857,  2413223726,  3913307833,  3561958441,  3825992218,   418861920, 
-  3514809137,  3422196883,  4057965212,  1708674102,  3794705421,  2966195725, 
-   493973447,  3479541465,  3656023208,  2274396848,  1881712570,  2550473523, 
-  2703806311,  1551636836,  1156068972,  2369459254,  3011574011,  2311005096, 
-   191326151,  1863083917,  3524284407,  3498189902,  1312392465,   460255197, 
-   637087471,   909984962,  1290108561,   440422681,   169113122,  1078381091, 
-  1247778255,   545342694,  2435321079,    45738210,  4252153256,   842595287, 
-  2093176956,   712050907,   676568219,  2176087956,  3290765842,  3456005479, 
-  2785538921,  1006346862,  1611370072,  3726210469,  3509949992,  1628944617, 
-  1418145871,  1345692850,  3236455256,  2733186734,  1290470992,  2613014396, 
-  2331565150,  1197550004,   467485199,   163905663,  4191770099,  4126920033, 
-  2448761988,  1056942013,  1898277660,  2633545373,  2595237019,  1071685896, 
-  2931595945,  2249937480,  4098535131,  2538500801,  2371071958,  2525509097, 
-  2507442991,  3399829048,  1701449231,   228244892,  4143675849,  4046825986, 
-  4231233462,   737671571,  1341073707,  3109125075,  1612540938,  2786294458, 
-  1934659937,  3107917280,    61599963,   304843641,  4133676679,   538760056, 
-   918685998,   558607761,   532548250,  3682880319,   549645075,  3424647335, 
-   158364478,  4097347321,  3792482072,   796572349,  2933869058,  1608239950, 
-  3053324468,  2213129251,    72902028,  1611038901,   185451854,  2020660204, 
-   517551148,  3271394798,  3679951366,  4245855450,  1552332960,  2454080035, 
-  1656213231,  1085003122,  2981691950,   516199626,  2094154376,  1680358458, 
-  2735121941,  2036992641,  1345176426,  3141191410,  2511007730,  4103317394, 
-  1639273355,  4242624367,  2117603062,  3702964954,  1439458548,  1919160214, 
-  2259390623,  2791199540,  4081242750,  3725788047,  3403815710,  2684508392, 
-  1030315213,  3864828427,  2925920484,  1438211183,  2213997695,    71470481, 
-  1975704301,   406378668,  2900339071,  2780468962,  1970813623,  3965368189, 
-  2534173763,   199992128,   747328300,  3605804279,  1137520138,   973076932, 
-  1026229320,  3067637918,  2294373256,    80406879,  2871530472,   511375339, 
-   277175476,  3055515457,  2398565374,  3922615268,   482285501,  3570032915, 
-  3650429628,  1646408617,  4079150332,  2754723259,   159298362,  2461265582, 
-  3365038656,  1361055879,   128747275,   793417490,  3916631443,   361403774, 
-  1888436421,  1724320400,  3714797563,  1277857741,  3365940910,  3342460177, 
-  1004430932,  2158975477,  2616992941,  1767899838,  4203319293,  3262663340, 
-   708288403,   258694814,  2356087653,  3685420103,  1780499565,  2829274271, 
-   460535828,  2577937287,  1219387480,   745825903,   295703573,   329528455, 
-   322897933,  2356838916,  2712199022,  2869690061,  2458670286,   776846414, 
-  4208610304,  4087118866,  2229076407,  3670142600,  1606388095,  2605594612, 
-  3375000571,  3879505473,  1679679267,    15662360,  1864618759,  2978966568, 
-  2986369614,  1468956988,  1782555450,  2320540456,  3631671521,  3270636112, 
-   813661056,   874183637,  2280455261,   336587406,  3888887901,  3404487619, 
-  3412738677,  1401881216,   610902002,  2354806465,  2083891835,    99320543, 
-  3487081999,   862280777,  2336861329,  1148518099,  3169970991,  1890795001, 
-  1433980437,   756109487,  2026667673,  1068056336,  1778744137,  2761465093, 
-  1707702032,  2489263879,  2682296117,  3728072271,  3047144317,   800062815, 
-  2273562698,  1241727897,  2351640497,  3358419937,  2126122394,  2528160569, 
-  3194940496,  1371199995,  2702407367,  3346332277,   462092364,  3177723462, 
-  4168651513,  1812062269,  4075120195,   622474860,  1312548147,  3871830222, 
-  1213324345,  1767056513,  2733747136,  3416664955,  2081172034,  1853790233, 
-  2501930020,  3803190174,  1515545479,  2739153993,  4053427911,  3430232951, 
-  2116457790,   138388806,   436173532,  4146745494,  2373071892,  2876418921, 
-  2884762260,  1449827330,  2773164568,  1263300670,  3332919843,   450560240, 
-  3314235498,  1242253562,  2215123419,  1212134725,  2831409702,  2367167225, 
-  2697733582,  1825120570,  1911415245,   674187430,   558576779,  3308591452, 
-  3769989996,  1902629198,  2945754597,  2819885808,  1694089167,  2033343353, 
-  2964119996,  3708331848,  1871405001,  1236455639,   478216696,  2487128939, 
-  2559645280,  4169882900,  2887076053,  1473225988,  1966892138,   513250503, 
-   269913925,  2131079829,   994669508,  3685351485,  3227748531,  3664910063, 
-  2696000729,  3298361856,  2430263077,  3056985496,  2924552731,  3859509111, 
-  3896996924,   362550737,  1431798678,  1575615422,  1807027356,  1265242527, 
-  4128182639,  1514228954,  2297208376,  3710498006,   968504605,  4233508883, 
-  2898263688,  2045180957,  3735541756,  3432111063,  2598827661,  1678218023, 
-  2684678563,  3193770675,  2446945151,  2320590707,  2244185568,  2982544670, 
-  3978873794,  4133112265,   865881065,  1083241442,  4093184611,   552943935, 
-  3819757984,  2109249367,  1714381421,  1463808501,  2982010674,   446538223, 
-  3925918850,  4204838229,  2992705423,  3189304904,  2030894315,  2135799781, 
-   989184436,   607521123,  3500211072,  1589177673,  1986861897,  1327308911, 
-  1085088512,  2331951267,  4276616849,   812597839,  1052853298,   894355647, 
-  3884464856,  1808356166,  2445701647,  1955139878,  3524931434,   705181118, 
-  3816828705,  2706835090,   762652929,  4125805640,  3595524574,  1396313621, 
-  4097093995,   426206961,    37580474,  2896009211,  3053526556,  3661755727, 
-   749782163,  3786515642,  3414343756,  1432823807,  1449366270,   693337390, 
-  1133964543,  3151957080,   928700014,   318442261,  1572064680,  2158979277, 
-  4005151903,  1758536471,  3993927085,  1424892676,  2689325040,  3294617688, 
-  2363996131,  3813972006,  2858482306,  3584346686,  2658058836,  2476814065, 
-  2055648691,  2915146313,  2820740041,  3451070676,  3972768731,   281259476, 
-   186033317,  2804859037,  1150241283,  3820029881,  2687136378,   330044259, 
-  2634980092,  2070531002,  1440111046,  3332244570,  3720390334,  1411374480, 
-  1225154078,  3191309983,  3814834196,  3198706332,  2613199328,  2471579856, 
-   484913712,  3638155440,   185312631,   360105182,  1094864729,  1247816530, 
-   957408000,  1498218897,  3164875404,  4036524934,  1025319020,  3339141284, 
-  4071755358,   691191778,  1325603348,  2901994035,  2316798104,   822787110, 
-  3697637408,   107214375,  3383215531,   489230043,  4293322066,  2842585166, 
-   449007646,  3385649282,  2926971497,  3374370107,   515062067,  2909907227, 
-  3647317879,  2606708521,   374074459,  4186352954,   455692748,  3383614020, 
-  2733014285,  1133352121,   872956269,      517888,  3012050045,  3147154236, 
-  4057122541,  2826616847,  2138524164,  3484577353,  4221365093,  4255089437, 
-  2363209579,   178997824,  1175600400,  4234536982,  1530583884,  3834980278, 
-   911566527,  2265050528,   360940122,    94364803,  4238189245,  3705892586, 
-    84726215,  1876818056,  2317480582,   440059019,   530094171,  2079739190, 
-  3728965375,  3702085651,  3618165840,  3153109718,   834681387,   603085288, 
-  2426557792,   388843448,  3204650930,   539589124,  1037634351,  1662785093, 
-  1660455377,  3869220275,  3480033499,  3553036165,  3859008454,  3256146207, 
-  2776834262,  3795821633,  4056482084,   785675899,  2969180198,  1936879271, 
-  3595338107,   348370316,  2224036726,   131662088,  3138442654,  2907274497, 
-   498091237,   447257923,  1818344923,  1027828659,  1808586276,  3527018567, 
-  1605406473,  3392157559,  2923107624,  2894491158,  1439724301,  1546459118, 
-  3854724634,  4184175340,  3426652813,  1109486818,   338341268,   128817588, 
-   904532305,  2357871799,  1291424706,   359432611,  4158908180,  1817694233, 
-    26869061,  1025726185,   891872551,   821883511,    20061639,  2112313115, 
-  3796671772,  1292628612,  3644135388,  3306856189,  2005829616,  1293242633, 
-  2828008068,  4178582652,   750797681,  3285465394,   277306035,   222631790, 
-  2243729222,   602427229,   793221973,  1121676013,  2797337273,  2464012577, 
-  1159879322,   412785104,   404650358,  2273080879,  3285605750,  1830508785, 
-  3724837424,  4128116989,  4258722286,  3741389435,  2964566352,  3949403001, 
-  3041315325,   958762525,   961355645,  4006967028,  3651719584,  3259306864, 
-  1910694399,  1145727368,   917727995,  3812357914,   654607377,  1040574343, 
-  1408952308,  1348170308,  2397438522,    34378278,    44123321,  1320396828, 
-  3860152248,  4028531838,  1879369668,  2561382215,   940806014,  4046819377, 
-  2449364055,  4097372006,  1855116123,  2251930328,  4152843664,  3931098807, 
-  3590578844,   276712510,  3657235631,  3001761342,  3363205859,  1876614152, 
-   342232797,  1691662567,   584332404,    51909063,  3296052152,  2248051289, 
-  3452536692,  4276089863,  1990124566,  1621812229,  2731225550,  1913718061, 
-   441813570,  1304997226,  2842109741,  1493655403,  1023889844,  3821833045, 
-  2505129941,  2117146848,   918139780,  3682773967,  3476749811,   925996505, 
-  3200016367,  2312816131,  2812144728,  2773243526,  1265166767,  3924467068, 
-  3416597855,  1983755611,  2974713071,   162709491,  2208356495,  2288390649, 
-  3411762819,   361072914,  3921493139,  3943924572,  3199939947,   136213545, 
-  1850924144,  1275973009,  1923880407,  3539662790,  4029628361,  1572874308, 
-  1508754668,  2001789716,  2875294401,  2189133332,  2153625226,  4271836658, 
-    94958297,  2615806780,  1140008893,  1558143137,    96392993,  4179784569, 
-  4253378503,  2751133971,  2615416638,  1428039769,  3443912578,   781832818, 
-  2735657170,  1141307186,   346361612,  1821003265,  3697635276,  2247049171, 
-  2911851361,  1519406610,   291689915,  3524594873,  2441691706,  1534810970, 
-  3540445537,  2950878346,  3920128082,  1019801225,  3013814945,  3965260578, 
-  1541350066,  3890441574,  1832555512,  1992020279,  1647859255,  2078744739, 
-  2831212151,  1688154572,   440601201,  2003639553,   511547945,  3226408489, 
-  2378008770,   931952251,  2898611947,   866466197,   744262759,  1390397369, 
-   975575860,  3526808631,  2947268392,  2486714877,   218290773,   399570860, 
-  2523917057,  1465308053,    27796926,   807433401,  3594790482,  1125808775, 
-    31341214,   596018039,  3859746441,   231911074,  3538983546,  3235212842, 
-  4232219373,  3287332818,  3084008422,  2785164632,   393266110,  1022353130, 
-   728457403,  1997816423,   112400352,  1283481944,  1878619068,  1840525942, 
-  3377573154,  1681281911,  2001262943,   163032401,    68381091,  2522930394, 
-  3397124022,  3732203657,  4205235468,  1564549768,  2064276429,  3742024587, 
-  4250828149,   419329838,  1819202049,  4079370027,  1602390364,   991179654, 
-  1036587149,   406495786,  1548166304,  1079319708,  1565547525,  3735347967, 
-  3243543702,  1466094482,  3916504266,  2784035754,    91379903,  3472851907, 
-  4230763681,  2974652924,  1931830401,  1705994150,  1144685909,  3033738443, 
-  3229741194,   177261655,  4054858032,  2215035858,  3522155550,   413005615, 
-  4264139971,  4013079830,  1819577402,  3381720858,  3437681088,  2837179484, 
-  3621978521,   505736933,  2348315869,  1014886972,  1448373423,   948553084, 
-  1718127349,  3848847154,   855340325,  1837745982,   428898842,  2489677289, 
-  1291745390,  1636459939,  2380136413,  4201432142,   738571556,  1206889494, 
-   535123466,  3066550718,  3371231453,  2846524389,  3952760234,  2878661534, 
-  2269252436,    43471587,   156726593,   177546226,  2162686062,  1901815490, 
-  1397874981,  1071597459,  4156592242,  1050216905,  4074816101,  2389859627, 
-   967695260,  3124290922,  2230479164,  2777188263,  3404683898,  3339027559, 
-  3635115446,  1535443016,  1653050029,   974715316,  2398624152,   584785723, 
-  4192817174,  2393311744,  1824490277,    48643501,  3431827885,  1609752375, 
-  2206467686,  3648562098,   362499111,  4016251705,   551316992,  1689559967, 
-  2477185335,   477711382,  3783294408,  3549088364,  2529422492,   470713123, 
-   553089626,  3953732244,   961916577,  3781083231,  1683271724,  3124136429, 
-  2965278217,   404490375,  4243568010,   448151163,  2746146511,  1623011534, 
-   101737195,  2532040055,  2826385794,  4087129299,  1963423528,  4243979356, 
-  3826384581,  3272620320,  3964782164,  3661459700,  3493209679,  2762610534, 
-  2600978937,  3996567446,  2271353993,  2211713454,  3923759672,   610580404, 
-  2088482125,  3669696416,   479939773,  1878113435,   755581020,   259907757, 
-  1915658897,  2630605647,  2860978246,  1573669786,  1426622002,  1976148696, 
-  1335338916,  3757783423,  1387004366,  3766883443,   900796262,  1028050076, 
-   462946740,   155812248,  3614806524,  3204224297,  2799625609,   378328708, 
-  3398508964,  1374812042,  1356006356,  3009277608,  2387928921,  2031588359, 
-   945534385,  2671167066,  1063496667,  2288788933,  3104837704,  2806777987, 
-  4216746801,  2276977540,   117998523,   415678811,  2716371330,  3439036104, 
-  1728482024,  2586502297,  1309556583,  2942087879,   654838127,  4223311556, 
-  4106989924,  1987485739,  2126198987,  1460510598,  1395936503,  3004250690, 
-  1478007872,   312486217,   505792086,  4012625176,  3666988937,   728097710, 
-  3861757610,  1794114816,  2629423017,  3089047891,   453062297,  4146177371, 
-   888301904,   133537436,   122831795,   190757035,   581500510,  1832147504, 
-  1387292785,  3435191452,  3947157341,  1716698900,  4243147629,   714532657, 
-  2522507067,   593721498,  2372529003,  3910076160,  2510234787,   423908131, 
-   502932847,  3904991381,  3174185712,   809475384,  2924392840,  2416594312, 
-   976175868,   475378390,   805182100,  2863036491,  3709677251,  3979384536, 
-  3327552926,   102964965,  3251417135,  3850191792,   297301610,  4033276557, 
-   947798907,  1636448395,  3523653088,  2699625175,  3111204531,  1021135843, 
-   449673886,  3541064959,  2603553376,   453678815,  2856528228,   557830691, 
-   186653061,   920059950,   700839132,  3602607297,  1436684537,  3500340982, 
-  3156453070,  1490104277,  2246179536,  1586070882,  3983158916,  2263123246, 
-  3275855444,  1802543460,   119608812,  4246008126,  2798160804,  4046991438, 
-  2862319394,  1780569940,  1386133614,  4255928419,  3175839033,  1353134079, 
-   537619211,  1387352239,   956301248,  3906884464,   861434973,  2910683793, 
-   531319315,  1696646047,  1365955107,  1611965444,  3326319492,   320339877, 
-  3011995079,  2286602024,  1385431266,  3189773012,  3885261709,  3185747548, 
-  2024729533,  1654066019,  1253571424,   747573829,  3250757101,  4163730862, 
-  2505295265,  3261726829,  2648633596,  2229021401,  2618580745,  1554802773, 
-  4166126190,  3017878697,  2827467858,  3396161753,   999031779,  3330906320, 
-  2465149306,  1490100457,  2583700328,  2437792089,  3948051169,  1443282816, 
-  3137898678,   678542066,  3494845305,  2139062391,   332974028,  3928987431, 
-  3679642121,   740377199,  3061732145,   996415665,  4028983350,  1815932003, 
-  1297895046,  2940988044,  1052467737,   728020330,  3619692921,  1717510000, 
-    12066934,  3516165826,  4261506649,  2996224757,  1378250083,  2244440490, 
-   917879470,   221336436,   874881837,  3407591273,  2138706117,   654505740, 
-  3309838094,  2623317696,  4073728910,  2934925164,  3968294022,  4248920442, 
-  1853594840,  1770978727,  1311210349,  2156268166,  1800878532,  1073900127, 
-  2950325834,   599297335,  2550788124,  3899681582,    16160995,  2018578262, 
-  1975817261,  2649295605,  3624709784,   254530563,  4161172623,  3151065905, 
-  3697810527,  2191244108,  1611161648,   355572435,   792082409,   345765507, 
-    87017756,  1563147086,  4162632320,  3738562237,  2201741261,  1280130571, 
-    40808453,  2784288696,  3919117705,  1729306869,  4056076127,  3677152498, 
-  2397808990,  1789454852,  3683729364,    80373545,  1530160882,  1043072915, 
-  3592451075,  1073916364,  3265206869,   371187122,  2240230066,  3915151252, 
-  2675059713,  2594556770,  4022078332,   657293958,  1175033679,   337476815, 
-  2356922481,  2080047382,  3943022036,  3601911869,  2196046331,  2552464471, 
-  1208720469,   743734436,  3079142944,  2389028024,  1724609865,  3492108608, 
-   814380667,   241438490,   793814836,   285001388,  2297155619,    20588790, 
-  1382711336,   337790781,  3680805176,  2831122002,  3232772994,  2298231422, 
-  2149543367,  1737984235,  3725769504,   288770808,  2210374573,  4169812521, 
-    63956286,  1719678591,  1859184109,   238171106,  1064990508,  1271687077, 
-  1936294061,   445277179,  2825144182,  1208642029,   766737565,  4285704702, 
-  3024022208,  3287655907,  3339537522,  2911750988,  4000921306,  1789048144, 
-  1254361510,    84402342,   646460322,  1140631935,  3787819415,  1815313263, 
-  1549593747,   867899709,  2321841567,   148755662,   618671863,  1144028693, 
-   324344907,  1195051192,  3749285034,  1686139218,  3992506688,  2688700109, 
-  2048590906,  1094193152,  3086361424,  2725014053,  3694760662,  2603684491, 
-  3521221456,  3743862731,  3257171663,  3050593492,  3125811669,  1159137077, 
-  2200077521,   389979362,  3086292265,  1120143034,  3315000048,  3341686274, 
-  3950912118,  4039855435,  2864373085,  2486136310,   789216180,  1367260203, 
-  3049596442,  3098511727,  2625747877,  3140900615,   102292423,   752148690, 
-  4285748352,  2484707840,  1776505762,  3052596479,  3980411751,  2441998651, 
-  2236045501,  1639632774,  3214962173,    64219444,  1421128618,  3739691576, 
-  2596395686,  3547183971,  1029849252,   670474290,   585244853,  1446332352, 
-   335885360,  3920082358,  3356755647,   712095589,  4177899163,  2257338133, 
-  2810493886,   889321640,  3910417866,  1508237902,   634518118,  3055173420, 
-  2045043622,  3736990058,  2158192863,  3952353473,  3553708899,  3379872074, 
-   781480035,  2997770372,  1762739348,  3294364558,  1499711014,  2393596217, 
-  2162337614,  1553487400,  2425889343,  2111533974,  1628776743,  3243575762, 
-  1499683884,  1219220354,   488880005,  2062737681,  3025091369,  3672313641, 
-  3707089928,  1595563531,  3479544452,  2393657175,  1288632280,   347566568, 
-  2908302976,  2442597328,   486062172,    17589059,  3372962641,  2870248404, 
-  1540129081,   770281617,   439599078,   896474585,  2632690139,  2214052503, 
-  2166606424,  3084015078,  1061004492,   226212913,  3569762952,  3814270665, 
-  1379417168,  1492133338,  4265798583,  3670151311,  1672592807,   321510359, 
-   161604464,  3115150332,  3952352473,  3728184485,  2572004512,  3363831992, 
-  1491616794,   911081957,   755760932,  1855675342,  1588942717,  4131531101, 
-  4102378296,  2660753719,   252502431,    49687246,  2178361439,  2133425373, 
-  3146288312,  4256699939,  2614057332,  2547601914,  1247669635,   749809430, 
-  2956182229,  3136676260,  1538589622,  3812187768,  3697383382,   256240926, 
-  2520426335,   401343353,  3645482247,  2634187933,  1328037590,  1666888033, 
-  2996682864,  1307241901,  1213328240,  2666691768,  1114751779,  3535445478, 
-  4011234088,  2018628437,  3483032037,   459059945,  3891759239,  4001036424, 
-  3296129398,   315378338,   352085083,   194556621,  4262806357,  2337628036, 
-   534885663,  3737141071,  4134838065,  1466088594,  2691501404,  2079950780, 
-  1111432936,  2901299626,   620345423,  3270056423,  1491729556,  2708119013, 
-  1793499041,  3173162473,  2489544443,  3479855232,   340550903,  1767446591, 
-  3145400323,  4198461952,  1388015121,  1896156947,  3181920790,  2517803452, 
-  1318953964,   630525703,  2991295035,  1080577881,   611545143,  3428817435, 
-   486978079,  1968966795,   441210290,  1751885956,  2862641791,  2436312653, 
-   500841588,  3743805046,  4069655061,  3363925486,  1317073603,  3926422267, 
-  3975199885,  2168151291,   127770059,  1089391077,  2445007914,   373961957, 
-  2071546119,  1574571629,  1453895941,  1459976925,  1778451995,  3802717766, 
-   629583334,  3038956471,  2758172020,  1747626643,   200658100,  2861798143, 
-   684882048,  1806704447,  2919726713,  2284106660,   112003822,   961628042, 
-   824301090,  1215989142,  3641975788,  2575505648,   716527491,  3464209593, 
-  1669263226,  1013288899,  1665032724,  1931975050,   316793575,  2071877979, 
-   512454966,  3439878480,  1174270010,  1041851718,  1001880559,  3904002035, 
-  1004358868,  3150529223,  2381259996,  2728247485,  3934603064,   121039920, 
-   153185525,   584342047,  1173366005,  2033553098,  2801861514,  2235599958, 
-  1075115360,   217576968,  2894796683,  2752606536,  1740641241,  4108817575, 
-  3778343922,   551686028,  2799035265,  3768737811,  1271015277,  2945338557, 
-  3920149627,  1119630186,  1283646408,   798323270,  4262312684,  1669116774, 
-  3899214538,  2724845151,  1319573299,  3666457176,  3781859606,  3288904570, 
-  1350451953,  3190501201,  4068111780,  4206987977,   905151171,  3522094282, 
-   493721076,  1534467688,  2792281045,   968579745,    77123507,  2905878480, 
-  2960453611,  3194011519,  1092865246,   559679513,  2984633618,  3132835485, 
-  1933832211,  2239750454,   398125870,  2022742257,  2485324162,   979795936, 
-   470980900,  1028686450,  2096113752,  3458030194,   850226556,  3824936309, 
-     3316524,    65460415,  1902734652,   664594782,  2095623474,   401607736, 
-  2714102893,  1845804706,  3331169316,  2261951148,   113343472,  1538427995, 
-   721772069,  2192193639,   166503817,  1111177042,    65995617,  1233772612, 
-   729586223,    71575948,    90148578,   523809794,  1583475660,  3515643528, 
-  1384004592,  2906909807,  1438056001,   429620992,   961969085,  3014517166, 
-  4043161032,  2098947503,  2451931160,  2799516019,   545094994,  1238475173, 
-  2593170915,  3866748457,  3528819173,  2380965772,   447337767,  1236467702, 
-  2473516818,  2619697899,   315994078,   156938565,  4246199755,   152579872, 
-   401788343,  3536587528,  1709562160,  1858064085,   717524842,   523040478, 
-   414617884,  3737526827,   408254916,  2808605826,  1975849995,  2179067059, 
-  2095485393,  1830079456,  1714854902,  1198572305,  2065506470,  2896381637, 
-  3008308289,  4244065196,  1499136887,  2596972184,  1038487602,  3493553985, 
-  2711873059,    31754862,  3044765698,  1641376713,  2846285485,   199079471, 
-  3347452930,  1152559784,  3058541953,  3632431337,   193860811,   867169529, 
-     2514716,  1603596868,  3687154394,  2378254013,  2495146814,  3450135769, 
-   580620409,  3262088523,  2315358022,   620767116,  3484879636,  3038877728, 
-  1637220177,  2267811949,  2446723286,   525239486,   433535098,  3636315977, 
-  1262145389,  1263200131,  1488200943,  3684665370,  1529293863,  2897729843, 
-   695288290,   347390974,   207448233,  3616230342,  3662353418,  3739329119, 
-  1251948214,  2896371727,  3580082212,   318242210,   408085238,  4214339593, 
-  1216714010,   710116972,  3909812282,  1528185639,  3339776189,  2193798391, 
-  2945826062,  3066761003,  2286581711,   168083391,  1087905849,  2009302366, 
-  3894267921,  1955545254,   208422919,  3314228237,   569446156,  2796870112, 
-  3329060452,  1219644572,   786571572,   650737739,   731732695,   920639912, 
-  1321932506,   243405230,   938970359,   605389214,  2228805898,  1976456001, 
-   141913568,    31715175,  3963354279,  2584851137,  3452854108,  2571766814, 
-  2108194814,   981620259,  1002580539,  1852260133,  2524895461,  2942139251, 
-  3909817146,  3731127270,  2431013271,   776832182,   960479679,  1360545272, 
-  2214150273,   401508744,    96063330,  2937929988,  4129694238,   471725068, 
-  1886305074,  1441120254,  2725011964,  2582448145,  3177579598,  3341799743, 
-  3512026389,  1555262410,  2916999630,  3097648856,  2685535254,  1893446426, 
-   513314131,  2713607649,  2689891897,  1318996109,   590421650,  1287397222, 
-  3897943754,  3675755435,  1942401355,  1080585703,  2637766710,  1706649213, 
-    22684191,  4257774238,  3498989462,  3752778609,  2915400447,  1977452745, 
-   107718779,   793503314,  1908451988,  4251220814,  2453488390,  1342886255, 
-  3710685419,   619495791,  3206459328,  1910304858,   362282143,  1006692046, 
-  3827707712,  1540824410,  2705402824,  1271177377,   372485776,  3934353076, 
-  2168985661,  3528306572,  2376905617,  4000597020,  2307497304,  1764852727, 
-  3202492970,    66396600,  3314350288,   780262687,   799183757,  3024869271, 
-   825689015,  4100660425,  3581993460,  2068548581,   210667888,  3711016365, 
-  3098635114,  2073875797,  1836421220,  3741154833,  3266492875,  1210908211, 
-  1653512093,  2489597674,  3371265901,  2238456592,  3611705206,  3624442163, 
-  1518056403,  1450655956,  1736269339,  2699430647,  1753878088,   634253406, 
-  1508654392,   913107257,  2661320808,  1332700499,   314989698,    12913531, 
-  1262873090,  3516984661,  3532844859,   973847157,  1740818180,  3571192381, 
-  1277925485,  4011973896,  1581050153,   170296751,  3813296175,  1838798248, 
-  3977298556,  2164808817,    89749623,  3609480411,  4187715199,  3330849638, 
-  2710051884,  3882498290,  1589965393,  1991741639,  1713415149,  2581107473, 
-  1376542691,  2217132879,  3049477782,  3670503118,   358563516,  3128311559, 
-  3312828013,   389957843,   158194312,  1378673353,  1421244074,  2343393004, 
-  1662455370,   621423158,  2177717637,   414800348,   135241467,  4146551239, 
-  1619578902,  1887480454,  2917197035,  1442793159,  1219072549,   754604389, 
-  3835565423,   415273668,  2732661245,  2387434148,  3430215873,  2279452198, 
-  1642267806,  1498906541,  2209910616,  1129596382,    95285990,  3545872248, 
-   383106958,  2157259976,  3550499493,  3337967614,  1488290232,  2477694078, 
-   639694978,   877076100,  1445601575,  1668753210,  3404547748,  2888120826, 
-   336897013,  3210940590,  4292011638,  2240408604,  3301138613,  3704686440, 
-  1717494406,  3043121364,    21564582,   967912153,  1551403915,  2710283050, 
-  3637726674,  1360950424,  2715954279,  3457089116,  3026939670,  2765167863, 
-  2330656429,  4214487622,  3094960958,  3225469409,   269844615,  3203126270, 
-  3724151919,  1107290795,   332076984,  4191363694,   102740519,   761984065, 
-  2183860828,  1314125277,  4044457590,   323158199,  3937789083,  1991622054, 
-   244801057,   133036315,  3704446065,  2823117874,   991827044,    21212258, 
-  1887937716,  3246956280,  2247319682,  2642752599,   599875059,  1211985995, 
-  1835846356,  2398998836,  3093910695,  3782263343,  1010988844,  3004258165, 
-  1373711304,  1569331033,  1414889439,  1073157167,  3932303671,    49741051, 
-  1385304058,  1538733579,  2111574749,  2901872490,  3051789179,  3463411039, 
-    31163406,  2108978856,  2227078932,  1739102921,  1240405830,  1481327610, 
-  2081405138,  3293147236,  1370427207,  3182664967,  3772375199,   581726603, 
-  4232248038,   918971934,   894275379,   526092160,  4256923379,   722734433, 
-  3772217992,  2554575941,  2255969588,  1003523389,  4184080516,  2152500855, 
-  4146203381,  2171585585,  4025271035,  1791775568,  1049573651,  2334465171, 
-  2513738140,  3768503833,  1396769675,  1528629686,  3134245439,  2953722838, 
-  1598044207,  2321320611,  4015624404,  1965270946,  3263424727,  2398149864, 
-  1584470675,  3922898233,  2616541549,  3984027718,  1826204881,  3711117212, 
-  4183376577,   874954265,  3311516532,  2080602609,   405472567,  2985614634, 
-  3636819478,  3825249499,  3694817886,  3752578639,  1923446716,  1487900860, 
-   601095252,   883322038,   621241263,  3113697366,   612621288,  1225149418, 
-  1494762343,   503025891,  1235544777,  1519348578,  2362177588,  1279967511, 
-  1757441380,  4259363785,  1810727421,  3336919464,  3183112008,  2028498656, 
-  3242132776,    31659375,  3623758887,  2591858000,  3919929000,  2818963668, 
-  1810203432,  2072380222,  3351759752,  3987517782,   972654617,  2258439963, 
-  1752174374,    62115004,  1391561355,  3704708536,  1890832844,  2740967181, 
-   840928007,  2603402580,   142776420,  3023335557,  3806935061,  1298184119, 
-  1026122244,  1667428630,  1898792380,  3701936540,  4098535381,  4080823532, 
-  2113071972,  1921727260,  3453048451,  3005441683,  3670304990,  3939360728, 
-   403187993,  3601294107,  3953468772,  4188431136,  2166140877,  1562809015, 
-  2897225000,  2659434033,   546927914,   310068193,  3245314975,   241423403, 
-  1776827199,  2801830444,   906507066,  2338568459,  3761529437,   403019575, 
-   506538215,   505585672,   800299523,  3464214312,  4225168116,  1773431198, 
-  3022467629,  3320945412,  3857135627,   204817601,   242577937,   730228305, 
-  1016443744,  2553837119,   979348569,  1081708992,    89941506,  1343584500, 
-  2458785547,  1673257994,  3509836696,  3979740495,   820745412,   515741421, 
-   880819146,  2683912843,  1788493078,  3299177266,  2202032731,   886652962, 
-   179423403,  3858586850,  2095716707,  1130473103,  2757696008,  2264293817, 
-  2241476567,  3012533332,  3482210979,  4022093916,  3691215483,   703108655, 
-  2698680125,  3607788658,  4024443151,   197324329,   908320984,     9637575, 
-  1652391064,  1693236051,  2133921185,   756469020,  3649052344,  2102803739, 
-  2769861666,  1183162021,  2137200107,  4060818052,  3681765634,  1788497091, 
-  3919485300,  2195866095,   623242556,  1581853818,  1021063221,  2126090072, 
-  1845298607,   562762513,  1214571349,  2663019890,  1062802411,  1684751862, 
-  3091151126,  3059612702,   189572408,   317583614,  1286830519,  2377975196, 
-  2426072267,  2429150735,  2987005801,  1305135193,  2874458080,  2932368313, 
-  2296903756,  1413678284,  1077546648,  2867406237,  2886351401,  2035494603, 
-   474997019,  1863395020,  1718255699,  2075267027,  2153318913,  1195132369, 
-   787924324,  3553023922,  4148333585,  3803752254,  1799661547,  2515835554, 
-    47801667,  3371495773,  2368916902,  1665879109,  1058788387,  1841790226, 
-  3275220912,   942783449,   124722708,  2040147442,  2461568707,  1967907783, 
-    13130795,  3242893878,  3933200205,    42204964,  4073839779,  1807152549, 
-  1417792095,  2452654471,  4054480066,  1163240638,  2445995195,   873838411, 
-   287289610,  2271123608,  1328182145,   759882542,  3207116832,  3951537667, 
-  1974960892,   473305060,  4055762246,  4227234973,   295762545,  3946894499, 
-  3372168245,  3193065356,  1164977173,  3641858464,  3274990095,  1813334880, 
-  2419877520,  3961234735,  2325815411,  3092908291,  2545042262,  2128421796, 
-  3621921691,  2198547215,  2746820113,  2772186283,   646528125,  2697343539, 
-   784685759,   127288424,  1084707800,  2181610298,  1890836160,  1533515948, 
-  1506502563,  2373456806,  2711458924,    59792104,  2981913057,  2468360283, 
-  2606925886,  1332351261,  3742090834,  2590898672,  3267547266,  1652079497, 
-  1893560427,   751523982,  3917037392,  1377898403,  1347070467,  3232717128, 
-  3180590825,   666841499,   229653974,  1799543961,   822113617,  3776461412, 
-   700692389,   673652446,  3874558580,  4255395547,  3437032090,  1705607051, 
-    23350989,  2083638685,  2525070794,  3110811868,  1346824016,  3003557635, 
-  4034483142,  1129859679,  3649032846,   959859066,  4146476651,  2168218584, 
-  3778486668,  1587327131,   777408207,  4149013002,  1643071638,  3510009761, 
-   100288129,  2077817795,  2672567575,  1779770541,   832774645,   776063137, 
-   503469560,  2163916878,  2183834428,   800552943,  3538160306,    13409419, 
-  1832819528,   679861994,  2662674702,  1278171634,  3309580049,  1591667878, 
-  1939204083,  3960320362,     4683402,   815500119,  3049516851,  3371108781, 
-  3204419924,  3209087378,   536313401,   151443368,   467937885,  4210967913, 
-  4213420336,  3403002228,  2611343267,  1743137563,  3373494091,   971328500, 
-  2316664722,  1180314580,  3516943363,  2846444439,   372011116,  3453179206, 
-  1445170693,  2441232734,   842908060,  3291107176,  3185939957,  3062815864, 
-  1408821370,  1113529933,  4150776698,   488957071,  2838516059,  3008470202, 
-  1700439398,    40022482,  3853275673,  1026535871,   895296720,  3249310468, 
-  1744096081,  2558298090,  3208440144,   489540888,  2520363230,  2594668462, 
-  3570349540,  2338259578,  3598343603,   256756874,  2670489439,  3589275180, 
-   531137332,  3897408020,  3919715755,   522877060,  2675661061,  3879782658, 
-   818812527,  1683174959,  2490504638,  1048725597,   229313763,  3531136283, 
-  2668766602,  1897410992,   571506343,  3542950253,  3397341992,  2829203096, 
-   499828964,  2348865000,   906108637,  1823772162,  4253653415,  1955912737, 
-  3153735220,   543392815,  3404600553,  3238029055,  2969057482,  3321888819, 
-  1583950706,  1097085827,  1174360507,  2327775975,  2512347802,  2939593832, 
-  1140439468,   175802201,  3383452482,   356794648,  2802174057,   602875992, 
-  1086631341,   182040382,     3101705,  4094433195,  3607745754,  3153271571, 
-   879030582,  1405936797,  3311329627,   872155782,  3546781853,   997551017, 
-  2866064951,  1709867188,  4049622143,  3944311695,  2761718682,   133745323, 
-  1090887262,   337808075,  3126827211,   593225800,  3620991990,  3794809644, 
-  3897129348,  3088192810,  3434608979,  1631038723,  2347939594,  3581327226, 
-  1574781750,  3661477495,  3581190014,  3894993682,  1505431866,   786861658, 
-  3634362490,  1248513296,  2355296144,  1082889507,  2338128289,   198923744, 
-  1261928675,  1313963160,  2687438171,  2678000386,  2908338375,  1170087722, 
-  3166859281,   859678356,  4085430575,  3230282579,  1009173966,   810008727, 
-  3201395107,   578843415,   144272155,  3731398196,  1160157684,   404773255, 
-   646970381,  3775701017,   743877554,  2704448470,  1242685443,  1166773105, 
-  1936683389,   323629831,  4044786184,  4265423201,  3707675317,   490627699, 
-   262340041,   375369711,  1948731069,  4198472276,  3324535436,  4085535147, 
-  3513481219,  3703547308,  3557076220,  3222319617,  1108965488,  1979499171, 
-  1711528033,  3950897091,  2883535208,  2691671402,  3109131570,  3668124886, 
-  3990669342,   984794949,  4083190814,  3824021131,  3419141944,  3297720658, 
-  3654159513,  2483157730,  1065708071,   368558953,  3912378933,  2408137392, 
-  2986902053,  2920005363,  3949607045,    14330110,    76392919,  1728347173, 
-  2782417174,  2493037194,  2617486432,  2394254424,   286997950,  3586246795, 
-  3715767686,    95991893,   427569812,  2514549920,  3473484831,  3681199854, 
-  3090855141,  3668005469,  2942866261,  2524575055,  1206093435,  2066085719, 
-  2968032396,  2841813263,  3260032500,  3555854914,  1186106505,   793259484, 
-  3942365591,  4079687209,  2351349302,  1212933959,  3427715809,   835369306, 
-  1067151172,  1529320937,  4218646485,  2067743015,  2579129706,  1543175708, 
-   585922414,   698728450,  1528313590,  4178497419,    54114205,  1674397175, 
-  3772075573,  2171102792,  1296773836,  2586992321,  3359734477,   865993906, 
-  1460718331,  3060442677,   684910726,  1562568951,  1844760695,  3419402406, 
-  3237964542,  2374420141,  2796092295,   159934301,  3582268468,  2817391431, 
-  3661658050,   352351598,   126303991,  3797851216,  3134119764,  3680072785, 
-  1484185060,  3144093707,   574030143,  2021399700,   290541442,  4099298721, 
-  1765234914,  3808554356,  1298334259,  3426073643,  3254291127,  2782652436, 
-  4223586441,  1381859274,  1376454481,  2586077394,   885377285,  3432632602, 
-  2991335608,   547905044,   701128356,  2373866866,  3243953286,  3819241229, 
-  2926145961,  1329623607,  1647784684,  1667289285,  3401516058,  1349141299, 
-  4027654707,  1561364742,  1279298036,   786313067,  3574718767,  3543130189, 
-  4066163532,  3959219323,  2980919482,  2502065206,  1078006110,  1764073795, 
-  4193422420,  3057204086,  2992888584,  1291753028,   335291260,  1804936082, 
-    61260987,   116587105,  3437365389,  1770848452,   482962922,  3756772043, 
-  2232251087,  4249254162,  2116457850,  2354742158,   520184776,  4021494168, 
-  3843358765,  1707093832,  3196459061,  2921753903,  2642619535,  3923535030, 
-  1599364883,  3652955117,   607301788,  1139261082,   599754829,  2065678901, 
-  3200114980,  4166837086,   510053954,  1380360535,  1488225622,  3806625307, 
-   922073774,   700872314,  1772588067,  3346198809,    81469741,   992288217, 
-  1383255187,  3401569701,  1529247439,  3864324618,   528635589,   229231498, 
-  1867314237,  3688310154,   235121368,  1774327945,   206825308,   854099524, 
-  4252607434,   748136323,  3875407103,  3616118008,  1967066663,    90716096, 
-   486976033,  4271394112,  1493064790,   249969416,  2988019285,  1436491429, 
-  3978664520,  3029455950,  1917832922,  2979802914,  2450238636,  1435919398, 
-   988075593,  3685582080,  4070580702,  1799431222,  2559836365,   327275339, 
-  1458555135,  1628711943,  1650047360,  3113090218,  1869648539,  4202569461, 
-   495826642,  3485057846,  4085229940,  2980765675,   182717934,  1824534401, 
-  4049017235,   377974464,  2647522631,   395056051,  2983509232,  1053065651, 
-  4081937897,  1023150646,  2536924823,  2246597986,  2380292767,  2379900956, 
-  1733824765,  1355656016,  3351729503,  4084878297,  4231582397,  1854345412, 
-   454388418,  4172078535,  4281038856,  2405706692,  3049152044,  2806332999, 
-   893205420,   481967534,  1359762201,   943357432,  4043050767,   107125220, 
-   199606789,   439887036,  3768805297,  1088497127,  3106363140,  1953859513, 
-  2815360791,   850404971,  2917319651,   109072067,  2623833339,  1594427813, 
-  1068326869,  2743561749,  1781973326,  1770510120,   360772442,    80136728, 
-  2313128410,  3021844672,  3635295617,   227877902,   572651376,  2775563419, 
-  2370285538,  1957177331,  3913515636,  3488533947,  2877532136,  3126262175, 
-   135760428,  2278207980,  1387362491,  4263854361,  2377491163,  3687489245, 
-     2041796,  3050360636,   667459479,  2354324221,   673215499,  3038900850, 
-  3793298042,   947806144,   724091616,  4119013883,  3498580371,  4075428028, 
-  2928324871,  3610067713,  1388552361,  1215879781,  3344770320,  2947494744, 
-  1192537449,  3273789019,   557257912,  1326840846,  3922102170,  2359014133, 
-   463555199,  2811863444,  1831008305,  3627532481,   898763559,  3367478215, 
-  2392318915,  1268658943,  3738181229,  2080341262,    25454411,  1487012065, 
-  1260132360,  4086204386,  1133760568,  1881489630,  2772031114,  2213150667, 
-  3149138057,  2011976424,  3193325854,   491433913,  1680010767,   880078426, 
-  1651847524,  2263637922,  1581936477,   264608903,  2781819785,  2453086748, 
-  2084988692,  3961196070,   711353372,  3388177651,   473041426,  1346143711, 
-  4253651870,  1181272534,  2939294136,  2071360158,  2153692096,  1392557268, 
-  1260805518,  1937979829,   259371636,  2410686116,  1640808343,  1671300972, 
-  1004350098,   616795034,  3132353040,  1570247961,  4268986229,  3522743148, 
-    46849587,   801209098,  1589887682,  1711139110,  1546394155,   297847342, 
-  3161348192,  2746539942,  2197176531,  1418522202,  3869247144,   470296101, 
-    82527981,  1152495396,  1325991469,  2111998891,  1162390975,  1352460179, 
-  3865630517,  2529158514,  3259266496,   864765830,  1679682600,   533457865, 
-  3392908331,  1692738770,   492268443,  2947625126,  3894007569,  1876368175, 
-  3424314137,   957251729,  3213566104,  3932061547,   464673302,  1154782165, 
-   821617430,  3803426175,  4195486255,  3910494226,  1572474962,   478131238, 
-  3833252346,  2556578409,  1046275749,  3842125341,  1102920280,  2652082280, 
-  3426178581,  4263640034,  3649146676,  2001784615,  1263352655,   334767632, 
-   332346913,   751222216,   848095323,   222345845,  3876979632,  3931267023, 
-  1893051265,  4006916614,  1234451449,  1892575439,  1700625384,  1939632263, 
-  1722963537,  2660076359,  2322237983,  2345580859,   789653754,  3210043927, 
-  1034147221,    45944962,   507382246,  1180794462,  2189217167,   890874297, 
-  3802204633,   926365009,  1452412765,   713055303,   939468833,  3207942848, 
-   696992394,  1141547788,  3853435731,  3445762651,  2052171793,  1357151177, 
-   574964156,   843372952,  1635443841,  2868699746,  4218000652,  2785116170, 
-  1042389303,   913036713,   279581681,  1093185970,   570432857,  4222238893, 
-  2909900029,   609439165,   999113030,  1938268639,    11554570,  3938016555, 
-   738371440,  2852789858,   306776264,   499629568,  2357628459,  1414906178, 
-   131081062,  2208116978,   675574464,  2303366205,  1107967651,  2225477359, 
-  3908462763,  1493695408,  1338320408,  2217181054,  2508601086,   582092337, 
-  4106858432,   622396251,  1065848236,  2223864448,  1031518295,  2157999254, 
-  1247780136,   207427503,   164457817,  2972737631,  2741554477,  2617770703, 
-  4148913625,  3080005732,  3585705474,  2622502897,  1920023304,  1216147997, 
-  4021395906,  1898812905,  3877752925,  1396287731,  1169030489,  1818023372, 
-  2033079690,  4229752616,  2267928310,  3009949773,  3784393275,  1450361968, 
-  1279830355,  3642630696,  1093051437,   173114892,  3082447916,  2103774465, 
-  3501072473,  2990912276,  2228216802,  4248951192,  3377253146,  1771310456, 
-  1700580172,  3119665005,  3822908063,   624413848,   355188125,  1120944429, 
-  3550925493,  4214591327,  1825320836,  2898625972,  2771191637,  4061210083, 
-  1640620699,  1698865492,  2124736279,  4035884302,  1639303498,  2853339445, 
-   311803410,  3605744571,  3679671030,  2668566717,  1470470206,  3488633002, 
-   582108704,  1363790496,  2695833464,  3097244160,   842275270,  1617458152, 
-  2799438355,  3026421530,  2371075912,  1175841666,  3998044207,  1944561092, 
-  1854713064,  2289652485,  3009847061,  1464892573,  3189033854,  2781286762, 
-  1930362205,  2991109670,   226801480,   139003854,  3103086722,  3582288534, 
-  1052775825,  3615675994,  2161682755,   320937901,  2901545779,  2037165048, 
-  1050530146,  3945139970,  1682881745,  1459020476,  2374700711,  2353884348, 
-  1535304335,   686541308,   939726684,   688418416,  2022821440,   888772847, 
-   654996920,  4074939637,  3085403137,    87283325,  4000181165,  4043824794, 
-   341335883,  3022817571,  4167338372,  1145683267,  1951614490,   922792290, 
-   165877975,  1539065030,  1844672900,  1697257190,  1791364460,   315304886, 
-   221923618,   190098099,  4044900203,  1854012754,  3748151558,  3651003692, 
-  2675076153,  3687499757,  4248149619,  3915603122,  1534709856,  1664191752, 
-  1291574682,  3062255132,  3213693606,  1538308760,  3740171209,  1407412503, 
-  4078893775,  1033565409,  4116743071,  2732847335,  1716815301,  1908767603, 
-  3881799442,  4227655416,  3468244549,   438697396,  3593344710,  1367050275, 
-  3735847997,  2604539296,  3866556522,  2665073131,  2926350841,    35938772, 
-  2903563529,  1208855495,  3408282998,  2764253117,  1647076301,  3166744285, 
-  1971660047,  3551076825,  2428455240,  1888519615,  1280804422,  2564655198, 
-  4112651672,  4013945300,  1642979720,  1673785857,  1574236020,    60200744, 
-  3096248417,  1288717103,  2532478719,  1466109336,   560938154,   622165107, 
-   506351013,   897852712,  1603348090,  1613809326,  2596259286,  3261397608, 
-  3201846318,  3800902676,   864231965,  2360237283,     6345680,  3475170293, 
-  3883092953,   745406247,   621390600,  1293083110,   286022990,   613698894, 
-  2116265904,  3873763134,   564965411,   690663572,  3285787803,  3136607095, 
-  4177791200,  3762388618,  3418427030,   537532619,  1917696610,   169705001, 
-  1733201249,   176261207,  3103210642,   980053129,  3226301420,  4258806573, 
-  4112507004,  2776307898,  2746393332,  1468529755,  2592539494,  3570918938, 
-   890018257,   135514089,   602956719,  2401655667,  1858123507,  1872072448, 
-  2840832185,  4026401216,  2594398351,  3282233158,  2407736703,   329996943, 
-  4271874840,   483613714,  1369137827,   716117195,  1393826184,  1844264673, 
-  2759112325,  2883829767,     2480590,  2657980936,  3565382425,  2600158909, 
-  2007069980,   927760485,  2176416982,  1122183781,   682735078,  3322402285, 
-  3067557111,  1967469381,   899248642,  1874907199,  2708894159,  2595770547, 
-  3307758142,  2590833891,  3758505375,   253891497,  3311815579,  2325593254, 
-  3622820290,  1963069076,  3362103903,  3375218033,  3782650136,  1117036405, 
-  1808801479,   544236568,  1312995173,  3015679461,  1480645676,   797669059, 
-  1251367743,  3797771174,  3972829875,  3344321688,  2078131527,  3160549305, 
-  3775007816,  2427455943,  1944508892,   869650343,  3378821266,   230906478, 
-  2399316948,  2669407250,  2674629318,  4107327820,  1777678695,    99639590, 
-  1289523880,  1195228121,  2786385314,  2821712262,  2538990592,  4032256663, 
-  4016622191,  3619161428,  2932435976,  3913687641,  1701255453,   566972380, 
-   460824630,  2109814550,   790490527,   206110787,   394275184,  3096616148, 
-  1058214353,  3362897660,   787177787,   658144529,  3526005914,  1052285707, 
-   622119450,  2427416100,  2919707421,   929238051,   291115496,  1027725088, 
-  2668901647,  3316935307,  4176389565,  1076637354,   269372850,  1708686983, 
-  2475694890,  2522542145,  3682122739,  3349776634,   927916618,  2334888519, 
-  2827692690,  2058687717,  3362195796,  3883125135,    51657167,   689078009, 
-  3218608847,   728865347,  2925464093,  2003671250,  1003735379,  3602718405, 
-  2075495840,   944632786,  3213967277,  4098826170,  2975315285,   800466620, 
-  2547115934,   760943536,  3802647455,  2767894772,   913533001,  1685107774, 
-  2316339543,  3138903509,   818142540,  2937073511,  1847470676,  3239496881, 
-   166186492,   310142340,  1696678345,  1654920650,  1063958357,  3508716896, 
-  1801773393,  3688030455,  3568836867,  1567484172,  1135041588,  3074005666, 
-  3936606645,  1639900531,   929763278,  1774436730,  4264446979,   589478410, 
-  3961935071,  1838668357,  2299756985,   142771567,   148611101,  2337527461, 
-   215418761,     3269230,  2731154205,  2395400828,  2880073439,  1297154188, 
-  3617139488,  3757424961,  2170259160,   816708652,  3181804953,  1396912786, 
-  1927833754,  2179410075,  2879300559,  1754540907,  1796744416,  3721117123, 
-  2623291922,   208027287,   549889188,  1399567058,    30146696,  1698993952, 
-  3128068118,  3885983450,   317575630,   999830038,  2797866322,  2176587944, 
-  3313574128,  1526137343,  2274731429,  3215875548,   987460350,  1459676295, 
-  1675086863,  3493318971,  2593334218,  3288807360,   238168904,  1098377394, 
-  2653562772,  1295856234,  3582183705,  3575390346,  1928207838,  2337339229, 
-   618052329,  2842109057,  2395260623,  1887959526,  2705324184,  2449573559, 
-   507515775,  3073453794,  2216274011,   376663573,  3244903214,  2536072933, 
-  1426696030,  1758462139,   149672932,  3568593310,   611550209,  3863555440, 
-  1455701532,  4029061903,  2200617939,  1966062588,   356623682,   122744758, 
-   368599308,  1070395790,   477923585,  4126711935,  3519457576,  4203708093, 
-  3168759633,  2248754443,  4231207678,   848469844,  3814747757,  3970179742, 
-   368674778,  1458121299,   382045627,  1789972446,  3497656057,  1705314540, 
-   298898310,  1341056566,  3087298239,  3850437645,  2274780710,   830462077, 
-   208271989,  4184699750,  3179847400,  3273493377,   776548522,  1817274192, 
-  2350022119,  3571469708,  1804722503,  3156914053,   356325422,  4092827988, 
-   164963702,   401970030,  3841570621,  4180284953,  1520196402,    21071429, 
-   963519986,   355172358,  3317352671,  3207360414,  2229223179,  1613772667, 
-  2752937128,  3068639960,  1233053601,  1858883070,   219383089,  3993360845, 
-  3374487978,  2485593820,  1048106818,  2052727658,  2676596761,  3307544509, 
-  3070445494,  3152448612,  2579826040,   695449110,   259113202,  3837218296, 
-  3075736764,  1065802865,  4017388059,     2842866,  2451831611,  3003283427, 
-  2293769936,  1671255986,  1719658505,  1748610858,   601557983,   150874363, 
-    42529667,  4000879259,  2711109236,  4080337904,  4216975543,   185672049, 
-  1685896893,  1339225478,  3351176036,  1367783485,  1366102031,  3914244108, 
-   639606301,   345968087,  2916220080,  3638169527,  1465014828,  2573588251, 
-  3273285978,  3980748234,  1663324196,  1879149901,  1394835951,   644399967, 
-  1479576161,  3430198891,  4051088940,   149371852,  1410206760,     1330296, 
-  2324549187,  3198382076,  1087044343,   324216600,  4080324098,  3522724594, 
-   690012769,  1196759464,  1922169286,  1628485151,  1563531778,   244039866, 
-  3644103779,  2642246287,   217599930,  2255266157,  1371490456,  3858695670, 
-   500761938,   465753099,  2861968623,  1554093764,  1354198834,  3490748439, 
-  4120859676,   438683041,  3814379177,  1961366507,  2132142445,  1676187692, 
-   621776921,  2230295139,   975324151,  3884471070,   544233752,  3346276171, 
-   329818826,   461504987,  1603109350,   637802922,   593071538,  2134002510, 
-  3879515579,   667303884,  2451978409,  1393843399,  2382141994,  2609856037, 
-   770872536,  3773105973,   673821735,  3168740014,  1318666896,  3610558569, 
-   952471726,  3322107916,  3439894581,    68442653,  3843670519,  3980018954, 
-   259114608,  3588127575,  3529479491,  3505853365,  4012435004,  3026617956, 
-  2636376238,  3719062431,   339446789,   406183493,  1950400260,  1169841020, 
-  1610931651,   413767286,  3408530001,  1527536503,  3541419848,   357714364, 
-  3945572522,  1857909111,  2692138445,  4134824339,   672347115,   510277697, 
-  3995120300,  3155630891,  1627550848,  3221837406,  2776308055,   923096078, 
-  1698805119,  3099842115,  3878546311,  3937648481,  2809278983,   418197985, 
-  1486109875,  3887473942,  2716347713,  1605006067,  1624038292,  2756050211, 
-   225105283,  1028800446,  3475530378,   341271471,  2907536336,  2910932183, 
-  3545884116,  3309795498,   991686561,   564783151,  3558089046,  3891571025, 
-   202084856,  2441080321,   129381008,  2076003667,   118976818,  3806834018, 
-  3182598945,  3847944104,  2759140202,  2993434969,  1117601657,  3160120571, 
-  1746214215,   579986143,  1509635152,   935115445,  1930302314,  2513226139, 
-  1456218620,  2085751699,  3041693709,   736956969,  2344944359,   217577751, 
-  3291421244,  2934942981,  1668663484,  3291173909,  3316966504,   471708902, 
-  1847097090,  2665904752,  1272046789,  3726570993,  2209771083,  2683735885, 
-  2399988057,   718141726,  3534158837,  1677278983,  3309727307,  4196707511, 
-  2474423727,  3521145916,  4206415637,  2903580645,  2712725934,  1570641375, 
-  1114540064,  1195180935,  1108731799,    17834540,   465679789,  2199602244, 
-  2184032872,  2993596540,     1503437,  3262524033,   596861666,   275427392, 
-  3620318531,   771006407,  2080164336,  2147113062,  3661429719,  2251740994, 
-  4208107872,  4121995796,  1475281086,  3498303128,  3146027697,  4269589824, 
-  4082505684,  1768974574,  3250666738,   316703888,  3806236258,   322006092, 
-  2414543335,  1723174751,  1692883840,   648239540,  2068454105,  4277783817, 
-  2533342792,  2501261432,  1464338528,  1738464961,  1349601166,   539987597, 
-  1396239695,  2758328465,   284381783,  1636306355,   329655441,  3351600675, 
-   736443890,  3695781118,   759702983,   605218164,    21536437,   522628879, 
-  2185344559,  2237209836,  3358058594,  2997095454,  1285959823,  2216767424, 
-   334896980,  3032082052,  4094556806,  2070002722,  1758368386,  2617495794, 
-  3414120853,   868647336,  4052723461,  2977817617,   390953142,  3647492287, 
-  2574408321,  3537645876,  2369047158,  3497447836,   598763565,  3632418827, 
-  2324135550,  3120311989,  2601128622,  3918630401,  1164649626,  2126414171, 
-  1453666316,  4030619828,   850572919,   965394080,  2659261926,  2415296821, 
-   177173088,   661896891,  3619468491,  1646681068,   283441056,   282422750, 
-   201861255,  3409420101,  3476382386,  1934725396,   271477161,  2364371452, 
-  1946815292,  1740659679,  2669638959,  1272400126,   216348489,  2521753111, 
-  3423553428,  3798003651,  1450185487,  1053018491,   897229945,   566751710, 
-  2522142439,   830160333,  1007761571,   345858381,  2121029578,  3628056712, 
-  1031862387,  2654888856,   608158510,  1789534136,  3404350121,  2230366848, 
-  1543977628,  3789276855,  2490073621,  2072188863,  3456628587,  4100883686, 
-   867204797,  3143622897,  2551098109,  2504897239,  3903285237,  3714919334, 
-  2081687743,  1804936113,  2827165971,    77018555,  2505851711,  1638347763, 
-  1525589599,  3225376838,  3181962177,  2789034574,  4118174379,  1660668243, 
-  1295727616,  3150830358,  3722825428,  4249187686,  4073912214,  1732936728, 
-  3025188318,  1334075588,  3896519965,  3746875801,   104798441,  2917919891, 
-  3594844075,  4006954007,  1955713621,  4284920668,  2327842329,  1093740265, 
-  3928623688,  1272215644,  2178842464,  2952883863,  3436298067,  1693778013, 
-  2984170039,  3051903508,  2821554305,   435553428,  1986501397,  2427230281, 
-   279906663,  1763244069,   101646473,   208013378,  2073078991,  3772022654, 
-  2982285860,  1706549035,  3903674422,  2962947084,  1163377284,  2924475994, 
-  3443227552,  3143271070,   779993129,  2345118597,  3769384258,  2013495156, 
-  1083941101,  3117044642,   749533157,  2742069589,   849872669,  2693327295, 
-  2677112011,  2084777643,  2043282502,  1939979050,   714600537,   746454314, 
-  2412545716,  1643473590,  2642757509,  1008186397,    80625984,  1254156026, 
-  3131627771,  2509125982,  1316794564,  1318704776,  3876301093,  1238338523, 
-  3933832617,  3670412191,   995513498,   400518961,  1533539966,  4078579406, 
-   818133061,   651155570,  1509584511,  3166327006,  1396807417,   918016699, 
-  3931370556,  1972980979,   877635820,  3835710738,  2208305877,  2080855187, 
-  1099018573,  1515657755,  4145648841,  2541980756,  1594746153,  2090026899, 
-  2967896065,  2561461947,  1797298658,  2831059215,  2646651551,  2288194329, 
-   908693869,  1857415010,  1532161358,  3024462301,  1693461776,    79075300, 
-   919961845,  3340853061,  4128840528,  3682390845,  4023750072,   105440300, 
-  2831166023,  2808100436,  4150837974,   691753058,  1570847086,  2528779478, 
-    68023431,  4252460112,  4268260517,  3706441632,  3312113208,  4227509932, 
-   894726355,  1972388719,   719552483,  3742516938,  2805304517,   226936161, 
-  2962073332,  3115103910,  1646818155,  3155250514,  2105670403,   659379270, 
-  1613575716,   777043902,  3631744181,  4095976031,  2116231440,     3626412, 
-  1099460807,  2003112351,  1397006443,  1003972663,  2250823748,   429997808, 
-   474919506,   423390056,  2121690662,  4041807778,  3335848848,  3126831695, 
-  3283779096,   239072498,  4057193121,  4056002679,  2486265979,  2205395867, 
-  1309969795,  3371573915,   657119019,  3870115297,  2786557571,  3347636691, 
-   220625560,  3412463559,  1744537096,    15989042,  3191555556,   368047164, 
-  1124504196,   316566208,  3475317327,  2009907227,  1045598433,  3764185806, 
-   455579890,  2293279126,  1853312369,    32258893,  4124729612,   221895333, 
-  1822887240,  2037746727,   962615140,    53529845,  3586011121,   976676982, 
-  3145413080,  1924972578,  2003371821,  3589034870,  3525072402,  2625995030, 
-  3126901697,   523413302,  3619917019,  2113235924,  1043190288,  3217718764, 
-  2619753968,  2488479511,   876219341,  1573586338,  2275934390,   875850908, 
-   915739955,  3450772582,  1765605177,  3771999494,  3854347636,  4204435846, 
-   233185879,  3416988350,  1163749100,    97277578,  3889391818,   308367808, 
-  2218167158,  2011639805,   195416176,  4261042339,  1562619514,  2159757354, 
-  3645257021,  3201103236,   981797588,  2291860436,  1330989960,  3318328943, 
-  1795035367,   381770682,  3221152706,   650892107,   103842175,  2949918184, 
-   757909689,  1906063367,  4141398971,   519893878,   224120810,  4157240216, 
-  1957573065,  1779451099,  2543197762,  1073753573,  3479971616,  1299313869, 
-   533431803,  1067724519,  3776478281,  3184511435,  1941930785,  1387090114, 
-  2162948432,  3105156134,  2369639917,   896627413,   218358617,  1477194268, 
-  1031000455,  2396448221,  2490989033,  4196502274,  1259175729,  1331974132, 
-  3749213960,   952866165,   191845742,  2368068740,  2431703601,  1852664524, 
-  1961670375,   214627726,  1673135785,  2543607364,  1655005383,  4127703964, 
-   224915289,  3722304774,  4219689630,  3333245169,  1591450854,   700664928, 
-  2465264506,   785722989,  2187552717,  1351524747,  2739970999,   296880280, 
-  1650399594,   428874098,  2722002958,  1743389779,  1604639911,  1353133153, 
-   487612610,  1639639306,   122479662,  1172942412,  2757683159,   374846565, 
-  2215772670,  4135118603,   725120441,   658571992,  4213927030,  2553006517, 
-  3221591950,   455274252,   180070755,   942205834,   242917979,   586793061, 
-   357200269,  4156007225,  2917028900,  3694439123,  3223106814,  2135781803, 
-  1117909884,   710108780,  1317673093,  4067381929,  2290715269,  2931884944, 
-  4196432398,  4254239373,  1890838555,  3893214738,  2037322365,   505864049, 
-  3630019594,  3193421776,  3777674602,  3996722307,  3765322030,  2604704351, 
-  2881039189,  2869847604,   670700987,  2732785901,  3678423208,  2820240182, 
-  2338739206,  1083480656,  1222358943,  1761145546,   219687022,   116595797, 
-   407987816,  1413591304,  2506094865,  3844189797,   170074682,  2794915467, 
-  2462532417,  4153055541,  1525064872,  4241239840,   767588558,  4019114328, 
-    67561173,  1650591980,  2633856103,  1807587052,   943862069,  2997934887, 
-   727582546,  2112952427,   124104960,  1177453476,  2492978146,   470864599, 
-  2720953903,  2416144996,  3402133229,  1080700331,   719606378,  1813042789, 
-   162295719,  1092411544,  3031254251,   414452860,  2029190845,  1348745524, 
-   155697799,  2427165886,  1616982987,  3597466902,  3010863936,  2153853916, 
-  1320340305,  3128921417,  2908524434,  1599411178,  2698783991,  2647687804, 
-  2869700017,  2571740055,  2800297398,  1322384787,   876757632,  2942118654, 
-  2781409191,  2472585396,  1867700531,  3805404674,  2968237672,   789371296, 
-  3304578755,  2661610922,  3360696499,  3271866618,  3328529970,   996981350, 
-  3182930850,  2623650771,   397535373,  1749667822,  3788465243,  4011973238, 
-  2014843361,  2493258703,  2512579317,   641543304,   541334562,  3708818643, 
-  2153487002,  2900277322,  1584863339,  2183603449,  3518714330,   246101321, 
-  1863370762,  2408004535,  1139321324,  2199729440,  2739995238,  2416264218, 
-  1040164119,  3331515481,    61948308,  3308121983,  1617201855,  2738389396, 
-  3590095218,  1034575804,  3907067629,  1878724566,  3588171882,   155795010, 
-  2666339996,  2999696854,  1462865171,  3266119219,  3652657561,   944336831, 
-  3912645642,   325804986,   933691370,  3499675386,  4212155053,  2833359901, 
-  2597075238,  3395406047,  3996465295,  3837998255,  3164147144,   951865272, 
-  1505694411,   620863900,  4259725225,   294410437,   305902871,   940694605, 
-  1425387125,  3478067031,  1468961418,  3581165196,   167679207,   694007124, 
-   112379598,  3050367619,  3022979473,  3618171030,   511819809,   332616205, 
-  2872613806,  3675118623,  1497753198,  2823436524,  1372737283,  4243712551, 
-   347630165,  1867015948,  3696015714,  2974843401,   263257110,  2569712968, 
-  3100385724,  4124176363,  1533260067,  2822614514,  3631167971,  1342699859, 
-   912519677,  1197877025,  2235838792,  2540566857,  2233417811,  4290537510, 
-  2564381045,  2791570943,  1227815967,   596519170,  2485469478,  4196056950, 
-  1523020780,    35467141,   190935531,  3724207311,   372041142,  1529684650, 
-  3577865538,  1623997061,  4288248098,   418290121,  3129242553,  3200990004, 
-  1814306160,  1947417404,  1979607120,  2188945102,  3522953813,  1385134463, 
-  2708861197,  3447365474,  2392145184,   524869465,  2040518402,   624721550, 
-  1186693030,  1139582014,   230504793,  3515398104,   462739752,  3999253829, 
-   413069765,   721397849,  1035183844,  3099984072,    68423579,  2606079307, 
-  1678277572,  3396544530,  1849961135,   765015602,  3110392444,  3907287564, 
-  2145657214,    55859044,  2390246638,   771119666,   822137710,  4014589289, 
-  2326073959,  3079053923,  2861325685,  2150057021,  4228544353,  1364826409, 
-  1258299838,  2489283146,   978490627,  4205108009,  1448409887,   686152009, 
-   208695145,   520829507,  1839891194,  2708468370,  4187747247,  3621780372, 
-  1960631648,    37366821,  4054306004,  1633559294,  1301168639,  2208253962, 
-  2278814101,   358290696,  3179050263,   383974607,  1380665496,  2314073504, 
-  4254483209,  1986502827,  2931036446,  3904073669,   201817629,  2277387506, 
-   646721378,  1865990730,  1026940897,  3376873381,   899939963,  3322732024, 
-  1527761746,  1130592117,  2335861187,   513313144,  1097423893,  2631958305, 
-   992846066,   232653380,  2563708221,  2649375134,  2864882711,  3700941846, 
-  4077827577,  2920728188,  3507359416,  2179521571,  2306971098,   809776853, 
-  3274124329,  3828711752,  3270143264,  1127342546,   680564670,  3411765558, 
-  3529237920,  2039723458,  2503812316,  2739699807,   114340233,   210062844, 
-  2652203423,  4159425391,  3091655358,  2473119872,  3637919551,   457537125, 
-  4246328476,   975717071,  3170564029,  3398499228,  4050636773,  1692951391, 
-  4243585814,  3456049183,   202656270,  1686083067,  3116843769,   468441263, 
-  2363931921,  1374838407,  2101331551,   709300340,  4183493481,  1734352294, 
-  3043589623,  4110437448,   443850481,  2870911437,   786424008,  3930398580, 
-   749115973,   285801861,  3602036336,  1516309758,   778202363,  3246909694, 
-  3867313184,   482687323,  3213063197,  1115776609,   337062666,  4020964179, 
-  1958272382,  2135558669,  2722935298,  1573008490,  3329406933,   569056031, 
-  1886066680,  1401764720,  2289974766,  3405676187,  2873411279,  1279948187, 
-   191835273,  3570292328,  2739440465,  3583464580,  2031502200,  2363866172, 
-  3534636706,  3779518582,  3283346779,  2312913187,  3411189966,   868310468, 
-  1546666068,  4160841520,  3542543037,  1159113512,   410075091,  1070024445, 
-  2431941861,  3656179546,   739621984,  2557770598,  3505084676,   882570192, 
-  2550334069,  2615722555,  3783638032,  1877963153,   759303309,  4003062519, 
-  2848807520,  3356709819,   262799430,  2940936914,  2583244711,   877543911, 
-  1696905641,  3401678142,  2686891823,  3569052673,  1106923253,  3310214956, 
-  2676843829,  4172547795,   840976166,  1810386357,    22264254,  2096144443, 
-  2617397749,  4171744504,   964377160,  1871279524,  1379769187,  2532617296, 
-  3271411605,   628971537,  1908686796,  1650391430,    97811955,   590386798, 
-  2186719020,   684951814,    70614399,  2802963686,  2455731039,  2773852433, 
-  3480014721,   762047691,   231046970,   142763535,  3945566200,  1578782381, 
-   227973962,  2645127324,  1359943596,  3227790890,  4216332459,  2321914330, 
-  2888427757,  1253885199,  1098385202,  3842630916,   461909627,   907030743, 
-   655796731,  3373876879,   675492060,   315370362,   172558070,  2762946361, 
-   490802624,  2470305633,  2377236771,  2405045804,  1413152660,   174251967, 
-  1875735925,  1109155793,   458015941,  4210838315,  1294218121,   828833258, 
-  2536468455,   684639323,  3134095077,  4254112643,  3721315931,  3379099253, 
-  2334536829,  2845497085,  2856264542,  1414817307,   646967581,    82678989, 
-  3912523245,  1858821822,   351588924,  3543498289,  1296514444,   479207921, 
-  1117778203,  2247609686,  3171173257,  1844118378,    19353846,  2280389631, 
-   549201500,  1846140593,  1266949037,  3645967944,   511482370,   740633109, 
-   260621290,  3877073842,  3791513266,  2504083770,  3314913040,  2649065641, 
-  4152199714,  2089462015,  3802349030,  4086059536,  3959681843,   827507760, 
-  4159612254,  2690182092,  2959557472,  2563233928,   780622379,    54530154, 
-  1856749426,   947550616,  3048906898,  3465543642,  3711186129,   152295568, 
-   172087877,   155004258,  3939748881,  3835236796,  1274610017,   583474983, 
-  2709423679,  3356071243,  3215116679,  1342947087,  2499224684,   497971959, 
-  3731178378,   773773701,  4006524505,  2846047778,   968952917,  2787617227, 
-  4201028091,  4091002586,  4265425445,  1318033300,  4143156496,  4072608233, 
-   802220053,  2445239091,  1605637731,  1035634735,  1042468626,  3170309109, 
-   869797034,  1307338271,   512063690,   893584336,  3988070670,  3686065134, 
-  1666673191,  4130141483,   847414206,  2182783815,   586600570,   387736680, 
-  1346271847,  1914648694,   821359755,  3963376622,  1685600386,  2515434113, 
-   335636533,  1023393887,  4288202614,  2301022341,  3090702178,  4258112055, 
-  4288723320,    33819328,  2616127417,   473062509,  1427302590,  3979563803, 
-  4119810635,  1305720257,  2831303608,   329303814,   366776855,  3088611834, 
-   905290244,  3487699468,  4237463361,  2048991331,    10024471,  3684629735, 
-  1804633736,  2444596873,   692222236,  3714463229,  4125067171,   716444806, 
-  1269577562,  2707328189,  2401978310,   113299741,  2873936898,  2162302233, 
-   809793850,  1132020277,  1218664579,  1190935378,   310480482,   138704657, 
-    57956049,  1201232933,  2478475132,  2201870930,  1700474603,  1143561230, 
-  1940871315,  4196106099,  3938570320,  3773900174,  4069790082,   400942965, 
-  3862387683,   766178761,  2596720858,  1657087186,  1204415352,   433061690, 
-  4061652283,  3489090088,  4006146763,  1781603204,  3354129701,  1848900803, 
-  4169055395,   569900187,  1165876612,  3037476610,  1051861998,  1948207844, 
-  2689904865,  2297915125,  1896535449,  3890027826,  3225361313,  1601295295, 
-  2954071319,   223891976,   818091164,  2366328931,    83761389,    62327569, 
-  3398147641,  1638891298,   356734939,   384210175,  3414239279,  3049846091, 
-  3413339223,  3476258090,   325848202,  3489476129,  1022914023,  2042435810, 
-  2199830771,  1154819782,  2831778561,  4210951777,  2191524056,  1056911588, 
-  3373554072,  2215508080,  1803306426,  3204234287,  2758210820,  3692876303, 
-  1422359834,   225707181,  2537523619,  4106196113,   979077313,  1050722712, 
-  3977106887,  2911524930,  1375777321,  2154609570,  2333818045,  2494725553, 
-   548794766,  2441962636,  3364688808,  2111838446,  2552272974,  2511824288, 
-  3570244822,  1039735334,  3819544509,   985167096,  2124540096,  2508766510, 
-  1590090628,   771748805,  2264089972,   776062418,  2058468193,  2249444211, 
-  3906777343,  3764268310,  3972977445,   819788313,  1750758536,  2741360476, 
-  1274235776,  2021846813,  3000849409,  2193912230,  1567339589,  3254652838, 
-  1254346223,  1504398142,  1095823238,  3268303753,  1542151081,  3616611669, 
-  2177812219,  2133455746,  3938379118,  4173456256,  3897271424,  2123300516, 
-   138498510,  2959674020,  1348309779,   946708347,  2930265499,   297693870, 
-  4001151325,  1700317661,  3665628621,  3815847602,  1954509275,  1819973957, 
-  3815117054,    73965609,  2632192999,  2590758545,  2148543140,  1892976432, 
-   317884454,  3865311206,  3223562307,  2129785149,  2360078233,  1881120974, 
-   187030190,  4022518564,   999629031,   694564150,  1712985362,  1853156788, 
-  3487372306,  1098217655,  4017721166,  3445106028,   982438295,  1025449532, 
-   635865901,   857640764,  1637868814,  2501310490,   863302320,  2249062984, 
-  3561311937,  1119407453,  3563257393,  3773274996,  4151032147,  1603348956, 
-  1222431378,   702111578,  1147678182,  1085106214,  4024919908,  1701032362, 
-  2051904359,  1859980130,  2045433328,   175625665,   477750785,  3656853485, 
-  1136606510,  3320877149,  1866858575,  1993485452,  1543364090,  4069935602, 
-  3493983242,  1591522273,  2938805989,  2868080362,  1070720513,   968163602, 
-  1893157857,  2484273910,  2455926105,    86268852,  3645523623,  1358704102, 
-  3897900713,  4189161979,  2571407985,  2719733945,  1643540600,   697654290, 
-  3585589808,  1453978133,  3025851832,   201316095,  2866047223,  1059158952, 
-  2504854525,   573247180,  2471773855,  1535003058,  3076388028,  3815462960, 
-  4201078729,  3584122296,  2840140890,   786919285,  3345893755,  1583716368, 
-  2540959684,  2385394395,   321642472,   531898993,  1850738308,  2705426220, 
-  3468522011,  3434666872,   645786674,  3930338365,  3321498271,  2848981811, 
-   840617124,  2652601116,  2046027798,  3415112107,  2460574221,   840432863, 
-   542505773,  3852708237,  2561534593,  2577443986,  3119112506,  1261835727, 
-  3764785600,  1670648827,  1401532756,   925380269,  2489416723,  1768343393, 
-   564101246,  2698569539,  1875836636,  2819148026,  1316574416,  1241963220, 
-  2514494302,  1063437575,  4218263898,  1264822421,    88118462,  2234745904, 
-  1805333683,   907457358,  4017261531,  1860636695,  1058364820,  1247150663, 
-   103110603,  3374220947,  3361341383,  3429733418,   354978403,   932425768, 
-  3803955174,  1409151939,  1913826333,   622959256,  4128094413,  2182010234, 
-  4183870317,  1497611475,  3639473171,  1148570273,  2188396658,  2834952296, 
-  3991641771,   844734304,  1197636855,   935172297,   960063985,  3765444863, 
-  4241008628,  2109286454,  3482474606,    89695813,   620283821,   331546052, 
-  2697111198,   891197725,  3423609035,  2875853635,  1763653320,  1312682418, 
-  1914855404,  4209658751,  3783887855,  3153623635,  1305818410,    17114971, 
-  2663518136,  2730577064,   525447689,   271910469,  2436834748,  2495035169, 
-   156817535,  2610658424,  2878338330,  2176021448,   891867770,  3117756665, 
-  2937776138,  1157001214,  4120413784,  2964621339,  3369893396,   732521336, 
-   376581698,  1954648762,  2082519729,   853660309,  1620989685,  2317389306, 
-  3207232392,  3809395766,  4195614328,  2595473452,  3389418163,  2953176689, 
-  4288937804,  3203595099,  3618379199,  3818544258,  3720400287,  3171395111, 
-  3973498529,  3892496216,  3324919243,  1356384494,  2325687959,  1583800423, 
-   318010832,  1654336712,  1977332394,  3495858733,   202118648,  3446701617, 
-  2511701033,  3769728678,  3586628014,  1440247900,  1180062766,   356790604, 
-   442738339,  2276307630,   958545842,  3528319801,  2944210116,  2908303062, 
-  1846489988,  3508792529,   480270951,  3547075849,  1877452074,  1597704066, 
-  2327544145,   718699089,   349343089,  4101628907,  3318928407,  1089117499, 
-    30564969,  3328478634,  2982489270,  2117094581,  1373799406,   263227994, 
-  3361309480,   167160432,  1101044675,  2483331578,  1222627656,   888813516, 
-  1343694367,  3729198232,  3607858651,  3637921829,  3215870119,    44217842, 
-  1257629005,   782190829,  1721403379,  2964991173,  1650991426,  1200043165, 
-   242566874,  2942243157,  2933369527,   141121326,  2978896897,  3592371705, 
-  2118629504,  1401152624,  2462099872,  3757132841,   397460806,  3471336679, 
-  1779707878,    39593611,  2372300775,  2224875850,  3861154071,   100240285, 
-  3070499165,   168593313,  2898823963,  3169288205,  2674314210,  3374346002, 
-   264417509,   458378468,  1456522872,  3178255554,  1731679649,   852404730, 
-  2685659093,  2922903994,   450792786,    26433501,  2739703862,  2396286722, 
-   805017723,  3010461951,  2971214905,   118475090,  2899871671,  1568805684, 
-  1647747743,  2728376881,  3763135225,  3375428774,  2499572705,   915558698, 
-   711508597,  3942011041,  3566721754,  3786898948,   982451357,  2710072666, 
-  2720839255,  2330028525,  1201182642,  2499459274,  3664913011,   693573160, 
-  3909677717,  3724610663,  2598319070,  1933861059,  2311987432,  1080305611, 
-    33429679,  2716109264,   129622104,   773652348,  1447988245,  2250933339, 
-  3151776277,   531724888,  3041475641,  1794016008,  1373471758,  1197813532, 
-  2302961675,   174415600,  2146892934,  1386078430,  1266055834,   156769215, 
-  2261892721,  1666646131,   129324849,   955472930,  2635087848,  2592646000, 
-  2527017494,  3185439803,  1688712983,  3749811500,   136310800,  2027146350, 
-  2021672757,   132623461,  3401928488,  2955990578,  1425958156,   824906946, 
-   292224579,  3078143660,  1892179490,  1095913477,    71798226,  3483864242, 
-  4127113667,   359666881,    40864393,  1157020310,  4294036359,  1627771053, 
-  2626002378,  1327701109,  4066528717,  1421242015,  3180442396,   803912739, 
-  1287847722,  2604534081,   466044786,  3254788496,  3352812074,  1106912115, 
-  3871592228,  3771689588,  2934666145,  2966416871,  4253297767,  1735028203, 
-  2212236928,  2048220512,   928831272,  1588042763,  4070781585,  1966095581, 
-  3854930059,  2538441388,  3575402921,  3899618852,  2766123465,  3584557372, 
-  1811166888,  1682484318,  3846560467,   155187066,  3046467351,  2592975774, 
-  2742361786,   607779983,  1530109487,  2140610917,  2064203190,  4076701084, 
-   481148453,  2315137312,   552533149,  3955749830,  2403472653,  3105217329, 
-  1220291660,  3315389545,  1410069440,   570619348,  1506876991,  1261779049, 
-  4173668761,  3281100745,   767380306,  2753213563,  3511045000,  1375074130, 
-  1203047952,  3125111446,  4090412561,  1709348698,  2534661971,  3569025501, 
-   831698681,   331527542,  1796082631,  3878061683,  3690848975,  2513328516, 
-   155931633,   541011996,  3394449786,  3418372970,  3481901127,  1420202423, 
-   107182653,  1815037432,  2047849696,   153576322,  4200671627,  2198036594, 
-  2173249394,  1938688377,  3823315566,   217045242,   844388138,   146744017, 
-   742419591,   617452152,   384196514,  2320170690,  2504826870,  1911450066, 
-    57643038,  2465011853,  3804966549,  2522794292,  1843507232,  4156487382, 
-  2816587394,  4144373258,    78093411,  2009836109,  2870566522,  3115176965, 
-  2804775404,   652473152,  3171544191,  1399563897,  2911184377,   571383239, 
-  1474422304,   638901859,  3998814419,  3971209678,  2836512868,  1228402489, 
-  2919269344,    67214752,   379650938,  2848457846,  2086588724,  3277261050, 
-  2331111753,  1721215232,  3212212695,  2464599642,  3813719032,    20759042, 
-  1434885143,  2254068110,   328405224,   872307308,   921816251,  1555098156, 
-  1635105806,  3657085387,  1345423291,  3675231874,  1008171633,  3402990860, 
-  2459868225,  2802471264,  3245238860,  3584071518,  2627185242,     4647622, 
-  4230329233,  4228211955,   808856459,  1455436717,  2009778913,  1197065984, 
-  2795085678,  3756504463,  3939318246,  3525612225,   569284634,  3803981197, 
-  2866924309,  4285520252,   275101079,  1972845588,  2767036941,  2447433665, 
-  2084829612,   978482141,  3412416288,  3625069701,  2424252553,  3589553529, 
-  1823681247,  2667042330,  4214293313,   277760359,  1365536300,  3097375126, 
-   138359752,   920722351,  2763233243,  2976695054,  4221002312,   580281735, 
-  2523303543,  1927232492,  3886954357,  3837451694,   252156677,  4061782492, 
-  3785738853,  1853866646,   818618606,  4229419903,   708015345,  1423984749, 
-  2819291869,  2925710180,  1128386968,   976796775,  1816314745,  1419689571, 
-  1611970284,  1189155318,   828841958,  4141740018,   169203971,  2720078083, 
-   186717395,  2879115443,  3207035406,  3069227764,  2352438144,  3655288731, 
-  3566555916,  3273732022,   534531433,  2166298007,  3451996128,  1267045260, 
-  2797618017,  1629729495,  3431990129,  3112821639,   740494673,   765338030, 
-  2971151659,   822310516,  1553312361,   619101753,  1909655424,   934887544, 
-   729142757,  2257275056,  2783224022,   969723592,  3987893622,  1443481436, 
-  3403908951,  2272054612,   329091913,  2410759447,  1954421279,  3798726059, 
-  4074054300,  1937934718,  2647052068,   273036420,  3378411651,   126841508, 
-   751699616,  2106587319,  1486440452,  3363118419,   717890003,  1244363914, 
-   185175791,  1321326945,  1402626759,   885402625,   338382480,  1231333001, 
-    79264672,   284858790,   839235529,  1285685191,  3474991354,   553136637, 
-  1888229732,  4100234124,  1147209878,  2619467656,  3979772939,  2724236581, 
-  1623946598,   372883704,   876194602,  1354570079,   918857933,  2725940185, 
-  3382778039,  2856023352,  3475193825,  3542300150,  1247843994,  1866850227, 
-   449531154,   406308059,  2914166620,  4146382089,  1166491631,  1533049098, 
-  3164266743,  4176971404,  2338247370,  2166084826,  2567996320,  3888631385, 
-   495890510,  2917487105,  2904033346,  1664944538,  2421214987,  2128999066, 
-  4029609821,  3959179606,  3890904600,   181343673,  3064372693,  1641324928, 
-  3402495456,  1767626895,  1027842616,   930083844,   921478651,  1502246998, 
-  1447695193,  1720681779,  2304474580,  1145245029,  3600031674,   695571141, 
-   524046788,   606966184,  2159985415,  2080122224,   824811550,  3979548436, 
-  4173134181,  1471129067,   342125172,  2452906028,  2257645475,  1921969075, 
-  1451067442,  3311065385,  3507873780,  2074420960,  3423313309,  3390459453, 
-  3069023122,  1074286592,  1209146079,  3914927282,  1374544822,  3727178982, 
-  1535403090,  2198435846,  2349799514,   608567794,  1784099931,   733339182, 
-  2565257040,   478594628,  2735197845,  3091102625,   200446706,   493146630, 
-   214177996,  3784339218,   869777902,  1365234452,  1005922531,  1361747745, 
-  1937012814,  1980434494,  3356013664,   346246765,  1551751326,  1708550772, 
-  2678421185,  2845545672,  3929679194,  1185748831,  4223932871,  1810897859, 
-  1473438138,  1376639040,  1372349496,  1702875423,  1652319216,  3794766736, 
-  2494768228,  2791303155,  2148967149,   560100777,  1539775750,  2332395502, 
-  1226093986,  3772022723,  1873239654,  1250906029,  3932474042,  3318060218, 
-  1251040510,   513005033,  3068921055,  4242190501,   411836604,  4141091015, 
-  3230082222,  4278709336,  1944711009,  2970892994,   492450776,   367591403, 
-  3752567949,  3220965763,  2662400747,   233706732,  3302049588,    25630487, 
-  1941950956,  3243340961,   865084135,  2575741054,   866696133,  1715748680, 
-  2236466160,   858538345,  3198684790,  4061200870,  1880336495,  3448677381, 
-  4050792949,   474305178,  4006128906,   704918155,  3302397723,   163875025, 
-  2925021627,  2112609401,   894172948,   582884740,  3249920838,  2390655488, 
-   760780408,   641311863,   979761930,  2958177785,  1607167117,  2220497976, 
-  2489557504,  2374663244,  2521409627,  4094516260,   418039811,  1357811980, 
-  2606058500,  1597833493,  1020017894,  1925207955,  3756516916,  1775474866, 
-  4255415143,  1651443901,  3889670181,  3135368830,  3916942596,  3539878585, 
-  2796355172,     7807396,  2605148816,   316260918,  1099824177,   524068281, 
-   737106589,   736514123,  2968828836,  3080120600,   158861346,  2744908312, 
-   487543100,  3713522995,  2873554361,  3724103520,  3186163083,  1636549890, 
-  2577551934,  3004479333,  3796060030,  1367257153,  1503667945,  1633202619, 
-  1631371871,    88090931,  3930557130,  2009962632,  3649728958,  3512072910, 
-   930521003,  2603438898,  2326013927,  4004929130,   337210299,  2760892683, 
-  1907067374,  2320769794,  1271888497,  1873008873,   790891538,  1755898484, 
-  1245211929,   424899001,  1363308412,  1750877108,  2289831476,   762397379, 
-  3208426600,  3900636482,  2997061666,   351768744,  1192974166,  2155431282, 
-  2262517382,  1076837480,  1013866699,  3069935702,   559302066,   459749288, 
-  2782495719,  3282287316,   500021559,   307626137,  3685083810,   593386005, 
-  2425376995,  2965843855,  2173239581,  2892783005,  3090090184,  1853751420, 
-  3871843471,  3282810631,  1411341636,  2759151716,  2638907713,   172039290, 
-   415695575,  2363553559,   191141111,  3420501538,   444401459,   105277675, 
-  4204385875,  1603626388,  3611499813,  2379655745,  2929862538,    70046824, 
-  2693584420,  4043965311,  3139332930,  1548654988,   495259112,  2514182024, 
-  3389111643,  2406345157,  1566164481,   544495236,  2812825639,   204853282, 
-  2448453221,  3789261776,   352916306,  2024136068,  2585907973,  1359340076, 
-  1260759752,  1161883920,  3177883248,   142645975,   972193376,  3014666215, 
-   483784213,  3617627125,    65466601,   491144577,  2647249020,  1122962452, 
-  2116751505,  1562297789,  3092455523,  2453816465,  1630752429,  3757825864, 
-   946877456,  2638014367,  3534941802,  3586736503,  4118056876,  2183736038, 
-  3017192246,   787574407,  4040868460,  2908931090,  3622680338,  3166234133, 
-  2635371288,  3400402077,  1325184079,   139884770,  3778868930,  3475172745, 
-  3426789220,  2776197889,  2520375265,  3711822172,  2153152047,   694035090, 
-  2545101991,   368444448,  1163092609,  2899729857,  1326060526,  2870186805, 
-   804327308,  2203563548,  2691083954,  3755168551,   172613596,  2030290846, 
-  2071556156,  1577838541,   836504016,  3470549596,  1733134298,  1734080337, 
-  1773020488,  3702396143,   766089727,  1791196346,  1957305122,  4139913394, 
-  3167805957,  1350232355,   656788740,  3523514493,  2708653643,   521495326, 
-  2392707379,   781103031,  1029873020,   457663589,  3107018447,  1160237768, 
-   835680233,  3230475281,   621861744,   458049113,  3097785436,  4012138216, 
-  1607771222,  3719290791,  2727599325,  2230354870,   446294758,  1303371069, 
-  2913771128,  1119891373,  1104463504,   562265888,    67489501,  2778264169, 
-   827897751,  2577517345,  1390267319,  2030029750,  4110185822,  1894021172, 
-   128275735,  2481226587,  1565692579,  1017841765,  2025577981,  3034301072, 
-   750840936,   813680961,   199542503,  1774097372,   737466521,   891124230, 
-  2173147267,  1530282591,  3915099391,  1423697306,  1757458432,   973023183, 
-  1717022952,  3061701951,  3904064076,  2936188258,   825110006,  1018679588, 
-  3631075874,  3017237842,  4077166279,  4142192163,  1057261791,  3149083994, 
-  3713112125,  2511090632,   434524025,  1219186268,  2964792131,  1971647965, 
-  1472732761,  2810500713,  3838589556,  2446533285,  2561253964,  2588029987, 
-  4191642841,  3802822338,  1413309102,  2582958846,  2001411821,   152936876, 
-  2039896782,  1186719552,  1111682226,   155146423,  1836209261,  3186615190, 
-  3532911155,  4186450806,  1089620162,  1714743147,  1254550948,  1116337321, 
-  2951427271,   397431233,   843481672,  2093233394,   714170195,  3764566506, 
-     9835719,  3912186265,  1771542155,  3323809696,  1300921835,  2412944465, 
-  3694835287,   173488577,  2561569558,   777874538,  3593452808,   549128394, 
-  1965609296,  4093639496,   147946952,  1871029084,  3270000085,  3520802947, 
-   250866984,  4190145983,  1487402746,  2899788620,  2004615136,  4075865147, 
-  3848827755,  1650238499,  1521676406,  2215540140,  1099997356,  2324693645, 
-  1420629758,  1175495097,  2403005501,  3600906853,  3417069489,  3251082460, 
-  2197028292,  3977871315,  1240380353,   213265173,   426275588,  3678744588, 
-  2528802812,  1418167868,   110179419,  3891895373,  2895481690,  2278199503, 
-  3331974613,  3033820228,  1979820675,  3138198970,  3548773347,  1555280786, 
-   385293522,  3051884188,  2477127480,  3970858686,  1068164208,  2626838831, 
-  3997086227,  3812316362,   910176324,   725847167,  2546448413,  2843206996, 
-  1545351591,   518508160,  4065961221,   832565276,  3253560666,  3543983858, 
-    23722490,  1238641419,   394761596,  2467248478,   352125150,  1736525277, 
-  2382247416,  2623128802,  1477685940,  1143295838,    71377835,  2519091467, 
-   824089338,  2086498867,   676260345,  1484496017,  2454580725,   845453635, 
-  2195879068,  3967571441,  3152325532,  3369370323,   770951813,   446190589, 
-   814440759,  2481678694,  2324327960,  2455212250,   364917134,  3425970854, 
-  2308038549,  3198215416,  1994929792,  2260419764,  2347263575,   436834986, 
-  2055764533,   502965383,  2858556424,  3310245176,   146811706,  1202128280, 
-  2163716930,  4238471632,  2579812513,  2615328173,   859593180,  1952206143, 
-  4205310229,   597882722,   216677337,  2115849892,  1565116968,  1287222616, 
-  1086201550,  3542532235,  2926522688,  3769319325,  3509714603,  1274371382, 
-  3734035304,  1075748491,  1962619084,  2702933159,   966759269,  3876575152, 
-   426846314,  1410768562,  1426860349,  3810775568,   978387070,  2742571042, 
-  3381657822,  1174962584,  1784217874,  1012354384,  2837854936,  3836627105, 
-   111977587,  1664392552,  1405048942,  4218649223,  1973153337,  1190362141, 
-   689849661,  1138033345,  3542917353,  2043038024,  3503718316,  1275646925, 
-  3310393721,  2651706892,  1385373117,   924848295,  2022361510,  1445885153, 
-  2745523291,  2705927586,  1273723533,  1792079428,   889313085,  3369228200, 
-  2014898674,  3642785817,  1836782600,  3353971187,  1534033210,   756902521, 
-  2986253024,  2416407141,  1429035010,  2556754460,  1981031120,   942383611, 
-  2739963251,  1215709025,  2787563044,   545142130,  2408551431,   843654515, 
-   134415525,   621843659,  2610779465,  3532028143,  1908687062,  2524647535, 
-  4046744715,  2842229466,  1002737138,  1225172163,  1746901562,  2428740437, 
-  3890031015,  3568606825,  2652776392,  2285991299,  2321148089,  1861961063, 
-   977389915,  4009609053,  1885064573,  1582435070,  1111135687,  1551197392, 
-  3800433961,  1419090104,  3633496654,  3988473785,  2881375609,  1577329394, 
-   632376691,  2580159682,   882911358,  4154501000,  4115766152,   572804868, 
-   906008736,   509340358,  3836413329,  4238304532,  2604489296,    54372516, 
-  1913781677,  2991460493,  3451261491,  1988618105,  2584154422,  3789269085, 
-  1538425787,  1388508368,  2610865802,  2181615974,  1213213545,  2316880305, 
-    61896747,  2540214604,  2212834744,   287774341,  2403485209,  1498529461, 
-  3715440401,  2686330311,  1127771403,  2224500176,  4123672758,  3370305741, 
-  2392151039,  1128734428,   412143847,  2061422085,  3599308810,  4154376429, 
-  1110912122,  1447579523,  1778003207,  2141498485,  4142588360,  2660444792, 
-   802565313,  3950093339,  4268914452,  2028708067,  1578506631,  3893686638, 
-  1227259310,  3466305096,  3724725713,  2470217375,  3765813113,  3197699210, 
-  3988904887,  1871149747,  2802586440,  1183634597,  2368912587,  2978369622, 
-  1451236764,  2084796379,   116492777,  3912725154,  4155665630,  1740578889, 
-  4246684489,  2813797694,   937037443,  2020532434,  4131156169,  3998536215, 
-   283771911,  3152331586,  1262925779,  2548242768,  2520098775,  3111133931, 
-  3820588693,   803563980,   295536818,  1477771246,  1670205066,  3387365842, 
-  3223336737,  1927680980,   142935083,  1165410794,  2940082976,  4121916597, 
-   894703279,  3963072869,  2165277798,  3216253131,  2789173154,   909604181, 
-   390907280,  3564240610,   767457769,   645257649,  1494283599,  3409659731, 
-   204773333,  2814812632,  2583943513,  4268751894,  4110495586,   987999701, 
-   954036557,  2828383971,   696967208,  1371219785,  2208708603,  2484471111, 
-  1429184698,  2642808969,  2554435160,   169508906,  3923597868,  2157572998, 
-  2812322896,  2030437875,   283383918,  3060684118,  3783404517,  2815319068, 
-   187575856,  2541535080,  1131669711,  3543888742,  1827599568,  2221412742, 
-  3063777137,  2071354287,  4234255445,  3923136484,  3751452396,  1169670483, 
-  4192483945,  3434761370,  1976847675,  1175023030,  3841142524,  3457258997, 
-  2669073672,  3772029588,  2709590625,   271411736,  1467504193,  2220656659, 
-  3929162510,  3942545304,  3325560968,  2940589527,  1779852999,  2289190122, 
-  1759320855,  3264447645,  1029008295,  1473785680,   868195993,  4164096274, 
-  1873838013,  2399317237,  1410225522,  3419226778,  1084976303,  1939564888, 
-   347979417,  2221996137,  3278748905,    51076685,  2621290495,  4177579307, 
-   641647694,  1870651510,   565189381,  4225835518,   320071835,  3576261322, 
-  3487519737,    45869995,  3110551469,   319365287,   454028844,  1121527233, 
-  2214170415,   359153669,  1625680252,  2334498747,  3872920048,  2895059869, 
-  2563550725,   632091714,   189386439,  2700408724,  1229169723,   532293609, 
-  2861851069,  3530089744,  3714174155,   449834893,  1041086958,   417366068, 
-   167539128,  1221081897,  3291674132,  2741771098,  1024486788,  2787438800, 
-  1583700818,  2813944297,  3039586740,  1859323765,  3521461656,  2631017731, 
-  2769794576,  2944273287,    93268967,    85021695,  1392466941,  4115381849, 
-  2924675877,  4214656651,  1923453076,  2461127194,  3867982054,  2050058221, 
-  1741420417,   135446331,  2655065621,   109889532,   934262934,  1819612098, 
-  1987466118,   220505008,  1060758167,  1002161510,  1468681982,   616419193, 
-  4117738347,  3833041750,  1562919103,  3633188657,  1384889332,  2454858152, 
-  1111367568,  2019684378,  1885501789,  1298281883,  2833589370,  4112514702, 
-  2245171262,  3209259225,  1402022978,  4086113058,  3246677528,  1758942350, 
-  2506247626,  4010054802,  1599234515,  3945310801,  2117182521,   226839221, 
-  1988643141,   850642388,  1044733324,   914653280,  1072903805,  3376504884, 
-   281805655,  2281262718,  2542507467,  1165830438,  2880083745,   703918680, 
-   565239572,  4091658098,  2459364280,  1142489594,  2751514237,  3853083115, 
-  1766591829,  2685325000,   646841828,  2188069745,   142509439,  2445118440, 
-  1142349862,   611203007,   711199908,  2059708650,  2809038413,  3247621637, 
-  3464354481,  3607921813,  4058404288,  1455913980,  3806100240,  3378761070, 
-   493274345,  4148900335,  2644793211,  3134060010,  1596561302,  2178310778, 
-   339449658,  4273008688,   337502613,   202248488,  3531901637,  1344867924, 
-   913267726,   300749415,   106323258,   805473193,  1125950631,  3919056402, 
-  1375397466,  1320252229,  2270109016,  1692102740,   420921669,  4146180886, 
-  2379210828,  3567283624,  1563624932,  2025522165,  2876970892,  2381586279, 
-  3018589210,  1165924646,  1625658070,  1441476470,  2350441087,  3449868561, 
-  1912640561,  1655812597,    79421416,  1348779272,  4130859748,  3526776733, 
-   188752760,   383964693,   799505562,  4161853669,  4174104973,  3234218504, 
-   217062733,  4278207152,  1815709894,    59673304,  3731835167,  4086395793, 
-   752022221,  3770481421,  1207122616,  3143029008,   939496357,  3277469128, 
-  1451989018,    55065593,  3216677857,  1165322815,   439026891,   806333784, 
-  1806721332,  1808464132,  2380493314,  3129696359,  3302686774,   974656808, 
-  1007697039,   193654631,  2164078236,  3670752137,   945191275,  2570853857, 
-  2317876274,  3240970137,  4134725689,  3352982631,  1355699126,  4169149049, 
-  2969048728,  3118410115,  2936788002,   350717820,  4110780133,  3630689848, 
-  3784709092,   107684252,  3366903208,  2042179805,    60604909,  1485249246, 
-  2111918946,   282192399,  1954501472,  4215041779,  1232313157,  3673523253, 
-  2216551089,  3663952251,  3156902565,  2880312177,   774920855,  1124722534, 
-  1773760517,   121928116,  1947136576,   605106173,   516616988,  1011701904, 
-    24447078,  3624153954,   522577665,  4238428200,  1953290394,  3670362349, 
-  1636330282,  2337028734,  2561845814,  3154660487,  3476058894,   853961317, 
-  2679086351,  2319141547,   466233022,   442108908,  3458493698,   157994178, 
-  2494318437,  1414706351,  3469737532,  3126827809,   876300225,  3918824191, 
-   380271027,  2624365803,  2559579309,    51838146,  1504651032,   665877154, 
-  4175508542,  1274143991,  3527712511,  2019964552,   737176791,  1088528339, 
-  2166308443,   635040150,  2316874100,  2684199162,  3075874509,  1644442909, 
-  3329976770,  4057157340,   658724833,  2658467360,  3010347227,  3049860167, 
-  3484386973,  3740489975,  3135861970,   791210824,  2497347771,   419144857, 
-  2585870552,   112853105,  1665708891,   323552959,  2613078284,   420946202, 
-  2289630957,  2466703902,  4037294576,  4118662182,  1166399722,   397344690, 
-  2232850304,  2627684226,  1350995738,  2093988423,   629125570,   281127586, 
-   584615791,   282409245,  1135692250,  3286249608,  4137312775,   419006380, 
-  4255842357,  1108170147,   341012934,  2253227894,  1586778254,  1522925373, 
-    51238982,  3155192637,  2769899220,  2895123177,  3648101845,  3013698350, 
-  2386779818,  1762369809,  1815777998,  3902380663,  3889414705,  2539694262, 
-  2317757757,  2417079299,  3184603257,  3155539472,  2492695736,    38783718, 
-  1630390890,   459049847,  2326533696,   470616995,  2165926960,   706513423, 
-  1567507986,  3328961498,  3486571372,  2140006415,   575129303,   719746777, 
-   956927323,  1842727759,  2891846166,   923116350,  2900218885,  4060687416, 
-   533639300,   469229861,   711065368,  1046044856,  4052337829,  2427844495, 
-  2767993204,   575897849,   256532353,  1938151365,  2127052120,   546705074, 
-  3363301656,   802305130,  3356439090,  1322473504,  1366845161,   817872781, 
-  3919364798,  3671325247,   265671317,  3584056918,  1986774370,  1864158225, 
-  1891924045,   740874726,  2211469781,  3442398017,  1439405092,  1275815925, 
-  2713640407,   521727973,  1547837435,   799783509,  2784808475,  2290426260, 
-  2466120020,   442572249,  3808077586,   300140612,  1242481086,  1457318816, 
-  2087997471,  2193183391,  1852742304,  1231740331,  2953502025,  2918428195, 
-  2327727073,  4104247856,  4066837100,  1510382125,   522593410,  1843540542, 
-   995230270,  3989520962,  2754726621,  3036255279,   519860719,   513571066, 
-  3837321835,  4153578662,    37086880,  2017084701,  2466971023,  3460384545, 
-   309909262,  2787851258,  2892749601,  1623384714,  4251271618,  1015568649, 
-  4067396965,  2617486703,   188595692,  1315089489,  2569983121,   440251909, 
-  2578292475,   957354133,  3134555450,   903729906,  1595398795,  2320741694, 
-   385017015,  4046187596,   748651976,  3702943604,  3988681010,  1610877700, 
-   549391297,  4225189917,  2166547959,   259023146,  3896417354,  4032007560, 
-   241013757,  4199104826,   776181267,  3746419544,  3125533865,  3770718287, 
-  2231639115,  2709788666,  2433605109,  4247029051,  4063137382,  2860386084, 
-  3560378810,  2461912304,  3335199373,  2936843227,  4274588339,   867130802, 
-  1071009051,  3899044830,   950703849,  1778056093,   484248485,  2366049045, 
-  2502964803,  1596705203,  3911290654,  3125947003,  1570722422,  3787632507, 
-  2371813359,  1465975044,  2531056027,   106901880,   812332618,   204329770, 
-   221382135,  1794128135,  1414488314,  3800790731,   293795143,  1832791512, 
-  1237401182,  1033630335,  3309268472,   342972006,  2082148356,  1531087372, 
-  3696519001,  3368558373,   682018111,   256775914,  1908397070,   612178907, 
-  1960691608,  2472683272,  2108692850,   381014306,  1368654379,  3449652076, 
-  3192148673,  1369489588,   324716424,  4063998772,  1154511978,  2446991006, 
-  1858970615,   684660395,  1637043868,  2719912053,  1679605836,  3803212509, 
-  2202484409,  3114079745,  3615493770,   997401363,   759125463,  2168275378, 
-  2367148713,  1860338511,  1190230036,  2165611026,  1359085547,  2684214310, 
-   321241955,  1962645692,  1366225114,  1609724523,  4146986271,     3829804, 
-  2952974573,  4119677354,   792853057,  3783804922,  3867324177,   743676104, 
-  2245868668,  4219701127,  1147699702,  2241407929,  4293401362,  3687108763, 
-  1457529899,  3279850420,  1749350334,  2111491262,  4080063128,  2401495696, 
-   194809499,  4085164020,  1667185433,  2649063089,   886365063,  1668949264, 
-  1238780997,  1743030989,  1537952813,  3334939613,  2188971769,  3533358513, 
-  3710698160,  2881158049,  1338657914,  1350959190,  2276987668,  2748663087, 
-   984261543,  2643754447,    66897092,  1964634418,    82069018,  3183907719, 
-  1360142629,   224100886,  3099890544,  2052911850,  3847850864,   103492809, 
-  3486784432,  1411988687,  3225742125,   565935240,  2007862320,   823355941, 
-  1824560903,   942392373,   333583177,  3990628969,  2181797775,  3224666088, 
-  1281737342,  2274903290,  3804209156,  2178547249,  3869005787,  1186025622, 
-  4134692197,  1893553025,  3316380482,  2116733417,  1120281825,  3440288572, 
-  3496891597,  2717587266,  2811609417,  3250058826,  1467882143,   369041548, 
-   801948091,  3087604649,  2021552833,  1368553110,  2284972314,  1317118278, 
-  3138290243,  3687210847,  4290809593,  1012803127,  3736432264,  3058039530, 
-  2473861314,  4141677244,  3094932043,  2318287259,  1828867312,  3748531122, 
-  3733526167,   476049972,  1338760246,  1568475574,  3092996089,   844086636, 
-    17301720,   128874548,  2648734141,  3210948270,  3251368601,  1407138078, 
-  1424883075,   986368342,  4083719754,  3740594713,   274043977,   680305765, 
-  2775084033,   306099180,  4274281466,  2067143399,  1815210876,  3797620989, 
-  3277629528,  3205348712,  3370955990,   797069698,   199679619,  1458281100, 
-  4194697790,  4166510873,   701058706,  1387648743,  2007899339,  4157236711, 
-  3943463373,    25508716,  2720002937,  3954867335,   902270755,  3007511453, 
-  3188291763,  1080635672,   467182668,   462286267,  1526607385,  1562291606, 
-  3872645290,  2701782956,  2906907696,  3331729889,  4255610698,  3433481404, 
-  4054851323,   791200895,  2854863450,  2413740413,   668808793,  3022605715, 
-  2385137101,  3640072982,  2333666902,  3497792068,  2128806051,  1877738155, 
-   526457580,  1029240226,  3949114267,  3499655717,  4193334757,  3411596236, 
-  2157094094,  1206454707,   749089877,  1584317980,  4013398400,  3409203828, 
-  3972938440,   105732932,    69871970,  3423664471,   712992998,  3237502364, 
-  1480483623,  1373026115,  1430732495,  3946662355,   572501340,  3053665828, 
-    59407310,    20841640,  2514750719,    97086877,  1109288878,  1743156986, 
-  2697487888,  1386652824,  3779117722,   443162230,  3592037463,  1409090955, 
-  4108668886,  2509539713,  2783399111,  4100257081,   177804710,  3026984273, 
-  3020445640,  1479672407,  2845601243,  2211005101,  3973761025,  3932406833, 
-   526594249,  2479446195,  2187200122,   563170681,  1423575827,  2316091766, 
-  3648186980,   823253212,  3357486699,  2340612016,  1603057414,  3749697440, 
-  2921009997,   314324178,   705249682,   920275306,  1684269455,  1647755606, 
-  2661756361,  1654248845,  2721259226,   341700680,   699729568,  3626917811, 
-  3854848442,  2255880917,  1107669370,  2714984365,  1983605429,  1442201039, 
-  3331234099,   116234859,  1483735577,  2235412528,  3873266357,  2623536000, 
-   524769087,  2722169676,  1571854987,  2074167686,   650258645,  2423071714, 
-   818853710,   921379465,  3267017281,   495771276,  2799118003,  1133759270, 
-   182991254,   147304460,   384680199,   752849046,  1198259352,  2847842221, 
-  3717498404,  2622605096,  4266552840,  1436216099,    39934682,  3783894942, 
-  2174646671,  2045138977,  1621873423,  3509148287,  1025831216,  3241551191, 
-  3248429028,  2441744517,  2229399592,  1708591221,  1252737337,  2058112215, 
-  3624239755,   369993000,   675505497,   761272570,  3308636010,  4222571472, 
-   340918785,  2889630068,  4277899911,   328370602,  2374978995,  2966271504, 
-  2748186728,  1436896481,  3602922780,   428100423,  2249817704,  4271956536, 
-  2034777115,  3673958728,  2295984116,  1903617322,  2490717786,  1034024062, 
-  2875786755,  2853510455,  2619273332,  3990770210,  3628691154,  3173819657, 
-  1027661116,  3892512264,  3976663917,  2558797994,  3465438144,  3057509564, 
-  2708774649,  3226003366,  3552346458,  1103356990,  3763191538,    70306413, 
-  3044101560,   674016926,  2705891901,  3201759632,    86819646,  3801131105, 
-  1536294611,  4160526078,  3855276602,  2012873661,   748768753,  3652123796, 
-  1299228785,  3412505487,  2013303610,  3371772476,  2047681252,  3093987100, 
-   249988003,  4278799351,   339151710,   108308594,  1201696438,  2480174248, 
-  3989779612,   407917167,  2144880065,  3766612863,   960317317,  1694741707, 
-  1095371277,  1958394598,  1919626087,  1169441030,  3699359147,  3922910403, 
-    50259909,  3975394949,  3088026552,  3892801032,  2865009342,  3664907144, 
-  1238422523,  3699185552,  2523897572,  3443476556,  1209821004,  4208204307, 
-   494352199,   128413240,  2837564881,  1888283906,  1490164910,  3539497386, 
-  3316517545,  3230163045,  1145788170,   671202149,  2530966907,  2617197729, 
-  2782504669,  4092345758,  1147257045,  4241725352,  2103670541,  1565436877, 
-  4060465930,  3860583923,   412405470,  2401133267,  2885694249,  2723370016, 
-  2255757059,   155123959,   423984231,  2318326039,   453129340,  1278964172, 
-  4151240999,   287872275,  3981512941,   304479195,  3384968274,  3317284275, 
-  2157781735,  3879617179,  3273290648,  1844166767,  2063356811,  3995461144, 
-  3904046375,  3760685052,  3226741390,  2008648023,   488657228,  2549693578, 
-   469020039,  1519877120,  1165143376,  2050921735,  2528732805,  3294754086, 
-  4249787254,  2365255361,  2467669507,  2965658435,   869601112,   901722724, 
-  2239118817,   471169086,  3995765714,  1029148425,  1077106054,  2217251505, 
-  1487496004,   942987611,   871618765,  1483656747,  2321503045,  3766611080, 
-  1036101947,   853464356,  1757329834,  3105906374,  2910696272,  2831841748, 
-  3912960620,   492319621,  1884032376,  1846765423,  2094696507,  3086949491, 
-  3150846170,  2810443659,  4038049831,  2095439627,   978531201,  3142005127, 
-    20051605,  1380992287,  3781848128,  3118077192,   572702948,  4239116986, 
-  1772441392,  1160737959,  2978033744,  3210499418,  3776235907,  4012104399, 
-      403308,  2400374920,  2151423721,  1461841655,  4294371857,  2451056412, 
-  1686511930,  3163428074,  1825846343,  1655886156,  1281379152,  3218300206, 
-  1167927746,  1237724271,  3127201282,  1635791292,  1896208972,  1144624405, 
-  4155349189,   267052787,  3753786854,  3894827743,    49379433,  2416919341, 
-  1630482631,  4212923433,    17919814,  3971975005,  1211139244,  1683525296, 
-  1853981475,   921965924,  2194811727,  3453528898,  3726725251,  1236142945, 
-  3636785739,  3523505333,  2634536321,   494695201,   979415428,  1083517215, 
-  2696856326,  2176952129,  2155384040,   503939551,  1566134540,  4041082205, 
-  4003680365,   115936224,   906247637,   165538559,  3482063077,  1982373287, 
-  2997034401,  3452638536,   254559998,   754573662,  3487453222,  2202108175, 
-  1302991050,  1595292110,  4030041517,    53964309,  2725210763,  1235133089, 
-  1128308099,  3913799822,  4226727119,  2520165388,  1491388215,  2537284848, 
-  3562795156,  1813722522,  1617481392,  3518533732,  2447210020,  3114212971, 
-  1909614984,  4229901169,  2995938695,  2240783662,  2138629084,   556426323, 
-  1342973273,  2270223712,   616903164,  2305188066,  4265239081,  1823603827, 
-    82730196,  3966987695,   380016060,  1671110450,  3576384144,  1790552388, 
-  2696276000,  4019239125,  2904067506,  3611048701,  3464387153,  1504542805, 
-  1111576712,  2507592572,   838464422,   185936566,  1801320570,  3564094752, 
-   806142499,  1716994233,   568730156,   339644179,  1821279530,  3109912943, 
-  1104476828,  3303712497,  2595748741,   735149745,  3361464512,  3852558133, 
-  2214986722,  1915423713,  2018955704,  3712601743,  3163528429,  3510848911, 
-   136305698,  1354550843,  4140650046,  4249577209,  1382867023,  1429928032, 
-  1695839753,  2761631272,  1821107131,  2364779544,   336132275,  1428410068, 
-  1536344095,  3136552761,  1885922165,   697237139,  3365613137,  1097488584, 
-  2585758737,  3369256361,  1386013825,   277643792,  2675395103,   358030158, 
-   101617343,  1072526669,   698190641,  1587976342,  2746154296,  1396285226, 
-  1916464240,  3634863925,  4277517677,  1841565073,  3429837149,  1373487244, 
-   687449897,  2289350841,    49566585,     9231463,  1376334490,  1342536722, 
-  1894690460,   633056726,   251638524,   301079623,  3786389981,  3855191097, 
-  2063250766,  1405520057,  3418256983,  3995981111,  1205323110,  1515319102, 
-  2641648861,  3725180218,  2294246552,   987838829,  3116638950,  3451482131, 
-  1129272983,  1547546509,  3929938966,  1281666738,   900214944,  2598854423, 
-   771377654,  1954614852,  4062533390,   230857194,   281505116,   513380847, 
-  4033465833,  3504501082,   701556249,  3305209120,  3474888000,  3073370453, 
-  3223013405,  4070530172,  1162014854,  1181836580,  1395673938,  1980905118, 
-  2639330374,    92103008,   184477350,   986581715,  1010061504,   955765404, 
-  3724241693,  3499792114,   139029039,  3928969750,  3891520031,  1967741812, 
-  3365005688,  4054969645,    46730849,   252623411,  3590900159,   423840643, 
-  3800527936,   415716866,   136036496,  3792268253,  2865206906,  2553275238, 
-   376904330,  3049728540,  1171869274,  3942961306,  4157360791,   773549998, 
-  3376997989,   232797333,  2456522413,   127099838,    54592012,   492752196, 
-   786712403,  2789008623,  3078095894,  4009193077,  3810161109,  1110712229, 
-  3277391928,  3055931486,  1353140175,   327211172,  1990219352,  3727674382, 
-   927033202,  1621924220,  2677730389,  2978972930,  3124567096,  1770975838, 
-   812530636,  3998607189,   729537725,  2971282554,  3662968013,  3457532240, 
-  1352591239,  1401922529,  3912261724,   661399463,  3734758739,   855990753, 
-  1513855060,   790526633,  1429429793,  1766054650,  2272728895,  1217030979, 
-  2080749694,  3917035257,   351842291,   299941682,  3618325051,  2869941031, 
-  2692744655,   670507883,  3475036452,   934099833,  4066873143,   754002972, 
-  1646119171,  1169407463,   439960208,  3112142899,  2586636704,  3691049088, 
-  1495970741,  1047976329,  2800822191,  2601961529,  1100506423,   136729037, 
-  1008937859,   449384754,  2921374674,  2486501560,   900467703,  1859430149, 
-  3323073959,  3374680845,  1232342365,  3449198891,  2427119895,  1868931902, 
-  2266139375,  2468188171,   584028780,  3546939139,  1609137673,   360357704, 
-  1574320499,  1088009785,  3600445725,  1239580522,  1552427639,  2883578920, 
-  3816142665,  1364789477,  1778647651,  2441201128,  1030086376,  4201716172, 
-   993684634,  1244981677,  3898324641,  2725242614,   886833583,  1161281208, 
-  2502961890,  2416356160,  3325033068,  2913456054,   140206922,  1471748940, 
-   724670899,  3842500749,  2614329372,  2812693742,    66976387,   964807157, 
-  2180547812,  2232209391,  3897005471,   197532027,  1288504046,  1618849146, 
-  3684353992,  3443688516,  1689960179,  4182579381,  1662434739,  1758063550, 
-   171572439,  1528020886,  1169292173,  3899099872,  3501317882,  2778123711, 
-  1406148833,  3875414848,    48731863,  3944544182,  2564195388,  3003617296, 
-  2492593736,  4119669521,  1270028585,  2542990013,   559127286,   485969140, 
-  3535244525,  1019395426,  3373611039,   485213955,   992191951,  4269653815, 
-   875415541,  3075776629,   445593216,  3023493506,  4285252754,   712776332, 
-  3138247806,  2435572785,  3806659659,  2400633861,   870028607,  1009231706, 
-  4107842399,  4278139919,  1658691860,  1646217745,  3673941671,   100900075, 
-  2856435959,  2837683746,   337181100,   415598914,  2945787445,   327658410, 
-  2239505228,  2671970009,    75132977,  3155378929,  2895457009,   562963159, 
-  2177531352,  4105239409,  1760691246,   635103188,  3410743569,  4152052919, 
-  2115307076,  1198570662,  3151476699,  1893185117,  3100105774,  3437615107, 
-  2133813981,  3703647270,   747941711,  1387962077,  2143432484,  4020645826, 
-  3236322957,  1298657423,  2692670148,  2379572837,   776500546,  4278620598, 
-   380677715,  1070234738,  4059456853,  3964031490,   179750113,  2173692819, 
-  3738672718,  4294381740,  2041284118,  2154332898,  1967613045,   502733473, 
-  2994029112,  3953444629,  3594309158,  3889182197,  2476639023,  3170050063, 
-  3602310036,  1779348977,  1982040852,   618101007,  2190522802,  3076700320, 
-   950148620,  4283468915,   854086305,  1389868846,  2338528600,  1969484915, 
-   658681102,   377398935,  3383172094,  2604813228,  1663029885,   851111122, 
-  4190412303,  1504994355,  1420322307,   243401233,  2236827426,   127139963, 
-   829633848,  3218953713,   218657441,  1213916095,  3334810175,  1000306513, 
-  3485130318,  3789237046,  3509016921,  2310698082,  3121505438,  3983154924, 
-  2253483513,  1568457360,  2106693493,  2038337964,  3453192535,  2107312093, 
-  2457686663,  3215345684,  2831171121,  4070247695,   247234727,  4204289907, 
-  3083793493,  4046366059,  1055248447,  3615220965,  3606156852,  3800697440, 
-  1045833021,  2415232134,   260567910,  1227627724,  1433525345,  3535340897, 
-  2184027200,  1993555993,  1610647294,  1075039851,  3889870944,  3883890358, 
-  3539003970,  1255227592,   292685810,  3169300788,  3972981909,  2681055979, 
-  2189076195,  2843192588,  4075255646,  1809467178,   153052581,  2703220164, 
-   193018133,   540992120,  1692093681,  3522260629,   559392715,  1708876192, 
-  1796031579,   838095456,  1741225979,  2237413550,  1588680119,   836138357, 
-  2492081254,  3414768507,   860243743,  3163294564,  3016165326,  1924874819, 
-  1816545369,  3767438127,  1692942655,  3681848101,  1956956702,  1991088776, 
-  1547626209,  2941479792,  1683388589,  3291321213,   354866801,   205355484, 
-  2649511930,   485559894,  4005044414,  1397118680,  2282182028,  1186851006, 
-   662540752,  3269101837,  2406354009,  3866381677,   399363425,  2394399354, 
-    39023210,   714894995,  1225575021,   791277831,  3202588128,  2254344701, 
-  1061186993,  3689145367,  2357365618,  1184926630,  3590043499,  3219599094, 
-  3706204238,  2532700240,  3383980441,  1780231686,  4086551892,  3593257915, 
-   822071876,  1448625495,   656963438,  1741685167,  3139878566,  2342474275, 
-  1559551320,  4121772375,  1000805098,  2456001029,  1220705154,  3740897946, 
-  4263989299,  3021669302,   283783003,  3010452120,    86042755,  3958869712, 
-   385618429,   920046376,  2841064623,  3553518225,    55152179,   417454131, 
-   899227919,   883552160,  1987681395,  3622149537,  2998819698,  1727705753, 
-  2416598798,   151999609,  1733611788,   361169157,  3029602030,   646123484, 
-  4084886949,  3936526606,  3714933337,  3956452121,  4211049392,  1103365552, 
-  2973829414,  1278930928,  1656281727,   637850140,   374840434,  4271804115, 
-  4120581206,  4145483415,   121780317,  2360536899,  3321251214,  1829907164, 
-  2201099048,  1517739954,  1409757640,  2661855114,   667088216,  2117314577, 
-  3628786038,  2420831460,   960473554,  2624771821,   741615868,  2925013503, 
-   721606283,  1510093387,   186709955,  4162548093,  3085224087,  4059189195, 
-  3979479507,    21540047,  2180710948,  2461647306,  1643449790,  1973042840, 
-    77756450,  2532747102,  2831728010,  3460912304,  2417362081,  1165300356, 
-  2796451067,  2655055676,  2401461313,  1169549052,  4197452756,  3317460436, 
-  3447484929,  2719888341,  3300594776,  2470880286,  1727135469,   838134548, 
-  1000800879,  2657191037,  3071169432,  2240517096,  1865491080,  3429000435, 
-  2594576525,  3807301096,  3387864694,  2762454376,  2033160537,  2246699531, 
-  1796249830,   970128659,  3869504952,  2147655831,  3806392498,  1709934149, 
-  1166789854,  2901215141,  2289829690,   360508928,  2690449141,  4125812872, 
-  3743157575,  2140451685,  3068861877,   810966406,    36550918,  1412806544, 
-  1774615796,  2611379407,  2190003975,   475476701,  4174104402,   821961919, 
-  2699978853,  1963574894,  3852195361,  3859148235,  3635982998,  2950650117, 
-  3574933382,  4000309241,   590199333,  3616125256,  2408172584,  2325881013, 
-  3455361210,  2357562968,  3876644938,  1933759302,   264958701,  3684347883, 
-  2036734722,  3504655901,  3880603140,   190200301,  3519579874,  2064175068, 
-  4044680209,  3905005616,   339943744,  2961301678,  1367326512,   857955128, 
-  1413868642,   734786933,  2826385823,  3736103908,  1343318286,  1669397124, 
-   658638461,   441700597,   581960598,  1912885058,  1879303554,  4187619139, 
-   988210915,  2512670032,  1126426814,  1034823717,  1801144363,   996865989, 
-  3897347010,  3179383469,  4045018736,   432607520,  1435799968,  3127261656, 
-  3606976025,  4179374332,  3215798532,  1861966503,  1845685514,  3631764660, 
-  3675333025,  1862418232,  3157300529,  1128669046,   517573397,  3415350219, 
-   385658920,   304710959,  4242346624,   414096304,   640343398,   540843431, 
-  1575774226,  3641365552,  1445208793,   568117764,  3369795349,  2616588653, 
-   159080245,  3808800426,   573828680,  3277703192,  3348017874,   142911844, 
-  3773340433,  3262071947,    26307305,  4033386391,   340688113,  2255939016, 
-  2484463591,  3691506721,   785878911,  2907056339,   885187805,  3019002685, 
-  3620749306,  1496874768,   213493005,  4079779646,  3623279888,  3192169972, 
-  1345314019,  4187075891,  3215427171,   737940368,    58193096,  1694175541, 
-  4281182480,   734035475,  2971834638,    92021206,  2133998236,  3493776100, 
-   114118243,  2496497226,  2156969843,  2567860364,  3735602148,  3957407167, 
-  3445835094,  2145810152,  1114516833,   844926040,  2850637932,  1835029847, 
-  2497418053,  4191964274,   737584447,   331975429,  1421484181,  4127226604, 
-   732810390,   881031779,  2180818396,  1108221356,  1382477529,  2089261907, 
-  1876069731,   496133085,  3861050589,  1016719126,  1010635468,   103313391, 
-  3744175681,  4150227831,  3645210554,   878216182,   905756328,  1899262137, 
-  1108828037,  1163269587,  2765696368,  2522393088,  4139825921,  1711616181, 
-  2137599564,  3461494722,  4131606782,   732026048,  3188336953,  3646155619, 
-  1852202061,  3685697140,  3287863126,  1749214912,  2766920383,  1719346498, 
-  1948067590,   590515050,  3148165939,  1471126621,   375694398,   873783335, 
-  1042392495,  2936219397,  2303280354,   455941744,  2219642784,  1222667394, 
-  2229837532,   901708520,   815728374,  4006902682,  3105602682,  3828030163, 
-  3963592345,   679160738,  1018853400,  2872061802,   553780413,  2748895148, 
-  2852644767,  3289880397,  2966184143,  1158117024,  2516488992,  3300494000, 
-  2870735204,  3902372100,  1604033432,  1042780400,   632319160,  1226217100, 
-  2029392331,   637349753,  1451497687,  3268453689,  2861703963,  3585179723, 
-   586575013,  2989229244,  3817235677,  3849498978,  1653919463,   974730904, 
-  1506223412,  3054704725,  2583347310,  3361116594,    65417616,  3378691218, 
-  3406440083,  3626152409,  3576507993,  3894951224,  2126039206,  1445434407, 
-  1928125117,  3855721517,  1779296434,   408063993,  2026344427,   799559480, 
-  1066229347,   776804076,  4228371867,  1132446999,  3868839410,   527219937, 
-  1972010892,  4174459050,  1210464456,    41430266,   138252571,  2294922638, 
-  3269828605,  4093302488,  3072655741,  3769357025,  3993269205,  1896182728, 
-  1811496864,  2392947277,  4173585878,  1970205892,  3971529805,  1972166347, 
-  2210144133,  2434606294,  1316077548,  3219867881,  4032974558,  2405038438, 
-   300862390,  3720613704,  1216459303,    75591033,  4216511951,  2743859764, 
-   106472964,   166304991,  3700261277,  2240609581,  2049686797,   353674502, 
-  4124765868,   337772451,  1752146684,  2069216272,  2648138781,  3696189511, 
-  3494696221,  1407732563,   648038783,  3932736309,  3366204319,  3229538554, 
-  2941190747,  3758263411,  1997468435,   307181936,   884672227,  1943178972, 
-  2869417276,   207825701,  2784368320,  1113857590,  1236089984,  3437513558, 
-  2774612839,  1076635044,  1335257859,   615130932,    29307697,   552678045, 
-  2770125699,   556692410,  4135844901,  1260679850,  1693131562,  2939317215, 
-  3290425059,  3768584026,  1142294241,  2777570075,   393676773,  3987080927, 
-  2639479610,   202744397,  2230986717,  3667322361,  1877232553,  2053988301, 
-  1422992291,    80564629,  1743154518,  1818213830,  2207436308,  3880317073, 
-  1648254786,  3572721716,  1291729002,  2381692878,  2639745537,  1458362308, 
-  2644691721,   756616190,  2637204189,  1450852365,  2636299555,  3880653820, 
-  2261613039,   271670299,  3580729991,  2019736271,  1269759112,  2310289287, 
-  2777209523,  1353418545,  3246750736,   215214764,  1891322517,  1685691680, 
-  3152082830,  1014727969,   605801167,   550934212,  3274650044,  2831505533, 
-  3337917429,   340756899,  1527510402,  2308953593,  1947437076,   273066175, 
-  3294538078,  3954941747,  2906830752,  2554833574,   135317702,  4222890866, 
-  1851560874,   935734256,  1216303234,  2830499390,  1672575566,  2314171835, 
-  4159260093,  3756524356,  1032695040,   408938845,   899782609,  1340108577, 
-  3182046948,  2440419368,  3986152798,  2929219686,    49288111,  3014070275, 
-    88523896,   723585199,  1291207197,   744253185,  3341522973,  4211417537, 
-  2580372545,  3208496590,  3389227648,  3411554473,  2875258380,  3209604139, 
-  2658164082,   826442732,  2306926090,   857332399,  3550815343,   395976930, 
-  1527359402,  1575497172,  3025131997,   734096912,  1945431048,  3131990666, 
-  2925438588,  2733981271,    60703147,   241241492,  2475237438,  2026968183, 
-   935781511,  3515001468,  1290533582,  1038855378,  3607853115,   650868793, 
-  3792220055,   354341346,  2312978407,  2517843442,  2730035873,  4038177319, 
-  2195666747,  2131809243,  3923971403,  3600291505,  1640729054,  2141867222, 
-    72258110,  3341985415,  2081226035,   906751221,  1137540804,  1020022557, 
-  2539165460,  1661517857,  2921658364,  3183681915,  2747716485,  2758090881, 
-   303758694,  2369506486,  1333559414,  1965201490,   222400423,   237948290, 
-  3877784710,   644893865,   763257248,  3273281835,  1893455727,  3452810617, 
-   405405797,  1076204822,   162477222,  1208731741,  2738647138,  2704259866, 
-  2938639688,  1145896881,  1210016260,   745986217,    21198995,  1081316830, 
-  4180395358,  2860788251,  2835349897,  2628710046,  3219477661,  1316336835, 
-  1064731072,  2620766384,  3010564682,  2049848741,   229849704,  1672674436, 
-  1754113830,   632391988,  2858235670,  2907645427,  4131038097,  4254228152, 
-  3520117234,  3223649950,  1102177261,   143501226,  3401565416,  2907396924, 
-  1972157505,  4226622304,   251132956,  4090043090,  1140764548,  1486906935, 
-   183321519,  2991082657,  3780865948,   379806058,  3932505937,  1468357534, 
-  3167997645,  3858259629,  4036357432,  2118036942,   421845862,  2848336507, 
-  1630117831,  3635449721,  3696489081,  2855124140,  2320210311,  4186193010, 
-  1605418681,  1101279226,  2872548357,  4272339695,  2538962669,   601082289, 
-  3969612398,  3403874455,  2188570631,  1079797687,  3041591672,  4042598469, 
-  2348052063,  4180484036,  1102424208,  1667035778,  1594548841,  4123589234, 
-  3963089702,   471473473,  1103572084,  3606362233,  4133283616,  2040098238, 
-   222440770,  3456015082,  2260875643,  2955939254,  1741936680,   513948506, 
-   285469622,  1834688027,  4282399609,   335318718,   877305704,   788306725, 
-  4076415485,  1313225461,  4003428952,  3760322844,  3354719133,  3310361021, 
-    36522393,   485898065,  3603531645,  2862376258,  2721244497,  2249176417, 
-  3310130398,  1783385360,  1562775230,  4065026632,  3895092244,  3418739121, 
-  3216449616,  2980815481,  2136929064,  3105860186,  3156198472,  4172657025, 
-  3170765052,  4262758029,  1609396227,   687334901,  3187682269,   982733449, 
-  3706781928,  3015905925,  2051271725,  3742343237,  1283271924,  2202202031, 
-  2451201722,  1132195141,  3819322155,  1784619433,  3082823415,  1699867801, 
-  3763378215,  1898602045,  1738075725,  3575965695,  3572891390,  1809832615, 
-  2709498620,  1268134536,   708957422,   555705211,  2274962160,  2108875602, 
-  3491210339,  2570606789,  1481324014,  4223519580,  1197863536,  3853349998, 
-  2429779453,  1659074015,  1880947515,   534541732,  3012726746,  3158902270, 
-  1487067151,  1812298785,  2630499828,   769010771,   827479803,  2990899504, 
-  3886912868,  3768603528,  3352794403,  3207544810,  1451335764,  2759239762, 
-  3234529008,  1463210832,   915936693,  3138874061,  2414089018,  2511446760, 
-   790694995,  2560507919,   177349170,   703051485,  2762785392,  4276636121, 
-  2683920007,  2983267070,   488432915,  2389041220,  3602379803,  4223515474, 
-  1247188456,  3800144437,  1043810345,  3434472426,   412745760,  3761712731, 
-  3821488008,  1497653913,  2677063460,   696450922,  2063533103,  2619515711, 
-  3542483537,   874670478,  4189219227,    10214131,  1171263160,  3215844038, 
-  2564879465,  3123959507,   314092038,  2451014581,  3269239819,  3538156875, 
-  3521140660,  2143449242,  4271965488,  4290290844,   912854638,  1041360425, 
-  1739510066,  1304084947,   725821406,  3078083309,  2721762062,  4240284108, 
-  1775068832,   831705812,  1811553177,  3187402955,   245237292,  1500947072, 
-  3551236569,  3995998000,   233585781,  2002806436,  1613742598,   319705969, 
-  2959544142,   639983207,  3495165078,  2900447106,   322185651,  3336694729, 
-  4006523886,  1231461108,  2772037164,   666420911,  3657110593,  1715752373, 
-   755484838,  2044597112,  2976733240,  3446916727,   588100589,  3207279381, 
-  1074168640,  4033615774,   595616579,   735339904,  2043554055,  2751218977, 
-  3287873520,  1858507166,   485572618,   627365452,  2090345734,  2597879255, 
-  1285950133,   493449762,   848818434,  2525964618,  2684499188,  2804484552, 
-   301978072,  2526499328,  3192025312,  2384079134,  2552965665,  2966090926, 
-   318234734,  3844314233,  2004315475,  3121917581,   517308072,  2070999733, 
-   356062526,   660295796,  3187000438,  3818537499,  3876539661,  3908136441, 
-   747359680,   712083275,  3668865409,   255046737,  1995395238,  3815136616, 
-  3375643467,  2092833836,  1266393266,  1529488205,  2113093125,  3553648588, 
-   346510955,  1506568106,  1864141670,  2312197409,  3324419735,   456748946, 
-  2132531203,    44473202,  1735667370,  1698421744,  1795188122,   188582805, 
-  2758844183,   694026934,  3267931306,  3253656992,  3255093894,  1435295496, 
-  1691572916,   531531575,  3379496063,   692934263,  1679891060,  4218830093, 
-  3345178341,  2323686321,  3301921754,   344868026,  2303475774,   770003712, 
-  3610751725,  2838156782,  3284159345,  2813735714,   565558933,  2329339932, 
-  4169604245,  1856353771,  3971757483,  1038423758,  3192768999,   256233361, 
-  4029315437,  3420444495,   346461510,  3351211662,  1777262290,  3363515671, 
-  1030255644,  4192498250,  3132219040,  4250397799,   694029687,   919830430, 
-  3708129573,  2978402861,  3996748539,  1335189864,  1947326312,  3127718929, 
-  3968563218,    15887780,   462045900,  2180538981,  3518272921,  2468434904, 
-  4182709866,  4037492246,  1247240645,  1039076202,  1091166688,   194559383, 
-  3028408745,  1016949099,  2398895896,  4238298091,  1235045333,  2847389960, 
-  4268889402,    27221009,  3184916191,  1713326313,  2562081055,  2563919201, 
-  3231092595,  3180570882,  2610600265,  2623340071,   417532374,  1049948962, 
-  3428497888,  3821627274,  4113665501,  3925819285,  3476691188,   878793820, 
-   405364751,   263843301,   688966897,  1502548773,  3220180055,  2784024719, 
-  1642986767,  2198406628,  3335415181,   368294543,  3823661258,  1745444307, 
-  1008381768,  3268179728,   931932053,   174334763,   311496278,  1936177061, 
-  3617959761,  2588902332,  2885093540,  2028498645,   766224557,  3177217093, 
-  2791702946,  2118124851,   860075513,  3422561287,  3256610558,   812249170, 
-   755395726,  1884374941,  1970050933,  1525434145,  2179237677,  1354199443, 
-   286336048,  2617478641,  3095284081,  1999154728,   750811243,  3377167993, 
-   545317537,  1893515872,  3341122155,  3214904191,  2040805078,  2945621439, 
-  1954671178,  3221946382,  2176031476,  4008815438,  2676449230,  2883042059, 
-  1231141150,  3801840640,  1923189101,  2458378042,  2789559112,  1133419483, 
-  3076070020,  2608813704,  3355121667,  4011552156,  2067500537,   673464026, 
-  2669211957,  2958248476,  1178899207,  3297981710,  1252644201,  4062722768, 
-   477900574,   440527308,  1829918488,  1670533170,  1534444358,  2429182344, 
-  2978037269,  1539486487,  2019431406,  3804832398,  4261236310,  2392409649, 
-  2655691972,  2587794083,   711427674,  2359110303,  2399954579,  4028692099, 
-  1578210752,  4099073689,  2709076319,  1222390014,  2723265955,  2730920304, 
-  2257088208,  2256473551,  2880150309,  1020603893,  3852168995,  4093827778, 
-   390357705,   252651624,  3254786741,  3668684558,  3561056528,  1961292065, 
-  2986688122,  3020735256,  3309977804,  3295884831,  4093074530,  3117527193, 
-   697326438,  4147497706,  3927972705,  1575323960,  2783638271,  4269114255, 
-  2213347471,  3017072159,  2743267379,  1598787795,  1733724761,  2790071977, 
-  4012862571,  1860057563,  1282509488,  3832185956,  1556917124,  2362372217, 
-  3294596218,  2963709402,  2367669282,  1876270100,  1061264173,  3573454485, 
-  3359260236,  2353822753,  1669535157,   823814157,    59844236,   510409491, 
-   348847701,  2697355734,  1278822469,  2963630570,  2408392460,  2271561666, 
-  2229235533,  3812166486,   501685082,  3115361894,  3322207203,  2235378320, 
-   712703947,  1554515760,   644219721,   167954232,  1750464696,  2110800164, 
-  2318473472,  2732130524,   664906472,  2424277491,    49697916,  3064536054, 
-  1510804757,  2148543572,  3420088181,  2495862068,  2574570753,  2067049827, 
-  2011516803,  2831162039,  2816831130,  2687284639,  2649247072,  1726943154, 
-  2994464553,  1354576946,  2202963469,  2156951502,  3322873733,   894882947, 
-   993115615,   858472282,  3228963998,  3327023359,  3070342965,  4223022431, 
-  3718292997,  1266916109,  3732674073,  1284101666,   480759935,  4173409075, 
-  2291113574,  2747755000,   209893814,  1257364554,  3101796937,    27956108, 
-   167094611,    64917601,   386966479,   458071386,  3012252959,  1554575574, 
-  1256353900,  1614108081,   679975230,  1277680779,  1612706791,   530493182, 
-  4270611333,  1367957929,  2899957917,  1779398402,   642465465,  3241378828, 
-   468568482,    60748908,  3600254120,  1480623720,  3200597697,  3743886328, 
-  1926673769,  3861245514,  1708623441,  2751579631,   780154280,  3613582721, 
-   696105265,  3891344153,  2169010768,  4080261113,  1254854216,  4033868855, 
-   268425516,  3713574352,  4172164334,  2530299249,  3175930011,   482294284, 
-  2300493421,  1303978851,  1121158408,  2271124722,  1661457900,   195038643, 
-  3489645319,  2875505426,  3770159573,  2361303763,  3798982911,   228108234, 
-   791181642,   166725907,  3419002511,  3361307646,  2233352273,  3565700403, 
-  2088281328,  1696485025,  3044395709,  1114335939,  2777285388,  1089272110, 
-  2514184713,  1052401222,  4231695282,  4246740349,  2117355945,   592811160, 
-  4230946739,   903016992,  1430255563,   318940858,  1019785081,  4005907417, 
-  2461881433,   261784519,   618996903,  2335278570,  3967908416,   146902230, 
-  1744503103,  2832967774,  3162752289,   753814642,  4083901462,   827570030, 
-   672538950,  3491536109,  1824344454,  2252749438,   372134736,  3474148697, 
-  1388905979,  3452308414,    26175452,   142697066,  1724425259,  3278706859, 
-  2125865286,  1930334434,   733034992,  1539091945,  1870799894,  2040545073, 
-  2008429830,  2356144034,  4196812024,  4262217390,  1410913583,  2057201587, 
-    96355004,  2767684682,   328562323,  2375402429,  2773390957,   293038095, 
-  3511959079,  2657396237,  1814087746,  1410199878,  4112995543,  3432312395, 
-  2936661117,  4206341794,  3716561453,  2287423507,  1622818046,  1690675357, 
-  3027687267,  1080919590,  3555011423,  2269751392,  1974226517,  1101601477, 
-  2013834764,  3222634640,   433904909,  3566893224,  2884698897,  3333992438, 
-  2559286705,   731285654,  3745175581,  1152237530,  3849367207,   913545131, 
-  2343867234,    73471744,  1465228163,  3329755212,  2874412267,   357719480, 
-  2372307237,  2250764778,   230737113,  2188597609,   350574759,  1510430925, 
-  4187480666,   778954876,  4129069711,  1129893082,   821592391,  2965550439, 
-  3559745278,  1989035208,   655847452,  1279431621,   902854351,   451249069, 
-   435747886,   968749515,  3542444585,   556909946,   613520536,  1018104837, 
-  1239571327,  3569489389,    12975018,  4024001690,  1311638625,  2227928689, 
-  2630937013,   495752274,  2687466648,  1335128527,    93238925,  3610563585, 
-  3361337006,  2639113102,  3823872218,  1032555894,  3876989156,  1213676882, 
-   828003456,  1834010671,  3391155765,  3760386244,   278905664,  1798050295, 
-  1726521006,   217992094,     2818132,  1503355688,  2408073055,  2019382661, 
-  1173019511,  3983785733,  4129243291,  3285297209,  1954926000,  2683255197, 
-  3684941871,  3881483504,   213885187,  4105620658,  1356712054,  2105523085, 
-  3123129026,  3861595758,   892315138,  3358759456,  2998182802,  3635280692, 
-  4230568858,  3736564227,  1186481503,  3511468220,   480908081,  2310356882, 
-  3463215423,  4058363457,  2939353685,     3467521,   129305026,  3676697019, 
-  2494812991,  2548372460,  2794077173,  2591247928,   612284214,  1510032248, 
-  2756843047,  3006315862,  2970052452,   121377223,   541595649,  1165996122, 
-   340950983,   476641156,  4108975171,   825000922,  3550748441,  4184489088, 
-  1457112749,  1413842090,   100719967,  2314512497,  2411341106,   741528801, 
-  3581874462,  1715752954,  1726120854,  4028179101,  1998891142,    47598192, 
-  1175075279,  1167030221,  1244624183,  2083954225,   141383364,  3898707069, 
-  1122339025,   265783095,  2709769095,  1888795559,   476950552,  3386249684, 
-  3505210596,  3527611330,   422763106,  2188997395,  4115874636,  1805446405, 
-  1491167956,  2775970800,  4100922272,  1993591081,  2462414094,  1837250956, 
-  2726777496,  2998271668,  2584126765,   573648769,  3329657661,  3080107532, 
-  1664176347,  4118816380,  3913949733,  2280520790,   472143518,   636006186, 
-   185809275,   160345089,  2823356389,  1714361787,  1688919262,  2165128818, 
-  2161567074,   359713540,   611452690,  2381530404,   993951258,  2182428408, 
-  3465917816,  4241753322,   908668029,  1607106621,  3770792152,   949840153, 
-  2289622852,  4002939613,  1000950034,  2904726403,    70686247,  2472733240, 
-  2084072533,  2434178487,   185425841,  3842301863,  1960696710,  1680318775, 
-  4053879187,  2740682890,   463735568,  3817600966,  1594183447,   420607327, 
-  1562805591,  3879520004,  4010552909,  3782080716,  3017492755,  2447706958, 
-  2057849216,  3952516262,  3668623301,  4080796690,  2073022350,  1243858001, 
-  2946215021,  1430102747,  4279679394,  1536534055,  1217495561,  4079456445, 
-  2630667189,   436964332,  2267810305,  4141934545,   922750430,  1152165823, 
-  2817705172,  2205959784,   730822377,  1843854318,  2976308028,  2653936699, 
-     9892892,  3977135363,  1195179809,  3822861594,  1792897076,  2475256588, 
-  3637548978,   935348531,  3546050373,  4075239247,   213005621,  3846217061, 
-   602066509,   647266762,  3527677406,   860697193,   743782784,  3161974107, 
-   980236891,  1453140659,    74179812,   246288686,   931024664,  1011290664, 
-  2700391768,  3587629508,   821101114,  3560048719,  3948841551,   403578727, 
-  3486619262,  2475368903,   435990361,    19170563,    96962841,  2142507019, 
-  3324622118,  1365791786,  1006020059,  3974006526,  2599774805,   879901830, 
-  1369260625,  3938586102,  1183366850,   577772021,  3514611900,  2777259148, 
-  1801257195,  2844935650,  2699732478,   973439323,  2275256298,  3895400180, 
-  3689768865,  2602906082,   707613264,  3935342201,  3592341570,  3918221115, 
-   715711309,  3833766204,  1118789803,  4136894622,   196414719,  2649654369, 
-  3902720419,  3299661903,  1275299257,  2277885553,   128836226,  3314190013, 
-  3667608734,  3643705006,  3308517174,  2382380983,  4209004826,  1525208621, 
-  2759667918,  3903780982,  1323548281,  1503770228,  2939943535,  2558655029, 
-  3330232806,  2092026592,  1978626690,  1764357799,  4290786036,   155648352, 
-   822637067,  3321837729,   902230392,  2334675321,  2140769047,  1358855900, 
-  1333296509,  4065577983,  3915437451,  2677580209,  2996792923,   493881984, 
-  3895109945,  3449919112,   466656449,  2184629090,  3270512963,   143839497, 
-   475097086,  2363248612,  2042590464,  3776914079,  2713392396,  3218830572, 
-   614292528,  1411526605,  2549069663,  2456585661,  4230382642,   448651643, 
-  3830354197,  2675457830,  2315772156,  3060411578,  2683287664,  4111390098, 
-  2592128446,  2973275493,  3799709153,   401351430,   456132277,  2158224515, 
-  2196055746,   184900494,  1125754218,  3205703637,   357884822,  2806408871, 
-   103160720,  1167394895,  4238710286,  2741552404,  1254432106,  4026991696, 
-   987600169,   527066901,  2869182206,   975446920,  2638882743,  3627178677, 
-  3017015893,  3429046632,  3906942929,   812658934,  2136710410,  3197096750, 
-  1311182832,  2863322924,  1139758704,  2408516961,  3396117773,  4253722100, 
-   349756116,  2793284834,  3227985820,  3429271192,  3273701300,   141680234, 
-  1705798638,   736159633,  2004495167,  2142147387,   577914486,  2966457903, 
-  2566511913,   497825332,   741974619,  3919484286,    88342837,  3725839114, 
-  3302362470,  3744057265,  1201218009,  1711505181,  2327929278,  4130231459, 
-   664989158,  2183964688,  3145373120,  4125760127,  3584301112,  1139024375, 
-  1174933321,  1926909519,   916828632,  3279379717,   190679404,    29903701, 
-  3441860467,  1207370298,   489621616,  1876145150,  1383098076,   226857504, 
-  3855796623,  1677463729,  1816150780,  1817437756,  2363976225,  4055523015, 
-   104463268,   115410356,  3595918207,  1373676015,  2911450599,  3628194575, 
-  2939805682,  1755425819,  1596658505,  1871698697,   470967274,  1939781313, 
-  1654568482,  3641539044,  3604173485,  3317586235,    49146884,  3242076677, 
-  3928834772,   502229635,  1588908855,  1395254369,  3798509876,  2356823426, 
-  1535232888,  1030052446,  3398929369,  1814146181,  3909802523,  2084367399, 
-  1121485720,  3451988870,   737087483,  3536089523,  1841827480,  2719757000, 
-  3315052718,  1680844672,  3495741534,   709166025,   372992367,  2051341813, 
-  2625016398,  1483851354,  1326411752,  1203441402,  1801390863,  2688794052, 
-  1449246455,  3053686634,  1754834098,  1659337977,  4062680025,  1470470690, 
-  3444137954,   752978384,  1070289320,  2915123344,  1117942418,  2461096653, 
-  3459149528,  1983757240,  3168845396,   718579809,  2080010167,  1008686508, 
-  3932346812,  3002607323,   199926629,    64341053,   952477685,  4110894694, 
-  4054437675,   853686566,  1617625440,  3664748787,   973493157,  2398580105, 
-   414776736,  1761450470,   865991777,  2254639114,    79137688,  4284308935, 
-  4233455210,  3547145227,  1510485355,  2335629819,  2258648648,   251090001, 
-  1001353705,  2641842202,  3602919755,  1126147241,  1501319067,  3067678473, 
-  1786268952,   319688418,  2274618767,  1163173362,  4031491560,  4259893793, 
-  2315154206,  1488177200,  2861162499,   886213826,  2096191340,  3318050711, 
-  4005138387,  3866335850,  1922030118,  3415508704,  4124281248,  1173342267, 
-  1175545303,  3409316729,   748043634,  1279163039,  4216790648,   983343213, 
-  4173859243,  3076992137,  2364512898,  3306124177,  3145238535,  3891228264, 
-  2432873705,   724753208,  3968977254,  1008272748,  3180040288,  4126845273, 
-  3311707957,   388796158,  3978984402,  1892519475,  3275851931,   832545419, 
-   126099364,  2937016866,  1907331449,   320306094,  2538126047,   646577755, 
-  3638685149,  2922865986,  3071296812,  1111197113,   431177625,  3801368476, 
-  3142472093,  1419528195,  1459611628,   273153895,  4068456465,  1172915453, 
-  4232544908,  2650720458,  2158342608,  2407959657,   865800503,  1930125992, 
-  4247867850,  1115380772,  1742510246,  1399390740,  2576867545,  1138615338, 
-   921847385,  3183147789,  3502914210,  4214657383,  2699303099,   596079415, 
-   660263412,  1392864638,  3387050392,  3073685757,  3999064539,  3753205430, 
-  4097385690,  1152461795,  1946349111,  1675541826,  2534171860,  3253359909, 
-  3245522559,  2420519675,  1670203537,  2466994667,  3721113270,  3661170007, 
-  3795675437,  3148480467,   130022709,  1457576711,   620478427,  2515913219, 
-  4140255346,  2000093257,  3297370681,  3828674803,    97520491,  2294749584, 
-  2800730728,    66326166,  4202219466,  1023239925,   264514203,  1057100712, 
-  4040635563,  2616359058,  1487708740,  2831212086,  2092166058,  3744496893, 
-  2305345156,  1930459809,  4049970356,  2861144713,   461043690,   511851881, 
-  2338314586,  3320756074,  1401935640,   741128383,  1605097020,   219256611, 
-  4023323028,  2873492676,   116363549,  1486525688,  2645695603,  3323267125, 
-  3079218839,  3541393250,  3736436489,  1151438979,   249324134,  3507877125, 
-  3684294148,  4230052415,  3532225564,    63510774,  2422987429,   170961062, 
-   631726596,   460127685,  2610653443,   118123538,  3302083432,  1182202796, 
-  2574187123,  2868045779,  1626756710,    91085173,   523867826,  1530872440, 
-  3266227811,  1611720833,  2973226922,  4130573943,   672378672,  2302853897, 
-  3324556383,  2140849402,  3255056351,  2504099554,   119035872,  3259814751, 
-  2383360045,   178890004,  4216371572,  1835747028,  2147526198,  4116890510, 
-   548907245,  1164683216,  2114414592,  2120922022,  4182286946,  1913317807, 
-  3822271665,   212076402,  2644410849,  3991442543,  3537996351,  1261075456, 
-  1065143826,  2534703304,   243966603,   975325608,  3040621487,  2146447948, 
-  1654863975,  3414498594,  2559729695,   891046677,  3982390051,  3469038806, 
-  3708579363,  2042146412,  2600853554,   665564391,   204503999,  2628820525, 
-  2059488156,  2190958713,  3975896895,  4256809751,  3334171165,  1797659297, 
-  4278746889,  1993412314,  1338687861,  3258100049,  2564721985,  3137324158, 
-  2777041409,  1316733336,  2967271574,  3261914640,    52498690,   922044609, 
-  3236465708,  4104488440,  3308432682,  3368212641,  3969995073,  3530815228, 
-  3250331275,  1612894037,  2030682655,   689038336,  3088398277,  1069515257, 
-   735156457,  1288170926,  3421821147,  3002015339,  2834570118,  1051661936, 
-  3502320553,  4009233964,  2460835729,  1762243848,  2948845258,  2232618168, 
-  4011663882,  2131015257,  2944153532,  3884313083,  1167327861,  2309515229, 
-  2742774896,  1764027578,  2778211510,  2066778473,  1748855553,   711653803, 
-  2991159918,    66350499,  2231459129,  2209499484,  2118803043,  4008492190, 
-   592798272,  3685927769,  2232564086,  2523394680,  4093031464,  1474629363, 
-  3672844873,  2322320461,  1143623280,  3227397901,  1114857571,  3073234977, 
-  4105587697,  2278851551,   525886695,  3611450478,  3186428973,  3932939100, 
-  2666216993,  2154797908,   195323389,  2806996631,  3383052764,    89109265, 
-  3485667850,  1616719922,  1415246656,  2158024528,  2537606761,  3619893101, 
-  1302742467,   214730760,  3448652958,  3773318890,   488613468,  1798689100, 
-  3235149955,  2446292810,  2895085248,   565326996,   109808295,  1166968611, 
-   862796992,   291445622,   746635697,  3588849941,  2253257677,  4092336391, 
-  3607403026,  3921113272,   364063250,  1907798571,  2565402775,   638218268, 
-  2913187736,  1445997349,  2455156546,  1891700454,   531864037,  3814322969, 
-  3309668349,  3914500206,  2171829856,  3550909434,   669807821,  3576794371, 
-  2073098489,  3640598854,   462077624,  3830674355,  2242949417,  1538219836, 
-   283707476,  1672024657,  2708323757,  3868384152,  3228353390,  4107859362, 
-   312556030,  1106514024,   322052227,   676681160,   228317399,  4051409170, 
-  4279280813,  1600492969,  2441183867,  4200984531,   420781440,  2584548316, 
-  1457866139,  1498262739,  3797471921,  1911895023,  1565171051,  1329578950, 
-   909213766,   344621526,   248748757,   672489240,   454529929,  1833902544, 
-  2948656681,  3410280273,   526028024,   273414674,   780768607,  3620789606, 
-  3835705507,  2323078568,  4188071914,  3457482276,  2945234167,   476299525, 
-   466888934,  3902781259,  2215891311,  3464760662,  2178182262,  3040281078, 
-  1539523976,  1566660432,  4008510300,   283964906,  2062655112,  2705930309, 
-  2263134406,   376990352,   163258794,   941852987,  2911471659,  4023119500, 
-  3525015345,  2882934454,  2047234443,  4075496896,  2394495998,  1293005659, 
-  2032857234,  4088977491,   331723693,  3857896027,   734575372,   484114738, 
-  1093135131,   331017957,  1339659603,   403955928,  1966600954,  2860684026, 
-  2715224911,   341800905,   293284821,  1374563131,  3422483551,  3431609349, 
-  3846104662,  2662503718,  3122350749,  1579160295,  2780411923,    38181468, 
-  3160697768,  3047364594,  2068602490,  1092103965,  3279036578,   795545279, 
-  2011614073,  3304950817,  2731797963,  3522458457,  3101370512,  1000324113, 
-  3292583571,   233806134,   400043528,   356916736,  1981227179,   175427402, 
-  3740067564,  2653826674,  2529709833,  2158090054,  4137659543,  3612339141, 
-  3849142000,  2723959256,   486748291,   439987234,  3421605013,  2834442548, 
-  2139397730,  3549097161,   791123542,  1507188122,  3160409526,  1171487365, 
-  1061693790,  3554173914,  1936471672,  1197917339,   732238633,  3204462780, 
-  1757020096,  3315534665,  1603475131,  1179773770,  4009951747,  1051069736, 
-  3481755518,  2222300994,  2185612665,  3824437095,  3163931231,    90491252, 
-  1842844865,  3522904326,  2692581450,  3515691393,  2811190042,  1975574162, 
-  2857582417,  4086912106,  2065324715,  1135167479,  2165868900,  1065105570, 
-  2003422353,   895409484,   395659845,  2147102242,   537233375,  1485881856, 
-  3098001415,   251265061,   669460202,  1773076640,  1528217868,  4132906021, 
-  2790816685,   878945828,   580620752,  2883813061,  3313386740,   770565456, 
-   565700849,  1978732320,  3344822578,  2115652162,  1110674627,  3227434239, 
-  1142700274,  3571247575,  3162884050,  1969115426,   413703615,  1406283394, 
-  1752220789,  2448338544,  3570280533,   860242245,   341625482,   303931741, 
-  1806024285,   298765179,  1773695188,   244928024,  4092509815,  2540695165, 
-   144978201,  1283243641,  3230365222,  3676155018,  1760589800,   809249633, 
-  4048783350,  1312535374,  1162647459,   969146107,   461916980,  1668818715, 
-  3017956133,  3860414521,   998963676,  2540548513,  3444271070,  2365172892, 
-  1538951513,  3944869602,  4055472402,  4291815786,  3922502850,  1947830619, 
-  4168524169,  4105297216,  1568095786,  1209847873,  2604492629,  1694194642, 
-  1690035127,  3666639813,  3317184864,  1349043137,  2880305334,  3890119009, 
-  3717047922,  2088549909,  4146106927,  2944457973,  3399377810,  1242103607, 
-  2271791682,  1670478083,  3761688181,  3951150605,  1557240425,  1910694456, 
-  3859068829,   300376114,  3961700792,  2279909432,   779166729,  3584262943, 
-  1138026278,  1293025864,   451065908,  3948491974,  1712295284,  4105187171, 
-  3374984028,  2345025016,  1652134169,   777314392,  2615233616,  3834442529, 
-  3628223846,   410589070,   794893430,  3990436780,   614827104,    98419925, 
-  3050462314,  2025744782,  3630514462,  1014348254,  3770342038,  2096173208, 
-  2040759549,    58849711,  3901955446,  3090826029,  4223154932,  2403534703, 
-   119219846,   310903977,  2180333610,  3334808929,  2352347784,  3451592106, 
-  2152660991,  4032903295,  3814094909,  2339981604,    38914890,   108072682, 
-   803649543,  2667160678,  3414987476,  3764416459,  2129830387,  1728376030, 
-  2536125558,   412735067,  3073673003,  2973165789,  3074077584,  1442951000, 
-  3164916948,  3288578422,  3114157831,  3882773404,  3514751881,   601854729, 
-  2381037706,  1177766165,  3801326421,  2487798057,  2213157360,  2188044361, 
-  1776143915,  1662215003,  3340560215,  4253307194,  3546966017,  1532567040, 
-  1932836698,   935152485,   514180061,  2349663250,  4236501410,   955770994, 
-  3235270226,  3843132549,  2045593002,  3303846945,   596972915,   779230059, 
-  4178567886,  2837114890,   804317591,  4092331201,  3922047070,    22696617, 
-   469244177,  2624216518,   462705093,  1011671211,  3488046278,  4095143500, 
-   372857653,   663476696,  3816756242,  1663989988,   570437691,   170555061, 
-  1042836502,  1851525394,   955408555,  3112081673,  4218797961,  2681073052, 
-  2571137702,  4051416880,  2241560340,    26067011,  1939426523,  2370586175, 
-   998091069,  1908141827,  1379238619,  2356285846,   319081729,   406631165, 
-  1581380497,  1228515350,   595474229,  2789794132,  2410878949,  2907392716, 
-  2795242659,  1126150975,  3906597421,  3519114649,  1023444544,   354699750, 
-  2435330044,   457953338,  1639847488,  2902718922,  2304525684,  1039898625, 
-   461883808,   598562037,   113253441,  3234634968,  1662041676,  2274184347, 
-  2591222797,  1704263375,  1188026029,  3318670687,   442411351,  1628272593, 
-   100790599,  4064505723,  1557774459,  1906626959,  3076405444,  1944487502, 
-  3379691095,   955339763,   489751950,  3284279445,  2046474644,  3471561029, 
-  1717451932,  1357411945,  1682459070,   707399079,  1601408381,  1909470290, 
-  4060995280,  2500277293,    11379861,  1584136661,  2240020710,   429136922, 
-  2954758731,  1664268286,   609182972,  3915402788,  1818823246,  2584368834, 
-  2392490011,  1117231368,  2984936866,   413466182,  2590716774,   490495998, 
-   567531811,  3772583765,     2270259,      616798,  2404526161,   785205748, 
-  3491200488,  3892322268,  3848648878,   731204020,   580168451,  3554667942, 
-   748275148,   402499983,   267286089,  2085328659,  2386298237,   136538441, 
-  2229851774,  2482210130,  2509181792,  1984481472,  2231200485,  2054779383, 
-  2601402840,  2533616819,   108317630,  1327984568,  3638268141,   970258291, 
-  3171208146,  1140945287,  1545530833,  1221530572,    69714641,   329325041, 
-  1842794914,    15144837,  2887980987,  2509365887,  1270124095,  2365385801, 
-  3306227603,  3095009408,  2910627888,  1217633352,  1852141531,  3784988033, 
-   656153686,   597410768,  4111616581,   914153977,  2763286051,  3089407775, 
-   357793624,  1585944288,   633746266,  4039329506,  1199985248,  2037904538, 
-  3837861406,   203826884,  4043677903,  2305897386,   960267742,  3166942604, 
-  3520744594,  2159715680,  4106826001,  1091489175,   570481577,  2584068533, 
-  2933950521,   565103866,  3697868051,  3619695761,  3531597206,  3661247106, 
-  1962548405,   501776719,  3079321434,   198335804,  2386711525,  1598536954, 
-  3873055201,  2759161341,  1278838543,   607411820,  2965916682,   954879719, 
-  1231804538,   293595421,  3475640477,  1937322678,  1252048225,  4141622499, 
-   428477520,   148908090,  1536555125,  3645104207,    17332925,  3528885762, 
-  2983407729,   709829644,   355412287,  1880128203,  3935780333,   806261307, 
-  1637437793,  2574496483,  2091653077,  3746393249,  3114742806,  3949856494, 
-  2556425386,  3148586507,  2489786372,  3063473542,  1102531696,  2704829311, 
-  3908985310,  1938314465,  2549144550,  3547306184,  2317558667,  2137137699, 
-  1486649506,  3730109379,   199992695,  3204970780,  1638009168,  4052660214, 
-  3529631565,  1370913727,   634735514,  2489124757,  3605149402,  2190083118, 
-   693730996,  1019296826,  2695970047,   181221610,  3412911162,  3588920743, 
-   370355824,   673755814,  2642522135,  2682882181,  3015248855,  3817532708, 
-  2526275951,  2342865834,  1967001580,   957406137,  1715087596,  2712823631, 
-  3252558026,  1678722865,  3452823447,  4085918322,  2259428330,  4123005522, 
-   331788960,  1376060886,  3667308281,  3457673808,  1887668433,  2737355742, 
-  2083440435,  2069948857,   865374720,  2022186249,  3326755051,  2666893800, 
-   277461378,   598724135,  1428151889,  2343168038,  3775990348,   677573474, 
-  3496175232,  2248411097,  3375740870,  1263112389,  1925775083,  2366594105, 
-  1853400410,  3845051993,  3509133639,  1495178536,  3713882664,  3511555335, 
-  3865845343,  2375937254,    66112458,  4171871853,   292173921,  1069539912, 
-  1304724181,  3181543680,  3778529721,   269830255,   323931361,   810881593, 
-  1491664091,  1088022392,  2673989886,  3086986077,  3139366857,  1423850741, 
-  2152475394,  3840251374,  3535470119,  3005322857,  4208493118,  3926755535, 
-  1488566089,  3131077136,    86903779,  3104564845,  1049910709,   339336088, 
-  3582430980,  2440702187,  1228911583,  1689712975,  3283902285,  2470109953, 
-  1291404980,  3080422408,  1876431491,  1921404252,  4262315378,  3700234434, 
-  2053308927,  1914329972,   723887712,  3153549030,   113632826,  3018287049, 
-  2466068073,  3316744064,  2867199807,  4072027659,  2059562961,  2211791246, 
-  2463500221,  3719403933,  1985753335,  3537736672,  3960834755,  2035512134, 
-  2758757368,  3346771828,  2092243668,  1042087524,  2134327505,  4009546872, 
-  1373709272,  4053397979,  1609858605,  2366705240,  2726281042,  2464262074, 
-   483966588,  3956094885,  1125932497,   104024321,  1452176670,   373431338, 
-  1533555019,  3023969334,  1933060183,    46296548,  2008510922,  2220148345, 
-  2336847308,  3645423490,  3818705272,  3644798645,  1418729523,  2226493755, 
-  1186132331,  3208445845,  3370916692,  3160432759,  1750913510,  1178388880, 
-  3452568162,   799393077,  3663633952,  2506711252,  1595569939,  2251633045, 
-   230355785,  1549072476,  1961504201,  3336541105,  3774298745,   176796424, 
-  1670258216,  1499343996,  3614136565,  2452250071,  4014747629,   276560533, 
-  3392199554,   693585020,  3958651256,  3320626185,   902802299,  1571866368, 
-  2447999722,    69536543,  1006547021,  2727134678,  2154892538,  3274213801, 
-   213352719,  1890313968,   558496352,  2854130530,  4131483812,   200198466, 
-   103389167,  3699361186,  3386297569,    73444972,  1237272196,   993274541, 
-  2991356590,  2696086076,   411514678,  4195443059,  1831308188,  3714166476, 
-   616882695,  1102599147,  1918799617,  2446009866,  2103050197,   593171226, 
-   409980894,   689060057,  2889365694,   880350490,  2881960809,  2385768737, 
-  3547828728,  2325351568,   856060448,  1062180322,  4050927266,  2442547410, 
-  2759039569,    96191462,  3926575792,   854443533,  2573592819,  3830385540, 
-  1294078706,  2000869588,  1062624536,  3181783693,  2309540231,  2354448509, 
-  1333855841,  3038331552,  2949075491,  3779956080,  1097223292,  3559637379, 
-  1750169979,  3046884490,  3325811605,    57715309,   953081702,   113534135, 
-   252200898,  1872706628,  3606567305,  4157332261,    62072772,   455165505, 
-  3979631744,   407784334,  2294761186,  3416185604,  4264083773,   561281411, 
-   416766838,   507243855,  3840272618,  1078986311,  3472078970,  3309881310, 
-    82159362,   889473571,  1066428661,  1302739002,  1392008164,  2726486232, 
-   579439564,  1548536078,   171180404,  3102039380,    44356225,   869115977, 
-  3660506424,  1455765294,  2459054750,  2690618114,  1488075929,  1489281921, 
-  3909509969,   526640073,   835384457,  4216546185,   123351337,  1550076728, 
-  1943081987,  2739256278,  3478181553,  2458651514,   911786738,  4243830166, 
-  4245859047,  2249430657,  1015374083,  4103473364,  1234154180,  2829068448, 
-  1797407965,  4291515607,    98109679,  3898272585,  4037905860,  3641858575, 
-  3974874161,  3447822050,  3223430733,   795335474,    30187215,  2711968285, 
-   872041854,  2781957578,  1757691460,  1544606638,  3407389038,   757213913, 
-  3549534548,  4222816851,  3802360078,   930710195,   787026016,   104178225, 
-  1957009377,   910657279,  3139337489,  3917642673,  3155236214,  3522213560, 
-  2721227136,  2844043041,  4113006557,  2332883297,    43308647,  1546992789, 
-  4143462288,   661896766,  2180811389,   351160089,   396550681,  2898505983, 
-  3709229630,  1538660082,  3638032317,   736305011,   116479505,  3786388905, 
-   306779959,  3934637663,  2432583059,  3772465586,  2790075799,  2805769060, 
-  2064694814,  3469600201,  2113936661,  3923922293,   914255399,  3744136187, 
-  3237761989,  1576675264,   141801470,  2323149142,  1106231384,   323616754, 
-  1402699976,  3159114033,  3342503806,  3112828697,  2828741932,  3071752021, 
-  2994811677,  2621393626,  1791286255,  1095161631,   182001711,  4243449448, 
-  3696007004,  2910968265,   622921884,  3254881480,  4187253238,   766836795, 
-  3667870594,  3925817758,   934931355,   945233337,  1131605005,   787128731, 
-  1724310324,  2072618669,   515519313,  1201641859,   886136217,  3918512836, 
-  2086598441,  2252906881,  2285373115,   982511541,  3137684712,  1110492110, 
-  1709422868,  4188543030,  2543553601,  4065379001,  2910358216,   807617467, 
-  4287181264,  2450949646,  3640702996,  4107723912,  1289226192,  3092906099, 
-  2610630294,  2018805121,  1515676248,  1143018261,  1109819275,  3265770351, 
-  3105843639,  3176697907,   934026105,   922650000,  2119185096,  3937104235, 
-  3405089474,  1626911461,  2491629993,  3550115621,  3615253851,  2185286007, 
-  4250970605,  2247141194,  4160009317,    19851053,  3029883115,  2473778054, 
-  1073701048,  2990007778,  1741645285,  1113494761,  3661750244,   293906095, 
-  1584178722,   613297421,  3810254128,  2287828410,  4057983804,  1525607905, 
-  4218656192,  1774967608,   479512120,  4084804423,   529711759,  2920016361, 
-  1516660648,  2881695336,  1276472177,  1076464589,  1609903015,  4277262053, 
-  2925435243,  3416496871,  3534352229,  3025685044,   956944197,  2970061449, 
-    26418005,   633049266,  3343765969,  1516565017,  1495320531,  3851505893, 
-   960648614,  1890976109,  2267314250,  1423628819,  4072595317,  3277143652, 
-  3600414311,  2932374255,  1269121955,   657889522,   277108743,  1674833452, 
-   624598503,  2965422928,  1656456005,  3265238803,  3779955301,  1109021291, 
-  4054648752,   220488884,  2552032788,  2151859273,   342645771,   144324456, 
-  2360756626,   699597589,   257232530,  2043294209,  2956421841,   260837687, 
-  2076623840,  3627401429,  3043540959,  3470550645,  2833569086,  2714383323, 
-  1093280431,    97836152,  2813460043,  2400327094,  3220790402,  3298098580, 
-  1650994967,  1034346017,  4087190900,  4146835364,  1455539959,  1424731905, 
-  3245469070,  2905531820,  1899921945,    56134865,  3244243069,   176920034, 
-  3508073447,  1674746030,  1073743090,  2578392335,  3405869426,   565224543, 
-  2772891695,  3708714589,  2066248952,  1975834706,  4143600982,   440279851, 
-  1407214380,  3854980005,  2469050367,  1809946969,  2449827299,  2216035302, 
-  1195223484,   908527880,    43248172,  2708344899,  1877032341,  1295625855, 
-  2721424047,  3644966707,  2151097894,   648283244,  3443915759,  1509431988, 
-  1779248918,    23853276,  1111557288,  3221601138,  2224660190,  3661287553, 
-  4238552514,  1104543573,  2082147032,  3642920145,   413334954,  1287753693, 
-  1765056731,  2792237399,  3082654508,   956796352,   297064068,  3211194041, 
-  1105242974,  2407628431,    14003263,  1600210993,  3004333051,  2323960674, 
-  4165663960,  2997060021,  1691989988,  3896088588,  2245270018,  2961489519, 
-  3354850277,  2744653085,   925085051,  2974235296,  2989883645,  1964529360, 
-   958559553,  4138774919,  3256392716,  2781039475,   935391315,  2515205402, 
-  1070811670,  2029212296,  3350282367,  4245104010,    56484385,  4006896294, 
-  4272496100,   808422964,  2051009391,  1332973690,  1975088108,  4151630823, 
-  4220399352,  4007936070,  3870389337,  4232470156,  1192714609,  3591344025, 
-  4047205476,   742175401,  1946387395,  1871043879,     4864612,   269480512, 
-   780835661,  4240346617,   913946510,  3387820089,  2717333846,  3211135430, 
-   837486438,  2259333804,  1936341866,  1587857850,  4028155183,  1357558777, 
-  1632254147,  3312161380,   766125424,  2495545458,  2613066683,  2326318025, 
-  2768203392,  3243780720,  2439644382,  2148783497,   498160676,  1026892037, 
-  2810096850,  2094321311,  1328757061,  1748632439,  1944960706,  2975813702, 
-   115182166,  1851377361,    90740162,  2932688305,  1448419717,  3425670800, 
-   560237018,  1514669904,   993023200,   245723229,   372898327,   822734221, 
-  2406810609,  4278988716,  1581409622,  4089087739,  1578701418,   874470794, 
-  3888408804,  1962176442,  1655630031,  1377432234,  1705006929,  4205351163, 
-  3312384279,  1318321279,  1247613027,   441686040,  1333601575,  1158807815, 
-  3571377966,  3829568266,  3768732672,   438865250,  1241305125,  2853595695, 
-   128271638,  1306931542,  2444756002,  2496220317,  3456885469,  1992560992, 
-   670924243,  1952827523,  1137531074,  3352353437,  1434349662,  1654074497, 
-  3997081237,  1166867418,  4127397225,  3021415807,  1526765203,  1356611044, 
-  1558495720,  1909698680,    86090655,  3830407614,   901136010,  1393955058, 
-  1749067090,  3777987976,   294551016,  1219487608,  3794773732,  2989076742, 
-   986959816,  2698863620,  1147953808,  3290476085,  2244610669,  1793336348, 
-   882475593,  1705202133,  3769259692,  3509327761,  3738816746,  2293249710, 
-  3102813538,  2767086256,  3064079406,  3398290900,  3537917822,   395964548, 
-   105136810,    47384813,  3918476326,  3210228296,  1523303056,  1205901403, 
-  1916833511,  2777739783,  1439008682,  3265459573,  1023729130,  4004642791, 
-  2176523093,  2713267368,   624730185,  4125970905,  1252161505,  1194361562, 
-  3925284099,  3867871191,  1117446501,   186953462,  2674137467,  2465872047, 
-  4172267928,  3146714826,  2714143779,  1769851125,   497528571,  3507403346, 
-  3443146828,  2195829951,  3888948374,  2047640376,  3670511853,  4147769799, 
-    94474009,  1068977888,  2329466569,  1179173496,  3902685951,  2100278889, 
-  4105943821,   213272730,  1501647165,  3782817584,  1147314200,  2624974141, 
-  3807985798,  1440933400,   289954241,  3321524985,  3520413149,  2495958487, 
-  1952675326,   541866731,  3335569179,  3364005854,  3988981030,  3701957638, 
-   281650814,  3112251321,  4275966031,  1827936735,  1158886758,    86891266, 
-  4066072455,  3912167447,  1627105478,   266554182,  1847788824,  2878968377, 
-   855970432,  3879858393,  1351088974,  4038072331,  2252726828,  3666367866, 
-  3892852152,  1570980068,  2007256612,  2414238011,  3211349834,   660626584, 
-  2135226337,  1526741214,  4050653404,  1594272429,  3118746395,  2180322548, 
-  1068929531,  4030083204,  2847265682,  2545462352,  1154300689,  1960746745, 
-  4277158417,  2158443040,  1791461569,  1989580791,  4203244820,   669281139, 
-  1423977766,  3922865652,  3826499115,  2567280053,  4168006751,  2343831795, 
-  1365563097,  2302735936,   380908911,  1676146195,  1820387525,  1223027723, 
-  2958101886,  1116413639,  3337282973,   363256475,  1958778584,  2809070975, 
-    57465045,  3938509358,  1878901612,  3862907283,  3458874173,  4133099949, 
-   972592583,  3765601874,  3410356390,  4145454523,  1114516077,  2578857278, 
-  2664754311,  2140577183,  2977542354,  4048393042,  1904981176,  1682256397, 
-   124801260,  4060422846,   281385677,  2460977306,   312053090,  2445882829, 
-  3856814726,  3629896458,   762060286,  1978084738,   181309615,  2636386791, 
-  3351955472,   719145064,  2883229978,  4159023450,  3641042510,  3820758125, 
-  2033311939,  2274277361,  1397825513,  2571380707,  2321934854,  3979638307, 
-  3883376204,  3683271424,  3412478676,  3825301736,  2244684483,  1887643743, 
-  2871363939,  2985404857,  2560426020,   212390843,  2240875928,   968782290, 
-  2992782361,   528343790,  1582619091,  2397410222,  3698149725,   732563876, 
-   228133322,  1516583757,  3724617881,  1027160603,  1468082273,  2585764000, 
-  4000213352,   631256121,  3519371364,  3719066456,    62131936,  3392567247, 
-   385978114,  1368571285,   186850235,  1030755664,  1134768117,  1804465998, 
-  4081498327,  3259789665,  1797452740,  3878694917,  4011684926,  1103862299, 
-  3808585007,  4240898966,  2978652363,  2698016264,  1660546530,  3084351078, 
-  2687710184,  2589770078,  2812815728,  1239203363,   402910112,   153181839, 
-   531974862,  3060044443,  1671296547,  3286427319,  1593488495,  2148565888, 
-  1192694619,   977997068,  3603420819,  1347344984,   874030085,  1942237996, 
-  2796405446,  1900653163,   128967745,  2704558212,  1769693179,    91885306, 
-  1845164922,  2719806373,  3304251420,  2623767050,  3023352465,  3902843001, 
-  1019202175,   221432931,  1403991460,  2409941464,   545626590,  3591792116, 
-  2300147652,  3982939351,    62791712,  2455886216,  1315208105,  3282697231, 
-  1182036832,   343315534,  3786843034,  4074711638,  1409297427,  1307498485, 
-  2425502769,  1226038482,  1058446606,    99709967,  3692761080,  3495621540, 
-  1151393863,   120088608,  2801373829,  3213594622,  1027711220,  2122216871, 
-  4131295527,  2071767280,  2640913853,  1229291606,   240773537,  1266497840, 
-  2771117994,  2063197247,  2310006298,  2376276489,  2249147130,  2877523049, 
-  2172569998,  3097711231,  3400035547,  2805111553,  4084911381,  2042522152, 
-   925774323,  1639277273,  3733524186,  2529788483,  1512849657,  1461265599, 
-  1208644054,  2341876261,  1826790191,  3271338687,  4216583841,  3572498544, 
-  1991281789,  2613401267,  2806471957,  2473799516,  2391827188,  2120131155, 
-  1728929381,  2475605758,  1908590592,  3044122063,  1903148162,  1365778416, 
-  4154457776,  2846231680,   206573558,  3935738428,  1699499932,  2461849386, 
-  3604735967,  3141215073,  1254493456,   930200123,   508253824,  3165127836, 
-  1911080003,  1956851759,   470853721,  1451494650,   514152949,  2446940803, 
-  1943669210,   560226504,  2389461261,  2049458283,  3194563295,  2222926714, 
-  4221601832,  1711341913,    53667132,  2985216505,  2386778890,  2720346091, 
-   842027440,  3762257711,  1044782960,  4178832253,   217324071,  3158192991, 
-   901915830,  3371988033,   697027483,  1536426572,  1754429881,   343152753, 
-   824061316,  1764596779,  1806067345,  1172656610,  4128036692,  3386618281, 
-   999189138,  2519350464,  1789009470,  1980360010,   412550649,  3684395839, 
-  4065071271,  2805376707,   239886389,   474730327,   387973078,  3844382386, 
-  2731255114,  1443266366,  4054534940,   735570996,    27856903,  3978035176, 
-  2328671766,  1535570853,   390928015,  2513957937,  1932579330,   838553083, 
-   700065442,   302105466,  3715080965,  1963219640,  2500912699,  3760837512, 
-  2847989343,  1801295199,  3888025166,  2532129274,  1288412922,  2130073802, 
-   487218933,  3522461524,  2434686745,  1882561083,  4092946962,  3941880020, 
-  1678165979,   239997647,  1259443081,  1344632253,  3959589443,   145941363, 
-  1215933836,   817866391,  4209629150,  3545268333,  2849003407,   478262784, 
-   601774590,  1281877034,  3538731935,  3925215300,   910572888,   704588666, 
-  1768734548,   546144315,  1525875434,  1108708449,  2947909622,  3366501908, 
-  2481954549,  3128729486,  3967445003,   724639015,  4036102488,  3570334860, 
-  4005570358,  4048193330,  3968791911,  2643354886,  3088889253,  1032541936, 
-  1410424002,  3091853163,  1660569651,  3935708096,   401934079,  1968784721, 
-  2186753635,   801911028,  1106793224,   590848758,   610528824,  3304132643, 
-  1577519104,  2040160047,  3245050387,  2067988230,   812211311,  2554843216, 
-  3007092857,  1660674948,  3918331098,    48923916,  2580178659,    28516816, 
-   698867403,    32762579,  4000950750,  2005825488,  1259729101,  2868051414, 
-  2875582875,   124316935,  2584254622,  3105703179,  3191788579,  1920359470, 
-  4030002916,   731534139,   760679973,   578392551,   659926517,   742914778, 
-  2719930921,  2178120562,   215029963,   487952312,  4050027713,  4247247527, 
-  1610130248,   750424982,  2313569504,  1665799798,   970843167,   938330945, 
-  2709209507,  3976707749,  3424755835,  2582400313,  3756118570,  1343393568, 
-  1664977322,  2724924445,  2306662148,  1046317773,  3545302665,  3758141323, 
-  2206446759,  1792192735,  2177657566,  2947928845,  1896582141,  1769879802, 
-  2665019653,  2941802258,  3897186149,  4083767100,   879328816,  2434190774, 
-  2322839213,   844032855,  3357335293,   621088707,  3622694434,  3699397675, 
-  2391695208,  4156221318,  1151507701,  3516972895,  3236665784,  1454937207, 
-  3242160804,  3156772589,  2737833086,  2788803836,  1487697995,   450468567, 
-  3009212151,  1126123662,  2683531371,  3607910475,  3794681135,   234317218, 
-   125160275,   810068984,  1458842621,  1332370413,  3276822923,  4211205006, 
-  3365192192,  4164780557,  3272875209,  2852957812,   177030731,  1720356131, 
-  3731846486,  1255095938,  2954980236,  1497731185,  3844475066,  2580930622, 
-  2109111329,  3620282545,  3027997524,  3376615341,  2053580261,   527500389, 
-   803645486,  1941468204,  1614891414,   384973493,  3536967372,   880854463, 
-   906546342,  1714727201,  3574471043,  2191442739,   360077925,  3388925493, 
-  1889406905,  1413613088,  4189091765,  3112564171,  1972507961,  4128483809, 
-  2824157692,   399668434,   775729301,  1853622663,  2701079103,  1104097600, 
-   418809035,  2183371067,  2528199461,  1206168117,   692019262,  2712246792, 
-  1025782160,   917056704,  1628880222,    96019324,  3465497986,   524209743, 
-   493130405,   242024098,   188539737,  2025084921,   705929463,  2297088190, 
-  1859739963,  3614869593,  2588204224,   755758770,  1032790626,  2903708526, 
-  2360424409,   887100037,  1158793448,  2907994324,  2140988034,  3898300683, 
-  2203335283,   719130100,   496982192,  2885113321,  4276589151,   316192881, 
-  4238958193,  1514160461,  1469412922,  2911734295,  1712256412,  1726038877, 
-  3812905137,  2106518572,  2206003606,  4048757765,  3359439589,   178182857, 
-  2971344570,   974211037,   381528624,  4215721421,  1699505165,  3288904870, 
-  1604616815,  2467948885,   481506319,  2254626968,  1462834663,  1023963368, 
-   143874687,  3867510656,  2767456774,  2576504348,  2933701761,  3474269261, 
-   906901571,   762132535,  1257335647,   311398004,  3752160803,  2971608671, 
-   402319738,  1304201303,   399006949,  1379936450,  3958640021,  2944169288, 
-  2821581850,  3833767539,  3164297908,  2500047708,  2434981012,  1270834808, 
-  3674758679,  1465931215,  3108264506,  2504409933,  3074107032,  2619662170, 
-  3835475668,  1749738319,  1252257650,  3690102270,  1763929919,   290056285, 
-  2115335887,  2832041770,  1549803188,  1332718507,  3843616101,  3426003819, 
-  2838810813,  3766472589,  2971938913,  4262525698,  3455695365,  1797717332, 
-  2605434997,  3529319937,  2717046534,  1039362459,  3937824956,   313231120, 
-  2064505129,  2148618149,  1338883668,  3793279726,  1656257857,  2613560900, 
-  1244861183,  3939839388,  3320353619,   291937054,  2228698895,  2679020622, 
-  3331470275,  4094836625,   726405652,  4148821005,  1301355358,  2831043366, 
-   622243829,  2672323331,  3154667983,  2026269154,   516574581,  2056753810, 
-  2453938045,  1077936662,  3135996352,  2801436436,  2448574713,   397811655, 
-  3911946896,   171217033,  2615591104,  1249287293,  3049759655,  3869851242, 
-  3073933128,   923631932,  4196364795,  3474144514,  1665752523,  3037134367, 
-  2665397336,  2981789095,  1653329441,  2787118795,  1194458869,   108265862, 
-  1533524677,  2154333118,  1876525112,  1679789904,  3240143479,   945938320, 
-  3969460481,  2751914688,  2118998331,  2466231372,  3755513301,  3184624306, 
-  3788324813,  3795166005,  3764851981,   778874545,   506087342,  1128622232, 
-  2047095687,  2318173218,  3920412193,  3663652836,  1142965086,   180863247, 
-   833914187,  3030977416,  2101657248,  2077303763,  1881704464,  3365999589, 
-  1757667809,  2065065091,    22064847,   926510587,   766031814,   459980158, 
-    13520050,  2642346873,  3713921414,  4000491811,  2006381132,  1560510328, 
-  2538475787,   556873240,  3081831258,  3011532636,   164154603,  3198208278, 
-  2330130538,  4046238501,  2598471274,  3997219871,  2168266256,  2596427390, 
-  1457631005,  3037150714,  2105168613,   755754975,  2075067659,  3150011797, 
-  2080152821,  2950838825,  1462384384,   890487493,  3182631611,  1989402927, 
-  2981934446,     1481614,  2445598545,  3476603503,   907939307,  1804278860, 
-  1461269694,  3366254950,  3998637589,  2505700963,  3725632633,     7160986, 
-   106570506,  1531669030,  2689889336,  3255682635,  2904458723,  2714911819, 
-  2869905590,  3488590556,  3844996902,  3442477177,  2201494480,  2078588239, 
-   670805219,   731333226,  2811068273,  3349403492,  2342318294,   650124544, 
-  3860062831,  2170202288,   661622754,  2521179578,  4005449810,  2057269257, 
-  3012731123,   918889299,  2267178132,  4015283585,  3562195148,  1613299808, 
-  3678960747,  2006298269,  1066865787,  3778630550,  1927430710,  1674339381, 
-  3094095805,  4148138255,  1043880525,  1370239620,  1036185719,  4236958754, 
-  2368900604,  1084545117,   741297228,  3556382513,   126946879,   214764602, 
-  2904102578,   273557610,  3973961251,   710153245,  3100928404,   532892345, 
-  4104354987,  1674264142,  3812699998,   418070231,  3179092648,  1010612509, 
-  3763937583,   942145504,   931364986,  1194690661,  2583765864,  2551014920, 
-  1074771908,  2149389775,  1881154037,  3225277614,   570489555,  3704352907, 
-  2800749042,  2139017032,  1592409082,  1385217871,  3652371816,  3419179099, 
-   292386100,  1821623798,  1547089743,  4289593099,  3765513383,  1824247772, 
-   344079747,  3725834383,  3575860155,  2369255061,  4026811363,  3546406039, 
-  2408817500,  4196481900,   849267388,  1593257853,  1609777890,   627554592, 
-  1198032261,  3968740625,   951895467,  3964530670,  3055177586,  2231726633, 
-  1936005342,  1634307976,   688594988,  1481549789,  1278268689,  1515626546, 
-  1932239577,  3241518226,  4069188122,  4161311138,  3390650317,  1415931283, 
-  2060945087,  3322949048,  2833361061,   750742945,  2203217513,  2617360107, 
-   810068743,  3868325853,   672025149,  4042254089,  2661751023,  2164509020, 
-  2440981977,  2045853343,  3943702598,  3722691471,  1184095005,  2137878561, 
-  2026768903,  1963785104,  2403704003,  3803783992,   722395427,  2318255445, 
-  3052878242,  1972621558,   840024616,   909068369,  2737582848,  3475363371, 
-   494797551,  3077035433,  3686205208,    95699761,  2147772766,  3915467436, 
-  3022575973,   590236691,   651662934,  4147407345,   959369282,  2564841462, 
-  1241824376,   623098340,  1218831680,  1137784890,   709515751,  1177274974, 
-  2519212412,  1779086266,  1910042581,  4055919073,   708978116,  3617926218, 
-  3089262452,  3504116701,  1271406048,  1958848230,  2992517999,  1444765181, 
-  1632925654,  2520628865,  3546998848,  1595278236,  3400510541,  3722249176, 
-  4087886269,  1004735320,  2766274926,  2663504245,   869007285,  3215960617, 
-  1629603111,  1947659409,   122255177,  1573041885,  1491062887,  3356449991, 
-   735044222,  1841557791,  4243696552,  3385023620,  3722004635,  2292564700, 
-  2288060180,  1974419554,   297972578,  2114389014,   537867321,  1432861510, 
-  3083869621,    59186273,  1102531990,   651056264,  1747278632,  2051458811, 
-  1373430056,  2544447174,  2605851249,  2518177440,  1597526605,  3391408016, 
-  2993451476,   855873057,    49825390,  2836081674,  3953549012,   576641752, 
-   562402612,  1744417379,   806046087,  1070856024,  2947588070,  3368381544, 
-  3583035333,  3828757508,  1779629224,  2826752415,  1874575081,  1603885290, 
-  1071431450,  3632699576,  1971098788,   986971481,  2905173479,  2519697869, 
-  1761488748,  2450844956,  3536109595,  3976387161,  2105161799,  1232365971, 
-  2757900379,   625517343,  2380496211,  1589990364,  3386143497,  1302341287, 
-  1689618760,  3533764665,  2874300324,  2659496943,  3933560110,  2351982617, 
-   756565550,  3675672836,  3912659930,   954225782,  1881696657,   942236305, 
-  1883647340,  1329589843,  2048016215,  2001875448,   821555526,  2017525818, 
-  1616643961,  3940422805,  4256997931,  1437716168,  1963183431,  1225392445, 
-   705992684,  3320510232,  3367863641,  1159977045,  2183580050,  3180674154, 
-   157135563,   146729450,    35646179,  1804178554,  1731408574,  1703619671, 
-  4007568018,  2315097959,  1601668757,  2981889874,  1781697332,  3963692773, 
-  4142967194,  1522599667,  3627318007,  3171413206,  1007621812,  2340547348, 
-  1188877054,  3050770742,  2189056539,  2985498320,  2033081052,  1378726787, 
-  3674296161,  1291195725,   340345143,   893835592,   301086364,  3104691057, 
-  2207489873,   589848280,  4125477917,  2546628531,  1131668373,   782957373, 
-  3403918918,  2531441202,   696761116,   287983077,  2795514236,  1643730829, 
-  2571455514,  2497847384,  2182824154,  2909388752,  3712734709,  2239597622, 
-  2320876782,  1600613546,   997440823,  3481033514,  2289991489,  2700415035, 
-  3315385899,  1708769425,  2912159344,  3359444521,   353815871,  3086591409, 
-  3286297109,  2555219830,  2680273173,   713517935,  2311747130,  1014296334, 
-   345043303,  3582536115,  1504444238,  1318891729,  3043420229,  2232114281, 
-   920285703,  3446671501,  1421328032,   726680821,  1894857714,   123108432, 
-  3048169057,   194187860,  3265887580,  2148374965,  3417036799,  1468893796, 
-   445722777,   519437013,   303054093,  2599982684,  3506252211,  1249022910, 
-  1764672748,   868711362,  1352031664,  4234165958,  2191358140,  4237395746, 
-   876373495,  3089677589,  2507190287,  3768109689,  3410487083,  2830419918, 
-  2530453947,  3085110356,  3981546838,   674059640,  3181705868,  3982922230, 
-  2216454062,  3190368339,  2447448766,  2606944918,  4258473143,  3273047399, 
-  3672515185,   425015929,  2412482282,  3390389996,  2305120168,  2694673019, 
-  1901584422,   426461105,  1750421878,  1527290243,  3406630005,  1750507567, 
-  3118099931,  3466978172,  2253871432,  1623388014,  3038157608,   702157751, 
-  2717684009,  3284241242,  1625045049,  2365735331,  3968429373,  1930861635, 
-  2884557582,  1693548527,   206807882,  1464771881,  2335495598,  1973884341, 
-  2290111718,  3685208272,  2011168641,  4260101616,  2010382538,  1513989849, 
-  4167460750,  4080595278,  1807878087,  2020749626,  2983649558,   904893075, 
-  1774401822,   224175656,  1100194381,  2969224120,  1240836388,  2753390009, 
-   865808677,   206563937,   639384917,  1456522460,  4034788773,   243113191, 
-  3709172559,  4065780201,   973425345,  1544798221,  2361846507,  2331964142, 
-   542747718,  3548363544,  3623158217,  1949025382,   536106092,  4126487236, 
-  1115120454,  1193679746,  1852725126,   300755022,  1748101941,  2662476338, 
-  1872352006,  1363542668,  1808191362,  4115866170,  2343881700,  2642334583, 
-   459938109,  1422270867,  4022667100,  2032864790,  2502229767,  2643517831, 
-  3790405954,  3722207411,  1057626805,   576206975,  3611216705,  3086842507, 
-   857630762,  1545084820,    98426225,  3395038923,   688133173,   604438735, 
-   383697224,  3656491768,   384613669,  3934752725,  1574993169,  3967020185, 
-  2627357308,  4122100991,  3374129211,  1379544581,  3361440586,  4024903098, 
-  1153255690,  3428431343,  4140019308,  4084330715,   701746019,   567616245, 
-  1289873320,  3426200444,  1602876024,  3274988593,  3519569303,  1619431339, 
-  1351364832,   253686350,  1787744259,   457802870,  1484108727,  3823736120, 
-  3669025989,  1797752554,  1875624486,  1876120159,  1932067012,  3315304981, 
-  3598191722,  3630365214,  2123199004,  2842830660,   102249870,  1864706643, 
-  1633589581,  2614201653,  1102586097,  1533993945,  3072490953,   437695847, 
-   697029012,  4133889007,  2922908337,  1050136567,   865126850,   586282009, 
-  1702195494,  1206459958,  2131676926,  3220687842,  1998918083,  4036948728, 
-  2050619068,  3456352003,  1945824853,  3849229546,  2567191675,  2362596289, 
-  2508478772,  3017645802,  2537413085,  2613169607,  1872287624,  4111583964, 
-   120656884,  3358264213,  4255149763,  3196836751,  4102693471,  2015957820, 
-   497839476,  2835329474,  2366701724,   362429302,  1477155323,  3074245129, 
-  2517681589,  2781836867,  3063069268,  4208333826,  3137368592,       98393, 
-  2499890335,  2598813783,  2190736995,    26278736,  2377975662,  4205022350, 
-   399538117,  3181248457,  3744991939,  2597828636,  1655947201,  1334906284, 
-  3142164897,  2852623108,  1538386784,  1953083131,  3041033426,  3124887634, 
-  1841198023,  2253280935,  2879153364,  2487643388,  1292323937,  4186278728, 
-  1580539735,  4171128696,  2770679804,   808051481,  1537678840,  2352313842, 
-  3229478695,   892712329,  3901322069,  3321686971,  3982185302,  3573989667, 
-  1151712052,   306028964,   134658943,  3754438035,  3354398546,  1464335445, 
-   940311090,  1757956433,  4281426972,   638430880,  4224430738,  1960292514, 
-  3608800447,  3047202785,  1277649939,  2891119061,  3392343774,   445539245, 
-   700183626,  1457278831,    80905938,  2438727983,  2266216716,  1319709502, 
-  2161152108,  2116236344,  2484791707,  4149484682,  1762754751,  1386559735, 
-  1703878973,    89269188,  1193854389,  1651958629,  4198734294,  3000227363, 
-  2006269305,  1048129981,  3742113658,  4181881598,  3099562336,  3235203867, 
-   903954699,  2232899358,  1210987719,  4085979439,    85948663,   178885687, 
-  1804223054,  1177624130,  3886927969,  1158749060,  2401743917,  1573077914, 
-   374428025,  1511047583,  3960545470,   603440965,  3311337149,  1716034430, 
-   423343323,   134433896,  3508359141,  1357982922,  1828125200,  1872688221, 
-  2570922604,  2464295350,  1733068784,  1322635582,  3970377438,  1403821854, 
-  1073985750,  3898588421,  1991050355,    22201496,  1470865269,  1590916294, 
-  1023880423,  1859370519,  2953686802,  4001899237,  3055545328,  1585471874, 
-  1266801245,  2072464667,  3422893026,  1953559784,  2723280196,    57443429, 
-  4225729705,   896750808,  3732295397,  2897004607,  1681929485,  2496100703, 
-   342336054,  1541710924,   551362133,  3602285531,  1530347728,  4081234313, 
-  1423911684,  1575616160,  1824335982,  3295644197,   732249525,  3292642691, 
-   591332282,  1332089631,  1195772158,  1844489980,  1813584930,  3608385825, 
-  1953509270,   922619309,  3437199521,   436977407,   570934907,  2184523660, 
-   980073091,  4281193113,  2579194223,  1551896973,  3832111848,  1705238993, 
-  1470510395,  3129858885,  1850291148,    25969495,  2885085675,  1065707190, 
-  1329733277,  2859963021,  3428518784,   503543030,  3636361844,   564388991, 
-  1948771893,   590827687,  3742151542,  3614074295,  2773796454,  2427510685, 
-   344352330,  1103638604,  1930433590,   312653235,  1982026887,   908749242, 
-  4220706283,  2550829526,   194365139,  2379345865,  3611301684,   354128658, 
-   930834520,  3948360188,  3461130751,  2881932184,  1191892745,  3966829206, 
-  1644415876,  1844223905,   144676873,  1912321982,  3266929852,   887302470, 
-  3170799611,  2967974444,  1774123265,  1445525888,  1345190977,  3124508767, 
-  1707054523,    37718215,  1752806237,   468944536,  1106992769,  3284685544, 
-  3548199773,  1695816979,  2939728999,  3670277065,   744744740,  1537098892, 
-  3478480213,  1526986598,  3613292311,  2182336988,    14975962,  1336877910, 
-  3660748776,  2668224056,  3317578529,  3673727113,  3967180417,  1330381319, 
-  3213189916,  2892658928,   825757591,  2770000973,   339871084,  1765301693, 
-  1956929874,   893739847,  3178207854,  1768846841,  4037402231,  2184029226, 
-  1461664264,   415809987,  1129847435,  2399268197,   178639142,  3390521454, 
-  1080370432,   171265172,   650737362,  3187093546,   779902182,  4115249943, 
-     7204256,  2944274171,  3165410382,  2797138009,   341430839,  1513442718, 
-  4092539426,  2432497413,  3764480611,  1603628500,   527963235,  2836716944, 
-  1223671718,   765158955,  1493512751,   998910537,  3309970161,  3497359596, 
-   478213702,  1053511663,  3887083026,  2409402483,  3581773205,   962723304, 
-  1024198225,  1641077090,  2997965076,  3856681366,  2033820802,  2091450581, 
-    21440752,  2920756029,  3200945764,  1121443338,  4237498289,  3579300966, 
-   185336465,   287602657,  1902442431,   285001808,  3253954686,  3105063153, 
-  2332163529,  3462754964,  3264791416,  1651454300,  3039998337,  2768607043, 
-  3455982765,  1791545143,   121489297,  2122407090,  3648855800,   791254876, 
-  3885540547,  4292062121,   225957440,   388288575,   618916762,  2127591767, 
-   249924009,  1001787762,  3311784354,   992333613,  2996929434,  1064745319, 
-  1179217372,  3046240666,  3829458518,   807401125,  4101292279,  3486268615, 
-  3663955771,  1087640193,  2122633707,  1080762917,  4008502001,  2407236619, 
-  2718156214,  1904012306,  2501194641,   146607083,  1358789338,  3969845076, 
-  2431690814,  2791201405,  3200289744,   844957971,  1021392100,  2098811471, 
-  3582645205,  1237701157,  2697355964,  2804287748,  3830173549,   266423866, 
-  1858735894,  2485722883,  1428397257,   505521952,  2807106280,  3922248780, 
-  4052884152,   571763579,  2158279577,  1514535930,   728897910,  3052643922, 
-  3175380167,  3697730689,  4054879982,  1207338381,  1201965258,  2525142255, 
-  3030181001,   314893023,  1609076303,   310480409,  2969836549,  2662705898, 
-  2636021680,   333957846,   562121982,  1194066988,  1085277110,  3773303335, 
-  3924189725,  3877252891,   916299010,  2153513028,   782584725,  3732207155, 
-  3586671183,  2371158465,  2757917756,  3344389979,  3255338806,  3037330008, 
-   266602264,  2746743380,  3943973006,  2643152866,  2441616201,  3476223904, 
-  3599000989,  1774852941,  3834924807,   376310773,  2077847929,  3307436205, 
-  1835008208,  2010982961,  2231353518,  3796528819,  1496898585,  3586575966, 
-  3867483295,  2944741222,  2466061967,  3893303655,   453543846,  3249607181, 
-  2626482586,  3722355222,   246321463,  1502726667,  3481597751,    64541038, 
-   136656749,  2001360340,  3346433708,  1596889837,  2792398398,   657855317, 
-  1498017300,   234497274,  1464041173,  2479345852,  3067539414,  2892103572, 
-   385542739,   558992777,  4049072868,  3293997387,   439818385,  2926154050, 
-  1867777735,  2543489539,  2283348234,  2453955000,  3065679477,  3284122691, 
-  3072426331,  3190237890,  4156797801,  2416803825,  1105892503,   812446840, 
-  3798051210,  2851441897,   347850759,  3907217824,   500162562,  2315310560, 
-  3642001655,  1295829848,  2650456336,  3757694892,   159108577,   181274963, 
-   412149497,  1962621865,   417065093,   714380210,  2873496255,  1523251786, 
-  1720680603,   783860933,  1388540912,  1603176227,   123257763,  2314963029, 
-   198292679,   627710510,  1580975246,   282185200,  3889552966,  3976566038, 
-   215697159,   599971029,  2898480301,  1091824877,  3871814881,  3196339115, 
-  2427348882,  2045211748,  2643665609,   707440361,   712653168,  2467948487, 
-  3963019114,  3675864433,   332500108,  2992389392,  2022490994,  2565880678, 
-  4121822909,  1761967180,  3220915475,  2938462788,   583404044,  1926288658, 
-  3251364016,  1956058616,  1545667225,   533014457,  4282049588,   652804944, 
-   736107837,  3886188884,  1085864615,  3554853389,  3276152547,   648498949, 
-  2151670663,  3136066712,  2002499518,  2584499724,   337512962,   495037244, 
-  3119441617,  3546251097,  3840713438,  3246705209,  2623268627,  1986900193, 
-  1142654957,   599968310,  2000052440,   942845610,    84046174,  3700643020, 
-  2614280391,  3359658516,  2274433751,  1047236411,  1693122275,  2633602367, 
-  2533106436,  3793995078,  1906208615,  4153749422,  2725636496,   421124011, 
-  4016391721,   502207052,   789804352,   209039475,  1405709417,  1227278037, 
-  4212397029,  1092654253,  2374097654,  2780048596,  2603504105,  3804128299, 
-  2396299988,  1796543199,  1985897550,  2634913075,  1895640293,  3397324865, 
-  1061753733,  3475621289,  2251879552,  2251232760,  3374268932,   289175024, 
-  2986521844,  1557165625,  3068437017,  2626514292,  3262923328,  1753204127, 
-  3130834338,  3482292315,   268803867,  2250091271,  2287756662,  3627856405, 
-  4294610028,   294533908,   486250968,    60908860,   847199256,  4196066167, 
-   177468683,  2000584439,  1220348717,   633864101,  4139429657,  2491249034, 
-  1622257437,  1359120316,  2406684439,   787782254,  1003865702,   595168100, 
-  1116175589,  2752218963,   683367566,   400251364,  4158024610,  1124849407, 
-   277031009,  3705140627,   723563955,  1296817519,   159227536,  3498327868, 
-  3858896541,   942026518,  1474934007,   131122561,  1677764963,  3370536030, 
-   959968378,  2217112483,   441253234,   370285933,  3615387397,  2708328335, 
-  3951256791,  2866405829,  1758966724,  1852315395,  1008255070,  2510962819, 
-  3770405717,   524847495,   433185835,  1654079652,  2016566264,  1174055427, 
-  3941912661,  1457432156,    10653736,  3971660462,  1460531074,  3178215539, 
-  3090200474,  1104476844,   832941544,  1621994803,  3458124763,   990758585, 
-  2277728001,    33091200,  1481904505,  3137221901,  3740437743,  4284906939, 
-   113787939,  1580805269,  3463103399,  1682957922,   797036640,  3531882113, 
-  1180352289,  3322610694,   343319974,    97764708,  2226123791,  1225352129, 
-  3603556866,  2796047824,   209269683,  2938233502,  2472009263,  2896137890, 
-   709388797,  1240073720,   776542125,  1287922618,    68843737,  2324921282, 
-  4038758401,     5337550,  2810814129,  1007877741,  2994535097,  3952727662, 
-  2034925345,  2998516183,  3178074574,   206658286,  2432555809,  1576295246, 
-  1694572867,  3634115955,  2714454708,  2598759600,  1299166159,   140690154, 
-  3024284183,  2045981587,  2247497802,   936767148,   949137374,   276314512, 
-  2036677803,  1821083052,  1221845585,  2122297619,    90243290,  1032286340, 
-  1043441015,  4101625461,   352729724,  3476203603,  2433346122,  2910044624, 
-  3764750643,  3159090382,  1821119682,   187555493,  3363309050,   293583812, 
-  1343252124,  1890556127,   161258394,   188664311,  4220703023,  2772833032, 
-   790685376,  1140020580,   680789579,  2523611422,   643029730,  3059807892, 
-    90261459,  2510251686,  3434123649,   719308235,   690016994,   483858877, 
-  2574237688,  2797895644,  3080674458,  3330636964,  2596489355,  2950134490, 
-  4078710059,  4189634999,  3716368706,  2664434790,  2656139672,   630417139, 
-  3572973974,  1964879383,   167970694,  3158780945,  1010668751,  3722359240, 
-   838808289,  2636494817,  3468067455,  3922680322,  1079869449,  3800716951, 
-   362481617,   216560365,  1660790248,    63587620,   998025835,  2379786239, 
-   531315024,    84165232,  2043125827,  3791305852,  2878741192,  2931514695, 
-  2030945396,  4001815888,   891566519,  2540168995,  2349744285,  1018131471, 
-  1547767762,  1118280728,  3201643092,  4095092018,  3281039501,  1683183307, 
-  4092761235,  2354771654,   733040258,  2343334540,  3972365654,  3505997515, 
-  2906834205,   375115484,   796878917,   376634649,   104679014,  3823310154, 
-   460435804,  3834000904,  1381083062,  3694329902,  2745823766,  1752959333, 
-  3094538979,  3414261237,  1846536204,  2023091172,  1357324027,   566819056, 
-  3649430580,   904815396,  4039235453,  3862119451,  3066260707,  3380457987, 
-   378617445,  2214659179,  1743805421,  1924624399,  3709602817,   830735202, 
-  3122622648,  3100075979,  2153217460,  2619815034,   441435691,  1358185339, 
-   333329737,   702079789,  3025701020,  4156137746,   477912752,  2173573315, 
-  1216487379,   231515448,   243429041,  3493098863,  1524856640,  2117990606, 
-  3984177029,  4119783294,  3718502640,   656477134,  2856267033,  1420370978, 
-  2381380582,  3098294411,   882028914,   118660883,   903025721,  2766118850, 
-  3768871321,  2727202449,  1405471582,  2821588529,  3184893909,  3289075374, 
-  2127945694,   356135867,  3756710844,  3468808274,  2971866131,  1793302517, 
-  1908409658,  3491910954,  2622107622,  1503039550,  2752487130,  3291596743, 
-  1202700426,  2478286230,  2306361430,  2645169019,   179236527,  3984739604, 
-   971930858,  2126320670,  2440340310,  3283303907,   744901573,  2645141901, 
-  2953751754,  2245379264,  1921431403,  1002096739,  3101053111,   891170509, 
-  1598238867,   823649529,  2387968706,   454602878,  4178810809,   319312119, 
-  2225777100,  2216178054,  3965964619,   516156567,  1606592025,  2282640996, 
-   675551326,  4137095117,  2668699810,  3328401372,  1672626919,  2446146020, 
-  3990078828,  3533408732,  1986747907,   346502253,  1159677215,  1840118614, 
-  3619415002,  2300097174,  4165001624,  2989854630,  1511740430,    14741485, 
-   841724698,   170783938,  1112518816,  2634290756,   393704701,  1443154515, 
-  3506899602,   424062148,  2994016300,  1241270006,  3346806714,  3780229635, 
-   327165974,  2829417499,   373287285,  2308285679,  4250452953,  3435504991, 
-   123233600,  1932032003,  4163072044,   170885611,  1385128182,  4083243103, 
-  1491193618,  2133695780,  2663125709,  4117549555,  2872875498,  3848812479, 
-  3174267874,  1543737090,   998655572,  3528312390,  2119904709,  1067965016, 
-  2392916032,  1610098697,  2035303549,  1444485222,  2272972169,   589138887, 
-  3998897338,   564375585,   620903210,   903172170,  3474015384,  1850881497, 
-  3127916710,  2247728498,  1982296457,  2924553363,  1486013547,  3766611478, 
-  2165130725,  3553855384,  3510719973,   452470158,  2568510408,   358290575, 
-  3061334657,  2907175682,  3304511651,  1660227513,  1431184587,  3236836954, 
-  3004946059,   848784055,   424303335,   271597693,  2466147947,  1677470445, 
-  1963748056,  2462063878,  2099230138,  1694314904,  3800255665,  1301737672, 
-   868626732,  1729450093,  4262860674,  1799295335,  3702376548,  2103137733, 
-  1211893786,  1664407012,   393744319,  1787034038,  2107225277,  3524439505, 
-   923734884,  2405391541,   833489103,  2801009936,  1118094572,  3445149167, 
-  1539436702,    46993392,  3110352957,  1038314236,  1875563781,  4266134992, 
-  2371896850,  2316407005,   801003612,  3350121498,  1512091558,  2233792338, 
-  2187482004,  1456234759,   553730171,    30618690,  2768388099,   969002001, 
-  2396984636,   784715092,   976281347,  2392786950,  2675301573,  2398430130, 
-  2616736969,  1754281644,  1219719140,  3583056908,  4111455152,   849693233, 
-  2000823228,   869963013,  4198695050,  2926264280,  1790117483,  3901268863, 
-  1676531604,  1910810646,  1721758373,  1369964078,  3552522254,   917609420, 
-  2551252699,  2309122195,   486854588,  2509469194,  3250127459,  2136599783, 
-  2944766570,  4156764986,  1484429983,  4250082200,  3143766519,  1068380570, 
-  3972910300,  3135051834,  2990321265,  1847578030,  1617812814,  2451851838, 
-   126189104,   126956555,  2621273874,   441146352,   881843239,  1044303428, 
-  3936510073,  4209231658,  3738634152,   743878687,  3891675031,  2676068856, 
-  2556201367,  3512936223,  2290111552,  1314704834,  3638327734,  3548701699, 
-   412729949,  3148568249,  3744883795,  3162114456,  3900380023,  4074386195, 
-  2019750928,  2088375114,  3825355908,   602420644,   914959501,  3213893899, 
-  2406244383,   982813902,  4288452727,   711376163,  4177011783,  4043924933, 
-  1913899141,  1248951069,   508155543,  4135660779,  3414145890,   428496049, 
-  1224412787,  3901568474,  2312826321,  3793036126,  1476254500,  1845175036, 
-  3938895915,  3692120966,  3893744070,  1055132429,  1690139573,  2592330198, 
-  2432085801,  2188642000,  4029279768,   556940242,  1428845634,  2797759400, 
-  1029969693,  2306971623,  2509594985,  1437002816,  2083846162,  4269405004, 
-  2446100175,  3847694066,  3995932040,  1929529612,  2631879961,   256413852, 
-  3631952164,  4023299619,   171545721,  3616020041,   806510842,  2620517029, 
-  1115508396,  4157222236,  3880708130,  3121708428,  1784954776,  3198889253, 
-  3254574259,  4061692490,  3780296385,  3296194018,  1372649747,  2251581072, 
-   684325407,   854816584,  3552690741,  2256889342,  2332745201,  1143098475, 
-  2498602580,   109761647,  2242699505,  3822009648,  2436565607,  3010073160, 
-  2673826643,  1833616562,  1627062143,  4154935879,  1775625763,  3908200582, 
-   572281333,  4051485451,  2956597248,  3986411180,   480259777,  2902474846, 
-  1823223642,  4282048695,  1974640539,  4123183012,  3682158360,  1180844425, 
-  2297039398,   497190488,    44881551,  3658501928,  2026958750,  2530927921, 
-  3787248069,  3227213293,   242524179,  3195259885,  1707173602,  4148466921, 
-  3871046216,  2726459410,   794938128,  1259386245,   566527997,  3740131939, 
-  2558071633,  1082396661,  1671034324,  3720262987,  4129515898,   855484277, 
-  3753961151,  2366874100,  2091196750,  1738819343,  1638348837,  3880981592, 
-  1009421487,  1804643897,   783547462,  2233030642,   705173410,  2132457865, 
-  4019208734,  1679401262,  2610511654,   244268356,  2372314789,  4088838693, 
-  1412503124,  4195316213,  3490893607,  2949967830,  1950921273,  2074433020, 
-  2344607933,  4198514108,   399986608,  2170623881,  1956564968,   230587723, 
-  2945302183,  2695778116,  3205969078,  2559484362,  2407708501,  3588573958, 
-  1468287370,  4263050262,   313371944,  4211199459,  3614723479,  3317678253, 
-   126437466,  3303083563,  1114904186,   390340649,  1989869939,  1863738346, 
-  3489078511,  1167763517,  2215848624,  3370820135,   183848776,  1644694665, 
-   642587728,  2218831075,   750890816,  1329300499,  3377385485,  1547616324, 
-  4132693130,  2430343333,   188945359,  1546841016,  3753413813,  1623424344, 
-   721050934,  1864069386,  2139729638,  1269080020,   901921354,  3038636452, 
-  2820948323,  2397667965,  2651998460,  2761362078,  2319177945,   468157630, 
-   833391701,  3108207551,   151223296,   938672760,  4279326788,  3013650194, 
-    22399049,   377088984,  4125073090,   305519357,  1415818029,   500239380, 
-  4273155969,  4252289762,  3099257727,  2086540033,    12317936,  2805646342, 
-  1521536009,  2292482996,  3417248433,  3797657509,  2773244875,   600374738, 
-   278510167,  1213741823,  2011648371,  1776047674,  2873056711,   537266311, 
-  3824651074,   999375744,  4089761034,  1515367787,  1509331181,  1154766903, 
-  4045327793,  2813660489,  3118405796,  1025292158,  3236289088,  4086416017, 
-  1229964209,  1390395918,  2864426761,   544611538,  2564106010,  1253311864, 
-  3157930369,   137058990,   668167194,  2717821741,  3280998315,  3659499388, 
-  3608203873,  3254797088,  2233623578,   437281387,  1665742042,  3501965425, 
-  3961813959,  2769233605,  3238673224,   965134247,  3071124828,  2826722215, 
-  1845113433,  4167230523,  2740815371,  1372226287,  2091152014,  2609339964, 
-  3082164244,  4153039109,   159265882,  1428185591,  1665281308,  3086363083, 
-  1911091348,   199289891,  2821513463,  3532935386,  1704821730,  4218117628, 
-  1332896706,  2638945220,  1381930000,  1470773744,  2392747267,  3957076044, 
-   619558487,  4122846817,  2222291842,   681840093,  3969317043,  1787247076, 
-  3141255221,  3027760618,  1771160194,  3207628591,  2973320896,  2267801378, 
-  3648444149,  3158887592,   626214954,     5301921,  3582493109,   247295182, 
-  1531712558,  2232151246,  1292068779,  3229849718,  2390375945,  2002957746, 
-  2272159855,  3903721186,  3321430257,  1029142139,  4097341224,  1974949256, 
-  1037147772,  1549677034,  2218573283,  3961977087,  1952871803,   666290790, 
-  3534355544,  2448051590,  1198677153,  2437914653,  2286020902,  2586687644, 
-   817016152,  3349748797,   481182971,  3748135797,  2144133117,  1670869283, 
-  3505611630,  2525333930,  4175784245,  3237715468,  1017783576,  3746250324, 
-  2255219652,   729548109,  3890178199,   556555303,  2487287465,  3144791970, 
-  4006205580,   365194062,    74439164,  2298887082,   123447004,  1767506150, 
-  3023471409,   165367127,   624227456,  2227656914,  3973619100,  4175575901, 
-  2239605376,  1856425506,   762484796,   427626012,    80994139,  1269783416, 
-  1961195756,   606485695,  1525601798,  3019948837,  4055138783,  2626050829, 
-  1873373283,  2165672244,  3556888364,  3478412252,   142791345,   315997942, 
-   639405333,   190568718,  4123946479,  3564028533,  1172340535,  2115762845, 
-  2200996218,  2025841946,  1185882271,  3187112925,  4011474213,  3635819704, 
-  4001071387,  1935425346,  2569502716,  2843613632,  1391350969,  3143604249, 
-  3451916410,  1699285848,  3287651299,  3056721863,  3862299633,   840823727, 
-  3918908825,  2865401817,  4224669765,  2227636504,  3122840154,  3311614841, 
-  1584971742,  2338847481,  1062112504,  3038469677,  2783368799,  2821614566, 
-   915648651,  4064412017,  3745609914,  3875058322,   526375273,  3742456425, 
-   974237011,  2114590450,  1980452433,  3135363772,  1890130616,  2917742735, 
-  2784419024,   566483517,   446500027,  3291575059,  3400559469,  1258330948, 
-  1145789816,  3478580075,  3558230146,   955707550,   976686175,  1899026874, 
-  2794340471,  1353541517,  2670512824,  2696182266,   459296047,  2009367362, 
-  4220739192,   158679804,  2585996419,  4147331996,  2021872442,  2207448418, 
-  1391605994,   533500865,  1158323658,  2302684325,  1744424983,  1237324397, 
-  2947646611,  3631908135,  3035170354,  1493803103,   551830022,  2324515503, 
-  1425279878,  3094141581,  4233410682,  2770600932,  1888648231,  2993856661, 
-  3960125598,  1749116667,  3132251047,  2184711796,  1759113507,  4264337669, 
-  2279305267,  1331230320,  1650918284,  3353326537,  1116077591,  3452768724, 
-  3403948572,  3493199050,   393333101,   739816144,  1873788865,   630083588, 
-  1899072597,  2352316959,  4283782701,  1776813077,  3753039717,   513808792, 
-  2668539126,  3119935656,  3735918135,  3593997882,  2707837448,  2591424257, 
-  2860896726,  3532266173,  4082500102,  1877799941,  1198174803,  4239067565, 
-  4249774804,  1847454723,  3716466906,  1592092906,  4132691728,  1422840512, 
-  2024424896,  3497885914,  3594234281,  1876407793,  1023631912,   690972001, 
-  2628869168,  2521939777,  3308808593,  2071598336,    36012690,  2823287931, 
-   901364070,  3441956976,   731191920,  3493910825,    72079446,  1829016087, 
-   865781048,    67413324,  3895688425,  2074646037,  1283334776,  3622863275, 
-  2588826833,  3115921758,  3032333001,  3294662064,   621873836,  3520785999, 
-  3633840683,  2821667179,  4201535464,   544750386,   763846125,  3147784099, 
-  2568730426,   272255974,  1536703914,  4213900953,  2511471219,  1834961949, 
-  2591783935,  4041371770,  2498492748,  2189266772,  3611775448,  3332999714, 
-  3527664745,  4153197505,  3396137552,  2615847224,  2686677288,  1374433550, 
-  1508320196,    67206315,  1872205446,  2764618119,  1036429444,  2093595873, 
-  3282279117,   455876302,  1337406284,   926314195,    64055027,  3086663019, 
-  3118976937,  2082902463,  1668084408,  1005968577,  2267005245,  1531598392, 
-  1255473726,  4281431922,   233309469,  4131403189,  1739241452,  1286589381, 
-  1489726666,  3628498601,  1594723285,  1066470982,   608965061,  4246720512, 
-   554923486,   659769429,  3991853900,  2979031082,   528434775,   596654148, 
-  1450509342,  2422538173,  1923435622,  1413518805,   612929112,  3793871943, 
-  1477895085,  3256328210,  4260902322,  2600252108,  3011650980,  4035814657, 
-  1218489490,  1252774258,  2001135291,  2231485081,   977084876,   116832482, 
-  3354231130,  3503005693,  2005041974,  1695546886,  3332962846,   249655455, 
-    98376219,  2976255347,  1923005424,   929659431,  3684144449,  2551813504, 
-   534634478,  3413823570,  1060028378,  3344671248,  1169032509,  1968440013, 
-  1086058483,  3677591644,  4230828339,  3991204636,  2565046939,  1121990616, 
-  1988984840,  2694813538,   563870773,   446361601,  2313314997,  3608438687, 
-  3608747404,  3740562914,  3713515171,  3477872131,  4195637940,  3855923094, 
-   944439498,  2129658822,   118880019,   928218033,  1061904348,  2908493842, 
-  1391897860,  1745577611,  4189036924,  2846991787,  3139091632,   273084646, 
-  4145293382,  2079888761,  1213913571,    71321837,  2949143426,  2999374654, 
-   611951022,  3869491822,  3059116919,  1510370959,  2614470715,  3600773850, 
-  1348614658,  1377744583,  4094559123,  4213443599,   486163007,   658794486, 
-   164672800,  1566687969,  3317385486,   513415556,  1123975993,    74741892, 
-  1885897845,  3167161187,  1095125566,  3075008189,  2552775793,   501622656, 
-  2192215177,  1803123388,  3729174460,    95549266,  3575184185,  2111824727, 
-  3545231358,   725219877,  3456424923,   505520382,  3575166617,  2469569074, 
-  1909093433,  2749548304,  3572748339,  2187021936,  2121791728,  2529219608, 
-  2472969576,  2656042476,  4077244754,  1477197427,   811939748,  4070764834, 
-  2507883660,  3531197387,  3802752812,  3472929988,  2008294733,  2950217433, 
-  2782824435,  3751776181,   603451456,  4215235404,  1929806970,  3255551491, 
-  1970957054,  1525934853,  1763952735,  2705608123,   929331348,   381963936, 
-   879054117,  1099686711,  2222733936,   657579747,  1500567515,  2627120283, 
-  1241401998,  3620084477,  2755821189,  3111373594,   668929241,  1432921702, 
-  1375789944,  3955051944,  2080526931,   840231845,  2290341046,  3070105649, 
-  3722351825,  1929662807,  4232985292,  1444371608,  1600071636,  2508625963, 
-  1131741483,  3808130126,  1722720473,  1542321723,  2275848137,  1151832493, 
-  2602589691,  2616969236,  1323784118,   287071602,  2282670760,  3735166603, 
-    51649279,  3985770681,  2400438704,   937559738,  2034311756,  3895846242, 
-   695729986,  1977585969,   119070462,  3004655729,    38336158,  3488681059, 
-   344352298,  3716042813,  2954206999,  2562050994,  1830158398,  1037243718, 
-  3050990745,  1605478237,  3839030444,  2371979685,   608363113,  2560112825, 
-   832983129,   865924509,  2541312012,  1173493945,  1683091697,  4294843572, 
-  4168235617,  1536733374,  1011522695,    69362765,   413976049,  1574215232, 
-  3705459363,   820731079,  2480445874,   240310638,  1937134366,  3691290989, 
-  2041184946,  1071472201,  4086235213,  1682227832,  1234367863,  2684844994, 
-  2354280963,  1195230149,  1798012031,  2882109379,  3135758217,  1069237874, 
-  3729230080,  1622877443,   427676040,  2267587281,  2076550859,   369569641, 
-  1836060328,  2879430824,  3683520773,    54241546,  3076449176,   797392397, 
-  3379892429,   843105023,  2836428348,   294974288,  1860515717,  1819224916, 
-  3583727302,  2533803045,  4037035333,  3209397642,  3219709660,  1305532149, 
-   102144752,  1761084242,  1865097840,   843830444,  1041589725,  2238242973, 
-   226738987,   802802925,  1597788968,    19401302,  1234488511,     7471180, 
-  4002743867,  2542615001,  2213203507,  4216283834,   106733382,   976278100, 
-  2591918064,   362739846,  3304946576,  2681894260,   905972751,  1226018694, 
-  2972976560,  3762483269,  4061749970,  2743945424,  2188862571,   501975924, 
-  1741867357,  4028874568,  1904316881,    88141526,  3362769901,  1074946124, 
-   225002986,  3513211238,  1177630189,  1021580686,  1733417087,  2812968330, 
-  2512885019,  1809001715,  1751891285,  1064061397,  1991294590,  4120312202, 
-  1417724991,  2051563058,  2579713895,  1093595892,   144909719,   915339510, 
-   588530587,  4181488669,  3108143810,  2947681961,  1103813683,  3862082962, 
-  1280401002,  1212522152,  3859394198,  2201705479,  1911492689,  1680787824, 
-  1938603463,   923839944,  1986921902,  2406911525,  3885551658,  1204649346, 
-   610722460,  3505579802,   261404167,  1819289741,   978115166,  3943384785, 
-  3256171927,   400232881,  4112333094,   912827834,   868808501,  3651764396, 
-  2079094404,  2305942878,  1154263886,  1927802617,  2403632931,  2390223265, 
-  1677443232,  4153918365,  3926163687,  1605019800,   373673478,  3976186517, 
-  3648086390,  3666361145,    90026629,   228179855,  2318224762,  2557091519, 
-   279673195,  2040479488,  3299058937,  2736772884,  3600188932,  1749216885, 
-  1652961370,  3509175179,  2409968752,  2633199823,  3404785600,  2111327580, 
-  1268733400,   809145947,  4194596314,  1738494818,   491311036,   527742216, 
-  1413297711,   610655733,  4101886733,  1673032066,  1708630251,  1973968708, 
-  1890047617,  4132705326,   933134821,  2085187812,  2747977264,  2954146885, 
-  1547041437,   556704529,  4284826860,  1417202590,  4002238532,   688962409, 
-  4247922504,   827106433,  2489546868,  2325269706,  1673390132,  4073009169, 
-   528419566,  3235699549,  1913332096,   892334899,  1684601909,   644841916, 
-  3034270637,  3120706402,  4293154751,  2111055688,  1610985038,   873160578, 
-  3973401007,  4006510649,  2951868941,  2860841314,  1401134141,  1942224196, 
-  4181366546,  3736175195,   354640323,  2623921373,  3849683876,   674760179, 
-  3358074607,  1018057893,  2003158734,  2657815839,  3343546357,  4250338609, 
-   808601313,  3913098083,  3598635671,  1990630928,  3538206228,  3894244757, 
-  3022697131,  3316753751,  3328990810,  3411229947,  4131360556,   131760657, 
-  3693850278,  4278653038,   608110312,  2323502719,  1369673931,  3257351894, 
-  3038142322,   601078387,  2260783410,   762442104,  3633480118,  4099866048, 
-  1815527521,  2686437815,   860155357,  3428843245,  2088221557,  1695649556, 
-   900934230,  1522549383,  2582037817,   635752557,   899713266,  3295025492, 
-  2772633949,  2667568493,  4240595533,  1857701750,   758466917,   716190401, 
-  3056303486,   325353922,  1858156407,  2746920298,  3236302904,  2648744209, 
-  2655019703,  1339379040,  1671832630,  4114130880,  1201570866,  2325529239, 
-  3803408475,  1855172634,   721133804,  3135293318,  1084954015,  1949861505, 
-  2347662009,  1551678357,   568994755,  1235165081,  3818839073,  2723626512, 
-  1987363024,  1399174723,   376147205,  1483635310,  3637836664,   705264590, 
-  2748341519,  2561299314,  1995204557,  3424995168,  2444649937,  3259001693, 
-  2809188753,  2503920575,  2230014097,  2009443648,    97198668,  4149251344, 
-  2323724428,  2353507721,  1180844030,  3078910499,    52784281,  1651786970, 
-   393436631,  1530811664,  1468240372,  1670335572,  4195752492,  3473786297, 
-   504405409,  2179583544,   540433706,   669214680,  1610312627,  4023149242, 
-  4222146546,  4206218688,  2564004609,  2916109459,  1440499695,  2912199718, 
-  1623966925,  3892973197,  3259113108,  3839181053,  2257650392,  1036274098, 
-  2563205837,  1093347478,  3825500237,  3273975995,  3514569484,  2792258505, 
-    21786831,  1533415641,  2299197671,  1051173668,  1417056197,   581325457, 
-  2143401588,   871684975,  3775081601,   186264767,  4009063560,  3821977257, 
-  1621089141,   524916469,  1184735436,  1418884813,   451005801,   829525809, 
-  2354140856,  1947303645,    67155762,  2899671378,   225265925,   316953586, 
-  1354719052,  3092371578,   196737061,  4141035353,  3444039778,  1359598378, 
-   179142776,  1926037059,  1521094981,  3053512746,  1346239071,  3684015920, 
-  1437530903,  1728420910,  1723024895,  3128060179,   538359857,  3774436998, 
-  1659300713,  4035638175,  2950787144,  4132339092,  2657858264,  2566152288, 
-  3897136134,  4021490188,  1444133979,  2252494196,  4107575809,  3346132136, 
-  2842891356,  2451216076,   381593644,  1641295475,  3367507166,  1233257835, 
-  3423127298,  1518921466,  3748751854,  1036577390,  1630792566,  4258811767, 
-  2117870418,  2444171960,  2679029535,  3423513841,  4286662519,   150255225, 
-  1445623884,  2743807022,  1843679435,   665189958,   516801750,  2606342096, 
-  3739069333,   656041286,  3952971161,  2472414158,  4269695400,  1006664673, 
-  3636335300,  2877867165,  3738266116,  3697625049,  1341441241,  2966567623, 
-   614877380,  1547932175,  3866469054,  4252980330,  3787075158,   395286854, 
-  2202607753,  4120161834,  1202860917,   472981950,  2442222282,  1087770964, 
-  3719035585,   173705271,  2198691840,  2442396744,  3102961895,   296333396, 
-  2264116135,   414423313,   396256597,  1595965187,   697419695,  3831107243, 
-  2594463629,    47228524,  2701926889,  3868224657,   843532009,  3508600476, 
-  2663108507,   508572857,  1696946873,  1374426223,   289057817,  1283307848, 
-  4267168913,  3037415664,  1587859469,  2403912565,  3001286937,  2455294456, 
-  1328343807,  3374232375,  4205604393,   517209157,  1539457148,  3777180011, 
-  1595914054,   309513271,  2896597958,  4166995733,  1471078199,  1612564769, 
-  2343127395,  3723203549,  2223109273,  1064291756,  1990107960,  1167476480, 
-  2697840689,  3880420799,  2661580185,  2455572998,  1634899558,  4212290757, 
-  3266784657,  3854552991,  2173812756,  2770996532,  3097658273,  3504898481, 
-  2368636263,  2226516841,  3251717397,   900943078,   467239514,  2829851633, 
-  4195807496,  1003857795,  1015241932,  2649854043,  2403319169,  2775765564, 
-  2666595018,  1602344758,  2034530586,  2837502434,   988087406,  3550015242, 
-   474619834,   860560851,   776031352,  1981075001,   532166715,  2992371158, 
-  1095441881,   331407526,   476242116,   751762005,  3587116280,  3286000851, 
-  4270221942,  1052258092,  3869069592,  1741912349,   893024790,  1896601828, 
-  2253844005,   305729950,  1486848347,  4238135055,  4045164870,  3608759643, 
-   886169379,   186438358,  3301706757,  1327198687,   160240307,   364785190, 
-  3932031335,  2092229587,  3143546425,  3134142316,  1367631744,  3717095250, 
-  4094215155,  2720520315,     6968237,  1732662471,  2672919659,  2143056979, 
-   793481048,  2584537792,  2297563645,  2132889757,   810299344,  2006616237, 
-  1027913641,  1099835378,   348384782,  3814930094,  4160663026,  2977355357, 
-  2833482734,  3054783520,  1938847445,  2807432966,   843765875,   398376786, 
-  2691111733,  2514908290,  2952074391,   166718596,  2276402225,  1201068074, 
-  3870000590,  3188072132,  3297771247,  2013987972,   331381338,  3244031807, 
-   377689202,  1865971885,   228056400,  2471578827,  2520747419,  1869903370, 
-    50402290,  3897258641,  2788919357,  4047643971,  1080071114,  3810808803, 
-  1545230483,  2335745932,  2818644443,  1897140124,   873385784,  1203900640, 
-  1903342832,  1297373800,   483096585,  2163529767,   961336338,   411691237, 
-  2290833442,   471785968,   326051171,  2463425140,  1831740308,  1515267147, 
-  3602566891,  4188658489,  2999933689,  2275047493,   936335922,  1896612078, 
-  2074632516,  3965887507,   878958281,  1453816398,  2089487657,   875250189, 
-  1849677385,  1373841744,  3700268910,   994230016,  3955949809,   903426397, 
-   403313532,  1038426993,  4078898080,   847353334,  1923906120,  3108649084, 
-  1327331589,  3574081090,  3407432616,  3400731899,  1642689593,  2117459830, 
-  2237695293,  3808814895,  1204908459,  2303956005,  3756808828,  1280535549, 
-   341395447,  3661935820,  3002545186,  1883223249,  1516308800,   826246620, 
-  1762670157,     2003994,  1973860782,   435093721,  1136103635,  3374947876, 
-  2780114412,  3061684303,  3118388560,  1425833373,  2004573823,  1956192659, 
-  3874954441,  3651322052,  1976043320,  1126022446,  3077503215,  3950768675, 
-  2972725229,  3505438923,  1814050395,  2277599372,  1690063913,  2956736377, 
-   617440665,  2217182958,  3120468280,  3952053492,  1170633241,  2174490784, 
-  3148211969,   456476312,   834818738,   869312836,  4291088967,  1826482994, 
-  1561371206,  3817119472,   859517057,  2803997753,  2564360878,  1299180320, 
-  2644642473,    52597298,  1714522024,  4029609657,  1715888731,  1369329233, 
-  3141704481,   381021762,   185357647,  3983183302,   384776396,   571150398, 
-  3021381829,  2061703218,  3060604365,  2917966146,  3112919811,  3729571351, 
-   217398541,  2029156709,   811007343,  3926389686,  2445621038,  4114728341, 
-  1566964112,   634208751,   293377579,  3802038914,  2080709608,  1865756301, 
-  2290630792,  3496677667,  3102739668,  3192223604,  2386394058,    84214436, 
-  2777496931,  2687883469,  2666979986,  3483111599,   876326135,  3853900117, 
-  2737222312,  1524567851,  2676775428,  2088112046,  3951345738,  2579070261, 
-  3703189924,  3350370266,   594977839,  3941798566,  2506426151,  3137467217, 
-  1371744477,  2376110174,  1810722477,  2948465483,  3122207353,  3242375820, 
-  3458369350,  1365751610,  1950454722,  2112776806,  1880897145,  2809013922, 
-  1946251745,  2011798320,   715056915,  3393712537,  1503838692,  4047170448, 
-   943053953,  1196989998,  1468982218,   937074255,  3990301197,  4210166476, 
-  2885676226,  3294854617,  2155919380,  1482205400,   475193588,  3271746868, 
-  3727713086,  1907512733,  3983107512,  1176469787,  2370811121,  1786352023, 
-  1207638319,   308426296,   677645560,  1515792344,  3689710360,    99693046, 
-  3731398520,  1865765587,  2061672043,   513558246,  2805633137,  2419447103, 
-  3168495159,  3705175673,  1814478260,  1302805160,  2872997778,  2900191057, 
-  1342146665,   371075743,  3334040015,  1325586193,  1566908956,  1788242343, 
-   528361855,  2362878687,  2592134216,  4167805621,  1662528810,  1795837971, 
-  2063393125,  2675864855,  1468036763,  3859647045,  3779577474,  2149696283, 
-  1611748845,  1915610307,  3449282163,  1334179112,  3452729552,  4209950364, 
-  3033662350,  1914021091,  2544764604,  1450105659,  3767045237,  1240253676, 
-  1633433992,  4005893070,   161492383,   926769266,  4234860883,  2998273984, 
-  3211523025,  4193229089,  3150198400,  1015804038,  2726144524,  3810470768, 
-  1536646161,  3946536913,   504322094,  3070674017,    56009720,  4072549961, 
-  1216157043,  3497167780,   262588087,  1837956670,    99733669,  1491120741, 
-  2414934836,   799208787,  2669027106,  1864742276,  3756939733,  1060468255, 
-  1979976355,  1159553389,  3885681305,  3464487405,  1167046054,  3161596940, 
-  1969586386,    75262489,  2181516417,  1259278248,  1831080782,  2938110597, 
-  3008974035,   235583904,  1077513776,  4051455641,   852816406,   750088129, 
-  3367548362,  3222495575,  2573335730,  3483352004,  3911635233,  4255039780, 
-  1570369127,   514546456,  3832204027,  2102586869,  1828561881,  1654757741, 
-   662040346,  4258204817,  2807926679,   314717363,  1916301331,  1572303242, 
-  1445703197,  4018910600,  4270723062,  3569636183,  1674573452,  2508320724, 
-  3960284809,  1234301837,  3478386572,  2264152081,  4053992388,  3617277677, 
-   844603266,  2774194116,   444464711,  2818255609,  3816323225,  2979675281, 
-  1419763667,  1067271645,  3428898692,  2145759340,  1244064418,  3850217517, 
-  3715877670,  2548400503,  1051840812,   680846031,  2405181794,   612183004, 
-  1168965775,  2855967674,  2760706952,   889310544,    25416391,  2802722251, 
-  1505321520,  1322097799,  1798388154,   726676408,    71242590,  3047730915, 
-  1666842412,  1784307243,  3427469585,  1805709796,  1648068230,  4157314811, 
-  3100431747,  3693822340,  1478639407,  1042986966,  1832594177,  2485693468, 
-   960776054,  3119050562,    62189452,    24964360,  3076024594,  2663955187, 
-  3991603054,  3394194842,  1584952174,  3787381581,  3000941069,  2718074540, 
-  2446138038,   545102319,  1107387256,  1233806850,  1449412721,  2592781873, 
-  1462599027,  1867805665,  2584935819,  1429179177,  2221884204,  1164458873, 
-  4126670829,  2830450436,  1064707297,  2854612906,  4120765082,  1687012762, 
-   279538830,   576179473,  1007960135,   904818365,   747308981,  1055216697, 
-  3049737360,   820947655,  3343505219,  1527383936,   148974913,  2133718172, 
-   267011951,  2950483988,  4096661933,  1083342426,  1567859394,  3991435686, 
-  3853419980,  1815573379,  3590771666,  2662825892,  2854585897,  2784410216, 
-  3959716621,  1875744601,  2528206234,  2710197191,  2414877109,   244798412, 
-  2135108911,  2722405744,  1749894460,  3114123315,   707650427,  4035782099, 
-   622978820,  2873454213,  1576081449,  2915109800,  4040523105,  2578295498, 
-  2748057482,   886090712,  1646549080,   386959316,   160776562,  1140012458, 
-   370897398,  3556271520,  4231139217,  2889634508,  1303509885,  3104906082, 
-  1446535576,  3656744165,  3967741634,  3843229197,  2297521734,  3136813346, 
-  1630549641,  1900550346,  3862933937,  1753497221,   334691291,  2993189417, 
-  1508377681,  3447636139,   306784769,  1677794001,  3906604620,   949271635, 
-  1330092666,  2642462828,   760821892,   684418260,  1960684947,   225743429, 
-  3648726985,  3769894131,  3906525873,  2440469706,  2767029117,  3274051983, 
-  1483977181,  3371784736,  2734865978,  1697817765,  2996406636,  1404094393, 
-  1587344912,  1372353101,  1348468612,  2732455732,  1818112818,  2835334711, 
-  2222327798,  2031834428,  1278349835,  1423825078,   711841731,  3514312387, 
-  2625753084,  3447542689,  3455133014,  2719633966,   415201266,  3378293338, 
-  1748699188,  1713957614,  1209880654,  2877950998,  2554200445,  3724812435, 
-  2317285646,  1382330205,  3879470408,  2968332434,   720914859,  2771772446, 
-  1998036908,  2583092763,   468839760,  1411283792,  1872204992,  3419633013, 
-   424925945,  3441575406,  1610631442,   445995969,    39751435,  1053338806, 
-  2886057326,  1771945166,  1266405220,  1579631385,  2307708292,  3535843238, 
-  2850349891,  2236323837,  3817495476,    82955815,  4272982978,  3253131515, 
-  1923160950,  3066201969,   941729126,  3298340688,  4244911177,  1396659658, 
-  1650558858,   437676737,  3139640330,  1798694176,  1843855845,   658540248, 
-  1738587875,  1128795734,  4225445768,  2690981125,  2198451187,  2769939798, 
-  3322544834,  3393894720,  2579719372,  4205439783,  2143015091,  1215065477, 
-  4031800757,   658528306,  4233321702,   391988391,  2179624797,   450710755, 
-   838111321,  3855524062,   406595776,   104995995,  3419682835,  2524465056, 
-  3136219567,  2175050735,  3942632366,  1135987131,   976785130,  2615121321, 
-  2622569567,  3404659020,  4230196233,  3292588558,  3393599567,   809645586, 
-   638592950,  2435172263,  1290014806,  3828503965,   735692622,  2339776858, 
-   730073515,  3041825946,  1049889288,  2306133884,  2193880910,  2004454329, 
-  1032756130,  4075781699,  4181504505,  2501370533,   362063083,  2277478863, 
-   559754750,   714206277,   538845554,  3952397145,   852497123,   303365418, 
-  2061297359,  1197312459,  1930416343,  1348212714,  2883803146,  1584093399, 
-  4138073029,  2319308910,  2858170647,  3051623272,  2660281327,  4092466294, 
-   900241110,   965396207,  3057938876,  3942454480,  3557744414,   517255428, 
-  4109826319,  1857463412,  3522942520,  1916306177,  2157007146,   875751650, 
-  3210877510,   537065136,  3653737327,  2695003859,   745885372,  3332024039, 
-   777704206,  2334889581,    42344249,   394372522,  2320432122,  1680685068, 
-  1743694124,  3192631089,     4881752,  2023195826,  1790913282,  3563905476, 
-  3099435444,  2518230556,  3153511021,  3342275362,  4052261653,  1883991455, 
-  1218252409,  3923382959,    16092442,  3810800307,  1532855837,   607697081, 
-  3217931286,  1948201518,  1875415108,  1058186044,  3947731640,  1338960199, 
-  3663490245,  4241986231,  1658821303,  1194944138,  3993917884,  1650151860, 
-  1419869832,   576927475,   389730821,   103574994,  2747347855,  3547803865, 
-  1689493015,  4083944432,  4242206262,  4001612600,  4095715611,  3044414013, 
-   867425043,  1220485565,  3263580243,  3056365365,  1528078197,  1748954665, 
-  3128044615,  4000457326,  3605643508,  3194383586,  3282155981,   838605721, 
-  1217874536,  1490835618,   932584116,  2335730971,   877819679,  3697368637, 
-  4107144784,  2751665035,   809897484,  2889880926,  3136529910,  1925023062, 
-  3149350774,  2774184866,  2534573618,   304557663,   293387791,  3540557071, 
-  3876142121,  1668899453,   316171158,  1082814563,  3068210482,  2229804403, 
-  1283770547,   757854720,  4121105008,  1491705840,  3423259749,  3443177864, 
-  2884125348,   374096601,  1992850607,  3146634556,   457646576,  1606496118, 
-  1812088820,  4044696759,  2138063950,  1888299930,  1352963744,  1204341101, 
-  1323762162,   529192384,   957182048,   512167699,  3198063649,   754039664, 
-  1186705533,  3171903302,  3329182294,  1037538670,  3258476634,   101095022, 
-  4289585869,  1067139881,  2483805760,  1109225055,   668258093,  3024256847, 
-  1735691120,  3590020304,  3655285656,   323537988,  2894263066,  3569133981, 
-  3547991679,  3975513923,  2105964828,  4216319219,   927175539,  1704660153, 
-   754787423,   489211261,  3046125281,   162462039,  4107728990,  3473730707, 
-  2162716900,  2467620938,  1351403716,  2598272592,  1949001207,  1952948936, 
-   107370185,  1470574573,  3349846948,  3330295423,  2117338215,  2827950937, 
-   527313149,    87430724,   590338345,  1566056685,   495947553,  3117137323, 
-  1816311180,  1221930586,  4132983602,  3322845950,  3902127730,    18786278, 
-   408523343,  2038123886,  1465536435,   437752102,  1488813337,  1412029420, 
-  1883652671,   734935024,  2012570632,  4074494525,  3501504861,   862462592, 
-  1313925929,  3219669945,  1551777868,  3484843358,  1232698609,  2761116000, 
-  1122619447,   632621231,  3464675897,  2058312920,  3599996141,  3554828494, 
-  3699250309,  2428246155,   313807137,  1956242828,   427773222,  1232881208, 
-  1063506127,  2339833183,  4212847393,  4031441502,  1159408381,  3018293743, 
-  4043045695,  1531897913,   809016056,  2046846125,  1460352280,  3012757111, 
-  2459802821,  1155292860,  4032812613,  1766321374,  3850308046,  1924275791, 
-  3743995484,  2216558623,  4085643773,  2273880374,  1661928909,  2144473921, 
-  1562563117,    20064305,  1869202651,  3404980353,  4201181161,  3579716911, 
-   659598420,   749960807,   213466626,  2178386943,  3732775618,  1619714832, 
-  3901063196,   620761888,   110154724,  1201507349,  1752682925,   934559230, 
-  1282992524,  2297885890,  3511131224,  2035806515,  1285525040,   707142588, 
-  4151425291,  2199093426,   596538397,  4024041694,   736669649,  2333629915, 
-    17132986,  4255632116,  1307248497,  3041345166,  1968285423,  3628866008, 
-  2043463208,   685059274,   797918947,  2752001130,  3388586534,  2552828174, 
-  1345133926,  3482766135,  3653749512,  3524613026,   290906762,  3447115139, 
-   996227435,   479894230,  1768244139,  3731956269,   168255409,  3291190265, 
-   866704426,  2307652432,   132207329,    31041169,   146527816,  1677838930, 
-  1694306924,  1823098281,  3297944348,  4016937912,  2304249277,  3370706579, 
-   445465378,  4118074293,  1010674007,  3846730217,   522811391,  2079666110, 
-  2210875306,  3979047557,  3943871229,  4057482895,   460818337,  1693331841, 
-   445884244,   115137225,  1440738171,  1694802903,   840148440,  3400685765, 
-  1431071519,  2827005686,   694073776,  2375521531,  3687418253,  1905658802, 
-  2698006454,  4134313441,  4019074854,  2657897671,  4227063137,  3211587920, 
-  3664077866,  3575266690,  1910661807,  1030805436,   885071408,  2622069669, 
-  3811204348,  2182483996,  3282093155,   293058701,  4107681607,  1483618227, 
-  2877025698,  2652015030,  3391188136,  2888081874,  3556745055,   592741816, 
-  1168886914,   477556882,  3387817883,   945664893,  3065016383,  1446723396, 
-  2275131718,   653973374,   670582258,  3337677258,  3795075127,   290474336, 
-  2868185236,  1711049354,  1928928261,  3934117683,  3232374300,  1550735369, 
-  2542547822,  3235303511,  4174704625,  2941151804,  2467730847,   217636064, 
-  2638251907,  1458697587,  2204160609,  3474269253,    90203389,  1003879353, 
-   586195437,   708671537,  3252590876,     4039653,  3251145177,  3696945010, 
-  3996324520,   324038821,  3252822405,  1416718180,  1662429926,  2633709301, 
-  4182305957,   805494140,  1092587463,  2491477825,   648019871,   420134175, 
-  3789789308,   773586041,  1491699887,  3611237719,  3461722437,  1109448438, 
-  4280053352,  1699586315,  2695652204,  2379456061,  3331518730,   494127903, 
-  3064908579,   393364284,  3720882674,  2048716159,  2442711903,   757441828, 
-  3199401824,   840488917,    17906466,  2587223927,  1517777923,  2226160145, 
-  4284079407,    26932663,  1244108996,  3526712095,  1524593284,  3689423655, 
-  4059101713,  2167247245,  4017071343,   824772568,   982806098,   558089829, 
-  2941103168,   666003646,    32381310,  4118517092,  1489381967,  3741680798, 
-    82297678,  1716614615,   345789440,  2699258093,  3846118241,  3270168203, 
-  1155630502,   848623258,   229532023,   861339454,  1045875814,  3080995996, 
-  2641521351,  1865877461,  2120795161,  3970108339,  1618934100,  3823913118, 
-  1594682146,  3222946110,  4213084667,  2926926615,  3544427771,  2285078144, 
-  1797543876,  3762368565,  2825847876,  2257772639,  2079425707,  3535991869, 
-  1136851025,  1782424485,  2630588697,   918546242,  2085696243,   560799289, 
-  2088060056,  2377658616,  1291946364,  4126149256,  3364323439,   452408151, 
-  2296271760,  3498504118,  3188946720,  1566693966,  2337459304,  1313615160, 
-  3385063221,  2275512274,   720000552,  3598093225,  2287524435,  1195730858, 
-  4179228655,   837997591,   731815840,  2331626681,  1836767316,  3583944841, 
-  1914792715,  3935875938,  2407906247,   272810559,   457228779,   405588361, 
-   140559980,   834242840,  1642322531,  3558147814,   894841624,  1016523570, 
-  4249822593,   657141609,  2791107607,  1201266774,  3053063212,  3681024970, 
-  1272092958,  3020958951,  2877151221,  2645269045,  2741253893,  1850521660, 
-  2577025741,   967061909,  3228376933,  3460067597,   924710212,  3127033414, 
-  3743940359,  3086517863,  2660712528,  2977827542,   548915738,  2154698045, 
-  1819501423,   910060316,  2760145640,  1139175917,  2414730818,  1086860165, 
-   363692061,  2905923200,  1711409272,  2358183061,  3817583419,  1157541461, 
-   285048228,  3956304421,   474955037,   876536975,   310199876,   548213897, 
-  2298028642,   250707066,  3617734318,  3360168457,  1761090392,  2695118162, 
-  2680454059,  3188281238,  2260794782,  2232151704,  2133529842,  3800243821, 
-  1776208306,  3879468439,  2821383714,  1991567237,  3022588145,  3865828325, 
-  3379909717,  1484740716,  3637748257,   669000885,  1613346958,  2842343340, 
-   746146350,  1623089967,  1320348915,  1652168053,  2689886381,  3797565315, 
-  2102951267,  2760445428,  2043621366,  2991389998,  1849060744,  1745917928, 
-   707316439,  2652109727,  1245641714,    89381764,  2411773873,   272836303, 
-  1605385110,  2677726188,  2145817405,  2581781646,  4137223692,  2310238541, 
-   105216835,   542925897,  4227280485,  1420083371,  2893805976,  3347014616, 
-  3849175265,  1161598711,  2746134386,  1140578304,  1955205459,   267740942, 
-  2821205175,  3718882714,    49056553,  3281441748,  4008293624,   949524844, 
-  3261992349,  1816135492,   717700665,   824970232,  3860696115,  3128575380, 
-  1751681995,  3116447332,   541348253,  2117770072,  1562926724,  3222061722, 
-  3770972199,   917886406,  3854869117,  2974204375,   763185131,   265133819, 
-  1963425466,  2981553537,  3917167319,  1318481623,  2347270007,    81160101, 
-  2851600790,  4112082753,   623010945,  3692394442,  3979823160,  1942475935, 
-  3875537876,   707925420,  2820570397,  1088304742,  3818966116,  3596377050, 
-  3207342050,   181487141,   741253094,  2944315280,  4137929902,  3937030071, 
-  2234193122,  3446281074,  3742770587,  2280529149,  3950461744,   966052616, 
-  4177880780,  3718763635,  1518816465,  2735314335,   320681056,  1673923858, 
-   425743630,  1432602560,  1422007568,  3856945538,  4167032295,  1580634049, 
-  3381808242,  3528789327,  1932557058,  3021104134,   687148704,  3528355910, 
-  1782549648,  1701982466,  1648045619,  2137687431,  3967071643,  1056301125, 
-   487342524,  3554055355,  3724695994,  3158783013,  2204415522,  4240392439, 
-  2841837666,  1675156341,  4196279372,   697547341,  3293012675,   667622965, 
-  1432312142,  4076880518,  1624762716,  1401279369,  2458703036,  1867923082, 
-    51946794,  3359652529,  2242628513,   984515087,  3368543104,  3319742134, 
-   331390471,  3258027629,  1608329774,  3068177052,    65270134,  4016741516, 
-  1017873979,  2109786428,  1844063850,  1800156091,  4218943581,  2856109667, 
-   857924744,  3998852529,  1587581002,   649753066,  1010924036,  1648348702, 
-  4070471399,  2719900500,  3207446510,  2685687250,  1629765932,  1362670580, 
-   855447810,  1246115455,  2452654799,   180744417,   462365399,  2712265474, 
-   159979380,  3537962923,  2980083353,  1216272773,  3079784415,  3212029130, 
-  2124329707,  4275720456,  3463387937,   457050915,  1046959832,   157305025, 
-  3152123057,  1552193308,  2320693991,  4059586832,  3221301054,  1420359359, 
-  1735631463,  2208884464,  3998379657,  3643406470,  2971772845,  3747652568, 
-  3824554696,   861364823,  2304595720,   125005562,  1049265332,  2313706035, 
-  1427531743,  4113589463,  3846589834,   216069600,  2268458906,  3357141180, 
-  1384364989,  2024714835,  3150505899,   774402064,  4058083974,   440693222, 
-   108827253,  1045097693,  1357749051,  2110571837,   854169106,  3349543088, 
-  4126234545,  1562206862,  2028973385,   901637264,  1651892098,  2660941007, 
-    80863190,   291036508,  1248594292,   367646496,  2042613135,  1438712976, 
-  1213714595,   144254297,  2617047803,  2088077186,   101727130,  2196724665, 
-    51908307,   332593637,  1729398805,  3743517989,  1155874014,  3609484364, 
-  2070032940,   706603701,  3206592907,  2459508397,  1675196230,  2716736483, 
-  2547928747,  2299200010,  3025679399,  4187125331,   314291168,   884865060, 
-  1007234085,  4062781508,   113395769,  1590117931,  4256546355,  1021420204, 
-  2825523488,    71457535,  3286573022,   102722304,  2424980062,  3162469668, 
-  3840232347,  1083453616,   579973099,  2706708631,  1094560895,  1504935036, 
-  2595208932,  3689991019,   659152998,  1915068038,  4035862881,    57375498, 
-   811468924,  1278974136,  4293297154,   364370379,  3937175208,  2094891098, 
-  2250616956,   110989047,    31909894,  1450541009,  3712194965,   335257561, 
-  2050151566,  1896618053,  1508633909,  3673514398,   696455465,  3364707499, 
-  2626052929,   631225368,  3958447817,  3180574654,  3307220199,  3005014968, 
-   799125649,   441605225,  2720601720,  2075872439,  2553453163,  1232250655, 
-  2171704822,   895699195,  3277027890,   385163224,  2109836765,  4170369436, 
-  1542734531,   105195848,  3289941607,  2757245625,  1070078637,  3500350200, 
-  1274303536,  1405801533,  1236261061,  2431449205,  2365549876,  2044144786, 
-  2097309431,  1132149258,  1302792517,   243146573,  1193771852,  3753717929, 
-  1076974761,    97719245,  1895283097,  1865840931,  2482102688,  1796656537, 
-  3842639915,   790649652,  3765197284,  3558015744,  4095605012,  3023666320, 
-  1869132997,  3411217504,  4246800601,  2727299193,  2124744171,  2208018226, 
-   192103776,   603841892,  1206463270,  1307054888,   585108683,   505921438, 
-  3362387345,  1246758846,  2439705653,  3282273677,  1846884910,  4042554473, 
-  2956059795,   872772047,  1550335345,  2646215061,  2763033689,   222176245, 
-  2386489756,   600956040,  3457767976,   498761542,   871231316,   619566245, 
-  2362903454,  2228373760,   728714296,  3437315428,  2434180373,  4251186364, 
-    33021992,   807258559,   541347581,  3478732903,  3414177967,  3969966436, 
-  3890206709,  1381446643,  1328096991,  2982354742,  1015171024,   290790653, 
-  1707313054,  2656385954,   541560669,   394169606,   195411056,  3143434169, 
-  3972497222,  2822684522,  2481894056,    97151615,  2671516792,  1239273277, 
-  1535948984,  3940462390,   298474995,  2345666810,   769603744,   136006561, 
-  1330818931,  3826284593,  3048149949,  3734764683,   351960233,    23421913, 
-  3590614629,  3389257320,  3697700849,  2466178730,   299157165,   498953091, 
-   940598699,  3639392346,  1947777198,   571641162,  3927699487,   413236692, 
-  2888952348,  3069669524,  2946066488,   760286961,  1541548521,  1414106715, 
-  2184968132,   545942986,  2779459199,  4101268230,  3781613275,   763753485, 
-  3700732395,  2024288230,  2951322543,   472607826,  1274603429,  2530610394, 
-  3706863998,   334059775,  1832952116,  1386301378,   257490215,   930012917, 
-   646350902,  3397339693,  1461451337,   663608859,  3577325466,  2542607690, 
-  3426916567,  3967735324,   757085473,  4274086389,  1956455371,  1745638721, 
-  1670744174,  3382556913,   809109021,  3430490549,   471120211,  1824824269, 
-   436744620,  3780318066,  3293839574,  2036693981,  1668945424,  4154918577, 
-  1995724432,   758679285,  1176017035,  2129851964,  2335928152,  1570797378, 
-  1261602594,  3619566459,  3319631938,  3230240454,  1298778757,  2420964577, 
-  4049982154,  1635384254,  3328103224,   561201154,  3246878758,   972264563, 
-  3977266900,  1865580901,  3314697001,  1131386066,   767993645,  3321259098, 
-  3093617237,   595396920,  3219463410,  1054194287,   825396400,   786170282, 
-   166242657,  3204625681,  1342528447,   389235421,    92339287,   836385974, 
-  2470524049,   730461612,  2908147154,  3655658160,   149822176,  3120905767, 
-   958553911,  2165325440,  1925560851,  1568047952,   847592939,  1995409484, 
-  3055366776,  3598776502,  1118378324,  3971630629,  1922109309,  1305990217, 
-  1767032089,  3459970060,  1961233971,  1142832835,  1032034544,  1460156712, 
-   808185188,  1945012916,  2292607970,  3896250302,  3025084202,  2396167046, 
-  2478523772,   728349230,  4180274101,  3799778080,   254815766,  1752787003, 
-  2587178719,  1661900149,   884065766,  2692394728,  2645092663,  3230235941, 
-  3820886392,   423022883,  3212157431,   638172051,   156508009,   358046940, 
-  3492642704,   841311315,  2551031728,   949519443,   323912192,  2506526497, 
-  4128262142,   912865647,  3660725338,   948862190,   912684182,  3171835775, 
-   193561975,  2086264400,  3826932231,  1176674595,  2448325642,   346037620, 
-  2039259077,   830434922,  3169666800,   823408850,  3922401657,  2076039337, 
-  2051188874,  3194298244,  4238355332,  1244940048,  1609714248,  4111225695, 
-  1256808673,  3106422462,  1736581658,  2571795186,    25733840,  3240547533, 
-  1406070585,  2100519143,   746139302,  3111918857,  2442510478,  2346069436, 
-  3762820951,  1097238705,  1277414245,  1524338255,  1759102930,  3381328361, 
-  1077189266,   193927394,  1291146533,  2104270530,  2471875930,  3161263559, 
-   929330519,  3527894929,  2091568737,  1573375611,  2668731659,   866411439, 
-  3127011499,  2092761839,   164512495,   869518907,  3277758807,  1764882057, 
-  3774016982,  3402735474,   339326945,   367096726,   325100978,  3375234756, 
-   252299468,  1809925440,   180869726,  4279289270,  3167383812,  3396795725, 
-  2825612615,  2303992462,   266082989,  3276472619,   139561945,   533712179, 
-  4112997648,   277877173,   485928516,  4123112008,  3006146561,  3045717297, 
-  4044528274,  1001022125,  3163398571,  2319952554,  1574259649,  2286785886, 
-  2417145631,  1093916929,  3331751396,  1639823002,  1554945490,   585529504, 
-  3997874010,   636971662,  1539771254,  4031954238,  1665944117,  1623971331, 
-  1389714135,  2241152115,  1552670185,   179569026,  1000167865,  1159239763, 
-  1251434741,  3169664983,   253164451,   244592193,   924530562,  3916267537, 
-  1479948944,   710322581,  1833749923,  2070073443,    96195155,  3819520093, 
-  2995614519,   122157928,   881467854,  1626638743,   603757224,  3830806226, 
-  1338535543,  2585546699,  1128893143,   998702728,  1889491106,  2987423295, 
-  1120823296,  1654816876,  2821694248,  1047881093,  3293088278,  2597215373, 
-  2366427279,  4149558320,  1125954695,  1270926191,   795654578,  3217216245, 
-  3951337286,  3420720105,   910742762,  4060573220,  2486028771,  2711337169, 
-   656036426,    64477768,  1393213981,  4288658775,   725783816,   300593445, 
-  3484393230,  1284521245,  1644105843,  2906898953,   584856467,  2806360205, 
-  3278561113,  3163688717,   759829179,  1586342163,  2818037134,  1961339848, 
-    71028939,  3499356703,  2095811228,  3114912980,  2515308273,  2269799105, 
-  2042690865,  4107689735,  3573921747,   195938969,  3361897667,  3603640682, 
-   132969763,  3126150773,  2588997509,  1840184638,  2463915819,  3348476551, 
-   725563069,   788630472,   954901656,  3087105598,   435945607,   895238151, 
-  1401066748,  1697586830,  3467131028,  3976688601,  2200436160,  3512420129, 
-  2869187979,  1099590900,  2198263637,  3810533442,   407919959,   496728659, 
-  1626551803,  3749180952,  3716553553,  3399243378,  1509977116,  1333928399, 
-  2796544005,  3803301900,   227768709,  1751795403,  2203140028,  2472213905, 
-  3965648374,   570374679,  1720800354,  2461603736,    95733897,   198470670, 
-  3463355505,   811570786,  1218319908,  2517046301,  3628539659,  3102506238, 
-  2608408872,  3127805847,  3072930345,   414530027,  3512948759,  1129044436, 
-  4122359133,  4238236858,  1022264969,  2632573313,  4206095433,  3451197254, 
-    74769791,  2063325156,  3340676977,    18389349,  3869442822,  3178231094, 
-  2187368099,  1058480870,  3663929160,  3067467704,   628396321,  3124372782, 
-  4005002002,   902093294,  1389278272,   490687399,  2977913312,  3750363186, 
-    71616924,  3624181757,  2421939569,   205624440,  1277306021,  1639043104, 
-  1709684526,  2258577116,  3957095301,  1296296102,   248368260,     7476887, 
-  1957824754,  3604966352,  1023574818,  1592319788,  1732269145,  1065708441, 
-  4268503735,  4139131232,   562532566,  2172590170,  2534028056,  3826522945, 
-  2784630589,  2784559557,   646145054,  3994325919,   540583981,  3816114916, 
-   621521726,  3202282132,  1787067171,  3467133912,  2208160413,  3022184836, 
-  3816957288,  3238718270,  3842954333,    82383037,  2504094452,  2093930173, 
-  1172016654,   508414877,   813727083,  2815459466,  1938811880,  3315153813, 
-  1291254032,  1297843896,  1249498790,  4016249839,   477961120,  1369793770, 
-  3515862346,  4016942816,  3571974705,   767054678,   362127552,  1192004639, 
-  3683373171,  3107138060,  1549433379,  2038980864,  2258207582,   977479605, 
-  1641822908,   614407938,  1332673048,  4248375105,   210622386,  3302259832, 
-  1809560385,   946738900,  3409410752,  3977115366,  3082848965,  1704176143, 
-  2165873337,  2070146750,   758033833,  1704325510,  2487144298,  4213886591, 
-  3928413661,  1951836573,   654371843,  3154432208,   796848343,  1266425211, 
-  2105477208,  2621828300,   458084988,  1095160780,   490299921,  3398635424, 
-   389445800,  1452907134,  2319668471,  2590378643,  3545669343,  2587675433, 
-  2998127404,  2163077512,  1278928530,  1838388746,  4284603504,   729306439, 
-  2464834075,  4186663434,  3520361110,  3015333355,  4101591506,  1344127035, 
-  3535342670,  2510967955,   667543291,  3743714868,  4206464980,  1191609324, 
-  2063764962,   595075740,  3817451245,  1596995120,  1681514392,   230100418, 
-  1575535972,  2112617841,  1200512069,  4178670713,   696875206,  3690826567, 
-   127408110,  2438290026,   848284696,   550822678,  4138547399,   486365958, 
-  2990024594,  2780011077,  3166524788,   977503869,  2583013812,   849610023, 
-  4015591388,  3511583148,  2398880225,  3387487581,  2950030221,  1400933374, 
-   421572431,  2855224322,  3353716233,  3022334834,   450222178,  3920673851, 
-   810988747,  2847887443,  4222145627,  2033094220,   253848436,   380194482, 
-   960519694,  1953471340,  3154331873,  2127022692,  1154246065,  4254627828, 
-   413661786,  4067523437,  3797578170,  1546658950,  3095436071,  2399055211, 
-  2401891535,  1175530067,  1823167021,  1592245297,  3828191894,  1626715588, 
-  2585842168,  1733468473,  2121009784,  3733894867,   629453245,  2246973305, 
-  1498488325,  4241609607,  1741298629,  2563745185,   477532383,  4237049970, 
-  1314572316,     7288821,  2900885893,  1636597847,   942113023,   327040018, 
-  1229979759,  2997277141,  1882785575,  2966406615,  3108789742,  3587640527, 
-  2113038969,  1667948232,  3274050802,  3374789090,  3153332173,    42784842, 
-  3464970195,  4214022954,  1169721604,  3356986763,  3294952207,  3370023539, 
-  1280770564,  1265238630,  1898833576,  3888981392,  1280565231,  1189894348, 
-  1688021473,  1667079950,  3972994461,  2817630240,  1163110301,  2033298733, 
-   146705187,  2423442477,  3396784122,   112139856,  1522652818,  2536903231, 
-  4119734557,  2509279955,   153489233,   579685763,  4167098214,  3958872498, 
-  2374853893,  1070102405,  4041023405,  1110504724,  3812278492,  2919537165, 
-  2973552993,  3666730851,  4138422808,  2627141450,  1817672688,   276985304, 
-  2954182691,   125032263,   612517677,   696883378,  2650572944,  3051316102, 
-  1964587154,  1269738899,  2271365828,  3742288322,  1670599625,  2690356365, 
-  2330610960,  4098736728,  4040014382,  3282057381,  3780914751,  2139496745, 
-  3352166102,  1034342576,  2083540301,  2571176969,  3896700833,   199449473, 
-   491475278,  2870485810,   859991108,  1298362069,  2136080420,   447772123, 
-   656820494,  3463543198,  2625298610,  2882551128,   376519185,  2357494502, 
-  2811631691,  2571820931,    71196563,  2601054011,  3444315232,  1010773994, 
-  2356922344,  3305196676,    25420893,  2191391963,  1670101489,  3362139395, 
-  3244569385,   760185996,   182306040,  1386240052,  1975921236,  2037601092, 
-   419653990,  1360934691,  1541731299,  4011200817,  3030253685,  3476611977, 
-  2693573488,  2885118842,  2723788600,  3470606719,  3660922506,  3446021797, 
-  2168869376,  1106077057,  2319340366,  2774111985,   215206339,  3968897576, 
-   881973947,  1576669843,   485495056,    86944277,   368797497,  3896841419, 
-  2143059593,   402049363,   726488004,  4247321354,  2895399098,   365977404, 
-  4001109589,   211763726,  2272391091,  1970396786,   931654087,  1963071356, 
-  1478128355,  2371532751,   103990140,  3349522959,  3069388337,  1036343178, 
-  2232169965,   585901189,   828845020,  1189539914,  2595527485,   887110046, 
-  1375955244,  2448528589,  2354833007,  3910230214,   238828220,  2251010211, 
-    81021947,  2036376354,  1489414132,   924748155,  1349173585,  2744249149, 
-   536105336,  4061125151,  4078986004,  4005972197,  4122669963,  4147777749, 
-  3827920990,  3637665420,  4148889995,   368721336,  3329669484,   365818450, 
-  1382042368,  2016489304,   295776788,    74145134,  3886100084,   606604933, 
-  1121708214,   827266950,  1638059549,  1969186089,  2122910304,   775550772, 
-   546202669,  3244285617,  2869336607,  3839389232,   184156380,  3247187967, 
-   605454913,  4057142016,     6820171,   292655863,   281317726,  2364277571, 
-  3882576267,   659781894,  3469081948,    49617968,  3876970872,    92770661, 
-  2045933407,  1113463472,   481339969,  3182821518,  3138914486,  1301835088, 
-   974684163,   295842808,  2938828528,   626539024,  3839945455,  3830188874, 
-  3242177551,  1211095798,  2622400591,  3835340811,   830442270,   835899489, 
-  3001351516,  1180263865,   112914290,  2219355059,  1896887702,  2771651802, 
-  2575373902,  3432509413,  1533015524,  1529854267,  3874734177,  2963709081, 
-  3584983087,   832894642,   101924466,  1276211377,  2908179383,  3920393878, 
-  1473602937,  2064826867,  4170251345,  3732985086,    42310161,  1180495914, 
-   903940727,  2223349197,  2961204239,   150965336,  3258551869,  2191559917, 
-  3700028647,  3496735859,  2084072425,  2644555181,   101495863,  2327507110, 
-  2386126066,  3170412912,   920053012,  2142935050,  1663172722,   970947998, 
-  3391436104,  2127784864,  2468918640,  1567240235,   653675678,  4251054876, 
-  2822556689,  1620509332,    14563521,  3236610523,  3340199180,  1528604173, 
-  3138909228,  2924197874,  3503373170,  2401597295,  1015288549,  3737382713, 
-    96891425,  1322016893,  3074496529,  3602256011,  3577476732,  1706073792, 
-  2210062506,  3265662024,  4200365103,  2574255891,  2710064686,  3351956419, 
-  1932635440,  2372571428,  1928679531,  2665266652,  2601012107,   473051926, 
-  1777628419,  4120393745,  2767566421,  1228017335,  3919772492,  3715067296, 
-  2712719084,  2746150520,  1635421090,  2823495457,    13904555,  1086119835, 
-  3445299049,  1380710842,  1428915899,    39499706,  1871303801,  1339398832, 
-  1051670372,  2194663137,  3798437895,  3530206369,     6292518,   684829028, 
-  2855145416,     3536461,  2509828638,  3906595809,   342965637,  3686290840, 
-  1049152347,  2554956312,  3281671647,  3473298962,  1443546781,  2978511136, 
-  1015313856,  1304318150,  4170149672,  1803726835,  3692283032,   676189246, 
-  2060686697,  1970068852,    24045114,    66003331,  3900157483,  2360501885, 
-  2984971849,  2584831843,  3196200706,   979117347,  4037961902,  2231233526, 
-  1242885237,  2934862802,    54219947,  4133004016,  4028856409,   294987887, 
-  1500464320,  3270889687,  3056919605,  1966166983,  1199923925,   881871687, 
-  2054009450,   151776097,  2890875028,  1800121177,  4036680009,  3787551675, 
-  1130142262,   549399231,  3101893176,  3405076838,  1572662325,  2387308296, 
-   333510795,  2489680410,  4276928124,  3543807167,  1225463047,   521582788, 
-  1196896981,  1055294485,   103552777,   802214257,  2848620353,  2440898694, 
-   637656554,   386971741,  3488363790,  3050693722,  1727571715,   378200243, 
-  2337883896,  4107587397,    69557483,   637089133,  2849572881,    49700789, 
-  1579819290,  2346865644,  2158118831,  2418663783,  1273653567,   580304810, 
-  3934704170,    88471213,  2383570702,  3290737697,  1208544609,   551833012, 
-   993768195,  1888275250,  2198829958,  2120156344,  1151403423,  3153466062, 
-  2815364670,  4009542957,   397065016,  2860004670,  1934675686,  2903286665, 
-  2385926659,  2802867492,  2423590307,  2817144552,  2175031518,  1383429313, 
-  1611083701,  4243747864,   854229991,  1956710729,  1328349691,  3050168310, 
-  1028245421,  1216244134,  3055130900,  3664449768,  1671014884,  3992442103, 
-  4040340305,  1839845051,  1324789632,   807082108,  2597163281,  1866034821, 
-  2406090224,  3395043853,  4023232132,  1153085551,  1963332099,  1834223037, 
-   414264130,   309296261,  2073574386,  4075760688,  1028722567,  1448663014, 
-  1250756743,  2457030080,    93661298,  3398729605,  4228813263,  1496307663, 
-   577906045,  4221466420,  1182078375,    16523819,   803328953,  3887700199, 
-  3101753155,  2308253034,   404698440,  4175852336,  2322438376,  2792600117, 
-  1316647624,  3538472387,  2938835586,  4080303791,  1274189140,  4160691369, 
-  1591080658,  2221060671,  3176736694,  2013961399,  2607578931,   249809604, 
-  3692528741,  3574246086,  1238390150,  1629238729,  3088231875,  2153385343, 
-  3757434484,  3014973666,  1674842570,  1635333277,    78340766,  3764014800, 
-  1805886495,  1355947552,   731211900,   541474405,  1779111507,   702345420, 
-  2141486713,  3525829081,  4287246223,  2573087889,  4197123207,  2374081246, 
-  3228195681,  4161264765,  2421682571,  2085634526,  2052774301,  2107262864, 
-  3640225188,   908960249,   227572084,  3573941278,   574664870,   231431413, 
-  4169051962,      940780,   890975217,    63760967,  2421050332,   169094402, 
-  2259979959,  3868046088,  3366247597,  4146280713,  1853852157,  1811993661, 
-  1380120538,   206960412,  3043165653,   576056766,   588627843,  1619693962, 
-  3240741176,  3213179321,  1924864044,  1233098622,  2401407271,  1249394465, 
-  3449774050,  1028598142,  3068670665,  1392241467,  2540030365,  2186494503, 
-  1951711242,  3296163457,  1940492721,   897572453,  3783370082,  3791179145, 
-   609952834,  1522022489,  3225236619,   274082515,  1184289852,   706711075, 
-  3892723525,  1799753479,  4129498091,  1757110080,  2188956153,  1037323159, 
-  1472419792,  1812084043,  1193836045,   763222369,  3857469260,  3828701486, 
-   429590172,     1483001,  1553708994,  2221527328,   345606884,  3831355930, 
-  3428614020,  1514561525,   670730317,  2833349040,  4046527209,   363406345, 
-  4045244396,  4158120422,  2139605256,    29560485,  2039833520,  1547991020, 
-   215057511,  3843964963,  1847581020,  2480808567,  2501980440,   728904205, 
-   750864452,  2970653891,  1930965475,  2937405522,   793648440,  1264489886, 
-  4004503534,  1277290069,  2424639159,   475496752,  2186651834,  4071906356, 
-  1291188393,  3940150473,   126490750,  3958586211,  1014150452,  2122056836, 
-   475972566,  2857036775,  3262919263,  1919801476,  1119236074,  1613960119, 
-  1423283951,  1471474102,  2643813173,   760894104,  2084706857,  1690656610, 
-  2001873771,  2886334327,  1114432567,    65339150,  1190173551,  2088946532, 
-  1753856323,  1332538828,  1669661023,  1064589348,  3264789150,   572619806, 
-  1619970083,  2704176171,   220576883,  1273168949,  1560439969,  2400938501, 
-  3905252445,  4103547480,  1681562794,   485360110,    19487881,  2565521092, 
-   105687164,  1398420335,  3946581459,  1565862254,  2458198411,   362442317, 
-  3410413032,  1190105799,  2313388659,   268914261,  1684585783,  3309568700, 
-   987102901,   363237140,  3338084444,  1834522707,  2549179134,  1149410139, 
-   115768789,   835485743,  3222663674,  4095620374,  1152421572,   106577310, 
-  3399615385,  1548399277,  2859156384,   430744080,  2181146344,  1788112019, 
-   494080951,  3488458066,   158296421,  4142284065,  3165946964,  2962075699, 
-  3100747509,   748777653,  2006390343,   610826821,  1738112414,   628766394, 
-   144611525,  2105393910,  2617800576,  3339609569,  3330576802,  2854480315, 
-  4144698313,  4117398432,   972231724,  2804064927,  2442599638,  2756549792, 
-  1407000688,  2815500955,   819380899,   741868580,  1075431262,  4195681364, 
-  3764472246,  2468602146,  2569390908,  3474430607,  4101630062,  4180155359, 
-   705769571,  3956084492,  2475302236,  2921705212,  1626872704,  3237586569, 
-  3483760083,  1025038781,  3366567830,   432224271,  1953166412,  3394423618, 
-   269444994,  3539354798,  3763379867,  3912259566,   489195383,  2650250877, 
-  1801971825,  3767862506,   880709999,  1388001014,  4124891067,  1680421318, 
-  2137019219,   802228183,   659487707,  1564677129,   581946049,  1995287384, 
-  2320930886,  1222437930,  2142614760,  3204316224,  3843561364,   383661641, 
-  1760105960,  2878609580,   361890931,   412084276,  3080832141,  1061502237, 
-  3792940706,   688240462,  3937365547,  3160540123,  2443120993,  4035763802, 
-  4012865938,  2363853607,   209450944,   827354901,  1868246938,  2052812050, 
-  2862647395,  2201323059,  3630570047,  2287023570,  3465382835,  3074298652, 
-  4104079158,  2532319908,   326565951,   315527177,  3953281656,  2046899177, 
-  2547222170,   163574102,  1535595748,  2358361418,  2127319979,  2338997709, 
-    25968354,  3576995746,  3494921850,  4124356104,  4194652511,   930503881, 
-  1045614607,   330254751,    39425112,  1006258126,  2543630422,  1940863863, 
-  2988852356,  3958400678,  1556648355,  3835095018,  3759475373,  1327356634, 
-  1426745804,  2069685655,  2173480159,  3026647842,  3268611445,  3981554879, 
-  1387980919,  2884615110,  3709993085,  3453526784,  3024205360,   689074546, 
-   992855727,   860036479,  3376967288,  3588893430,  1966617805,  2357384603, 
-  1909473312,  2023425092,  1071723917,  1925825166,  3160266115,   943883297, 
-  4250412426,  2492112128,  2141985895,  3971640513,  3745451616,  3033544033, 
-  2624608653,  1621994412,   740972225,  1721173006,  1667924479,  2136093920, 
-  2664281037,  1359041755,  1714341822,  2019831950,   397816504,  3272929657, 
-   449985696,   904279708,   915312456,  2758602889,  3696415932,  1745283283, 
-  1384762029,  2561880246,   928791253,  2093835064,  1559052030,  3362052800, 
-  4073349882,   381934261,  3610999303,  1464380645,  2491277693,   873289935, 
-  2629369504,  2839870363,  2670688550,   543826196,  4013962142,   300065624, 
-   707631018,    50212769,  2861039718,   735784282,  1431627539,  3049487986, 
-  1566841168,  2989884228,  1800467920,  2645754895,  3165687130,   984723204, 
-   385209827,   902281489,  1626547245,  1742695717,    90790199,   361135850, 
-  1731345052,  3127764733,  3088035894,  2992407024,  1874632825,  4119722365, 
-   710324041,  3990489051,  2322369255,  4187512507,  4159974719,  1265801548, 
-  2078770276,  3058488068,   823397051,   465659863,  4273969321,  4107826078, 
-  2335679260,  1603102705,  2560402150,  1959893532,   681934075,  1477151782, 
-  2815357155,  1915260125,  1518625134,    18941392,   641694336,  2214113906, 
-   775692772,   689083393,  2468419841,    31910586,  1524212093,  2369081075, 
-   749499037,  2054630531,  3920275524,  2762119514,   417588877,  1132924493, 
-    24697670,  2631148411,  2223582826,  2331774623,  3629192434,  1656536328, 
-  1011048093,  1971190992,  1844121066,  4045472820,  1872601085,  3780403586, 
-  4254151779,   779088319,  3310417468,   376938428,   908257922,  4007028012, 
-    43050867,  2026836652,  4042468516,  2881264559,  2142805816,  2781169000, 
-  1344447240,  4116181050,  1495707609,  1117948595,  2054789889,   553019929, 
-  3900119785,   397983844,   813433766,  2463643921,  3653401107,  1748047751, 
-  1554367978,  2928873161,  3257991566,  3251304250,  3653716671,  3632050604, 
-  4037840051,   807757471,   913210473,   820062815,  3814112549,   118922895, 
-   418992125,  1160847342,  3563491614,  2494668450,  2218391366,  2885367528, 
-  1643973413,  1102254022,   148059355,  3531187162,  2203202965,  3158125422, 
-   429338850,  3797156674,   999268119,  1613601744,  2046306442,   403414563, 
-  4122291273,  1504718295,  2218776130,   152796196,  2479852435,  1917657086, 
-  2324017623,   855357288,   771503600,  1874142554,  1178525727,  3023354153, 
-     4583573,  3852178083,   887737160,  1411055758,  3817559974,  1564709601, 
-  3558989104,  3728028176,  4028889228,  2606112618,  1222716379,  1529108686, 
-  1260375615,   311056276,   918728610,   235008965,  2814123381,  2845648136, 
-  1221356378,  1263290559,  4143413039,   804417134,  2199501975,  3367998402, 
-  2275708015,  2364270095,  3995195544,   839226700,  2296800437,   798394658, 
-   389202368,  2723386922,  1331557082,   188080455,   219958554,    38031154, 
-  2042369096,   343102284,  1812423361,  3260720086,  1910387167,   716015883, 
-   445495622,  2035179628,  1275311572,  3470173869,    17946937,  3815997683, 
-  1215585467,  4048468287,    47685747,  2908112750,  3941595898,  3802156906, 
-   425737691,  1529529265,  2820803697,  2574558693,    67046687,  3992612429, 
-   195053655,  1219483629,  3218951953,   198717832,  1804508700,  1549232600, 
-  2573387726,  3434393298,  1878537801,  3039872973,  3974579281,  2774752671, 
-  3724664021,   250992937,  3796283851,   240670018,  2756837866,  1293436200, 
-   203216373,   308515204,   808033598,  3547170979,  2419201983,  2225783885, 
-  2052593595,  1700044205,  2164213407,  3468520026,   260051787,    54257100, 
-   564932766,  4193877696,   439201239,  1126919846,   453939867,  1750518743, 
-  3455904704,  2177817282,  3677080536,  3976458120,  1529153176,  2721134644, 
-      837271,  1090704480,  1974077454,   255748260,  3933296160,  2323656545, 
-  1582450063,   342990486,  2246266613,   233968441,  3672627207,   388390285, 
-  1934492713,   326258200,  3219705438,   791474922,  2328388052,  4105688499, 
-  2073294662,    83942544,   990988223,   850974549,  3350366846,   523611439, 
-  2471866431,  1545608527,  2939064326,  4043963572,  3570736114,  1190781139, 
-  1417991816,  2165586139,   332411793,  3052304951,  1152123994,  2741173573, 
-  2584894458,   299160712,  1507897297,  2497623975,  3021512229,  2232964453, 
-  3878821634,  3692137292,  2863668588,  1833090497,  2345132117,   370063657, 
-  3688067181,   483290617,  3703552200,  2553924459,   716525887,   758213129, 
-  1738980514,  3422833088,   223079200,   708988023,  3680245593,  2268686443, 
-   293820549,  4292052494,  1908797290,  3135200791,  3994534702,  1063785241, 
-  3421079050,  3128564367,   207621239,  3282063694,  2777459408,  2706038527, 
-  2963317967,   688571538,  3952098888,  1768022372,  4142211366,  1893321026, 
-  2002366012,   748084317,  2710128245,  4045218418,  1121836457,  3537454135, 
-   690867740,  2841925227,  1080016578,  2507523869,  3085730518,  2243988794, 
-   933953502,   476524927,  2320977449,   588527139,   918375988,   361284190, 
-  3125699426,  3997936336,  3560531838,   346918922,  1633347116,  3759678885, 
-  3681288400,   588106925,  3967198616,  3088913600,   779160033,   327874263, 
-  3535663290,   546185391,   196771751,    64399808,  1722813062,  3099158152, 
-  1742115182,  3157252262,  3253650191,  1209567539,  1590595321,  3692116395, 
-  1278594450,  1930080299,   594165998,  3818120972,  2722448631,  2180924943, 
-  2872020708,  3855215664,   296894141,  4119030370,  2065278804,  1755659884, 
-  3741503242,  2348811516,  2664942076,   928673648,  2685432136,   527200144, 
-   182852956,  2598081583,   815006399,    57775709,  1497380626,   892950173, 
-   257493294,  1822152696,  3619522885,  3825696535,  4181810903,  1265052547, 
-  2857583770,  1886482985,  2496406019,  3003190801,  1183795662,  4042482827, 
-   227419881,  4009550630,  3539521952,  3924960889,  1640700615,   378061213, 
-   226788548,   908854103,  4284893099,   437927769,  3088633509,  3818660304, 
-  3988794345,  1068692675,  3354079936,  1521920718,  2595710397,  2309525977, 
-  3902685451,  1715924654,  1736531821,  1986949098,   795539284,   654400725, 
-  4266586050,  3682491816,  3150550356,   513487823,  1127216553,  1134740629, 
-  3875256745,  2632683634,  2472384015,  3479639524,   454996556,  1816265767, 
-  1619154315,   705533307,  2383967838,  1204303108,  2314517475,  2271288404, 
-  1001377684,  2941681802,  2224899252,  4143265413,  1696615771,  2533963047, 
-  2318008985,   440153346,   110826746,  1222244485,    37743343,  1500261834, 
-  1805386720,    98953903,   793154014,  2744187026,  1569597899,  4219619711, 
-  2117194150,  4247540215,  2720802994,  3109633486,  2501896041,  1863509155, 
-   336484203,  4012359356,  3508651786,  4015678271,  2481634735,  3606379191, 
-  3922187532,  2267235306,  2582582444,  2791804369,   904754763,   327142317, 
-   750036516,  3311972385,  2337809094,  2748620987,  3579530146,  1974459242, 
-   518959810,  1658997792,  2237390067,  3857291463,  1505679733,  1095483566, 
-  1187289364,   792268955,  3371777052,  3989413571,  2073135412,  4219497528, 
-  1273360909,   737585398,  2485701499,  1128532048,  1491573935,    76354080, 
-  3571906020,  3474913121,  4218899909,  3526088374,  2756904429,  2113923037, 
-  1929575763,  3712511115,  3831938405,  1239660288,  1235114805,  3498507371, 
-   626562947,  2933421985,  1053765194,  2172663829,   741854873,  2500279317, 
-   693523177,  1910559597,   122003312,  2067815601,   547535401,  2228501018, 
-  4012914725,  3345495510,   104402497,  3774928048,  3973924075,  1959983842, 
-  2136339372,   441458080,  2456991240,   973861706,  1476690771,  3312984041, 
-  1703095683,  2268831855,  2208478140,  2986236161,   446658134,  1381591968, 
-  1456956064,  2501315671,  2458894231,    94704220,  1147355030,  1699600599, 
-  2838785822,  3245258197,  2069242150,  1072167231,  3020230077,   566772229, 
-  1757101575,   796722908,  2745640062,  3541210912,  3199745975,  1955124643, 
-   990048979,  1274982704,  1162042072,   283424020,  3681097546,  1086017414, 
-  2752258776,  1713790514,  3116449953,  1520457891,  1755935266,  2214756283, 
-   532372809,  4036806281,  2153777523,  1926913498,   982063333,    67463042, 
-  3699932619,  2820510948,    87261706,  2641086911,   608659076,  2170277111, 
-  1239824328,  3519904695,  1866553495,   928759657,  1094300988,   451235990, 
-  1825915769,  2120176551,  3873504085,   959568643,   740741388,  1550694896, 
-   154416721,  1866404454,  1572250452,  3221467660,  3387446390,  3410958362, 
-  2976418524,  2592399587,   432656270,  3178848037,  1204372663,  4059122760, 
-   394488412,  2027780999,  4089636748,  3114609136,  1804274820,  4104732125, 
-  1282015940,  2519387514,  3499797662,  3318255208,   964700995,  3334909378, 
-  3757617136,  2201992420,   239310331,  2125639279,   830408680,  3992029107, 
-  2761086152,  1100237490,  3105339494,  1975712438,  1918151810,  2046445809, 
-   261979678,  4251129377,  3008901458,  3004498031,  1896232095,  3217219716, 
-  1517288442,  2329383951,    19777965,  1413896024,  2495409988,  3202507187, 
-  2570071027,  3345159672,  1240206154,  1223010778,  2788637723,  3268982473, 
-  1202059388,  3218783122,  3023134692,   474924808,  2312773391,  3373223831, 
-  3713001024,  4089337710,  2261622108,  2650855215,  3877371118,  1991255195, 
-   695723307,  2863271580,  1524368447,  2024478170,  2778492825,  2775757060, 
-  3766140031,  2415576579,  2014031032,  3999759734,  2267549361,  2110343263, 
-  3417766219,  3434328348,  2248776133,  3135524220,  2277032306,  4065264594, 
-  2331039663,  3102359018,  1702210111,   987534746,   829619678,  1998369965, 
-  4288045355,  3694126179,  3421672231,   316871802,  4203880182,  1042846879, 
-   897267819,  2534888005,  2985588767,  1501852868,  2372366793,  2998976816, 
-    98698129,   570650960,  3225804657,  4280540570,  2206748131,  1624608733, 
-  1834419283,  3860411400,   988408843,  3352274100,  2701593797,  1852458046, 
-  2638002685,   314142769,  1738129003,  2122055333,  3077797613,   208429799, 
-  2133602088,  3486029183,  4186726775,  1832742487,  2012126366,  1778776330, 
-   992252581,  3048856569,  1771100171,   766268999,  3353857647,  2447572409, 
-  2847547057,  2035430143,  1158649231,   233155130,  2091066182,  4083528428, 
-    25817712,  2082037169,  3402265511,  1466721712,  1170281096,  2896093164, 
-  2258787200,  2966196589,  1590317073,  1215342692,  1501506849,  4081525459, 
-  3900346518,  2401920236,   981469851,  2893681515,  1385104648,  4283557676, 
-  1756379213,   262581932,  3590455964,  3263928615,  2917801851,  3369376546, 
-  2613679187,  4266977202,  1855873790,  4173973080,  3758433811,  3574837805, 
-  2926550148,  2609910340,   270147629,  2196952350,  3404250741,  3651868094, 
-  2051824051,  3172101796,  2962779715,  3188990576,  1466284897,  3871617146, 
-   299924896,  3591368497,  3451482452,  1066611638,  3696484175,   699068153, 
-  1138250114,   882385976,  2054792963,  3580006041,  2144916547,  2457660707, 
-  2634645680,    95930206,    11717045,  2751055838,   735778002,  1158910163, 
-   299010185,  2341687219,  2153421587,  3732685422,  3258304099,  2997386625, 
-  2377307088,  3467556012,   878835353,  2600450311,  3638103516,   372985399, 
-  1767992101,   210222674,  4031734533,  2219406418,  2394832189,  3513936414, 
-  3758412971,  3002311471,  3753613671,  3438612529,  1651935064,  2836379045, 
-  3384126758,  3493480623,    67108297,   820974729,  1398340672,  4116426643, 
-  3649846542,  2980773232,   562083853,  1361859759,   383438486,   237047123, 
-    74387434,  1317977362,  4264210363,  4080919746,  1966469874,  2511673943, 
-  2549025971,  1255462040,  1037740160,  2971983518,  3012054793,  3545864979, 
-  3327957837,  3319075762,  1584044276,  2695600465,  2362829255,  3417332982, 
-  2215133596,  3605107291,  3936179281,  3227631768,  3665760785,  3638110295, 
-  1423415658,  4246847184,  4102746635,  2249393109,  2952271032,  2345173648, 
-  3989716949,  2951508528,  2445377985,  1666888859,  3828303699,  3545525293, 
-  3946688715,  3185410637,  2214600125,  2811700180,  1248055894,  1813167325, 
-  1267943871,  2863300804,  1559346929,  3905047605,  3818844515,   329589444, 
-  1436473155,  2695122825,  2617583404,   163276195,  1554947623,  1281475971, 
-  3580546558,  1306243548,   589031318,  3205366805,  1634994077,   574070365, 
-  3317620758,   700240900,  1727080012,  3986847443,  2027867463,    49483132, 
-   220408240,  3030706951,  2108156345,   678037442,  3724589992,  3460205352, 
-  4263226589,  3737768093,   729394726,  3420494167,  2514527340,   507684421, 
-   705588054,   650216691,  2935529918,   882788420,  2669449377,  3550573996, 
-  1611539218,   195060361,  1642733128,  3658134989,   271607939,  3659242158, 
-  2093756680,  4040201757,  4149311422,  1374481490,   569059581,  3129479746, 
-  3619233700,  3514687313,  1015522357,  1782384639,  2371946183,  3973165040, 
-  2870834408,  1911487276,   721425747,  1338501364,  1973218275,  1253119475, 
-  1781746597,  2185044110,   293613149,  3777806319,   610252693,   105391918, 
-  1813792170,  2242791832,  2499963472,  3107534512,  3030930032,  2981373317, 
-  3644411262,    94079282,  1286742175,  2430153157,   227450494,  1742167392, 
-   400521957,  2443473110,  1769109646,  3054743574,  3419060774,  2442169665, 
-   349136974,  2318751847,  2130017378,   305464158,  1177231913,   266943174, 
-  2534516661,  3392823319,  2126521932,  1644640541,  2064925845,  1553045961, 
-   724343775,   387985717,  1695770431,  2804457130,   565902390,  3172476973, 
-  4186982437,  1154940371,  1260266261,   639557537,  1655897808,  3249007092, 
-   304159440,  3648839862,  2306796913,  2688401614,  2309870995,  3780281090, 
-  1705984318,  2928035721,  2141298994,  2009413486,  3026081896,  2326885496, 
-  4137086655,  3843621170,  4276905134,  3535377689,  2848158245,  1334661151, 
-  4056775242,   895783968,   190377463,  1576148997,  1490855151,  2115313549, 
-  1397194254,  3886098269,  4086487968,  1223422395,  3606298332,  2598119715, 
-  1505964592,  2665332243,  3802036536,  4233544677,   462584594,  4090876717, 
-  1241447957,  2910541633,  3940264711,  1428892809,  3606337797,  3562300366, 
-  2635564024,  1773894898,  3514969562,  2948358395,  3080086616,  2296244080, 
-  2663115450,  3713504510,  2915612769,   760594097,   650689730,  3987397253, 
-  1410839028,  4122037990,  2668057703,  2499758233,  1495150061,  2035042479, 
-   257775522,   257622138,  4218635429,   447259957,  2513457292,  1369199738, 
-  1951948313,   523367094,   629394432,   507296377,  2183051817,  3081225209, 
-  1169340298,  2348645308,  2560583614,  3607568543,  2428615416,  4291009664, 
-  1731942225,  4177502351,  2659177563,  1279419273,  2922781572,  1092485994, 
-  2375599526,  2244332900,   668196502,  3003949408,  3092989159,  2652270976, 
-  2747382011,  3905979837,  1690552725,  3015500566,  3327900984,  1012833176, 
-  1601987798,  2609097575,  4219991923,  1567116609,   766375144,  2574956695, 
-   560885991,  1888395999,  2671905266,   851641468,  2975871667,  1384539381, 
-  2074349076,  3362039940,   538133734,  1767176271,  1552792325,  1402367902, 
-   592881871,  3108395663,   998989477,   276966024,  3448139625,  2749170572, 
-  2023593900,  2558167340,   474831752,  2189627643,   307660081,   246793281, 
-  3330843138,  2125681987,  1114252980,  2132026618,  2073702404,  4209894563, 
-  1453868641,  1094715599,   437926163,  3520200411,  2149804521,  1840036768, 
-  1183262234,  3962679442,  1979551141,  3267032420,  2985575098,  2049206270, 
-  4243865326,  4140583827,  2320676874,   959057901,  3514644256,   137380429, 
-  3463266142,  3037313138,   687188213,  3188262200,  1823494834,  3653042247, 
-  3092990470,  1319253913,  3974322245,   159510393,  2483231141,   474702100, 
-  2309553868,  1997246356,  2565099702,  3835186742,  3583276434,  3809936252, 
-  3945414587,   713655473,  1460527425,   223617910,  1055655316,  1738775643, 
-  3383891637,  3866079408,  2878643955,  3146407462,  2523940415,  1415507550, 
-  1042409759,  4241165358,  2314378522,  2456911609,  2968655434,  1349599111, 
-   703693032,  2268029257,  2979603541,  2638927411,  2347879434,  1507240816, 
-   205338661,  2143821007,  1246011160,  1363259726,   413215804,  1538079862, 
-  4212654710,  1339838568,   958209795,  3775399992,  3474060340,  2224191699, 
-  2847238646,  1556123542,  1306375013,  2496087862,  3806067477,   602262875, 
-  2525551886,     8332078,  2777950485,   356937771,  3082261692,   515619797, 
-   533458976,  2889432872,  2094435919,    82103650,  2471006436,   517010711, 
-  1232293137,  1311562353,  2121599857,  2947598351,  3527336545,  2445546855, 
-  3271806097,  1630281731,  3308307049,   508313060,  3749759141,  3976348168, 
-  2836400161,   366149236,  4192357346,  3111893180,  1131479117,  1516520642, 
-  4286806749,  1092966544,  1344589014,  2349506567,   293948767,  2016953493, 
-  1101246577,  1884211694,  2614351713,  2529829096,  1653893622,  1112771856, 
-  3459839475,  1066795605,  1394070654,  3766656959,  1629064142,  3362086685, 
-  4256952326,  1278084525,  1589345124,  3014575418,  3290009099,  2426524329, 
-  1888696863,   688589033,  1322828382,  1865253168,  3908870673,  3655752847, 
-  2809843025,   554759434,  2672021621,  1778846305,   785841793,  3484097370, 
-  3199531668,  2722325168,  1638027063,  2941376716,  2617936992,  3176750105, 
-  3673671845,   183520853,  2333114700,  4221752214,   992818965,  1935014072, 
-   630635618,  1171938283,  3128688985,  2168121115,  3494626767,  2062714791, 
-  1983124148,  3421286272,  3854662865,  4137045710,   488714903,   925472433, 
-  4199773210,  1933070616,  2259605870,  1116021153,   813347872,   109466923, 
-  3315050213,  4186153720,  3153387190,  1486804560,  4203377601,  2123311451, 
-  3792778157,  1993380592,  3247643022,  2139230199,   588132527,  2423822794, 
-   862776858,  1956944546,   654141610,  1496246341,  4254871534,  3192228233, 
-  4100796563,  4205003380,  1727727353,  2887194190,   324584559,   126207505, 
-  2565173733,   964323116,   508188717,   931529299,  3806733677,  1791031516, 
-  3036460645,  2639707572,   298459178,  2989065994,  3103991207,   273109756, 
-  4019461000,  2165969423,  1192375489,  4196597609,  1462496870,  1731042575, 
-   174166846,  1657794740,  4211500499,   592307913,  1023823441,  3510605644, 
-  1826879738,  1640132312,  2101084111,   834868292,   675498652,   948596657, 
-  3979944195,  4266354357,   289237148,   216289671,  3806486995,   445485256, 
-   775397058,  3979628182,  3210903894,  4153186795,   695449344,  1499365712, 
-    23065511,  2526419494,  1127706280,  3778844638,  3625700765,  2790176850, 
-  3301603850,  3390353474,   303583579,  4059339602,  2033488037,  4256271169, 
-  3387644545,  3111341664,  1723589650,  2050554360,  2917082044,  2478862138, 
-  3670677047,  3735090977,  3158176504,  2397955111,  1471599417,  2198659845, 
-  1335791675,   819865523,  3043139676,   196934363,  2791674909,   257272418, 
-  1021115490,  4026693158,   367841895,  1582953139,  2443624194,  1565995091, 
-  2460095533,  2384992762,  2834378568,  3964480376,  3554029217,  1508511160, 
-  1670366370,  1352551957,   724138308,  2063911879,   179031828,  2907944294, 
-   812538047,  2389021060,  3810623446,  3422541911,  2255422833,  3610863262, 
-   592806125,  1396371812,  4209787601,  3317206559,   427984777,  3161520408, 
-  1242028577,  3711443793,  3260155319,  4091820974,  1545972312,  3104883555, 
-  1024941743,  1022387988,  2363165221,  2830995270,  1884170222,  2608025209, 
-   954815600,  2739908479,  1659944017,  1842556492,  3210468565,  2391964524, 
-   759561183,   861891716,  2257325103,   960688442,  2767431770,  2563518220, 
-  2719943774,  1035660794,  4005865975,  1823867581,  2150175013,  2097888319, 
-  2240023297,  2739797405,  1269849300,  3098825978,  3172442441,   620925863, 
-  2213021746,  2430787452,   684807399,   505783502,  2108646056,  2047977627, 
-   464272143,  2715976811,  1889125166,  3733018033,  3930073692,  3524075009, 
-  2044112570,  1309370521,  1576047956,  2047034992,    46841229,  1950643409, 
-  2304351210,  2190259549,  2059156108,  3231625757,  2412904271,  3352832666, 
-  2433153534,   532977135,   700898221,  2475029990,  3089595102,   345961173, 
-  2714871381,   414726147,  1984663513,   953184833,  1559907535,   284547384, 
-   896730376,   579046243,  1594483836,   589696740,  2520928170,  3748586013, 
-   859745901,  2473636318,  2277780827,  3383665228,  3603236116,  2536151205, 
-  4244933742,  2370910330,  1481537639,  3167047478,  1936906017,  3878864533, 
-  3884517828,  2767179497,  2486328486,  2260029379,  1398716959,  2624614805, 
-  1625486033,  3373340652,   232680497,  1707623621,  2403000817,  2780326539, 
-  3068296524,  1531938141,  3885553811,  2743327142,   306690244,  1832539015, 
-   129250188,    34318231,  1382443952,  1574789119,  1476408625,    14036364, 
-  1692340139,  2272883022,  3516866067,  1756441241,  2723957437,  3608024821, 
-  2096455372,  1039560643,  1058649428,   640039495,  2452400504,  3547520235, 
-  2728907051,  4037906161,  4057985699,  3975350106,  2556491317,  2952365482, 
-  2049065236,  2015248372,   256777047,  1832779683,  1045802840,   958876844, 
-  2548728294,  3834827024,  1114567317,  2533819780,  4259012616,   280420059, 
-   203374273,  2265326916,  3858800139,  2702753053,  3808346569,   253129348, 
-  3395101655,  3872638032,  3904571899,  1511026249,   560807695,   350425436, 
-  3105222063,   404789048,  3540140244,  3996689118,  3220099939,    20606138, 
-   505595979,  1542451676,  4103959495,  2152910741,  2781632387,  1076977097, 
-  2138737173,  2854526981,  1619821162,  3616703868,  2004439439,  3340990273, 
-  2531654973,  3670909829,  3727945960,  3005246837,  3620117618,  2376326916, 
-  1809903733,  3964655457,  4201718297,  2124876718,  3120160676,  3527662192, 
-  1544446026,  1553589409,   185410553,  2180640399,   567398936,   924939669, 
-  1720402281,   882945387,  2988817344,  2276315296,   116028293,  3818638379, 
-  2930152963,  4003329384,  2283738399,  3980309423,  3856852145,  2043171568, 
-   690636436,  3160530803,   964911626,  1394519011,  2074087448,  2420893404, 
-  3755454172,  4173816519,  2188647219,  2696707567,  3727571965,  2689373299, 
-  2895487624,  2399079148,  3038388937,  3161276522,    89556277,  1929473595, 
-  2832007234,  2828518583,  1809282135,   159150215,  3180574197,  3726541935, 
-  1651917134,  3606451007,  3808586388,  4111994695,  1274819360,    71915214, 
-  2261458078,  1312810542,  2766279586,  3544363243,  2079108076,  1586143912, 
-  4221836838,    94144684,   765688510,  2747160251,  1775898924,  2589813759, 
-  1759024192,  3215765988,  3141425261,   402786959,  4245967089,   593992195, 
-  2737737062,   198994532,  2460322229,  2400070206,  4024520493,  2844787921, 
-  2889939596,  2892076132,  3871342309,    99415642,  3828489341,  1985189114, 
-  2119114529,  3778404044,  3451891414,  4268205667,  4214330269,  3999356574, 
-  3990679386,  2504982315,  2785456071,    36214366,  2393622087,  3428662609, 
-  3745114983,  4030104369,  3978756263,  3342932869,  4246357704,  2591951565, 
-  2470059171,  4005433417,  1991188429,  1375829027,  2356716092,  2724561887, 
-  3549346240,   762898826,   949159286,  1106914760,  4101527238,  2398215692, 
-   739415353,   343780066,  2287917014,  2613590017,  3750598144,  2841510091, 
-  2276267827,  1896545299,  2112560264,  2574860005,  3751550457,  1246734402, 
-  1930339934,  1688009749,  2600394077,  2766401199,  3716885225,  2438748659, 
-  3077976849,   917105241,   738770674,  3540976060,   170731943,  3213509464, 
-  1897950012,  2831857827,  3315389685,  3598306773,  2233127828,  2755511871, 
-   285647165,  3871784095,   692679828,  3680709520,  3336155431,    51267431, 
-  1915052076,  1021909701,  2841430023,  2413672739,  1551751950,  2410433064, 
-  3833298316,  1486094454,   110472800,  2317100709,   524951374,   856031695, 
-  2394842532,  3961838792,  3654423934,  1783094643,   275919428,  1256556724, 
-  1625994343,  1244852737,  1870936249,  3101418233,   230063315,  1760348026, 
-  1598777022,  3256132191,  3055753884,  3962659419,   770535466,  1419080562, 
-  1788814600,  3943410287,   571402740,    42521150,  1949043836,   873816821, 
-  1707010885,    90655999,  3694125649,   132343370,  1782717352,   766032737, 
-    87046168,  3240704950,  1668755447,  3418462805,   967752254,  1482869106, 
-  2458425789,  1662468508,  2941240219,  1269496496,  2526878525,  2201307595, 
-   330632007,  1930291695,  2256996414,  2441385288,  1687991044,  3157147882, 
-  4028587388,  1235711990,  2366747806,  2404613980,  3467099190,  2225833178, 
-  1288873229,   502399802,  3429112764,   468547991,  3731947068,  2387552587, 
-  2553278748,  2828587753,   445686825,   205701914,  1574271647,  1136620139, 
-  1119425437,  3756204856,  4222083974,  2545703267,  2912285150,  1922532562, 
-   824397469,  2416558849,   486377771,  1690073170,  1203698413,  1552444578, 
-  2472980962,   630469293,   151770659,  2608036343,   732185163,   566287260, 
-  1119438728,  2078413788,   140314147,  3691381203,  2447647335,  1263417118, 
-   834684812,  2820809336,   102322906,  3481159322,  1537399463,   204506013, 
-   546021433,  1907956265,  2019510351,  3867315516,  2111631804,  1563826891, 
-    24795400,  3367715022,  3653171640,  1797919332,   626105930,  3733441534, 
-  2827971527,  2556259128,  2008630208,  1418576776,  1553664837,  1167022698, 
-  2083251496,  4083066030,  1285240746,     6886774,   881028869,  2747662968, 
-  1450472752,  1712948548,   902840212,   264910203,  1140653556,  1468293996, 
-   804243833,  1559758066,  2132312462,   531270208,  1617765994,  3265290993, 
-  4061719038,  2570579703,  1263026470,  2243861932,  3482440149,  3101822050, 
-  2123240533,   518115300,   651833508,  2315054727,  1928793097,  3843972246, 
-  3682030756,   177022633,  1985324556,   797353829,  2759051624,  3981333057, 
-  1595805034,  3086728970,   113840689,  2132113286,  1214855778,  2712528344, 
-  1876820026,  2710829033,  3157518537,  1474342948,  1186152535,  3385424725, 
-   668544159,  3005510258,  2320601972,  2827025428,  4154913498,  2819296907, 
-  3237089617,  3655652050,  3294124969,  2538001511,  1432541735,  2078720238, 
-  1592252615,  2518809977,  1188678784,   404805369,  2765211383,  3442796774, 
-  4248898599,   206357856,   513647349,   585670091,  2545667317,  1436022449, 
-  1967670889,  1266393855,   109552201,  2778267144,  3665597169,  2442095028, 
-   682752089,  1715343856,   888180957,   283622017,  2057883249,   587496007, 
-  3925129777,  3837234244,  1008751677,  2366056894,  1774532653,  1772231842, 
-  1549535979,  1512270779,  3849659821,  3849489403,  4027693670,  2208554929, 
-  1321344760,  1275508794,  2506993331,   938761718,  1005178777,  4148252633, 
-  3724269568,  1548131939,  2408646448,  1975139857,   264530064,   840385007, 
-   817147243,  1363159516,  2222885973,  1529316543,  1694264873,   966721104, 
-  4087742352,   586941035,  1898423875,   138264481,   469690974,   321231519, 
-      211891,  1741354035,  1342393242,   708890144,  2108027264,  1687548485, 
-  3805442454,  1925016232,  2899167471,  1127563304,    84863557,  1561558668, 
-  3273767952,  3574643582,  3035104458,  3170078453,  2568567922,  2995802703, 
-  2861008767,  3193995081,  3248419357,   802307804,  1359841054,   601264535, 
-  2101490796,  2686659099,  1694668332,   945173201,  3756545699,  2058029805, 
-  1838197421,   138610489,  2090827805,   297532831,  1673380494,  2902537001, 
-   304129688,  1282320303,  1125499546,  3390276313,  3987592409,  2031707447, 
-   482988466,  1838128643,   558548393,  3601190831,  3758698701,  3827088520, 
-  1447243485,    90103016,  3614914203,  2157818223,  1914920674,  4012515147, 
-  2317733826,  3751763647,  3457545986,  3863296407,  3013786025,   857127886, 
-  4014117485,  3092488316,   860594544,  2381419416,  1906913399,   772004930, 
-  2605137037,   994561415,  2836939003,  2564858611,   802608050,   365408022, 
-  4273312872,  3717803597,  2370420519,  2232882309,  1705970272,  1421085410, 
-  3847916722,   507892276,  1063203550,  1745465965,  2177898362,  1688793534, 
-  2695575565,  2298619094,  1985871933,  3338053676,  1157978550,  2013358236, 
-   614082689,  2176571073,  2867075734,   302967377,  1762647499,   242423810, 
-   849897841,  1256714738,  3749652689,   681076041,  3324792036,  2760772146, 
-  2080168813,  1676149829,    96119419,  3303269249,  3293814111,  3823857247, 
-  2091154525,  2838943151,  3517299708,  2874697681,  1508835268,  2826207965, 
-  1200450524,  2607668406,  4171258380,   751677966,  2131666623,   166462405, 
-  1998918161,   847900446,  2648112816,   302711426,  1711818945,  3078257741, 
-   276956484,  1882278028,  3722014694,  1602507069,  1655261645,  1299031364, 
-  4017171943,  2491286883,  3544835558,   320186889,  2305864923,    81412519, 
-  3990194960,  1520576411,  4097947505,  1283166405,   902771217,  2919713968, 
-  1768868683,  4199774116,  2705926482,   145577526,   413212043,  1115074987, 
-  1753537788,  3765249182,  2996648591,  2669099697,  1940439434,  3297063547, 
-  4214706014,  1554767796,  2809756869,  2145015519,  3716649245,   657008234, 
-  3934294608,   506965443,  1038921107,  3753966341,  1585039654,  2347032494, 
-  1398792984,  1620096886,  1458263010,  4162878257,  2834006827,  3337589054, 
-  3810063338,  2508345952,  2128752929,   203682913,   459894409,  3146442226, 
-   571544715,  3423424747,  2203102845,  1576705116,  2283630052,  2419689236, 
-  1454213374,  4261328302,  1084697160,   752820920,  3292913624,   255838870, 
-  1547311873,  4112431501,   246100285,  3098089663,  1194930898,   192713017, 
-  1643408966,  3943807104,  1257163166,   294466665,   664862507,  3954216318, 
-  1654764661,  1405033907,  2404459756,  1864068119,  3753017035,   458943330, 
-  2188502505,  2837578167,  3180423984,  3622618825,  2248002659,  2962062274, 
-  2538576443,  1414694921,  3326978756,  2534096740,  1367100663,   918951629, 
-  3578583593,  1036715512,  2331400326,  4263556013,  1927627583,   835018748, 
-  3931914007,   414906550,    14063203,   847567707,  2702788791,  3392917259, 
-  3736622244,  3259435108,  1134426843,  4218222257,  4093240909,  2452690878, 
-   348682961,  1602454277,   905998141,  1063070569,   937781073,  2454486058, 
-  3753315288,  2003200997,  2039219609,  3506946010,  3621355464,  3799456282, 
-  1764253144,   317478767,   741471913,  1521058643,  2831081701,  2941376445, 
-   864403440,   404030689,  3601955781,  2346190099,  1125489296,  2944078161, 
-  2922471368,   564483943,  2007623335,  4013727103,   903390159,  3516025674, 
-  2095419632,  3528484636,  2515838591,   787044158,  2052294221,  1055085172, 
-  1907524414,  1834546605,  2526229378,  2562555277,  3545412232,  2488671220, 
-  2073893566,    61897607,  1329221139,  2091552927,   884201005,   247201254, 
-  2514700342,  4092795525,  2234964848,   892418395,  1284581365,  3131871063, 
-   476963689,  2818170738,   111968275,  2773521413,   435281708,  2683712230, 
-   276153915,  2760865572,  2559966407,  3911200904,  3151287291,  2734982772, 
-  1462998075,  3841141927,   815069390,  1378992995,   787238713,  3341259540, 
-  2435499394,  1005853150,   369843346,  3484923021,   986314131,  1749826411, 
-  4119326132,  3563716202,   817280871,  1060361180,   150574112,  2147462923, 
-  2380756953,  1094488658,  1303011102,  3414160159,  2637427552,  1988533969, 
-   256758437,  1328765981,  3462241958,  1706864370,  3859983375,  1666242098, 
-  1587586413,   193971777,  2212514309,  3635538955,  4200093262,  2816529871, 
-  1813099288,  1902783289,  1855737723,  1512138162,  3251662863,  3363779231, 
-   210387349,  1029944161,  3324276210,   415484285,  3765303940,    73214995, 
-  3635028892,   747606592,   836098373,  2211099989,  3746542547,  1184804368, 
-   552920387,  2097614431,  2812862862,  3959291099,  3409372754,   599912004, 
-  2520997787,  1559322077,  2362817058,  1788767982,  1739480900,  1022333552, 
-  1265019197,  1171453839,  4024801380,  3708567451,  1125950510,  1595308714, 
-   707170236,   267892161,  1518084541,  2940465764,  2846566133,    48969788, 
-  3748170320,  3006827957,  1344319874,  2336631966,   545166552,  1001527379, 
-   347791768,  3981196582,   386394465,  1693777789,  3751224472,  3367441808, 
-  3694543083,  1867217735,  4289722530,  2393404853,  4110722414,  2273110327, 
-  1919891970,   732229507,   719300964,  1252331020,  2817192001,  4184753012, 
-    20393486,  3434919653,  1384782509,   457241823,  1445554913,  2103145248, 
-  3927480783,  1442025978,  2670002124,  3813370170,  2091286413,  3917306067, 
-  3149416434,  2190235889,  1670982898,  3234574172,  3630863908,  2150085001, 
-  1188000138,  1674438880,  2767351478,  4249269399,   740020531,   194226396, 
-  2673581115,  2997291421,   315109965,  3151795615,  3112118581,  3913033755, 
-  3360942304,  1633642370,  2750691545,  2179184559,  1830137882,  3152385977, 
-  2297158710,  1807100626,  3270467895,  2748291641,  3069822107,  3027979794, 
-  2303220861,  1872247083,  1426952581,   783453887,  3304568478,  2349980393, 
-  1310316156,  3289582319,   152193776,  1653430731,    85301115,  1610069374, 
-  1276206695,  4044988955,  3036515649,  3600069517,  2898046516,  1720574984, 
-  1694301926,  3684371703,  1984891155,     7682943,   121477240,  2815953085, 
-  1165318681,  3224533256,  3254015153,  3094441671,  2958919608,  3744445221, 
-  1356335976,  2226815302,  3523732859,   394094735,  1276332046,  3313806337, 
-  3714484347,  2404580073,  3478941313,  3435363352,  1574279224,  4145524892, 
-  3937446847,  1658725608,  1215939581,  1160305612,  4193585761,  2670697794, 
-  1215448636,  3696910146,  3577508906,  2285204699,  1094019009,  1774417984, 
-  2773014753,  2780578512,   167556929,  3191595517,  3498391184,  3621579479, 
-  1787377121,  1655267109,  2670889204,   337454887,  3103865044,   266236416, 
-  3956103007,  3772131594,  2543751702,  2913282799,  1998793787,  3899383175, 
-  4209990664,  2514644822,  3282618224,  2333310294,  3964400714,  1377337537, 
-  3854078864,  3441506417,   968166473,    97356449,  1992601686,  1887893254, 
-  2964126005,   400203215,  3050265265,  3638107646,    67270256,  1309401077, 
-  2284327043,  2970675089,   494916098,   823319965,   746503141,  1553175162, 
-  2368529750,   446856423,   772653809,  4204703156,  1091263911,  1581075299, 
-  2862100189,   363318906,  3421952955,   327462976,  3028606014,   706485592, 
-  3937514256,  2219207545,  2349095757,  1341097236,  2087846763,  1980088089, 
-   496589941,  2807572798,   938284830,  3538580800,  3054519977,  1128539402, 
-   274258154,  3598334860,  3496325833,  3748485976,  3357588507,  2808504416, 
-  1077901877,  2928689426,  1351393954,  1628555273,  3237634344,  1742335582, 
-  2636815038,   231959587,  2687173944,  2265308984,  2354062787,    71785797, 
-  1641140471,    94486430,   259911346,  2220429906,  2268901008,  3753961207, 
-  3805388930,   742645209,  1160450193,  1941439992,  1633476882,   261574752, 
-  3583869129,  2121400996,  3962447723,  2666794277,  3226017133,  2988581564, 
-  2625127613,   492484515,  3312069227,  4146443120,  3245023798,  1239434858, 
-  2138781493,    93060495,   148101673,  1812649764,  1220175960,   227392536, 
-  2949810485,   892042943,  3465998606,  4145246801,  2042310072,   597677639, 
-  2818394550,  1032927727,     6711001,  2407672570,  2500767746,  1438461654, 
-   329141737,  2244309434,  3854119119,   924328673,  1868866975,  3115887003, 
-  2042251095,  3131457142,  4282416942,  3169006944,  4152451978,  2556659276, 
-   236422376,  2000726618,  2286684874,  1957638254,  2068149064,   483349051, 
-  3567291471,  2000658101,  3449544957,  1314055466,  3021408193,  3147877252, 
-   924022315,  4115260415,  1949266599,  3980620819,  4045214956,  1155383332, 
-  3237244914,   172527555,  3043005441,  2194003139,  2549694589,  2444189361, 
-  3223122518,  2793488101,  3748048475,  2300459569,  1947657203,  1828803406, 
-  1332309267,  2447274759,  3420981337,   311842414,  3009263852,   606376730, 
-  3593522843,  2947003233,  4217956870,  2499200226,  1595052754,  3925250652, 
-  1704553591,  3539406798,  2808512439,  3598054629,   785061955,   127663086, 
-   335090545,  1535811405,  1287567409,  2407419421,  4102806286,   155745541, 
-    56713915,   209354168,  3426744943,   872924512,  2625543358,   504148253, 
-  3326759655,  1079693800,   722813774,  3418422852,  3503476361,  3679414347, 
-  2518473718,  3145153323,  2712054911,  2944591945,  3200427547,   275460486, 
-  1737696116,  2611554314,  1515565362,  1106632643,  1039874049,  3890329990, 
-  1275831182,  3911980916,  1632785495,   504702383,   731692145,   608133994, 
-  1656415597,  3448234407,  4073822244,  3619460486,  2244425341,  2707388385, 
-  1516225814,  3942032296,   148240834,  1796650203,   821201466,  2590677299, 
-   247519678,  2902298989,  2355998065,  3135990695,  1607585136,   706961654, 
-  1867432653,  3176400121,  2384867365,  2058025324,  2702466824,  1871897007, 
-  1514968023,   659534180,  1632648571,  2513715916,  3707434747,  3472606057, 
-  2759630636,  2783831959,  3832789533,    93892302,   231725096,  3843329099, 
-  1236757823,  1290878160,    67405033,  3430485417,  4169502434,  4292262074, 
-  1412995811,  3749570751,   321171159,  4023912109,  3142136564,  2112199921, 
-  1443161505,  3709493928,  4023049229,  3893655047,  3102639941,  1385930009, 
-  3875211279,  4254404615,  2859104611,   658818110,  3959797804,  3110196558, 
-   866122687,  3313426185,  3231485721,  3022340409,  4019688948,  1510693166, 
-   562142689,  4269929599,  3899839012,  2719697175,  4273284952,  2177366693, 
-  1540994585,  1748628535,  4225444901,  1740630072,  1757079793,  1359760608, 
-  1927294381,  3918877466,   898264501,   152805874,  4270397499,  2388793023, 
-   208516649,  1159511654,  2345624146,  2700833398,  1728655979,  2970910659, 
-   321831138,  2513261002,  3158817632,   548848962,  3747010403,  4151524440, 
-   701839829,  1403288631,  2055422031,   893209998,  2912457844,  3672565206, 
-   704811999,  1124794448,  3516183460,  1758330402,   592662265,   765559082, 
-  1085731539,  4103114603,  4156395482,   411259576,   498030627,   155443403, 
-  2244520492,  2910412598,  1481795896,  4241773632,  2237020034,  3117066281, 
-   744981119,   461482313,   660915978,   432619229,  3504103644,  2793472261, 
-  2769269715,  3434801616,  3947587393,  3943109712,  2131571133,    43827034, 
-   221332762,  1961372074,   860148956,  2379176020,   708630942,  4010308873, 
-  3514518392,  1324219238,  2552209082,  3147700511,   449238468,  1070672072, 
-   424110506,   437243633,   326823840,   280555021,  2587874155,    31540078, 
-  1598518743,   925313881,  4231941442,  2885179408,  4157519437,  3138864072, 
-  4212218458,  2818883859,   221476852,  1698341339,   430578679,  3025019161, 
-  2771085460,  3191744413,  3643367960,   728202977,  2846191061,  3941079866, 
-  1844407534,   713506037,  3904241368,  1863539380,  2307868432,  3912446738, 
-  3783960449,  1668771274,  3184653542,  3340516963,  3991449024,  2556572959, 
-  2208768792,  2338246571,   930305701,  3693415791,  3581316786,  2820575273, 
-  1874449618,  3071675829,  1026862196,  1704667772,  1302340100,   440904496, 
-  1614362313,  1296957884,  1510104030,   846701318,  2232418685,   156669424, 
-  1507370895,  4243781949,    22402579,  3841096049,  2713492596,  1180926356, 
-  1701475874,  2211010140,   103167136,  3701955201,  3682365312,  1072930351, 
-  1370633317,   730445161,  3094374496,  3293222623,   887252210,  3277905678, 
-  3037736840,  3453471630,   414222490,  3154616995,  1797572939,  3104961699, 
-  2898761938,  4028117281,   853896785,  4162634293,  3952897176,  4015398770, 
-  3909911726,  3122792549,  2304368768,  1948271262,    65066876,  1118398845, 
-  1521838080,  2466108265,  3936932588,  3196554451,  2448191224,  4104758602, 
-  1515958018,  2283219805,   659851559,  1835950617,  2849744905,  4034886096, 
-  2661020957,  3712161561,  2930297914,   563833320,  1274961737,  3465912073, 
-   398653193,  4212431026,  2191641494,   791843104,  2704122410,  4212302944, 
-  3573396793,  2451959981,  1448882380,  1864903354,   277245740,  2161921499, 
-  4209537162,  2151212113,  1495661748,  1619965510,  2682253747,  1617332761, 
-   385842876,  3479793961,     9682862,  1571765702,   849764095,  3392979260, 
-  3451300493,  3745423172,  1186197528,  3913825286,  2991930000,  2010750847, 
-  2690472989,  4169869242,   930063190,  2960080546,  2356173666,  4179805657, 
-  2325798283,  3313418282,  3863238644,  3956077957,  1732118681,  1559964723, 
-  3618410968,   117604305,  1554903813,  3923318061,  2383759714,  3419783191, 
-  1588149873,  1277964143,  2705676537,  4195614379,  3001312347,   891174066, 
-  2335405240,  1177595411,   757711067,  1458979012,  2978475955,   418977436, 
-  3709171844,  1319514762,  1030533605,  1377940685,  1238820097,  3942679605, 
-  1114098033,   261832302,  1147995283,  4226165699,  2938800031,   296072189, 
-  4089659578,  3791431823,  1668560680,  2247371041,  3147116212,  1754561725, 
-  1893756265,  2638591337,   712790657,  3349958239,  1803210297,  2784649251, 
-  1629280732,  3965769520,  4012735007,  2142570383,  2929658310,  3045926344, 
-  1722163110,  3760522608,   379587281,  3510272490,    50813060,  3446113378, 
-  2685452552,  2510212398,  2478703264,  1309810608,  2522401486,  1700285669, 
-   999163958,  2626345584,  4213234379,   422849324,  1927536687,  2537506784, 
-  4208050980,  2360227923,  2150871407,  4083331601,  2317377066,  2953485083, 
-  2479411089,  2547267806,  4163681791,   605587577,  3607297469,   581236761, 
-  2396564518,  2076173946,  1924862597,  1107847812,    67847699,  1458072931, 
-  3318727873,  1073389189,  1423742946,  4130646429,   307824828,   984982409, 
-  3331527132,  1971780948,   951052068,  3071057510,  4173447399,  1708016892, 
-    35727489,  3672679259,  1553509614,  1438233795,  2203903929,  2767488169, 
-  2432617549,  3749006092,  3240656572,  3422295764,  1824061812,  4206540576, 
-  4233939329,  3319874571,  2072751152,  2310173907,  2500828304,  2435674053, 
-  1008105551,   319639064,  1370748780,  1011201881,   447174109,  1768375582, 
-   218376410,  3031026172,  3361612836,  2010704305,  2676383292,  2987943268, 
-  3465024910,   789098610,  2989632808,  3569080154,  1217107813,    89108291, 
-  1866208293,  2049795770,  2315537685,  4068743545,  3956293873,  3836850975, 
-  1971215869,   860913647,   715513525,  3653666495,  1163335865,  3977696592, 
-  2083094284,   981107631,   244298082,  4033056415,  3384576309,  4211203736, 
-  1609248403,  1798296052,  1609413725,  4184435501,  1730287655,  1323535720, 
-   823712243,    48564123,  1456161775,  3278232329,  4040533425,  3021870443, 
-  2261838521,  1231856600,   356597007,  4230910213,   924105240,  2961154809, 
-  4170492308,  2581531594,  1333250171,   619214930,   801568342,   651282166, 
-  3698158445,  2186806062,  3330984675,  3495754344,  1447851777,  4113573806, 
-  3092147624,  4169798518,  2273802671,  2637225182,    69145495,  2433479146, 
-   453714724,  4215847458,  3846212012,  2832692845,  2712649809,  1383973794, 
-   946929817,   434785114,  3056838058,   177031459,  3379817759,   220850376, 
-  1766323703,  3822009479,  3679480158,  1890609468,  1405550077,  1554351791, 
-  3826522005,  1376091120,  1169804257,   614224027,  4140430174,    44757635, 
-  2787768648,  1427295646,   249239522,   856257961,  1135691710,  2516822699, 
-  3232327249,  2581343190,  4080870973,  3572645452,  2470260219,  3365164149, 
-  1616596035,  2359020236,   406723157,  2523084961,  2071519856,  1532719111, 
-  4138120178,  4188683526,  3439654640,  1871655280,  3924006352,  1092049192, 
-  1241604270,   805309636,  3771526783,  1374532928,    90551464,  4172002208, 
-  3806566691,  2535210384,   168417216,  3166873965,  2024618234,  3370594335, 
-  1682400689,   194261210,  3609468865,  2183378581,  3613639800,   259474474, 
-   178242062,  3396613822,   696889306,  3258643533,  4001868149,  1532031130, 
-  3200262062,  3289110607,   618958757,  2460471441,  3602633741,  2107153358, 
-  2881373420,  1724218952,  3290466596,   333104145,  2295247705,  3543740199, 
-  1042750036,  2049037127,  2181822101,  1197263546,  2495598293,  3716977102, 
-   313087204,  4088446978,  1998613040,  3312601455,  2878097284,  2655065141, 
-  2945495624,  4061767243,   246229157,   149159959,  3014934213,  2350936446, 
-  3795552868,  2497644924,  3648596074,  4030916745,  1222454884,   362576900, 
-  2556483554,  1026587911,  1537922180,  2368262184,   952053592,  4182490416, 
-  1977951023,  1356157215,  3587063932,  3972109573,   670953942,  2050433094, 
-   945537214,  3586884690,  3884087719,  1270363069,   231597262,  4102896206, 
-  3292390928,  1169586793,  2985241169,   631720146,  2665145120,  3843322231, 
-  4016055875,   114454685,   985742782,    38387647,  1833544518,  2351549424, 
-   462284279,  2388571632,   881661678,  1332691094,  3298846473,   350772557, 
-  3322206988,  1834622451,   925698691,  1223114873,  2739607997,  3526223592, 
-  3262692966,  3392322112,   132875725,  1739453389,  1706953443,  1667802773, 
-  2327889897,     2050004,  1840139363,  2525236816,  2349668607,  3136114355, 
-  1800400151,   511503837,  2745197853,  3097030275,   934771442,  1610284679, 
-  2444790737,  1986547091,   452731858,  3777164063,  3060026013,  1708866718, 
-  2762038515,  4043395865,  3670947718,  4199172175,  1379230039,   127547614, 
-    69872068,  1484555969,  3698345532,  2576397201,  4271070423,  3057536977, 
-   830536694,  1593460367,  2200251000,  4199662048,  2521034768,  1203551240, 
-  2317536025,  3356264106,   922814208,  2145729274,   810435371,  3084602356, 
-  3806340615,  1060505455,   600435799,  2648206428,  3911306340,   524813290, 
-  1453579591,  4185480305,   777156828,  2778147916,  4133806026,  2311377820, 
-  3457043041,  2047221003,   177300377,  4029989592,  1146287203,   179064306, 
-   611275034,   232106735,  1448047320,  4140234161,  3548185425,  2986261542, 
-   976635274,  1297997404,  2260279429,  2209770811,  3544783222,   651713704, 
-  2611004660,  3886064695,  1466480800,  1105017513,  3972343242,  2441328895, 
-  4007207023,    81162557,  3935232176,  3940888405,  3612168481,  1498242539, 
-  1240894392,   206858877,  2293835539,   834847232,  1688680932,  1115253882, 
-  2117241156,  4240415556,   460291894,   486571263,  3918481617,  3882985509, 
-  2927384295,  1717601997,  2619136670,  3769615584,  3567750253,  1785321821, 
-  2526307913,   989545826,  1881422579,  3082787592,  1562382953,   798206688, 
-   152393690,  4061047603,  4075992204,   113185684,  2899537074,  4227412556, 
-  2382138120,  3212226369,   333763062,   599571605,  2862200393,  3159417893, 
-  1128851738,  3518347291,  3571840225,  2657212351,  2739898944,  4065545392, 
-  1394216189,  3645491550,  4128882886,  3246480915,  1670253214,  2148934487, 
-  1980311302,  3883726529,  2223885042,  2727806184,  2687869281,  2345205144, 
-  1406757880,   294486553,     1341281,  1018141930,  3324762035,  3884917864, 
-  1407651376,  2522786698,  1000541406,  3215035902,  4042587041,  1442270047, 
-  3180586690,  3101343774,  1010986581,  1614092478,  1306474218,  1662995058, 
-  2392030284,  2963398581,  3599322100,  2195502719,  3626507240,  2240704183, 
-  2617208037,   707763287,  1212558751,   133875805,  2593442870,  2691469564, 
-  1862522493,   802895127,  2382593001,   337654346,  3071414114,  1621418698, 
-   606606089,  2511788162,  1652929701,  1048739844,  1417994833,  2232334013, 
-  1437090472,  3668816032,   351234958,   134104027,  3814746303,   908191094, 
-  3715766446,  1026514796,  2218830043,  3817876838,  1910114323,   403793847, 
-  1416273149,   571519047,  1873153210,  3872648064,  3354114661,  3220443683, 
-  1253137167,  3910504304,  2007159831,   433690818,  1619689736,  1420647400, 
-  1185576772,  1128136703,  2361211282,    67880136,   641690708,  2623386855, 
-  1949119912,  3107408696,  1561138002,  3603701378,  3846620293,  2906517095, 
-   473944485,  1109535172,   285583520,  1861885430,  1644768363,  3777932493, 
-  3694153789,   721836398,  2511664933,   191550341,   434607873,  2503312681, 
-   881519779,  3898820719,  3625131092,  3778818234,   723055580,  3370589995, 
-   664664019,  2283364892,   234849234,  1890720502,  1900809146,  2563780640, 
-   113462054,  2576982297,  3853175741,  1104574116,  1098462393,  2711387496, 
-  1465693067,  2297951175,  4025672584,  3889572915,  3568352106,  1972083649, 
-   620953447,  3606696885,  2341350483,  2743561799,  3805913425,   749796565, 
-   930384033,   622157392,  2527626067,  2182522180,  2045330690,  1934372730, 
-  1456278789,  2070928023,   277468862,   330220320,  2953252949,   890776687, 
-  2529302545,   181431478,  2718123193,  4200049742,  2633368366,  1044939001, 
-   538603557,  1219579899,  1099005911,  2396852452,   446119790,  4284781460, 
-  4143775482,  3872621028,  3166270143,  1736971524,   471932221,  2946081227, 
-   924360563,  1270894737,  1318790505,   559977105,  1731323553,  1087095161, 
-  4285498249,  1009869999,  1945771443,   970062144,  1222550322,  2526246359, 
-  3711507128,  3658041075,  1732724216,  2827811352,  3899843311,  3845035395, 
-  3959996925,  1018460876,  1870886391,  2867628400,  1194201996,   535235948, 
-    47854913,   303392918,  4100723271,  1764288943,   604523601,   271443830, 
-   784142533,  1128477891,  3105349992,  2165361184,  4133400304,  1466122828, 
-  3113696231,   998353424,  2953471338,  2015231138,   751191116,  3422523043, 
-    11713936,  3459657211,   848615725,   722661284,  1543357280,  3110159853, 
-   789757336,  1828514965,  2856826435,  3080200828,  1965211467,  3488959917, 
-   395618697,  3380751255,  1709734683,  2203263358,  2762660510,  3273288271, 
-   425738239,   915204920,  1540652287,  1265356742,  3657264365,  2834478536, 
-   254328989,  3351293845,  2683963990,  2648861813,   129403293,  4041347411, 
-   715092224,   775320914,  4160920740,  1018041111,  2109168310,  1188762316, 
-  3032891242,   811684429,  3660428003,  2620931455,  2389234341,   547367413, 
-  2279214697,  2894547019,  2895495422,  3498558796,  1213090509,  4028722192, 
-  3697784344,  2089167225,  1032986011,  2235587694,  3859027602,  1369870532, 
-    63099301,  2142466881,  1212944745,  3940022394,  2352907954,  2440530477, 
-  3502080701,  2240876528,   616832783,  3379251874,    63783332,  1657838339, 
-   419347276,   206600722,   879383533,  3867550833,  4264878227,  2256772096, 
-  2466119652,  4020055056,   583227065,  3164897292,  1656236046,  3332402830, 
-  2582509813,  1576349886,   984093457,  1727645382,   635765791,  1390439224, 
-  2599048832,  3839198353,  3113946619,  1186969351,   563986881,  2170985370, 
-    33231038,   413837681,  3263169487,   464257001,  2136813394,  1981868381, 
-  1191824080,  3897997885,  2688297248,  1020076890,  2789813324,  2274556676, 
-  3725261670,  4087008954,  2049367763,  3867685122,  2971636571,  2102450323, 
-  3894031845,  1562908085,  1919087548,   863278014,   550935804,  1782568493, 
-  1336588123,   161418925,  1181528961,  1189320244,   937173739,   953567487, 
-   586546610,  1674386618,  3456369668,  3994351449,  2937055107,  4108522969, 
-  2166775392,    27582546,  3147315497,   386426694,  1007240956,   387895513, 
-   322259851,  2125431527,  3581424731,  2153771283,   199556110,   738161488, 
-  1584768787,  3949965303,   260742039,  3512141001,  1275785221,  1050368056, 
-   258173096,  1277716502,  1845538759,  1891705347,  1907645307,    82902409, 
-  1383687089,  3853894157,  1792040101,  3375468514,  1401810827,  4146113203, 
-   226775039,  2423450971,  3833722005,  3548571367,  3659039312,   934716093, 
-  2522801204,  2278776812,  2605869476,    84369614,  1880675207,  2803981622, 
-  3826365455,  4152945197,  2252371044,  3343422197,  3018320252,  1329428187, 
-  3682843016,   296728027,  1213598597,  1973192745,  3834394838,  1346522836, 
-  1303290336,   144520875,  2990827414,   757692194,  1879484602,  2579293113, 
-  2899183696,  3851206334,  1285326552,   425640908,  2293492128,  1718341840, 
-  4066792583,  2421722396,  1059034597,  2654179092,  3881951376,  2614290540, 
-  3364098430,  2884107112,  1214127246,  2007698954,   885106855,  1729706678, 
-  1708956702,  3678235702,  2833841605,  2479955168,  1109637403,  1811358865, 
-   441144794,   851699594,  1018769915,   115718386,  3588138746,  3429409411, 
-  1734552237,  1790316967,  1211129022,  3450039974,  2610296796,  2344845470, 
-  3402949081,  2652760931,  2351610500,    50516238,  1220475958,  2319809912, 
-  1576549983,  2893184850,  2018715535,  3636721605,  1253791067,  2448758915, 
-  1548201340,  4040145578,  2938185755,   219665811,  4181233919,  1549393140, 
-  2279059019,  1527442584,  2728425667,  2853242745,  3089113514,  4126139140, 
-  2488475342,  1224348081,   197067183,   834247809,  1073543330,  1423868894, 
-  3548839168,   941583659,  1353548080,  2429557173,   306181902,  2300182244, 
-  3447014077,   170871806,  3687302169,  1260076896,  1520536698,   335294354, 
-  1213836935,   652603444,  1733656903,  2881868502,  1203556008,  3759577909, 
-   642009823,  1199378081,  4268785086,  1591056325,  3111113792,  2858064928, 
-  3766140436,  3089482938,  1581176817,  1472956455,  3731596350,  4208732635, 
-   962092716,   430462741,   785742333,  3190634366,  3746675372,  1188116625, 
-   581160054,  3985142659,   130874926,    27672422,  3830866987,  1628939570, 
-  3931405933,   219631638,  4049016062,  2967981155,   375123461,  1774577180, 
-  4235693690,  3346681259,  4172368080,  3947046631,  1901632627,  3954942529, 
-  3217634450,  2764082770,  3139206540,  1784412993,  1589304637,  2434343381, 
-   907311383,  2826985145,  2019815668,  2385338620,  3012196051,  3837245808, 
-  3872588839,  2791986114,  2482559421,  2862990984,  2726255887,  2875430981, 
-   501725759,   990549438,  2374356888,     2109853,  2620555651,  1804743150, 
-  2175234094,  2174503232,  4219681129,  1676701565,   641084431,    30468130, 
-  1812750748,  2706309576,  2795640946,  2922862663,   756152086,   100275718, 
-  1402329264,  1895822308,  2819844817,  3387469555,   394392943,   520717629, 
-  1105812497,  2909366712,  1522242669,  3489422471,  2571211354,   560587170, 
-  3108310532,   825041387,  1088887210,  1509417773,  3847309684,  2365936086, 
-  2838246673,  3462789568,  4249073626,   418066577,   635969285,   705169352, 
-   472757359,  4092360937,  2259114787,  1170525192,  2160075289,  2948641294, 
-  3485288179,   215764663,   448764886,  4159946768,  3032919908,  3189704835, 
-  1873881585,   754762482,   801960918,  1840413261,  1815466379,  3684603047, 
-  3793944759,   425953850,   818664350,  4230794662,   562174630,   921434029, 
-  1805385182,  3202125526,   849502833,  1348916753,  2674668017,  2436399550, 
-  2556961424,  1957842517,  2905196202,  2777129513,  3256653131,  4167289514, 
-  2193569315,  3133882374,  4048388172,  3941797376,  2309452930,   375861830, 
-   707310236,   403829440,  3280635212,  4044481493,  3696898916,  2930323669, 
-   526485111,  1293183825,   190828390,  1719571221,  1583681607,  3636371188, 
-  1359450056,  3015545028,  3434563414,  3074560745,  2600156170,  3558975781, 
-  1280255410,  1540247884,  4047457305,  1230314017,  2818730797,  3275211559, 
-  1879981606,  3892693370,  2974459736,  3625030903,  2705605462,  2567370731, 
-  2700354790,  1599210272,  3765514867,   334451168,  2202010838,   890143543, 
-   696345925,  1396336631,  1318762592,  4252878092,  1583140229,  2989838708, 
-  1228322910,  1716046609,   857701857,  1982912514,  4255141399,  4197003213, 
-  2634679534,   753891722,  2779656251,   195114317,   900036256,  2982864291, 
-  1171407834,  1891310257,  2225588650,  4003970820,  3651852861,  3207096534, 
-  2583971310,   113884290,  2239686251,  2244079979,  4064710213,   962628613, 
-  1464808581,   999271622,   227582304,  2406919740,   710552453,  4106913355, 
-   934649596,  2988068167,   101193087,   480641526,  1655689778,  2826465639, 
-   389212002,  4026855941,  1497449168,  3925854521,  3424426379,  3877132249, 
-   828127110,  1167326972,   106210184,   511849320,   495201652,  1116325058, 
-  1760300546,  2862982755,  3784642973,  2163514656,   898130703,  4049208029, 
-  4031287581,  2709828801,  2949758685,   699639617,  3645657011,   866865294, 
-  4080374798,  4055301933,  3808904393,  4132907339,  4170686999,  3027253734, 
-  2014960739,  3055866088,  3333024724,  3003069634,   213624677,  3167649274, 
-  4269104176,  2863590773,  2841591668,  2923010937,   989077425,   230044462, 
-   658458519,  1686470221,  2358380687,  3571432046,  1980562622,  3218903917, 
-  1384438857,   682092814,  4291825824,  3589728392,  2276171039,  2204913466, 
-  4223396133,  2067765181,  1229263104,  2009125270,   700151236,   880124307, 
-  2629232666,  3408839412,  3201316826,   515616593,  2983029085,   672820890, 
-  2667359458,  3661802679,  2780939068,  3183412824,   396920665,   516494729, 
-   605862613,  3639661419,  2276361414,  3533854495,  1666169453,  1055894947, 
-  3286107927,   197275368,  2367939136,  1345061335,  3562311865,  2284894453, 
-  1446817483,  2934189412,  2890982521,  1149006057,     7157354,  1128177178, 
-  1940349799,  3794667473,  2883349622,  3801311067,  2868957945,   361408308, 
-  4225536514,  4282441847,  3646929773,   438908824,  1805952065,  1629627086, 
-   985991817,  1612610215,  1103967764,  1591547642,  3995794982,  1009352727, 
-  3290246274,  3024883091,  4095268924,  3422572455,  2350842342,  2879826540, 
-  4203434736,  3084820399,  3109912605,  1364361417,  4045736139,  1055531818, 
-  3188479341,   789731715,  2624825339,   842886378,  1958604150,  3730051135, 
-  3932721919,   256273991,  1720091772,  2710412965,  3664545616,   953989294, 
-   373299411,  2070133347,  2226166805,  1855276659,  2221767263,  2406096944, 
-   958548616,  2373989296,  2000229872,  2977235804,  1085701222,  3593775525, 
-  1482198757,  3281591921,  1176254360,   318116614,  3332060020,  1711543478, 
-  2883583257,   126452507,  1733050759,   138395263,  1901793169,  4207036618, 
-  3329013558,  3818994215,  1035595729,  1634677809,  3720779350,  1496459185, 
-  3383855877,   563182131,   411439632,  3587890145,  1177365702,  3705018389, 
-  3297119986,  2377473675,  2876446209,   301337445,  3744150836,  2793760793, 
-  1429766244,   903365836,  3725017307,  4174784548,   369679350,  3263689996, 
-  2527895397,  2929128117,  3582758769,  2090339633,  2846680959,  3856055559, 
-  1143917783,   716411141,  1315323711,    94249028,   633572941,  1500610705, 
-  1296181356,  1613063102,  2025712361,  1281836821,  3833124279,   433407742, 
-  1602039756,  1898876105,  2637273353,  3126993203,  1095768152,  3509089185, 
-  3783334148,    71025544,  1192425730,   735397154,  3965004440,  1067775120, 
-  2624861421,  3725426699,  2089014146,   260074074,  3630144442,  1809398343, 
-   860529269,   547793003,  1248232738,  2908915566,  3888017240,  2242612391, 
-  1609878691,  2270804134,  1089424925,  1116369645,  1687277056,  3298650740, 
-  3486393417,  1698928020,  2366984403,  3802564023,  4020819569,  2187429069, 
-  1141490153,  4044779719,  1388025493,  1224477249,   804395090,  2907671304, 
-  1577630512,  1698015750,   867397738,  1711526592,  2330043411,  1627133899, 
-  1497292620,  4023124262,  4110730681,  2496333001,   150323227,  3931557309, 
-  1845307204,  3902734374,  2499694792,  1036557792,  1403166304,  2893733189, 
-  3652476127,  1218201443,   539786805,  4089700570,  3106464396,  2797885957, 
-  2447207671,  1270338807,  1846548106,  1753791141,  3907160679,  3497625915, 
-  1276533926,  2595184689,   384902641,  4161144399,   361049723,  2756000060, 
-   644003117,  2909720911,  4284358438,  1186576227,  1265319592,  1188409783, 
-  2892820847,  3087098176,  2139272139,  2812858283,  4240047525,  3927671193, 
-   801218529,   501551480,  3302516343,  3948411489,  2550615840,  1422360562, 
-  1853445097,  4294040725,  4285339906,  1359622734,  2517433225,  2343233267, 
-   201223027,  2280840292,   393266492,  1702933901,  1945536973,   617486705, 
-  1688910570,  3763346413,  1246127248,  1392935950,  2302692297,   371043670, 
-  3945747522,  1124237767,  1309693066,  1449848800,  4079470312,  1939010452, 
-  2161567835,  3911311678,  1877826733,  1594807501,   442926875,  1906104932, 
-  2434901954,   132964498,  1583359035,  2582812562,  2313823338,  3263505500, 
-  3975496620,  1781269489,   716398131,    92579934,  1128363186,  2350565416, 
-  1889218758,   665020135,  2019201892,   971140586,  3089177191,   202426593, 
-  3431790111,  1164714273,   950109607,  1066320517,   251780984,  1894035484, 
-   835520750,  1914163419,  2824211757,  4205954214,   952345014,   347143019, 
-  1703936780,  1428032666,  1550172689,  1178564559,  2277447700,  2210756524, 
-  3431241330,  1572040644,  1816844589,  1985280117,  2706845891,  1247141175, 
-  3867544479,  2093239206,  2268188780,  1574795631,  2507495911,  2363591380, 
-   520793729,   434350111,  3267067386,    19017174,   835677938,  2235516919, 
-  3175395757,  1755819643,  2226648873,  1802202141,    48949683,  3232603985, 
-  2021230967,  3216985427,   917109811,  3003403425,  1617382350,   330455031, 
-   477507193,  2453912513,  4037628846,   192468246,  4139726559,  2016974726, 
-  2745243390,  1749282675,  1066067550,  3025472830,  3553082389,   952110327, 
-  3730718445,  2432853804,  3002404771,  1462595970,  1891077572,  1585859040, 
-   628436628,  1551202305,  2855837672,  3047267525,  2998810077,  2130071936, 
-  2357788908,  1109020106,  1295852094,  1679801597,  2985446048,  1168583519, 
-  1864366934,   725529603,  2623346546,  1115354463,  3246667506,  2521726518, 
-   619617776,   513786032,  3765557741,  2074031747,  4257818958,  3620255790, 
-  2425201422,   680442645,  2400705816,  3695400118,   375128906,  1222628923, 
-  3159887992,  2823470748,  3578526887,   335300139,   687738127,  2378758189, 
-  3065054889,   843919690,  1891254930,  3491884637,  3581962226,  3438868914, 
-  1373079208,   940249299,   656410461,  1713120250,  1900944709,  1507798419, 
-  3749999113,  1642095467,  2352792295,  2378726405,   715577982,  1108882858, 
-  2200382984,  2909342312,  3269699620,  2673958912,  2229539036,  2532270389, 
-  2426694261,  2356830212,  3052999531,   600583995,  4290421676,  3868702612, 
-  4087734073,  3448697914,  2338405418,  1229205358,   235895709,  3923648530, 
-  1313403404,  1729133856,   235781226,  3489275414,  4284187630,  2101733592, 
-  3286747248,  3234414242,  2911812754,  3488295962,  1598657358,  3299635825, 
-  4045608775,  1510319170,  1794246235,  2169129087,  3413012603,  1425327281, 
-   898184868,  2830257172,  3475189610,  4154405351,  1533884947,   478403267, 
-  1088167588,  3548385978,  3513304812,   943717381,  2111547679,  1953606241, 
-  2264907110,   366819817,   521220868,  1678192411,  3965328614,  1477943662, 
-  1562907290,  3250078280,   184560072,  2972084425,  1889264737,  2599121537, 
-  1692642052,  2279174540,    68861425,  1431073641,  3342094666,  3491263305, 
-   260121956,  1623035459,  3539659082,  2266098911,  1335340526,  3200505903, 
-  2411696429,  1200346734,  1974145146,   905426096,  2329950478,  3619919379, 
-  1905181339,  1423388635,   437924185,  3246410106,   570539738,  2664753663, 
-   485036053,   261059398,  2791210730,  4287549093,  3060198497,  2547283169, 
-  4142436515,  3064293952,  4269982256,  2077564951,  3327400843,  1580148235, 
-  1706416897,  2559501581,  2797670369,   302847739,  3758946010,   515405377, 
-  1704278176,  3849784115,  4266223751,   112352691,  1677494577,  1144492327, 
-   346670654,  2434822755,  3529188181,    56102073,   531897583,  1057222515, 
-    36381814,  2933707603,    84623874,    12398444,   414184836,  2093707147, 
-   499477186,  4110120176,  2362178817,   904445493,   988430718,  4211339391, 
-  4123585066,  4204385533,  3383571347,  2475386563,  4193952084,  3446640686, 
-  4262121486,   346828735,  2997249160,  1975916878,  3881238813,  2131865725, 
-  3087878552,  1629908890,    99466171,   987208461,  1023840202,  2170411308, 
-  1826584001,  3535565480,  2432167770,   211387004,  4288041270,  4048374470, 
-  4232102523,  3672062527,   164213389,  2432890025,  2970755000,  2785770347, 
-  3115284376,  1311736842,  2368870422,  2779536356,  1776777492,   953352106, 
-  3686169863,  1351660651,   338313583,  2362540813,  3204603396,  2517661523, 
-  1348893828,  1306518523,   738938251,  2491537367,  1991320798,  1241664306, 
-  1880114176,  1911980480,   591943212,   682102555,  2210682356,   997209254, 
-  2503273115,  4117297687,  1346822821,  2793182792,  2241993548,  1693807491, 
-  1748924741,  2696919831,   813156194,  1386765184,  3735965705,  3291915047, 
-  1806660421,  3371814411,   365328440,  1641747281,  3619285385,  2151809529, 
-  2751725716,   581165257,  1754058800,   437061529,  3516490389,  2465971674, 
-   168539061,  1327249564,  1417623235,  2927048640,  1953704701,  2315372364, 
-  2961882229,  3474865540,  2524779191,    82291999,  2361300103,  4117183343, 
-  2763521838,  3916820470,  2321885017,  2260491162,  2809548537,  1817050433, 
-  2044875775,    53779114,  4176086797,   907394975,   962272199,  2272954534, 
-  4131468589,  1196814446,  1437773887,  4187119145,  3296571133,  1404298600, 
-  3254234373,  1630511232,  2207311375,  3432482157,  3545196591,  3180183051, 
-  1418909020,   103446679,  3213776405,   690250327,  3267569552,  1681941299, 
-  3381985843,   958243574,   653115132,   779077295,  1749513339,  2052950114, 
-   740812351,   310980335,   193084876,    98613114,   732405616,  1812127979, 
-  1311318226,  3337589993,  4008016933,  3578990555,   601174454,  4183342307, 
-   646669637,   497491304,  2513661280,    75183436,  1533741158,  2928523899, 
-  1932315506,  2186097952,  1559523069,  2805849986,  3010462899,   461653776, 
-  2926653376,  1136676976,  2536841653,  2361354989,  3224583143,  1015409619, 
-  2366102686,   294060490,  2838614195,  3972911491,   536685760,  3911567415, 
-  1447446954,  2637262071,  1144673719,   875561546,  3672061468,  3075653189, 
-   395585982,  1555391019,  3666837591,  3331412217,  3042482689,   613788860, 
-  3596724352,  1747255301,  2882665629,  3521177863,  3215119449,  4009266404, 
-  1650414429,   849089097,  1656459946,  2884184415,  1092124989,   138528498, 
-  3709770462,  2830033290,  2801035430,  3015157619,  4120255942,   616390514, 
-  4078197346,   248873827,  1113249594,  1394553153,   331589577,  3813885527, 
-   530322779,  2390497782,  1081150351,  2542176295,   708825763,  2610998228, 
-  2325243300,  3611699245,  4219269266,  2738744295,  1274537084,  4163249245, 
-  2133316470,   899421925,  1395378324,  1654966753,  3122988652,  3914419035, 
-  4237884975,  2909836258,  1121738101,   395359251,  3839031537,  4246845674, 
-  3471652599,   302857406,  3570167403,  3175710379,  1674887366,  2179263760, 
-  3526767039,  3573631495,   482581332,  2887355920,    14024175,  2031946336, 
-  1473344610,  3013854715,  3119134133,  2110145889,   266478349,  3826161804, 
-  2053286239,  3113820628,  4022913069,  4007821527,  1112834204,  1015637918, 
-   493103837,  2223935638,   961813968,   316379722,   637641869,  2863359826, 
-  1830680533,   135007288,  3206160107,   434580256,  2008774211,  4094571888, 
-  2643530538,  3572586884,  3083240061,  1469134093,  2635384141,  2012251505, 
-  2876002603,  2670932338,   102048341,  3408767145,  1434008596,  1423479879, 
-   565999579,  1600983341,  1887422847,   294174555,   123396396,  3783528046, 
-  2998701926,   533635800,  3995134203,  4255935903,  2011320117,  1235036288, 
-    95976873,  3546504999,  3051695180,  4196934995,  2829362990,  3579773022, 
-  3299877421,  3220646307,   597577245,  3055036919,   476990766,  1488426726, 
-   347440184,   985234876,  2040421558,  1329513104,   771669665,  1170602988, 
-  1774758364,  1459369411,  3880422170,  3532973166,   646759427,  3952851081, 
-   795182572,  2533305580,  2628269559,  3434368052,  3963733290,  2715834394, 
-  1342272298,  3356142715,   583718855,   817061376,   493822993,  3414670633, 
-  3665024100,  2675161083,  2474188924,  3559729243,  1760545131,  3954205849, 
-  3514108927,  4006444937,   210356038,  3083578462,   494970239,  1068695193, 
-  1860913799,  3389031837,  2704021864,   402772698,  2595873814,  2501788178, 
-   353161501,  2481866186,  1182756747,  2804108602,  2569981746,  2321705975, 
-   740161986,  2838365040,  3612603855,   546810195,   819816398,  3987557374, 
-  1697541320,   762068366,   249327283,  2217903941,  2532974788,  2315661133, 
-  2153643503,  1278119836,  3701858778,  3370786740,  2691068511,  3817706930, 
-  4220644004,  3297350814,  2870215318,   733053366,  4130842571,   445249631, 
-   902019507,  2930048897,  1781604181,  1394514105,  2034113079,  2629567776, 
-  1470544627,  3726058708,  3098269479,  2069780746,   827456330,  2173271965, 
-   959498582,  2682624728,  3052896033,  1610615335,  4238105858,  4187055708, 
-   308593117,  3583527673,  2449811141,   485388952,   745327543,    99849334, 
-   457940539,   269253189,  2229082746,   839882715,  4294063927,  2847522929, 
-  3130112605,  2142543445,  3193157187,  4031283544,  1569840917,  1553509045, 
-  2677244995,  2387973414,  3431297896,  3848274659,   774901019,  3381860802, 
-  1804223384,  2452254447,  2350756614,  2831075342,  3033432268,  2591853790, 
-  2649343259,  2767391429,  3759425819,  3946862334,  3595032028,  1849199654, 
-  2978119443,  3623515903,  1822306676,  1169870870,  4080179279,   540513498, 
-  1855971398,  1026959300,  4247732580,  2769150599,   794941024,   779557952, 
-  3891625812,   708458218,   163316030,  2574769282,   107411173,  1508007303, 
-   759836859,   672213390,  3029715659,  3035196027,  1227744646,  2442247427, 
-   954643341,  1309231316,  3801539770,    55550624,  1361749717,   750000765, 
-  2329570795,  1281659226,  2244452036,  2118071308,   839643665,  1438016021, 
-  1356458046,   958919704,  1255372183,  2118213246,  1890934561,   397248615, 
-   889029703,  3772314323,  1895459295,   668221672,  3601329260,  4176560701, 
-   970377147,  2006302139,  3212138276,  3182865228,  1622628057,   722368198, 
-  2917691300,  4205721622,  2785775243,  3453008060,  2664897874,  2292900753, 
-  1446467186,   766644618,  4042716794,  2421376377,  2175187165,   352362443, 
-  3282158063,  2667044459,  2881716089,  2323341470,  3877815081,  4209217501, 
-   317836763,  4200310700,  2922294224,  2006603327,  2735537388,  3566197679, 
-  2217573488,  1183813692,    11143511,   537830269,  2743009553,   379082409, 
-  1640924505,  3374532956,  4249841015,  1007565772,  1061546519,   363262026, 
-   121846111,  2550008014,   874249905,  2819575807,  1789291684,  2930281339, 
-  4268575011,  1479907152,  3769201023,   993579048,   609507084,   228163077, 
-   361512202,  3439573936,  3127608046,  2401655380,  3311211015,  2481694380, 
-   247633100,  1798352020,  1349948900,   492072393,  2717742601,  3683281971, 
-  3025275751,   852345800,  3167720682,   660328153,   789955061,  2682693304, 
-  2691106655,  2472028891,  3203032675,  2321810942,  3009299282,  2108553522, 
-  2861550692,  3900550680,  3238877688,   157588619,  4150118198,  2433664982, 
-  2512132871,  3489271520,  3358855283,   984994003,  4012562566,  2683325366, 
-   210131215,  2618124922,   617054118,  3111361221,  3228602269,  1203966910, 
-  1082418748,  4201092162,  3827826779,  2932751358,  3800757265,  2848212560, 
-  3869821123,  3830411008,  2075252781,  2615548781,  3188356010,   204492941, 
-   895906002,  2442375211,  1617627366,   788983752,   738604861,  3076177442, 
-  2848373338,   753097754,   500612011,  1960540747,   298444645,  3802650513, 
-  3196521607,  3794935284,    77571894,  1502141198,  2619276627,   488179660, 
-  1165662217,   668898025,  2506189105,  2691230302,   707024437,  1889839006, 
-  1669541838,   170428864,  1392407223,   792701417,  3950416926,  1198333160, 
-  1554741964,   591177465,  3039225500,   995705583,   230793349,  1319770901, 
-  1979359375,  1393385069,  2453218883,  4080350198,  2232872891,  2310750328, 
-  2726852113,  2574575900,  2073832821,  3680683912,   381950742,  1388625151, 
-   908362193,   904716116,  2619723522,  3545029305,   750789143,   630749455, 
-  2503324422,   690769669,  3091352695,  3971578385,  3890012082,  1232079696, 
-  4053149701,  1977482077,  2334881062,   500646606,  3981737316,  2031766722, 
-  1823785284,  3740987246,   420862234,  3065014647,   974128584,  3925274174, 
-  2223408936,  3856323102,  3745652403,  1171291148,  3707785562,  4080359674, 
-  4005953254,  2606653463,  3649181110,  2315554615,  4218313115,  2003947282, 
-   391975185,  4048723194,   434789550,   623877336,  1159923388,  3376641281, 
-  2092363877,    16601345,  1288378178,  2712441423,  1274696086,  3215118679, 
-  1512873183,  2058284890,   495444598,  3997119798,   593512272,  2758664437, 
-  2276892509,   274519858,  2377689786,   869039717,   340100335,  3186189895, 
-     5236690,  2195257477,  4168253594,  1283931211,  2371049975,  2974958046, 
-   862607689,  1406361210,  1853783653,  2661344478,  4153088757,  2587606559, 
-  2714291216,  3109863152,  1541216166,    36312193,  2073743939,  1283371507, 
-  2836795401,  1227014390,  3720615461,  3319285684,  3133342449,  4219237205, 
-  2581787601,  3189652172,   429737791,  3397570833,  2087038504,  2902475414, 
-  1899820585,  2558053805,  2794779014,  1516557833,  3437666590,  3860270274, 
-  4201228021,   548003484,  1943616184,  4293960974,  3602272904,  1852213729, 
-  1195854984,   963947066,   448622957,  2097498899,  1072354352,  1307918145, 
-  2667374190,  2583594820,   786914042,  3911293959,  1625606454,   285054893, 
-  1198462194,   887250927,  4265140732,  2078050175,  3447175491,  3829610637, 
-   828879635,  1750040392,  1519254878,  1497891557,    50793505,  2125508050, 
-  2043265669,    90441792,  2281244271,  1919080308,  1661726886,   457893420, 
-  2794671243,  2145742817,  1154622865,  1464072207,  1175115484,  3197190806, 
-  1420734127,  4253186539,  1196013748,  1091779315,  1283178409,   333955038, 
-   617858057,  2947817534,  3947573124,  1451627471,  3397442685,  1779250401, 
-  4283878407,   998776788,   355971524,  3894906852,   216008927,  2208732962, 
-  3304780495,  2408651406,  3097295623,  4131190805,   555735192,   813696283, 
-   863943687,   664904541,   571345163,     3131315,  2293639924,  1288738013, 
-  2467610497,  1157164449,    97324689,  1033069419,   472831117,   231417477, 
-  1362286340,   570232443,   141438399,  1190247281,  2835510966,  2950728523, 
-  2282822712,    19792511,  3514698869,  2322720902,  1292669285,  2879476981, 
-  2942200628,  2006006531,  3785604899,  3290744202,   598964317,  1579719360, 
-  3693190653,  2586611719,  3403275788,   190777125,  3948966912,  4066529518, 
-  1790483916,  1284662978,  3769884485,  3692127265,  1391166550,  3148134691, 
-   660198846,  4262830491,  2546588734,   283385013,   607392002,   672040953, 
-  3855514009,   223329498,  3835924717,   724037620,  2734559009,  1587011615, 
-   793107415,  1227589309,  1423637390,  1468545883,   991685430,  2197895258, 
-  1949308810,  1207045681,  1686441172,   567740510,  1974062418,  1515614782, 
-   920553565,  2468405785,  1392132844,  1216006615,  2322905380,  3229618734, 
-  3514568028,  3087395488,  4202575792,  1333777942,  4224498896,  1406577402, 
-  3926648568,  1220279640,  1490476427,   804825808,  1456482871,  2196052265, 
-  2231149699,  3435826804,  1273068558,  2363264224,  2870321607,  2373470287, 
-  2201186736,  1860433124,   523671246,  3737105507,  3122703953,  1764674071, 
-  4268171289,  3288868268,  3877679458,  2115522067,    36180580,  2459898536, 
-  1807985560,  2406952385,  3770280222,   181339080,  2975049212,  2208592786, 
-  2924988261,  1846792929,   690166963,  3142827584,  1304173096,  3900572277, 
-  4010628841,  3760085445,   483151536,   699784881,  3294721858,  3704525333, 
-   518494135,   454739535,  2040792618,  1033566285,  2311961495,  2941205380, 
-   380519676,  2363423205,   821381154,  2501873176,   429257092,   196302792, 
-   916445326,  3342973320,  2088656880,  3917864579,  3100215850,  2141595062, 
-  2969997905,  1911063607,  2387631895,   679047023,  1730491724,  3887225753, 
-  1549439324,  3822774864,  4169678793,  2777380632,  2068235502,  4172615546, 
-   797725160,  2106149745,  3855395655,  3230186315,  3371199311,    24347334, 
-  1966181364,   607261468,  2544346248,  1601024645,  1394354134,  3235088384, 
-  1975313036,  3911260054,  3715855708,  2787082155,   215905838,  1531666127, 
-  3746718035,   108267849,   126185971,   626768723,  3193871702,  1795272406, 
-  1115817662,  4051658115,  1078195412,   899791809,   743661850,  3769779877, 
-  3309118496,  3577305092,  1633956629,   633725668,  2760190549,  1721256214, 
-  4241815577,  2159574113,  3577583286,  4162819833,  2297950622,  2691610450, 
-  1357740197,  1543344558,  1403651210,  1216777867,  1486547359,   794478731, 
-  2484905285,  1696503246,  2106003227,  2447021035,  2140655694,   262799931, 
-  4016934420,  3932786119,  2394899478,  3287348005,   668311765,  2002049695, 
-  1821548009,  4164089130,  1201609730,  3674944592,  1810972562,  3983950732, 
-   961811677,  3227949290,    17956108,  3951340520,  3270337731,  4052666224, 
-  1245381588,  1383417918,  2187752588,  2724671426,   939591439,  2022755221, 
-   827061423,  1724459102,  2260757000,  1683992170,  3419190682,   688930164, 
-   205585761,  3961239641,  2236331142,  2374451198,  1885813572,   906429615, 
-   670858251,  2097213299,  3802224707,  1285310841,  3950899814,  4238929575, 
-  3133936140,  1237407741,   844543644,   755684629,  2753619582,  3222315900, 
-  4101826078,  1579792566,  3136818843,  2474607727,   497667821,  1746486534, 
-  1195172454,   888416140,  2095949791,  2448912688,  1464631797,   558879401, 
-  3889791517,  3297996226,  1129189763,   712568526,  1836300435,   261275382, 
-  4109470267,  1370531685,   809815135,  4026549296,  1796366375,  3274943248, 
-  3316306174,  2639910245,  3493406910,  3211735334,   131133874,  1079466466, 
-  2158487696,   896808378,  4032373961,  3286609633,  1289526880,  1210631862, 
-   563763670,   359009343,   974081717,  2597787186,  1434793860,  1664077096, 
-  2364665819,  1736140394,  4222187167,   493496676,  3470169251,  2411012589, 
-    20807184,  1151680850,  3811369982,   436426306,  2104515189,  1055195170, 
-   106187711,  2466791491,  3281038279,  3436706392,  1197871753,  2039453766, 
-  2516420245,   480192090,  1434022063,  1900507534,   918856240,  3397988273, 
-  1391694535,  3393114293,  1195398782,  1686460141,   210654590,  2888581770, 
-   718828705,  4189295953,  4043004535,  1706716977,  1148839657,  1744563353, 
-  3159161467,  2917568187,   562187916,    88839922,    66027691,   922449626, 
-  3326476022,  2953677470,  1699535613,  4268271604,  3674116499,  2355235043, 
-  2645202621,  1417679111,  2098551575,  2219983495,  3298257833,  1650992701, 
-  2913214273,  2552338690,  3058918089,  3846007412,   635825328,  2873881201, 
-   931156960,  1368870830,  2132061812,   637395050,   531306780,  1982617994, 
-  2206060593,  2053432492,   260330258,  3522497349,  1116988588,  1579614851, 
-   345828195,  3420867442,  1105524881,   578757085,  4164616051,  4008178843, 
-  1128782096,  1190526222,  1519712902,   422503053,   618057469,  1681126143, 
-  1170582362,   409413062,  2981043143,   179083516,  2679971185,  1358878375, 
-  3496620408,  1980699362,   350310299,  2392433825,   482268378,  3095484306, 
-  4018322305,  2226258796,  2143964286,   219530209,  2983546506,   612276713, 
-   492316202,  3577544632,  3949248208,  2550128766,  1347965716,  3171595312, 
-  3501341457,  1098993413,  3884834643,  2000578197,  1047166202,  2088716734, 
-  2965927019,    82528511,   503986687,   639512492,  2770945759,  1136080664, 
-  3438078634,   548440760,  1408236928,  3818765334,   137916041,  4100863231, 
-  3062172443,  3862586714,  2621060643,  2277837642,  3191160139,  3712913179, 
-  3039548280,  1397908155,   274208857,   411950871,  3330211777,  1813272046, 
-  2009251171,  1131687694,  1848383906,   705113574,  2799668382,  3955940979, 
-   657871706,  3364874358,  3201156526,  4231505743,   752810539,   142186100, 
-   750079044,  2249097705,  2530145618,  3729537714,  3363742222,  2537640904, 
-  3650449853,  2772878241,  2365835435,  1429720384,  1168868247,   125519034, 
-  1562956254,   609600257,   274615755,   595115051,  2356583657,  3977118289, 
-  3911685669,  3926774734,  2240424382,  1316502032,   158769162,  1182188168, 
-  1929116960,  3220547906,  2346483912,  3976534145,  2449090167,  2592213604, 
-  4119867056,  2617520008,  2370198366,   757732900,  2286261099,   969060152, 
-  2959641864,  3377416308,  3476203899,  1776542350,  1939377091,  2936395667, 
-  2193865610,  3775140457,  3872507799,  3737512909,  2762788163,  3130275710, 
-  1399282566,  2013784733,   413007780,  1613813047,  1686790409,  1676308614, 
-  4233916706,  1427011106,  4123878575,  2979093352,  1629025876,  2437556427, 
-  2724720340,  3813204700,  1958954732,  3811269035,  4071670277,  4017149140, 
-  3022230762,  3787768524,  1364711450,  2245303129,  3491435758,  2069668018, 
-  2445535125,  4138750152,  3555972970,  2288143772,  3645492291,  3914602494, 
-  2089877244,  2281796225,  2037791996,  3584988824,  3860172239,  3537820930, 
-  4161153018,  2164947619,  3372780766,  2565668289,  4103470489,  1972562873, 
-  1376820441,    81828432,  1690880767,  4259074741,  2791670128,   430445652, 
-  3374261126,   991568706,  4165775340,   106305372,  1960261325,  1080670581, 
-  1198895048,  4237422750,  1689270112,   869089320,    86703347,  2258606349, 
-  2271210826,  3753857155,  2646926462,  3113188141,  3037910707,  3972782996, 
-  3056884071,  3816624143,  2220904541,  3878639137,   643791769,  3574684144, 
-  2961287941,  3461558450,  2302525218,  3351239183,  4105707065,  1076291113, 
-  2383065961,  3934554204,  1769502842,  3704514805,  1317965564,  2581509990, 
-  3249464768,  1013316130,    95001434,  4037454024,  2267794790,  1495136404, 
-  4242482811,   443955823,  1793280833,  2926735501,  2341423546,  3121511202, 
-  3310198243,  1311355944,  3376815701,  3814518182,  2132411273,  2304792454, 
-  4224453184,  2986558446,   438814131,  3912827259,  3334511230,  4283259673, 
-  1498187435,  3063187416,  3996908065,  2911344276,  3619985386,  4239340028, 
-  1053446265,  3372355950,   972730380,   412362627,  2410517100,    41191403, 
-   756925831,  3396786115,  2326592169,  1199750255,  2780227331,  3559165487, 
-  1466351655,  4003184418,  2250875554,  1260954760,  1261208465,  2090670783, 
-  4260340802,   329016576,   888993581,  3074434283,  3420253770,   465626149, 
-  2072744437,   497800017,  1956787752,  1080899919,  2068399989,  3400560112, 
-  3746249704,  2547618900,  2371409553,  2887076326,  1814191143,   724231351, 
-  3980420753,  4249717874,  3655455662,  1924089020,  3315727908,  2381388592, 
-   694345647,  4233074724,   388111382,  1554772151,  3591427077,  2692776515, 
-  2319550629,   116425274,  1280581794,  1646087753,   200798599,  2101499436, 
-   487023963,  3006488462,   714082023,  2176129297,  2711704203,   116248957, 
-  4157839312,   656943433,  1559315821,  2640281822,  2348516353,  1472833768, 
-  3846639500,  2694209763,  3768517270,  3928597755,  1320888151,  3920944424, 
-  3172093710,  1594798369,  2228289829,   620050550,  1845705869,  2921812349, 
-  3076229459,  2767088291,   249426137,  2676238734,  2002067594,  1200087220, 
-  2084051944,  2624872890,  3556888684,   255137568,  4120270727,  1212090960, 
-  4021898908,  2256081570,  4196844759,  3937910651,  3972304601,  2239382413, 
-  3048259355,  1487429994,   169891806,   264327193,  2545918100,  1791835853, 
-  3318537303,  3280386512,   840441988,  2747676198,   852351266,  3747627632, 
-   319052633,  2016040900,  3598996987,  2858744135,   180703266,  1566579060, 
-  3297907812,  1454559228,  2484523362,  2150646665,  1962390832,  2747600600, 
-  1012349988,  4281670516,  2957864983,  3257183542,   381959232,  1945515938, 
-  2538582970,  3682022080,  2766046519,   289971258,  1802579963,  2822871614, 
-   649230797,  3734153267,  3307917145,  1566419083,  4284574967,  1389128325, 
-   709663094,  1144536076,   619340236,   117366493,   154264780,   582950785, 
-  2323169284,  1624467142,   340140962,  3429768560,  2219439112,  1109457160, 
-  3216576642,  1833230360,  3068236962,  1721071708,  2120329461,    31773143, 
-  3610055371,  2654513477,  1383656422,   174652926,  2728373899,  2385485642, 
-  3472466947,  3152371210,  2130719934,   332353037,   148495613,   819260191, 
-  3977568801,  1584414560,  2134517719,   284002653,  1345139810,   935474788, 
-  3791514014,  2575692194,  2072720653,  2028294608,  1603793152,  3018571903, 
-  1214889457,  3687497190,  2347568498,  4154364390,  3735341890,  1993111545, 
-  2071637946,  4095461853,   839247973,  3189921332,   544991775,  3648103626, 
-   809757909,   661150660,  2183067463,   754138918,  3674458578,  2272362935, 
-  1247562352,  1763620117,   273678262,  2612178853,   743376724,   151435255, 
-  2918751714,  3221048328,    50473114,  2937370806,  3526759824,  1738857172, 
-  2986929440,   248750828,  3326910162,  1841065392,  3648723806,  2496144657, 
-  2001051275,  2664476973,  1322230921,  3902117127,  2884209940,   356365727, 
-  3564220829,  3016885384,   563030767,  4208733532,   321489301,   935567605, 
-   475800900,  2191317846,  2542211128,   362463924,  1828531785,  1119068910, 
-  3967139368,  1894372289,   287725379,  1615040283,  3679611145,  3283864395, 
-  4250571373,  1045416492,  1103513940,  2664556706,  1149994159,  1082809829, 
-  1545293868,   607304236,  1006083535,  2941349059,  2774367597,  3869403542, 
-  4036870288,  3785403155,   145823332,  2674187740,  1294306443,  3128552859, 
-  2362558357,  3705693639,  3357590511,   508951299,  2873081500,  3043274647, 
-  1752077478,  1742432512,  1957538505,  1618918052,   765091898,   766753025, 
-  3752298141,  2164811383,    87125888,   532066926,  1624932941,  2912832341, 
-  4139046258,  2867479943,  2211902784,  2780800177,   632222663,  3042195360, 
-  1176548126,  2126705551,  4130061915,  1013006077,   125002242,  4106379492, 
-   203767634,   660867519,  3549015901,  1269026823,  2512216204,   754055064, 
-   982190050,   602039437,    49576645,  1031084806,  3079555346,  3620190475, 
-  3404128154,  1455366204,   876053072,  3412838261,  2999835490,  2664985365, 
-  3813421780,   356503329,   812909201,   429174537,   774429290,  1565280979, 
-  2935817366,  3530625275,   661779189,  1437907554,  1940413587,  3640878054, 
-  2773176078,  2699055283,  3314529069,  2401295150,  1808918393,  1281472053, 
-  4067528505,   947826343,  2724160457,  3779244991,   758152626,  3584274654, 
-  3107876227,  2963682693,  1676311994,  1752261399,   861971824,    47566501, 
-  3223845205,  3416951145,  2878703729,   225984859,  4188380555,  4174272743, 
-   463873297,  1603929565,  2150920167,  1039819380,  1079011541,  2667842184, 
-   658435426,  2864334025,  3157178632,  3236745516,  3437605987,  3160502246, 
-  2579649133,  2897276998,  4083404164,  1787657536,  2509122502,  3244915527, 
-  1321877183,  3460817715,  2966901615,   364122213,  2253921649,  1203613292, 
-  3797479382,  3936075546,  1170732157,  1416737348,  3352483797,  3796625603, 
-  2138282305,  3141163611,    15997228,  1297880640,   596832063,  3643046261, 
-  3120129338,  2325928525,   523016654,  2381603908,  3799113523,  1222543757, 
-  3361990312,  2805038520,  2347330065,  2230477579,  3394448156,   177671803, 
-  3588077445,   755495138,  1517460104,  1251348528,   682498523,  1345938207, 
-  3028880448,  1574604645,   643845875,  3664357575,  4031963432,  4200683359, 
-  3643989882,   511900407,   980633776,   870511652,  3578062369,  1212340081, 
-   906361602,  2804758153,    61880755,  4292946801,  2089964810,  2030050481, 
-  1840899707,   867949713,   946726928,   562520096,  3191918461,  1167767867, 
-  3057764821,  3495866685,   922113089,  4114694540,   737902763,   355551525, 
-  2243276211,  2901985477,  2678890918,  2599807441,  3926983675,  1684736989, 
-  4198645384,   947332272,   139872942,  1471119933,  2533455386,  1369950405, 
-  1451992806,  3089360563,  2939285075,   541633331,   938727523,   423776510, 
-  2808128078,   586899274,  3696575452,  1621047444,  3807579860,  1452100927, 
-  3124351060,   218057846,   495446257,  3502877749,  4100144223,  3713354988, 
-  2414783332,   643478261,  2432426332,  2277346920,  2269676601,  1632676202, 
-  4235276929,  3588696161,  3856888696,    30142383,  2205486506,   429174739, 
-  1371599451,  4236099395,  4094951423,  3999688151,  1426570093,   611039932, 
-  3569536606,  1091958157,  3528449919,  1403233112,  2382293827,  2417820607, 
-   227034275,  3416052661,  1661710798,   661013906,   545968717,  1758750608, 
-  2463587077,  1875022056,   434936682,  2688535264,  2784876435,  4069452989, 
-   641282433,  4275086294,  1255271152,  1248037691,    87814717,   651080983, 
-   481433064,  1903017470,  3727850229,   421623164,  2908494743,  1958693555, 
-  2289018218,  2428158170,  2966648543,   841073738,  3592242466,   201363367, 
-  1962656610,  4240726183,  2351724879,   282972604,  3423229453,  3962143192, 
-   464140915,  3952705443,   124642129,  1810048807,  2638444494,  2698103550, 
-  1867426988,  2799437267,     4135144,  2955755796,  3832529204,  3207404309, 
-   541898922,  1442428181,  3551529170,  4179174038,  3891321220,  1464168133, 
-  3391413135,  2622391160,   537739930,   776459724,  1317008935,  2635748987, 
-  4053640879,  3460846943,  3000129650,   587990416,   495409766,   807846766, 
-   418925487,   274948238,  2010346799,  3826769485,  4164115386,   882135598, 
-   933550430,  1653517636,  4196829665,   946352104,    80866595,   618453894, 
-  4146093629,  1325747600,   197054796,   386623299,   149843113,  3412795930, 
-  2999487580,   230452210,  2429369374,  2883958854,   497571784,  3576149563, 
-  2252269389,  3919891925,  2909747244,  2153670272,  1170328805,  1143222828, 
-  1997134908,  1150313486,  1854227844,  4026078065,  1828414448,  3248451067, 
-  4124522542,  1290608950,  3481754372,  2412494019,  1296411240,  3027272348, 
-  2342491743,  3847073824,  4135533405,   321493421,  4190536265,  3619601750, 
-  3388770929,  3160400353,  3687751957,  1167634256,  1902550505,  1873992334, 
-  3759717847,  3213212374,  2445162396,   221020753,   533695449,  2775761058, 
-  2854211309,  1584197265,  2480546675,   425594695,  1136793499,   238094769, 
-  3350517708,  4253046309,  1328749306,   194004358,  3754481882,  1785889189, 
-   494130791,  3008493071,  3590828152,  2314315515,  1180937358,  3462973905, 
-  3049286595,     3948136,  3491383506,  4266628748,  3272230423,   108533379, 
-  1378593768,  2670486781,  2070102186,  2696217500,   911298870,  1078017659, 
-    12901094,  3787827642,  3688496300,  1212136156,   628434025,  1261405780, 
-   271703989,   524245772,  2197066219,  3244959869,  1887915084,  2875825909, 
-  2482153750,  2112647088,  4202873856,   925454909,  1455807555,  1218071863, 
-  1362605131,  3363685363,  1463640294,  3672639110,   654966893,  1448058852, 
-  3938389649,  1253768665,  1914988782,   772200871,  4131213167,  1909221553, 
-   206614789,  4264719645,   236485817,  4084287148,  3314905090,  3755411648, 
-   676632103,  2532501888,  4275885085,  3658517363,   425615357,   602934262, 
-  1956024667,   460611777,  4035431772,  2633123204,  1938738252,  1883319355, 
-  2832098041,   884189530,  2081408232,  2445456502,  4215852099,  2882745928, 
-  3985090099,  4202977301,    32459739,  2255342584,  3086827318,  3042375014, 
-  3874305609,   118067981,   863202821,  2900464577,  1728573182,  1722844467, 
-  1814231805,    28624892,  3161617545,  3151183959,  3283768216,  3123510444, 
-   605262933,   591984300,  1033405596,  3617733144,  1709517125,  3382700353, 
-   359675016,   302003813,  3305985073,   450161633,  3564906935,  2347440271, 
-  2281878569,  2413658924,  1106721264,   152078019,  1141090709,  2846227135, 
-   629859650,  2536209463,  2637135672,   755468053,  3242706820,  2748599625, 
-   542618152,  3691848157,  3832512964,  3625109208,  3317129913,  1255694435, 
-  1007645013,  2875173034,  3414806068,   352784783,   464249984,   743651193, 
-  2743258772,   201620562,  2744314056,  2468585228,  1735297255,  2627357574, 
-   615289585,  3550774033,  3260834107,  1169423787,  1464349699,  3160775612, 
-  2089632903,  2689541001,   458431986,  3231605395,  2958608764,  1392192548, 
-   512443411,  1633745733,  3593422217,  3070178896,  3063601273,  3718648316, 
-  2059200915,  3401374821,  3181189815,  3554168599,  3485006773,  1700004218, 
-   695250905,  3286151945,  2376232595,  3707052570,  1341567785,  1884427362, 
-  1373269901,  4184388936,  3857035811,  3908860835,  1476390320,  4288540981, 
-   891684624,  1715316827,  4279803560,  4257092602,   978121063,  2795008526, 
-  2228053336,  2820897326,  1186743962,  3812148280,  2876786178,   828135213, 
-  1064551364,  2529768177,    97292177,  1526535668,  2895749156,  3359698555, 
-   862193760,  2271890791,  3370552772,  2839716094,  3826729835,  3242635093, 
-   515070459,  2653937110,   177385904,  2403130528,  1120505592,  1393960514, 
-  1723328106,  3041845811,  1620050142,  2739217498,  1890863869,   353642478, 
-   993858693,  2216442630,   967355584,  2681160943,  2036747334,   332367843, 
-  1267277493,  1494825420,  1243139709,  4158811179,  3132493850,   833002646, 
-   934685652,   290486306,    56536114,  3802562147,  1855639785,   880758271, 
-   901871607,  3193482534,  2243757339,  3622640266,  3683571219,  1190455968, 
-   533030785,   435598850,   881196698,  2204599703,  3357972135,  4229217479, 
-  3254772538,  2688831529,  2657010794,  1607232508,  2217154803,  2246636999, 
-  3419481628,  2148754477,  2436898848,   967517242,  3759229936,  3202764261, 
-    41562598,    71666820,  2761083499,  2686584275,   343735536,   796430878, 
-   710619262,  2808130450,  1605823713,  1745744190,  1011986994,  3979843543, 
-  2224293517,  2688398418,  1394629523,  2582715113,  2124747055,  1262321501, 
-  4228445180,  4133772077,   591582341,  1759001410,   660039537,  3256439755, 
-  3337955896,  3992001188,   526079332,  1258493241,  3052872740,  1258108447, 
-  2229362902,  2585368541,  1071420700,   952926931,  2238535533,   239828374, 
-   882765648,  3801324461,  3776981681,  1215204556,   389558287,  1563531656, 
-    40987241,  3521978414,  2374686255,   440076856,  1532863469,  1018771130, 
-   599949072,  3909823043,  1562754491,  3620773082,  2371134703,  1900873019, 
-  2141348246,  3095274538,  3455679039,  2322973759,  2658743697,  3253045895, 
-  3960340797,  3676128972,  1632229246,  1950192755,   458492417,  1978882094, 
-  1008527080,   876095021,  2434443399,  2140187281,   171706337,    70678448, 
-   148011215,  1952654014,  1527097033,  3252855985,  1622725642,  1735069628, 
-   202751234,  2340271294,  1295899197,   234555967,  3927720675,  2050727898, 
-   336036036,  2179941381,  3604785521,   201589774,   119665719,  4223771519, 
-   301333505,  1684680876,  2362489409,  2166802943,  1035021309,  1074120246, 
-  3162036157,    24888119,    38984105,  1458392530,  2805088390,   407680477, 
-  3058159131,  2827656233,   932712750,  3978623565,  3681776236,   661416555, 
-  4103067783,   580997924,   274822529,  2020566200,   576366389,  2392479788, 
-  3749112782,  2238409614,   303976447,   321877606,  2174437690,   490565860, 
-  1761373319,  2327482249,   619349908,  1264030889,  3996836257,  1658977437, 
-  2915458691,   642246446,    44268955,  3397990247,   966209018,  3838572398, 
-  1178964412,  4214139862,  3748834543,  3462925639,   131920978,  1667919959, 
-  4290681595,  2348018960,  3964034763,  2398569806,  3039885261,  4194206532, 
-  3466892066,   638208989,  4049974204,   993895522,  1538865211,  2411161440, 
-  4039878920,  1810893530,  2063891536,  4015728155,  1498510938,   333410094, 
-  3657535120,  2629811916,   621345869,  3371679352,  1520363735,  1654259954, 
-  2080656341,  2150334421,  3767375157,  1852214765,   102862724,   437464171, 
-   594579819,  3741988613,  2037010022,  3126874363,  1860251484,  1519608210, 
-  3388754348,   501570461,  1825865628,  3283159057,  3964932520,  1450168132, 
-  3502200594,  3190777728,  1626480583,  3709421918,  3404537598,   841507093, 
-  1497981565,  3171382460,  2553573914,   539601440,   636520685,  2607068141, 
-  1785861599,  2317260784,  2011249928,  1640818796,  1263567890,   433925534, 
-  2548730897,  3392896499,  3366978463,  1477983217,   114805941,  1926906274, 
-   502447086,  1676067047,  4293014815,   440255078,  2997203862,  1910233671, 
-  1298946738,  4233667680,  1957900192,  2289370031,  2700157335,  3199442894, 
-   375383680,   847343187,  1730038885,  3098968270,  1719745154,  3323117781, 
-  1128438177,  4174289271,  2619084673,  1040055615,  2639984000,  2047597960, 
-  2444716104,  3680469249,  1384289495,  2751335136,  3774393720,  1221940723, 
-  1197793826,  4017357699,  4064549170,  3128484955,  3075673549,  1267800159, 
-  1591938835,  2403186451,   954513200,  1503596877,  3805953979,  3843402673, 
-  1663284919,  2950994342,   770299692,  2597321102,  2343097653,   426462407, 
-   538288979,  3934337918,  1176786217,  2641405614,  2860201990,  2927873192, 
-  4092617407,  1910131505,   418750627,  1704973464,  2940419689,   782292003, 
-  3853956343,   205980237,  2877128937,   348044784,  2437371638,  1568212422, 
-   317171160,  3358678458,   394476748,  2311113367,  1836718110,  4197276594, 
-  3887298454,  1607251275,  1428322120,  1997154648,  4063405934,  3105205364, 
-   909707545,  1865558846,  2534892911,  3372944806,  1421067633,    18390196, 
-  3240282549,  2295529414,  1454367152,   584252641,   927514300,   236264458, 
-   425666054,  1639728578,  1255553540,  2594557364,  3454933504,  3696531306, 
-   282606485,   757206554,  3753922295,  1685381600,  1984242810,  3364873889, 
-   890947088,  1122565180,  3890598779,  3462633621,  1151230134,  3590618841, 
-   837330114,  2015750705,   399514338,  2558742648,  4070824207,  4000712030, 
-  3893459939,  1790745303,  2049370346,  1506694517,  3311103341,   658366210, 
-  4184201498,  4172409201,  2805894169,  1004555008,  2557620879,  4044721959, 
-  1746217655,  1825967437,   200423406,  2441311076,  2970516165,   827428405, 
-  3717501695,  2009138188,  1322767286,  2327227896,  3941566135,  2721323241, 
-  2899713745,  1369267631,  1558151294,  3081769237,  1765783618,  3393246336, 
-  4140931791,  1903903701,  4004599081,  1404695629,  3628471988,  2536500042, 
-  2139795265,  2112531871,  2482525138,   786586753,  1940069818,  2908958838, 
-  1561851405,  2487023212,  2046210082,  3874101837,  1940814075,  2003991993, 
-  3134352879,  2618304183,  3012371093,  1233656355,  3345475989,  2899732248, 
-  1417089712,  2712362615,   606822605,  1180111248,  4145058311,  2916049523, 
-   424676823,  3804033320,  1642831330,  3962679519,  1957865322,  1449421781, 
-  3927500681,  4241127340,  1374876378,   508477919,  3872829373,  2166228287, 
-  3100033314,  2582563910,  2675778485,  3519476081,  2687157800,  3506734957, 
-  4117162527,  3726173728,  2362045798,  3083376779,  1882413881,  3476777697, 
-  3631284867,  2981196168,  2384917905,  3309069948,  1883847653,  1939462629, 
-   325583953,   455513743,  1989359873,  3477393950,  4094002704,  2183246162, 
-  1058465634,  1719425242,  2372197263,  1175621807,  1249271443,  1165856520, 
-   643698765,  2682063159,   325705131,  3043213236,  1492336351,   581358052, 
-  1945966319,  2791746089,   547105503,  1184554607,   235280346,   879973831, 
-  1825493211,  2800779257,  4113200388,  3996362816,  1479067202,   957336137, 
-  1717719629,  3916624632,  1773561382,    65293695,  4205418605,  3066771584, 
-    81239760,  2301680097,   784349379,  2321479690,  2754003084,  3373516224, 
-   273439524,  1626251299,  2700497390,  2576487881,  3602376489,  1129314795, 
-  2689176250,  3940215388,  4047625229,  1869304357,   282060264,  2699077086, 
-  3855137869,   190415859,   391877786,  3061050572,   578160013,  3908697641, 
-  3985631699,  3261255406,  2657026857,  1036961866,   404779710,  2303580527, 
-   474049461,  4090196268,  2103081388,  3612293516,   762851623,  3796945341, 
-   192020585,  3449551219,  3813775718,  1511270125,  3168109964,  3852586914, 
-  2867163910,   325171386,  3017916514,  2462602349,  2650947494,  1300542838, 
-    16559445,  4152518297,  3347180287,  3459883462,  3275867034,  1190868188, 
-  1051373259,  3561095326,  2995944263,  4154285194,  3395811951,  2135586162, 
-  1080447608,  3377836442,  2526036073,  1368857579,  3855430530,  1529622592, 
-  2186830787,  2273754678,  3234674558,  1760540049,   267100789,  2705516449, 
-   569713173,  1997270543,  1762330487,  4237660160,   876437978,   384311785, 
-  1451447972,   947114401,  1480026678,  2872716914,  1363877522,   368679058, 
-   457894344,  3522574967,  1927388899,  1615248633,  3157409771,  1081157582, 
-  1985070290,  3814227328,  1170785760,  1761144369,  3747009538,   827183444, 
-   322865858,   271320731,    48853205,  1789482524,  3780673545,  2398962315, 
-  2617130435,  2027098304,  3789321053,  2594595210,  1291432256,  2987705261, 
-  1452655197,  2790110915,   908858822,   199957044,  4188082398,  3938490889, 
-  2218177967,   439384508,  3823989312,   117764431,  4106989717,   924942160, 
-  3210051782,  4113250965,  4191866528,  4016544080,  1792347725,  3944417847, 
-  1806991732,  3704699106,   631583861,  2258787948,  3640073174,  1491339336, 
-  4147219047,  1770900887,  3236328320,  1070048606,  3295491283,  2559757188, 
-  2993822812,   673373717,  2177299044,   347508239,  2890119952,  1118728717, 
-  2417835709,  2151631901,   910618052,  1138193705,     6401226,   695957358, 
-  4149835859,  3560104503,  1798094000,  2738355364,  1471088341,   249794890, 
-   541482619,  4224660497,  3451969264,  4092010499,   209927180,  1042913322, 
-  1549494111,  1835598582,  1690755570,  1729157758,  3129478695,  4040921980, 
-   356987483,   454555191,   645517146,   820225297,  3680398375,   939139214, 
-  1735468741,  3113744697,  2053937208,   793874707,  3062511595,  3386339513, 
-  2580136100,  2045869832,   464734262,  1024397156,   996234690,  4245925097, 
-  2823376710,  3917489660,   754830180,  2585179295,  1653820026,  3744309672, 
-   718435847,  2106493842,  3484773407,  1333109354,  1506284542,  3796148844, 
-   775622208,  1547457092,  2994971880,     7682896,  1387670368,  2028676436, 
-   136321307,  3346498863,   736946291,  1273521433,  4125835926,   834346335, 
-  1590790769,   798327267,  3296504845,  1799765576,  4129690966,  4137869587, 
-  1434053555,  2911134536,  1703461407,  1142276590,  3035367672,  1671065772, 
-  2848757103,  2810433468,  4170252862,   321968749,  2048355870,  2348580948, 
-  3408462865,  1644172479,  3468337314,    17773538,   433785119,  3810126310, 
-  1301903545,  3353455459,  1476226613,  4275788483,  3154786914,  1470817047, 
-  2339709500,  3699717735,    89319325,  4029830551,  2797038428,  4235558775, 
-  2660619449,   739866491,  1523313346,  1754164860,   656162706,  3755724112, 
-  2791994910,   650868612,  1726521483,  3680427334,  3007447057,  2533503620, 
-  3423944165,  1759610451,  3594691882,  2507291905,   748987663,  2839460898, 
-  2621716418,  3425093151,  3546193211,  3842886799,  4201461247,   515587915, 
-  2581471711,  1504775512,  2135852448,  3062421929,  2259528299,  3532703425, 
-  4196879163,  1812562847,   907799293,  1298792606,   278466343,  3917372905, 
-  1087663164,  2938691312,   846821016,  2504234369,  1536154943,  2124437298, 
-  4278656507,  1047215931,  2594038458,   920122700,  3392363390,  1075474434, 
-  2539944450,   365353276,  1334260223,   358982152,   430180316,  2624306457, 
-  3180356019,  2898317889,  2842200794,  1946092311,  3717325314,  3837544294, 
-  1858256068,   586112658,  3241236271,  3131642194,  3244678401,  2434191051, 
-   682033211,  2543407756,  4290264995,  2298530562,   159123385,  3393378652, 
-  3409838375,  2607992561,  3295931756,  1217467410,  3139950448,   857001992, 
-  3919809124,  2895189152,   191423932,  3264733051,  2916906700,   690671997, 
-  2047008709,  1204075524,  3017615537,   645907368,  1407478697,  2318635932, 
-  1429180207,  4042035625,   848598735,  3092527302,  2206393691,  1319522514, 
-  2504272548,  1251736583,    68283748,   361404078,  4133969874,  1649005721, 
-   796957317,   893092718,  1405909275,  3879343156,   579622218,  3253282592, 
-  4058877588,  1718873747,  3299841770,  1311405724,  3761352263,   569382864, 
-  3967793890,   298970737,   987427027,  2155644996,  2374266952,   999931401, 
-  1292521992,  3610670871,  2831192788,   223270463,  3584117387,   487643399, 
-  2270208586,    33686469,  2418985323,  1342918447,  1147416754,  4278992712, 
-  2327891219,  1537475968,  2424555488,  1945777935,   481086915,  1398031047, 
-  2736905344,   646216216,  1952533257,  1368363230,  3970188472,  2881440660, 
-  2736189834,  2001535041,   341855139,  1246115884,  2451152358,   488877446, 
-  1326434096,  3278393816,  4223650123,  3644129271,  3401253187,  1775891313, 
-  3285722079,   648456784,  3912618406,  4271843102,  1939972217,  2925485935, 
-  2272103293,  3264207314,  2223053110,  3715138064,  1159400994,  1919872520, 
-  2955370502,  2568599115,   834662268,  3723818649,   708127026,  2011906581, 
-  2897115441,  2591029456,  1575274229,  3148206230,   722252923,  3940445619, 
-  3334140750,  1280880821,  2042645084,  1958673849,  2795716913,  3345042296, 
-  3743608878,   333584168,  2168654941,  3623905212,  1838790779,  2546258394, 
-  2230826851,  1428363353,  3313412132,  2204267021,  2451829586,  3871542123, 
-   349296659,  1157075772,   540841025,  1673980750,  1547022393,  1160416519, 
-  3887165175,  2527237398,  2946474041,  3540708425,  1195696736,  2525628225, 
-  3841472496,  1655806647,  3704417363,  3228154436,  1026191310,  1862055414, 
-  1194772198,  3256636125,   741927990,  2974851767,   377057391,  1787286058, 
-  4293869351,  2738158954,  2625054903,   895851839,   403486504,   827457362, 
-  3077703940,  1761256050,  3265905451,  3161808719,   444016440,  2436525985, 
-  1957335067,  2439841821,  2764089401,  1839043647,  1460956462,  4225947283, 
-  3027765609,  1789722266,    21832532,  1888906418,  2061187813,  2419610985, 
-  3180035894,  3914026247,   614198387,  2485587848,  1079313367,  2301000204, 
-  2634051623,  2273048567,  2410828347,   669655185,   436776455,  3617779489, 
-  2560844640,  1755410620,  3101491992,  1100112342,   350342577,   252079473, 
-  3405300022,  3828755421,  1193171556,  3151730808,   516113736,  3345674767, 
-   573554725,  1718025510,  3373837967,   798383089,  3196131940,   133381848, 
-   582076198,  2860475574,   104135208,   167239098,  4251322676,  2332155888, 
-  1796706287,  1656772293,  3884316050,   494536528,  2408119061,  2811213980, 
-  2366073121,  1767458261,  2798239540,  3370540892,  1165589192,  2524322534, 
-  4218773313,  1338252441,  1514079443,  4145123082,  1557090255,  3927393547, 
-  2165318873,  3399467992,  1943595235,   981459262,  3857323060,  3330436102, 
-  2637248798,  4197050143,  4055949221,  2633707665,  4044226511,  1240087339, 
-  2130931971,   249920340,  2130335751,  2057432467,  1019654012,  2541047640, 
-  3009990512,  3894978694,  1494287117,  1765697985,  2888294617,  1371040151, 
-  4088480533,  2330756812,  3011797060,  3184651469,   542291631,  1085890946, 
-  1128962358,  2154136329,  4162736640,  1071839690,  2273383523,  2724447374, 
-  2675339078,  3820792658,  3981226619,   185771621,  2614763964,  3875479631, 
-  2836614839,  2722285795,   757328757,  4185406548,    12027403,   865728148, 
-  2395154723,  1163540359,  1875251691,  1687587572,  2051568694,   439228440, 
-  1385162601,  2198738943,  4034385169,  2860991370,  3153904770,  3873017287, 
-  1825101308,  2939484033,  3303579977,   600071498,  3334764908,  1769835740, 
-  2250412096,  1416535464,   281547301,  1567226180,   725763306,  1521329024, 
-  2592586006,   444968027,  2347121214,  1056059298,   958601786,  2989473595, 
-  4000180820,  3258897613,  1313887811,  3798913293,  3405057546,  1052951675, 
-   598009393,  3191619940,  1421043347,  1907497173,   976656687,  3479704048, 
-  3063793252,  4071958431,  2905113964,  3395837759,  2046975386,   476492682, 
-  1305683883,   227524202,   154839268,  2376425810,  2708836997,   420611167, 
-  4135356407,   482492990,  4056683243,  2248871194,  4043999165,   877585840, 
-  3422441354,  3074850785,  1502720580,  2161112764,  1551347504,  1199811192, 
-   830455435,  2456885701,  1272206308,  1472213231,  3489707362,  2119372569, 
-  3562512411,  3564690487,   449937598,  1145641453,  3609786659,  1974084445, 
-   905657511,  2167570736,   554845564,  2470624194,  1710493583,  1926533065, 
-  1347421801,  2089399932,  2956374979,   176523507,  2859402931,  3107277493, 
-   456663715,  3314868222,  3542196414,  1936447396,  2626422045,  1219959982, 
-  2367683075,  2187609661,  1717204646,  2448671955,  2112989714,  3059302932, 
-  2031843000,  3481487100,  3907334284,   781222111,  2393349216,  2139317630, 
-   663854753,  2408651988,   371526762,  2434041469,   968420535,  2803919921, 
-   375733315,   230455798,  2554002812,  2963921438,  2659499977,   888611947, 
-  2455065014,  1218491293,  1823923773,   423320814,  2212076267,  2500852991, 
-  3578631464,  2313119678,  1419974295,    88278758,  4160451023,   485185053, 
-  4174071608,   534548534,  2301346752,  1492362395,  2040929292,   273005877, 
-  3481223303,  3683780622,  2814295013,  2185357943,   198461528,  1445637037, 
-  1169784885,  1126238782,  2136904463,  1059507888,  3458192559,  3871165228, 
-  1909535977,  4105421794,  4004685090,  2316003071,  3897900711,   535558399, 
-   897625994,  1103066635,  1001726243,  2392586846,  1621086768,    65680831, 
-  3931587446,  3319542358,  1265250698,  3401541694,   857408826,  3065313868, 
-   944076567,  3024799059,  3679936876,  2674405303,  2924905078,  4247905389, 
-     2711440,  3176876007,  3951572137,  2421002468,  3221390068,  4157639675, 
-   196771823,  2679586890,  3094614176,  3988739518,  1194163067,  2298585027, 
-  4289660606,  3817157985,  3903989612,  2306234006,   370506003,  1281770665, 
-  2094172964,  1207013882,  2099625025,  3319664104,  3729119989,  2284178546, 
-  2497116432,   853269256,  2771508096,   247293292,  2722329274,  3728230272, 
-  1094730031,    43585620,  3769988681,  3861928494,  4187849575,  2718016102, 
-   932644926,  2673010277,  3367243931,   794126928,  2394465562,  3587774044, 
-  1431658589,  2286341279,  1904842570,  2258077320,  4161071825,   660188478, 
-   416746604,    83244088,  3447336230,  4242896861,   829053252,  1419290670, 
-  3771075968,  1416790525,  3732508757,   501837852,   479973730,  3182857801, 
-   902442561,  1046903762,    58355306,   937411296,  3262400710,  1483431601, 
-  1089156574,  3740398304,  1606986176,  3584281319,  1819928947,  1250323678, 
-  2596076615,  2002436719,   107885344,  3187863784,  1581300986,  3794973885, 
-  3181408954,  1147526847,   472879824,   580779608,  1154448826,  2829169156, 
-  1753682051,  4243536472,  2569320353,  1897302786,  4087585400,  1171250628, 
-  3147611449,  2620088986,  2968110424,  3429835803,  3769899494,   791690207, 
-   630601617,  3091609742,  3607374257,  1671107281,  2876287260,  3310299383, 
-  3603618426,   251951437,  1235984013,  1430903386,  2987263413,  4056739525, 
-   744517689,  4185894206,  2935720364,  2203750657,  3947342475,   661166798, 
-  1283826915,   586151741,  3904861423,  4055118309,   931982480,    17130091, 
-  2943320785,  4182925785,  2057798841,   505667064,  2901247073,  3891463298, 
-   848159701,  2268418208,  3792800927,  1421453597,  2221821591,  4036670930, 
-  3788957388,   298305948,    28016636,  1082397307,   300372351,  3405751462, 
-  1208015555,  1660719873,  2421849286,  3985432447,  2015346380,  2906117857, 
-  3697734188,  2856812626,  4101439506,  3029692937,   367297563,  2038826091, 
-   576649332,    87915207,   739860436,  4140776647,   897267896,  2042143977, 
-  2163281959,   517755722,  2878809596,  4050421866,  2216563643,  1680318602, 
-  3125181225,  1139649609,   503125967,  3541260427,  1066816633,  4038356660, 
-  3798714590,   573658154,  1451015045,  3103984931,   496064191,  2062627034, 
-   235149681,  2285944212,  4174848730,   616484819,   720056478,  1716490888, 
-  3302760427,  1995465771,   984927285,  2708641994,    27202719,  3884824710, 
-  1335962018,  3571942910,  1601745687,    91345032,   228125261,  1994893297, 
-  1214496544,  3985328598,  3939744012,  3729315371,   619167372,   555631663, 
-  3236414038,   798357710,  3617925523,  2569652870,  4120829099,  4038818122, 
-  4220556251,  3754971651,  2073549678,  2003832686,  3098860360,   595800618, 
-  3680856315,  3845771399,  3965714510,  3761111104,  1064862571,   574889971, 
-   710407553,  3564171465,  1828772707,  2975717848,   232213387,  1876321663, 
-  3462476960,  2720313049,   139357759,  2134699216,  1170027416,   458154570, 
-  2736286438,  3555944963,  1616240749,  2087912628,  3856508485,   248739178, 
-  3988386464,  2056397954,  3646648531,    22230156,   592382991,   926409273, 
-  1077306850,   340567885,  1504011608,  2850499029,   707023135,  2901600293, 
-  3315553110,  1492905196,  3861427225,   382462534,  1620455723,   646816756, 
-  2058405220,  2999819881,  1268734840,    19779323,  2011080349,  2217856637, 
-  3432627780,  1400673751,   103431249,  3454003166,   178475023,  2043190015, 
-  2948433028,  2754842187,  4112404491,  1968096388,    72391511,  3652679689, 
-  3872840661,  3740145362,   762035336,  4229308498,  2302983650,  3049007953, 
-  3989671836,  1648952770,  3235499686,  3467857918,  1834300470,  3534877151, 
-  3541362754,  4265524355,  1741881267,   726363723,  1946654101,  2528798707, 
-  3924000994,  3991588544,   199297628,   884684643,   926444742,  2874891550, 
-  4145564558,  4174177173,  4232807334,  2228812555,   607438020,  2875303655, 
-   912474989,  4152684439,   309493194,   919779640,   305355414,  1226614470, 
-  2975959931,  3840506002,   955881629,    43474673,  3479181401,  1819028332, 
-  2070675805,  3543227541,  3790620780,  2665079516,  3884489435,   557112889, 
-  3511087867,  3777855834,  2140023960,    31885320,   899671978,  1660242740, 
-  2850633838,  4204376486,   126203166,  1794812597,  3827037883,  1462570561, 
-  3179495172,  3200915400,  2291900735,  1414067526,   781571115,  3451102864, 
-  3488452079,  1429440471,  2982922442,  4103448328,  2866625005,   209921361, 
-  4212331636,  1286719168,   658533104,  3354497223,  2135771679,  1670254581, 
-  4011600437,  2497965197,  4257946217,  2845953983,  1624668136,  1182907064, 
-  1060669241,  2789082113,  3758524425,  1221287922,   854817450,  1691516658, 
-  3163050820,  3748858825,  4028904742,  1795560715,  4085748866,  2621448918, 
-  2523878609,  3722251112,  3316885487,  3718189592,  4076161136,  3765048769, 
-  1542028708,  3891105156,  4066495067,   833291062,  3216744247,  4030763650, 
-  3124840224,   783250942,  3183812115,   891083210,  3317403702,  1275278961, 
-  1473108976,   299984934,  1734024667,   871307300,  2836297547,  2073202924, 
-  1686445048,  1720167336,  2141665326,  2714867518,   126830467,  2538836675, 
-  2190709566,  2914306104,   329390770,  1820195945,  2466222571,  4148500677, 
-  3198479313,   706123945,   816158539,  3192855939,  3961712337,  3396092732, 
-  2909255439,  1836753969,  3520245974,  2805046417,  2836713120,  1037536854, 
-  4204888721,  3150025581,  1009195501,  1621240207,  1391955195,   554655038, 
-  1320815333,  3717822383,  2982438832,  2170006981,  1437987601,   366913157, 
-   956145690,   554663276,  2651955896,  1726523688,  3631128900,  2970248943, 
-  3967084151,  2757371988,  3448781057,   536529178,  2551322931,  2920854194, 
-  3920737178,   609743544,  3003572460,   781114293,  2329668221,  3559002233, 
-  2855179294,   423359002,  3337701809,  4198425888,  2003410692,  1516192522, 
-  1647889391,   194993094,    26969843,  4007711768,  1691211761,  2430799517, 
-  2190517485,  3561871861,  1655041990,  2311127618,  2620242093,   951676882, 
-  3462948979,  1794901729,  1118876650,  2031408578,  3990933298,  3883223641, 
-  3422265443,  1784662843,   378259699,  2501000670,   152515145,  4066959772, 
-   468653962,  3297789577,  2696645620,  2291661222,   466861773,    64282811, 
-    84791907,  2980519464,  3981132204,  1304396299,   275933808,  3704250690, 
-  2931603822,  3431672300,  3604627684,  4152858077,  3893854809,   872989699, 
-  2266227519,  2379240391,  3268105700,   170950984,  2794315630,  1784036601, 
-   559585581,  2660916816,  1556279368,   667873824,   319289253,  2677695625, 
-   919976214,  3646274224,  4241429374,   747689002,  3844648275,  1382620217, 
-   747317678,  2262683220,  4133413693,  1504539852,  3646185243,    46030270, 
-  1320451207,  3264679962,   563720005,  2071296158,  2704203071,  2494673692, 
-  3276071819,  3132662499,  2645232441,  3804964560,  4015779396,  2920246194, 
-  1030824586,  1761322132,   357254325,  4096094257,  2940402680,   539564763, 
-   304950453,  1857863510,  1871665378,   629829170,  1495322636,  3898433719, 
-   375726440,  1124956035,  3235689363,  4171270662,  1434683350,   303787411, 
-  3807237778,   163165617,  1964999928,   497187901,  4011909594,  2623204567, 
-  3261160233,  3710328380,  2121825365,  4221673200,  4035329079,   506863608, 
-   506261070,  1050475538,  2693078591,   920321913,  4058017623,   360125043, 
-  4226563994,  1871919306,  1027083419,  2839142043,  1437085438,   447409210, 
-  4187828149,    60049970,  1909012126,   732442156,    14888955,  1339308092, 
-  3581290729,  1252096962,  1437066211,  1160304044,  2641988754,   984582294, 
-  2475587807,  4090201015,   783128349,  3916967135,  4250883767,   884681463, 
-  2215970904,   525969142,  1681530363,  1586992710,   489458249,  3258736476, 
-  2859532622,   166371955,  3304957712,   977907114,  3365730487,   609764986, 
-  2782586690,  3221436527,  3683189403,  2769482651,  1980777371,  1996037754, 
-  2899269871,   706978245,  3695688172,  4049940209,  4270996865,  3871713188, 
-   498531288,  1695173333,  2335723280,   515863601,  1519261247,  3610345071, 
-  1977371213,  2686561089,  1884923384,  1536138846,  4101197460,   650643781, 
-  2727708552,   301976287,  1822679329,  3880899801,  1213608658,  3737614352, 
-  3207713877,  1515192642,  3168391274,  3058655878,  2235337339,  3042700801, 
-  2253993529,  3588669150,   362927418,  1202952116,  2109398828,   594288686, 
-  3588911990,  1801851902,  1053024243,  1764424476,  3255332806,   992019447, 
-  2138925513,  1480501276,  1713293051,  1819373853,    24689397,   961462416, 
-  4153839856,  1753279570,  1184886646,  2054293885,  1251826977,   964950929, 
-  3864544726,   158123359,  3843465575,  1065847363,  2753170952,  1726540503, 
-  2464771221,  4241621719,   298477568,  1581539390,  3810520160,  2454472203, 
-  1777206610,   507581964,  1390043975,  3195166058,  3704014027,  3148486930, 
-  3383027026,  3260827426,  4188905819,  1903409116,  3681725015,  3374730765, 
-     4845606,  3229999272,  3702026424,  2838634592,   896263470,  1306064374, 
-  3348816538,  3469614505,  2952185493,  2030429733,  4185158912,   533576889, 
-  2895640493,   593028285,  3705006295,  3632081384,   273282566,  2384723769, 
-  1549090757,  3126568103,  3497484266,  1277023402,  1149134035,  2374837136, 
-  2158144687,  2497341733,   768268437,   965613873,  3551159507,  1347763285, 
-   155889014,  1617422703,   870016072,  3002744122,   490653016,  2195858692, 
-   440952789,  2271184322,  3414352132,  3395804066,  3855648664,  2105348948, 
-  1739316655,  4213996293,    21968583,  2565222544,  4004594919,  2215313462, 
-  1359781560,  1122986728,  3245666483,   217792150,  3249536779,  1721238085, 
-  3247687024,   372624298,   756891602,  2832288208,  2698078160,  3743398960, 
-  1032887422,  1168085426,  1616217091,  1731762363,  1753822025,   404159245, 
-    24241093,    75921008,  3794356246,  1923887982,   670758795,   215412908, 
-  4189717186,  1400748691,  3470020011,  4137205654,  2713853670,  3567394762, 
-  3256756525,   568312956,  1709608081,  2433365048,  3276486969,  1237784866, 
-  3940738327,  3276959868,   281121812,  1854044821,  3281854444,  1422187222, 
-   264214002,  1018835162,   958502117,  2766390974,    18592347,  3285388008, 
-   370673437,  1271949995,  3747354239,  1762776974,  3799255877,  2467807397, 
-  3015844294,  1268663301,   840021577,  2704008921,  1846833228,  3615476669, 
-  1778056226,  2053432178,  2179021760,  3186783648,  1270479025,  1352285122, 
-  3557758012,  2183272163,  1299098170,  3846815497,  2743571450,  4073949615, 
-  1732876294,  4117748571,   771071178,  3622855920,  3247916538,   956483487, 
-  1266458966,  1205313061,  4292507034,  2011531599,  3992945088,   799812398, 
-  1982849541,   445048911,  1842888988,   587399401,  2567889317,  2074712071, 
-  2767611010,  1151803667,  3403746795,  1921896548,   196241278,   131171074, 
-   129327436,   883339594,   971645111,  2065342740,  4000944586,   454763380, 
-  3638480462,  2235385838,  2447382063,  2913909405,  1067832221,   376604703, 
-  1334632553,  1711998559,  2892398372,  1084085605,   542170904,  3187669853, 
-  2228111832,   360646595,  4212119462,  2964207743,  4263497288,  1747881995, 
-  1279753101,  3995695602,   345267719,   626185163,  1286444963,  1347236279, 
-  1704535580,  1256346211,  1549412053,  2768559060,   464559701,  2151258255, 
-   625368392,  4006842317,  1186700376,   483154190,  2808947426,   598109870, 
-  1462282400,  3105098299,  1531689313,  1333931751,  2221485749,  1903130214, 
-  2004836375,  1783894714,  2853793695,  2936906730,   102415628,  1244330098, 
-  3096373606,  1486938783,  1008221210,  3575397703,  3737393530,  3287012901, 
-   145149070,  1428803042,   541163713,  4225637916,   520335980,  3977052401, 
-  3878458787,  3134996912,   721010728,  2118095041,   335357282,  3026722997, 
-  3922013859,  2917135733,  1381282290,  1543745564,  2366633531,  3866305193, 
-  3122688522,   200116996,  3923952991,  3918982290,   715338970,  1087263129, 
-    98343020,  2358708676,  3712314001,  2943785238,  1106900094,  3956610398, 
-   635580276,    45009790,  1771514162,  3736836167,  2696177505,  2894576749, 
-   946604926,   512535937,  2646332146,   390720885,   753107685,  2294538462, 
-   218434720,  4094531390,  1812116885,  3310867140,  1201166964,   552002363, 
-  2815979203,  3003873731,  4183012892,  1158695030,  1358234020,   316498217, 
-   435840283,   117117270,  2791161620,  1067331971,  1081563627,  2330981580, 
-  2324383500,  2353063901,   277872438,  3014848341,  3600765574,  1800151655, 
-  1237501609,   488779643,   324459815,  4107273960,  4192543817,  2695767613, 
-   188544079,  3010400390,  4033509556,  1963905858,  1184297736,  2578810437, 
-   296467543,  1495856171,   143942290,  2027175721,  1302307357,  2899076856, 
-  4213811483,  2012993309,   795711826,  3109109666,  2707271737,   315884297, 
-  1763315883,   701290166,  2986970424,  2803046765,   235357576,  3951669689, 
-  3923073619,  1796855661,   775357465,  3669696024,  1465882085,  2719349737, 
-  2772498224,   123303608,  1306365766,   369960296,  3040067157,  4239574684, 
-   473347504,  3052706142,  3892314589,   324145513,  2940853916,  3371523804, 
-  3867887011,  2397816657,  4009067596,  2743977916,  1409894740,  1546651890, 
-  2846786308,  1240633996,   897870422,  3244636973,    75286275,   425648584, 
-  1462661842,  1417990417,  3107910637,  2984972187,   615706498,   549961107, 
-  1527639212,   975247786,  2240327039,   968066490,   879799951,  3695707849, 
-  1132188841,  2611665514,  2849914395,  1549585410,  3217943109,   298794365, 
-  4144627711,  4255032695,   675767077,  3232877841,  2894818051,  4264016423, 
-  1122075449,  1635560816,   326878622,  2564778919,  3517008788,  3730152330, 
-    69252450,  1896972459,  3396667178,   710534219,  1107747396,   262866172, 
-  1732864588,  2425304091,  1904091516,  2854346779,  4233519865,  3100958328, 
-  2245940122,  2714744795,   339691505,  1512473499,  2577658685,  2689357152, 
-  1190601540,  4022976751,   665618990,   704392737,  2187646540,   870380831, 
-  3658565828,  1922583249,  1150763299,  1751270822,  3966758790,  2312469428, 
-  2900934543,  2747298626,  3973804251,  1063259896,  3884551127,    55689501, 
-  2130472429,     2214942,  4272450742,  2160605110,  2195915984,  1973086531, 
-  1058544951,  4030529297,  1741492563,  2578103452,  3315980961,  3509525785, 
-  2339296683,  3285312215,  2333763414,   984135811,  1498213774,  4243158508, 
-  1133275091,  1541186773,  1797300781,   685792685,  3439282263,   587792617, 
-  1858713014,  2248553086,   845430537,   993998314,  1877920048,  3539209236, 
-  3012476649,  2412325405,   787982098,    35331781,  3700618230,  1618128511, 
-  1747775440,  3665663793,  2995022621,  1438702877,  2122228654,  1314173804, 
-  2314624303,    33727629,  1705132088,  3414179549,  2102945334,   483799515, 
-  2900680578,   700099133,  3133866995,  4071994892,  3881488712,  1466832027, 
-  2130819039,  2007745259,  2600730083,  1202704736,  3454226538,  3543961333, 
-  3845976534,   353728242,  1767055828,  1651983946,   252518427,  1740780919, 
-   356534182,  3025769712,  3281468323,  2675704869,   345811886,   982200788, 
-  2190003437,  2977373284,  2432232373,  1654363050,    39448586,  1640431911, 
-   135787952,   733770321,   447742781,   328454352,  2215011124,  4080013154, 
-  3212189995,  2169646045,  3421825908,  1042335378,   241271064,  2374900195, 
-  1176383722,  3449518526,  1615807373,  3175461987,  1501895398,  1252770042, 
-   586100257,    44637074,    26186220,  3148495500,  1031963281,  1936461931, 
-  2142225952,  2102848501,  3354363855,   974118557,  3587787990,   236539897, 
-  3366998730,  2775315855,   775069793,  2174220835,  2282810406,  1072820678, 
-  3978325026,  2788969182,  3321168599,  2486108798,     3782572,  1881072235, 
-  2717607184,  1414246653,  1148639440,  2881911491,  1911978108,   355402652, 
-   499150684,  3132270988,  4259723165,  3831889606,  1834048774,  3843245460, 
-  3831988883,  1693497200,  4043772725,  4150426056,  2839646532,  4168120907, 
-  2864754632,  3426201803,  4028938192,  2550835418,  3202425671,    45583990, 
-  1622947844,  1680694589,  4075245804,   892281712,   298419188,   740541143, 
-  2593219978,  2442282461,   454885309,   114990460,   224033474,   276328173, 
-   564454885,   378170040,  1258521008,   341638128,  4206449258,   302854102, 
-  1189031627,  1251691677,  1074031260,  1389266991,  3190518080,  3215533801, 
-  4219542362,   267714103,  2037208803,   729597617,  4134412340,  2457388524, 
-   479528179,  4023491783,  1107780558,  1505273604,  1999590668,   279588665, 
-  2474306189,  1196791612,  4030309659,  1029565355,  4175553475,   245083972, 
-   906631797,   657770409,  4118184781,  2175186980,  3662757847,  2830648544, 
-  1508439397,   182388968,  1201725972,  1617436472,  2404970602,  3601100487, 
-  2934899569,   164781885,  3473282267,  1458863778,  2295642047,  2949125745, 
-  2278842779,  3840689620,   783126282,   154989744,  3176952807,  1812324025, 
-   498486966,  1918794354,  3118705885,   337378604,  1867695482,   167769086, 
-  3389809995,   405431647,  2813651560,  2614029793,  3213695406,    67055915, 
-  3178157377,  3296585009,  3091143046,   992084368,  3345135762,  2077562839, 
-  3756323883,  4124610666,  2689082733,  1986146004,  3438532382,  2845479998, 
-  1721395212,  2658818706,  3478903617,  1646282270,   107320130,  2913007081, 
-  1361624474,   248105441,  1136919354,  1433625290,    93408390,   286698746, 
-   372925941,  1858727459,  1876363786,  1949470280,   883115393,  2232625894, 
-  2391564354,  2775389014,   576284543,  1908331603,  1798102968,  1010461689, 
-  1704581020,  3223169649,   652719307,   230168447,  1505963587,  3847909362, 
-  2913871873,  3854712538,  3326507624,  3354910522,  2377147254,    76150167, 
-   133267177,  1016680894,  3222425011,   488307709,  2762146309,  1927631590, 
-  2864185520,  3661045192,  3369405457,  2579105422,    83203159,  4122759714, 
-   314912090,  2907369144,  1684346445,  2140709108,  3486144209,  2041778207, 
-  4136111942,   568867548,  2286107964,   618329301,  3738560553,  2405592719, 
-  1137611054,  4265792236,  1047992605,  1432461339,  1334319065,  2886815797, 
-   285519793,  1090699335,   194477874,  3281517296,   567104142,   155762993, 
-  2865716704,  3781945886,  3637439636,  3635508220,   452825248,  3119003427, 
-  1949053203,  1431539360,  1838776255,  1980240999,  2783202711,  2026230032, 
-  1658718643,  4137772525,  3628816288,   661886003,    26636241,  1718352286, 
-    56167028,  4161842345,  1850284959,   678334285,  3344187557,  1411660397, 
-  3887561428,  3212252067,   307315911,   196102436,  2018745782,  4231392928, 
-  2386541374,   489292467,  2915324123,   404619720,  1427445548,  2250822418, 
-   843374798,  4214679829,  1601187539,  1014275606,  1227585230,  1375803490, 
-  3794575854,  3733972420,  2630740941,  3803963921,  2162216943,  1864269651, 
-  3582305660,  3858360491,  2902441465,  2834341518,  3082294879,   493073631, 
-  1985892571,   476923742,  1820902041,  4232920537,  2289856114,  1696553147, 
-  1394439360,  3188837630,  1399895145,  2935718929,  3759581823,  3177400297, 
-  3436449115,  3739553789,  1011290605,  3159873325,  3767376480,  3363204463, 
-  1241781149,  1844322130,  3366325186,   487381392,  2390116824,  4141295114, 
-   451547256,  2358410065,   343168858,  4237378684,  2154515578,  3835708372, 
-  1397558918,  2050362637,  2996811734,  3430362949,  1254555649,  2554037169, 
-  2785113176,  1972340174,   775420101,  1975462343,  1622062920,  2863762762, 
-  3494434588,  2186454802,  1318635591,  2941773306,   454207241,  2202346449, 
-  1560429060,  2423481211,  2477575413,   509778407,  1042335601,  1968533249, 
-  2169750319,   879820615,  3643422744,  1211933946,  1060959235,  3892825411, 
-  1906653259,   634662040,  3806249604,  2150587971,  3720666895,    90770590, 
-  1412790709,  4106400014,  2084076184,  1182740336,  2674779417,   514981387, 
-  2561610233,   985541692,   831640623,  3227610734,   978286277,  3835395255, 
-  1682247720,  1602239176,   992152986,  2399742192,  3672031424,  1654852733, 
-  2036108031,  1850834189,   760693651,  2902977278,  2792999418,   636506542, 
-  2082168752,  4076188073,  1480210649,  3256899406,   417310810,  2516529518, 
-   306372908,  1206758974,  3664903384,    55970269,  3830606645,  3724864793, 
-   499976455,  2735876339,  1941087122,  2666938374,  2329767471,   235601306, 
-  1709913802,  3750345883,   731918751,  3272997279,  1171397278,  2387023218, 
-  2387906216,   572849077,  3149007243,     2275970,  3683741768,   313932454, 
-  1466309187,  4182273377,  4071211722,    45014053,  1759707241,   524529358, 
-  2737443485,  3706669205,  2518406674,   152783730,  3107970266,  3303482034, 
-  1197363901,  1277294107,  3059613845,  1151294489,  4085659917,  4023715916, 
-  1319451599,  2433926029,  3961190076,  2458519822,  2056999744,  3668096371, 
-  2424563826,   160692235,  2063232482,  1507472925,  2696175223,  3496053777, 
-   135348246,  1487660235,  1049808270,  2539773033,  1245371605,  2888026193, 
-  2321469164,  1317741791,  3499538193,  1995517567,   430686408,   772387854, 
-   846418173,  3090294747,  2959090495,  1175177695,  3721515118,  1144319209, 
-  2835330209,  2877300148,   447520475,  3292656878,  3315889511,   406735862, 
-  2710789916,  3300534757,  4231295050,  3196996316,   691253075,  1783121527, 
-  3548195727,  3608626684,   124728941,   165662057,  1594748018,  4164052152, 
-   198833039,   282798386,  2133008430,  1969778816,   478435222,  4150008961, 
-  1698097738,  3355912135,  1266643374,  3686753186,   575726210,   324811330, 
-  3242780469,  3138368586,   159174470,  1970856896,  3665079976,  3481522128, 
-  1114702855,  3879350118,   890501072,  3299800259,  1706304353,  4289055647, 
-  2289101200,   634670897,   861076070,  2540920858,   259683582,  3023736310, 
-  3776988294,   409447854,  2152100356,  2476405819,  1516337036,  1143931845, 
-    12655571,  2297551440,  2508136321,   492563089,  1829915997,  3527665334, 
-  3574295482,  3994268323,  3044845636,  4114617365,  3113038304,  2383353525, 
-  1787795274,   900809325,  1059505497,  2651738121,  2863290811,  3216222200, 
-  3211213755,   102885696,   434733902,  3552335771,  1345324063,   892796331, 
-   582350209,   672590992,  3931879799,  3089623110,  1340782203,  2574855354, 
-  4187848612,  4001106826,  1645939913,   889516390,  2762464836,   302330161, 
-  1141660233,  3003983505,   141719195,  3853907887,  2304623939,  2541389774, 
-  2129194718,  3402706955,  3200123025,  3206367276,  3908944639,  3205369146, 
-   924553428,  2056807665,  3578741743,  2980091782,  1497457750,  2162514120, 
-  3438877879,   537726281,  4077754214,  1442658034,  2838419244,   190909208, 
-  2772237724,  3514750402,  2132846773,   568076421,   962262825,   234064406, 
-  3157340399,  2269084748,  1330270506,  2740960693,  2327245677,  2829731490, 
-   428959635,    47291924,   802324652,  4186871293,  2298394560,   917095037, 
-  2009901227,   955184214,   370499485,  3649074978,  4238908238,   538520879, 
-  3919229774,  4163544369,   143661318,  2171945877,  2085662498,  2163430318, 
-  2032542173,  1872904966,  1312330698,   359466085,   809101381,  2048844847, 
-  1740219817,  3524623043,  1303646460,  3214394013,  3723914788,  2693161672, 
-  3662146337,  3175980438,  3768055234,  3735505767,   257684379,  1772775897, 
-  2278759048,   315292591,  1382488379,  3395273585,  1671563433,  4216177450, 
-  1995908964,   537643845,  3608356574,  2566068008,  3694933783,  3899105475, 
-  4223459180,  1662811274,  1495490271,  2211575756,    55582274,   530944185, 
-  2815477752,  1957711315,   320599867,   190444625,  2992031846,   106802568, 
-  1154203238,  1061424542,  1385552817,  2980532811,  1989361158,   587530205, 
-  3101614206,  2640254711,  1682367300,  1555920269,  2003054998,  2367838254, 
-   674964839,  1171212812,  3004364804,   766293617,  3492955032,   187262484, 
-  2750594855,  3437524354,   808384391,  3318224698,   539686169,  2766654239, 
-  3505632343,  1769629910,   284101455,  2311109936,  2080811287,  2061411871, 
-  3874804004,  2189986989,    98756338,   380777339,   235101772,  2131219086, 
-  2469187799,  1905928855,  2088896162,  3323604314,  3019985094,  2514630530, 
-   998109137,  2934871872,   340458738,  1890919319,  2711463992,  3004860253, 
-  1643300576,   517665911,  2312891749,   992373900,  2720502017,  2436566942, 
-  1732777777,  1089607727,   294405560,  1968479790,  1355246927,  3439373888, 
-   826258272,  2205681283,  3766413506,   266237630,   373062188,  2337452274, 
-  3964342648,  1793260538,  2000732329,  1739240378,  1450092856,  2893630473, 
-  1917896465,  4191815601,   722375843,  1280273402,   111255560,  3253672186, 
-  1216737709,   763506730,  3418912862,  3568848938,   743085430,  3441631942, 
-   949731317,  2071388909,  3861024373,  2732685531,  3688160261,  3177724357, 
-   685989840,  3803564237,  2772306499,  3016003959,  1990824001,   856590217, 
-  3746949784,  3858988491,  3159855270,   520542829,  2626320994,  2964542157, 
-   170918030,  2197487157,   832966266,  1514074998,  2163393332,   632122308, 
-  4075501966,  2164640782,   276307167,   331298500,  4285670612,   277253446, 
-  1777907366,   264953342,  1944405393,  3069975921,  2029534183,   615800567, 
-  4282409254,  3082887464,  1427866575,  1638573276,  2194990699,   412198593, 
-  3821583187,  2053512114,  3298303109,  3834085923,  3018160831,  3096187150, 
-  1871882152,  1371878486,  1514719316,  4181653624,  2899623008,  3901908550, 
-  4125136723,  2512136743,  2973688748,  3189229528,  4077765110,  2298376344, 
-   176542789,   840453668,    62346085,  4285902182,  3363469551,  1965245196, 
-  1048067742,   582807590,   906907540,  3173759460,  1693901067,  2606285203, 
-  3156912867,  2019649314,  1644241017,  1179945904,  1612952690,   580160207, 
-  1796192928,  1129704359,   590397321,  1812712978,   250431085,  3540749510, 
-  4114865570,  1275353380,  3655913118,  1109709664,  1564792226,  3701263603, 
-  2624718087,  3956037071,   605880704,  2285945076,  1725824149,  2303969382, 
-  2349664036,   207279879,  4197492428,   588249255,  1028157263,   470182123, 
-  1303103998,   413353764,  2299845309,  1256231763,  2195135855,   187259845, 
-  2962512192,  3042831588,   582022418,  3950766571,  3190761193,  1784731645, 
-  1807546967,  3719303866,  2334488804,  2187555807,  3871760572,  1401589763, 
-  2621787058,  3917760854,  1097139915,  1617203917,  1293962827,  1404717237, 
-   547555399,  4048495012,  3491932115,  3566600680,  1502897581,  4092421072, 
-  1206836663,  4128349387,  3558769970,  3909878769,  3676572293,   762970996, 
-  1323506529,   929244522,  1564267453,  3216715426,  2375831265,   870584287, 
-  3226680481,   414090554,  2024127835,   581120032,   503291939,  2975894064, 
-  2206395647,  1029490270,  1594193275,  3555417424,  1211569858,  2661369105, 
-  1198732482,  2839984135,   128860141,  4177942393,  2995142310,  1139397926, 
-   311800858,   729370718,  3235213874,  3849840602,  2500332285,  2654603897, 
-  2257649379,  4277072908,  2663831008,  1911569669,   745329787,  1416611987, 
-   907270920,  3609415916,  2115315097,   561835004,  2882551530,  2216617516, 
-  3155578058,  2520944890,  3372230835,  4162621536,    71406637,  2790647499, 
-  2455881094,  3610586984,  2746979334,  1036091350,  3415159132,   703666257, 
-  1949746632,  2974372571,  1961117963,  2619470624,  3160140580,  2045521473, 
-  2608823397,  3358770178,   114290189,  3215820972,  2784455117,  1282266229, 
-   573158654,  1664326966,  3435536098,  2446574139,  3412707813,  1833113382, 
-  1610740378,   729559844,  1969777519,  3129676914,  1960781972,  3851308679, 
-  1146428631,   987284466,  2575193520,   600507487,  3178232920,  2319109332, 
-  3605561703,   684239759,  3590039148,  3979345990,  3112265514,  1867530452, 
-  2925128823,  2806423272,  1685059693,  1324236855,  1282928845,  2380035355, 
-  1244340497,  3494272721,   417033515,  1573041201,   201806056,  3496813165, 
-  2548508147,   606049170,   103372720,  3586974609,   425498058,   247518311, 
-  3793724627,  1393985506,  3205795505,  1632231528,  4012795049,  4139178362, 
-   241148674,  1529493727,  3049652218,  3436434625,  3772151748,   775965159, 
-  3542989548,  2374955982,  3904747153,  1478858612,  4202847100,  3345558707, 
-  4190605618,  3756499705,    52006112,   315813182,   235351612,  3768973508, 
-  2303095141,  1832304523,  2582868276,  1823803076,  2048424633,  3748500857, 
-   244423481,  1965594277,  1819156499,  1395029956,  3367995983,  1214570928, 
-  4200113734,  1802159377,  3419755052,  3486015981,  3837889966,   977237711, 
-   215552547,  3970134066,   860461841,  2527571348,  2434411451,  2241097013, 
-  2512203484,  3019192406,  1437511126,   647455832,  3009713182,  1753127451, 
-  1172329500,   261936797,  1611289667,  3166886190,   115188633,  2218472882, 
-  4094454840,  1694778910,  1856889661,  2600905145,  3271753218,  2234208474, 
-   966262337,  1844539083,  3733632946,  2220079304,  2677961448,  2931914094, 
-  4082358330,  3775235268,  2028836202,  2698014963,  4231297025,  1349160982, 
-  2924340234,  2278975966,  2173274353,  2308607147,  3578794225,  2053902888, 
-  1413338803,  4114610020,  1659625315,  1528602133,  3249786384,  2003932642, 
-   338415466,  2061264987,  3553487147,   841802876,  3661038184,  1578253142, 
-   640668076,  2164735007,  4255561259,   516436590,  4111496195,  1295896333, 
-   362461254,  1496277798,   673256276,  2330521821,  2009024350,  2846620301, 
-  2156168671,  1815125235,  3532776133,  3878471038,  2990371626,  3158495093, 
-  1678967134,  3218061868,  1989182008,  3397919196,  3722566941,  2770701969, 
-  1026220876,  1817624313,  1905220327,  1476576714,  1443432841,  1940543828, 
-  1094845557,  1099205015,  1491293695,  3063725537,   931804162,   586376776, 
-  3375390852,   526212191,  4044167794,   805503893,  2282411411,  3513521355, 
-  3690437166,  3340205455,  1559319416,   810428902,  3052935750,  2578182879, 
-  2755914468,   631258069,  3899973069,  4205913703,   403717267,  1030002178, 
-  3103840206,  2377342867,  3110724356,  1207488743,  1718789793,  3780162835, 
-  2764308650,  1093846096,   589176899,  1423201552,  3532676289,  3170682942, 
-  3370051646,  2351773946,  3578192525,  2668422752,  4168309552,   337611966, 
-  3827718612,  2347907533,  1138730090,  1774469243,   435367739,  1803308653, 
-  4036601622,  3505775264,   123244374,  2583738925,  3149268165,   928852748, 
-   810182085,  2313958596,  1477103925,  1520601365,  1161985614,  2784367847, 
-  2414769172,  1551336227,  1223900065,  2274955756,   526947240,   491773971, 
-  3103815593,  1953924312,  2012901424,  1229613249,  4079017659,  2387809697, 
-  3732193691,  2633225827,  2456397989,  3598552421,    50705048,  1813087421, 
-   297715310,  3431890322,  3924101317,  1075443461,  3516839455,   806200772, 
-   204781671,   797021526,  3876868794,  4042516185,  3472769474,  2566787264, 
-  1393381696,  1023248224,  2239769770,  3393285566,  3764786334,  3526256213, 
-  2145087847,  3963377508,  4090606456,   649736264,  3552527155,  1779583190, 
-  3861427254,   263380545,  1076173537,   369216060,  1310712090,  2944623651, 
-  3806782015,  1364592773,    66288958,  1836218046,  2433726156,   951414194, 
-  1024808968,  1751495195,  1240826890,  1273004456,  3511153750,  1898921872, 
-  1814111157,  1937502067,  3765963318,   137952113,   753890461,  3828259932, 
-  3805629777,  2922570533,  3299794079,  2023897537,  2507694738,  1525292303, 
-  2040764740,  3130341567,  2591761955,  1632116816,   304489281,   533147842, 
-  2896920511,   419664965,  1328388693,  2416350213,   619381893,   667268665, 
-  2389626247,  3878276144,  2648162648,  1464242567,  3802297081,  1180571419, 
-  1055700593,  3530738812,  3716889405,  3531344565,  3669552666,  3537402124, 
-  1565471947,  1268520572,   398479322,   460260162,  2763226221,  1713893193, 
-  2934619138,  2042201388,   920878726,  2662406681,  1325056735,  3317898064, 
-  1203852881,   941186355,   377980528,  2991957225,  2092337795,  2241937042, 
-  1332709118,   899383621,  1549213993,  3362184370,  1655265086,  1104626740, 
-   874618914,  1210976411,   891289587,  2679696600,   787940882,   217044925, 
-  2305642497,  2111931607,  1416487734,  3913603630,   492436027,  2360151832, 
-  3490617750,   866730953,  3285885080,   579835122,  2338171433,    92045932, 
-  1028545901,  2238522133,  2291583325,  1385332119,  1930406279,   649329779, 
-  2493161208,  3196630099,  3166497485,   321515668,  3551929782,   153165562, 
-  1619365116,  2056683350,  1121145678,  4086216869,  1277376457,   266469697, 
-  3872507051,   520120163,  2703414523,  2443737044,   225248102,   586426334, 
-   328913618,  2191263714,  2695778514,  2109145364,  1867077586,   543403744, 
-  1010424697,  3757045549,  3639185183,  1168640129,  2946042782,  1761176288, 
-  1479052219,  4048737914,   493426483,   371111527,  1827931320,  2976654085, 
-  1283792142,  3267442866,  1106784956,  2250834244,  4003400669,   124405248, 
-  1060808781,  2635136582,  3397325155,  2676199908,    86809077,  3365023653, 
-  1793127036,  2294635254,  1579599019,  3977403930,  1462371834,  4248774208, 
-  1930902441,  2383533725,    83030953,  2135065640,  3064219688,  3796574771, 
-  2792934168,  4230906812,  3996262018,   586009257,  3954819686,   702225565, 
-  3863947027,  4149650423,  3945431954,  2096476520,  3033947345,  1906545707, 
-  3950465777,  2240154582,  4270481417,  1031635628,  3155594166,  1407786750, 
-  3136682094,    43422277,  3529246047,  1217662753,  2209113825,  3609353751, 
-  1479500429,   890606351,  2190051360,  3411488385,  1945393999,  1876580872, 
-  1699502859,  4005529456,  1188350139,  3684183047,  1649905159,   863113087, 
-  3466004863,    64445335,  1008710939,  1945404981,   485541274,  2168966635, 
-   377836115,  3638530143,  1579507428,   427720087,   272842646,   942045563, 
-  4160582451,  2673100292,   837116854,  3583664930,  1703528778,  2985805086, 
-   361202901,   142303064,   847915955,  1007093849,   515494992,  1499212231, 
-   399266340,    96494219,   521248678,    21680860,  2069839908,  3867683142, 
-  3482739377,  4292425837,   755470981,  2836951712,  2359397802,  3058290399, 
-   984457890,   141927009,  2738378828,  3051621989,  3151298560,  3699303487, 
-  2354425869,  4042177634,   696865634,  1222345417,  1621508643,  3970657003, 
-  3670139021,  1663067811,  2701256972,   928943984,  3470160807,  3872337081, 
-  3678041330,  2472956009,  2692302447,  1433049524,  2540647619,  2559709013, 
-   596488905,  1367205169,   604673516,  1533811179,  3796586241,  3750542935, 
-  2981567525,  2547510058,   168315058,  2549137208,   156658466,   708682092, 
-   775458179,    76874527,  2682210868,  1393358902,  2965368033,   378868292, 
-  3047250458,  4130979282,  1055078631,  2940086331,  2313995801,  3355591535, 
-   796053558,  1971004589,  1178120568,  1454229069,  2525917773,  2483751412, 
-  1213310615,  1785628440,  2200796824,  1781034467,  2197580199,  3038685887, 
-   122265392,   460120701,  1190618850,  2849421999,  2363642101,  4217947202, 
-  2470262928,  1774209421,   472545189,  2447508859,  2633223610,  3850644599, 
-   408026744,  1613774586,  2910427330,  1253674220,  3194347978,  2983445564, 
-  4264331954,  2174298724,  3113934227,  2536167740,  2863115988,   930525469, 
-  2533761848,  4292928159,  3027944905,   380798071,  1748642828,  2561888131, 
-  4226417150,   106881075,   511787655,  1947568138,  3271443917,   984291197, 
-   979873464,   893158545,  3234103820,  2316897882,   719370266,  2570663704, 
-  3100026959,  3776865641,   998512912,  2418589146,   575136328,  4068987956, 
-  2989278324,  3708453670,    30379135,  1144795171,  3378970088,  3109246058, 
-   689740693,  1749576679,  1694036867,  2868710828,    72345174,  1062216887, 
-  3640814968,   831190285,  2592208094,  1756756378,  4238349734,  1676567478, 
-  2238228124,  2261052114,  1328835051,  1779611529,   215654643,  1434008778, 
-  2115368369,  1474854760,   570764555,  4156203530,  1685419877,   998263470, 
-  1116479564,  2292944190,  3377411512,  1728452471,  2479516414,   868971504, 
-   416283803,   135884800,  2560715855,  2001394670,  2456322505,  4270724889, 
-   386641225,  2449826351,  3220419180,  2134396792,  4091123765,   903881881, 
-  1730006754,   742694704,  3488334960,  1878240560,  3321531339,  1735287865, 
-   458553427,  3174994448,  3986819078,  3419203666,    31044977,  2684675202, 
-   231415648,   473212532,  2305139227,  1308970316,  2069296666,  2980571159, 
-  1817563284,   678638646,  1136780909,   832055715,  3358959242,  4236642159, 
-  3205193426,  2059553733,  3995726184,  3483632468,  3830341893,  3267252873, 
-  3550198778,  3529732573,  2859171322,  2235285132,   278961045,   269694493, 
-  2112299016,  3032314128,  1210112464,  3816989961,   387001465,  3583745755, 
-    61951486,  1563889063,  3983896550,   893358382,  3936188105,  3313625177, 
-   841889911,  2751775126,   525993010,  1382334723,  3946680009,  2523176280, 
-  3568708029,  3380051960,  3938338179,   818721877,   247679740,   255363750, 
-  1494403244,  2317288004,  2944803783,  3033769836,  3991070001,   681103720, 
-  2387423083,  3588734303,  1527970590,  2493608480,  1905951931,  1021217988, 
-  1228496374,   410184446,  1570366980,  3304921365,  3921534459,   959890381, 
-  3959035206,  2933598619,  3551689003,  2310463979,  3196683025,  1662599453, 
-  4234243097,  3829302348,  2745489524,  1276894920,  3913032319,  1607892387, 
-    95733248,  3125110543,  2737809900,  2550543515,  3795540184,   316088965, 
-  1946523010,  2392626024,  2682973237,  2650136331,  2272160224,  2884153240, 
-  3380021000,  3482180598,   772711289,  3824177779,  1296933050,  4266513615, 
-  1362573362,  2389955798,  1313113981,  3920625931,   243120553,  4161484676, 
-   804814785,  3689389868,  3463810643,  1809061546,   513172377,  1226091359, 
-   610822493,   163059910,  3585687935,  3409444447,  2812281161,  1608966644, 
-  3689219879,  3420938750,  1408339629,  3356131986,  2150678850,   235888816, 
-  1092590364,     4583394,  2013512313,  1685307296,  3319011169,  1973484882, 
-  1228947820,  4287545357,  2735765492,  3132649963,  3316580629,  3704862277, 
-  2982435583,  1572746127,  3953359628,   516348672,   170699870,  1516184721, 
-  2976971810,   351919839,  4128616889,  3304841677,  1792265564,  2330558665, 
-  3283290265,  2413895246,  1612426947,   680355848,  2139877741,   730017665, 
-   259772700,  3146686099,  2959363201,  2751627099,  1371030448,  2720988792, 
-  3610383837,  3024288814,   965301624,  1778274977,  1195039575,  3951298703, 
-  2812137221,   896615005,  2699793929,  2643735430,  2632722215,  3302276324, 
-  1914781097,  2844359734,  3946096707,  2245185296,   510626049,  3139312558, 
-  1161195453,  2820617287,  3697075627,  1735468861,  2680311895,  2212917799, 
-   953952498,  1393161009,  1489470321,  3422624561,  1177990691,   231309060, 
-   219576293,   252969207,  3090179797,  2505822715,  1021711869,   676832469, 
-  3316440291,  3591361493,  1807658340,  1782988676,  2531381001,  4246646733, 
-  4293273741,  1864866217,  4012253690,  3797042374,  2542843369,  4035445540, 
-   262207373,  3244768143,  1345942137,   772531852,  4105955039,  1816636525, 
-  1786242111,  3712969480,   187614284,   126490716,  2291745139,  4221992941, 
-  3485234596,  1442187642,   839526260,  1291250885,   537054861,   836056740, 
-  1030658844,  3215972188,  2267658232,  1694276306,  3660808764,  2896160847, 
-  2595993453,  3535605314,   301837007,  4252810424,   163418593,  1711347555, 
-  4073533568,  4071292047,  2760112149,  4108931632,   781755866,  3895740232, 
-  2103149937,   161804698,  1466982225,  2359745563,  1182979440,  3585963109, 
-  2798405265,  1872288584,  2053392479,  1792223135,  2396899363,    13571885, 
-  2955016312,  2598318598,  1339993369,  3636907603,  2747100191,   579842714, 
-  1962072270,   385041474,  2482712276,  3944265183,  1285942634,  3139276048, 
-   161007512,    44656108,  2289072134,   313022711,  1276809223,  2624790028, 
-  2167265268,  1191473504,  1794037808,  3189396026,  4074285117,  2599459764, 
-  1647526075,  1709534838,  1293225802,   723280322,  2579817236,  2531810334, 
-  2146282074,  2263067130,   835193200,  2199777795,   836040170,  3473750182, 
-  1575199516,  1520064343,  3916332594,  3048927973,    25218510,  1053432922, 
-  1272946352,  2423570723,  2167078989,  1727427326,  4149742328,  1006272629, 
-  3370499812,  2654283342,   346461725,   816116394,  2280339743,   661673736, 
-   347319341,  2113722645,  2761816264,  1041661529,  3447469799,  1894909746, 
-  1461330294,  2811131790,  2243137372,  3465257714,  3461410208,  1148385091, 
-  2415823110,  1048756408,  2646088982,  1880304621,  2387086243,   648296367, 
-  3064521064,  3317423594,  3346127843,   194030776,  2735115899,  3511617764, 
-   156127762,  1829712963,  2596089207,  1477585712,   911360654,  3270347981, 
-  3838628193,  3052408442,   806474933,  3037004003,   865214355,  1583481944, 
-  2421764014,  2887543808,  2393118847,  1277343854,  1229973136,  1029375939, 
-  1464580364,  1488335437,  3569005885,  1093915991,  1964364894,  2254315180, 
-  4075610760,  1560453200,  3715913215,  3021843976,  3572723908,  3857376948, 
-  4122705910,  3039250353,  4293814366,   232822952,  1103524456,  2940866493, 
-   164286882,  3329787222,  1427182830,  1872123347,  1268637873,  3413754787, 
-  1316153592,  3732826732,  1342809510,  2738913574,  1463929465,   734776489, 
-  3228554915,  2888278180,   613414097,   322149550,  1048598259,   894801538, 
-  1402468838,  2578569271,  3382644564,  1238866295,   221760634,    93579952, 
-   517085334,  3290651635,  1709079286,  2478448337,  1954714947,  3444456968, 
-  1429345184,  1988401507,    57051493,  1339485037,  2214409329,  2449202916, 
-   173361246,  1731374635,  3135221518,  3847195817,  1204686557,  4057205876, 
-  1340730536,  3786170787,  1995156146,  1055540475,  1060275911,  3750245558, 
-  1672325882,  1870319985,  2257214690,  2826534508,  2802555020,  2625929280, 
-  2139045936,  1529707157,  1839946083,  3722548992,  2296742736,  2744314305, 
-   785823865,  3853655016,  2490684304,  2073601296,  1812975524,  2206948623, 
-  2676494687,  2237550051,  2859482333,   631952711,  1192926673,  3867424040, 
-  3060335544,   883395962,  2760850283,  1832905679,  2877453438,  1227960668, 
-  3239938486,  1706989441,  3930569395,  4105654742,  1628659309,  1713452914, 
-  2061280439,  2650036496,  3218042367,  1538663960,  2158266535,  4209762521, 
-   533425262,  3568626978,  2717702992,  2027352490,  1473513230,   152989835, 
-  2567389244,   296654382,   328505959,  2806125515,  3709148507,  3688734014, 
-  1195885212,   689159648,  3181616811,  2975285817,   598484933,  2648035179, 
-  4010500924,   179153279,    68654456,  1494724399,  3046540060,  3900177025, 
-  2725455904,   830124068,   714200876,  4083855012,  1807801376,  3594338032, 
-  4232708226,   457432595,  2723740929,  2020371381,  1224448561,   512092479, 
-  1742461194,   257760482,   556097737,  3461202317,   390445651,   602402286, 
-   671434945,  2787926796,  3435881682,  2354358294,  3897997259,   660622454, 
-   782448775,   334928619,  3389202884,  4139375849,  3093257543,  1796787955, 
-   425545494,  3752275082,  3096898833,  2854648239,  3633129237,  2050370854, 
-  2525948483,  3615012975,  4039355600,  1030552099,  2800879763,  1539138175, 
-  3316316360,  3095262611,  4147236474,  1419524826,  2321738391,  1365203055, 
-  2650595991,  2684935497,  2003355673,  3293643878,  3147280988,   443470620, 
-  3690871424,  1645099408,  4164704201,   220451202,  2826274138,  4177701850, 
-  1573022421,  2856043779,  4032503222,  1056724172,  3849695400,   758332912, 
-  3508097218,  2395093608,  1122643269,  4285666450,  1103478721,  4287556414, 
-  3990476227,  2146080389,  2747027294,  2074542677,  3596729255,  2316139905, 
-  1132453831,  1881789935,  4090051760,  2107972461,  2551319877,  1904143755, 
-   327306670,  3790337076,  3526722955,  2831746543,   940430649,  2146247235, 
-   905446557,  3758187595,  2148329389,  3170371856,  1273645305,  3132391005, 
-   951533814,  1560123673,  1435290724,  3194145015,  3084064687,  4129567898, 
-  2632607221,  2294218439,   601508288,   218004058,  2582064492,  2354218702, 
-  1894222804,   499853719,  3337431325,  3351687206,  3643260516,   770235505, 
-  3548322249,  2313584178,   381929436,  2206716544,  3362040016,   498240300, 
-  3839748743,  2586927019,   135399161,  1326067324,   476597485,   933707978, 
-   978482805,  4008205771,   300885486,  1167166326,  2285763775,  1492149783, 
-  1244906216,  2698562113,   645471238,  1079122374,  2953960491,  2465658237, 
-   364677831,   754184713,   546785829,  2327922758,  3560877661,  4145827749, 
-   819291645,  4056263908,   959212705,  1040347494,  2957523841,   717511793, 
-  2724210721,  2327206563,  2394410089,  2768713747,   734918443,  1093520262, 
-  3779692765,  2797193091,  2145936055,  3546494150,  1463634323,  3351537204, 
-  1965946435,  2297567105,  3026490839,  1255754067,  2394082550,   304550632, 
-   794421118,  3056954055,  2822547983,  4085463544,    36249359,  1747991107, 
-  3624814238,  3752039895,  3000394110,  3186695431,  2497601465,  1585081745, 
-  3621767194,  2898574039,  3815508553,  1045675410,  3076265381,  1478076007, 
-  2664607473,  2069536312,   839785277,  3697922498,   267320398,  2186060667, 
-  3303037224,   449663089,  1239825958,  1219625986,  4125913298,  4234400674, 
-  2676364525,  2601404829,  2765189257,  3356953497,  3375937256,  3515994907, 
-  1876987839,  1498267344,  2265476925,   367889907,  3919074660,  1648550670, 
-  1620468799,  3043895285,  1298260739,   317184987,  2022064146,  3494156830, 
-   830552756,  4225407548,   962273376,  2627560635,   344206200,  3826965285, 
-  4204182220,  1111444347,  1327886577,  3179961125,   472103598,   362335920, 
-   849169057,  2252454610,  2116354422,  2660385506,  2688032257,   415209234, 
-  2112313517,  1876700874,   392556227,  1425663721,  1850176903,  1886503568, 
-  2440571332,  3810933251,  2143812876,  2595484778,  1991533579,   223995138, 
-  2237306375,  3307954859,  2169212455,   624527001,  4192483096,   358876803, 
-  1061217270,  3077062334,   617560776,  2697441960,  4285912803,  3413943158, 
-   284118317,  3038226279,  1807353250,  1132493703,  2571590892,  3583837185, 
-  3370619702,   539480811,   344432748,  2573304276,  4249375878,  2944742501, 
-  1777725919,   464132616,   188278079,  1630558768,  1072710719,   337983860, 
-  3613329302,  1891093225,  3748516706,   726723249,   552150555,  2077675725, 
-   623623758,  1858802822,   213596251,  3619743051,  1932885430,  2554112044, 
-  3216844256,  1985463865,   277369900,  2832449950,  1069734324,  3112472403, 
-   170364628,  3609915876,  2363699219,   443641698,  2778864690,   123663923, 
-   286113310,   452903416,  4224284037,  3940024184,   343885949,   444571293, 
-  1261439016,  2648817663,  4270200685,    47436867,   265727534,   471083230, 
-  1348529338,  2146664924,    96903858,  1859855177,  3099311047,  3645364345, 
-  3187843443,  2371694820,  2626172479,   976522266,   358266233,   983488737, 
-  1852759717,  2398293234,   206129900,  3765600533,  1036012982,  1773395139, 
-  1423216957,   388523242,   950222769,  2575070352,  2372691011,  2834671062, 
-  1414114513,  1366247733,  3721300525,   179320341,   751416015,   532417066, 
-  3336503294,  1394662641,  2697160335,  4059078023,  4062508631,  2536751532, 
-   514778639,   362847413,  3072902020,   124821305,  2314096641,  1912778957, 
-  2662748482,  1385524251,  4090963984,  2825765499,  2720870111,  2008864452, 
-  1652302460,  3324537938,  1148366442,  2072823051,   308121380,  1059390875, 
-   592053108,  3501371062,  1862217989,  3780371122,  3607049836,  4195799604, 
-  1986831742,  2530494653,  3205871211,  1046250478,  1948317923,  1710279979, 
-  3884712341,   117043039,  2551469345,  2288096096,  1419050379,   932796197, 
-  3148217360,  3209377456,  3365959402,  2017953488,  2442340405,  2834023413, 
-  3427287347,  3475628104,  3941554677,  3187541784,  2596709862,  4026015481, 
-  3909374267,  1467178357,  1636288800,  4040377940,  2468623195,  3865660444, 
-  2251891621,  3217161084,  3985058102,  1074989309,  3074829683,  1448017088, 
-  3075508867,  3362052402,  2196101914,  2704315383,   489114285,  2429809682, 
-   499813232,  3164386519,   373607011,  3017628857,  3286215945,  1898684606, 
-  1148137255,  1559527257,   560170544,   480664152,  4194106873,  2708165810, 
-   308777994,  1605842659,  3228452121,  3285402548,  3292442465,  3046600146, 
-  1616709911,  2146896708,  1930381795,  2861445427,   229028791,  1357903430, 
-  1073704264,  1758275667,  2187234813,  3704609336,  1858703938,  2333371734, 
-  3515194586,  2135063212,   933327518,  1995594766,  2675827786,  2422964937, 
-  2209342030,  4015663835,  3481310139,  1440400777,  2285743697,  3653016669, 
-  2567871084,  1400912378,  3869699720,  2721698861,  3485550843,  3366488888, 
-  1595827021,  2778874761,   464963448,  1288308378,  1777281910,  3595463193, 
-  1623131775,   670166312,  1977984136,   617721182,  3161394125,  2784773451, 
-   902345592,  4233541014,  3790230141,  1553937811,   788890837,  1240730686, 
-   487573044,  2628474896,  2097267765,  2287004099,  2691078369,   903893021, 
-   389149274,  3199131500,  3430304205,   424170807,  1046774103,   433707329, 
-   480610973,    68730646,  1307697297,  3892435526,   194947920,  1285768943, 
-  1284657047,  1256331707,    99477712,  3240252930,   526183629,  3795951564, 
-  3894792689,  3712959257,  3019293779,  2846613219,  2642670629,  3777781936, 
-    22716752,   378300573,   347348156,  3514309797,  3830069637,  3898194397, 
-  2542426151,   846478665,  3215419628,   733320210,  2334467740,  3851559167, 
-  3565567346,  2544076050,  3967075721,  1592625633,  3478107110,  2212887523, 
-   310754472,  2850008540,  2710293250,  1067189868,  2313401279,  2852423238, 
-   448214273,   595529297,  2651858218,  3031660544,  4237781009,  4212106941, 
-  2052655309,  3378775715,  4189915312,  1898294219,  2321516603,  1952748618, 
-   758387305,  2203078494,   430532005,  3791319877,  1088975514,  2146942777, 
-  4013005102,  3007996013,  3139568486,  3673836561,   373748435,    16585688, 
-  4168762924,  2873741737,  3180326529,   852184942,  2848182834,  2428126276, 
-  4170428027,  2225762322,  1057113797,  2721534346,  3146284460,  3782558583, 
-   566222278,  4214800352,  1317557287,   374005309,  3096189813,  1764478923, 
-   246664343,  2554834955,  3045686641,  1824525570,  3150282310,  3887195738, 
-  2415692605,  2573980639,  1535440999,   677050493,  2672330373,    57644208, 
-    71535034,  2400073021,   291158368,  1159045227,  1611066057,  2318484401, 
-  1555272833,  2321712442,   502986380,  2333761685,  1765334266,   210156878, 
-  1460637057,   574678417,  3821604018,   222194493,  2713824177,  2611936976, 
-  1996562868,  1582287862,  1297674147,   543747440,  1629134641,  4121501212, 
-  3300032229,  2593901194,  2708450252,  1899392915,   764742998,   396861368, 
-  2737821854,  2958355405,  2065307334,  2885214855,  3839298628,  1742443743, 
-  3655317476,  1365562827,  2522764970,  4214734244,  1435542929,  1481101301, 
-  1103578754,    21273879,  2189280972,  3003137196,  2362656626,  2996537415, 
-   143043432,  3280688552,  1618545887,  1040020463,  2710768915,  2229949166, 
-  1186815609,  3366660091,  1586917161,  3021917985,  4047868572,  1237740359, 
-  1822346667,  4279477136,  3977991530,  4140356510,  2253610581,  3132736045, 
-    69504757,  2428376474,  1502664549,  1475568354,   267054566,  2175307837, 
-    84508055,  3759702069,   130475856,  1358478684,  2832527710,  1839693402, 
-  4185671881,  2318233026,  3651622922,  2271898556,  3814578192,  1807435167, 
-  3913487356,  3602250580,   499528023,  3946823882,  1572976367,  2080946266, 
-    34055852,  3148392021,   895443174,  3954610705,  3378432594,  2830823963, 
-  1027356081,  1673355864,   798247312,  2145468993,  1383365136,   766001476, 
-  1457679859,  2509463491,  2350032143,   769776897,  3684191143,  3451854781, 
-   910096038,   998677542,   109790215,  2670913565,  1195688678,  3206051403, 
-  3154770804,  1631397301,    92437531,   581944926,  2160177943,   749303888, 
-  3594925975,  2495474193,    32119830,     8309863,  1188909486,   192042071, 
-  4028940647,  2266497288,  1348545681,   310863694,   692799134,  3647928448, 
-  1216787192,   949756435,  2828479579,  2723603575,  4150296553,  2955372059, 
-  2198046202,  2877909514,  2564575766,   730447699,  1866130585,  3195984645, 
-  2366015389,  3432433897,   751669731,  4189968611,   879636283,  1860262844, 
-   216608313,  2902440256,   428172571,  3645874494,  3236661468,  2712402867, 
-  2296003721,  1865850021,   397325776,  1240865784,  3435980009,  2008315743, 
-  1800341700,  2117661641,  2496477680,  2421569492,  2539749283,   365548651, 
-  1888808742,  2948509522,  2128036350,  1471389490,   635442872,  2706344497, 
-  3765378023,  2446881072,  3471465451,     9932420,   180807759,  1420456916, 
-  1212391146,  2260996066,  1891190459,  3672995904,  1676602820,  2927478447, 
-  1616320744,  3461806817,  1132318016,  2841226247,   985333802,   298446377, 
-   621399270,  2325544451,  3462005729,  1694028704,   181288484,  1349584393, 
-   859461033,  2645260639,  3174009121,  1291576931,  3927279180,  3544518086, 
-  4001857869,  1928072106,  2771901152,  1084307125,  4278035844,  4076723613, 
-  1612976093,   982534353,   149444476,  2201781145,  4112753020,  3691609587, 
-   595720654,  2795325713,   327033695,   509335221,  1518293087,   620747160, 
-  3773865409,   639823214,  1856509195,   470021167,  4286922946,  3230054827, 
-  2407695705,  1616607911,  1899704051,  4003205001,  1462057876,  2501048596, 
-  4199403578,   599170256,  1196093532,  4062805763,  1709543229,  2778971928, 
-   857263440,  1330570179,  2942946560,  1626620279,  3997622819,  4220625490, 
-  1254297547,   516614371,  3099297836,  2639748765,  3956672787,   886993962, 
-  2874418179,  2718402325,  4051505039,   776617086,   782027760,    34381095, 
-   361145974,  1709285142,  2935138248,   520542504,  4200397837,   577276857, 
-  3634139709,  4277579036,  2093528544,  4085175454,  2388631144,   870344456, 
-  3409862124,  4079726874,  1512644722,  2623222854,   945634120,  3317638018, 
-  1312160061,   116870158,  2900219183,  2830380501,  2254980741,  3698154223, 
-  3114493575,   586616941,  3372627488,  2823936551,  3182789005,  3892418438, 
-   172888702,  2742912415,   324497803,   776679644,  1819129798,  1107177905, 
-    61158986,  3439411412,  1357444221,  2486060858,  3222792163,  1709547360, 
-  2653352176,  4198145871,   297040167,  2351288226,  4237784701,  2421903375, 
-  1509706924,   741488058,  3389086751,  3673212679,  1009885160,  2759918187, 
-  2290998878,  4165171272,  4277524818,  1127625265,   490346939,  3022297930, 
-  2379616953,  1957930406,  1009323672,   425529505,  2465414961,  4177328691, 
-  1535050471,   205259579,  1138432521,   174904625,  1150480251,  4162868817, 
-  2091183457,  3095121355,   852383460,  1255501169,  2109414379,  2816663951, 
-  4041482143,  4105836758,  1715237511,  4144657832,   769161682,   793338649, 
-  2634729229,   824270252,  2081166572,  2056841376,  1146119424,  1539527553, 
-  3143334995,  3355121028,  2222362113,  1544034508,  2662952856,  2649581069, 
-  2022495198,   191335762,  1864623409,  4141567408,  1800359856,   963756409, 
-  1281793579,  3227472576,   344343982,  1906127333,   664565645,  2647466526, 
-   849094294,   169414882,   623204924,  1827467304,  2062291263,  2149400142, 
-   868449678,     1329300,   784048146,  2890365326,  2432086385,  1863932546, 
-  2795534741,  3501626395,  2996408061,  3024307585,  4246907165,  2436993335, 
-  1125079741,  1901301673,   355917598,  3279757573,  1200782823,   243420303, 
-  3134429784,   558648801,   511540772,  1940687583,  2400760801,  3935237053, 
-   394348952,  1984759116,  4065067427,  2896131585,  2642760802,  2764111011, 
-  1670990134,  3076661984,  3717278105,  3686657598,  2560002030,  2486737057, 
-  3605008764,   711639349,  2930668111,  1144066603,  1334230250,  4081543931, 
-  3693490142,  2299958928,  2897321413,  1228353395,  4158885954,  1807071706, 
-    29447256,  1338644113,  3746130342,  3704087795,  1889549207,  3411481540, 
-  2329660613,   818290923,   315255992,  2573235101,  4212394297,  1697632381, 
-  3599266502,  3346757542,  1243086796,  3028917682,   268264192,  4248373027, 
-   822266896,  3715176857,  1378512965,  1324416727,  1589029736,  2081751026, 
-  1622243378,  3572061853,   795637184,  1488813169,  3862672732,   811758990, 
-  3504965683,  2544365837,  2740344548,  3972139361,  1538818870,  1779600287, 
-  4100842876,  3293669663,  4025719527,  2557962505,  3227875123,   647440755, 
-  1355533782,   447309103,    14304448,  1771538706,  3888859349,  3247602379, 
-   790935303,  1738176595,  3792256520,  4191116567,   754992251,  3197243026, 
-  3404667817,   949626336,   410801946,   985874981,  1958126054,  3870529098, 
-  3719747524,  3953107150,  3111720710,  3410004463,   387345002,  2599429619, 
-  3802229859,  1879275672,  3012469321,  1270899899,  3469136444,  4139676786, 
-   999459478,  3329147702,  1080769212,  1459627146,  2636740380,  2477731833, 
-   113159666,  1431903314,   268865106,  1114757786,  2485241148,  1304047277, 
-  3185293040,  3701391231,  4036134019,   527750097,  1666128667,   567150503, 
-  2607036762,  1443621927,   440486455,  3830754344,  2638523286,  2830073062, 
-  2615421776,  1640206496,  1612897042,  2719863852,  2697202341,  1885095876, 
-  3404280017,  2047655539,  1709051397,   371506757,   878013368,  4194786378, 
-  1822174164,  2726051755,  1672779029,    80135120,  3453241998,  3130344013, 
-  2601688135,  3773865298,  3016339318,  2569995298,   339116268,  2260115186, 
-  3772695985,  2475366368,  1926294573,  2800832672,  2208092404,  1189120818, 
-  1711040530,  4254805134,  3665702542,  3842921779,  4221766719,  2342004301, 
-  4075087035,  4175460611,  3659246192,  3965809560,  2238786956,  2773291408, 
-  1928285807,  3033533641,  3074856939,  3161049670,  2608521306,  3930353671, 
-  2571515253,  2085552066,  4194037957,   511973480,  2499380540,   944195594, 
-  4180792335,  3743557037,  2280547658,  1850744142,  1521526298,  3059563815, 
-  1015532926,  2147466773,  3427059515,  3131036326,  1867868090,  3232970999, 
-  3852547188,   693721535,  2091266059,  3188691140,  1661412903,  3475173062, 
-  4130036801,   571226058,   117615426,  2972527569,  2032544684,  2406499012, 
-  4115181329,  2067643243,  3094569315,  2822415764,  2218541712,  3684725605, 
-  3462974996,   464208135,   605994560,  2458207916,  2858223078,  3934673418, 
-  1935489361,   378929675,   172415536,  1769981989,   591121985,  2229910726, 
-  4261953279,  1332016129,  4222767231,  3201597084,   203037517,  1601882355, 
-   781058504,  3891916536,  3568745584,  1991658462,   107329491,   472259933, 
-  3676563766,   446878072,   642852298,  1899001774,   838669806,   653467021, 
-  2101023706,   206611966,  1595600115,  1616591920,  4224249385,  3246745620, 
-  2071796976,  3405613580,  1608271185,  4091624060,   801790673,  4283900258, 
-    82343951,   783605951,   683002059,  2002417266,   936920854,  3484142676, 
-  3180180901,  2869711856,  2471388517,   997211345,  2823009280,   433086067, 
-  2848465143,  1936509574,   516892963,  1958134098,  3419122943,  1832282764, 
-  2512447557,  1417563637,   294901197,  1670989804,  3005116175,  3022893523, 
-   582243748,  3593130119,   976733859,  1395093680,  1817437630,  2330353596, 
-  3930967331,  2737585872,  3032409765,  3092721354,  1065337966,  1251414820, 
-   916623326,  2077292298,   395995498,  2550472462,  2797783377,   795879098, 
-  2733219989,  2500566562,   270286102,  4002215531,  3936098543,   496998143, 
-  2281125753,  3498677177,   764788956,   159898809,  1660990008,  1541077028, 
-  4246043148,   603605509,   899341978,  2809616720,   676177330,  2832048003, 
-  3924207300,   495378455,   201555053,  1988648479,  1056297493,  3991293597, 
-  1404275089,   383079708,  4222422742,  1548278394,  3283938152,  1372745408, 
-   838243958,  2755156191,  2316938131,  2584700269,   471727909,  2224130719, 
-  2294277431,  2369124831,  2109942119,   370697567,  1377753093,  2550567262, 
-  3870370125,   599298091,  1303496645,  3237575757,  3113466090,  3618922888, 
-   519508304,  3587756588,  2258990681,   203345601,    91535557,   969849140, 
-  2291356926,  1250905121,  2334442063,  3407231458,  2252443027,   322070264, 
-  1357109122,   633800327,  3210172433,  3002781024,  4183025681,  1575153727, 
-  2542544389,  1855743410,  3060162824,  1236197534,  1282557344,  3016668861, 
-  2174604750,    23908394,   681658101,   537064161,  2501731678,  1536286270, 
-  2872347311,  1281239349,   586541560,  1959219596,  1046209534,  1018338763, 
-  1276499355,  2286354884,   726156767,  1378208131,    97112787,  2821784117, 
-   936136809,  3147630878,  3805143872,  2972816609,  1319190863,  1736632475, 
-  1973581109,  1425660984,  2126944171,  2071656274,  1703258686,    29343300, 
-  3015177650,  3382201673,  3732562020,  2515171840,   656875886,  3019164621, 
-  2741073651,  2144085178,  3420925789,   382258311,  2535476949,  2582507031, 
-  3629353314,  1538693175,  1254657212,  2245177877,  3770656720,  1352128744, 
-  1790882525,   867578027,  2364506578,  1368027273,  1743562898,  3778781081, 
-  3576537185,   778948138,  2549347781,  1662814869,  3397621888,   285259933, 
-  4147635618,   263524358,  3316574690,  3880248657,  1155880784,  1578561702, 
-  3993236667,  3922811875,  1261905771,   593503073,  2644670866,  2025933743, 
-   143456450,  2353586959,  2912872917,  1402576367,   577066513,   331304989, 
-  2239872153,   521822184,  1843583474,  2795789400,  1699725961,  2466052069, 
-  1640961861,  3605195187,  2849626108,   563329912,  3632066803,   955556963, 
-  1212763395,   930215731,  1916221857,    37031083,  3951269627,  2683575442, 
-  1860018359,  3873194583,  1396622807,  1205448629,  2917531341,  2935324393, 
-  1928095429,  2841954087,  3856334280,  2824252342,   797712414,   840794584, 
-  2925979994,  3563208682,   135927275,  4128049473,  4040917978,  3866783142, 
-   536443286,  1540488742,  3093019791,  3529228602,   358356128,  2785952915, 
-  2381020483,   186346999,  1367649629,  1639779263,  3732541776,  1266582110, 
-  3940357229,   819622590,  3464884833,   786203927,  2910632440,  1987712170, 
-  1817502354,  3115656915,  3089075030,  3386376201,  3252971751,  3230338991, 
-  2535126588,  3330129830,    74643585,   553408912,  3475402431,  1037848350, 
-   352661153,  3399302189,  3286975549,  2181832290,  4035855336,  1020046106, 
-  1051904362,  3898599528,    29277910,  3650780514,  1637318512,  1994702789, 
-  3871250515,  2806587771,  2097657919,  4009148701,  1474748364,  1126574905, 
-  2639218051,   755051211,  3683338849,  3141710644,  3751510973,   889230029, 
-  1237329728,   833459958,   392945970,   449430315,    64642744,  2195931272, 
-  1401142943,  4099049128,   780970851,  3953993883,  2733310615,   104700104, 
-  1118812605,  2280822118,  3194085371,  1112123419,  2448605642,  1902745994, 
-  4063571582,  3178219388,  2970224427,   724274611,  1412286093,   615767996, 
-  3085676126,  3513150461,  3137712329,  2143830960,  2850353785,  1212305547, 
-    74852197,  2445551769,  1005362461,   941641287,  4052871852,  1092002414, 
-  2725865524,  2526413613,  1059555426,  1076946550,  3538510762,  2329057682, 
-  3511187788,  2849411922,  1139811627,  3061395323,  2116084564,   381685341, 
-   816400517,  2165110498,   980734239,   386657644,  1571390551,   390323586, 
-  2331707082,  3558875544,  3506959807,  3520038727,   686379125,  2895121099, 
-  3330964124,  2016046547,  2650541376,  2207051533,  2260443202,  1493558613, 
-  2471201440,  1122187202,  3266482314,     1868021,  1221442941,  1952304867, 
-   384028932,  3165256251,    12527618,  3977181174,  1492907780,  3009556627, 
-  3977583863,  3379813604,  1889781080,  4259888740,  2420970822,  1699427027, 
-  1175377122,  2202096630,  1770224295,  1171211600,  2455140285,  4053182825, 
-   944758496,  1597909858,   463061874,  2232532298,  2411223999,  1139588852, 
-  3796531775,  4105629343,  1637691674,  2527454876,  1536808133,  2852654071, 
-  3896204661,  4070277420,  1143892920,  1475779675,  3721192605,   365494379, 
-  2240105858,  1898622869,   456838428,   207756399,   946240179,   206948081, 
-   271800717,   199415206,  3356828747,   814588650,  2060454121,  3182382772, 
-  3750581551,  4102053057,  3276262693,  1208904500,   539003542,  1862037122, 
-   973099642,  1499447226,  3614841299,  2517497890,  3230388048,  3482919703, 
-   723407579,  3926681154,   622624116,  3904307605,  4166741301,  3107571573, 
-  2235705219,  2945309222,  1708269882,  1036309815,  4167741176,  2195231503, 
-   848597511,   765355692,   296229400,  3545225635,  1918164295,  2057010462, 
-   581446345,   442851392,  3230075566,  3728924474,   449187706,   114639649, 
-  3705662639,  3074346106,  2226582939,  3729645923,  3935242945,  2309924481, 
-  1741852893,  3814741953,   525025638,  2216236049,  3979473501,   421912565, 
-  3033475582,  1325270585,  3801952106,  2693236538,    22208203,  1467190946, 
-  2542324081,  2570807058,  2751078654,  4083489366,  3018407987,  2071390148, 
-  3738953616,  3956048845,  2211559693,  3862511950,   430120904,    64326780, 
-  2293129246,  1517867649,  2770831408,  3098716545,   183585007,  1845552118, 
-   390403222,  1162688848,  2889236814,   407679451,  2855660430,   420489025, 
-  2643393158,  1875049493,   424036486,  4111953626,  4253158843,  2961056342, 
-  2309869438,  4123989838,   175919189,  2887790791,  3866644744,  3326340064, 
-   632304229,  2991469835,  3322737047,   708702870,  2988425985,  2829771284, 
-  1523181631,  2527240962,  2640616941,   688164131,   338605364,    87517713, 
-  3754193722,  1377558772,   337662800,  1487208076,  2325128420,  1934865177, 
-  2875201548,  1352387826,  3143927189,  1037189485,  1055525799,   407904414, 
-  3710121883,  1040366139,   874244021,   703814052,   774455800,  3811807466, 
-   839242786,  1194176659,  1419320144,   498708910,  3089671285,  1161094660, 
-   238148702,  1804469148,  1747063815,  3013853053,  2231179061,  2898003259, 
-  1442375647,  2109263241,  2145268407,   178546186,   238635795,   499268376, 
-   486625745,  3046669688,  2828766431,  3074672917,   349843002,  1313292480, 
-  3908442651,  3724956816,  3212179813,    83624531,  2169929907,  3825124193, 
-   193375308,  3198139592,  3570643537,  2989754139,  4047510071,   434353242, 
-  1650149464,  1179606754,    49953833,  4026100689,  4243831993,  3512275996, 
-  1113188382,  2088852879,   465263763,  3332078346,   336106143,  1651549264, 
-  3204904151,  3183389320,  1092655450,  2926527994,  3492339855,   574309614, 
-    98507761,   969703112,    44345394,  3511994644,  3118924378,  1319864374, 
-   702727724,   995079335,   419087034,   562711223,  2662464081,  2558429782, 
-  3572071170,  3375881754,  1471854996,   253249227,  2425588467,   580767733, 
-  3137280469,  1634309807,   978285263,  1844504430,  3199882524,   817960461, 
-  1352360984,  3596142264,   830961296,  1734683034,  1581853387,  1212770001, 
-  1614721151,   648750139,   244923711,   773579549,   955934474,   467854313, 
-  1474873247,  4181382394,   281538129,  3799010667,  4222967255,  1854767500, 
-  2124756647,  3999995576,  1127287394,  4001234395,  3743570651,  2842658396, 
-  3397737099,  1185009615,  3133872849,  1396296382,  1346366157,  2899317580, 
-   866432252,   468586107,  2875124331,  1295914846,   394440694,   934963917, 
-  2556626790,  1877075961,  3123161114,  1292838783,  1879676239,   457177063, 
-   433304087,  3331322297,   383103863,  3485407751,  1250484883,  1170071844, 
-   441485963,  3543581914,  1982298251,  4249365123,   344212536,  3970909841, 
-  1717508150,  2284202754,  3634754158,   274570737,  2641341540,  1758214478, 
-  2500647437,  3487295683,  2359669822,  3609102617,  1735187948,  3074233986, 
-  1376909520,   359703637,  1116596426,  3900372815,  3214141768,  2392663321, 
-  1002272123,  3774288810,  2761154042,  3061309599,  3627796635,  4091039436, 
-  1635530677,   851099203,  1545654027,  1939046055,  1831642698,   785528978, 
-  3310687475,   654213097,  4092184789,  2220416855,  3446037347,   868553190, 
-  3565446852,   679203235,  1924692916,  2493153164,   355954564,  2276481792, 
-  2015048115,  1705620779,  2798094220,  2461858984,  2100851563,  3975761973, 
-   158457629,   685607782,  3725711933,  3341731355,  2516273098,   762735153, 
-  1856696078,  2002797523,   899371219,  1081356743,  3075613203,   921542687, 
-   678207955,  2700061961,  1539496426,  2107145159,  1891059555,  1330785482, 
-  2027986378,  3013110804,  4051671089,  1292616417,  2029970969,  2782117132, 
-  1100081696,  2618672869,   571066633,  2777339598,  1894975020,  2908532667, 
-  3754462205,   893643138,  2987301968,  1209802551,  2626292508,   368186672, 
-  2752353354,  4227352596,  1815496647,  1395156245,  3656522944,   591539754, 
-   227837719,   172314071,  3968807181,  3235901995,   414406665,  1254292788, 
-  3430616454,  1011330657,  1093823932,  2077907406,  4225377577,  3470139592, 
-  4214275271,  1864474371,  1239944690,   277434671,   668256860,   851402703, 
-   269146227,  3608576036,   306561328,   637916055,   328503754,  1182872920, 
-  2496713049,  2870234737,  1138530125,  3663924297,   942413631,  1643043796, 
-  1500063476,  1838818672,  3047733503,  3727101554,  1524461636,  1750260055, 
-  2500012255,  1423257151,  4288426177,  4162410522,  2321689396,  2848946495, 
-  2121028605,  2625872309,   513584923,  1239464261,  1917720050,  3250545325, 
-  2121146694,  3151940222,  2191863909,   865931964,   586332119,  3563052577, 
-  1939928449,   209869832,  1737837992,  3652120840,  3253175653,   626463420, 
-  2088004265,   324050558,  2499110141,   190990746,  4070894084,  1180420592, 
-   288285864,  4143632145,  1213345422,  2171772484,  2735325298,  2487876662, 
-   817797728,  3542229393,  1661612211,  3853880785,  1903112045,  2211136958, 
-  4229973096,  3934296093,  2017937683,  1701583029,  2867910911,  1952962126, 
-  2218120897,   391498315,  1922393632,  1836782326,  4116989016,   619955432, 
-  1322948293,  3089639532,  2131079992,   393428184,  2724424973,  3524517528, 
-  3541111121,   738561409,  1791117834,  2301355750,  2321123145,   925395337, 
-  1492239258,  3331397753,  1342569086,  3944026722,  2842951129,  2931276516, 
-  3742354486,     3030172,  3927681470,  2286004850,  1062378285,  1887676814, 
-  2441344744,  1775154441,  4220183767,  2952417397,  3748295167,  1543055858, 
-   628237509,   857701432,   517538599,   831539125,    33930395,  1383403546, 
-  1026559897,   286569105,   579008531,  1675232333,   874455592,  1620980393, 
-   883072518,  2899336565,  2356509468,  2734728140,  2519756835,  4280957773, 
-  1288945959,  1553420449,  1256898872,   511903866,   628923414,   157625413, 
-   801753079,  1053157281,  3143374566,  4201753809,  2762737338,  3163930922, 
-  2491827906,  1649444925,  2569984203,  2115589290,  3295133390,  2827146286, 
-   208484930,  3914886612,  1330492083,   867856478,  4223929065,  4234992473, 
-  1521226297,  3948665610,   563462025,  3586311094,  2913581933,  3722449010, 
-   646927618,  2039014007,  2171892743,  1436136797,  3127082741,  3292247596, 
-  3546091236,    99564913,  1908293258,  4151746490,  4226865204,  3083801348, 
-  3510826166,  2671177047,   938419497,  3180378491,  1169049140,    17742673, 
-  3265088809,  3700450378,  1419928462,  3934238187,  1926904571,  1495296292, 
-  1997592025,  3451255489,  1082563396,  2810668966,  1744767105,  2194989135, 
-  3147700690,   537211103,  4285675261,  3381533328,  3639054670,  1661367045, 
-  2576492154,    70580777,  4006824903,  2241051423,  2928020929,  3953433785, 
-  3924696879,  4184899467,  3495748468,  1476473360,  2301803984,  2106198436, 
-  1591316976,  3875849555,  3576553758,  3171493827,   465318360,  3632476371, 
-  1408089568,   291155017,  1865080066,  1276161913,  4289818155,  3404257880, 
-  4148343813,  4094770428,  1642179686,  3537040458,   297689520,   420234650, 
-   920980189,  2333001610,  2674729472,  3121055833,  1338370168,   216923715, 
-  1556952763,  1365504817,  2033486773,   380576627,  1468459222,  2968503350, 
-   940698214,  2714747808,  3262058109,  1104844280,  3370682448,  1319165327, 
-  3301205855,  3032433026,  4260178144,  3325716893,  2200977245,  2898343462, 
-   351070049,  2003064435,  3205089424,  2804874866,  1779009959,  2638900657, 
-  1600693405,   796576793,  3151281018,  3367963324,   854983101,  4128925175, 
-  2450770784,  1924002481,   579308207,  3117586963,  3919724533,   691943386, 
-   757599247,  2684236234,  3206719957,  2699904438,  2042608971,  2393779404, 
-  2277929892,  1572153148,  3774023818,  2027946732,  2960559026,  2005732955, 
-  2499434119,    64947910,  2565434311,  3810956926,  2440824010,  1898551064, 
-  3263545052,  3177313383,  3648451964,  2840383280,  2928494464,  2166830613, 
-   608806474,  3621293591,  3427131904,  3382345060,   788934427,  3865305670, 
-  3577314770,  3167941655,  1279163642,  1729569331,     1207214,  2950916794, 
-  3864512111,  3389192771,   752046548,  1515434426,   997690216,  3505659794, 
-  3895272529,   296425808,   643127582,  1972601734,  3639530407,  4141670406, 
-   361172069,  3539059435,  1817178915,   598761762,  1469523986,  3193159294, 
-   866293938,  3237019262,  2869836955,  4269123698,  3235076247,  1368621222, 
-  2250886150,  2561607496,  3559629909,  3273087555,  4053333755,   178486588, 
-  3632843181,  2812010694,  3263314562,   824634745,  2301264245,  2456133525, 
-  1675599338,  3315118423,  1393985525,   980789663,   476702784,  2178950433, 
-   500698754,  3010869880,  3060303247,  4071704276,   460352586,  3223821211, 
-   913376882,   803906269,  2619703404,  1584684712,  2696900624,  3274299619, 
-  3985978667,  2034982218,   239903217,  1984838672,  3578536305,  3043720666, 
-   615211137,   101600950,   715721157,  3437061955,  3747376403,    42140530, 
-   635982506,  3242725442,   520431252,  1639259861,   107858406,  1331489288, 
-  1921043255,  1505095515,  3690620561,  1183750794,   769017706,  1510911966, 
-  3746425517,  1855035567,  2898406359,  2577489192,  4179395842,  3515582410, 
-  1663833699,  3973486507,  2792376276,   183910268,  3320717824,  1077842671, 
-  3699934121,  2186863283,  2896820892,    58178520,  2689129967,  1922412142, 
-  1393645920,  1995231082,    32894555,   425964777,  1889855384,  4097774513, 
-  1154833833,  2430117478,  3918657985,  1545458579,  1081887548,  3861723175, 
-  2822689576,   115712318,  2694016307,   356684833,  1219712168,  2574748899, 
-   800070925,   289749088,  2837537096,   892499662,  1452443641,   415426445, 
-  1425990069,  1872742740,  2215820852,   177457044,  1100613269,  3599109967, 
-   907079945,  1453357583,  1202390484,  3544213622,  3654317420,  2409493986, 
-  2772374320,  2530100139,  1229944185,   389394062,  3333084479,  1833509362, 
-  1359547362,  3963650481,  3538647430,  3885901231,  1938234575,  3237698574, 
-  1095164929,   451340437,  1130039945,   443106097,  3257138446,  3744804616, 
-  3629646878,   473803546,  2398508292,  1894729953,  1093255142,   900439630, 
-  3954936601,  1566486586,   467405763,  1017012785,  2117790258,   188793275, 
-  1680981424,  3599914171,  4142257509,  2896085394,   557240418,  1923809286, 
-   447938253,  1735752973,  3115225541,  2235420031,  1355422930,  1783837467, 
-  3290559863,   575293648,  3297683274,    42874588,  1663833294,  2015945376, 
-  1643208162,  2344037430,  2160719220,  2465921836,  3896515851,  3991012157, 
-  3815943328,   268294775,  4243904347,  2415519497,    19455403,   378112243, 
-  2605757292,  2287102565,  2245037683,   808256055,  4278667668,  2159373078, 
-  1454796439,  2198491427,  1225175406,  3745409665,   137477630,  2695485599, 
-  2414237566,   933981095,  2662326363,  1747663035,  1504515725,  3085241372, 
-   361665789,  2345472403,  1148425120,  2097015246,  3842949763,  1848305680, 
-   288048475,  4132106109,   519617865,  3597944069,  3337092561,  2972671666, 
-  2228405632,   517749907,  2943198792,  3771566845,  1895335285,  2401261476, 
-   810876082,  3839081991,   624182451,   254961217,   639746743,  1407040878, 
-  3110626871,  2455685679,   604247482,   150546190,  1255401003,  1753571529, 
-  3050750002,  3549498251,  3913973870,  3536333818,  4105242633,  1835557928, 
-  1763259727,  4250754451,  4140524204,  3692083635,  3006956770,  1074101598, 
-  2933586203,   535035668,  1795971882,  1714325059,  1293581371,   580289863, 
-  1123881481,  1190664137,  3700342517,  4025085872,  3211899352,   948846146, 
-  1937873168,  2704414723,  1407200795,  1713499416,  2624391995,  2655295862, 
-  3426311077,  1264157065,  2812340154,   642485737,   333443271,  2677708380, 
-   879358299,  1391153382,   720197301,  2023684818,   570560170,  3511415508, 
-  1567749152,  4009773330,  2806119776,   777587027,  2009630676,  2469740750, 
-  3727540828,   835384616,  2268496103,   525405700,  1811150914,  3223115141, 
-   342004968,  3757915048,  4180484379,   570089809,  3349936441,  3687197747, 
-  3282099785,  2983185937,    78078534,  2643239794,  1756561209,  1974892167, 
-   974083433,   973264248,  4237854382,  3704853235,  3742006177,   807497594, 
-   634769922,  3955247283,  3151943895,  1985439529,  1641635804,  2285305024, 
-  3797394921,  1134335831,  2140795995,  1476262462,  2258124972,  1957698352, 
-  3296214193,   153548571,  1204699054,   265882911,  3474381251,   209496848, 
-  1086862158,  3755700704,  3855669916,  1916847215,  3843984825,   425255623, 
-  1651569974,   888638305,  2358433222,   364069493,  2763643527,  2069300581, 
-  2319559404,  2870554337,   311344724,  3648800678,  3289791952,   707401797, 
-  3074177958,  3850167347,  2288028887,   616132856,   810903254,  3580373522, 
-  3488049832,  3143672686,  2692525474,  1644820370,  3125945713,   237224859, 
-  1157459071,  2057495106,  4182168061,  1116407876,   240729864,  3824454200, 
-  1723719020,  1236382758,  3431939370,  2224266607,  4204346937,  3363328485, 
-  2237374042,    71191996,  3061999551,  2403460118,  1372439412,   862282158, 
-  3148690741,  4286323139,  3710979391,   578548364,   186542282,   683598959, 
-  2087196436,   247803495,  1142699289,    59847742,  1204840302,   187014583, 
-   250152825,  3340800210,  1087595108,   330866103,  2835314845,  1642882435, 
-  2804105338,  2812995513,  3981828822,   747480815,  3842247017,  2841337852, 
-  3482887777,  4203629376,  3365222002,  1072888913,   680143767,  2204166447, 
-  1884715701,   674917415,  1473734371,  3945503110,  3596620161,  3334748118, 
-  3300084893,  2492957302,  3049412021,   994277436,  3206050306,  1944412199, 
-  3601293051,  2514820405,  2230227227,   724778748,  2245829713,    39132111, 
-   806880163,  4008326252,   533738425,   885550631,  1520895408,  2302360135, 
-  1873093507,  3955474775,  2800071814,  2313530461,  1124954732,   867180261, 
-  1457885723,  2314766908,  3543981099,  2966626280,   667902968,  3883416168, 
-   414357406,   752110526,  1070440292,  4077655817,  1100791910,   236406864, 
-   909802337,  3479887861,   649520604,  2423476243,   286998915,  3431368157, 
-  3437717636,  1760728864,  2542241473,    66366565,  1242149946,  3442593908, 
-  1408586695,  1438600814,  3011452729,  2660448380,    23595657,   629611930, 
-  3732298805,  3760589089,  3528948952,  4240739491,   109242076,  3150487645, 
-  2423120261,  3717383267,  1844131905,   438982756,  3407683931,  2387567970, 
-   268556391,   565221627,  3770099810,  1707904397,  2923141830,  2482448093, 
-   191328508,  3383811202,  3381816866,  3134155565,  2674448387,  1238678975, 
-  2170436545,  3629871948,  2623332598,  3813943246,  1740549543,  1408134015, 
-  3434471595,  2462042097,  1307167232,   575549549,  4249762247,  3761316935, 
-   883104213,  2329505383,  1188052589,  1475541834,  1801130757,  2148292509, 
-   681291508,   142225748,   173993155,  3007218784,  1976344952,  2005760891, 
-  1811605462,  1609972396,  4195278419,  1425001355,  2757109763,   834425523, 
-   545013189,   769411186,  3172004663,  4124444609,  3802264321,   448359697, 
-  1100129839,   258535169,  3953302339,   270747164,   308236855,   524889094, 
-  1851320094,  3369178833,   213712271,  3304309355,  2134560308,  2774538520, 
-   311491702,  1814805675,  3712168021,    21768287,   904842645,  4126509201, 
-  3823951997,  1316958430,  1455576646,  3096105169,  4044969918,  1284052253, 
-   846980168,   591303280,  2686083819,  3992045645,  3114265890,  1042335392, 
-  4081432386,   989483005,  1971232107,   486767349,  2030679048,   883373589, 
-  2403191840,  2862473751,  1065332708,  1338048139,  4109789661,    57155867, 
-  1659183950,   787634289,   754296835,  2594934024,  1032043664,  1093409479, 
-  3504049169,  3064356791,  1152719159,  1761080497,  1667729582,  1436165815, 
-   626662336,  3233415496,  4273368940,  1670716724,  2256715057,  3863206376, 
-  3792517389,  3177041971,  2760736768,  3145039908,  3923207379,   665413968, 
-   702173878,     9328426,   880869195,  1487706853,  3545249773,  4230235865, 
-    65515209,  3224216548,   944580818,   624833788,  3840687245,  3362824547, 
-  4164227892,  3167684237,   139232760,  1463199728,  4016008678,  1700906202, 
-   748486853,   915047742,   259661584,  3194165678,  3861330628,  3220616686, 
-  4041546998,  3570521945,  1667321530,  4223951408,  2444758086,  2641828603, 
-  4276356901,    38913498,  4149588176,  3954865993,   522184291,  1273797019, 
-  1578771845,  2780867933,  3279439478,  3602931718,   913716068,  3134853337, 
-  1683607560,   945019770,  2361087003,     9275724,  3902384121,  2095502874, 
-  1883929364,  2242244668,  2535321479,  2892550374,  2392127565,  1903195543, 
-  3035540274,  1447638267,  3085293725,  3124523785,  1194853006,   626685088, 
-  1572514856,  2348981666,  2567565287,  3595568879,  1027475886,  3981345480, 
-  3474560614,   313379860,  2313036220,  3272093374,  1723905545,  3605594221, 
-  4278402458,  3106094709,  3660962189,  2276473004,  4152820705,  2821237048, 
-   751159090,  1445331702,  2536994808,  3190831176,  1139630724,  1867231404, 
-  2748568981,   569612501,  3088352550,   809921908,  3895020814,   726374409, 
-  3490486399,  3524137776,  2683694643,  3866915654,  2325089664,  1077448516, 
-  2786608262,   403812955,  1115729138,   101650505,   764604386,  1139325243, 
-  4085798343,  1802041598,   647865270,  3171701613,   837367508,   516189547, 
-   438483395,  1501007190,  2269635276,  4260018027,  3044250824,  2406411723, 
-  2390227831,  3002330984,  1031985942,    23660078,  3912581373,  3395845422, 
-  3600925050,  1421096467,  4270657414,  2800038724,   636426862,  2405397120, 
-  2223257306,  2424520736,  1588833155,  3129747855,  2817628947,  2502587310, 
-  3783799729,  3719036529,  3710741047,  3390091952,  4054771701,   235845340, 
-  2651477570,  2520603447,  3216105904,  1361901482,    33884401,  4180263994, 
-   660596015,  2731607942,  3902049159,  1502822597,  2034011243,   325242280, 
-  3909921622,  2000681693,  3755635634,   251961710,  3470651776,  1921306581, 
-  1781151016,  2900860521,  4150641703,  1656038107,  1734712603,   746924759, 
-  4052044672,  2385307182,  3916445825,  2677310482,  3658883238,   933331015, 
-    32024562,   616255080,  3005148466,   783579841,    17521483,  2775112113, 
-  3224936893,   208168772,  2078102609,  2485224226,  3789939930,  2414304282, 
-  4156278493,  2737951388,  2911830211,  2394240861,  1590306578,  2456781349, 
-  3697633457,  1839958827,  1039986577,   633352680,  2859419272,  2182815620, 
-  1376226267,    10834770,  1871577558,   151050864,  1364664990,  1532269991, 
-  3805494143,  2770543190,  2043449529,  1505592242,  1444924366,   240651465, 
-  1690405391,  3016103695,  3416626087,  3632284954,  3541945081,  3905383460, 
-  3450580627,  1361531205,   231218864,   856359863,  2785677417,  2084374719, 
-  1552089808,  2413885848,   502684948,  3846029119,  2707042453,   664407949, 
-   450793237,  1158929427,  1949808884,  2136814318,  3303807308,  2614587997, 
-  1043281075,  3223002016,  3780899369,  2386208475,   201455342,   368989242, 
-   679681379,  1867478980,  3409628508,  1364035240,  2098991495,  1989023392, 
-  1581511070,  3438178537,   261573010,  2588120236,  2049289684,  2007902063, 
-  3372179515,   239989250,  2815082631,  3697214999,  2096229009,  3057303801, 
-  2273012231,  2849535627,  2186293383,  1129196001,   629519887,   933965566, 
-  4239889167,  1293232488,   528736153,  3589630852,   766893297,  2172017583, 
-  1269658703,    99263987,  2838607341,  3693145804,  1491690192,  1710571360, 
-  2106881207,  3635911228,  3446853723,  1455174657,  2161012243,  3520475281, 
-   564464004,  3221888436,  4150296173,  1172512853,  2155499846,  3425313116, 
-  3782453990,  3160109417,   447534083,   733888430,   216078664,   214275918, 
-  1525064002,   848853503,  1375124965,  3857733718,  1270217070,  4222175854, 
-  2226932959,  2809857209,  2719990969,  2776966874,  2644493270,   870672343, 
-   721743562,  2402626906,  2358575584,  3920051545,  2699711047,  3974358555, 
-  1504729556,   280326379,  3415635123,  1265256164,  4094694982,  1701940683, 
-  2606979359,  1249502955,  1352082100,    75675686,  3440409236,  4265222622, 
-   787258760,  2742139147,  2767209119,   445092106,  2361768459,  1986251979, 
-  2261499196,    93646066,  1484415332,  2894206512,  3405858830,  4232514153, 
-  2320032844,  1369898852,  1103510882,   240159181,  2446740387,  2486608436, 
-  2158963462,  1925317362,   331261060,  1483691761,  4235450833,    60114721, 
-  3322696330,  1565083741,   492845943,  2067574776,  1707630257,   227032853, 
-  3809956125,  3950314742,  1255107295,  1019288142,  1255491855,   902520967, 
-  3084394974,  2085800422,  2838881822,   340278125,  1631783806,   928614252, 
-  4102671860,  2385563817,   158937695,   903716727,   354605864,  2221080000, 
-  3178464598,  3170929467,  1917868805,   247729772,  2292748577,  2021205963, 
-  2942955689,  1434451668,   589385792,   852687088,  1154051615,   346114462, 
-  4265719525,  4082211598,   434675639,  2027224937,  2267962864,  2178210510, 
-   172554777,  3212288996,   182462349,  1471949269,  1973405413,   772940711, 
-   261897589,  3092948203,  2424987648,   290932119,  2888073913,  3164739275, 
-  3242313374,   408896851,  3845785296,   303134419,   790320191,  2363222397, 
-  3777315683,   553429321,  2243165396,  3479151831,   900371128,   213823631, 
-  1910639190,  2649726240,   818765778,  2404376109,  3656101590,  1359321165, 
-  2546092268,  1460005015,  1550887646,  3849962840,  3988937907,  3172110575, 
-  3749278781,  3013187070,   671892698,  2233705261,  1135748714,  2130972486, 
-  2370039482,   574011390,  2921853092,  1394472893,  1624771609,  1775529187, 
-  2332777048,  2093702831,  1563721527,  1247960119,  1097299063,   580343564, 
-  4235950689,  1328701184,  3806240286,  3346730786,  2932898531,  2597979039, 
-  4234163138,   657401798,  1196043296,   115468284,   559966634,  3275735118, 
-  2578926497,   690927982,  1847837413,   529222804,  1266753493,  3658296002, 
-  1852240142,  3855751308,  3984703700,   793957380,  1111811009,  4048721914, 
-  2645129908,   862712810,  2889734755,  2057568742,  2494971781,  1961335942, 
-  3985646264,     5192896,  2501666301,  1253760307,  2346879750,  3886955909, 
-  3458779824,  3319692426,  1968242341,     5938904,  3519454323,  1511850370, 
-  2154396947,  3514931618,  1731140164,   757296844,  1138377737,  3764626791, 
-    30004139,  2702115864,  1794002472,  2423639224,  4129352675,   724726711, 
-   388778292,  3614419981,  1722790984,   340623199,   123562953,  2605216380, 
-  2578431212,  3811202537,  2592557041,  4242381046,  3854655936,  3687045114, 
-  1151111959,  1761464488,  4171964976,  2631870783,   125006901,   453781437, 
-  2117090244,  2193615619,  3444987836,  2210571237,  1967036455,  3825853890, 
-   396061674,   980867866,  3782646502,  2197558279,  2667405014,  4105135077, 
-  1683470601,   701973913,  2093839207,   673695051,  3047488588,  3873592680, 
-  2402992749,  3584163094,  1185530564,  3061690387,  4042525967,   707756466, 
-  3006230811,  3987870233,  1696456634,  1939955053,   166170567,  1762935806, 
-  2734876327,  3327243950,   685121034,   353588787,  1445587128,   926233911, 
-  2555022042,  1057067647,  1827303534,   135753234,  1546061427,  1533504778, 
-  3873503049,  1524202594,   803114285,  3100519466,  2516417355,  3373285176, 
-  2375679431,  1846684408,   679084866,  1111888067,  4171507393,    19210277, 
-  2044877635,  2486642704,  2965311038,  4148658661,  3572918945,   886331942, 
-  2425674208,  3003710333,  3204275932,  1531940781,  1013818408,  2826822113, 
-  3736111809,  1987868351,   950427723,  1603803350,  1384347257,   621893640, 
-  4090910414,   555638813,  2213415609,  2371355935,  2829888049,  1007691152, 
-    96750201,   622751859,  3526863423,  1060683439,  3034662684,  2081596198, 
-  1275241754,  1048345345,  4188245606,  2567514265,  3435608183,  1036145275, 
-  1554997137,  2199690057,  1304350185,  1702674190,  2325222139,  1804738818, 
-  3400008378,    95706437,  2346672321,  1191916944,   444727163,   300071481, 
-   620258706,  2136444312,  2604421090,  3903494986,  1343172383,  1262638026, 
-  3019976591,  3179081202,  3673348077,  2257591759,  3680805794,   221133916, 
-  2501388411,  4069258355,   885815125,  3995144728,  1178237768,  3393037033, 
-  2891451867,  1938182670,   850373909,  2109324863,  2643507145,   562954144, 
-  1500104259,  1854193060,  4011399872,  1018740612,  3740653743,  1227897056, 
-  4126715123,  1766711451,  1127461239,  2489664685,  1109779491,  2669896441, 
-   900767494,   846598638,  2009380143,  3431497692,   389879006,  2390956504, 
-  1244750865,  1303393897,  1744005919,  3634257118,  4046782612,  1837192595, 
-  1379364441,  3120969003,  1897266488,  2810456293,   554203059,  3995426095, 
-   568832747,   940691457,  1728829166,  1047197191,  3528677487,  3417138327, 
-  3198541904,  1044132580,  2827295774,   346471337,  3505376742,  2453104900, 
-   945976006,  3924019707,  4131094508,  2763827180,  3322627604,   426885210, 
-   988096797,  3045837896,  1692575009,  4227279427,   632881847,  3680280699, 
-  4004302160,  2033183950,  2211048211,    79137199,   231555105,   181202729, 
-  3688803690,  2069227957,  3862664696,  1049938814,  2545905026,  1591195989, 
-  2529092608,  2617636671,   651927520,   609941401,  3811369022,  1375286563, 
-  2028945637,  2562191914,  2234113722,  2254394253,  1503170392,  1100255559, 
-  1153325397,  4236450482,  1167308956,  3822086357,  4285012206,  3347645633, 
-  3580474221,  3004925192,   368580930,    51205725,    64251985,  3188091747, 
-  3599428684,  4270847736,  1746625266,  2883853335,  2393640592,  3196058140, 
-   882246908,  1192055876,   973025285,  2782510696,  3960776897,  2976857727, 
-  3284292048,  2613828801,  4216585935,  2417722198,  2701497312,  2236471925, 
-   132749968,  2382023530,  3327627214,   673628988,  1995617700,   988864577, 
-  1508226349,  2206976691,  3868041904,  1613452233,  1383230224,  3450746537, 
-  1132804144,  3890563598,   318519492,  1451924841,  1698751718,  1347417252, 
-  1791075993,  2513056767,  2232626953,  2969972589,  2109460286,   156741403, 
-  3658305727,  1187756131,  1077745686,  1423065416,  1779852123,  2295868991, 
-   755806601,  1250766930,  3450839168,   151212166,   208794819,     1466720, 
-  3382758496,  1311312118,  2973326177,  2406121262,  1499057232,  2545927910, 
-  1646405878,  1034518627,  4148117052,   569134800,  2751066904,    43887414, 
-  1565515472,  3792225514,  4058887432,  4217557041,  2327742657,  3179991567, 
-  1260083625,  1167282817,  3990142564,  1435407342,   405863253,  3203534670, 
-    44379526,  2312406181,  1836026590,  3733987294,  3920228115,  2002788554, 
-  2161200172,  3387042312,   628483448,  3747496886,  3464748618,  1509442993, 
-   976088233,  4004118649,  3566108895,  2237752265,  2575230329,  3920495434, 
-  1317838946,   442001424,  1445463671,  2060858498,  3294876179,  3689410804, 
-   705201577,  3473663947,  1836739616,  1538637092,  1239757490,  1500207413, 
-  4013102504,   235589498,  2687755037,  2741834085,  2967653086,   154396227, 
-  2019622079,  1534593793,  1469608471,  2665213940,   833910048,  1705149390, 
-  4237238917,  3027733044,  2152840614,  1192206146,  2910287504,  4091800744, 
-  2505978168,  1875063047,  2940693630,  3598785973,   425501754,  2412193972, 
-  1593508017,  3455151597,   457247704,  2670614884,  3736031702,  3679629926, 
-   595741867,   981572277,  4241646695,  3495572242,   524853597,  2259819996, 
-  3808535919,    30441493,  1300135434,  2483571470,  2876110200,  3317014145, 
-  3418422471,  3745957411,   379071689,  3902214587,  1501100918,  3200828474, 
-   122774414,  2473194565,  3988645291,   516963094,  2640728796,  1517393291, 
-  2402817535,   248739692,   887398003,  2311821679,  3815990105,  3732231306, 
-  1399781945,  2407425465,  1322134259,  3404992605,   691945778,  4034875021, 
-  1959549195,  2272983034,  3489058506,   488621013,  1701849300,  1391118750, 
-  4081222094,   160216218,  1646395542,  3321648490,  2763291671,  2119006161, 
-  3910197045,  3396867263,  1027752709,   368907038,   345221585,  3548379282, 
-   444442041,  1406386332,   829049025,  2527263790,  2265235291,  1828181477, 
-  3517656188,  3834456527,    55163354,  3941027558,   673578748,  1788598186, 
-   658227963,   168652057,   673823241,  1308596904,  1498225191,   991858299, 
-  2759550672,  1014132946,   922393607,  2635912204,  2596353958,  3656447759, 
-  2558731152,  4110060697,   928438052,  1464950271,  3925445314,  1252075899, 
-  1305664419,  1573243235,  2320678840,  3886210169,   122301739,  2068781537, 
-  2515395832,  2452338074,  3752720214,  2563447825,  2234552926,  1659802802, 
-  1986831103,  3926806338,   884424543,  4278396810,  3742708394,  2168468796, 
-  2513826208,  1266733357,  2827328192,    85293077,  2622687567,  2318725244, 
-  1593173155,  2293156079,  4242847036,  1202776362,   480088590,  2132241909, 
-   498832666,  2288136022,  4154377670,  2013486448,  1114203614,  1555877357, 
-  3943680890,  2117871265,  3246485824,  3222728643,   454742541,  4188201953, 
-  2896997557,   193940809,   959553080,   718091880,  2777589678,   859610617, 
-  2359019466,  3003809323,   179724614,  1833492767,  1604116412,   238156066, 
-  2211501127,  2498628458,   314559621,  4212929565,   344285354,  3450696440, 
-  4006644686,  2219988793,  2798918366,   761660944,   698431024,  4147393097, 
-  1383932121,  1213118780,   235749498,   363531848,  2520989186,  4150506019, 
-  3245066498,  2791097887,  1988674620,  4208674908,  3425177885,   737893655, 
-   707161534,  3730970032,  2197599711,   924790226,  2958738919,   531111823, 
-  1372911914,   743764127,  2544063706,    76837069,  2141462691,  3238566848, 
-  1630076981,  2530782625,  1727080513,  2105263528,  3951256738,   614943665, 
-  3759131864,  3585872958,   393699868,  3008591614,   870402609,  3129345356, 
-   816814576,  3549092961,   165912748,  3325143621,  2173068822,   156004208, 
-  2903601807,  2110296858,  4294393845,  1225068880,  1763442853,  2428268955, 
-   589230533,   359327353,   147038945,   137710073,   537989099,  2273358559, 
-  2999324269,  3507931563,  1970157214,  1225965729,  1693458016,  1532461659, 
-  2346607493,  2977836253,  3381992304,  2463800517,   263316491,   437719986, 
-  4232218517,  1035961418,  1792557091,  1204703860,  3921669022,   967562347, 
-    92870924,  3295471471,    79729186,  3851243658,  1019293442,   380536694, 
-   896366581,   583940236,  1953927855,   746406966,  1379719930,  1527126875, 
-  2472337415,  2531080512,  2028571282,  2608826303,  3660424927,  1505179344, 
-  1770658030,  1753097481,  2651786783,  3524855630,   898074208,  3515113117, 
-  3351596623,  4013033211,   746276211,  4285992493,   223483201,  1897014498, 
-  4177201751,  3635496728,  1973154262,   783699889,  3042360988,   667315812, 
-   879876820,  4106438835,  2279270181,  3051564240,   643348007,  1069167956, 
-  1409327638,   396765644,  2960239248,  2880851044,  1012093546,  4119316417, 
-    65592211,  3459759703,  2001235847,  3009132267,  3415976227,  3606514679, 
-   372191376,  2637520633,  3984273382,  1807236338,  3443956131,  1980629633, 
-  2864487138,  1309163140,   847529137,   917001288,  3178493071,  2469706944, 
-  3773929725,  1820380155,   531508861,  4217122807,   917268997,  4152299825, 
-  1315758393,  3445501131,  3167643353,  3644478699,  3116276902,  1905697288, 
-  3666925393,   259160752,  3241164278,  1998197351,  1370922082,  2765486244, 
-  3105144786,   890449163,  2770618409,  3656845793,  2974753033,  1729780315, 
-  2844541822,  3267018748,  2173616453,  3628543462,  3245262205,  1203658275, 
-  3224112819,  2523985094,   884313423,  1672560650,  1620154596,  1359033602, 
-  3539418919,  4266126437,   188678819,   408989780,  3845283475,   877422267, 
-  1659757363,  4060942861,  4167908746,  3785487416,  4041399128,   348042164, 
-  3267331972,  1027904684,  3833272880,  1217431466,  1199963870,   126539891, 
-  2900547287,   917806409,  1002238434,  2059651337,  1392938787,  4058636676, 
-  1965728367,  2186804519,  2265248680,  2491009318,   206397646,  1634706496, 
-  2973151088,  4243334151,  2902245363,  2357312218,  1878643281,  3217785963, 
-  2241441216,  2517859861,  1766284782,  3505365449,  1230375002,  1857298196, 
-  3268435106,  2751098701,  1872562755,  3869973045,  1116111385,   865725463, 
-  2775872977,  1169891705,  1243540355,  2583027576,  1754691853,  4096529680, 
-   971934788,   905034741,  2612212097,  2176353486,  4283797163,  4037087215, 
-  3371539536,   524559983,   158024202,    34712165,   870465418,  3382426287, 
-  1831146344,  3552402336,  3211233153,  1541478666,  3479117151,  1940447733, 
-  1594005108,  1666749664,  1568432517,  1746814296,  1677638339,  1207628586, 
-  1138995186,   187583164,   785542390,  1801817358,  3173831812,   500823633, 
-  3997164378,  2743459007,   901016827,  1685091914,  3243174301,  3241334470, 
-  3316076964,  3871444228,  2361063201,   111381706,  2945360806,  3891174114, 
-  1478649675,  1140960131,  3152029106,  1369799518,  2891012905,  2413822914, 
-  3930825062,  3293787661,  2635365793,   718286279,  3566430583,   174056305, 
-  1791498356,  1585079913,  1780394720,  2184482204,  1398851669,   868706054, 
-  3476215658,  2745104721,   426417438,   854431052,  2215367012,  1441963221, 
-  1447801373,  3653332065,  2441789402,  2477433637,  3453543791,  2079606392, 
-   578597327,    64086601,  1212071459,   640259149,  3363461205,  2199977424, 
-  3853506308,  4287695679,  3989969967,   151189945,  2233078482,  2224095587, 
-  1522349394,  3932079692,  2364024683,   433514490,   926255117,  2740515008, 
-   106584268,  1600934465,  3149563034,   422741932,  3803346337,  3250097944, 
-    54450248,   557998876,   544665582,   726259215,  4192434773,   494436089, 
-  2139623387,  2009943591,  4040798211,   921516446,  2299706273,   210442088, 
-  3276093897,   769585225,   924827249,   477086550,  3146232007,  3347978585, 
-  3845814080,  3593361849,   915981303,  3808156424,  3016143209,  2214035117, 
-  1062972283,  1371280291,  1351543961,  1186324042,  1812722618,  3020397755, 
-   667181437,  2204196385,  1817302220,    17676685,  4103561403,  1484571701, 
-  3490704554,  3494162464,  1764571438,  1298424415,   698430692,  3210672002, 
-  3027726163,  3421806790,  1690838348,  3389858400,   996916817,  3008193705, 
-   214210361,  1127026179,   545042672,  4256120702,   612964901,  3470989692, 
-   840241486,  2552266631,  1066979226,  3233625473,  2099845453,  2108446961, 
-   749000084,   330237449,  4144558717,  3214940933,   948525813,  1589851409, 
-  3454009982,   186579733,  3820100895,  1851519493,  2700571259,  1204411507, 
-  2674020268,  1756427774,   650137794,    64817346,  4029896036,   257349152, 
-  1322255153,  2807524056,  2075265204,  4122799426,  1429683394,  3163383198, 
-  2354635939,  4215903991,  3278049507,  2959906766,   320736959,  3770359537, 
-  3252586732,    72496528,  2979196855,  4178781103,  2731680682,  4059669395, 
-  3446668819,  2699554651,  1681306297,  2450750783,  2838649855,  2224836685, 
-   354909541,  2220550885,  3389899419,  3408625322,  1505896878,  2142206628, 
-  2767873552,  3971041321,   344582162,  1570711399,   805172451,   548926044, 
-  1499500266,   422460688,  2633305416,  1455505685,  3893960209,  2924136695, 
-  4230763410,  2730249127,  2636887857,   787542958,  1647771238,  2519853502, 
-  2710119047,  1324743783,  2517940819,  1260713034,  3810821182,  1235366098, 
-  1240939541,   980308212,   772775160,  1320457185,  1144882729,  1825637288, 
-  3282551815,  1825023904,  2584904586,  3372148425,  4162079874,  3798351668, 
-   984497630,  3556035257,  3411742409,  4236738715,  2353075086,  3558752744, 
-   480717188,  3479120927,  2639974334,  2387965887,  3654167583,  1666290180, 
-  3299032418,  2574933973,  4289335033,  3399992844,  2258722091,  3167175790, 
-  2342763868,  2636037505,  2995676300,   719100735,  2170255343,   702177586, 
-   477009153,   556280605,   665637843,  1890553741,  3793476074,  2113051959, 
-  1904261192,  1257074209,  3155923910,  2817457013,   761529186,  2252346671, 
-  3703806273,  2619399630,   454656361,  1777254803,  3343258493,  3713854285, 
-  2831351924,   510073778,   479145367,   220809361,   186151913,  4170908009, 
-  2797738436,  2598106945,    51153627,  4233945118,  1447762183,  1119664902, 
-  2185538801,  4153565207,  1033834580,  2497403247,  2094527631,   787814239, 
-   803057758,  1272201033,  1630215394,  3685165010,  2042749337,  1773835138, 
-  1223155063,  1640317543,  2334964506,  3320609388,  4281767537,  1526500708, 
-    48208878,  1303675955,   472766157,  3543041959,    14244269,  2433334928, 
-   770199640,  2200231255,  2721802229,  2879521413,  2729797552,   568998650, 
-  2533541313,  3664770007,  4194223919,  2884291718,  1444250162,   677471947, 
-  1961915397,  3694854414,   938863273,   186898875,  3124399529,  3317176130, 
-   604398502,  4081719762,  3781001319,   831807187,  2675646950,  2571352360, 
-   921793167,  2382042176,    53262528,  2462808566,  2163795237,  2317565082, 
-  1596698957,  1619303184,  2036946769,   229994907,  3333722013,  2402333786, 
-  3250460774,  3452633092,  1600687534,  3448124335,  1508439311,   699110235, 
-  1970657383,  1036651348,  2661425751,  3652068719,  4153508387,  1701025044, 
-  1076383114,  3864377969,   228774143,  3718038147,  1304349057,  3346811358, 
-   598800122,  2483509189,  1400614991,  1112416227,  2363318609,  3746232699, 
-  2363407393,  4098847168,  2410162626,  4098931719,  1281538357,  3380189263, 
-   902505173,   411405846,  1474414966,  2994224270,  1514822084,  2102312650, 
-  3041383341,  3626397956,  1633465629,  1118053794,  3454583704,   808912432, 
-  4095112774,  3456159257,  1591916033,  1667570752,  2184163244,  2760532952, 
-   893560134,  1210604451,  1936176399,  3503171179,  3815495248,  2885539724, 
-  1100785613,  2262396737,  1742402411,  2290770923,   377943844,  1314129888, 
-  1688477976,  2236330209,  3909410526,  2213975849,  4097881674,  2323755815, 
-  3342085673,  2212773739,  2614696263,  3681225802,  2936453664,  3690150435, 
-   541519463,  2119961635,   858328395,  2985338925,  2900465672,   603968496, 
-  1793230314,  3419618278,  3175545713,  2903654597,  1438612115,  3106600415, 
-   451066846,   173879137,   890035675,  4269156223,  2956792330,  2960495725, 
-  3724917895,  2825140444,    51469298,  1549583321,  3580618410,  1593427411, 
-   201778802,  3063828982,  3618676652,   938627846,  3102621535,  3005232888, 
-  3353462646,  1999409631,  1630451444,  1565090905,  2902067522,  1604776105, 
-  1311696417,  1647827470,  3525496549,  1872602659,  2273670336,   564994325, 
-  2947668268,  2266982994,  3996922804,  3547670195,  1049540428,  1473266487, 
-  3832314044,  3355864263,  3535205017,  2620416191,   480500704,  1235834183, 
-  4221263457,  3810824137,  1545398417,  3705320297,   850001018,  3548700799, 
-  3941840771,    92244321,  2289805435,   510662370,  3080092470,  1857489582, 
-  3446447340,   858688886,  2163160226,   108715579,  3542595336,  2356444137, 
-  3137696858,  1541932889,    11903959,   148046686,   347029598,  3542538598, 
-   135922534,  2821356082,    27643292,  2624381586,   515926971,  1685526487, 
-   872330304,   540782625,  2549435414,  4152072859,  1300614103,  3278970374, 
-   457381205,  2086873104,  4128702179,   911775600,  3592774129,  1682100503, 
-   109270553,  2276904481,  3143019738,  2850357724,  2835408851,  3210796067, 
-   157310963,  1541965115,   513272215,  2508346789,   502687367,  3189981290, 
-  1722537429,  3070785815,     6514582,  3715374243,  2632775479,  2236870453, 
-  1537679681,  3947849815,  3990744208,  2529192359,  2018222891,  3109715088, 
-  2129317061,  3793259276,   509375393,   504054864,  1255257068,  1773766986, 
-  4212517322,  3157615516,  1052411543,   252572617,   219837324,  3965722529, 
-  3248448954,  2485937560,  2166463145,  2486095242,   332400566,    67109288, 
-   680405686,  1818443170,   784159823,   526927840,  2982079385,  2665465105, 
-  1430814048,  2528471058,  3146721771,  2982621796,    29816990,  3791618894, 
-  2797469958,   963939021,   601304329,  2333024985,  2081117509,   813855420, 
-  2443856368,  2695737095,  2036845635,   698412948,  1249280571,  2279455490, 
-  2708647965,  3628722070,  1561570582,  3409650323,  2654237222,  2018843271, 
-  1991827548,  3062185005,  1305008269,  1117300905,   914691618,  2369231160, 
-    84981260,  2707069034,   589128007,  1510781386,  1250733073,   313448049, 
-  1879001897,  2013770989,  1921966687,   497585646,   417777080,  1263357879, 
-   630257812,  1364922638,  3967673473,  2124483291,  2223645865,  2958220767, 
-  2979330458,  2017800880,   348284908,  1633894117,   589878972,   424266418, 
-  1179800513,   413313667,  3307217703,   853421044,  1278691428,   808664969, 
-  2634053925,  1665125270,  2162942836,  2451560431,  4265968311,  2631293329, 
-  1771437025,  1212037468,  2038499639,   101070165,  2368797792,  2266310640, 
-  3036261099,   591196812,   338115255,  1641322654,  2688799559,  1821839105, 
-  2681889135,  2183771119,  1706583481,  3504268514,  3516570352,   911961852, 
-  2508166859,   493301460,  2225935207,  2859390251,  1354603532,   105868764, 
-  3679279896,   873974150,  3625347557,  1874348695,  3256082008,  1768737701, 
-  2964565917,   445365969,  2432470146,  3621861700,  1052080025,  2127075930, 
-  1243108823,  1279088579,  1018589338,  2388217657,  2392596775,  1617550228, 
-  1255355052,  1242613417,  1274899567,   494174658,  2527600988,  4039348188, 
-   551927005,  4128131432,  2776437724,   659913227,  1612018412,  1747693421, 
-   808662064,  4148999823,  3870135528,  1084665652,  4082445059,  2329945600, 
-  1040023796,   124958124,  3808227561,   848830087,   565570896,   883273740, 
-  2481230993,  3086936972,  1820303617,  1458997503,  1208445817,   463845707, 
-   565316237,  3298314542,  2701677261,   447852973,   634278467,  2467537081, 
-  1048419987,  3398636304,  2514547048,   769935461,  3132625140,  1768715658, 
-  3227945143,   718798623,  1800636910,  3156788317,  4092177992,  3701105284, 
-   923345136,  1007179371,  4266377422,   801592704,  2364799388,  2135279432, 
-  3717959386,  2237146531,  2510471969,   894378674,   695006888,  4192056299, 
-  3349227507,  1194770026,  2681382014,   571663819,  1496505568,   121814656, 
-  2276258468,  1876988543,  4151757195,   688476177,  2705304873,  4054050951, 
-  1903161960,  2199026999,  4066732635,  2142748513,  4024114806,  2438519381, 
-  2235636834,   425501587,  2455595792,   230044753,  1459218315,  2519839046, 
-   138638784,  2090861919,  1358745624,    87251375,  3048750436,  4090066573, 
-  3682750578,  2519479751,   257583924,  3305933976,  3729887277,  2144664874, 
-  1510696902,  2862244478,   652590665,  3832516683,  3763047148,   945905491, 
-  4026472767,   242562993,  1072023431,   314947932,   868182067,   531817435, 
-   496284543,  3331604109,  1094723926,  1700106776,  1611692780,  3854525462, 
-   754206190,  1875011963,  1877015087,  1287483248,  3341314774,  4095431886, 
-  3419343816,   940801795,  3193275997,   913409537,  1413583534,  2673560685, 
-  2963906352,  3551541063,  2254200457,  3259608086,  4170063702,  2936910369, 
-  2767713426,   362288456,  3685008601,  2244999436,  1857368314,  3225050050, 
-  3980322150,   524820069,  2009008926,  2777900188,  1610151126,  3763046681, 
-  4012982600,  1681097301,   473513161,  3101944461,   107427659,  1383236059, 
-  2311663784,   635058214,   420512396,  3997997619,   803364095,  3678353094, 
-  1446459193,   872178321,  4210237618,  2851364792,  3836323208,  2256004046, 
-  3269232285,  3966041711,  1845917516,  2832835939,  2265312584,   878885138, 
-  3953559253,   549021096,  2008255535,  3545338865,  2823609129,   974038776, 
-  3973701999,  2845698751,  3849871949,  2111893421,  3069611578,  1349778373, 
-  4200162722,   996505462,  2298300001,  2156637950,  2229125505,  2275207578, 
-  2974669047,   865836415,  2457483496,  3917710061,  4133141948,  3072596236, 
-  3170005385,  1043455778,  1855965067,  3589714415,  2064505191,   982380402, 
-  2365129697,  2237754427,    77344828,    37438868,  3336325013,  3828506329, 
-  2236458162,  3118159783,  2509400537,  2780214842,  1721453477,   589639268, 
-  1523996917,  3335148532,  1979051744,  1607517274,  2507300904,   873873976, 
-  1010006755,  1414383471,  3070345493,  3786731029,  1561495252,  3971328686, 
-  2911914257,   262665357,   920758422,  1949953543,  3291138004,  1154539520, 
-   827413912,   123304572,   434179341,  1510566347,  2779225254,  3266328055, 
-  1598355703,   559226119,   421495869,   487040893,   945670381,  1256306761, 
-  3903159947,   814669108,  1315847693,  2700683445,  1749715396,  3436209069, 
-  2579254111,   667973434,  3901751068,  3494069537,  2674834752,   550794796, 
-  3911605691,  2728761799,  4086274675,   592765712,  3108347409,  1944626628, 
-  3224140109,  4064378650,  1794630001,  1314268182,   485028198,  2450199386, 
-  1914134002,   907293509,  1976643173,   219415320,   210701969,  3181201063, 
-  2502410325,  3835218769,   754041860,  3265308555,   349225236,   818601698, 
-  1687626719,  1829160899,  1912425486,  1384136032,  3166360600,   240691258, 
-  1735663210,  2575347126,  1339299839,  2671273235,  1918519299,  3913442712, 
-  1108463995,  2607478834,  3984990735,  3186305867,  1531753796,  2907461767, 
-  3926698262,   559946340,  3658326982,  3804421052,   925597546,   604235510, 
-  2714377112,  1986295097,  2504713739,  2983424602,  4260545099,   369870907, 
-   871582738,   139444578,   368356477,  1517671052,  1378040113,  2483978883, 
-   323404284,   548853156,  3971029681,  2870005916,   796624451,  4154124219, 
-  2190638001,  2765636887,  2224553235,  3503539624,   705291621,  3250014196, 
-  3828952623,   260497531,   949500776,  3996866160,   509890513,  1710461253, 
-  2346815616,  1225560873,  3627729542,  2985658652,  2139331701,  2993017364, 
-  4083539805,  2032051792,   704806873,  4246691283,  1052948936,  1706574470, 
-  2284051477,  3193640894,   416822332,   103500658,  1608750419,  1565953361, 
-  4018236432,  1439606629,  1105188214,   526228666,  1574825788,   802175607, 
-   894127385,  2391158995,   972958562,    42150721,  2703512831,   694037025, 
-  1516395401,   712684515,  2145197764,  1667221871,  3936450844,  3678226379, 
-  2395567344,  1432787662,  1658594209,  2839235525,    45014678,  4087776200, 
-   656709174,  3452688793,  3462946608,  3015015680,  1003755863,  4078316032, 
-   530854877,  4021924444,  2232113674,  3457288455,  2857763856,  3390621689, 
-  1020463146,  2846901527,  1207589851,  3667157619,  1521858143,   927859121, 
-    53724939,  1924452902,  2485848307,  1461747052,  3034202033,  2870927429, 
-  1366597569,  2925690498,   342246497,   821073791,  1157799203,  3934633452, 
-   370995021,  3412119893,  2628849307,  1835966947,  3318103375,  1671913187, 
-   811805309,   788538264,   221529506,  3012394917,  1171627156,   581953169, 
-   526284717,  3825237783,  2897423365,  3261710071,  3726807971,  1895452389, 
-  2502727351,  2336448189,  4286634271,  4102081299,  2123530254,   447264852, 
-  1236006124,  2358195177,  1366807442,  2452052175,  3756721675,   263660929, 
-  2042451299,  3889092742,  1480446119,  1698143642,   783740024,  2539733075, 
-  2875277271,  4223603873,  3596398623,   719373411,  1266670430,  1383635865, 
-   762429035,  3303676584,  3921048192,   609980990,  2888230901,  3886666772, 
-   487289762,  1139443827,   925959847,  1749707597,  1922808180,   830495203, 
-   981084534,  2292610431,  1101101618,  1504006044,  1117166424,  1744903370, 
-  2839803096,   778657232,  1903147420,  3590699247,  2395011170,  2691799071, 
-  1209869230,  3339612791,  2511709978,  1114621340,  3886393257,  3247068721, 
-  1546166269,  3434880334,   424319680,  4259260514,  1836719335,   386078606, 
-   401450440,  3486387545,   621583673,  2833156876,  1857536171,   806709126, 
-   989820605,   755283868,   731421888,   251410231,  2386395930,  1626818439, 
-  3516057665,  3605816030,  1542107145,  2882655921,  3198710645,    55981602, 
-   803906278,  3704397224,   568859344,  1142741194,  2361774046,  3210511265, 
-  4272083914,  4143618527,  3552458710,   236321925,  1482906168,  3858003592, 
-  3244963561,   756274169,  2566142275,  2425050230,  3602027961,  3013800886, 
-  1459856051,  1619804618,  3647133469,   714946562,  2220915441,   454377977, 
-  2203679642,   251707035,    16738810,  4240524854,   462926627,  2877785063, 
-  2379791242,  2971293405,  1844884571,  1871493860,  2576429965,  1377094711, 
-  2309112359,  4024857204,  3682692651,  1570060589,  3072613980,  1429605224, 
-  2920765680,  3503567890,  1916167010,  2889616315,  3340662182,   554636192, 
-   745358030,  3410643291,  3709633675,  2467843899,  1312139744,  1808220190, 
-  4282384988,  1483026288,  4177596955,   924375062,  1938463291,    49389268, 
-  1610182164,   291591546,  4080255439,   516136742,  2679883386,  4021059225, 
-  4130324342,  2163167679,   567164566,   648676077,  1928796745,  2336437176, 
-  4214050237,   658335941,   723631414,  1958884700,   833582459,   255683696, 
-  2836285445,  3606714399,   169343590,  2219687131,  2747282773,   110764293, 
-   152194854,  2097165532,  1079540219,  2513446984,   467049999,  2360914443, 
-  1003499778,  3579529215,   811293555,  1369577192,    32897746,  1234460621, 
-  2069603839,  2059396960,  2137289760,  1651500106,  2113709146,  1356792818, 
-  4215093031,   119782214,   601070935,  3549588056,  3880411408,  2686871901, 
-   266427004,  1901162996,  3531811170,  1319059514,  2423491813,  3334053313, 
-  1547206936,   308663620,   787649172,  1261286194,  3248976330,  2656856492, 
-  3034966982,   768621193,  2859076311,  1694647448,  3245023385,   166042843, 
-  2532247996,  3876820307,  1445600446,  2485771042,   357119716,  3141377841, 
-  1534515087,  1102144204,    64683322,  4062402772,  3440305629,  2727272800, 
-  4239538822,  2287582866,   183439360,  1775375479,    28039128,  3423097248, 
-   856925199,  4167742521,   162029051,   171635113,  2249809155,  3333020785, 
-  2894037692,  1296799585,  2280694620,  2154972923,  1711238209,  3074116072, 
-  1206584525,  2839452896,  1987810282,  2960008243,   612613357,     2977351, 
-  3635536916,  1322724883,  3215594424,  2434665106,  1056796133,  2156680140, 
-   211672696,   295761235,  3330659810,  2700751657,  2426967958,   831295643, 
-  2311804963,  3281946395,   220527926,  1488023632,  1865895085,  2038081055, 
-  1767252152,  1275669712,   273102818,  4293030261,   504150468,  1079959992, 
-  4288512688,  1710567874,  1320023539,   725058381,  3648231399,  2619732999, 
-  1410966485,   456324458,  1170608590,  3907046448,  2227578190,  2553801101, 
-  1025291479,  3595640235,  2048446125,  3442685178,   314280003,  2504767912, 
-  4099748949,  4009865897,  2705121788,  4003828010,   178749489,  2584041908, 
-  1169122150,  4281035575,  2965000733,  2286182535,  1735535509,  1136491545, 
-  2267143220,  3124182284,  2944028422,  3709446386,  2711728200,  1731533546, 
-  4018769960,  1748247089,  2517602888,   428129765,  3120527932,  2900516528, 
-  3590267375,  2934780328,  2951153536,  2629366664,   822224942,  2447929572, 
-   767207754,  2381347233,   302607950,  3670763204,  1417059702,   463281176, 
-  1304426177,   964781004,  2954259826,    64027472,  2389487055,  2593217336, 
-  3662252809,   183404264,  3796218507,  3906023859,  2591724645,  2310284331, 
-  2770584994,  3318498875,  3347546564,  1395607506,  2794166631,  1903719692, 
-  3554684078,  1257996044,  3890995457,   528451993,  2578377485,  3829391446, 
-   591299318,  1479296023,  4100923639,  3888220725,  1003391994,   276173447, 
-  1260262548,   945493832,  3602642222,  3949747742,  3767957779,  2204951765, 
-  1708213851,  1053199622,  3976995637,  4286548488,  4012207411,  3785606420, 
-  1225391243,  3965894718,  3442461204,  2357649447,  3196244463,  2975843505, 
-  2704797876,  1935322665,  2900065627,  2034684524,  3493403237,  2385804557, 
-  1658872129,  1076292294,  2390586389,  1710131466,   520290931,   697961803, 
-  1668231652,  3574740536,  1060257414,     8900563,  2712335636,  1244023479, 
-  1967595084,  2949586037,  1985221619,  2517648140,  1108133593,  2542172841, 
-  1120366572,  1667491065,   732835392,   569460820,  1761695045,  2546710579, 
-  3691228839,  1551309723,  2259490622,  3207440847,  3108066696,  1071795340, 
-  1588646622,  1360448978,  3480169614,  2244387809,  4247185211,  3506145448, 
-  2719532850,  1335623996,  2567781930,  3230591160,  3793436380,   138177529, 
-  1444166795,  1945797591,   781263168,  2551617498,  2406758260,  3625259725, 
-  1846697836,  2941622183,  2112364364,  2802275834,  1190410801,   421440405, 
-  3925566908,  1210607367,  4132710947,  1910623083,     8618991,   801277575, 
-   259656417,  3046745360,  3483244962,   507174518,  2031472460,   310720687, 
-  3152791308,  2391707170,   189887527,  1789651632,  2754204687,  1015767102, 
-  1039906174,   524578580,  3974666508,   842928363,  1301714130,  1176278396, 
-   402875884,  1536483812,  2145464800,  3107007409,  2120861075,  2530147487, 
-  4002100945,  1514905342,  2893152886,  1281917030,  2610219603,  1585154621, 
-  1848369472,  3687292455,  2013246103,   590368550,  1342661748,  3114663057, 
-  3934624491,  4265938621,  2592064098,  3461278988,  1315378985,  3308394321, 
-  3424333819,  2917231407,  2298782009,  4241834415,  2382298031,  4201908656, 
-  3114976772,  1117540370,   304458431,  1597749408,   101950630,   902493880, 
-  1979470899,  1599676048,  3253902798,  2043885120,  3175392517,  2805055832, 
-   675542206,    38247071,    72098047,  3495969241,   109506254,  1646974332, 
-  1643562217,  3223693810,  3366360037,    44136417,  3110057378,  2399106034, 
-   916311820,  2471764144,   294745144,  3354931219,  1277290134,  3941313882, 
-  3213340447,   608832443,    22801092,   134781390,  4069001552,   590748444, 
-   953925482,  3136900844,  1737183385,   486265796,  3942900397,  1357716956, 
-  2619148418,  3718466544,  1309454608,  3922614679,  3990912815,  2221980060, 
-  3638663280,  1833713210,  2440361469,  3495513232,  2036690120,   622462554, 
-  2292364839,  2825295359,  3259047656,  4083785327,  1865936174,  2314036816, 
-   427184292,  2594960604,  3292105426,  3910613285,  2204640028,  2708771092, 
-  2275438104,  1795814888,  1144414061,  3063176786,  2414403230,  4211909698, 
-  2254067148,   596913918,  2957390692,  1054838859,  1725351940,  1269693940, 
-  2022583021,  3508542692,  2281672972,  2203776851,  1027259768,  3188079145, 
-  2188682240,  4140025842,   236216698,   829593407,  4160551058,  2823055940, 
-  2874921565,  1768550634,   821649713,  3647849179,   771344482,   973798498, 
-    70975103,  4144347238,  3679309686,   204800912,  3347185098,  1727862042, 
-  3850912272,  4202607374,   916769964,  3973187929,  1059475080,  3873115252, 
-  2832101443,  2306716583,   520150809,  3476740595,     1203314,   957866951, 
-  1496349739,  2823907017,  1945397757,   337039604,  1009236984,  2353739266, 
-  2401899558,  3116459936,  1206953034,   928176859,  3504008315,   652367509, 
-  3848202306,  1666965541,  2166508644,  4096936079,  3544684332,  4274609353, 
-  2333633578,  2943471119,  1093738671,  2244371744,  4195584936,   833095870, 
-  1054727903,   923221295,  3491033290,  2673554526,  3963208960,  3425122098, 
-   665879437,   580062212,  3423463544,  3391684435,  3065051013,   349554940, 
-  2354663223,  3656904037,   534720581,    17934120,   374961292,  1646587296, 
-  1963152624,  2333814158,  1636011957,  2149886752,  3489945240,  2778622526, 
-  3937723964,  3327970405,  1223150083,  3130843845,  2631514211,  3940374142, 
-  1490674375,  3539162722,  1729253319,  3644892989,   477354963,  4252071190, 
-  2969210871,  2185501117,  4024180606,  3725841155,   310484362,  2592359553, 
-  1920411328,  2775179813,  4075484846,  1147018129,  2036802288,   605741405, 
-  1295630100,  3513384592,   505329670,  1172809561,  1500738560,  3862814154, 
-  2607504876,  1468035453,  1105454438,  4085999541,  3806263398,  3172382260, 
-  2257477599,  3448076418,  1554742586,  3583796372,   660517910,  1083852567, 
-  1697766477,  3928951061,  2138126620,  1347825719,  1998413531,  3658843093, 
-    84621752,  3587266049,  2799833556,  1834040349,  1003749815,   146419639, 
-  1779641235,  4212558583,  3395292229,  2254212997,  1273581391,  2865331344, 
-  3377911216,  4118352472,  1789843786,  2394396206,  3783751286,  3413756130, 
-  2256026955,   316600132,  3048322555,  3546911034,  3509972829,  2333493342, 
-   556406191,  2630012897,  1772437954,   191758752,  3954416592,  1251368560, 
-  2588823135,   320219756,  3139315210,  2728439196,  3467798831,  2238284721, 
-   591829398,  1992183615,  3537570306,   962790917,  1167512288,  3654554920, 
-  1861099470,  3770033088,  2003561033,  3378474152,    34251367,  3198458839, 
-  2150128423,   439878714,  2552010945,   984221459,  1636324028,  2456500979, 
-  1855052793,  3142490196,  3874567333,  2171475402,  2672234903,  2964660371, 
-  3629918550,  3729886757,  1399508060,  2733517834,  2002750412,   458066275, 
-  3663873688,  1455690567,  4246276684,  3284672964,  3117135579,  1919322523, 
-   256592493,   758078210,  2259872903,  3722778821,  3294499885,  1887319814, 
-  2474276071,  3445586090,  3461913706,  4135725851,   874015396,  4198167777, 
-   827452154,  1859233234,  2916748521,   215810740,  2871630186,   114038080, 
-   512531467,  1671332119,  3853877508,  1365010575,  2049418166,   631643367, 
-  4100204636,  3521944427,  1983292459,  2072108138,  2020908871,  1101440509, 
-  2751118852,  1733298715,  2679554145,  3875753040,  3717184524,   772514244, 
-   649282664,   835431143,  2180351799,  1497251571,  2739040569,     3545212, 
-  1147208441,   526953401,   168252744,  1329474377,  3265463386,  2632241729, 
-   980377477,  3054476709,   206230264,  1160904850,  1912466558,  4037267242, 
-  2936076088,  2350191590,  1462639279,   234538705,  2914896533,  3158986718, 
-   113845794,   141786100,  2217631949,  2632092954,   116419840,  3825506992, 
-  2800424523,  1126081212,  3252676932,  2462106296,  1830518845,  3633311117, 
-  1909212335,  3307619541,  2960004711,  2854437858,  4197150517,  1943853034, 
-  4136930722,  2577346923,  2640412464,  3569499754,  4084310100,  2385865072, 
-  1010893733,  2557320992,   677205386,   751674701,  2439203456,  3996918572, 
-  2934852455,   691176781,  2198173335,  2092742450,  2950541563,  4080896852, 
-  2961740496,  1516839526,  1471485901,  2139082473,  2819537859,  2778595682, 
-  1264926573,  2384268780,  3807851486,  1451185849,  2506247297,   873124035, 
-  4210312564,   119778481,  1817206986,  3382650472,  1891081761,  2319376373, 
-  3572512976,  3768326513,  2887670434,  2447727570,  2904367003,  2017760488, 
-   584357260,   888710704,  2255935371,  4109592800,  3404485878,  1233064929, 
-  2955045696,  1941912750,  1131493918,  1742524763,   347983255,  3683021517, 
-  4130049292,  4011082522,  2302660252,  2043362170,  1228429479,  4209187799, 
-  3890748418,  2767972099,  3630458185,  2217258072,  2653864225,   804987387, 
-   685379634,  3171119378,   113607886,  2804699555,  2114513222,  3954537541, 
-   340227606,   824744097,  2279082662,   435155374,   691141181,  2366430003, 
-  1744369619,  3484562279,  1461998072,   842194495,   794715376,  4266035558, 
-   343530913,  4184096984,  1443056556,  3335691016,  2516290659,  1638047898, 
-  1708306354,  3910336485,  3482563875,  2002799839,  2864363020,   310831196, 
-  2601914310,  1105359536,  1542811401,   127056713,  2510291666,  1860347196, 
-   491245446,  3178391400,  1858151334,  1111751608,   501235893,  2060989127, 
-  3562497427,  1167563793,  1798945234,   565237621,  2077538090,  2283771669, 
-  1533475001,   663987258,  2999826185,   354825203,  1378648559,  2129527373, 
-  3848618142,  3157001827,  2921817307,  1202594924,    65616359,  4007473508, 
-  4130081839,  1235982335,  2316782199,  2040778868,  3493704504,  1920899283, 
-   843184643,  1402277514,  2763834474,  2594281329,  1588905625,  2962392675, 
-  3282838098,   290649669,   298779651,  1417504586,  4221503096,  2607446681, 
-  1845132915,   454048673,  3930901824,   212312673,   358172769,  1766828557, 
-  3968039172,  2363474409,   888568229,  2609858236,  3244618144,  3122834710, 
-  3316570886,  2105741912,   271616484,  4263222957,  2804411385,  3697183069, 
-  1159842066,  2162521108,  2372334341,  2749316521,   355313195,   257908273, 
-  2671387229,   567220236,  3686674862,  2972131839,  3207082420,  4114725541, 
-    25882786,  3603059360,  2149029658,   392876100,  3028253918,  1562118166, 
-  1216741989,  3660424625,  4161138295,   391475372,   396987442,  4063916889, 
-   699199575,  1257701274,    24598179,  3094718528,  1501314960,   455707738, 
-  2095724174,  4236538593,  3139199834,  3499518443,   514889564,  1558533549, 
-  2833914310,  3870882234,  1836241791,  1881041274,   211606431,  2129658849, 
-  3631802443,  1509153957,  2507152870,  2279451584,  1334348012,  1322291007, 
-  3802046300,  2924015934,  2889567788,   696138995,  3867983597,   763827683, 
-  1551698826,  1159315035,   243697125,  1376939295,  3884500798,  1337448668, 
-  2628455834,  1899404600,  3225603434,  3924126597,  3076007865,  2530594119, 
-   992275245,  3985334153,  1341310499,  2698277247,   953053951,  1996916686, 
-  3508674116,  4210582678,  2202118588,  1806095290,  4183147654,  2170246992, 
-  1786257496,  2452389033,  1272535991,  2991709833,   142634487,  1617468035, 
-  3727626522,  3907163034,  1280079323,   771388186,  4153855138,  3805676173, 
-  3876860448,  4274766844,   266998985,   756411747,  1400053582,  1482697488, 
-  1384270772,   290670860,  1413346572,   709895994,  2042547789,   330863988, 
-  1828977986,   403032196,  1690909587,  3643500284,  2041410707,  2924295410, 
-  3436644392,  3048886445,  3544497164,  1174264440,   153654054,   960430111, 
-   470074646,  2363897906,  2021358318,  2547132039,  3707708456,  3857806745, 
-   204142623,  1927899281,  3214785131,  4038015497,  1996127332,  1842021017, 
-  1428989680,  3625171098,  1586192789,  3756472101,  2376332774,  1810848554, 
-   373485119,   903069448,   601827054,  3550012868,   851261787,   229699714, 
-  1088909322,  2113227341,   292211009,   313121766,  2795523546,  1109426628, 
-  3220134087,   637688913,  3755101766,  2576010367,   278234912,   506758051, 
-  2369810475,  1591020375,  1377782413,  3903721728,  2897651553,  3367086247, 
-   711808440,   962923500,   129871912,  1335103355,  2443493774,  2683315770, 
-  3192592207,  3824306959,  4150372719,  3379571717,  3536927056,  1841551781, 
-   778556568,  2027995225,    16965320,  3855269757,  3668521703,  2984691504, 
-  1283266536,   728046800,   460316539,  2304153786,  3500710330,   750582785, 
-  3925699065,  2196132352,   709111308,   518930721,  3071707566,  2819783641, 
-  4197853470,  1391717922,  1684759821,  3239300777,  4243755928,  3816322461, 
-  1416715221,   348462279,  2484989992,  2871580552,  1130248565,  1215198767, 
-  1858176121,  3851999923,  1795838143,   495036592,   258425842,   948592948, 
-  3330600994,  1136783120,   948433577,   400669400,  1154030699,  2984911575, 
-   987901738,  3186810988,   171369818,  3469476390,  2170156834,  1383594489, 
-   865069835,  3021796472,  2237262984,  2840676084,   337490729,   624804677, 
-   884707755,   427110448,  1752113645,   681418481,  3842035846,  1997742709, 
-  2631149059,  2508232432,  2278408420,  2943866887,  2531927723,   787710743, 
-  3913944668,  3106609075,  3236915519,  3293716623,  2967283937,  3409966755, 
-  2598920916,  3387769200,  2295417025,   911988009,  4082853074,    50488036, 
-  3512438319,  1630505906,  3173288543,  2246838493,  1450413092,   897366185, 
-  3421301963,   110868209,  2691421800,  1190949287,  3809103195,   841764362, 
-  3460603030,  1307420200,  1405839683,   763054298,   665057232,  1397879790, 
-  1996063277,  1109498632,  1630510569,  4133215917,  3663103188,  2688694289, 
-   627244352,  4293441686,  2016280515,  1321839578,   917615404,  4228778825, 
-  1961520341,  1830998393,  4107873205,  1735694824,  2858893114,  2501372977, 
-  2999928346,  2733844411,   433871833,  1351040925,  4195098458,  2077561674, 
-  1497556835,  4134184482,  2686695468,   660172991,  1298092293,  1356169663, 
-   941947345,  3749152318,  1227087624,   268652026,  2311111427,    60951630, 
-    74935230,    53486198,  2244481192,  1624150700,   644305278,  1295744683, 
-  4192889473,   442665068,   129877384,  2490789119,  3749288009,  1098691814, 
-  3091142326,  1755397119,  1467889865,  1090333993,  3175803517,  3340801536, 
-  2103059289,  4225025615,  2600492247,  4101972176,  2049247752,  2751173898, 
-   605705337,  2206931617,   885042311,  3056136695,  3953049544,  3132514084, 
-  3784426447,  1680648854,  3244286915,  2933362276,  3015755435,   474545310, 
-  2988548219,  3156290784,  3781918425,  4076739992,  2517094490,  2740563463, 
-  2107188144,   174857287,   904868466,  2632627211,   356824769,  2229685608, 
-  2714017433,  1707395125,  2732886838,  1029119744,  1173394196,  2739119038, 
-  1166874755,  3669686855,  3553288259,  3076076553,  2959692434,  2901555677, 
-  1467509811,  1130363181,   705349528,   800715959,  3772270572,  2812661987, 
-  3542573725,  4181573853,  4152837201,  2885391266,  1487047224,  2569608386, 
-  3493243299,  1831212635,  1295830946,   855783150,  1388801842,   956655862, 
-  1899453487,  4022595488,   759663849,  2451030992,   417766410,  4135431163, 
-  1464565699,   926700778,  2100887550,   762207927,  3143895233,  3264732726, 
-  3702642844,  2738063637,    78363574,  2867574550,  3915540680,   499277907, 
-  2077575048,  3137056244,  2603364530,  1682726817,  1174229518,  2802523764, 
-  3616323742,  4103799825,  4115697727,  3758176345,  4155475206,  3303748828, 
-  2126728337,   161393533,  3408678774,    22741509,   362320220,  2047685288, 
-  2933064125,   971878433,  2267608154,   895228559,  2127221208,   196392954, 
-  2777212738,  1063018061,  3200898933,  3953512589,   690740394,  3329650865, 
-  2540139182,   268037981,  1666179128,  1867594897,  3859060867,  4041837964, 
-    49353514,  4107496137,  2562329966,  1689665719,  1878708724,  2368274091, 
-  4262843880,  3561783973,   104418401,  3556845620,  2910395516,  4111043290, 
-  3045733391,   364886756,  2805757757,  3697317245,  1737992799,  3261830977, 
-   639142315,   994778024,  1843517272,   619237652,   106655100,  4194671067, 
-   502036345,    68011703,  2196803174,  3296500002,   742789547,  3116139577, 
-  3157264370,   678308300,  2388905036,  2170721803,    33782323,  3254330647, 
-  3612940585,  3080546643,  1920153796,  2461085284,   157570972,  1944086661, 
-  3425988768,  1317752483,  3424024549,   780678235,  3104275919,  3288743294, 
-  4099353264,  4170834826,  3295041796,  3801699014,   128421484,  2464331992, 
-  3971641893,  3576100278,  4136056856,  1085781799,  3667902604,   985410762, 
-  2129624993,   153874737,  2013448328,   972247729,  1549101829,  3689234577, 
-  1318540115,  1633123175,  4146049675,  3150023059,  2801067609,  1687463900, 
-   637262163,  1584921968,  1835678795,  3379976587,  2956155266,  1270397149, 
-  2059515999,  2854488758,  3575269613,  4145121104,  1482658567,   758560608, 
-  3491975381,  1687025221,  2166226814,   295480834,  2765916494,  3060605408, 
-  3496220288,  2679404675,  3146577373,  3432027822,  3276274961,  4268728788, 
-  2084721717,  3457681570,  2829661498,    16620596,  4169311579,  2532924469, 
-  1839823974,  1189433349,  1826046568,  4140146573,  3029987956,  1726724723, 
-  2252493948,  3501781126,   553619023,   950051541,   250294595,  2194281021, 
-  4248392463,  3448097110,  2506397509,  3690198224,  3068381513,   162950967, 
-   402083389,  2663583434,  2581820581,  1660040124,  3505460447,  1199419242, 
-    32176534,  3413905847,  3390089581,   391059601,  2501977510,  1030998484, 
-  4099228137,  1462502402,  1118604273,   921765795,  2041234799,  1603351031, 
-   318877519,  2475211683,  2676079909,  3854618616,  1013880393,    40933915, 
-   927238348,  2098093642,  1200042608,   765417825,  4202494464,  3899262959, 
-   635733540,  2634672625,  2738266356,  2613119706,  3096414851,  3671361871, 
-  2581397682,  2084099411,  2066969711,  2969988937,   988155476,  1095914418, 
-   734100962,   218318199,   210464497,  3419112902,  4183508209,  2629018026, 
-  2909583204,  2722636813,   965546168,  2855419449,   532998148,  2242551387, 
-  3071133220,  2393253490,  3436532526,   572571459,  2639231895,  3140723331, 
-   288447265,  2727082842,  2768159305,  4223847479,  1255404630,  1283511200, 
-  2101728670,  3944749270,   268225831,  1269547051,  3283271473,  3572358432, 
-  3305089447,  1511502328,  3266319920,  4028167839,  4068511280,  1986714885, 
-  3179444215,   277241661,  1035600195,  3215314539,  3980953289,   222118336, 
-  1089654417,  3295617334,  2941268851,  2472203121,  1538166449,  3120112186, 
-  1251364367,  4022604748,  3855223214,  3038230349,  2344657977,  4154885314, 
-  2109810433,  3984129627,  1215515048,  2416611244,  1420131440,  3107192253, 
-  1714469040,  3936852245,  2268422009,  3349772107,  1654658485,  3627900181, 
-  3986275697,  2926391101,  2755576892,  4242051946,  2487609689,  3304250005, 
-   719245446,  1579953562,   904642367,  3312781782,   801549956,  3667156877, 
-  3818280288,   786261844,  2211988421,   996599469,   856344204,   741502639, 
-  2989005185,  2104256348,  2401151839,  3760759842,  3767337095,  2848488032, 
-  3083203269,  1588021580,  4251515708,  1405681833,  1873278737,  1784618821, 
-  1587830529,  3023910226,  3956116635,  2458492350,  1477428900,   835732989, 
-  3463515626,  2388643735,  2118645035,  3330158093,   826842045,  2579907955, 
-  3593872737,  3379012349,  1259689203,  2693643335,  2369782066,  4195992120, 
-  4179613104,   937913090,  1060681645,  1610607020,  3233111841,  3061470721, 
-  3090248567,  2583086232,  1216538717,  2676525354,   247693143,  1795182786, 
-  3776721671,  2417848546,  2589319820,  3838147737,  1899912164,  3770133373, 
-  1174228712,  3818333373,  4152847299,  3942064006,  1650764039,   701381549, 
-   253985561,  1969188930,  3905675357,  3386216180,  1546915456,   251863964, 
-  1086531396,  2326504329,  3702142684,  2334701654,  3871904212,  2124016157, 
-   694215939,  3503434976,  1685820267,  1487743640,   997364744,  3871228662, 
-  1551140770,   662575041,  4087201741,  3886660856,  3953771710,  2830980137, 
-  3389830820,  1484624437,  4159277529,  1772742587,  1052348453,  2483102935, 
-  1718570618,  4230302086,   779681916,   592889283,  1887947513,   535787990, 
-  3356964454,  2712701411,   381759597,   682108087,   758027259,  1142267312, 
-  2770571820,  3186577855,  2441740444,  2990335912,  1740114734,  1983367494, 
-  1885612763,  3242520977,  2287239981,  1173787245,   937807146,  2070224579, 
-  1351129001,  1954246767,    65697306,  3239475987,  2514885617,  2075846855, 
-  3994571270,   103508033,  2292140261,   609235464,  1971359700,  3972023057, 
-  2741864690,   280548520,  4122841575,  2217703878,   242305660,  1084553775, 
-  3455472902,  1254190647,  1187279240,   958317608,    72444843,  2032996850, 
-   423027232,  1523352602,  3615236785,  3409656083,  2989556731,  1422813532, 
-  2025635048,  3088774509,   768920925,  2648893658,  1901947613,  2032318427, 
-   294391483,  4038329067,   136119492,  2278527297,   741174783,  2738871543, 
-    83512684,  2520550216,  3244294173,  2823311462,  3340336227,   946338721, 
-  2150073167,    21976014,   557456528,  2080250366,  3739491585,  4008342002, 
-   940021011,  1730860933,  1651887678,  3192375312,   917849760,  3624987065, 
-  1721813615,  1709824331,  4286030212,  1243867293,  3363808182,   884216319, 
-  2633480808,  3158389363,  3687456372,   161731575,  1107318826,  3749063189, 
-  4255664085,  1834690089,   886357521,  1981018831,  2004506216,  3314058144, 
-  2735392911,   259673457,  3596440818,  1882351717,    70671281,  3759780506, 
-   809403212,  3359510080,   968023450,   999739902,  2597614923,  3397894075, 
-  3723433083,   299705855,   138043865,   735342651,  2454368498,  2239235718, 
-    87901516,  3282550877,  3464791022,  3696504272,  4118020119,  2234689013, 
-  3305943961,  2006945306,  3384391587,  1639836346,  2113094716,  2242879663, 
-  4225509748,  1513149275,   303233222,  2839278249,  3452602836,  3568323565, 
-  4079061502,  3008401384,  1006040111,  4173724040,  2341531999,    37610404, 
-  3558662921,  2532360499,  2361893769,  3236506487,  3130053532,  2412642491, 
-  2692542909,    11276981,  3246557547,  1130361718,  1586684171,  1991366571, 
-    40961608,  3546304670,  2092829632,  2514068778,   914297465,  1472731336, 
-  1058849911,  2175759479,  4160184205,   180444828,  3799714775,   113956941, 
-  1273573918,   987696211,  1602851577,  1350726555,  1906036381,  3150296629, 
-   908795215,  1940963449,  2106935780,   489834637,  2429014440,  1330456419, 
-   104319636,  1582749995,     6779341,   354097130,   496240720,  3856077502, 
-  3930119453,    47023682,  1408275609,  3134827963,  1735226679,  3404039559, 
-  4072969885,  1061747709,  1473859425,  2858202063,  1507799610,  1138818447, 
-  2094664960,  4147275218,  4009162432,    56019570,  1972646776,  3622609531, 
-  1146905124,  4141367041,  2215439349,   833403820,  3653217625,  1457641593, 
-  2928662361,  2878718129,  1904317619,  1003507079,  3292762720,   877045842, 
-  2790037966,  3065217719,  1967415795,  1593498011,  1979423159,  1894914977, 
-  2572630192,  3899915792,  3549311841,  3244859227,  3602634800,  2403870892, 
-  1625657972,  1798381601,  1137962870,   541954583,  1132973115,  3224448166, 
-  2287504214,  4087527805,  1279916618,  3444744312,   671482552,  3089312727, 
-   903533436,  4078916347,   636396348,  2132376079,  3360541344,  3994866684, 
-  3103536023,  2752597030,  1182385843,  2644933610,  2479602615,   814026942, 
-  1714252808,  1432537138,  2143279509,  1251406345,  1376578444,   719055494, 
-   834712050,  3039708875,  1345303761,  2369351360,  4283343930,  1379140984, 
-   342977031,   359286351,  1723644426,  1523021164,  3478120827,   310037302, 
-   195617010,  4053173941,  1697125557,  2169364528,    76435590,  2697268821, 
-  3435228660,  3124073575,  1129922419,  2212716358,  3363025659,  1652541679, 
-  2172394276,  1173059543,  3265038505,   694953098,  3170687198,  3810645331, 
-   263415152,   857236000,  3421608100,  1727778511,  2583445142,  3145817536, 
-   377319837,  3409536670,  1926492543,  2355475629,   413121367,  2213707904, 
-  3986634763,  2059901238,  2520395684,    76846953,  3331023820,   971071471, 
-  3546309726,  4096076408,  1649587718,  2717036808,  1841785841,  4181304587, 
-  1533144836,  3308604736,  1411277261,  1771526914,   104076710,  3838134771, 
-  2928892651,   735776620,  1488298478,  2666856977,  2313407503,  2436389639, 
-  1951859430,    54741992,  2449426666,   240452445,  3878109673,   212257614, 
-  2360107098,  2332661066,  2278551705,  2047173863,   683441820,  1341329786, 
-  1147697896,  1160605490,  3986586092,  3931995782,  2476729314,  3316636054, 
-  2837554268,  2903949421,  2351040041,  2197419139,  3886316668,   263978582, 
-   646291845,   896890784,  3896851143,  3771375716,  1748245444,  1816708569, 
-  2255149527,   421796766,  3582542071,  2552020526,  1306059730,  2501733001, 
-  4100091536,  3023898362,  3600294955,  1568131723,  1457011739,  3706683200, 
-   598936988,  3147124895,   239712227,  4225281914,  3608475701,  2949405669, 
-  3201067024,  1884877846,   244453976,  3115336800,  2340488752,  2867785943, 
-  3898578503,  2618944328,  3102593169,  1331041864,  3572275350,  4219113298, 
-  2873328633,  2315599255,  1299757588,  1609700927,  2540536653,  2745389863, 
-   283193773,  2550357134,  3581583200,  2373915065,  3284763094,   564886905, 
-  3443520709,  3641755572,  2666307133,  1849788684,  2102464170,  2322126877, 
-   679471432,  1874094132,  3662573554,  3181191846,   577888807,  1657530719, 
-  3453773790,  1354950150,  1678230549,   859406861,  1644956036,  1395680283, 
-  4121174214,  1854846080,     5437917,  3520004182,   984907614,  3485648819, 
-  3748845822,  3266055060,   893610642,  3916200375,  3319445508,  3664075573, 
-  3339719896,  1343760502,  1974456411,  1363156046,  3112898544,  3438709472, 
-   142190096,  2237078346,  3551059349,   693744786,  4188010881,  3649512140, 
-  1975286182,   473581801,   868700075,  1268283562,   204790700,  3454669618, 
-  2687726795,  2566500552,   296190947,  4027908157,   725217743,  4243870789, 
-  2152070063,  3378752072,  2515450445,  3381211353,  2752420957,  2719731687, 
-  1923105746,  1631215005,   137231008,  3509239638,     6106148,  3461576786, 
-  2033157020,  3455933148,  1081786889,  3886284081,  2507809717,  3602684245, 
-   330273685,  2515598845,   544105652,  3623566172,  2627947196,  3784251557, 
-  2318571245,  1263925150,  2545992192,   911559442,  1494986165,  3871663619, 
-  2770568095,  1631611630,  1712102624,  3915254484,  3099324404,  1815955394, 
-  3615789999,  1385757200,   536384049,  3227936388,  1887119048,   151850029, 
-  3960098922,  1858972954,  3818025022,   337785633,  4188973891,  2120785637, 
-  2332221588,   944149424,  2765093809,   393925097,  1933066675,   983350806, 
-   245665742,  3821346866,  1002843054,  1999965195,   657780767,  4167606562, 
-   563816569,  3124071732,  3798173241,   246049590,  1567202817,  3707458972, 
-  2027288295,  1640979480,   782464172,  3667958194,   911633795,  3679343346, 
-  1449424798,  2682618000,  4046196220,  3133050348,  2852607839,  1933117433, 
-  1401786506,  2896442732,  3430145027,  3103839746,  1475552558,  3677154149, 
-  1737916016,   940621492,  2515191469,  2216715453,  1176960328,  4279936310, 
-  2735503356,  2012624171,  2552241624,  4090193854,  4162715108,  4272785173, 
-  3657395067,  3207826805,  2692364684,  1249301015,  3836083669,  1230681178, 
-  1892055842,   893382874,   932700030,  1635399190,  3387407403,  4186823902, 
-  2099642108,  1850990678,   664986517,  3893729544,   948327448,  1305844811, 
-  3378554024,  1439037234,  3749161100,  3142282469,    74323748,  4198841564, 
-  2881113972,   217524134,   155934167,  1211387945,   208291719,  2635267314, 
-  3008459638,  2361680772,   281745830,  2985285284,  3093548299,   553866143, 
-  3987327260,  4168586631,  1805711675,  3381279505,  2654025320,  1574326194, 
-   115562846,  3112272217,    32457575,  2767667796,  2540721067,  2897066935, 
-  2147302151,  3268182102,  1356238033,  3750780104,  1842595272,  3908063445, 
-  3770782155,  2235106368,   238877190,  1874163139,   532737207,  4072668978, 
-  3414125956,  1019334199,  1738936464,  1567482585,  1332854455,  1209001507, 
-   526897055,  1547360210,   961183049,  4119668671,  4054728779,   943615069, 
-   412471089,  3648321340,  2185214890,  2928747663,  2485705068,  4186506773, 
-  1120156565,  1996332723,  4228592660,  3852298920,  2774996965,  4278872919, 
-  3623050896,  4173443904,  3063137549,   657232028,  1829591565,   342218294, 
-  1613932207,   409134985,  3814696614,  2965348418,  4178457502,  3187803928, 
-  1591372012,  3351373529,  4103504014,  1061282409,   843657391,  2847878593, 
-  3928765556,  2677326006,  2061040931,  2424129572,   713840509,  1848163072, 
-  1037698007,   215340459,  3945232688,  1861163823,   396006392,  2650518932, 
-    79627340,  3415441458,  3413271591,   473197890,  3006227528,  1471297605, 
-   486381688,  2231336264,  2436210862,  1185868022,  2767113128,   170579824, 
-  2399541703,  3480164631,  2172579889,  3594678368,  3548902382,   654918455, 
-  3349554180,  2470531358,   211435367,  1394657474,  2732152917,  3564946690, 
-   400499760,  2049489360,   922478533,   966914065,    38530731,  2712722812, 
-  1377680504,  1533744334,  2688034595,  1504995473,  3242731904,  2091987155, 
-  1454172881,   946086944,  2214233267,  3895309856,  2583466362,  1999365068, 
-  1660526673,  2816894605,  4155849072,  2926058278,  4240462280,  2778682072, 
-  3482040093,  2304536434,  2170072293,  2636668612,  2667622096,  2041372441, 
-  3600970341,  3656557349,  2175571620,  2467719828,  2631223892,   293512986, 
-   971025542,  2814940036,  1809658544,  1887225534,  4221257423,   546583335, 
-  1047202580,   559200412,  1451798951,  3854292504,   575421941,  1133767536, 
-  1121215924,  2781902945,   616074854,  2222300381,  2485020186,  2667819787, 
-  2595708996,  3703534119,   545230305,  3788402200,  2157012686,  1214232068, 
-  4046348610,  3578824457,  2420659250,   519448739,  2407544093,  3148236729, 
-  2302542600,  2727082529,  3825068801,   707292885,  2761407575,  1041458070, 
-  1170567257,   764112976,  3297953437,  2781187994,   865073288,   479654246, 
-  2515619172,   176437757,  3840579790,  2541236083,  2749711201,  1463192366, 
-  2507331757,   801151602,  3509884376,  2413258578,  1176085825,  2676147471, 
-  2987731823,  2181061418,  3003454753,    68778769,  2506873391,   327607123, 
-  2581268437,  3688883105,  1088066606,   550906651,  1099887628,   139379281, 
-  3661901736,   785303695,  3049531761,  3783769109,   446414739,  2454862501, 
-  3147459833,  2445361542,    52512573,  1840784731,  1675642139,  3473863470, 
-  3117573365,   838810906,  1112331625,   685627650,  3244397261,    87768610, 
-  3567603123,  2147565041,  2384683859,  2024017930,  3388512581,  1962728779, 
-   157733533,   104208760,  1404334574,  2204319410,  3363097167,   748440505, 
-   992416444,   226273861,  2316994842,   927783125,  3906885104,  2968686523, 
-  2868165930,  1332766198,   596142952,  2128907021,  3020255176,  2716568548, 
-  1447425617,  1672526623,    52237257,  1295813109,  2038137927,  2169384886, 
-   409459361,  1170718595,  3724958711,  1701489839,  2173752066,   337027919, 
-  1685536986,  1918317674,  1462686676,   372560909,  2685651916,  1306789426, 
-  1187563292,  3509146760,   281493155,  1954403443,  1411248758,   774179291, 
-   384339999,   164286968,  3327153719,  2581598674,   769215272,  2355855957, 
-  2143049662,  2081593655,   964329196,  3258726322,   566774405,  3616818334, 
-  4021870451,  3987672071,  1323209315,  3189264276,  1272376473,  2544363770, 
-   942252136,  1433707567,  1568337843,  1915564314,  3630743038,  2719851406, 
-  1427813303,  2147051835,  1253516370,  2091735348,   919450974,  1753871541, 
-  1717800027,  3617832332,  1255290288,  3553061415,   485897951,  3548338803, 
-  2987493393,  1143018854,  3222663887,  3550014798,   234603878,   429508627, 
-  3713451246,  2036708735,  1800265160,   540289926,  1172923702,  1869745268, 
-  1218528179,  3895994059,  1014578409,  3228837443,  3971189791,  2854293013, 
-   113922139,  2603412509,   413104739,  2145725015,  3312595293,  1400770151, 
-  1372972868,   904685857,  2467670559,  1999533346,  4058058960,   828110452, 
-  2200499108,  3890637205,  3555832709,   477147631,    10570523,  3246426924, 
-  1409838834,  3241408001,  3926856505,  1742801442,  1307102513,   690908422, 
-  2850235664,   696200820,  3642295616,  1887744508,  2673079693,  2682326918, 
-  1943130389,   884519495,  3574442719,    15422122,  2105868524,  1918104302, 
-   394309477,  2630741781,  1987619438,  4030664964,  1463367737,   388302161, 
-  1580829687,  2802121198,  1088683020,  3744418727,  2759660254,  2200906700, 
-   470974546,   411645505,  1665409544,  2365537517,  3107994705,  2012173041, 
-  3806407260,  3703708967,  3520193659,  4096653787,   616243365,  4011088526, 
-   941188131,  2818494081,  3991330267,  4251349477,   261778674,  1923068337, 
-  4238474374,  2657396630,  2124531725,  3150962310,  3429704211,  1051199572, 
-  1729629162,  4093159775,   818033975,  3611103081,  3197945068,  1840517063, 
-    95587418,  3616575080,  1740981864,  4224899313,   631122810,  1502834698, 
-   340357566,  4090141911,  1878907182,  4293560544,  4237260710,  3048432171, 
-   208550559,  3272963745,  1607154832,  3049717256,  1805176754,  2996541061, 
-  3647699678,  3812812132,  4224112889,  2960787161,  1297917816,  2450186258, 
-   401906234,  1108535070,   774437341,  3053411545,  3778888536,     6310882, 
-  2649078209,   277011412,   541977401,   579222531,  3395743576,   267232179, 
-  1719669745,  2599050345,  2289764577,  1149561724,   358528838,  2795573167, 
-  3843423316,   631791882,  4072474296,  1810386471,  1975622147,   196746007, 
-   450179142,  3058917431,  3817535551,  1683023543,  2258787503,  2751793471, 
-  2466986367,  1803636483,  2383404607,  3184459524,  4130547883,  2862877529, 
-  1724388789,  3754511885,   209023543,    71927225,  2463633143,   174625540, 
-  3848834373,  3276700002,  1738186855,  2958585857,  2674107381,  3918129466, 
-   165758374,   546091168,  3510865446,  1591730119,  3353291201,   288761430, 
-   448255280,  3473708715,  2823002917,  3107911081,  3622325583,  3006795867, 
-  2312342780,  2908313369,  1478808735,   700153440,  1595613652,  1853328840, 
-  3357416121,  1811564483,   186133757,  3164166153,  2197514495,  1249245979, 
-  1929266015,  2387526450,  1898376537,  2133263867,  1989762547,  2968269308, 
-   386457138,  2279746551,  3917376548,  2300627986,  3430840148,  2853668942, 
-    94333569,  3326649310,  3633856180,  3068182382,   592878780,  2757063322, 
-  3339021980,  4161408276,  2546475533,  2462514163,  3028726526,  1244207519, 
-  3997382253,  3745478099,   345081365,  2437065000,  3486247758,  3206373467, 
-  2888481585,  2663705074,  1174870019,    13911564,   660464234,  3054963890, 
-   900901482,  2516311671,  1356665320,   523083722,  2409043936,   444590341, 
-   382768999,  2268499639,  2918773309,  3855115461,  1372637795,   371385687, 
-  3138540716,   246386496,   450012453,   129476415,  2660113411,   377219861, 
-    43440239,  3801743733,  1687817868,  2286954671,   284520259,  2198004622, 
-  4013909423,  1162155482,  3712272739,   524164817,  3490624376,  3967023063, 
-  2539045509,   631981489,  2784601464,  3006212293,  3740711523,  4258325554, 
-  3788603424,  1003981369,  1276771922,  1156543871,  1195570872,  1560398214, 
-  2547390322,  2834763696,  2507057017,  4131403896,  1172112048,    82331525, 
-  2550600497,  1142442754,  1419281622,  2800261374,  2651318651,  1037401531, 
-  3364669048,  2160093456,  2385011925,  1512428357,  2961766692,  1981498610, 
-  1683755698,  1017587034,  2460610533,  1467799685,  1730941942,  1895427187, 
-  4268759296,  1090014819,  2886746530,  1287146633,   301377325,  1688788879, 
-  2521957916,  2209909225,   368906481,   198496257,  4055804722,  2271070026, 
-  2299149495,  4280987129,  1073569844,  2598420881,   380844097,   870142374, 
-   291014867,   647365921,  2419397657,   724287575,    25324525,  2117657675, 
-  4217438766,  4156102275,  1209513371,  2676454356,  3280262549,    55248685, 
-   364196010,  3459354979,   160638173,  3767297036,  3112928202,   980260442, 
-  3295042547,  3032274860,  3062571240,  2429562833,   510339678,  1467466629, 
-  3902529984,  1691182070,   143152589,    66377933,  1015454268,   230918550, 
-  3152518034,  2470844890,  3424912676,  2665015868,  2726336677,   445389758, 
-  2219126401,   431551003,  2208927269,  2560403022,  3460186280,  1041409629, 
-  1806087702,  3980774480,   651562001,   313627557,  2284901366,  2893490660, 
-  1548562101,  3480187585,   174344465,  2552748880,   926827480,  2979721435, 
-  1469551462,  1001077615,   823942011,  3917949391,  2574017513,  3001099160, 
-  4038636868,  2051843610,   957751343,  1332101862,  2142552612,  3101251595, 
-  2010060504,  2817510269,  3934372892,  2953379967,  2902332463,  1708792972, 
-  3487515356,  4103560737,  3575774427,  2518343239,  2577054351,  2838739444, 
-  2989399400,   205540738,  3677073240,  2029515720,  2498416321,  1872133140, 
-  3147146769,  3138220076,   657739176,  3549369012,  2819642167,  3286175242, 
-  1517685655,  4242953902,  2100414801,  3877180281,  1648062815,  1020265030, 
-   404338347,   737011651,  3303124833,  1862934687,  1379655558,  1073782152, 
-  4272415572,  3448911757,    24437157,  2389817612,  1351713793,  4241988223, 
-  4244738695,  3768240976,  2319818775,  4273993419,  4024586933,  2909502338, 
-  3626022764,  1123908901,  3472404531,  2719750914,  1260249932,  3915161776, 
-  3416596591,   898449845,  3014042830,  1411192926,   535612273,  2646339548, 
-  2053942413,    52967473,  2018783885,  1293282561,   258900011,   135931909, 
-  4209806809,  1149152190,  1808810027,   332725360,  3618372399,   562136348, 
-  1732398281,   390960254,  2441563445,  3475825182,  1501439529,   306593604, 
-  2684871244,  3766901311,  2308331074,   127118739,  3845841481,  3757758749, 
-  3973880271,  2793169200,  4077259651,  2340283303,  4235079684,  1520181096, 
-   893198142,  3903431686,  4205149035,  3878434307,  2295969116,  1256764100, 
-  3610267786,    42016757,  4096318602,  3345065168,   129184364,  2321211388, 
-  2451632441,   199355310,  2347778753,  1606612649,   617895007,  2813397020, 
-  2973791671,  2238341698,  3439721067,  1349828130,  3379835027,  3647367077, 
-   225667474,  3647970468,  2023565361,  2838696816,  2879972126,  2145106622, 
-  3699793310,  1975147058,  1445038525,  1542358611,  3511236084,  1478012558, 
-  1772358156,   661519373,  1850416445,  2189139743,  1061907664,  2168707340, 
-  2797849510,  1327355771,   742992108,  3821514174,   127496218,   570311104, 
-  3892723711,  2745088364,    16195705,  3039973112,  4153563712,  1918382353, 
-  1006002730,  2757332506,  2592081295,  1760138897,  1465674296,  2368935821, 
-   351468888,  2745983392,   385698768,  4011252299,  2451202038,  3963345511, 
-  3611009389,    81505031,  3188318231,   378940444,  3412376545,  1271585582, 
-   996428319,   497891601,  3668700709,  1623009845,  2995540228,   380790498, 
-  1614202038,  2465148032,  1999313596,   255228766,  2646438489,  2225501992, 
-  3571966984,  1854579900,  1304338783,  3389640069,  1635912911,  3839204488, 
-  2934079519,  3511278977,   227596856,  1714954354,  2018496039,   888865893, 
-  1992692866,  1766221087,  1650884929,  2744457199,  1186619750,  1548088594, 
-  2760565209,  1097013722,   823879641,   524115747,  3200133144,  2238938553, 
-   838265240,  1709841663,   167919430,  1914921657,  2517889461,  3309716606, 
-  1156106157,  3175175789,  1834090588,  3316929321,  4282902878,   967125630, 
-  4237778079,  1002221652,   745012517,    47448623,  3218372677,  2870859576, 
-   242257704,  3311215393,  3102980159,    36858765,  1468540941,   713144745, 
-   332719071,  2645798648,  3290820183,  2043709226,  1642358022,  1581196686, 
-  3016247004,  3465334457,  1880789413,  1387894639,   475465367,  2662719887, 
-  4224871170,  2589792195,  2285688544,  4013774920,  2822723230,  1190555610, 
-   467922681,   812808496,  3132266105,  2418083124,  1519065707,  2432690968, 
-   446381283,   717603391,  1556505260,  3084495298,  3424565287,  1292714762, 
-  3965278375,  2608738579,  2212169594,  1202698521,  2077913706,  2789832265, 
-  3696762390,  1701936848,   245506312,   902621099,  2005591173,  1673542787, 
-  2700649837,   343335783,  4069369296,  2852951643,  1405534779,   980537524, 
-  2979555229,   730671549,  1419049786,  1223520328,  1928841230,  2779735312, 
-  2076286796,  2129306967,  2527334103,  3464197567,  3265805946,  1823459672, 
-   653044632,  3564612879,   279241545,  3663330103,   186928824,  4131272039, 
-  2578097914,  2366397142,   746076997,  1328164758,  1997139063,  1834780379, 
-  1827852032,  4174305360,  1750109936,   397939140,  1178125279,  2479105985, 
-  3837201543,  2694578113,  2173131860,  2424285819,   810295923,   559107460, 
-  2744295152,  2319127585,   300405377,  4057780990,  3691089024,  2165508189, 
-  1651670342,   791519932,  1013750016,  3438220071,  3270351438,  3543331459, 
-  1410717875,  2813404085,  1790359694,  3576853530,  1334271506,  1198898861, 
-   765440864,   779072182,  3227589483,  4146308130,  2956509865,  1181239836, 
-  1520221664,   227067247,  3617890216,  2787986691,  1504252626,  4114333483, 
-  2397334275,  2500590299,   887610116,  1017282527,  4069218810,  2497472625, 
-   127956655,  1075846893,  3154382171,  1557058798,  1421186247,  3434751863, 
-   631802472,  1455044898,  1662133930,  2656378099,  1953951151,  3871178372, 
-   439369021,  2033251423,  1838705928,  1145147120,  2392396122,  3709761412, 
-  1013140352,  2662046165,  4220945806,  3974171703,   197078087,  1275910365, 
-  2330960437,  3519068800,   264254434,  2694918818,  3959029062,  2393099014, 
-  3649377099,   939993792,  3837379779,  1101746879,   785467061,  4010450097, 
-  3015917577,  2922370211,  2190146187,   545540142,  1959562350,   870907665, 
-  3303176123,  3516900397,  2408409327,  3327241036,  1058015763,   716483089, 
-  1601463554,  1421607279,    56787793,  3690816890,  4236947127,  4253784731, 
-  2605718679,  2762462389,  3423952861,  3141560370,  4113741267,  3121500422, 
-  3826190367,  2014326820,   335843014,  2175351137,  4121187864,  3337094965, 
-  3496226347,  2759155171,   387573809,  2458849830,  3162364581,  1962632124, 
-  3634086012,   857799838,  3482834139,   864613912,  1578247745,  1355972865, 
-  1110938734,  4017148952,  1261141919,  1654385588,  3442044193,  3939561746, 
-  1413588682,   679106237,  2916470193,  1959250753,  1719418078,  3379826939, 
-  2942125194,   309396666,  3055486985,  2001049249,  2575247039,  3130374123, 
-   797345523,  2168163463,  4120248908,  1406208245,     3617958,  3347101644, 
-  4254147938,  2561312781,  1153693850,    62541271,   649647194,   479536156, 
-  2982159366,  1406838922,  3375674252,   311767356,  1919005423,  3746931313, 
-   550097756,  1088455358,   357539590,  1838714308,  1777204572,   315794070, 
-  1623658338,  3794872770,  1609129340,   721801108,   585695236,  3982110647, 
-   745153757,  3963367211,  3577025562,  2419584431,   292982676,  2025188198, 
-  3497427063,  1689427733,  3789940051,  1058668638,  3574299357,  3942376747, 
-  3019951394,   331036712,  3551523588,  4140135966,   354737129,  1386877317, 
-    83313330,  4268764406,  2442258912,  2301359306,  3476037366,   302634499, 
-   196702527,   832451487,  1579136958,   811596449,  4216367967,  3070377681, 
-  2822920387,  1608895492,  2190229632,  3240881007,   190572137,  1042755947, 
-  3741735376,  1824524043,  3558524805,  2030118864,  1259568112,   349380527, 
-  3803864161,  1801026620,  3652649520,  2657705780,  1653778571,   643706518, 
-  2910358936,   302584304,  2825540732,  1305829852,  1428182627,  3185800133, 
-  2366456788,  2625478922,  1163114135,  1784516391,   994045567,  2171947407, 
-  1962347898,  2289497082,  1411329991,  3190693796,  1143030875,  3817650332, 
-   535460445,   654462994,   773460547,  2639416523,   480581138,  1732594704, 
-  2226695902,  1374427071,     9848356,  4083193033,  3065351043,  3952369089, 
-   228699644,  1505752230,  4198819383,   928571602,   357653051,  2538912638, 
-  3431004575,  3016233060,  2143369982,  3428861569,  1349925645,  2850184509, 
-  3763749588,  2685611192,  1235961591,   225673059,  3602279966,  2283023344, 
-  4145241372,  1888898062,   583624546,   573324873,  2984696300,  2736047856, 
-  1057350502,    89119719,  2641104754,  4109176847,  1069415863,  2565022970, 
-   600532413,  2059450891,  2595804227,  4065687747,  1003409639,  4144944734, 
-  1566308598,  2826553001,  3424630141,  4023750405,  3444842654,  2116704247, 
-  3118732301,  3933317735,  1273147677,  4095097422,  2847657132,  2218530962, 
-  1593959097,  3424681498,   928888132,  1261450759,   776034774,  3650975498, 
-  2791297551,  2976016695,  1158395670,  2600452600,   895987284,   770523957, 
-  3332988018,  3155216489,   240248765,  1199159213,  3445829484,  3212249543, 
-  2060716683,   793302143,  4283039722,  1160127738,  2114516556,  2335321579, 
-  2555221981,  3493645505,  3424149392,  3191278518,   117965737,   396564272, 
-   718350790,  2742242149,  3762461940,   488528961,  1809549019,  2070700790, 
-  3673467450,  1910627498,  1535547129,  2030958574,  2342566485,  1366566727, 
-  2056960075,  1790577007,  1212858857,  3706143918,  3479295556,  3538671990, 
-  3022865500,  1102673214,  3594468870,   917056759,   665700028,  2171359285, 
-  1025886555,  1948506846,  3348923634,  2276571410,  1721035499,  4279569185, 
-   596794712,  2871355999,   840756915,  2263553120,  3492398849,  4055710782, 
-    63777883,  3358412533,   376921369,  2026231628,  3010808168,  3824693792, 
-  3898821864,  4204016904,  2968347973,  3397799373,     5506924,  2442047782, 
-  3222532176,  2202335579,  2247390373,  1360937276,  2882312553,  4140013061, 
-  1861233056,    12532129,  3785519075,  2540801042,  1877762647,   919442579, 
-   277806049,  2615510840,  4261610943,  3108736063,  3035109676,  3677874694, 
-  4066942453,  4141397609,  3161970480,   354949511,  4145242460,   261114076, 
-   212301442,   101956603,  1369393592,  2595543807,   228107290,  2073390205, 
-  4126350787,  3283870699,  3374994046,   410882838,  2311278814,  1396655340, 
-  3254620695,  2475762236,  1930240785,   106682648,  1895684648,   589139785, 
-   678780222,  3547548714,  4127386675,   162188218,  2267651663,  1556067600, 
-  2144038986,  3275742597,   905985696,  1402312097,  2661405468,   689880403, 
-   187261909,  3448084241,  1790590120,  2821299520,  1145451508,  3115970511, 
-  3651763187,  1351035783,  1133832229,  2000153715,  2950784535,  1850824559, 
-   757842913,  2376333182,  1349661657,  3821582692,  1086412735,   486093205, 
-  4230793848,  2450252810,  1877698831,  1433705396,  2043744409,  1423498072, 
-  1735367547,  3833892985,  3084771545,  2612062892,  2351553218,   771975761, 
-   668369643,   343242190,   148339263,   464986473,   389975109,  3861772198, 
-   104124888,  3441053919,  3160809096,  1451195981,  2241576985,  3952785743, 
-   558752309,  2316836274,   743035219,  2288089819,  2537946136,  3021060703, 
-  2932329972,  2921801802,  3711740956,  3873587978,  3521502416,  3471411429, 
-  2448890538,  1388083125,   709822954,  3482759078,  4233664644,   695797885, 
-  3190430640,  3938688721,  3376241719,  1846222591,  4238419954,  1299909098, 
-  1683961621,  1331195250,  1933169776,  3352393739,  2080486401,  2509201801, 
-  2573487044,  1750803748,   517336575,  4050153463,  2901461921,  3017296277, 
-  2859595515,  2395720819,  2193977400,  4143077117,  2320195557,  2039469638, 
-  2717440846,   603703811,   298382181,   717318857,  4293037301,   497463312, 
-   874172552,  1041249640,   805622818,  1570528954,   597309466,  3742416837, 
-  3305490578,  4270895874,  1535208502,  1819242215,  2770831709,  3762508779, 
-  2221427370,  2660311160,  2920826180,  4183405756,  2492377450,  1070319062, 
-  3067319658,  1738556925,  2861203707,  2687496151,  2726168165,  1999250514, 
-   874669228,  1345474511,  2610327327,  3203601432,   498767773,  1738576114, 
-  1242126782,  2422632144,   443179713,  1437557025,  4287148888,   941649796, 
-   756192449,   261569633,  1490547632,   357757222,  2944866285,  2818329048, 
-  3902201915,  1777755294,   855683063,   158993971,  1768214660,  3224286413, 
-  1962543683,  1272429899,  4101796941,  3098318808,  1336374168,  1880907190, 
-   530855688,  4192985342,  1102085136,  1454743747,  3731585113,   894337655, 
-  1894902771,  1419146789,   377240971,   501895900,   311718474,  3983909456, 
-   227823375,   272247244,  1385154649,  3740294100,  3523305771,  2219165431, 
-  3490907920,  3717974896,     7313338,  1024837640,   740615823,   291280627, 
-  1612201593,  2990695409,  1569043272,  1373948066,  3733126785,  4066190153, 
-  2743521684,  3584986863,  2299807227,   438426165,  1792695081,  4109030674, 
-  4077835283,   995068497,  1026654683,  3326247584,  2217545313,  3923098720, 
-  2638526545,  3196849308,  2599583502,   416972522,  1860977939,  1277294938, 
-  4101609852,   492350875,  4128829934,  2538519811,  3640760407,  3893392201, 
-   473464953,  2621797184,  3838821009,  2933293137,  1463522982,  3101593755, 
-  3621405506,  1557381302,  1257244268,  3801691492,  1869130876,  4108740703, 
-  2815877692,   879443175,   474262020,  1194599538,  1643074013,   760986474, 
-  2141710859,  3964536190,  1461234855,  1284771443,   340804597,  1372265028, 
-  1155493205,   664655406,    22592474,   349983254,  1512858870,  1563506765, 
-  1895420977,   394518181,   771770207,  1212728155,   446200329,   701387443, 
-  2543381443,  3750569046,  3852039925,  2513925409,  3455067629,   328528478, 
-   492719194,   587668940,  2502803840,  1706853491,  3625723359,  2165782031, 
-   877767300,  2500251996,  3501422983,  2351034112,   464476248,   975391591, 
-  1606002591,  3468430018,   975381645,  1052690276,  2188438974,  4155349154, 
-  3087519153,  1154570287,   935768832,  3594458622,  3745279563,   994161354, 
-  1385963995,   695994657,  2944537081,  3301188587,  2575892184,  2417350404, 
-  2764483553,   674255493,  2589329217,   434209104,   805258637,  3272140735, 
-  4145298019,  2543939359,  2800315034,  2798313909,   454210707,  1854636572, 
-  3671219934,  2755479585,  3645225066,  3552052552,  2184089317,  2879070279, 
-   972963728,  2368186726,  3610313102,  4024103239,   596161203,  2942492834, 
-    13450311,  1836433235,  2528077193,  2985507028,  1584178008,  1141885521, 
-   122529054,  2378798505,  1693234899,   417715610,   834182142,  3208246061, 
-  3705797533,   624097560,  3546412422,  3826918487,  2580590550,  2207805142, 
-  2420462785,   605336635,  2904478533,    44639122,   272251827,  3740370649, 
-  1477723647,  3924469829,  2407697128,  2658630019,  1715411239,  2784908696, 
-  3557453897,  3454053480,   839502932,   609144933,  2425025234,  3840883780, 
-  2206844992,   301381564,  1195303513,  3358047585,  2413584026,   133698300, 
-   433282768,  1631058511,  3194031083,  3047166923,  2025282695,   385300184, 
-   135418281,  1893374957,  1581189342,  2897436006,  1993477459,  3925344282, 
-  4098466359,  2824346981,   313076289,  1205901755,  2471050480,  4259661360, 
-    90662194,   627969692,   520530838,  3130223474,  1568849916,  3205917337, 
-  4006207361,  2021681214,  2668990292,   463767584,  2913076262,  2121643508, 
-  1673093563,  1876606063,  3536276552,   772368307,  2253541158,  3960496659, 
-  3247518823,    71978311,   692076650,  2000589703,  2262717564,  1556756806, 
-  1251872861,  3813632390,  1118734083,  1189270349,  1574791035,   744548509, 
-  3975655607,  3616941312,  3112642095,  2589795214,  3986782566,  4080030497, 
-  2161743402,  1996074726,  1980721068,  3566943044,  3728295470,  3801777536, 
-   880220050,  1199593730,  2961089884,  3480460320,   944631293,   288967516, 
-  3200272728,  1994298587,  2657802845,  1849821589,  2465031922,   802512420, 
-  3488448796,  1681127574,   276536328,  2802945632,   232312986,  2422228668, 
-   887171205,  2851082348,   579895915,    48339219,   490555893,   258980702, 
-  4119489384,   867036243,  1840679504,   170513002,  1545874425,  2806115503, 
-   838153667,  2638525146,  2371458095,   401375893,  1626801316,   738056398, 
-  1733932520,  1670281316,    39002503,  1605907038,  1599401854,  2612112049, 
-   449528034,   683962631,  2736578883,  2126684123,  4009577728,  1569421042, 
-  3925458767,  1471015208,  3787932718,   747200999,  2318785472,  1905069706, 
-  1872442595,  3942497220,   446954830,  2308511942,   808205390,    66633948, 
-  1792326855,   692842493,  1453687626,  1201017396,   926647270,   707238396, 
-  3973194160,   616712844,  3169108122,   908982816,  3611537427,   806859184, 
-   428449617,  1061354254,  1593032350,  3842759954,  2058367859,  2137480395, 
-  3378375391,     8947584,   103881883,  3256828590,  3134815173,  2468933423, 
-  2679202623,   616969133,   172985508,  1510436035,   426490295,  3356870849, 
-  3108975725,  4266713351,  2474534125,  2695450710,  2414791029,   600617564, 
-   126643442,  3765645680,  2348624684,  3890745668,   867360493,  2956924437, 
-  1897526867,  4292720596,  3469539234,  4037957812,  3177177154,  4090021946, 
-   265655556,  3778318520,  3681689555,  3154730181,  3960714126,  1223898419, 
-    96486030,  1835174706,  4164848686,  2159839949,  3926269277,    28843861, 
-   735630956,  2668349170,   137017918,  3636449323,  3798446486,  3915340690, 
-   600881639,  1952854348,  3391921148,  1352615629,  2502793544,  4211425005, 
-  2920403325,   920831271,  3184348422,  3313905244,  3288781937,  3159819915, 
-  2623512711,   440419134,  2259226960,  1970650746,  3590396303,    73132708, 
-   316033179,   637322278,  3662278776,  4066492427,   687676317,  3574605022, 
-  1826273477,  2862373394,  1466361030,  2981514703,  3001328756,  1702415679, 
-  1407816173,  2000949958,   825910551,  2796665758,   926530770,  2805753170, 
-  3048600408,  3083827164,  3989154043,  1268280060,  3699889651,  2511966688, 
-  3837843550,  2043424730,  3225603379,  1347091970,  3393281543,  2410205635, 
-  2192257091,  2938054392,   321865762,  3718313809,  3953456402,  1701734405, 
-  3642324317,   479241225,  4015522392,   898116532,  2548028441,  1935220768, 
-   830100444,   426335006,  3199290964,  3780062329,  1219387181,  3260587882, 
-   568233503,  4146387690,  2326203957,  4153457223,  2326311873,  4056713891, 
-  3920773058,  4251980567,   886451491,  3149232346,  2347179304,  2128920853, 
-   555927048,  2971981214,  1236375355,  2707707954,  1357997841,  3955422217, 
-  3875282218,   573950460,  1234341497,   493044106,  3817937787,   781999610, 
-  1686605039,  4254909645,   440774898,   221701819,  1679231996,  3742385361, 
-  1222083567,  3724072560,   687551304,  3658937285,  1586461446,  2964661583, 
-  3360299725,  2600695287,   377799577,   826936260,    23109273,  4039708505, 
-  1383780846,  2803331485,  2306758277,  1267695502,   642672755,  4064908688, 
-  3376300825,  3103089818,  3616527900,  1725891662,   453352897,   262781384, 
-   670748829,  4096158061,  2117410251,  3110751987,  3659518640,  1533927947, 
-  3930990922,   915381334,  4192187216,  3678936983,  3281799965,  1093940278, 
-  2440455119,  4026932757,  3662111300,   351668571,  3019902105,   868947273, 
-  4203738176,  2738587760,  3473259573,   331098432,  3477454330,  3247349932, 
-  4006228112,   482790013,  1033454200,  3105270255,   708992330,  2065567260, 
-  3920427967,   534720058,   195646323,   326121859,  3518640643,   479006797, 
-  3010420920,  1104793703,  1168058321,  1149581871,   438448262,  3010673205, 
-  3421769784,  4106626938,  4258269223,  2771200154,   396665042,  2503362368, 
-  1065697916,  2624178112,  3856235041,  2928216435,  1892579327,   404049978, 
-  2454288141,  4137198454,  1885902426,   882711834,  2950050997,  2193165097, 
-   268111563,  1990548412,  2430932706,  1980890029,  2497857184,  3250160185, 
-  4208282018,   422919626,  4195930333,   249358135,   214870828,  3613592687, 
-  4213174577,   595750452,     9482046,   914706557,    58661423,  2795951341, 
-  1537607324,  4077165348,  3188871198,  2518318503,  1807574101,  3168578298, 
-   499855544,   878109670,   901033603,  3934958629,  3193914599,  3866587578, 
-  2199831415,  2203571134,  2195321414,  3472998376,    83326270,  1977193770, 
-  1518345956,  3831389008,    31985401,   949131745,  1210778186,  2835379672, 
-  2760253357,  2838794834,   154324274,  2330929811,  4160856381,  1065057979, 
-  1708106898,  1448175088,  2380509893,  1994433223,  1702074894,  4109805139, 
-  2025537118,  1649847152,  4256198650,  4277213779,  2490383086,  2701487604, 
-  3587224403,  3760488239,  1091407530,  1797105469,  1300453870,  1872979025, 
-  2293292995,  2612418214,  1578248037,  1812241697,   439629995,  3902781300, 
-  2321487087,  2211533848,   536156808,  3526323053,  2145554551,   196882410, 
-  3155712380,  2764059232,   415441514,   109464725,  3325256667,  4121294685, 
-  2411030698,  3655020169,  1855203861,   383593569,  2395968586,  1839531886, 
-   683476190,  2637608511,  4125028620,   240602801,  3734832970,  1904301217, 
-  1134234398,  2717870494,   121483367,  1111068419,  3065102273,  2491268326, 
-   453204705,  2290788075,  3605289511,   881244811,   756073080,  2926488020, 
-  1602820357,  3267702277,  1960152271,   100602448,  1055783054,  3111787311, 
-  3707809297,  4105301124,  1812857018,    59026257,  3654514023,  1751920936, 
-  1264709809,  3030717862,   952184931,  2547692476,  2691305121,  3981357774, 
-  3746733571,  1544866751,   735621321,  3135518983,   121420230,  3484832453, 
-  2379446379,   916956381,  2765258185,   916830431,  3314077134,   198019015, 
-  2950972262,  2414791524,    92512017,    60651311,  1092876404,   933185357, 
-  2402402981,  3626699590,  2446858275,  2760247411,  1521417484,   891225365, 
-  2196931335,  3513654196,   562733388,  3284472835,   343570682,   729436369, 
-   166832458,  3515616777,  1162076870,   874124597,  3443710848,  3759720106, 
-  3623583021,   541374660,   672187879,  1011207521,  2660403068,  2447479013, 
-  2651021318,  1351367725,  2425542251,  1780036541,  3828229681,   814264758, 
-  3061583178,  3364271759,  1698134382,  1166931063,  2002729514,  4178813748, 
-  2526004946,  3120568897,  3555880747,  4205607836,  1434382300,   774781898, 
-  1339095652,   160416470,  2935081542,  2748234339,  1283474440,  1953889456, 
-  2512108347,  3649153982,  3993671919,  3500036123,  1303184824,   620873071, 
-   491955541,  3385137623,  1971496045,     5642845,  2083502369,  1732303026, 
-  3109058132,  3828896565,  1936683509,  2588562285,  2253590421,   726285171, 
-  3357825728,  2733160600,   615638044,   168338733,  2113804873,  3623602093, 
-  3729590644,  2949648329,  4250918964,  2850181347,  2126864029,   248073064, 
-  4060447414,  3157945335,  3844009036,  3498707958,  2018560445,  3879907547, 
-  1448289047,  3702456932,  3101521913,  1480456321,   708730410,  1250899596, 
-   558099663,  1254654218,  2149102579,  2703697864,  3215326759,  3542862872, 
-  1054514371,  3580675504,  3559062397,  1456405253,  2625474946,  1500759519, 
-  3080984111,  1784885721,  2073836436,  3015652857,  2150661033,  2114394838, 
-    10727963,  1079208799,  1694805403,  2607370502,   680503869,  2686886765, 
-  3293596574,  3507228247,  2058116387,  2726822085,  4119110485,  3997000096, 
-  2955767544,  3024993603,  3919064435,  1702684862,  3111590268,  2520935278, 
-   749359792,  3777643581,  1681815322,  1624923537,   542179025,  2093658292, 
-  3587178428,  2766824162,  4027285379,  2041843618,   884814042,  1993810546, 
-  3113158935,  2178905570,   823372298,  3750124475,  2452209263,  4134437049, 
-  2475759723,  1743260987,  4218733207,  3656101455,   810389388,  1462614968, 
-  1772023102,  2456374535,   805040435,  2805004589,  2382918630,    10736765, 
-   853467735,  2514122550,  3193289162,   669266683,  3052642269,  3638721283, 
-  3325116752,   308583098,  3451095839,  3673331788,  1278494658,  2378645942, 
-  2056422218,  2373908944,  2985626669,   372653203,  2902116643,  2758097227, 
-  2449668083,  1028661574,  3983477168,    76884059,  1284344283,  1067620393, 
-  3083082235,   472489612,  1752972372,  2262215006,  2875724646,  4233756850, 
-  2592216911,    26685641,  1678521398,  3649237678,  2030132217,  3201182000, 
-   305311445,  3147627757,  3314072095,   767695949,   159399616,   592868857, 
-  2964320544,  3591531829,  3092518782,  2775984734,  2722517658,  2868607609, 
-  1410203785,  2712975019,  3497685072,  1678109918,  2739154027,  3466463274, 
-  3474823845,   109817205,  1310566818,  2548128512,  2962818012,  3060161588, 
-  2897202151,  2993673025,  3364783936,  1034545751,  1217754494,   282665353, 
-   717145248,   326266669,   962902742,  1042473593,  1176420128,  2465226236, 
-  2349097947,    86934196,  4256281513,  2723392382,   122090417,  1492556139, 
-   194367205,  1261786529,  2731967502,  2279602290,   563235526,   747462020, 
-  2094848621,  3294035382,  1296419918,  2256033811,  2030964119,   738424429, 
-  1745607675,  1126325079,  4228409676,  2503671672,  2971754233,  1880547706, 
-  2428616683,  1273926490,  1742083930,  2862855914,  1512174487,  2182475639, 
-  3416467315,  2436314417,  4089338622,  2676247666,  1318987180,  2773727722, 
-   380848380,  4237094143,  3461745678,  1056832329,  3078114330,  2160419345, 
-   208609004,   493820162,  4064835151,  2634600117,  2528921741,  1178441420, 
-  1007389564,  3503858852,  4219499517,  1136357646,  2022671377,  3797042020, 
-  2549008643,  3495825189,  1448053573,   272217461,   816472989,  3591925394, 
-  3343083230,  3024198918,  3771956522,  1811216321,  1372484868,  2879122090, 
-  1042491960,  3091833510,  2657950617,  3432402082,  1211808843,  3175603824, 
-  3485028195,  1384341436,   801317143,  3608169536,  1875206472,  3673459632, 
-  3562428993,   317643099,  1063563480,  1552452690,  1820279091,  3900639450, 
-  1836197209,  3030987997,  1902742567,  1245383867,  2037931340,  4021247904, 
-  4268977607,  2726536339,  2734849286,   837801310,  1908428896,  3649399503, 
-  4140436479,  1083684228,  4179316257,  4120702302,  3378045444,  3068653411, 
-   226595874,   414774681,  1085683940,  2270194070,  1580844218,  3378906951, 
-  1152967098,  4084414562,  1435306659,  1829610231,  2245506090,  3223116570, 
-  2186498065,   673694330,  4277289282,  2691351813,  2596752129,  3617405186, 
-  1658703123,  4092988096,  1101720968,   321366675,  2205094529,  3527434061, 
-  1249848627,  2249735015,  1109404321,   120778873,  4098352750,  1789813746, 
-   321985997,   627459188,  1859945597,   121545236,   961410697,  3700636027, 
-   699300448,  2592526689,  3074081201,  3300668882,    68157960,   330072381, 
-  1962440356,  1572106217,  3944459246,   610077944,  1396300675,  2556903320, 
-  3268870946,  1238201499,  3914400326,   875676514,  2113433444,   605663162, 
-   611125215,  4234352513,  2799261786,  3118888483,   843816914,  3590641686, 
-  3248184339,  4125591599,  2137484019,  3000740189,  1069278238,   305006478, 
-  3513628870,  2703073650,  3221709128,  4183849598,  3376873574,   375025365, 
-  3269454026,  2136290061,  2920306192,  2449892592,  1616633978,  2738071720, 
-   411100922,  3938947811,  3226847676,  2024576480,   196772272,  1242199975, 
-  1390781656,  2568768461,  2490852380,  2278609274,  3183711823,  2704919871, 
-  2321950624,   206021973,  3139137796,  1196575815,  2678506885,  1922610872, 
-   559313324,  3039259603,  2878099540,   893232306,  2207423972,   924682438, 
-  1780247660,  3301831108,  2036912143,  3543095140,  1832112035,  3620334231, 
-  1727281807,    37017143,   838027353,  1667724534,  2136818030,  3951975078, 
-  1357229818,   276125370,  2815062209,  1773431184,   653275690,  3605087524, 
-   626721364,  2160961295,  2001657802,  1994614993,  3901963348,  1514826386, 
-   954009854,  4077325834,    47396454,  3161699033,  1021854625,  1019917415, 
-  1677500008,  4204868689,  3377651610,  2490193241,   422534149,  2229703046, 
-  1269393693,  3522186122,   928317212,  2088561547,  3527812465,    67940765, 
-  1640232485,  3051988684,  1257040994,  2320159111,  3833578780,  1379194272, 
-  3129779366,   670279316,    82869571,  1078802813,  2923923775,  1924497255, 
-  3356169558,  2865680313,  2377275714,   337579956,  1626658443,  1319075635, 
-  1484791415,  3028311375,  2530974838,   917973636,  3632285102,  1651970265, 
-  3908291411,  4130271979,  3095656616,   323615743,  3986532586,  2863763028, 
-  2297478146,  4166389714,  2655848806,  3650315152,  2484315599,   820473083, 
-  3920942105,  3638308705,  1657676501,  3717782551,    61667121,  1778776904, 
-  1621973092,  1572233004,   772146458,  3496226314,  1700959311,    87609379, 
-  1559192179,  3920314405,   262023782,  3240906344,  2279717064,    23287493, 
-  2998696109,  2110344078,  3597343895,  3858641798,   489646351,  1175880085, 
-  1182201246,  1857843451,   500424235,  3032649825,   836588942,  4076898524, 
-  2039586230,   759596110,  2112380261,   375768924,   713172614,  1395290162, 
-  3760547937,  2756910135,   780355152,  1649285267,  3742005301,  2708780470, 
-  2770407301,  2184967040,  4088925012,   196146577,  2826675335,   161930644, 
-   582440587,  2461618232,   102321401,    69995575,  4085267154,  1282532063, 
-   938891537,  2642713356,   915742030,   285483629,  1632964936,  3622984308, 
-  1136889067,  1820470683,   160207158,  4200066997,  3242994802,  3300920886, 
-   853997524,  3483961780,  1801139954,   897456647,  3009736532,  1708241221, 
-  2245009102,  2717016586,  3972324023,  2800057009,   402816063,  4294399608, 
-  2048435692,  3162669173,   954040435,   607873780,   671885516,  3178309435, 
-  3969937493,  3630219980,  1959712426,   749343639,  2870378237,   755344990, 
-   351686773,  1855646827,   288480267,  1376873021,  2794327525,  4147998787, 
-  4267869895,  3350462139,  1041004658,   559616239,  1983260770,  1579312682, 
-  3261383003,   946117449,  3860046581,   719231679,  1989405355,  2967711151, 
-   109235254,  3731108490,  2119954381,   350551898,  1250496942,  2501369056, 
-  1594232488,  1739795472,  2387219817,  3709707136,   123978431,  3482876924, 
-  1274067902,  3724837390,  3134541997,   974707789,  1881852568,  3074445177, 
-   484524776,  1586191510,   406642670,  3813543947,  3141604218,    49408542, 
-    41306213,  3529426970,  1450266232,  3965453541,  2580406069,  3584299555, 
-  1616883474,  1884022262,  2863683515,  3050819122,  3388154937,  2432537449, 
-  4006801606,  3059235066,   374323249,  1964219442,  4044342066,  2954484600, 
-  4121343005,   303563652,  3332202960,   986860880,  2394079485,   665548954, 
-   720719346,   244459885,  2170702231,  3082794305,  2229659912,  3812614789, 
-  3943380431,  1280837045,  1954739822,   777324040,  1446684354,  1195296331, 
-  2105395665,  2308219584,  2171205168,   616182061,  1569777252,  3354376403, 
-   426183253,   476250528,  2057059195,  2233408776,   954304709,  1475408105, 
-  2028073212,  1636540757,  1519739600,  4145288914,  2867341344,  2084659620, 
-    95628544,   231111315,   453324935,  2186847265,   485439079,  2271111630, 
-   475704171,  3953112708,  2982117326,  4183997494,  1617335807,  2731174293, 
-  4094901153,  1371111253,   493641718,  1516197048,  1241446904,   373740418, 
-    32722973,  4158133513,  2437027295,   591434220,  1931412866,  3615549377, 
-   767154954,  3960566044,   281904084,  1254381532,  3030228609,  2196575083, 
-  4236300893,   288210211,  3033646852,  2081328346,  2203953442,  3800020759, 
-  3174824843,  3362850536,  2395247107,  3177493934,  2544783236,   702643247, 
-  2816564924,  3554137847,   343806682,  3951131694,  3097718047,   647780673, 
-  3240493506,  3761219993,   559688095,  1329780689,  3406500297,  2911238989, 
-    67700781,  1409453539,  1328215239,  3549086975,   352117245,   660970322, 
-  2832380648,  3534971261,   637069795,    77684039,  3086426887,  3101792954, 
-  2343870745,  3225618513,   953833358,  2911862751,  1439242475,   770666569, 
-   462917091,  3815473207,  2022302872,   512051077,  3726550599,  3553287490, 
-  3201173395,  4270813308,   409306316,  3569460346,  4255769308,  1746694224, 
-   251487833,  2267660763,  3458946561,  2823128001,  1016343303,   110453002, 
-  2269079962,  2936012571,  1279756407,  1624420068,   765575941,   982464618, 
-   906491520,  2937635406,  1075424345,   793742360,  3347253678,  2432260322, 
-   175900848,  1264913395,  4055036659,   980829507,  4112598209,  1660707086, 
-  3108617497,  4074064566,   782991497,   869895459,  3202820292,  3312206117, 
-  2269079955,  2733520164,  4294288243,  2342939498,   399590759,   149085529, 
-  4150307385,  2710091399,  1310749621,   698216144,   832000497,  2190145965, 
-  3806199945,  3840929343,  2027828947,   440635423,  3809294867,  4112119091, 
-  4282225370,  2469315317,  3457691749,  3129901389,  1082836659,  4228595920, 
-  2360734803,   211685785,  3508078662,  3746820750,  1050477920,  2569841134, 
-  1934811659,  1740294986,  2787949658,  1006237014,   176116814,  3747810834, 
-  3318722358,  2527774643,  3521006639,   856700538,  1764060580,  3491133300, 
-  4047258851,  3931176788,  2987147664,  3888372653,   104193978,   430589726, 
-  1624692279,  3141583490,  2197093217,  3034471430,  1072596326,  2514208424, 
-  3250958919,  1919893178,  1864012433,  3573601847,  2738399122,   246326668, 
-  2165744782,  4129645042,  1719314779,  1209022018,  2804053529,  2557562793, 
-  2598978650,  3321801688,  2534088494,  3367173547,  1354460359,  3498863330, 
-   391800366,  2880550362,   406205841,  2019869398,  3658534383,  3712623884, 
-  3496110180,  1430182567,   737137963,  3092391954,  4134785136,  3452186213, 
-   775282021,  1626769905,  1831777187,  1532691621,  3593065272,  3580885846, 
-  2986348004,  2553718695,  3219688798,   481020763,   660801604,  3485144669, 
-  2648499389,  1588272346,  2980412780,  1951288798,  3245794588,   117903522, 
-  1345871275,  3680007277,   867944021,  2842819113,  1170635810,   682257529, 
-  1459569087,  2255200194,  2837720753,  2663411929,   195724297,  2552204766, 
-   194539582,  2119029717,  1065456075,  1023266418,  1093224410,  1990118885, 
-   813922283,  1853608302,   462509012,  2941732976,  1148166644,  2889879998, 
-  2723778619,  2377560179,  3521996439,  2990443104,  4200620777,   442619777, 
-  3965237725,   201383659,  3851835048,    43908185,  2739024784,  4277808250, 
-   785766344,  3001009532,  2390970464,   660797470,  3325935362,   416644132, 
-  1805443387,  1100423789,  1031140412,  2302615280,  2951127326,  4163073762, 
-  1029575475,  1664990027,  1461200790,  2164719340,  2605697356,  2988261927, 
-  2338074803,  2504061826,  2950962372,  3838612126,    26686599,  2223210760, 
-  2390346364,  1245768019,   912056619,  4179687433,  4157038417,  4143057401, 
-  1519926170,  2656501636,  3136540082,  3351593505,  1815510867,  3151597520, 
-   560800082,  2774877822,  4061139061,  1202165740,  2449321933,  3639674955, 
-   305998075,  4249777410,  2648530812,  3215347344,  2813778204,  2576870163, 
-  1212062075,  2425828715,  3006689053,  4019030959,  4074781015,  1148173872, 
-  2456228901,   649490730,  3805183643,  4284344962,  3664469592,  3781755455, 
-  2806349151,  2230218806,  1085114944,  1144926343,  1272742413,  1569102399, 
-  2576571800,  4011133730,  4293379242,  1236548171,  1203192793,   551377264, 
-   663720548,  1226326197,  1057540863,  3845398864,   380488339,  3861896260, 
-   567752843,  4197111085,  1844938127,  1438280924,  2525477812,  1627278459, 
-  3636609121,  2368443154,  3064732627,  2182906457,  1918270053,  1806205500, 
-  3132333826,  2695453572,  3130869452,   340672726,   663883595,  1521755238, 
-  1190550793,  4030560248,  2861181097,  3282196306,  1788459431,  2808499035, 
-  3278091487,  1848744107,  3138220798,  1544714886,  1190978081,  2331229965, 
-   157913651,  3240615098,  4179308888,  4160690445,  1157609413,  4080661293, 
-  1061281753,  1436330025,  1605606694,  2997533904,    60187700,  3437360600, 
-  2499396323,  1266146897,  2889456229,  3123404649,  2488687116,  3010476005, 
-  3444368640,  3467604074,   384175457,   949594241,  3146329179,  1050435120, 
-  4055252899,  3255758837,  3273127859,   399530484,  4177257178,  4030030465, 
-  3351432299,  3455985892,   264053456,  3607248627,  1517200217,    54143406, 
-  3308581440,   272552147,  3579883610,  1097085205,  4070327331,  3467928350, 
-  1806584468,   607855153,  2867586474,  3331061059,  3932879131,  3141158422, 
-  1734379244,   144584725,  1552648432,  1483303716,  1477465230,  2347993589, 
-   934555704,  2227576295,  1302080544,  1970135724,  2594716992,  4268806881, 
-  1874689260,  1882591721,  3122126059,  2954185864,  4198044593,  2858043042, 
-  3420402995,  1206626637,  4093720414,  1566282829,   351550398,   103574671, 
-  4029403642,    10034884,  3814742527,  2369212405,  2016587647,  4250801863, 
-  2448937956,  2214435256,   627993480,  2698841053,   830460446,   695210943, 
-  2374994281,   423751071,  1744086363,  3938004718,  3278407003,  4114572694, 
-  3284042907,   873482141,  3485306313,  2121023967,   928433007,  2781839834, 
-   587773655,  3621610137,  4179551789,  2368467886,  3672634784,   832703644, 
-  1394768711,  3464402751,  2678228112,  3691938470,  1943894795,  1888718163, 
-   455615285,  3650329168,  1447921208,  4133461427,  2463547953,  2506917177, 
-  3831954249,  3578018595,  2103964053,   836354986,  4221599345,  1859082581, 
-  2853755116,     7442296,  1141729391,  3905355822,  3582310205,   940310566, 
-  1902793084,  1811831752,   770882200,   733649472,   590153048,  2273794870, 
-  3441062698,  2106150704,   142956248,   687732016,   397216443,  1644159995, 
-   925765679,  4244930429,  3148811015,   725218501,  2155387076,  2061545097, 
-  2592292471,   784791060,  4225461652,  2430669441,  1047858704,  1279225990, 
-  2175258431,  3332401670,  1564303050,  1036620822,  1229224406,   401981811, 
-  3564655564,  3960732383,   300226480,  3066290209,  3555723143,  4198232664, 
-  4001749546,  1394783166,   732717170,   311371706,  4142499310,  2252371952, 
-  2813690963,   133708880,   663861476,  3358453748,   399670203,  1340232962, 
-  3000064350,  3580323033,  2412561427,  2302987992,  1278192156,  3437805628, 
-  3241151086,  3864113173,  3313160988,  2757384809,  1167586589,  3280230940, 
-  4133579400,  1887065086,   626193420,   133141392,   976277111,  3854716774, 
-  4089228694,  4195051535,  3798434904,  1563310051,  1881155284,  3392646027, 
-   310671085,   425096531,  3885123529,  1229925769,   543771710,  2424698726, 
-  3622495822,   963444100,   503620777,   424606095,  1364647280,  1017103745, 
-  2637374212,    42944779,  1530318635,  2972686918,  2566542652,  3765896873, 
-   317853171,  2683011942,  1375654578,  1891876768,  2164415717,  2263004518, 
-   403523518,  3247617983,  1395206547,  1339903866,  1799688182,  3820618224, 
-   816539193,  3282184867,  1417743569,  3801455634,  1473640169,   621877728, 
-   392499376,   783939767,  2110913247,  4174420607,  2685155018,  2343249356, 
-   165232083,   487490102,  1368596861,  3197082963,  1444685609,  1431334553, 
-  1017485690,  3916152561,   574847767,  4275278235,  1691847450,  2790656468, 
-  3393365698,  4207954011,  1606232462,  1375382828,  3642628535,  2547348825, 
-  1504183365,  3211366049,   854938135,  3514287130,    77428916,  3411863142, 
-  2212735888,  3227870156,  2612271720,    61035589,  1080441561,   911731343, 
-  3836066577,  4294858074,  3356070725,  3693713900,  2012129485,   958829040, 
-    46850911,    73882199,  4118057530,  2262900573,  3246764565,  1284367250, 
-  3649307259,   755910393,  1967587953,  2876020673,  1077842806,  1528212967, 
-  3407435521,  1454298361,   966580029,  1469471875,  3848672391,  2705679842, 
-  3491296255,   866319524,   935142207,  1714425268,   734936156,  2447763891, 
-  3581392859,  3308577749,  1697268596,     1639087,  1979434668,  2255312160, 
-  3672809220,  1063048746,   238894597,  1975243690,  3680706510,   725018910, 
-  2576613108,  3943861744,  1679876745,  2135723606,   557263601,  4215792001, 
-  3313450927,  2145499664,  4255884965,   664504037,  3759697680,  2426898407, 
-   217847067,  4109082343,  1220415205,     7956723,   526620318,  1031164141, 
-  1615304215,  2399608173,  1420594677,  2117590386,   134091251,  3050265199, 
-  3266390120,   407304877,  3723245586,  2820301320,   972669505,  3335837131, 
-    47779199,  1827045126,   666442727,   171020159,  3465215211,  4199162086, 
-  2937142418,  2254955406,  1151786394,  4102540528,  1700759811,  1943053140, 
-   511909914,  3114092983,  1043448789,  4273394590,   216187463,   255644497, 
-   634975433,  3879061925,  4205035219,   408372840,  2720418974,  1027930214, 
-  2360364711,  2986576867,  2600454987,  2304130776,  3887638418,   334022651, 
-  3139014709,  2564854291,  1391136945,  3405035511,  3386928109,  3383928055, 
-  1462301666,  4138952036,  3198750967,  4109137425,  3759337494,  3867870360, 
-  3172187716,  1889519277,   712896719,   527235853,  1060776700,  1468758996, 
-   658593572,  3983532948,  1561991830,  3438876810,   462145508,  1767522955, 
-  1703569491,  2152898411,    83065587,  4136771184,     9682471,  3105737726, 
-   180296697,  2492989113,  3311323784,   460962921,  2087860448,  2227888310, 
-  2726976399,  2555665119,  1654421342,  3075757778,  3501052230,   130156079, 
-  1552647926,  4054693248,   909002860,   972934925,  3784342906,  2822748358, 
-  1480185312,  3197481965,  2759936375,  2695329503,  2572482252,   879622404, 
-   263989595,  3257353123,  3540045738,  1575925900,  1358523682,  1857244774, 
-  1501708656,  3848105603,  4127759126,  3283789851,  1034504495,  3956258512, 
-  1602618558,  1625462884,  4000965668,  2293284611,  2443153275,  3520568997, 
-  2401560229,  3593526047,  3612004120,  4124015046,  3031656102,  2520117093, 
-  2885459852,  3591433229,  3157919186,  3394304536,  1675528354,  1285690369, 
-   957061703,   791525457,   425431062,  3552508014,  2168770898,  2577351643, 
-  4193579889,  2993089329,  2784924266,  1857494390,  4041742672,   471787987, 
-  2166421454,  2229188002,   647368441,  2862884835,  2771222030,  3632142312, 
-  2992851242,  3840461682,  3456402132,   316698594,  2202646609,   180669275, 
-  1845876445,  3727275716,   978834946,  2707647927,  2541451538,  1524646501, 
-  2781313495,  3760213283,  2145730883,  3545584342,  1733481589,  3492420958, 
-  1447041085,  4139413245,  1441782833,  1438668657,  3364805445,  2687827857, 
-  3776616445,  2647468373,  2054072992,  2574096111,   707138868,   389276747, 
-  2044231856,  4183440860,   280227350,  3526259690,  1366575440,  3393389261, 
-   113222309,  3300325992,   452155630,  1657849595,   689455903,   640686909, 
-  1082353307,  2786783025,  3448059472,  1113916370,   417235957,  2335056995, 
-   397877152,  1054750399,  2854279874,  2863411095,  4134071851,  3303902266, 
-  3103242480,   129087174,  1691549976,   921303566,   812537880,  2031819537, 
-   914542466,  3750931417,   140766023,  4167461885,  3702623826,    37799212, 
-  1022922499,  4254667169,  3055888820,  2486563342,   446932612,  3061260201, 
-   631040451,  3942465080,  2339924743,  3983935343,  3347745458,  1000899355, 
-   541810788,  1736853402,  3157073555,   898167563,  2586355964,  1693804799, 
-   517422833,  2389675612,  3078519450,  3452490875,  2437020102,  2475276844, 
-  2872081572,  2405805743,   583865341,   259405867,  2603151127,   859904264, 
-  1286567138,  2789388184,  1725822974,  4171781793,  2010184724,   257214130, 
-   387118989,  1882523754,  3205527014,  3619829235,  1155518160,   461720052, 
-   940251236,  1515561087,  3246770983,  2539490392,   797901990,   861567958, 
-  3238394891,  2543164728,  2115321619,  2310591508,  3898606463,  2679122180, 
-  2632668058,  1166388220,  3312308198,  1580666781,   850364070,  2326451615, 
-  3970334353,  2730647589,  2313287445,  2604311514,  1496778671,  2504509987, 
-  1263942246,  1470069678,  1777560160,  3019090968,  1850335339,  2453206051, 
-  1458869308,  2560900457,  3351087457,  2821987891,  2361157354,  3051193907, 
-   692033171,  4152432213,  3948057894,  1254760360,  3060636984,  2042859732, 
-  3039022090,  3516958455,  1990393192,  2497026102,  2191641045,   691469449, 
-  3125579682,   626244164,  2246000539,  1820078006,  4089488349,  1433684051, 
-  1063641111,  2563014587,   327380352,  4133078312,  3253962195,  1955044791, 
-  1104611732,  1210940004,  1103142828,  3819068160,   233820374,   832301335, 
-  1628844373,   896712195,  2367112248,  2222350999,  1392012153,  2458139335, 
-   143576366,  1652835725,  3550790435,  3990147085,  1570221352,  2318603672, 
-  3616022718,  2586457924,  1424971197,  3807753648,   485274834,  1684296777, 
-  3709266605,   481457077,  1859298345,  1870125595,  3443195803,  1821314194, 
-  2599749626,  1521488706,   532980394,  1515630543,  2251282955,  2653017028, 
-   726004788,  1638824031,    44681377,  1967402633,  3437962468,   235154296, 
-  1453784824,  2624092831,  4119195676,  2351179702,  2469290251,  3373701629, 
-   679840065,  3351686991,  1728301356,  2329266280,  1103190207,  3143031408, 
-  2452878923,  1780136501,  2721692042,  1931477024,  3247350352,   697647556, 
-  1335829358,  1613894278,  1584430523,  3103478589,  2023973395,   439416430, 
-  2761008767,   194942734,  3141828413,  3866604032,  3239680361,  2038780812, 
-  3219516759,  1504053559,  2165674721,  3845714213,  4234654707,     7817849, 
-  1977669046,  1696743793,  2780767507,  1868534719,  3156821672,  3673620145, 
-   126418590,   356066633,   338016572,  2123882403,   198319345,  4041439150, 
-  1312250086,  1169651897,  1140528677,   117653527,  3103174182,  1196539115, 
-  1100339945,  2379275863,   102028357,  4084184850,   844863519,  1560573487, 
-  2288423226,    21612921,  3517225840,  3744823781,   796565070,  4105038800, 
-  2903924046,  1953976942,  2396995900,  2268250101,  3764385024,   672772433, 
-  1140658751,  1960088733,   832399662,  1800810211,  2414153005,  2586744526, 
-  4273739308,  3900463576,   603042987,   916075709,  1469823075,  1835810148, 
-  2083209429,  2387470270,  1021220254,  3056313707,  1315543034,  1857426461, 
-   626240634,  2862672630,  3078102966,  2403846234,  1786081249,  1145088313, 
-   427426498,  3154781234,  2305503089,  4119640703,  3754888235,   520251375, 
-  3986946183,  1862597787,  1615808378,  1435447276,  2241860909,   753258166, 
-  3284931223,   730669955,  2289133483,  2001950244,  2040863924,  2870931600, 
-  3643355188,   464054260,   830951337,  1970170753,  4010187001,  2978622332, 
-   116940172,   512390886,  4248578145,   340265102,  1494056745,  2859602919, 
-  3332569063,   485200535,   717179171,  1353928117,  3946290135,   386021347, 
-    40572058,  2019286964,  3993810439,  3629479519,  2925345162,  2093512815, 
-   823976493,   308229575,   215950663,  3452802903,    14222634,   959270640, 
-  3358689789,  2793111925,  2855324891,   217046036,  2156264215,   100909363, 
-  1484969156,  2835374654,  3241110774,  2076099730,   609954663,  3275596742, 
-    20980073,   213895919,  2157864859,  1283264892,  2425081140,   651840023, 
-  2913791445,  2681281941,  1139827273,   409802535,   378568123,  2809755750, 
-  2319920682,  3619417700,  2284953804,   246122448,  3089057197,  1252664824, 
-  4258120651,   593457981,  3626568702,  3759273999,  3074237520,  2681261396, 
-  3281384457,  2145217565,   335874668,  1387401888,  2224762168,  2893724064, 
-  3381399169,  1316453399,   675242336,  3271942151,  2403638901,  3725240437, 
-  3344756055,  3040573989,   492809226,  3536379364,  1543566103,  2876698622, 
-  1264657349,  1850940530,  1012305753,  4283916324,  4200564615,  3163810490, 
-  1602648756,  2652959761,   925928538,  1247699108,  2988193869,  2290493570, 
-   977629837,  1581463867,  3329769727,  3289573708,  3451191232,  3535484469, 
-  3398758901,  2368003710,  3449275769,  1599113851,   741832592,  2370037868, 
-   973639300,   236757899,  2148033305,  3423892233,  1929771773,  2669787837, 
-  2606323677,  3643238326,  4152699413,  1676020073,  2395113257,  4142517173, 
-   627984697,  1727991657,  2170028071,  2298847759,  1306315932,  3390279885, 
-  1788622567,  1343841354,  2416990800,  4080671444,  1762643996,  2645648441, 
-  1277235263,  2810180594,  3251750604,  4003684882,  2600822433,  2611302129, 
-  3579636785,  3074952419,    76953781,  2877012956,  2047627744,   874282477, 
-   176504799,  1696120068,  1913734599,   584213464,     4300179,  1722857549, 
-  2288599452,   735142398,  2822605191,  1476281720,  3544118351,  4218551024, 
-    84517151,   906498984,  1329021922,   766276083,  3942691538,  3108788483, 
-   879280961,  2418883943,   914694947,  2269232480,  3672527032,  2772711548, 
-    49368786,  2359417940,  1206360428,  2132962000,   624594571,  2830769174, 
-  2739474765,   294776444,  3588990197,  2040144341,  1932044650,  3551505135, 
-  2621430607,     3245788,  4104139032,  3684193793,  1827766387,  2915196354, 
-  4055860156,  2605626311,  1735103250,  2465245565,   646303467,  3869844262, 
-   712044221,  3775311218,  3980577629,  2069327543,  3398087785,   856926052, 
-  2612795932,  2475442306,  1088924369,  1950843803,  2624151566,  4285204083, 
-  3774341249,  3206710703,  1724176558,  1773620891,  2660020845,  1700045356, 
-  1733512469,  2173306475,  1619062721,   312790104,  2466461936,  1908512107, 
-  4127862180,   669912277,  4174420453,  2895376887,  1371163486,   586014306, 
-  3888930367,  1211896413,  1522477899,  4008913246,  2180509512,  3688683307, 
-  3336523647,  3394146910,  2408660657,   226933434,  2879060791,  1122129894, 
-   634375542,   322547344,  2396966104,  3849125244,   174103107,  3686405989, 
-  1023533506,  2794794985,  3800756338,  2663292061,  1317072930,  1928113305, 
-  1881653239,  1479687217,  1142681495,  1592567294,  1070315870,   991532504, 
-   196726016,  1963425163,  1561369817,  2540135418,  1762898769,   519859683, 
-   819603448,   403335199,   604175073,  1814810635,   685579656,   905466355, 
-  3354672364,   606150182,   687665113,  1120041140,  1227615629,   641066098, 
-  1132732548,  3641245586,   479655590,   488448286,  2775410072,  2639597676, 
-  3293397734,  3852741835,  3280898618,  1916076420,  2495031703,  4016618735, 
-  2249929038,   404729158,  1573978806,   269394850,  2843345148,  2079884246, 
-   639273429,  3200009808,   163242692,  2962851039,  4102859732,   137720668, 
-  4220822992,  2571281666,   615285499,   689476507,  1228137211,  3484207157, 
-   327397702,  2589411965,  2149792278,  2524183827,  2066787545,  3203017872, 
-   435902570,  3716315274,   227203018,   894655827,   473640732,  1971042904, 
-  3927835844,  3647353155,   539181108,   618932075,  1397720191,   432631341, 
-    41325100,  2268048102,  2392926712,  1102824043,   886486367,  1276579371, 
-  3566825124,  1048632522,  3038499757,  2231983965,  1187769404,  2234810449, 
-  2229627289,   491492904,  3032861785,  1488261718,  3895840951,  1706216479, 
-   584815002,  3958526457,  1844013415,  1062017305,   471439646,  1207638707, 
-  1334428427,  3138905224,  2188569971,  2756372444,  1621698126,  1776535502, 
-  1389358468,  2149462010,  2336365564,    88370713,  2735968967,  3843322529, 
-  1904601350,  1387891278,  1530300994,  4292328929,  2516107613,     5166700, 
-   451211000,  2815237931,  2106259866,  1910172518,  3240413856,  3630448967, 
-  3787149264,  2034723734,   501141782,   454346399,  3576222513,  1426237959, 
-  1959154691,  2573728388,    82972904,  2706109150,   932280687,  1012939132, 
-   635408226,   211715956,  1380283247,  2476028698,  1430101210,   620966036, 
-  3015435570,    35840664,  1436070057,   968313758,   123697609,  3258203656, 
-   877692777,  2136725624,    69511596,  1378106532,  1654977697,  4134808480, 
-    90348520,  1486469553,  3773541942,  1626402088,  1628873156,  1186730401, 
-   159659690,  1846216778,   995644325,  3067711513,  2025006494,  2898160853, 
-  2597211441,  1041335364,   931229542,  3737347078,  1482318587,    64023174, 
-  4267628624,  3671753474,  1209254215,   467101657,   345291559,  2347762125, 
-  1069489643,  2838559998,  1255044602,    53672625,  1335842403,  2864217853, 
-  2249870121,  3192756346,  2458423606,  1816217859,  2874119618,  3514483016, 
-  1481742271,  3625002501,  4136292831,   698192424,  1430316159,  1409541753, 
-  3055147613,  1525514302,  3388952720,  2577963447,  2362843660,  2089196901, 
-  1981124833,   941108613,  2823823004,  1117214568,  1898426561,  4211934657, 
-   545456398,   556141690,  4287303707,  4057588786,  1095419920,   374708168, 
-  2973967010,  3054624577,  1176386472,   493548528,  3632802404,   355720548, 
-   230111532,  1271175843,  3588395409,  2897017329,  2637748713,  4081562811, 
-    58811575,  1777837475,  2373010508,  4127715193,  1491710910,    10867075, 
-  4015913624,  3610489023,   939976709,  3719881127,  1627681029,  2711486511, 
-  2974782878,  2369096469,   681412800,  1154043145,  3340112267,  2227785652, 
-  3071716729,  4286519908,  2570648781,  3850185760,   951019084,  3891472356, 
-  1347407110,   131317171,   784788683,  3523110012,  3232173272,  3835949380, 
-  3070684863,  2331054173,  3249469930,   463302616,  1355387480,   541237221, 
-  2908053511,  3741447109,  3269690380,   489054072,   728343149,   799538494, 
-   663785398,  3772364275,   800994282,  4095849393,  4178290474,  1659943289, 
-  2880415465,  3768054988,  3619470295,  2532003096,  2302956581,  1465986007, 
-  3817591510,   574074886,  3209810270,  2074418517,  2698404091,  2965518771, 
-  1598356537,  3114719613,  2682408871,  3872299008,  3588628017,  2691646359, 
-  2603734140,  2742849194,   685026587,   788875517,  1127381583,  1924089022, 
-  1601787253,  3323064040,   590075257,  2657752589,   844982400,  3358622289, 
-  1174596310,  2638448726,  2897640884,    63681190,  3708770502,  4025223385, 
-   505512332,  2986825399,   621079090,  2185128981,  1927423060,  4064529161, 
-  3546891799,  1964082072,  3602982421,  3629269794,   467746327,  1732664120, 
-   743631412,  2702572524,  3442930257,  3811373050,  2877379493,  2219931853, 
-  3524067828,   439842362,  2583663166,  2813794937,  4116620856,  2272252658, 
-  2213494467,  1818277339,  2287189655,  4006762399,  1415796564,  4200403495, 
-   467835752,   233601637,  1002732150,  3018158686,  2271203625,  1855112548, 
-  3478638528,  3589434850,   176508396,  1028578671,  2419712337,  1774120532, 
-  3135916958,  1854584072,   779171636,  3137520694,  2691904177,  1483304699, 
-  2359945449,  2280005866,  3506406958,  2346263716,  2325000737,   538899380, 
-  1982430821,  2105754651,  3178503723,  3309328162,  1098783519,  2840766482, 
-  2190017540,  1573363677,  1930569150,    54465437,  4017098756,   229375975, 
-   135579857,   679624469,   182411196,   896060689,   449022716,  1230081497, 
-  4111788603,   768404696,  2147803981,  2109183347,  2226431062,    24489412, 
-  1589841842,  1241548534,  2016223461,  3631778326,  1906911631,  1402579416, 
-  3418184154,  2955263952,  3695973753,  1141198771,  2867253266,  1247587857, 
-  1748542006,  1161043442,  3642254249,  1838932045,  1648148699,   892967710, 
-  2532275287,  3520803170,  1714022270,  4109642903,   134167758,  3373071719, 
-  2153963981,  1528617084,  3855163419,  3099760787,  2442902232,   796455980, 
-  1001021345,  2685698914,  1313173499,  1440960381,  2807229807,  2791289757, 
-  1341365923,  3054388505,  3531914039,  4163292976,  4199182002,  1756998342, 
-  1913236535,  1653814254,  1434521038,  1815129806,  3011731685,  3154032624, 
-  3794347376,  1300739229,   911477665,  3155562717,  4117617068,   715623012, 
-   601031764,   105802738,  3050411022,  4024668925,  1419821686,  2475104473, 
-  2570345643,  3547128098,  4221545311,  1502705717,  2445785937,   933497926, 
-  3157998290,  3112076023,   495936925,  1769984088,  2712034937,  2636019998, 
-  4073255715,  1809334860,   120117260,   507216885,   194741107,  3908704150, 
-  2217678037,   951019899,  1887756625,   703341206,   728401754,  2184022953, 
-   130433854,  2275066115,  2079593684,  3634354807,  4157349762,  2349392933, 
-  1712956330,  3713673372,  2348874481,   386281045,  3948785018,  2449894159, 
-  3274446208,  3387270816,  2923287260,  1387429601,  2272198225,  3503978946, 
-  1065424548,  3319617967,  2328830599,  3163276941,  3773324031,    29321149, 
-  3130402875,  4189582082,  3574858813,  2829286137,  3213462104,  2319614029, 
-    28879488,  1823198431,  2336657011,  1431250480,  1181142413,  4029113336, 
-  2820444255,  2235906512,  4055227951,  3614756903,  2679733812,  1422163861, 
-  3634012233,  1930574063,  3453687017,  2373619767,  3861622627,   918899546, 
-  2386716808,  1608967550,  3811029449,  1614842453,  3437055440,   816308423, 
-  3324535852,  3395675926,  3738827448,   903514409,  4267976658,   859873213, 
-  1369876458,  3133255560,  4268970486,   947392094,  4218189479,  3968358820, 
-  3525320434,  2082582160,  1532863412,  1228161948,  1130483553,  1389901380, 
-  4173973210,  1595931112,  1667884517,   644275199,   736252390,  4148655662, 
-  1870930208,  3595382574,  1650688663,   432672696,  4050188119,   969094305, 
-  2394306305,  3657871437,  2214183324,  4038480847,  3525253706,  2637767857, 
-  1120237087,  1208850604,  2638356534,  2970041781,  2051177067,  1828219254, 
-   513640352,  1597801268,  3872343043,  1955055821,  2937407525,  1352953426, 
-  4090962461,  3662026595,  2328539603,  3916118684,  2385089508,  1738904063, 
-  2757714890,    49085619,  3596089321,  2109387695,  4135457394,   929352907, 
-  1272614665,  1230404847,  3609142432,  2296307496,  2047816031,  3655314916, 
-  2937858322,  1270886707,  1030977210,  2617264079,  2368105533,  2868619140, 
-  1622643853,   633993008,  1751301246,  2038545509,  3196707903,  3896022865, 
-  3757345938,  4174434955,  3836157037,   858185563,  3379160320,  3193275724, 
-  1842232008,   385760467,   594775006,  1303058980,  3205154109,  1414260765, 
-  2558268663,  3349412907,  2616262629,  3757989007,  2953403374,   311012265, 
-   459275592,  1285262636,  3736352834,   892038880,  3156679673,  2690103345, 
-   846948786,  3649578135,   406027104,   547231770,   393386909,   892206745, 
-   808326428,  3923929242,  1617657628,  3389623123,  2218565781,   721520111, 
-  1189523988,  2521610785,  3640539070,   149280979,   826485375,  4061636026, 
-  3846760995,  1129580337,  3416018013,  1146491932,  1818086291,  1511583015, 
-  2770291678,  1764353267,  1707861784,  1504753529,  1911484250,  3474822918, 
-  2585888767,   809324312,   193412804,  2980471525,  1750441437,  4159294812, 
-   414895546,  3752594901,  3789933176,   596957679,   610180122,  3478315637, 
-  3871267952,  4242887742,  3236444540,  1536666355,  3523601749,  1635036587, 
-  4042573091,  4142921104,  1477398935,   107352288,  1659872138,   883835875, 
-   639472420,   997246351,  1409349357,  2104356472,  1611685666,  2412194553, 
-  1442892786,  3345540043,  3000910356,  1115804150,  2887131928,  3262147167, 
-  3382826149,  3931202851,  1514821785,   114508268,  3395963103,  1429540707, 
-  2255631667,  3886972947,  3686442970,  2289787580,  1266816337,   613509574, 
-  2471227565,  1828743349,  1763914395,   612688691,    94214661,  1153955368, 
-   330448869,  2559540994,  2731332843,  1440498488,  4171679755,  4011854209, 
-  2670649126,  3384760997,  3032596287,  3431200121,   756373893,  1187154302, 
-  1103991674,  3810264747,  2317735311,  1201576456,  3907945796,  3878150044, 
-  3311016889,  1002261392,   789159190,  2880735409,  1593575575,  2999919892, 
-  3585100871,  3920917021,  3205302416,  3264505234,   492137408,  3246011204, 
-  1834002276,  1987385083,   855365138,  3758732392,   260735369,  2545374350, 
-  4049617724,   610657088,  1696925814,  2280424602,  2758017833,   770118073, 
-  3558544126,  2875435121,  4111044776,  2691714471,  3448401897,  2942377456, 
-  2571327202,  2397303925,  3302289558,  1543653594,  1756141018,  2547954339, 
-  2219330952,   369301476,   686189188,  1418403377,  3583831641,   874574089, 
-  1362583331,   379511824,  1159975086,  3708291290,  2326860826,  2156018824, 
-  2205465287,  1613550588,  3786231383,   317291434,  3241472320,  2068514097, 
-  2083645388,  2048552388,  2624250311,  3533931357,    10284472,   948607572, 
-  3119551251,  1056123407,   179924722,  2923609565,  2435473458,   848068002, 
-  4250351621,  3393317801,  2779591151,  3992637146,  3139951630,  2312734163, 
-  2799820182,  1192227067,  3770193335,  3955557501,  4191525945,  3059784903, 
-  4144088999,   806067635,  1781855316,  4035534401,   949981848,  1276438213, 
-  2317703084,  2543786053,  2397688085,  2790182563,  2265370403,  3875964018, 
-   254942767,  2174921975,  4119791100,  4257102140,  2679833682,  2249250516, 
-   940913674,  1525538350,   283057976,  1007757166,  3200300276,  3204397892, 
-  1990676840,   657582939,   273446523,  2292942275,   801226845,  2008151945, 
-   122494711,  1558419187,   300268877,   816484083,   742668350,  2672761383, 
-  3801642039,  2782802635,  3034666495,  1119625997,   847471846,  3532296312, 
-  4094325409,  2610834585,   976078503,  3300270874,   370116220,  2835887224, 
-  2496521195,  2015156087,  1870679973,  1548486949,  1844051861,  1135861416, 
-  1360425591,  4290138389,  1253911917,  1026729401,  2812286247,  3672967631, 
-  2937771265,  4075059984,  2382727537,  2576137775,  1388388315,   195792410, 
-  2006604243,   784889079,  3995948708,  2853556591,  1998961140,   380454925, 
-  2942287240,  1171067186,   940210597,  3951537547,  3664883154,  2607298913, 
-  2131491015,  3367032542,  1291187851,  2694884038,  3153124494,   485462689, 
-  2532011893,  2222772195,   938235925,   450748198,   827220472,  1005653212, 
-  3471077996,  2715457308,  2013637700,  3510266219,  3697259716,  2838466380, 
-  2805571935,  4175459439,  2443278225,  1156438452,  1048028710,  1445285058, 
-   165915417,  1003798662,  4158693849,  2173666000,  4222719233,  3651847485, 
-   751125379,  2680584841,  3391563831,  2638947198,  2319638388,  3148767014, 
-   778216919,  2870325922,  2445230704,   318758092,  1973902159,  3153660268, 
-  3835787726,  3484893522,   955610338,   652948912,  2334155276,  1243570278, 
-   754832419,  2761633568,  3040979581,  1193506471,  3236248003,  2036712312, 
-   454502744,  3365924731,     6939474,  4010804715,  4262813206,  1088892133, 
-  4185903687,  2724780562,  1247454016,   648756000,  2900994769,  1719769273, 
-  3165295308,   644859998,  2519707243,  2557328013,  3220073456,  4014827107, 
-  1616981521,  3304876967,  1442111018,  1045120447,  3704781147,  3893039422, 
-   469119303,  2303872799,    35239466,  3279729391,  3105508930,  2715329921, 
-   384105220,  2841661407,  1765145070,  1858635829,  2984762978,  1240788208, 
-    31604300,   371030384,  4231519855,   431726905,  1426829776,  1015781194, 
-  1395776263,  1882881394,  4133311916,  4069196424,   309396895,  2293726207, 
-   782427611,   577840131,  4119211509,   922228412,   261918180,  2167728907, 
-   130789978,  3004143052,  2032043327,  3938943514,  1562452879,  3975959333, 
-   807085963,   746421128,  1303963716,  1010335158,  1614685183,  2248668746, 
-  3424991115,   947169730,  3799729554,  3136791992,  2860584662,  1255243762, 
-  3843169584,   298301589,  1332650527,  2411531199,  3273548099,  2488781510, 
-  2368293953,  3211476517,   610285769,  3602821241,  1380513795,   597864088, 
-  1713534501,  1436634422,   811416322,  1897030865,  2999153494,  2746320011, 
-   854785003,  4292666985,  3547235759,   484562909,  2190363696,  3079231548, 
-  4140786771,  4227233141,  4285548592,  1523574539,  3177233406,  3569625082, 
-   959599231,  2449336213,   924529449,  4002933879,   209149229,  1937253251, 
-   764506813,  2917551605,   388673805,  3225659952,  3358087602,  3512906619, 
-   732990533,  3788535193,  4034544155,   276697794,   998295415,  2495732073, 
-   324057754,  2188681981,   122474557,  2194877762,  1818491033,  4188406440, 
-   349403136,  3172312881,  2964411152,  3812875869,  1912239061,  3047109684, 
-  4266507256,  2650583596,  4187647785,   908679242,  2601050638,  2886229592, 
-  2379050523,  1327255860,   746383056,  2090334192,  1877222373,   510897144, 
-  2539126624,  3868574945,  2830270587,  1949356041,  1040964745,   695192494, 
-  2882158414,  1627480004,   916151738,  3293889272,   517987741,   977890006, 
-  2581378138,  3324860267,   928929128,  3332575712,  2942904591,  4226109726, 
-  1771537612,  2687441719,   388221332,   760663940,  1611388232,   709999522, 
-  2032201018,  1586274056,  1588256539,  1860616301,   765681796,  3206901949, 
-  2025647229,    51002363,  1822299878,  1760247183,  3504190582,  2625432905, 
-   163861727,   341279554,  3234601713,  3322452586,   236144155,  3899555534, 
-  3123325919,  4095048304,  2782827427,  3994220351,  3553239150,   735562868, 
-   155618598,   509682903,   133205552,  1171607591,   765120387,  3530681061, 
-  2725789044,  1581645381,  1888946320,  1272212209,  1718127657,  1554694050, 
-  4068162219,   764373912,  4184897174,  1245136675,  3711717950,   643437100, 
-   580044386,  3567359633,  3666043855,  3876055404,  1709082376,  1182094828, 
-  2552223768,  3013442338,  3525729666,  2482262564,   112977732,   275640732, 
-  2562696353,  1700051859,   904194816,  3008433441,  1013113747,  3251857507, 
-  1172617926,  3292471917,  4121242564,  1738674604,   420789208,  2784410123, 
-  3328961448,   453332527,  4263471437,  1373408775,   319413809,   173525687, 
-  1984247146,  2391434904,  3882742729,   890382528,  4289175251,  2086145800, 
-  2555949186,   265266661,  1128693061,  3247564800,  3048661130,   774258274, 
-  1086728065,  2165784919,  1298703142,  1862112053,  1969335284,  4130175491, 
-  3590581011,   476434529,  2061499763,  1046927315,  3265100786,  1698770489, 
-    74597688,  1853883231,  2346401317,  4210660351,  2723035864,   349556804, 
-  1217614815,   260423486,  3189364764,  1882504028,  3121271384,  1626561768, 
-   604881045,   804314112,  3215899715,  1377671090,  3432697240,  1931203560, 
-   457795429,    76354905,  1732602830,  1187000593,  3172712078,   350921899, 
-  4278800374,   382563727,  1129130242,  2375930423,   834616482,  3231782114, 
-  2796320391,  2978279577,  3940802834,  3914697768,  3228086363,  1090396138, 
-  1268509365,  3286362658,   493696514,  2980022057,  1294554028,   527639925, 
-  2527872991,  4013567314,  3703875547,   684232464,   529311846,  3402111594, 
-  3151414480,  1161242065,  4098708928,  4206710994,   989558577,  3562454348, 
-  2288949584,  1023198081,  1629088830,  2506702293,  4172186947,  1435254509, 
-   897556651,  2473154586,  2306981781,  3695645738,  2678001567,   412577674, 
-  4181576337,  3511682742,  1362212574,  4237447746,  3081327293,  1286411734, 
-   618971737,  3708268099,  1563068399,  2870489298,  4201390561,  1771392303, 
-   315457364,  2598045626,  1309096573,    40928339,  3295525631,  3566624858, 
-   405298860,   279271405,  2221084083,  4187932637,  2045001350,  1098110917, 
-  1956178463,  2079617579,  3973621414,  3908144879,   972675809,  3636982476, 
-  3136497469,   975512050,  4091858631,  1172419837,  3364972089,  2512946742, 
-  1709746410,   152700462,   846939666,   945269806,  1501363486,  2905803320, 
-  1449648523,  3231256692,   501956782,  2460118585,   121663960,   693278826, 
-  1078329412,  3670185205,   625222510,  1464537179,  1065231095,  1273156146, 
-  2387364133,   808881186,  1598656916,  4204662327,  3795460455,  4241776950, 
-  1226407916,  3773220624,  3429190692,  1357741312,  1674101967,  1998910332, 
-  3693134077,  1025387579,   594896665,  1282804338,  2676503197,  1963826328, 
-  1525466312,  3255335208,  4170721516,  3351779778,  2975173410,  3968640688, 
-   492165504,  3968560333,  3107350214,  1184933672,   412653904,  2484809516, 
-   748900578,  2488206440,  3135736718,   715232477,  3122858023,   641510346, 
-  3056540044,   496673947,  2426237977,  4095643599,  1988719254,   372557543, 
-  2838524683,  2223785569,  3864091735,  4060772405,   290379280,  1819832960, 
-  2003128781,   677811576,  4170280537,  1098596626,   940399379,  2210106966, 
-   158296878,   759814761,  1272712527,   103903840,  3197883532,  4175430770, 
-  3073615428,   618888206,  2185349890,  2246880191,  4224690250,   258646641, 
-   913824942,  2527623482,   690302379,  3090042848,   466339578,  2547405494, 
-  3775843970,  2334756824,  1359372632,   942835118,  3111406467,   667567313, 
-  3089049952,  4148372014,   530266905,  3180965375,  2367379359,  3404728989, 
-  2504564158,  3382601461,  2192029319,    44550288,  3914327639,  2066129196, 
-  3542127636,  1928216444,  1438578846,  3721478050,  3662242905,  2852784593, 
-  4099147563,   630857028,  1877917495,   742294759,  2599304984,  1389124579, 
-  3302846929,  2642351532,   270218700,  1741617489,  4193422031,  2631474300, 
-  3727683887,   496330003,  2041905624,  3246028708,  3898123776,  4113875728, 
-  3396885111,   617403593,  3512554795,  1698982045,  2943576092,  1293306096, 
-   144393349,  2971049734,   209559869,  1914679635,  3215619676,  3362025963, 
-  1723204602,  2046062775,   234400907,   877844517,  3372412107,  2200076759, 
-  4080215346,   579169081,  1509800763,   818593401,  2651699506,  2031570519, 
-  2127092797,  2831996408,   558976600,   199371616,  3698405498,  2486083593, 
-  1522319975,  1005083689,   623372341,  3048569472,  4287126224,  2272521309, 
-  1850918223,    25899989,  1523693755,   447046519,  1251173722,  3392825944, 
-  2253728426,  3739447667,  4193301141,  1358935359,   161135486,  2651968696, 
-  1689226161,  3908200329,   181574683,   671443142,   335480007,  1102567269, 
-   181416583,  3630457261,  2447635268,  2134113912,  1573560116,    60875663, 
-  1378446772,  3106723178,  2837185431,  1408896901,   923450820,  3216392658, 
-  1852984398,  1156646617,  2815017130,  2795646867,   930492191,  2160729830, 
-  1520904083,  2887881727,   222554660,  1244272915,  1314659058,  2706016112, 
-  4290058696,  2617963747,  1754547144,  1185763018,  4240614689,   532116840, 
-  2990764036,  1991185861,  1355687257,   451276968,  2719683664,  1482741400, 
-  4012056299,   905171227,  1987275298,  3635618106,  1888100751,   907140689, 
-  2569454449,   177462564,  2046936677,  1167795411,  2580492821,  4281743610, 
-   942153133,   640365513,  2325743831,   317453415,  3517205858,  2539714508, 
-  3316970802,   789331966,  1470209089,  3841720413,  2318241818,  3572261977, 
-  3734176622,  1113210689,  4004243497,  1248164591,  2237947978,  2731972534, 
-  4264279391,  3126321490,  2045732481,  3991499302,  2953989881,  3603479028, 
-  1083112727,  2601361330,  2110198718,   463373812,  3647307296,  3304293527, 
-   680659529,  3452100024,   848001061,  2219180143,  3072589614,  1326533254, 
-  2384394632,  3599771497,  2811903748,  3512191718,   218811840,  3853999639, 
-  2667040287,   716703436,  2946237209,  3387940923,  2886714633,  3540435815, 
-    66554827,    91261895,  1983933438,  1522111875,  3745593177,  2026296882, 
-  1967282656,  4139881748,  1078355030,   482617803,   890444756,     6092243, 
-  1693683076,  1745283653,   425887267,  2696758181,  4161589286,  1328971707, 
-  3130205797,  3859241295,   902151994,  3506436379,   577195358,  1561396424, 
-  2469096956,   554461524,  2651076513,  3791840013,  1953329924,  3870910033, 
-  1858959774,  3150524555,  4116034094,  3430719304,  3000546361,   454201082, 
-  2957671941,  3403800833,  3765078250,  2418877128,  3104566425,  2633420476, 
-  2480681345,  4266416260,  1893773979,   484636103,  4110943677,  4270289422, 
-  1535900456,  1001082810,  3767063388,  4054744534,  3739200465,    30305272, 
-  2858961945,    43747645,   122985095,  3863226408,  2378597959,  2566217200, 
-  1536330755,   634462806,  1867549641,  1384540743,  1374592628,  3324967464, 
-  2991366355,   446024983,  2228090524,  2267690039,   841752997,  2443305227, 
-  2459540657,  2462925286,  2479920041,  1061026378,   230490070,    13667986, 
-    97380481,   355767056,  2854329722,   788158946,  4056698926,   508779055, 
-  2384429871,  2286832826,  1408415411,   850060740,  3574250911,  3823302437, 
-  2909891134,  3818396222,   213027537,  2365907097,  4171843582,  2155541001, 
-  1067338742,  3772238783,   804604304,   262673514,   446540126,  2356442156, 
-  1095226829,  1032648514,   442622014,   468102741,  4279275723,  3111073874, 
-  1727230525,  1627848162,  1228934620,   291370773,   190383470,  3911052455, 
-  1623212757,  2020205239,  2492223755,  2704714741,     1722184,  2825248003, 
-  1836685811,  1836080885,  1165813356,  1569294093,   474364436,  2432313534, 
-  3029767689,  3461712072,  1122067598,  3693876616,   246860620,  2260701859, 
-  1274640197,   992488166,  1502231140,    38978163,  3366126424,  1482561341, 
-   875813873,  4044488029,  3879289949,  3776141481,   866957904,   256533443, 
-  2695915466,  3841863957,   183338480,  3916071277,  3041892356,  2859553609, 
-  3421857613,  2205682537,  3464601939,  2397962074,   683244778,   468052052, 
-   835695744,  2580299169,  3818333644,  2055686362,  1547370993,  2884015448, 
-  3868962570,  1164317727,  4153491458,  2361773103,  2001823001,    33423505, 
-  4066635278,    28912783,  2892038836,  1455513569,  3791688336,   756704620, 
-  1031651320,  4116232924,  1980953396,  2529136712,  2448663622,    82569938, 
-   881924414,  1332191083,  2019110568,  3038063267,   731964163,  3762480865, 
-  1292970307,  3281742721,  3435317904,  4128098281,   543947782,  4035476221, 
-  2791314810,  3461842532,  3858081987,   238211561,  2771382072,  2701920937, 
-   905972456,   375373820,  2313047343,   699100646,  1707759283,  2710985079, 
-  3529810409,   852267830,  2133044910,  1686395245,  2460420564,   131075037, 
-  3105414038,  1991669928,  2600532268,  1370151905,  3320304460,  3654553356, 
-  1256225862,  1405427042,   406099000,  3156804548,  2532628496,  1344080841, 
-  2825192958,  4240407350,  3331949389,  4086585420,  4041614456,   891191813, 
-  2878182008,  3477469522,   643409461,   212148743,  1225423738,  2097936523, 
-  1798047324,  2803317782,   926707108,  3755782339,  2130490395,  1677918267, 
-  3114934003,  4005340584,   919893958,  1440435595,  3786199691,  3303453248, 
-  1768595998,  3962117228,  3372435612,  2942319851,  3372005150,  2545522861, 
-  2962348757,  3471196965,   927068606,   484588383,  2403425656,   885345211, 
-  1602735309,  3309188133,  1280525748,  1267629759,   899532465,  3970410176, 
-  1569429490,  3262484539,  1095404478,  2637895341,  3616872574,   208964957, 
-  1736550171,   200775052,  1536238807,  3081257664,   751785672,  1993666648, 
-  3532788486,  2841265199,  4194929818,  4160685772,  2565158463,   409714989, 
-  3783326076,  3395480957,   781557581,  3870293581,  4121613952,  2739649324, 
-  1229342118,   448049798,  4249119043,  3317770121,    93669476,  3486844352, 
-   914436888,  1030688603,  2806211281,  2869950971,  1176874052,  2905116653, 
-  3682212035,  1020148297,   846910482,  2694756288,  1716771462,   307498169, 
-  3662126176,   598857483,  3072604552,  2372680915,  2056602026,  4189025064, 
-  3981842324,   298427878,   191704121,   104597052,  2485735278,  3591231443, 
-  3643497306,  2665482165,   616352397,  3160438880,   119584982,   460730321, 
-  3870470477,  1274064748,  1695248992,  3011495674,    32691333,  3140027046, 
-    44792279,  1607991529,  3173445646,  1418417292,   124898497,  2705938730, 
-   714083703,  3168712590,  2696119667,    93844724,  2928973429,  4064674958, 
-  1336995002,   123705384,   421424894,  4034092240,  2498524173,  1886579468, 
-  1763413221,   796163803,  3499211984,   210169431,  1557003143,  2256580111, 
-  1050354100,  3687589851,  3624124686,  1046007811,  1496928181,  1854033433, 
-  1183835024,  1068622730,  1228586877,  3065840926,  2481459589,  3071870562, 
-   100430437,  1100874125,   656053681,  2789508369,  2648110069,  1591088098, 
-  1658774467,  1926349930,  3913971412,  3127277058,    21941677,  2872258120, 
-   959029312,  1839814757,  3077188805,  1837571845,  1817827210,  3091325172, 
-   864311947,  3921609541,  3863787252,  3981295762,  1830397963,  3941042209, 
-  3791872502,  1408778886,  3893691598,  1665316922,  2357136514,  3374303610, 
-  3428954591,  3367953140,  3438313696,  1207903575,   648652836,  3098717213, 
-  1378129535,  4137027581,  1033153230,  1116693175,  1567608597,  1631337358, 
-  1415054408,  4228036483,  1549937051,   916037018,    71027236,  3464447246, 
-  1824080796,  2467166995,  3249284516,   301602808,   805772622,  4197447204, 
-  1532308861,  3245412224,  1683596600,  3879751750,  2026927294,   925357855, 
-  2566143055,   898497479,   884859881,  3998047916,  1469046214,  3264846822, 
-  2226759284,  2158656300,  1037174570,  2442090639,  3816430425,  4146834974, 
-  3945372192,  4014567670,   742623210,  2723277983,   227496782,  2247994739, 
-  1836707202,  1246033654,   772476265,  1196702658,  3272241634,   681533964, 
-  4050051351,  1460320677,  4026551334,  1033519604,  4241476471,  2491033904, 
-  2549506671,  4255541269,  4288564656,  1508934138,  4113281578,   268456344, 
-  2892742428,   922951293,  2506652714,  1635098815,  3843139443,   433011612, 
-  1393270178,   173310823,  3435447704,  4065281094,  1904541655,   825500122, 
-  2596138538,  3322556856,  2658329288,   550148989,   105891017,  2553400718, 
-  2052049381,   219307557,   574681167,  1142657405,  1638207822,  3463018845, 
-  1531047422,  2840520095,  3919846522,  3610726354,   181640906,  1008902233, 
-  3377698896,   574516795,  1725497291,  3609679320,  3864625883,  4093999691, 
-  1394327779,  2229242855,   908901953,  4292336064,  2988825657,  3743050458, 
-  3250041172,  2624283203,  2039160201,   331549798,  2037618557,  2737075593, 
-  3525254662,   504854541,  3565040807,   858215119,  1081615289,  1546051268, 
-   606943864,   318647735,  3471448089,  2984029710,  2786733498,  4056581330, 
-  3051849231,  2419214147,  1025327533,  2288136329,  3991620002,  1917349676, 
-   177267967,  1675676596,  3972368064,  2681395401,  2689327667,   288723180, 
-  2735848725,   800354012,  2513453613,  1051079258,  1250478001,   655411394, 
-   685489340,  4088130417,  1195300067,  1246698178,   533469140,   652235206, 
-   847428780,   160028467,   262908580,  3828491221,  3329081287,  2386708497, 
-  3632767209,  1120077706,  1924029461,  1393081844,  1297513110,  2416004201, 
-  1231787449,   291802518,  2763631021,  2323288560,  2644666436,  2757584929, 
-  3337422573,  1578387681,  2787869670,  2809659331,   268331414,  1311812896, 
-  2165232715,  2891543027,  2312503649,  3240006418,    37928690,  3683725572, 
-  1042798707,  4065741503,  3192132967,   139573098,  2684984724,  3430041405, 
-  1335200286,  3452688625,  3709981021,  4176785384,   753834503,  2974238254, 
-   659165431,  1316450387,  1425552726,  3768390906,    74630182,  3562833569, 
-  1734470752,   904047240,  3234728761,   184927806,  2545525647,  1792387477, 
-  2993893538,  3052116043,  1435026365,   528067212,  3591076282,  4033000444, 
-  2521571593,  2470908253,  2426099740,   981420424,   319869568,  3440841130, 
-  3071969275,  1166539936,  4014604157,  1097905603,   789505996,  1870904390, 
-  2530116545,  2098854402,  3027525549,  2658669611,  1570897524,  1694450200, 
-  3129220649,  3325653452,  2563379653,  1986978079,   665929546,  1435107356, 
-  3275382518,  1898439719,  4278097874,  3520602823,  1780072316,  3525886402, 
-  3685227986,  4127860577,  3641200325,   683106477,   164070365,   897116669, 
-  3511615770,  1537823889,  3492577742,  2245445923,  1440790846,  1216268733, 
-   886887259,  1048045981,  2460616534,   981192165,  3193289156,  2534380725, 
-   872174017,  2571927959,   221825485,  3141393697,  4279946874,  2121104747, 
-  2994702909,  4215428835,  1646231572,  2448121178,  2366224402,  1525411214, 
-  1448625709,  2977412651,   573154800,   168469422,  1109673149,  3068434969, 
-  2686100762,  1364613007,  1071816199,  3976463767,  2712528608,   305662154, 
-  2436312914,  1775810388,  1052086118,  1478994019,  2682485412,  2260448884, 
-  2257543319,  1396428891,  3109345607,  3617038329,  3075009355,  4271031852, 
-  2872100485,  1538659378,   798753182,   313424884,  1737983415,  4287462554, 
-  2253553557,   610759518,  1858998140,   377320014,  3648259981,  3323574287, 
-  1864183109,  2223572294,  4287550052,  3908087053,  1595765652,   751880775, 
-  2669423980,  1925375923,  3673954034,   387084641,  2431780959,  3369699907, 
-   634025997,  2512693555,   254067150,  1046957178,  1491666681,  2246261141, 
-  3995296181,   883199869,   526593447,  1759110035,  3024976155,   445070397, 
-  1053696077,   350536256,  1404472906,  1232470601,  1045507188,  4098373137, 
-  1828080895,  1305438071,  3384267675,  4014696626,  3593332552,  1875025880, 
-   458105187,  3940286596,   763596240,  4067711425,  3427358327,  3410103171, 
-  1319998521,  2294770360,  1082479184,  2416112718,   536650342,  3590076020, 
-  1626514517,   749829138,   314314059,     2638660,  2062369804,   525032321, 
-  2248068265,  3859988473,  3319319560,    21373640,  1377230103,   546713393, 
-   679604006,  2300551604,   164132728,   640322525,   192037025,  3487139015, 
-  2892876248,   589507348,  3061957029,  2546444737,   635529984,   521759264, 
-   338479149,   578317443,  3859622332,  3079789403,  1429406083,   349638765, 
-  3442322304,   136453563,  1937369284,  3503965258,  1485894445,  1846520117, 
-   342365066,  4018833750,  1586062281,  3366429959,  1832215117,  3232660235, 
-  1759117604,  3823663637,  3645754037,  2207909200,   525250586,  1909897057, 
-   934868154,  3928499703,   336476437,  3602977583,  3996989236,  1478942810, 
-  3684828970,  3126019740,  2416985277,  3845312273,  3905469413,  3250753044, 
-  2199383741,  1751624000,  1332248104,  3364132318,  3837215232,  4146531246, 
-  2542256338,  1606643799,  3861817581,   334828686,  3318568236,  2578078351, 
-   254418406,  3845095500,  2397673005,  3193623330,  2354899819,  2679914093, 
-  1617262796,   506623653,  3805753512,  3502932934,  4077018863,  3212817162, 
-  2546555493,  3749522472,   880208663,  1785602254,  1908242967,   606685001, 
-   151418363,   859297290,  1622541708,  2809966966,  3986597973,   762814617, 
-  3496417639,  3625422161,   530616650,  4155016768,  1565265377,  3422120060, 
-  1636818834,  3384514080,  1038675520,  2953454293,  4213582333,  2326185477, 
-  3911505685,  3943044110,   714840858,  1849890606,  1706337771,   297463021, 
-  1559260559,  3651658783,  4151383353,   442264703,  3116100636,  1918173388, 
-  2486121976,   815133595,  3290358563,  2526768663,  1557015087,  3051166946, 
-  1788857201,  4033891098,  1123267112,  2311597054,  3798129495,   943864259, 
-   460686955,  1905142258,  2605217407,  4185080100,  2087749853,  1131910750, 
-  3024158242,   994256087,  1191885631,  1416623210,  1348110988,  3763051281, 
-  1396098437,  2803158933,   664441627,  2599833082,   458640874,  1877540486, 
-  1034128670,  3780032785,   699368732,  3848826445,  1572253969,  2881719071, 
-  3533776447,  3585702224,  4221433243,  2719002187,  1628374838,   952647887, 
-  2109139953,  3151357376,  3413050726,  2710093335,  3920601022,   528691369, 
-  1497860230,    66276081,  3357353977,  3889679439,  1844943324,  1613716319, 
-  2242246203,  3868848890,   268441711,    77326719,   215101498,  2642202616, 
-  2274220227,  2072258020,     7910808,  3566649590,  2038737568,  2466771426, 
-   657385630,    46403091,   233945389,  2446717966,  1668875112,   413527740, 
-  1580099316,  4122809526,   970703094,  3132734791,  2278401103,  2588182476, 
-  2135886074,  1082512461,   112158291,   501414431,  1794097633,  2595908820, 
-  1977573681,   238342076,  2890140391,   920035042,  3090502958,  1654237195, 
-  2838713815,   958050176,  1193320032,  4222819350,  1695248601,  3974823710, 
-   554916732,  2610242327,  2443296561,   813454764,   705387031,  4136892888, 
-  4235492882,  1115722296,  2137787888,  3883177844,  2335355213,  1721810170, 
-   155989615,  1319582301,    23479189,  2659237295,   874830045,  2635749940, 
-   733170665,  3616697690,  4039396606,   272572345,  3211285396,   888067244, 
-  4000421002,   312357422,  2322054444,  4281486471,   654548398,  1787394466, 
-  2741343005,  1331620175,   353082499,  2015076148,  3036326247,  2106738573, 
-   696001174,  4262288630,   832215623,  1200728264,   574389006,    93254695, 
-  2553166506,  3855564180,  3065449024,  2566981806,  3283872679,  2823224976, 
-  3115474885,   690876085,  3021166191,  2964091544,  2011545908,  4139080081, 
-  3959749469,   564525517,  1339321835,  3741127873,  2052086309,   635131492, 
-  2616510868,  2516503016,   995942801,  3010121933,  2101175208,  2556127423, 
-   163946745,  1780466956,  1537689476,    20268430,   193439057,   322749024, 
-   277449370,  1271124353,  2498423789,   618716317,  1867249421,   867361880, 
-  1999593289,  2093802863,  1014460629,  1429767566,  1003860951,  2097137133, 
-    69319180,  3841854714,  1553459565,  1399319118,  3171618305,   363651695, 
-  3918413430,  1204480241,  1403318218,  2580964942,  2131861955,  1098637374, 
-  2505333161,  2556473389,  1323184717,  4017843596,  2797096264,  1167667288, 
-    76463744,  1312680918,  2702401466,  3814917674,  1058505955,  1047569293, 
-  3700955286,   839217516,  2976975507,    26564135,  1119595214,  3589635931, 
-  3632869056,  1292739998,  4242456844,  4206700034,  1585855712,  1024082969, 
-  3851156581,   629929210,  2460727210,  2274034248,   458183637,  3004918686, 
-   167365901,  3386586757,  1605118920,  2242748723,  3098350751,   683674319, 
-   594748553,   162183321,  1339141246,  1029653709,  2023588825,  1576732270, 
-  3873615838,  2565366869,  2305780113,  2503753048,  3805087132,  3314139237, 
-  3208189155,  2122231641,  2240932467,  1374600680,   705512372,  2897717605, 
-  2094820632,  1093629799,  4043984421,  2426155084,  3334364230,   684756172, 
-   809542185,    94752427,  2698644211,  1771641606,  1119117261,  3150577859, 
-  3945425310,  2548716638,  2533421448,   550245572,  2354638589,  1374530774, 
-  1344445697,   562203822,  2745343659,  3010417009,   130552948,   315584214, 
-  1712124062,  3261879727,   182154411,  2253190108,  1458000818,  2829670134, 
-  3544314499,  2882689991,  2935096358,  3800077312,  3910678899,  2933069715, 
-   314430528,  2408678408,  3233828437,  1431802403,  2801808944,  2435155806, 
-   787059375,  2953775952,   841158135,  2159636882,  3562758340,  4057404468, 
-  2760199512,    59471422,   387865416,   602475431,  1882506211,   511097860, 
-   436572314,  1121077626,    55519842,  2379674009,    36373142,  2577782048, 
-  3808465345,  1642597843,  2003340162,   915403751,  3475679750,   953399636, 
-  3077264749,  3990942596,   302224598,  2314239226,  2260063249,  2596817147, 
-  2350739177,  3146822126,  4058613543,  2831893039,  2478575460,  1033477894, 
-  3664916877,  2668044575,  1658463391,   122318966,   936474512,  3491054852, 
-   560024289,  1830276631,   144885590,  1556615741,  1597610225,  1856413969, 
-  1031792556,  1844191084,  1441357589,  3147919604,   199001354,  2555043119, 
-  2023049680,  4184669824,  4074523931,   252765086,  3328098427,  1480103038 
-};
@@ -0,0 +1,115 @@
+/* Counter-based random-number generator Philox4x32-10 (Salmon, Moraes,
+   Dror and Shaw, "Parallel random numbers: as easy as 1, 2, 3", SC11).
+   The output is a pure function of a key and a counter: ten rounds of
+   multiplications and exclusive-ors scramble the 128-bit counter under a
+   64-bit key.  There is no state to keep or share, so any number of
+   replications or threads can draw their own variates independently, each
+   from its own key, in any order, and a block of counters can be
+   generated in parallel.  Here the key is a stream number and a
+   replication number, and the counter numbers the variates of that
+   stream in that replication.  The header file philox.h must be included
+   in the calling program (#include "philox.h") before using these
+   functions.
+
+   Usage:
+
+   1. To obtain U(0,1) random number "counter" (0, 1, 2, ...) of
+      stream "stream" in replication "rep," execute
+          u = philox_u01(stream, rep, counter);
+      The result is a double strictly between 0 and 1 with 53 random bits,
+      and is the same whenever the arguments are.
+
+   2. To fill positions 0 through n-1 of the double array u with numbers
+      "counter" through "counter" + n-1 of the same stream, execute
+          philox_fill(u, n, stream, rep, counter);
+
+   3. To apply the generator itself to the counter ctr[0..3] under the key
+      key[0..1], execute
+          philox4x32(ctr, key, out);
+      which stores the four 32-bit results in out[0..3]. */
+
+#include "philox.h"
+
+#define PHILOX_M0  0xD2511F53U  /* Round multipliers. */
+#define PHILOX_M1  0xCD9E8D57U
+#define PHILOX_W0  0x9E3779B9U  /* Key increments (Weyl sequence). */
+#define PHILOX_W1  0xBB67AE85U
+#define PHILOX_ROUNDS 10
+
+
+void philox4x32(const unsigned int ctr[4], const unsigned int key[2],
+                unsigned int out[4])
+{
+    unsigned int       c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3],
+                       k0 = key[0], k1 = key[1];
+    unsigned long long p0, p1;
+    int                r;
+
+    for (r = 0; r < PHILOX_ROUNDS; ++r) {
+        if (r > 0) {
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        p0 = (unsigned long long) PHILOX_M0 * c0;
+        p1 = (unsigned long long) PHILOX_M1 * c2;
+        c0 = (unsigned int) (p1 >> 32) ^ c1 ^ k0;
+        c2 = (unsigned int) (p0 >> 32) ^ c3 ^ k1;
+        c1 = (unsigned int) p1;
+        c3 = (unsigned int) p0;
+    }
+
+    out[0] = c0;  out[1] = c1;  out[2] = c2;  out[3] = c3;
+}
+
+
+/* Make a double in (0,1) from 53 bits of hi and lo. */
+
+static double philox_double(unsigned int hi, unsigned int lo)
+{
+    return ((hi >> 5) * 67108864.0 + (lo >> 6) + 0.5) / 9007199254740992.0;
+}
+
+
+/* Each call of the generator yields two numbers: number "counter" comes
+   from counter / 2, in the first or the second pair of words. */
+
+double philox_u01(unsigned int stream, unsigned int rep,
+                  unsigned long long counter)
+{
+    unsigned int ctr[4], key[2], out[4];
+    int          half = (int) (counter & 1) * 2;
+
+    ctr[0] = (unsigned int) (counter >> 1);
+    ctr[1] = (unsigned int) (counter >> 33);
+    ctr[2] = 0;
+    ctr[3] = 0;
+    key[0] = stream;
+    key[1] = rep;
+    philox4x32(ctr, key, out);
+    return philox_double(out[half], out[half + 1]);
+}
+
+
+void philox_fill(double *u, int n, unsigned int stream, unsigned int rep,
+                 unsigned long long counter)
+{
+    unsigned int ctr[4], key[2], out[4];
+    int          i = 0;
+
+    key[0] = stream;
+    key[1] = rep;
+    ctr[2] = 0;
+    ctr[3] = 0;
+
+    /* An odd first counter takes the second half of its block. */
+    if (n > 0 && (counter & 1))
+        u[i++] = philox_u01(stream, rep, counter++);
+    for (; i < n; i += 2, counter += 2) {
+        ctr[0] = (unsigned int) (counter >> 1);
+        ctr[1] = (unsigned int) (counter >> 33);
+        philox4x32(ctr, key, out);
+        u[i] = philox_double(out[0], out[1]);
+        if (i + 1 < n)
+            u[i + 1] = philox_double(out[2], out[3]);
+    }
+}
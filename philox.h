@@ -0,0 +1,9 @@
+/* Header file "philox.h" to be included by programs using the counter-based
+   generator in philox.c.  See philox.c for a description of the functions. */
+
+void   philox4x32(const unsigned int ctr[4], const unsigned int key[2],
+                  unsigned int out[4]);
+double philox_u01(unsigned int stream, unsigned int rep,
+                  unsigned long long counter);
+void   philox_fill(double *u, int n, unsigned int stream, unsigned int rep,
+                   unsigned long long counter);
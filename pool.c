@@ -0,0 +1,171 @@
+/* Pool of worker threads running numbered tasks, such as the replications
+   of a simulation or the points of a parameter sweep.  The tasks are dealt
+   out to the threads in contiguous blocks, and each thread runs its own
+   block from the front.  A thread that has run out steals the back half of
+   the remaining block of another, so tasks that take much longer than the
+   rest, wherever they fall, do not leave threads idle while any task is
+   still waiting.  The order in which tasks finish is therefore not fixed;
+   a task that produces output should either identify it, or write it
+   somewhere of its own to be merged in task order once pool_run returns.
+   The header file pool.h must be included in the calling program
+   (#include "pool.h") before using these functions, and the program built
+   with -pthread.
+
+   Usage:
+
+   1. To run task(arg, k) for k = 0, 1, ..., n-1 on "threads" threads,
+      execute
+          pool_run(n, threads, task, arg);
+      If threads is 0 or less, one thread per processor is used; never
+      more threads than tasks are started, and with only one the tasks run
+      in order in the calling thread.  pool_run returns when all the tasks
+      are done.
+
+   2. To obtain the number of processors, execute
+          threads = pool_threads(); */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "pool.h"
+
+typedef struct {
+    _Alignas(64) pthread_mutex_t lock;
+    int lo, hi;                   /* Tasks lo..hi-1 are left to run. */
+} block_t;
+
+typedef struct {
+    block_t  *block;              /* Block of each thread. */
+    int       threads;
+    void    (*task)(void *arg, int k);
+    void     *arg;
+} pool_t;
+
+typedef struct {
+    pool_t   *pool;
+    int       id;
+} worker_t;
+
+
+/* Take the next task from the front of block b.  Return it, or -1 if the
+   block is empty. */
+
+static int take(block_t *b)
+{
+    int k = -1;
+
+    pthread_mutex_lock(&b->lock);
+    if (b->lo < b->hi)
+        k = b->lo++;
+    pthread_mutex_unlock(&b->lock);
+    return k;
+}
+
+
+/* Move the back half of the first non-empty block after thread id's own
+   into thread id's block.  Return 0 if every block was empty. */
+
+static int steal(pool_t *p, int id)
+{
+    int i, lo, hi;
+
+    for (i = 1; i < p->threads; ++i) {
+        block_t *v = &p->block[(id + i) % p->threads];
+
+        pthread_mutex_lock(&v->lock);
+        hi = v->hi;
+        lo = v->hi - (v->hi - v->lo + 1) / 2;
+        v->hi = lo;
+        pthread_mutex_unlock(&v->lock);
+        if (lo < hi) {
+            pthread_mutex_lock(&p->block[id].lock);
+            p->block[id].lo = lo;
+            p->block[id].hi = hi;
+            pthread_mutex_unlock(&p->block[id].lock);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/* A worker: run the tasks of its own block, then steal more, until there
+   are none left anywhere.  No tasks are ever added, so a worker that finds
+   every block empty is done. */
+
+static void *work(void *arg)
+{
+    worker_t *w = arg;
+    pool_t   *p = w->pool;
+    int       k;
+
+    do
+        while ((k = take(&p->block[w->id])) >= 0)
+            p->task(p->arg, k);
+    while (steal(p, w->id));
+    return NULL;
+}
+
+
+void pool_run(int n, int threads, void (*task)(void *arg, int k), void *arg)
+{
+    pool_t     p;
+    pthread_t *thread;
+    worker_t  *worker;
+    int        t, k;
+
+    if (threads <= 0)
+        threads = pool_threads();
+    if (threads > n)
+        threads = n;
+    if (threads <= 1) {
+        for (k = 0; k < n; ++k)
+            task(arg, k);
+        return;
+    }
+
+    p.block   = aligned_alloc(_Alignof(block_t),
+                              threads * sizeof(block_t));
+    p.threads = threads;
+    p.task    = task;
+    p.arg     = arg;
+    thread    = malloc(threads * sizeof(pthread_t));
+    worker    = malloc(threads * sizeof(worker_t));
+    if (p.block == NULL || thread == NULL || worker == NULL) {
+        fprintf(stderr, "\npool_run: out of memory\n");
+        exit(3);
+    }
+
+    /* Deal the tasks out in contiguous blocks of as nearly equal size as
+       possible. */
+    for (t = 0; t < threads; ++t) {
+        pthread_mutex_init(&p.block[t].lock, NULL);
+        p.block[t].lo = (int) ((long long) n * t / threads);
+        p.block[t].hi = (int) ((long long) n * (t + 1) / threads);
+        worker[t].pool = &p;
+        worker[t].id   = t;
+    }
+
+    for (t = 0; t < threads; ++t)
+        if (pthread_create(&thread[t], NULL, work, &worker[t]) != 0) {
+            fprintf(stderr, "\npool_run: cannot start thread %d\n", t);
+            exit(3);
+        }
+    for (t = 0; t < threads; ++t)
+        pthread_join(thread[t], NULL);
+
+    for (t = 0; t < threads; ++t)
+        pthread_mutex_destroy(&p.block[t].lock);
+    free(worker);
+    free(thread);
+    free(p.block);
+}
+
+
+int pool_threads(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return n > 0 ? (int) n : 1;
+}
@@ -0,0 +1,6 @@
+/* Header file "pool.h" to be included by programs using the pool of worker
+   threads in pool.c.  See pool.c for a description of the functions.
+   Programs using it must be built with -pthread. */
+
+void pool_run(int n, int threads, void (*task)(void *arg, int k), void *arg);
+int  pool_threads(void);
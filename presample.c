@@ -0,0 +1,100 @@
+/* Arrays of variates sampled ahead of the event loop.  A presample_t holds
+   a contiguous array of variates made by a fill function, such as one
+   that fills it with lcgrand_fill and takes logarithms, in one pass over
+   the array: the generator runs in a tight loop, vectorized where the fill
+   function is, and the event routines then only index into the array.
+   The variates are handed out in the order they were made, and those not
+   used by one replication are kept for the next, so the sequence is
+   exactly that of calling the generator one variate at a time.  The
+   header file presample.h must be included in the calling program
+   (#include "presample.h") before using these functions.
+
+   Usage:
+
+   1. To create an empty array whose variates come from fill, execute
+          s = presample_create(fill, arg);
+      where fill(arg, x, n) must store the next n variates in x[0..n-1],
+      arg being, e.g., the caller's generator state.  To free it, execute
+          presample_destroy(s);
+
+   2. To make sure at least n variates are ready, e.g. the number a
+      replication is expected to use, before it starts, execute
+          presample_reserve(s, n);
+      The array grows if need be.
+
+   3. To obtain the next variate, execute
+          x = presample_next(s);
+      If none are left, another batch the size of the array is made. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "presample.h"
+
+#define PRESAMPLE_MIN 1024  /* Smallest batch made. */
+
+struct presample {
+    double *x;         /* Variates; x[next..size-1] are not yet used. */
+    int     next, size, cap;
+    void  (*fill)(void *arg, double *x, int n);
+    void   *arg;
+};
+
+
+presample_t *presample_create(void (*fill)(void *arg, double *x, int n),
+                             void *arg)
+{
+    presample_t *s = malloc(sizeof(presample_t));
+
+    if (s == NULL) {
+        fprintf(stderr, "\npresample_create: out of memory\n");
+        exit(3);
+    }
+    s->x    = NULL;
+    s->next = 0;
+    s->size = 0;
+    s->cap  = 0;
+    s->fill = fill;
+    s->arg  = arg;
+    return s;
+}
+
+
+void presample_destroy(presample_t *s)
+{
+    free(s->x);
+    free(s);
+}
+
+
+void presample_reserve(presample_t *s, int n)
+{
+    int left = s->size - s->next;
+
+    if (left >= n)
+        return;
+
+    /* Move the unused variates to the front and make the rest. */
+    if (n > s->cap) {
+        s->cap = s->cap < PRESAMPLE_MIN ? PRESAMPLE_MIN : s->cap;
+        while (s->cap < n)
+            s->cap *= 2;
+        s->x = realloc(s->x, s->cap * sizeof(double));
+        if (s->x == NULL) {
+            fprintf(stderr, "\npresample_reserve: out of memory\n");
+            exit(3);
+        }
+    }
+    memmove(s->x, s->x + s->next, left * sizeof(double));
+    s->fill(s->arg, s->x + left, n - left);
+    s->next = 0;
+    s->size = n;
+}
+
+
+double presample_next(presample_t *s)
+{
+    if (s->next == s->size)
+        presample_reserve(s, s->cap > PRESAMPLE_MIN ? s->cap : PRESAMPLE_MIN);
+    return s->x[s->next++];
+}
@@ -0,0 +1,11 @@
+/* Header file "presample.h" to be included by programs using the arrays of
+   pre-sampled variates in presample.c.  See presample.c for a description
+   of the functions. */
+
+typedef struct presample presample_t;
+
+presample_t *presample_create(void (*fill)(void *arg, double *x, int n),
+                             void *arg);
+void         presample_destroy(presample_t *s);
+void         presample_reserve(presample_t *s, int n);
+double       presample_next(presample_t *s);
@@ -0,0 +1,87 @@
+/* Parallel replications of a simulation on the pool of pool.c, with their
+   output in replication order.  Replication r (r = 1, 2, ...) writes its
+   report and debug log to temporary files of its own, which are appended
+   to the real ones in replication order once all are done, so the output
+   is the same for any number of threads as long as each replication
+   depends only on r, e.g. by starting at stream r of each generator.  The
+   header file reps.h must be included in the calling program
+   (#include "reps.h") before using this function, and the program built
+   with pool.c and -pthread.
+
+   Usage:
+
+   1. To run replications 1, 2, ..., n on "threads" threads (0 for one
+      per processor, as in pool_run), execute
+          reps_run(n, threads, outfile, debugfile, run, arg);
+      where run(arg, r, out, debug) must run replication r, writing its
+      report to out and its debug log to debug; arg is, e.g., the
+      simulation's parameters, which run copies into a state of its own.
+      When reps_run returns, the reports have been appended to outfile and
+      the debug logs to debugfile, in order of r. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "pool.h"
+#include "reps.h"
+
+typedef struct {
+    FILE  **file;                 /* Report and debug log of each. */
+    void  (*run)(void *arg, int r, FILE *outfile, FILE *debugfile);
+    void   *arg;
+} reps_t;
+
+
+/* Task k of the pool: run replication k + 1. */
+
+static void replicate(void *arg, int k)
+{
+    reps_t *reps = arg;
+
+    reps->run(reps->arg, k + 1, reps->file[2 * k], reps->file[2 * k + 1]);
+}
+
+
+/* Copy the temporary file "from" to the end of "to", and close it. */
+
+static void append_file(FILE *to, FILE *from)
+{
+    char   buf[8192];
+    size_t n;
+
+    rewind(from);
+    while ((n = fread(buf, 1, sizeof(buf), from)) > 0)
+        fwrite(buf, 1, n, to);
+    fclose(from);
+}
+
+
+void reps_run(int replications, int threads, FILE *outfile, FILE *debugfile,
+              void (*run)(void *arg, int r, FILE *outfile, FILE *debugfile),
+              void *arg)
+{
+    reps_t reps;
+    int    r;
+
+    reps.file = malloc(2 * replications * sizeof(FILE *));
+    if (reps.file == NULL) {
+        fprintf(stderr, "\nreps_run: out of memory\n");
+        exit(3);
+    }
+    for (r = 0; r < 2 * replications; ++r) {
+        reps.file[r] = tmpfile();
+        if (reps.file[r] == NULL) {
+            fprintf(stderr, "\nreps_run: cannot create temporary file\n");
+            exit(2);
+        }
+    }
+    reps.run = run;
+    reps.arg = arg;
+
+    pool_run(replications, threads, replicate, &reps);
+
+    for (r = 0; r < replications; ++r) {
+        append_file(outfile, reps.file[2 * r]);
+        append_file(debugfile, reps.file[2 * r + 1]);
+    }
+    free(reps.file);
+}
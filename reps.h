@@ -0,0 +1,9 @@
+/* Header file "reps.h" to be included by programs running replications
+   in parallel with reps.c.  See reps.c for a description of the function.
+   Programs using it must be built with pool.c and -pthread. */
+
+#include <stdio.h>
+
+void reps_run(int replications, int threads, FILE *outfile, FILE *debugfile,
+              void (*run)(void *arg, int r, FILE *outfile, FILE *debugfile),
+              void *arg);
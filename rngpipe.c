@@ -0,0 +1,179 @@
+/* Pipeline of random variates made ahead by a producer thread.  Each of n
+   generators, functions such as a wrapper around -log(lcg_draw(g)) that
+   take a pointer to the caller's state, gets a ring buffer of its own,
+   which the producer keeps filled and the simulation thread empties.  Every
+   ring has one writer and one reader, so it needs no lock: the producer
+   publishes what it has written by advancing the ring's tail, the consumer
+   what it has read by advancing the head, each with release ordering, and
+   each reads the other's index with acquire ordering only when its own
+   copy says the ring is full or empty.  The two indices are kept in
+   separate cache lines.  A generator is only ever called by the producer,
+   in order, so its variates arrive in the order they would from direct
+   calls, however the producer and the simulation interleave; the
+   generator's state must not be used by anything else while the pipeline
+   runs.  The header file rngpipe.h must be included in the calling program
+   (#include "rngpipe.h") before using these functions, and the program
+   built with -pthread.
+
+   Usage:
+
+   1. To start a producer thread for the n generators gen[0..n-1], each
+      with a ring of room for cap variates (rounded up to a power of 2),
+      execute
+          p = rngpipe_create(n, gen, arg, cap);
+      The producer calls gen[k](arg) for each variate of generator k.  It
+      starts generating at once, so the generators must be seeded first.
+
+   2. To obtain the next variate of generator k, execute
+          x = rngpipe_next(p, k);
+      This waits if the producer has fallen behind.
+
+   3. To stop the producer and free the pipeline, execute
+          rngpipe_destroy(p);
+      Variates made but not consumed are lost; the generators are left
+      past them. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include "rngpipe.h"
+
+#define RING_BATCH 64  /* Variates the producer makes per turn at a ring. */
+
+typedef struct {
+    _Alignas(64) atomic_ulong head;  /* Next to read; written by the
+                                        consumer. */
+    unsigned long tail_seen;         /* Consumer's copy of tail. */
+
+    _Alignas(64) atomic_ulong tail;  /* Next to write; written by the
+                                        producer. */
+    unsigned long head_seen;         /* Producer's copy of head. */
+
+    _Alignas(64) double *buf;
+    unsigned long       mask;        /* Room - 1. */
+    double            (*gen)(void *arg);
+} ring_t;
+
+struct rngpipe {
+    ring_t     *ring;
+    int         n;
+    void       *arg;        /* Argument of the generators. */
+    atomic_int  stop;
+    pthread_t   producer;
+};
+
+
+/* Top up ring r by at most RING_BATCH variates.  Return the number made. */
+
+static int ring_fill(ring_t *r, void *arg)
+{
+    unsigned long tail = atomic_load_explicit(&r->tail, memory_order_relaxed),
+                  room = r->mask + 1 - (tail - r->head_seen), i;
+
+    if (room < RING_BATCH) {
+        r->head_seen = atomic_load_explicit(&r->head, memory_order_acquire);
+        room = r->mask + 1 - (tail - r->head_seen);
+        if (room == 0)
+            return 0;
+    }
+    if (room > RING_BATCH)
+        room = RING_BATCH;
+    for (i = 0; i < room; ++i)
+        r->buf[(tail + i) & r->mask] = r->gen(arg);
+    atomic_store_explicit(&r->tail, tail + room, memory_order_release);
+    return (int) room;
+}
+
+
+/* The producer: visit the rings in turn until told to stop, giving up
+   the processor whenever all of them are full. */
+
+static void *produce(void *arg)
+{
+    rngpipe_t *p = arg;
+    int        k, made;
+
+    while (!atomic_load_explicit(&p->stop, memory_order_relaxed)) {
+        made = 0;
+        for (k = 0; k < p->n; ++k)
+            made += ring_fill(&p->ring[k], p->arg);
+        if (made == 0)
+            sched_yield();
+    }
+    return NULL;
+}
+
+
+rngpipe_t *rngpipe_create(int n, double (*const *gen)(void *arg), void *arg,
+                          int cap)
+{
+    rngpipe_t    *p = malloc(sizeof(rngpipe_t));
+    unsigned long room = RING_BATCH;
+    int           k;
+
+    while (room < (unsigned long) cap)
+        room *= 2;
+    if (p != NULL)
+        p->ring = aligned_alloc(_Alignof(ring_t), n * sizeof(ring_t));
+    if (p == NULL || p->ring == NULL) {
+        fprintf(stderr, "\nrngpipe_create: out of memory\n");
+        exit(3);
+    }
+    p->n   = n;
+    p->arg = arg;
+    for (k = 0; k < n; ++k) {
+        ring_t *r = &p->ring[k];
+
+        atomic_init(&r->head, 0);
+        atomic_init(&r->tail, 0);
+        r->tail_seen = 0;
+        r->head_seen = 0;
+        r->buf  = malloc(room * sizeof(double));
+        r->mask = room - 1;
+        r->gen  = gen[k];
+        if (r->buf == NULL) {
+            fprintf(stderr, "\nrngpipe_create: out of memory\n");
+            exit(3);
+        }
+    }
+
+    atomic_init(&p->stop, 0);
+    if (pthread_create(&p->producer, NULL, produce, p) != 0) {
+        fprintf(stderr, "\nrngpipe_create: cannot start the producer\n");
+        exit(3);
+    }
+    return p;
+}
+
+
+void rngpipe_destroy(rngpipe_t *p)
+{
+    int k;
+
+    atomic_store(&p->stop, 1);
+    pthread_join(p->producer, NULL);
+    for (k = 0; k < p->n; ++k)
+        free(p->ring[k].buf);
+    free(p->ring);
+    free(p);
+}
+
+
+double rngpipe_next(rngpipe_t *p, int k)
+{
+    ring_t       *r    = &p->ring[k];
+    unsigned long head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    double        x;
+
+    /* Wait, if need be, for the producer to catch up. */
+    while (head == r->tail_seen) {
+        r->tail_seen = atomic_load_explicit(&r->tail, memory_order_acquire);
+        if (head == r->tail_seen)
+            sched_yield();
+    }
+    x = r->buf[head & r->mask];
+    atomic_store_explicit(&r->head, head + 1, memory_order_release);
+    return x;
+}
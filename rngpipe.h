@@ -0,0 +1,10 @@
+/* Header file "rngpipe.h" to be included by programs using the random-
+   variate pipeline in rngpipe.c.  See rngpipe.c for a description of the
+   functions.  Programs using it must be built with -pthread. */
+
+typedef struct rngpipe rngpipe_t;
+
+rngpipe_t *rngpipe_create(int n, double (*const *gen)(void *arg), void *arg,
+                          int cap);
+void       rngpipe_destroy(rngpipe_t *p);
+double     rngpipe_next(rngpipe_t *p, int k);
@@ -0,0 +1,175 @@
+/* Parameter sweeps of a simulation on the pool of pool.c.  The file
+   NAME.sweep gives the values of the mean interarrival time, the mean
+   service times at the two servers and the length of the simulation to
+   try, one parameter to a line, each line a list of numbers and of ranges
+   first:step:last, e.g.
+       0.8:0.05:1.2
+       0.7 0.75
+       0.9
+       1000
+   and, on an optional fifth line, the number of replications of each
+   point (10 if none).  Every combination of values is a point.  Each
+   replication of each point is a task of its own for the pool, whose
+   threads steal work from one another, so the long replications of
+   heavy-traffic points keep every thread busy rather than one.  Each task
+   writes its row of results to NAME.sweep.out as soon as it ends: the
+   rows come in no fixed order, and each starts with the point (numbered
+   from 0, the last parameter varying fastest) and replication it belongs
+   to.  The header file sweep.h must be included in the calling program
+   (#include "sweep.h") before using this function, and the program built
+   with pool.c and -pthread.
+
+   Usage:
+
+   1. To run the sweep of NAME.sweep on "threads" threads (0 for one per
+      processor, as in pool_run), execute
+          sweep_run(name, header, threads, run);
+      where header is the line of column names (without newline) written
+      first to NAME.sweep.out, and run(param, point, rep, rowfile) must run
+      replication rep (rep = 1, 2, ...) of point "point" with the mean
+      interarrival time param[0], mean service times param[1] and param[2]
+      and length param[3], and write its row to rowfile, whole and at once
+      (e.g. between flockfile and funlockfile), since other threads write
+      rows to the same file.  Replication rep should start at stream rep,
+      so that the points are compared on common random numbers.  Errors
+      in NAME.sweep are reported on stderr and stop the program. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pool.h"
+#include "sweep.h"
+
+typedef struct {
+    float *value[4];  /* Values of each parameter to try. */
+    int    count[4], points, replications;
+    FILE  *rowfile;
+    const char *path;
+    void (*run)(const float *param, int point, int rep, FILE *rowfile);
+} sweep_t;
+
+
+/* Store the numbers and ranges first:step:last of line in a new array
+   *value, and return how many there are. */
+
+static int read_values(const sweep_t *sweep, char *line, float **value)
+{
+    char  *item;
+    float  first, step, last;
+    int    i, m, n = 0, cap = 0;
+
+    *value = NULL;
+    for (item = strtok(line, " \t\n"); item != NULL;
+         item = strtok(NULL, " \t\n")) {
+        if (strchr(item, ':') == NULL && sscanf(item, "%f", &first) == 1) {
+            step = 0.0;
+            m    = 1;
+        }
+        else if (sscanf(item, "%f:%f:%f", &first, &step, &last) == 3
+                 && step > 0.0 && last >= first)
+            m = (int) ((last - first) / step + 0.001) + 1;
+        else {
+            fprintf(stderr, "\nBad value or range \"%s\" in %s\n", item,
+                    sweep->path);
+            exit(1);
+        }
+
+        if (n + m > cap) {
+            cap    = 2 * (n + m);
+            *value = realloc(*value, cap * sizeof(float));
+            if (*value == NULL) {
+                fprintf(stderr, "\nread_values: out of memory\n");
+                exit(3);
+            }
+        }
+        for (i = 0; i < m; ++i)
+            (*value)[n++] = first + i * step;
+    }
+    return n;
+}
+
+
+/* Read the grid of a sweep from f. */
+
+static void read_sweep(sweep_t *sweep, FILE *f)
+{
+    char line[4096];
+    int  i;
+
+    sweep->points = 1;
+    for (i = 0; i < 4; ++i) {
+        if (fgets(line, sizeof(line), f) == NULL) {
+            fprintf(stderr, "\n%s has fewer than four lines\n", sweep->path);
+            exit(1);
+        }
+        sweep->count[i] = read_values(sweep, line, &sweep->value[i]);
+        if (sweep->count[i] == 0) {
+            fprintf(stderr, "\nNo values on line %d of %s\n", i + 1,
+                    sweep->path);
+            exit(1);
+        }
+        sweep->points *= sweep->count[i];
+    }
+
+    sweep->replications = 10;
+    if (fgets(line, sizeof(line), f) != NULL
+        && sscanf(line, "%d", &sweep->replications) == 1
+        && (sweep->replications < 1 || sweep->replications > 100)) {
+        fprintf(stderr, "\nReplications must be between 1 and 100\n");
+        exit(1);
+    }
+}
+
+
+/* Task k of the pool: replication k % replications + 1 of point
+   k / replications of the sweep arg. */
+
+static void sweep_task(void *arg, int k)
+{
+    sweep_t *sweep = arg;
+    float    param[4];
+    int      i, point = k / sweep->replications, p;
+
+    for (i = 3, p = point; i >= 0; --i) {
+        param[i] = sweep->value[i][p % sweep->count[i]];
+        p /= sweep->count[i];
+    }
+    sweep->run(param, point, k % sweep->replications + 1, sweep->rowfile);
+}
+
+
+void sweep_run(const char *name, const char *header, int threads,
+               void (*run)(const float *param, int point, int rep,
+                           FILE *rowfile))
+{
+    sweep_t sweep;
+    FILE   *infile;
+    char    path[FILENAME_MAX];
+    int     i;
+
+    /* Read the grid. */
+    snprintf(path, sizeof(path), "%s.sweep", name);
+    infile = fopen(path, "r");
+    if (infile == NULL) {
+        fprintf(stderr, "\nCannot open %s\n", path);
+        exit(1);
+    }
+    sweep.path = path;
+    sweep.run  = run;
+    read_sweep(&sweep, infile);
+    fclose(infile);
+
+    /* Run every replication of every point, writing a row for each. */
+    snprintf(path, sizeof(path), "%s.sweep.out", name);
+    sweep.rowfile = fopen(path, "w");
+    if (sweep.rowfile == NULL) {
+        fprintf(stderr, "\nCannot open %s\n", path);
+        exit(1);
+    }
+    fprintf(sweep.rowfile, "%s\n", header);
+    pool_run(sweep.points * sweep.replications, threads, sweep_task, &sweep);
+    fclose(sweep.rowfile);
+
+    for (i = 0; i < 4; ++i)
+        free(sweep.value[i]);
+}
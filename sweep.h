@@ -0,0 +1,9 @@
+/* Header file "sweep.h" to be included by programs running parameter
+   sweeps with sweep.c.  See sweep.c for a description of the function.
+   Programs using it must be built with pool.c and -pthread. */
+
+#include <stdio.h>
+
+void sweep_run(const char *name, const char *header, int threads,
+               void (*run)(const float *param, int point, int rep,
+                           FILE *rowfile));
@@ -3,201 +3,1005 @@
 #include <stdio.h>  
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
+#include "evlist.h"   /* Header file for the future event list. */
+#include "fifo.h"     /* Header file for the FIFO queues. */
 #include "lcgrand.h"  /* Header file for random-number generator. */
-
-#define Q_LIMIT 2500  /* Limit on queue length. */
+#include "zigexp.h"   /* Header file for the ziggurat exponential generator. */
+#include "philox.h"   /* Header file for the counter-based generator. */
+#include "rngpipe.h"  /* Header file for the variate pipeline. */
+#include "presample.h" /* Header file for the pre-sampled variates. */
+#include "pool.h"     /* Header file for the pool of worker threads. */
+#include "reps.h"     /* Header file for the parallel replications. */
+#include "sweep.h"    /* Header file for the parameter sweeps. */
+
+#ifndef Q_LIMIT
+#define Q_LIMIT    0  /* Limit on queue length, or 0 for none. */
+#endif
+#define Q_INIT    64  /* Initial room in each queue; grows as needed. */
 #define BUSY       1  /* Mnemonics for server's being busy */
 #define IDLE       0  /* and idle. */
-
-int   next_event_type, num_custs_delayed, num_events, num_in_q[2], server_status[2];
-float area_num_in_q[2], area_server_status[2], mean_interarrival, mean_service[2],
-      sim_time, time_end, time_arrival[Q_LIMIT + 1], second_time_arrival[Q_LIMIT + 1], 
-	  time_last_event, time_next_event[6], total_of_delays;
-FILE  *infile, *outfile, *debugfile;
-
-void  initialize(void);
-void  timing(void);
-void  queue1_arrival(void);
-void  queue1_departure(void);
-void  queue2_arrival(void);
-void  queue2_departure(void);
-void  report(void);
-void  update_time_avg_stats(void);
-float expon(float mean);
-
-
+#define INTERARRIVAL 0  /* Kinds of variate drawn by variate(): */
+#define SERVICE1     1  /* interarrival times, and service times at the */
+#define SERVICE2     2  /* first and at the second server. */
+
+#if defined(RNG_PIPELINE) && defined(RNG_PHILOX)
+#error "RNG_PIPELINE and RNG_PHILOX cannot be used together"
+#endif
+
+#if defined(RNG_PRESAMPLE) && (defined(RNG_PHILOX) || defined(RNG_PIPELINE))
+#error "RNG_PRESAMPLE cannot be used with RNG_PHILOX or RNG_PIPELINE"
+#endif
+
+#if defined(LOCKSTEP) && (defined(RNG_PHILOX) || defined(RNG_PIPELINE) \
+    || defined(RNG_PRESAMPLE) || defined(FAST_EXPON) || defined(SWEEP) \
+    || defined(PARALLEL_REPS))
+#error "LOCKSTEP cannot be used with other RNG_, FAST_EXPON or run options"
+#endif
+
+#if defined(LINDLEY_CHECK) && !defined(LINDLEY)
+#define LINDLEY
+#endif
+
+#if defined(LINDLEY) && (defined(RNG_PHILOX) || defined(RNG_PIPELINE) \
+    || defined(RNG_PRESAMPLE) || defined(SWEEP) || defined(PARALLEL_REPS) \
+    || defined(LOCKSTEP))
+#error "LINDLEY cannot be used with other RNG_ or run options"
+#endif
+
+#if defined(LINDLEY) && Q_LIMIT != 0
+#error "LINDLEY cannot be used with a queue limit, which needs events"
+#endif
+
+/* State of one simulation.  Everything a run reads or writes is kept here
+   rather than in file-scope variables and passed to every function below,
+   so that any number of simulations can run in one process, each with its
+   own sim_t.  The fields used on every event are grouped in the first two
+   cache lines. */
+
+typedef struct {
+    /* Clock, system state, accumulators and the mean times, used on every
+       event or every customer: the first cache line. */
+    _Alignas(64) float sim_time;
+    float time_last_event;
+    int   next_event_type, num_in_q[2], server_status[2], num_custs_delayed;
+    float area_num_in_q[2], area_server_status[2], total_of_delays,
+          mean_interarrival, mean_service[2];
+
+    /* Future event list and the handle of the pending event of each
+       type, the times of arrival of the customers waiting in each queue,
+       and the debug file written on every event: the second. */
+    _Alignas(64) evlist_t *event_list;
+    int       event_handle[6];
+    fifo_t   *time_arrival[2];
+    FILE     *debugfile;
+
+    /* Parameters and files used once per replication. */
+    float time_end;
+    FILE  *infile, *outfile;
+#ifdef SWEEP
+    /* File report writes the result row to, and the point of the sweep
+       and replication the row belongs to. */
+    FILE  *rowfile;
+    int   point, rep;
+#endif
+
+    /* Random numbers: expon draws from stream 1 of lcgrand, held in a
+       cache line of its own. */
+    lcg_t expon_rng;
+#ifdef RNG_PHILOX
+    /* Counter-based stream 1 for expon: the replication it belongs to and
+       its next counter (rng_counter[1]). */
+    unsigned int       replication;
+    unsigned long long rng_counter[3];
+#endif
+#ifdef RNG_PIPELINE
+    /* Variates made ahead by a producer thread (see rngpipe.c), built
+       with -DRNG_PIPELINE -pthread: ring 0 holds exponentials of mean 1
+       for expon. */
+    rngpipe_t *rng_pipe;
+#endif
+#ifdef RNG_PRESAMPLE
+    /* Variates sampled ahead of each replication (see presample.c), built
+       with -DRNG_PRESAMPLE: exponentials of mean 1 for expon. */
+    presample_t *expon_sample;
+#endif
+#ifdef LINDLEY
+    /* Streams of the service times at each server for lindley(), built
+       with -DLINDLEY: expon_rng gives the interarrival times.  Each
+       replication seeds all three afresh from its number (see
+       lindley_streams). */
+    lcg_t service_rng[2];
+    int   replication;
+#endif
+} sim_t;
+
+#ifdef LOCKSTEP
+/* Lockstep replications, built with -DLOCKSTEP (and -O3 for the vector
+   code).  A block of LANES replications is simulated at once, with the
+   state of each field held for all of them side by side in an array, so
+   that finding each one's next event, updating its time averages,
+   stepping its random-number stream and carrying out the event are done
+   for the whole block in vector registers.  The events differ from lane
+   to lane, so each is turned into masks saying what happens to each
+   queue and server, and every field is then updated in every lane by
+   compare-and-select.  Only pushing times onto and popping them from
+   each lane's queue of arrival times, and the logarithms of draw_lanes,
+   are done one lane at a time.  Replication r draws from stream r of
+   lcgrand, as with PARALLEL_REPS, and its report is the same; no debug
+   log is kept.  The gain is modest: on one core, ten 200000-minute
+   replications take about 0.5 s, against 0.75 s for PARALLEL_REPS with
+   its debug log compiled out, about 1.5 times as fast, at -O2 and -O3
+   alike.  The scalar queue work and logarithms, and the steps taken
+   until the slowest lane of a block ends, keep it far from LANES times. */
+
+#define LANES 8  /* Replications simulated in lockstep. */
+
+typedef struct {
+    float   sim_time[LANES], time_last_event[LANES],
+            time_next_arrival[LANES], time_next_departure[2][LANES];
+    int     next_event_type[LANES], num_in_q[2][LANES],
+            server_status[2][LANES], num_custs_delayed[LANES];
+    float   area_num_in_q[2][LANES], area_server_status[2][LANES],
+            total_of_delays[LANES];
+    int     done[LANES];           /* Replication has ended, or is unused. */
+    int     z[LANES], need[LANES]; /* States of the streams; which draw. */
+    float   u[LANES], mean[LANES], x[2][LANES]; /* See draw_lanes. */
+    fifo_t *time_arrival[2][LANES];
+
+    /* Masks of what the current event does at queue and server i + 1: a
+       customer joins the queue, starts service on finding the server
+       idle, or is served from the queue, or the server falls idle; and
+       the delay in queue of the customer served, if any. */
+    int     join[2][LANES], start[2][LANES], serve[2][LANES], idle[2][LANES];
+    float   delay[LANES];
+} lanes_t;
+#endif
+
+void  setup(sim_t *sim, int stream);
+void  run_replication(sim_t *sim);
+void  teardown(sim_t *sim);
+#ifdef SWEEP
+void  sweep_point(const float *param, int point, int rep, FILE *rowfile);
+#endif
+#ifdef LOCKSTEP
+void  run_lockstep(const sim_t *base, int replications);
+void  run_lanes(lanes_t *b, const sim_t *sim, int first, int n);
+void  draw_lanes(lanes_t *b, int k);
+void  queue_lanes(lanes_t *b);
+#endif
+#ifdef LINDLEY
+void  run_lindley(sim_t *sim, int replications);
+void  lindley(sim_t *sim);
+void  lindley_streams(sim_t *sim);
+#endif
+#ifdef LINDLEY_CHECK
+void  check_lindley(const sim_t *sim, const sim_t *check, int r);
+#endif
+#ifdef PARALLEL_REPS
+void  replicate(void *arg, int r, FILE *outfile, FILE *debugfile);
+#endif
+void  initialize(sim_t *sim);
+void  timing(sim_t *sim);
+void  schedule(sim_t *sim, int type, float time);
+void  cancel(sim_t *sim, int type);
+void  queue1_arrival(sim_t *sim);
+void  queue1_departure(sim_t *sim);
+void  queue2_arrival(sim_t *sim);
+void  queue2_departure(sim_t *sim);
+void  report(sim_t *sim);
+void  update_time_avg_stats(sim_t *sim);
+float variate(sim_t *sim, int k);
+float expon(sim_t *sim, float mean);
+#ifdef RNG_PIPELINE
+double unit_expon(void *arg);
+#endif
+#if defined(RNG_PRESAMPLE) || defined(LINDLEY)
+void  fill_expon(void *arg, double *x, int n);
+#endif
+
+
+#ifdef SWEEP
+int main(int argc, char *argv[])  /* Main function of a parameter sweep.
+                                     argv[1], if given, is the number of
+                                     threads. */
+{
+    /* Run every replication of every point of tandem.sweep, writing a row
+       for each to tandem.sweep.out. */
+    sweep_run("tandem",
+              "point,replication,mean_interarrival,mean_service1,"
+              "mean_service2,time_end,delay_system,number_q1,"
+              "number_q2,util1,util2,end_time",
+              argc > 1 ? atoi(argv[1]) : 0, sweep_point);
+    return 0;
+}
+#else
+#ifdef PARALLEL_REPS
+int main(int argc, char *argv[])  /* Main function.  argv[1], if given, is
+                                     the number of threads. */
+#else
 int main()  /* Main function. */
+#endif
 {
+    sim_t sim;
+    int   replications = 10;
+#if !defined(PARALLEL_REPS) && !defined(LOCKSTEP) && !defined(LINDLEY)
+    int   i;
+#endif
+
     /* Open input and output files. */
+    sim.infile    = fopen("tandem.in",  "r");
+    sim.outfile   = fopen("tandem.out", "w");
+    sim.debugfile = fopen("debug.out", "w");
 
-    infile  = fopen("tandem.in",  "r");
-    outfile = fopen("tandem.out", "w");
-	debugfile = fopen("debug.out", "w");
+    /* Read input parameters. */
+    fscanf(sim.infile, "%f %f %f %f", &sim.mean_interarrival,
+           &sim.mean_service[0], &sim.mean_service[1], &sim.time_end);
 
-    /* Specify the number of events for the timing function. */
+    /* Write report heading and input parameters. */
+    fprintf(sim.outfile, "Tandem-server queueing system\n\n");
+    fprintf(sim.outfile, "Mean interarrival time%11.3f minutes\n\n",
+            sim.mean_interarrival);
+    fprintf(sim.outfile, "SRVR1 mean service time%16.3f minutes\n\n",
+            sim.mean_service[0]);
+    fprintf(sim.outfile, "SRVR2 mean service time%16.3f minutes\n\n",
+            sim.mean_service[1]);
+    fprintf(sim.outfile, "Length of the simulation%16.3f minutes\n\n",
+            sim.time_end);
+
+#if defined(LOCKSTEP)
+    /* Run the ten replications LANES at a time, each on its own stream. */
+    run_lockstep(&sim, replications);
+#elif defined(LINDLEY)
+    /* Compute the ten replications by the recursion. */
+    run_lindley(&sim, replications);
+#elif defined(PARALLEL_REPS)
+    /* Run the ten replications on argv[1] threads, or one per processor,
+       each on its own streams. */
+    reps_run(replications, argc > 1 ? atoi(argv[1]) : 0, sim.outfile,
+             sim.debugfile, replicate, &sim);
+#else
+    /* Create the queues, the event list and the random-number streams. */
+    setup(&sim, 1);
 
-    num_events = 5;
+    /* Run simulation ten times total */
+    for (i = 0; i < replications; i++)
+        run_replication(&sim);
 
-    /* Read input parameters. */
+    teardown(&sim);
+#endif
+    fclose(sim.infile);
+    fclose(sim.outfile);
 
-    fscanf(infile, "%f %f %f %f", &mean_interarrival, &mean_service[0],
-           &mean_service[1], &time_end);
+    return 0;
+}
+#endif
 
-    /* Write report heading and input parameters. */
 
-    fprintf(outfile, "Tandem-server queueing system\n\n");
-    fprintf(outfile, "Mean interarrival time%11.3f minutes\n\n",
-            mean_interarrival);
-    fprintf(outfile, "SRVR1 mean service time%16.3f minutes\n\n", mean_service[0]);
-	fprintf(outfile, "SRVR2 mean service time%16.3f minutes\n\n", mean_service[1]);
-    fprintf(outfile, "Length of the simulation%16.3f minutes\n\n", time_end);
+void setup(sim_t *sim, int stream)  /* Create the queues, the event list
+                                       and the random-number streams of sim,
+                                       which start at stream "stream". */
+{
+    sim->time_arrival[0] = fifo_create(FIFO_DEFAULT, Q_INIT);
+    sim->time_arrival[1] = fifo_create(FIFO_DEFAULT, Q_INIT);
+    fifo_limit(sim->time_arrival[0], Q_LIMIT);
+    fifo_limit(sim->time_arrival[1], Q_LIMIT);
+    sim->event_list = evlist_create(EVLIST_DEFAULT);
+
+    lcg_seed(&sim->expon_rng, stream);
+#ifdef RNG_PHILOX
+    /* The first replication is numbered "stream", which keys its streams. */
+    sim->replication = stream - 1;
+#endif
+#ifdef RNG_PIPELINE
+    {
+        static double (*const unit_gen[])(void *) = { unit_expon };
 
-    int replications = 10;
+        sim->rng_pipe = rngpipe_create(1, unit_gen, sim, 4096);
+    }
+#endif
+#ifdef RNG_PRESAMPLE
+    sim->expon_sample = presample_create(fill_expon, &sim->expon_rng);
+#endif
+#ifdef LINDLEY
+    /* The first replication is numbered "stream", which picks its
+       streams. */
+    sim->replication = stream - 1;
+#endif
+}
 
-    /* Run simulation ten times total */
-    for (int i = 0; i < replications; i++) {
-      /* Initialize the simulation. */
-	
-      initialize();
 
-      /* Run the simulation until the end time is reached */
-      do {
+void run_replication(sim_t *sim)  /* Run one replication of sim, from
+                                     initialization to the end-simulation
+                                     event. */
+{
+    /* Initialize the simulation. */
+    initialize(sim);
+
+    /* Run the simulation until the end time is reached */
+    do {
         /* Determine the next event. */
-        timing();
+        timing(sim);
 
         /* Update time-average statistical accumulators. */
-        update_time_avg_stats();
-
-		/* FIXME log loop information to debug file */
-		fprintf(debugfile, "\nCALL:%d    TIME:%f\n", next_event_type, sim_time);
-    	fprintf(debugfile, "#Q1 :%d    #Q2 :%d\n", num_in_q[0], num_in_q[1]);
-    	fprintf(debugfile, "SRV1:%d    SRV2:%d\n",
-                server_status[0], server_status[1]);
-
+        update_time_avg_stats(sim);
+
+        /* FIXME log loop information to debug file */
+#ifndef SWEEP
+        fprintf(sim->debugfile, "\nCALL:%d    TIME:%f\n", sim->next_event_type,
+                sim->sim_time);
+        fprintf(sim->debugfile, "#Q1 :%d    #Q2 :%d\n", sim->num_in_q[0],
+                sim->num_in_q[1]);
+        fprintf(sim->debugfile, "SRV1:%d    SRV2:%d\n",
+                sim->server_status[0], sim->server_status[1]);
+#endif
 
         /* Invoke the appropriate event function. */
-        switch (next_event_type) 
+        switch (sim->next_event_type)
         {
             case 1:
-                queue1_arrival();
+                queue1_arrival(sim);
                 break;
             case 2:
-                queue1_departure();
+                queue1_departure(sim);
                 break;
             case 3:
-                queue2_arrival();
+                queue2_arrival(sim);
                 break;
             case 4:
-                queue2_departure();
+                queue2_departure(sim);
                 break;
             case 5:
-                report();
+                report(sim);
                 break;
         }
-	  /* If the event just executed was not the end-simulation event, then continue */
-	  } while (next_event_type != 5);
-	}
 
-    fclose(infile);
-    fclose(outfile);
+    /* If the last event was not the end-simulation event, continue */
+    } while (sim->next_event_type != 5);
+}
 
-    return 0;
+
+void teardown(sim_t *sim)  /* Free what setup() created. */
+{
+    evlist_destroy(sim->event_list);
+    fifo_destroy(sim->time_arrival[0]);
+    fifo_destroy(sim->time_arrival[1]);
+#ifdef RNG_PIPELINE
+    rngpipe_destroy(sim->rng_pipe);
+#endif
+#ifdef RNG_PRESAMPLE
+    presample_destroy(sim->expon_sample);
+#endif
 }
 
 
-void initialize(void)  /* Initialization function. */
+#ifdef SWEEP
+/* Parameter sweep, built with -DSWEEP -pthread, pool.c and sweep.c, over
+   the grid in tandem.sweep (see sweep.c).  sweep_point() runs replication
+   rep of point "point" with the parameters param[0..3], from stream rep
+   so that the points are compared on common random numbers, and report
+   writes its row of results to rowfile. */
+
+void sweep_point(const float *param, int point, int rep, FILE *rowfile)
+{
+    sim_t sim;
+
+    sim.mean_interarrival = param[0];
+    sim.mean_service[0]   = param[1];
+    sim.mean_service[1]   = param[2];
+    sim.time_end          = param[3];
+    sim.point             = point;
+    sim.rep               = rep;
+
+    /* No debug log is kept, and errors go to stderr. */
+    sim.infile    = NULL;
+    sim.outfile   = stderr;
+    sim.debugfile = NULL;
+    sim.rowfile   = rowfile;
+
+    setup(&sim, rep);
+    run_replication(&sim);
+    teardown(&sim);
+}
+#endif
+
+
+#ifdef LINDLEY
+/* Recursion engine, built with -DLINDLEY.  Both stations are FIFO single
+   servers and every customer passes through both, so the times at which
+   customer k starts and ends service follow from the interarrival and
+   service times alone, by the tandem (max-plus) recursion
+       D[k][1] = max(A[k], D[k-1][1]) + S[k][1],
+       D[k][2] = max(D[k][1], D[k-1][2]) + S[k][2],
+   where A[k] is its arrival time, S[k][j] its service time and D[k][j]
+   its departure time at server j.  lindley() runs a replication this way,
+   without an event list, LINDLEY_BLOCK customers at a time.  It draws the
+   interarrival time and both service times of every customer of the block,
+   in one pass over each stream; it then runs the recursion, in which
+   nothing is drawn, and last adds up the statistics, clipping each
+   customer's times at time_end rather than branching.  It counts as the
+   event functions do: a customer who finds the second server idle is not
+   counted as delayed, events at the same time happen in order of event
+   type, and nothing after time_end counts.  The recursion draws times for
+   customers the event functions never serve, so rather than carry its
+   streams over, replication r starts afresh on streams 3r - 2, 3r - 1 and
+   3r of lcgrand, for the interarrival times and the service times at each
+   server (see lindley_streams).  lcgrand has 100 streams, enough for 33
+   replications, and more are refused.  The statistics are summed in
+   double rather than in the float accumulators, and so differ from those
+   of the event functions only by rounding; with -DLINDLEY_CHECK every
+   replication is also simulated with events and the two compared (see
+   check_lindley).  Only then do the event functions draw from the same
+   streams, through variate(), so that both engines give each customer
+   the same times.  A queue limit (Q_LIMIT) needs the events and is
+   refused. */
+
+#define LINDLEY_BLOCK 512  /* Customers whose times are drawn at once. */
+
+void run_lindley(sim_t *sim, int replications)  /* Run the replications by
+                                                   the recursion. */
+{
+    int   i;
+#ifdef LINDLEY_CHECK
+    sim_t check = *sim;
+
+    /* The event functions' reports are not wanted. */
+    check.outfile = tmpfile();
+    if (check.outfile == NULL) {
+        fprintf(stderr, "\nrun_lindley: cannot create temporary file\n");
+        exit(2);
+    }
+    setup(&check, 1);
+#endif
+
+    setup(sim, 1);
+    for (i = 0; i < replications; i++) {
+        lindley(sim);
+#ifdef LINDLEY_CHECK
+        run_replication(&check);
+        check_lindley(sim, &check, i + 1);
+#endif
+    }
+    teardown(sim);
+
+#ifdef LINDLEY_CHECK
+    teardown(&check);
+    fclose(check.outfile);
+#endif
+}
+
+
+void lindley(sim_t *sim)  /* Run one replication by the recursion and
+                             report it. */
+{
+    double x[LINDLEY_BLOCK], delays = 0.0,
+           area_num_in_q[2] = { 0.0, 0.0 },
+           area_server_status[2] = { 0.0, 0.0 };
+    float  arrival[LINDLEY_BLOCK], service[2][LINDLEY_BLOCK],
+           start[2][LINDLEY_BLOCK], depart[2][LINDLEY_BLOCK],
+           end = sim->time_end, mean_interarrival = sim->mean_interarrival,
+           mean_service[2] = { sim->mean_service[0], sim->mean_service[1] },
+           last = 0.0, prior1 = -1.0, prior2 = -1.0;
+    int    queued[LINDLEY_BLOCK], num_custs_delayed = 0, i, n;
+
+    lindley_streams(sim);
+    do {
+        /* Draw the interarrival and service times of the next block of
+           customers, scaled as variate() scales them. */
+        fill_expon(&sim->expon_rng, x, LINDLEY_BLOCK);
+        for (i = 0; i < LINDLEY_BLOCK; ++i)
+            arrival[i] = mean_interarrival * x[i];
+        fill_expon(&sim->service_rng[0], x, LINDLEY_BLOCK);
+        for (i = 0; i < LINDLEY_BLOCK; ++i)
+            service[0][i] = mean_service[0] * x[i];
+        fill_expon(&sim->service_rng[1], x, LINDLEY_BLOCK);
+        for (i = 0; i < LINDLEY_BLOCK; ++i)
+            service[1][i] = mean_service[1] * x[i];
+
+        /* Turn them into arrival times, up to the first after the end. */
+        for (n = 0; n < LINDLEY_BLOCK; ++n) {
+            last += arrival[n];
+            if (last > end)
+                break;
+            arrival[n] = last;
+        }
+
+        /* The recursion, prior1 and prior2 being the departure times of
+           the previous customer from each server (-1 if none).  A
+           customer waits in the second queue if it finds the server busy
+           until then or later, as the first server's departure event
+           comes first. */
+        for (i = 0; i < n; ++i) {
+            start[0][i]  = arrival[i] > prior1 ? arrival[i] : prior1;
+            depart[0][i] = start[0][i] + service[0][i];
+            queued[i]    = prior2 >= depart[0][i];
+            start[1][i]  = queued[i] ? prior2 : depart[0][i];
+            depart[1][i] = start[1][i] + service[1][i];
+            prior1 = depart[0][i];
+            prior2 = depart[1][i];
+        }
+
+        /* What each customer adds to the statistics up to the end: its
+           time in each queue and at each server, and its delays in queue
+           if it starts service by the end. */
+        for (i = 0; i < n; ++i) {
+            float in1  = start[0][i]  < end ? start[0][i]  : end,
+                  out1 = depart[0][i] < end ? depart[0][i] : end,
+                  in2  = start[1][i]  < end ? start[1][i]  : end,
+                  out2 = depart[1][i] < end ? depart[1][i] : end,
+                  wait2 = in2 - depart[0][i];
+            int   served1 = start[0][i] <= end, served2 = start[1][i] <= end;
+
+            area_num_in_q[0]      += in1 - arrival[i];
+            area_num_in_q[1]      += wait2 > 0.0 ? wait2 : 0.0;
+            area_server_status[0] += out1 - in1;
+            area_server_status[1] += out2 - in2;
+            delays += (served1 ? start[0][i] - arrival[i] : 0.0)
+                      + (served2 ? start[1][i] - depart[0][i] : 0.0);
+            num_custs_delayed += served1 + (served2 & queued[i]);
+        }
+    } while (n == LINDLEY_BLOCK);
+
+    /* Report as the end-simulation event would. */
+    sim->sim_time              = end;
+    sim->total_of_delays       = delays;
+    sim->num_custs_delayed     = num_custs_delayed;
+    sim->area_num_in_q[0]      = area_num_in_q[0];
+    sim->area_num_in_q[1]      = area_num_in_q[1];
+    sim->area_server_status[0] = area_server_status[0];
+    sim->area_server_status[1] = area_server_status[1];
+    report(sim);
+}
+
+
+void lindley_streams(sim_t *sim)  /* Number the next replication r and seed
+                                     its streams 3r - 2, 3r - 1 and 3r. */
+{
+    int r = ++sim->replication;
+
+    if (3 * r > 100) {
+        fprintf(stderr, "\nReplication %d needs lcgrand streams past 100\n",
+                r);
+        exit(1);
+    }
+    lcg_seed(&sim->expon_rng, 3 * r - 2);
+    lcg_seed(&sim->service_rng[0], 3 * r - 1);
+    lcg_seed(&sim->service_rng[1], 3 * r);
+}
+#endif
+
+
+#ifdef LINDLEY_CHECK
+/* Compare replication r as computed by the recursion (sim) and by the
+   event functions (check).  The numbers of customers delayed must agree
+   exactly, and the estimates of report() to within LINDLEY_TOL relative to
+   the larger; otherwise stop. */
+
+#define LINDLEY_TOL 1.0e-4
+
+void check_lindley(const sim_t *sim, const sim_t *check, int r)
+{
+    double a[5], b[5], diff, worst = 0.0;
+    int    i;
+
+    /* With no customer delayed, the average delay is taken as 0, which
+       matches only another 0. */
+    a[0] = sim->num_custs_delayed == 0 ? 0.0
+         : sim->total_of_delays / sim->num_custs_delayed;
+    b[0] = check->num_custs_delayed == 0 ? 0.0
+         : check->total_of_delays / check->num_custs_delayed;
+    for (i = 0; i < 2; ++i) {
+        a[1 + i] = sim->area_num_in_q[i] / sim->sim_time;
+        b[1 + i] = check->area_num_in_q[i] / check->sim_time;
+        a[3 + i] = sim->area_server_status[i] / sim->sim_time;
+        b[3 + i] = check->area_server_status[i] / check->sim_time;
+    }
+    for (i = 0; i < 5; ++i) {
+        /* Equal values, both zeros included, differ by 0; a zero against
+           anything else differs by 1.  A NaN is kept as the worst, and
+           fails. */
+        diff = fabs(a[i] - b[i]);
+        if (diff > 0.0)
+            diff /= fabs(a[i]) > fabs(b[i]) ? fabs(a[i]) : fabs(b[i]);
+        if (!(diff <= worst))
+            worst = diff;
+    }
+
+    fprintf(stderr, "Replication %2d: %d customers delayed, largest "
+                    "relative difference %.2e\n", r, sim->num_custs_delayed,
+            worst);
+    if (sim->num_custs_delayed != check->num_custs_delayed
+        || !(worst <= LINDLEY_TOL)) {
+        fprintf(stderr, "\nRecursion and event functions disagree on "
+                        "replication %d (%d and %d customers delayed)\n", r,
+                sim->num_custs_delayed, check->num_custs_delayed);
+        exit(1);
+    }
+}
+#endif
+
+
+#ifdef PARALLEL_REPS
+/* Parallel replications, built with -DPARALLEL_REPS -pthread and reps.c.
+   Replication r (r = 1, 2, ...) gets a sim_t of its own, set up to start
+   at stream r of each generator (lcgrand has 100) or, with RNG_PHILOX, to
+   be numbered r, so its results do not depend on which thread runs it or
+   when, and reps_run merges the reports and debug logs in replication
+   order: the output is the same for any number of threads.  replicate()
+   runs replication r of the simulation (sim_t *) arg, writing its report
+   to outfile and its debug log to debugfile. */
+
+void replicate(void *arg, int r, FILE *outfile, FILE *debugfile)
+{
+    sim_t sim = *(const sim_t *) arg;
+
+    sim.outfile   = outfile;
+    sim.debugfile = debugfile;
+    setup(&sim, r);
+    run_replication(&sim);
+    teardown(&sim);
+}
+#endif
+
+
+#ifdef LOCKSTEP
+/* Run the replications LANES at a time, reporting them in order. */
+
+void run_lockstep(const sim_t *base, int replications)
+{
+    lanes_t *b = malloc(sizeof(lanes_t));
+    sim_t    sim = *base;
+    int      l, first;
+
+    if (b == NULL) {
+        fprintf(stderr, "\nrun_lockstep: out of memory\n");
+        exit(3);
+    }
+    for (l = 0; l < LANES; ++l) {
+        b->time_arrival[0][l] = fifo_create(FIFO_DEFAULT, Q_INIT);
+        b->time_arrival[1][l] = fifo_create(FIFO_DEFAULT, Q_INIT);
+        fifo_limit(b->time_arrival[0][l], Q_LIMIT);
+        fifo_limit(b->time_arrival[1][l], Q_LIMIT);
+    }
+
+    for (first = 1; first <= replications; first += LANES) {
+        run_lanes(b, base, first, replications - first + 1 < LANES
+                                  ? replications - first + 1 : LANES);
+
+        /* Report the block's replications in order, through report(). */
+        for (l = 0; l < LANES && first + l <= replications; ++l) {
+            sim.sim_time              = b->sim_time[l];
+            sim.area_num_in_q[0]      = b->area_num_in_q[0][l];
+            sim.area_num_in_q[1]      = b->area_num_in_q[1][l];
+            sim.area_server_status[0] = b->area_server_status[0][l];
+            sim.area_server_status[1] = b->area_server_status[1][l];
+            sim.num_custs_delayed     = b->num_custs_delayed[l];
+            sim.total_of_delays       = b->total_of_delays[l];
+            report(&sim);
+        }
+    }
+
+    for (l = 0; l < LANES; ++l) {
+        fifo_destroy(b->time_arrival[0][l]);
+        fifo_destroy(b->time_arrival[1][l]);
+    }
+    free(b);
+}
+
+
+/* Run replications first, ..., first + n - 1 (at most LANES of them) in
+   the lanes of b until each has reached its end-simulation event. */
+
+void run_lanes(lanes_t *b, const sim_t *sim, int first, int n)
+{
+    lcg_t g;
+    float end = sim->time_end, mean_interarrival = sim->mean_interarrival,
+          mean_service[2] = { sim->mean_service[0], sim->mean_service[1] };
+    int   l, i, left;
+
+    /* Initialize the lanes as initialize() does a simulation. */
+    for (l = 0; l < LANES; ++l) {
+        lcg_seed(&g, l < n ? first + l : 1);
+        b->z[l]    = (int) lcg_save(&g);
+        b->done[l] = l >= n;
+        b->need[l] = l < n;
+        b->mean[l] = mean_interarrival;
+
+        b->sim_time[l] = b->time_last_event[l] = 0.0;
+        b->num_in_q[0][l] = b->num_in_q[1][l] = 0;
+        b->server_status[0][l] = b->server_status[1][l] = IDLE;
+        b->area_num_in_q[0][l] = b->area_num_in_q[1][l] = 0.0;
+        b->area_server_status[0][l] = b->area_server_status[1][l] = 0.0;
+        b->num_custs_delayed[l] = 0;
+        b->total_of_delays[l]   = 0.0;
+        fifo_clear(b->time_arrival[0][l]);
+        fifo_clear(b->time_arrival[1][l]);
+        b->time_next_departure[0][l] = b->time_next_departure[1][l]
+                                     = 1.0e+30;
+    }
+    draw_lanes(b, 0);
+    for (l = 0; l < LANES; ++l)
+        b->time_next_arrival[l] = b->x[0][l];
+
+    for (left = n; left > 0; ) {
+        /* Determine each lane's next event, with ties going to the lower
+           event type as in evlist, and update its time averages.  Type 3
+           is never pending: a customer arrives at the second queue at
+           once. */
+        for (l = 0; l < LANES; ++l) {
+            float t = b->time_next_arrival[l], dt;
+            int   type = 1;
+
+            type = b->time_next_departure[0][l] < t ? 2 : type;
+            t    = b->time_next_departure[0][l] < t
+                   ? b->time_next_departure[0][l] : t;
+            type = b->time_next_departure[1][l] < t ? 4 : type;
+            t    = b->time_next_departure[1][l] < t
+                   ? b->time_next_departure[1][l] : t;
+            type = end < t ? 5 : type;
+            t    = end < t ? end : t;
+            t    = b->done[l] ? b->sim_time[l] : t;
+
+            dt = t - b->time_last_event[l];
+            b->area_num_in_q[0][l]      += b->num_in_q[0][l] * dt;
+            b->area_num_in_q[1][l]      += b->num_in_q[1][l] * dt;
+            b->area_server_status[0][l] += b->server_status[0][l] * dt;
+            b->area_server_status[1][l] += b->server_status[1][l] * dt;
+            b->time_last_event[l] = t;
+            b->sim_time[l]        = t;
+            b->next_event_type[l] = b->done[l] ? 0 : type;
+        }
+
+        /* Turn each lane's event into masks, as the event functions would
+           decide: an arrival joins the first queue or starts service, a
+           departure from a server serves the next in its queue or leaves
+           the server idle, and a customer leaving the first server goes
+           on to the second queue. */
+        for (l = 0; l < LANES; ++l) {
+            int type = b->next_event_type[l],
+                q0 = b->num_in_q[0][l], q1 = b->num_in_q[1][l],
+                s0 = b->server_status[0][l], s1 = b->server_status[1][l],
+                move = type == 2;
+
+            b->join[0][l]  = (type == 1) & (s0 == BUSY);
+            b->start[0][l] = (type == 1) & (s0 == IDLE);
+            b->serve[0][l] = (type == 2) & (q0 > 0);
+            b->idle[0][l]  = (type == 2) & (q0 == 0);
+            b->join[1][l]  = move & (s1 == BUSY);
+            b->start[1][l] = move & (s1 == IDLE);
+            b->serve[1][l] = (type == 4) & (q1 > 0);
+            b->idle[1][l]  = (type == 4) & (q1 == 0);
+        }
+
+        /* Draw, in the order the event functions would, the service or
+           interarrival time each lane's event starts with ... */
+        for (l = 0; l < LANES; ++l) {
+            int type = b->next_event_type[l];
+
+            b->need[l] = (type == 1) | b->serve[0][l] | b->serve[1][l];
+            b->mean[l] = type == 1 ? mean_interarrival
+                       : type == 2 ? mean_service[0] : mean_service[1];
+        }
+        draw_lanes(b, 0);
+
+        /* ... and the service time that a customer reaching an idle
+           server then starts. */
+        for (l = 0; l < LANES; ++l) {
+            b->need[l] = b->start[0][l] | b->start[1][l];
+            b->mean[l] = b->start[0][l] ? mean_service[0] : mean_service[1];
+        }
+        draw_lanes(b, 1);
+
+        /* Push and pop the times of arrival, lane by lane ... */
+        queue_lanes(b);
+
+        /* ... and carry out the rest of the events in every lane at
+           once. */
+        for (i = 0; i < 2; ++i) {
+            for (l = 0; l < LANES; ++l) {
+                int start = b->start[i][l], idle = b->idle[i][l],
+                    status = b->server_status[i][l];
+
+                b->num_in_q[i][l]     += b->join[i][l] - b->serve[i][l];
+                b->server_status[i][l] = start ? BUSY : idle ? IDLE : status;
+            }
+            for (l = 0; l < LANES; ++l) {
+                int   start = b->start[i][l], serve = b->serve[i][l],
+                      idle  = b->idle[i][l];
+                float x0 = b->x[0][l], x1 = b->x[1][l],
+                      next = b->time_next_departure[i][l];
+
+                b->time_next_departure[i][l] = start ? x1 : serve ? x0
+                                             : idle  ? 1.0e+30f : next;
+            }
+        }
+        for (l = 0; l < LANES; ++l) {
+            int   type = b->next_event_type[l];
+            float x0   = b->x[0][l], next = b->time_next_arrival[l];
+
+            b->time_next_arrival[l]  = type == 1 ? x0 : next;
+            b->total_of_delays[l]   += b->delay[l];
+            b->num_custs_delayed[l] += b->start[0][l] + b->serve[0][l]
+                                       + b->serve[1][l];
+            left       -= type == 5;
+            b->done[l] |= type == 5;
+        }
+    }
+}
+
+
+void draw_lanes(lanes_t *b, int k)  /* Set x[k][l] to sim_time[l] plus an
+                                       exponential variate of mean mean[l],
+                                       the time of the event it schedules,
+                                       for each lane l with need[l] set. */
+{
+    int l;
+
+    lcg_draw_lanes(b->z, b->need, b->u, LANES);
+    for (l = 0; l < LANES; ++l)
+        if (b->need[l])
+            b->x[k][l] = b->sim_time[l]
+                         + (float) (-b->mean[l] * log(b->u[l]));
+}
+
+
+void queue_lanes(lanes_t *b)  /* Store the time of arrival of each customer
+                                 joining a queue, and set delay[l] to the
+                                 delay of the customer served from a queue
+                                 in lane l, or to 0. */
+{
+    int l, i;
+
+    for (l = 0; l < LANES; ++l) {
+        float t = b->sim_time[l];
+
+        b->delay[l] = 0.0;
+        for (i = 0; i < 2; ++i) {
+            if (b->join[i][l] && fifo_push(b->time_arrival[i][l], t)) {
+                fprintf(stderr, "\nOverflow of array time_arrival %d at",
+                        i + 1);
+                fprintf(stderr, " time %f \n\n", t);
+                exit(2);
+            }
+            if (b->serve[i][l])
+                b->delay[l] = t - fifo_pop(b->time_arrival[i][l]);
+        }
+    }
+}
+#endif
+
+
+void initialize(sim_t *sim)  /* Initialization function. */
 {
 	int i;
 
     /* Initialize the simulation clock. */
-    sim_time = 0.0;
+    sim->sim_time = 0.0;
 
     /* Initialize the state variables and statistical counters. */
 	for (i = 0; i < 2; i++) {
-        server_status[i]      = IDLE;		
-        num_in_q[i]           = 0;
-        area_num_in_q[i]      = 0.0;
-        area_server_status[i] = 0.0;
+        sim->server_status[i]      = IDLE;		
+        sim->num_in_q[i]           = 0;
+        sim->area_num_in_q[i]      = 0.0;
+        sim->area_server_status[i] = 0.0;
 	}
 
-    num_custs_delayed  = 0;
-    total_of_delays    = 0.0;
-    time_last_event    = 0.0;
+    sim->num_custs_delayed  = 0;
+    sim->total_of_delays    = 0.0;
+    sim->time_last_event    = 0.0;
+
+#ifdef RNG_PHILOX
+    /* Start the new replication's own streams from counter 0. */
+    ++sim->replication;
+    sim->rng_counter[1] = 0;
+    sim->rng_counter[2] = 0;
+#endif
+
+#ifdef LINDLEY_CHECK
+    /* Start the new replication's own streams, as lindley() does. */
+    lindley_streams(sim);
+#endif
+
+#ifdef RNG_PRESAMPLE
+    /* Sample what the replication is expected to use, with 5% to spare:
+       each customer takes an interarrival time and two service times. */
+    presample_reserve(sim->expon_sample,
+                      (int) (3.15 * sim->time_end / sim->mean_interarrival)
+                      + 64);
+#endif
+
+    fifo_clear(sim->time_arrival[0]);
+    fifo_clear(sim->time_arrival[1]);
 
     /* Initialize event list.  Since no customers are present, the departure
-       (service completion) and tandem switch events are eliminated from consideration. */
-    time_next_event[1] = sim_time + expon(mean_interarrival);
-    time_next_event[2] = 1.0e+30;
-    time_next_event[3] = 1.0e+30;
-    time_next_event[4] = 1.0e+30;
-    time_next_event[5] = time_end;
+       (service completion) and tandem switch events are not scheduled. */
+    evlist_clear(sim->event_list);
+    for (i = 1; i <= 5; ++i)
+        sim->event_handle[i] = EVLIST_NONE;
+
+    schedule(sim, 1, sim->sim_time + variate(sim, INTERARRIVAL));
+    schedule(sim, 5, sim->time_end);
 }
 
 
-void timing(void)  /* Timing function. */
+void timing(sim_t *sim)  /* Timing function. */
 {
-    int   i;
-    float min_time_next_event = 1.0e+29;
+    float time;
 
-    next_event_type = 0;
-
-    /* Determine the event type of the next event to occur. */
-    for (i = 1; i <= num_events; ++i)
-        if (time_next_event[i] < min_time_next_event)
-        {   
-            min_time_next_event = time_next_event[i];
-            next_event_type     = i;
-        }
+    /* Remove the next event to occur from the event list. */
+    sim->next_event_type = evlist_pop(sim->event_list, &time);
 
     /* Check to see whether the event list is empty. */
-    if (next_event_type == 0)
+    if (sim->next_event_type == 0)
     {
         /* The event list is empty, so stop the simulation. */
-        fprintf(outfile, "\nEvent list empty at time %f", sim_time);
+        fprintf(sim->outfile, "\nEvent list empty at time %f", sim->sim_time);
         exit(1);
     }
 
     /* The event list is not empty, so advance the simulation clock. */
-    sim_time = min_time_next_event;
+    sim->event_handle[sim->next_event_type] = EVLIST_NONE;
+    sim->sim_time = time;
 }
 
 
-void queue1_arrival(void)  /* Arrive in the system (queue one) */
+void schedule(sim_t *sim, int type, float time)  /* Schedule the pending
+                                                    event of type "type" to
+                                                    occur at time "time". */
+{
+    if (sim->event_handle[type] == EVLIST_NONE)
+        sim->event_handle[type] = evlist_schedule(sim->event_list, type, time);
+    else
+        sim->event_handle[type] = evlist_reschedule(sim->event_list,
+                                                    sim->event_handle[type],
+                                                    time);
+}
+
+
+void cancel(sim_t *sim, int type)  /* Remove the pending event of type
+                                      "type", if any. */
+{
+    if (sim->event_handle[type] != EVLIST_NONE) {
+        evlist_cancel(sim->event_list, sim->event_handle[type]);
+        sim->event_handle[type] = EVLIST_NONE;
+    }
+}
+
+
+void queue1_arrival(sim_t *sim)  /* Arrive in the system (queue one) */
 {
     float delay;
 
     /* Schedule next arrival. */
-    time_next_event[1] = sim_time + expon(mean_interarrival);
+    schedule(sim, 1, sim->sim_time + variate(sim, INTERARRIVAL));
 
     /* Check to see whether server is busy. */
-    if (server_status[0] == BUSY) {
+    if (sim->server_status[0] == BUSY) {
         /* Server is busy, so increment number of customers in the first queue. */
-        ++num_in_q[0];
-
-        /* Check to see whether an overflow condition exists. */
-        if (num_in_q[0] > Q_LIMIT) {
-            /* The queue has overflowed, so stop the simulation. */
-            fprintf(outfile, "\nOverflow of the first array time_arrival at");
-            fprintf(outfile, " time %f \n\n", sim_time);
+        ++sim->num_in_q[0];
+
+        /* Store the time of arrival of the arriving customer at the tail of
+           time_arrival[0], which grows as needed unless Q_LIMIT is set. */
+        if (fifo_push(sim->time_arrival[0], sim->sim_time)) {
+            /* The queue has reached Q_LIMIT, so stop the simulation. */
+            fprintf(sim->outfile,
+                    "\nOverflow of the first array time_arrival at");
+            fprintf(sim->outfile, " time %f \n\n", sim->sim_time);
             exit(2);
         }
-
-        /* There is still room in the queue, so store the time of arrival of the
-           arriving customer at the (new) end of time_arrival. */
-        time_arrival[num_in_q[0]] = sim_time;
     }
 
     else {
         /* Server is idle, so arriving customer has a delay of zero.*/
         delay            = 0.0;
-        total_of_delays += delay;
+        sim->total_of_delays += delay;
 
         /* Increment the number of customers delayed, and make server busy. */
-        ++num_custs_delayed;
-        server_status[0] = BUSY;
+        ++sim->num_custs_delayed;
+        sim->server_status[0] = BUSY;
 
         /* Schedule arrival at the second queue */
-        time_next_event[2] = sim_time + expon(mean_service[0]);
+        schedule(sim, 2, sim->sim_time + variate(sim, SERVICE1));
     }
 }
 
@@ -205,169 +1009,255 @@ void queue1_arrival(void)  /* Arrive in the system (queue one) */
 /* Tandem-queue switching function. Removes the customer from the first service
    queue, then adds the customer to the second service queue and schedules departure */
 
-void queue1_departure(void) 
+void queue1_departure(sim_t *sim) 
 {
-	int i;
 	float delay;
 
 	/* Check to see whether the first queue is empty */
-	if (num_in_q[0] == 0) {
+	if (sim->num_in_q[0] == 0) {
 		/* The first queue is empty so make the server idle */
-		server_status[0]   = IDLE;
-		time_next_event[2] = 1.0e+30;
+		sim->server_status[0]   = IDLE;
+		cancel(sim, 2);
 	}
 	
 	/* Decrement the number of customers in the first queue. */
 	else {
-		--num_in_q[0];
+		--sim->num_in_q[0];
 
         /* Compute the delay of the customer who is beginning service and update
            the total delay accumulator. */
-        delay            = sim_time - time_arrival[1];
-        total_of_delays += delay;
+        delay            = sim->sim_time - fifo_pop(sim->time_arrival[0]);
+        sim->total_of_delays += delay;
 
 		/* Increment number of customers delayed */
-		++num_custs_delayed;
-		server_status[0] = BUSY;
+		++sim->num_custs_delayed;
+		sim->server_status[0] = BUSY;
 
-		/* Schedule another queue 1 departure and arrival at queue 2 */
-		time_next_event[2] = sim_time + expon(mean_service[0]);
-		queue2_arrival();
-
-        /* Move each customer in queue (if any) up one place. */
-        for (i = 1; i <= num_in_q[0]; ++i)
-            time_arrival[i] = time_arrival[i + 1];
+		/* Schedule another queue 1 departure */
+		schedule(sim, 2, sim->sim_time + variate(sim, SERVICE1));
 
 		/* FIXME logging to debug file */		
 		//fprintf(debugfile, "SCHEDULING 2 | time:%f\n", time_next_event[2]);		
 	}
 
+	/* The departing customer arrives at the second queue. */
+	queue2_arrival(sim);
 }
 
-void queue2_arrival(void) /* Arrive at the second queue */
+void queue2_arrival(sim_t *sim) /* Arrive at the second queue */
 {
-	float delay;
+	float delay, time_departure;
 
 	/* Wait for the next arrival afterward*/
-	time_next_event[3] = 1.0e+30;
+	cancel(sim, 3);
 
 	/* Check to see whether the second server is busy. */
-	if (server_status[1] == BUSY) {
+	if (sim->server_status[1] == BUSY) {
 		/* Second server is busy, so increment the number of customers in
 		 * the second queue. */
-		++num_in_q[1];
-
-		if (num_in_q[1] > Q_LIMIT) {
-			/* The second queue has overflowed; stop the simulation. */	
-            fprintf(outfile, "\nOverflow of the second array time_arrival at");
-            fprintf(outfile, " time %f \n\n", sim_time);
+		++sim->num_in_q[1];
+
+		/* Store the time of arrival of the switching customer at the tail
+		 * of time_arrival[1]. */
+		if (fifo_push(sim->time_arrival[1], sim->sim_time)) {
+			/* The second queue has reached Q_LIMIT; stop the simulation. */
+            fprintf(sim->outfile,
+                    "\nOverflow of the second array time_arrival at");
+            fprintf(sim->outfile, " time %f \n\n", sim->sim_time);
             exit(2);
 		}
-
-		/* There is still room in the queue, so so store the time of arrival of the
-		 * switching customer at the end of the second_time_arrival array.  */
-		second_time_arrival[num_in_q[1]] = sim_time;
 	}
 
 	else {
 		/* Second server is idle; current customer has delay of 0 */
 		delay			 = 0.0;
-		total_of_delays += delay;
+		sim->total_of_delays += delay;
 
 		/* Make second server busy, but do not increment number of customers delayed */
-		server_status[1] = BUSY;
+		sim->server_status[1] = BUSY;
 
 		/* Schedule system departure for the current customer*/
-		time_next_event[4] = sim_time + expon(mean_service[1]);
+		time_departure = sim->sim_time + variate(sim, SERVICE2);
+		schedule(sim, 4, time_departure);
 
 		/* FIXME logging to debug file */
-		fprintf(debugfile, "SCHEDULING 4 | time:%f\n", time_next_event[4]);
+#ifndef SWEEP
+		fprintf(sim->debugfile, "SCHEDULING 4 | time:%f\n", time_departure);
+#endif
 	}
 }
 
-void queue2_departure(void)  /* Departure event function. */
+void queue2_departure(sim_t *sim)  /* Departure event function. */
 {
-    int   i;
     float delay;
 
     /* Check to see whether the queue is empty. */
-    if (num_in_q[1] == 0) {
+    if (sim->num_in_q[1] == 0) {
         /* The queue is empty so make the server idle and eliminate the
            departure (service completion) event from consideration. */
-        server_status[1]      = IDLE;
-        time_next_event[4]    = 1.0e+30;
+        sim->server_status[1]      = IDLE;
+        cancel(sim, 4);
     }
 
     else {
         /* The queue is nonempty, so decrement the number of customers in
            queue. */
-        --num_in_q[1];
+        --sim->num_in_q[1];
 
         /* Compute the delay of the customer who is beginning service and update
            the total delay accumulator. */
-        delay            = sim_time - second_time_arrival[1];
-        total_of_delays += delay;
+        delay            = sim->sim_time - fifo_pop(sim->time_arrival[1]);
+        sim->total_of_delays += delay;
 
         /* Increment the number of customers delayed, and schedule departure. */
-        ++num_custs_delayed;
+        ++sim->num_custs_delayed;
 
 		/* Make server busy and schedule departure */
-		server_status[1]   = BUSY;
-        time_next_event[4] = sim_time + expon(mean_service[1]);
-
-        /* Move each customer in queue (if any) up one place. */
-        for (i = 1; i <= num_in_q[1]; ++i)
-            second_time_arrival[i] = second_time_arrival[i + 1];
+		sim->server_status[1]   = BUSY;
+        schedule(sim, 4, sim->sim_time + variate(sim, SERVICE2));
     }
 }
 
 
-void report(void)  /* Report generator function. */
+void report(sim_t *sim)  /* Report generator function. */
 {
+#ifdef SWEEP
+    /* Write the estimates as one row of the sweep's results, whole and at
+       once, since other threads write rows to the same file. */
+    flockfile(sim->rowfile);
+    fprintf(sim->rowfile, "%d,%d,%g,%g,%g,%g,%.6g,%.6g,%.6g,%.6g,%.6g,%.6g\n",
+            sim->point, sim->rep, sim->mean_interarrival,
+            sim->mean_service[0], sim->mean_service[1], sim->time_end,
+            sim->total_of_delays / sim->num_custs_delayed,
+            sim->area_num_in_q[0] / sim->sim_time,
+            sim->area_num_in_q[1] / sim->sim_time,
+            sim->area_server_status[0] / sim->sim_time,
+            sim->area_server_status[1] / sim->sim_time, sim->sim_time);
+    fflush(sim->rowfile);
+    funlockfile(sim->rowfile);
+#else
     /* Compute and write estimates of desired measures of performance. */
 
-    fprintf(outfile, "\n\nAverage delay in system  :%10.3f minutes\n\n",
-            total_of_delays / num_custs_delayed);
-    fprintf(outfile, "Average number in queue 1:%10.3f\n",
-            area_num_in_q[0] / sim_time);
-    fprintf(outfile, "Average number in queue 2:%10.3f\n\n",
-            area_num_in_q[1] / sim_time);
+    fprintf(sim->outfile, "\n\nAverage delay in system  :%10.3f minutes\n\n",
+            sim->total_of_delays / sim->num_custs_delayed);
+    fprintf(sim->outfile, "Average number in queue 1:%10.3f\n",
+            sim->area_num_in_q[0] / sim->sim_time);
+    fprintf(sim->outfile, "Average number in queue 2:%10.3f\n\n",
+            sim->area_num_in_q[1] / sim->sim_time);
 
     // NEW PRINTS
-    fprintf(outfile, "Average number in transit:%10.3f minutes\n", 1.00);
-    fprintf(outfile, "Maximum number in transit:%10.3f minutes\n\n", 1.00);
+    fprintf(sim->outfile, "Average number in transit:%10.3f minutes\n", 1.00);
+    fprintf(sim->outfile, "Maximum number in transit:%10.3f minutes\n\n", 1.00);
 
 
-    fprintf(outfile, "SRVR1 utilization  :%7.3f\n",
-            area_server_status[0] / sim_time);
-    fprintf(outfile, "SRVR2 utilization  :%7.3f\n\n",
-            area_server_status[1] / sim_time);
-    fprintf(outfile, "Simulation end time:%12.3f minutes\n\n", sim_time);
+    fprintf(sim->outfile, "SRVR1 utilization  :%7.3f\n",
+            sim->area_server_status[0] / sim->sim_time);
+    fprintf(sim->outfile, "SRVR2 utilization  :%7.3f\n\n",
+            sim->area_server_status[1] / sim->sim_time);
+    fprintf(sim->outfile, "Simulation end time:%12.3f minutes\n\n",
+            sim->sim_time);
+#endif
 }
 
 
-void update_time_avg_stats(void)  /* Update area accumulators for time-average
-                                     statistics. */
+void update_time_avg_stats(sim_t *sim)  /* Update area accumulators for
+                                           time-average statistics. */
 {
 	int   i;
     float time_since_last_event;
 
     /* Compute time since last event, and update last-event-time marker. */
-    time_since_last_event = sim_time - time_last_event;
-    time_last_event       = sim_time;
+    time_since_last_event = sim->sim_time - sim->time_last_event;
+    sim->time_last_event  = sim->sim_time;
 
     /* Update area under number-in-queue and server-busy indicator function. */
 	for(i = 0; i < 2; i++) {
-    	area_num_in_q[i]      += num_in_q[i] * time_since_last_event;
-    	area_server_status[i] += server_status[i] * time_since_last_event;
+    	sim->area_num_in_q[i]      += sim->num_in_q[i] * time_since_last_event;
+    	sim->area_server_status[i] += sim->server_status[i]
+    	                              * time_since_last_event;
 	}
 }
 
 
-float expon(float mean)  /* Exponential variate generation function. */
+float variate(sim_t *sim, int k)  /* Next interarrival time (k is
+                                     INTERARRIVAL) or service time at server
+                                     k (SERVICE1 or SERVICE2). */
+{
+    float mean = k == INTERARRIVAL ? sim->mean_interarrival
+                                   : sim->mean_service[k - 1];
+
+#ifdef LINDLEY_CHECK
+    lcg_t *g = k == INTERARRIVAL ? &sim->expon_rng : &sim->service_rng[k - 1];
+
+    /* Draw as fill_expon does for lindley(). */
+#ifdef FAST_EXPON
+    return zig_draw(g, mean);
+#else
+    return -mean * log(lcg_draw(g));
+#endif
+#else
+    return expon(sim, mean);
+#endif
+}
+
+
+float expon(sim_t *sim, float mean)  /* Exponential variate generation
+                                        function. */
 {
     /* Return an exponential random variate with mean "mean". */
 
-    return -mean * log(lcgrand(1));
+#if defined(RNG_PIPELINE)
+    return mean * rngpipe_next(sim->rng_pipe, 0);
+#elif defined(RNG_PRESAMPLE)
+    return mean * presample_next(sim->expon_sample);
+#elif defined(RNG_PHILOX)
+    return -mean * log(philox_u01(1, sim->replication, sim->rng_counter[1]++));
+#elif defined(FAST_EXPON)
+    return zig_draw(&sim->expon_rng, mean);
+#else
+    return -mean * log(lcg_draw(&sim->expon_rng));
+#endif
 }
 
+
+#ifdef RNG_PIPELINE
+double unit_expon(void *arg)  /* Exponential variate of mean 1 for the sim_t
+                                 arg, which expon scales to exactly what it
+                                 would have made. */
+{
+    sim_t *sim = arg;
+
+#ifdef FAST_EXPON
+    return zig_unit(&sim->expon_rng);
+#else
+    return -log(lcg_draw(&sim->expon_rng));
+#endif
+}
+#endif
+
+
+#if defined(RNG_PRESAMPLE) || defined(LINDLEY)
+void fill_expon(void *arg, double *x, int n)  /* Fill x[0..n-1] with
+                                                 exponentials of mean 1 from
+                                                 the lcg_t arg, as expon
+                                                 would make them. */
+{
+    lcg_t *g = arg;
+#ifdef FAST_EXPON
+    int    i;
+
+    for (i = 0; i < n; ++i)
+        x[i] = zig_unit(g);
+#else
+    float  u[256];
+    int    i, j, m;
+
+    for (i = 0; i < n; i += m) {
+        m = n - i < 256 ? n - i : 256;
+        lcg_fill(g, u, m);
+        for (j = 0; j < m; ++j)
+            x[i + j] = -log(u[j]);
+    }
+#endif
+}
+#endif
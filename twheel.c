@@ -0,0 +1,289 @@
+/* Hierarchical timing wheel (Varghese and Lauck, 1987) for events whose
+   delays are bounded, such as the uniform(2) transit times.  Time is cut
+   into ticks of a fixed length; each of eight levels is a ring of 256
+   slots, level L slot i holding events whose tick agrees with the wheel's
+   current tick above digit L (in base 256) and has digit L equal to i.
+   Bitmaps of the occupied slots let the earliest event be found with a
+   handful of word tests.  Upper-level slots are unsorted and are cascaded
+   down a level only when they come due, so each event is touched at most
+   once per level; level-0 slots are kept sorted, so events come out in
+   order of time, ties going to the lower event type as in evlist.c.  With
+   the tick near the spacing of pending events and the two lowest levels
+   spanning the delay bound, scheduling and removing an event are O(1).
+   The header file twheel.h must be included in the calling program
+   (#include "twheel.h") before using these functions.
+
+   Usage:
+
+   1. To create an empty wheel with ticks "tick" time units long, execute
+          w = twheel_create(tick);
+      and release it with twheel_destroy(w) when done.  Choose the tick so
+      that 65536 ticks cover the longest delay, e.g. twheel_create(2.0 /
+      65536) for transit times on [0,2).  twheel_clear(w) empties the
+      wheel.
+
+   2. To schedule an event of type "type" (a positive int) at time "time",
+      no earlier than the last event removed, execute
+          h = twheel_schedule(w, type, time);
+      The returned handle can be passed to twheel_cancel(w, h) to remove
+      the event without executing it.
+
+   3. To remove the next (earliest) event, execute
+          type = twheel_pop(w, &time);
+      which returns its type and stores its time in "time", or returns 0 if
+      the wheel is empty.  twheel_peek(w) returns the time of the next
+      event (1.0e+30 if none) and twheel_size(w) the number pending. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "twheel.h"
+
+#define WHEEL_BITS      8                   /* log2 of slots per level. */
+#define WHEEL_SLOTS     (1 << WHEEL_BITS)
+#define WHEEL_LEVELS    8                   /* Levels x bits = 64. */
+#define WHEEL_WORDS     (WHEEL_SLOTS / 64)  /* Bitmap words per level. */
+#define WHEEL_INIT_CAP  16                  /* Initial number of events. */
+#define WHEEL_MAX_TICK  4.0e18              /* Clamp on far-future ticks. */
+
+typedef struct {
+    float time;
+    int   type;
+    int   prev, next;  /* Neighbours in the slot list, or -1. */
+    int   slot;        /* level * WHEEL_SLOTS + index. */
+} twheel_node_t;
+
+struct twheel {
+    double              tick;
+    unsigned long long  now;           /* Current tick of the wheel. */
+    int                 size;          /* Number of pending events. */
+    int                 cap;           /* Allocated handles. */
+    int                 num_handles;   /* Handles ever handed out. */
+    int                 num_free;      /* Handles available for reuse. */
+    int                *free_handles;
+    twheel_node_t      *node;          /* node[handle]. */
+    int                 count[WHEEL_LEVELS];
+    int                 head[WHEEL_LEVELS][WHEEL_SLOTS];
+    unsigned long long  map[WHEEL_LEVELS][WHEEL_WORDS];
+};
+
+
+static void *twheel_alloc(void *p, size_t n)  /* Checked realloc. */
+{
+    p = realloc(p, n);
+    if (p == NULL) {
+        fprintf(stderr, "\ntwheel: out of memory\n");
+        exit(3);
+    }
+    return p;
+}
+
+
+static unsigned long long twheel_tick_of(twheel_t *w, float time)
+{
+    double t = floor(time / w->tick);
+
+    if (t <= 0.0)
+        return 0;
+    return (unsigned long long) (t < WHEEL_MAX_TICK ? t : WHEEL_MAX_TICK);
+}
+
+
+/* Put node h on the level and slot its time calls for.  Level-0 slots are
+   kept sorted by time and then type; an event earlier than the wheel's
+   current tick goes at the head of the current level-0 slot. */
+
+static void twheel_place(twheel_t *w, int h)
+{
+    twheel_node_t     *n = &w->node[h];
+    unsigned long long t = twheel_tick_of(w, n->time);
+    int                level = 0, i, prev = -1, next;
+
+    if (t < w->now)
+        t = w->now;
+    while (level < WHEEL_LEVELS - 1 &&
+           ((t ^ w->now) >> (WHEEL_BITS * (level + 1))) != 0)
+        ++level;
+    i = (int) ((t >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1));
+
+    next = w->head[level][i];
+    while (level == 0 && next != -1 &&
+           (w->node[next].time < n->time ||
+            (w->node[next].time == n->time && w->node[next].type <= n->type))) {
+        prev = next;
+        next = w->node[next].next;
+    }
+
+    n->slot = level * WHEEL_SLOTS + i;
+    n->prev = prev;
+    n->next = next;
+    if (prev == -1)
+        w->head[level][i] = h;
+    else
+        w->node[prev].next = h;
+    if (next != -1)
+        w->node[next].prev = h;
+
+    w->map[level][i / 64] |= 1ULL << (i % 64);
+    ++w->count[level];
+}
+
+
+static void twheel_unlink(twheel_t *w, int h)
+{
+    twheel_node_t *n     = &w->node[h];
+    int            level = n->slot / WHEEL_SLOTS, i = n->slot % WHEEL_SLOTS;
+
+    if (n->prev == -1)
+        w->head[level][i] = n->next;
+    else
+        w->node[n->prev].next = n->next;
+    if (n->next != -1)
+        w->node[n->next].prev = n->prev;
+
+    if (w->head[level][i] == -1)
+        w->map[level][i / 64] &= ~(1ULL << (i % 64));
+    --w->count[level];
+}
+
+
+/* Index of the first occupied slot on a nonempty level. */
+
+static int twheel_first_slot(twheel_t *w, int level)
+{
+    int j;
+
+    for (j = 0; w->map[level][j] == 0; ++j)
+        ;
+    return j * 64 + __builtin_ctzll(w->map[level][j]);
+}
+
+
+/* Return the earliest event, first cascading upper-level slots down until
+   level 0 is occupied.  The wheel must not be empty. */
+
+static int twheel_find_min(twheel_t *w)
+{
+    int level, i, h, next, shift;
+
+    while (w->count[0] == 0) {
+        /* Advance the wheel to the start of the first occupied slot on the
+           lowest occupied level, and spread that slot over the levels
+           below. */
+        for (level = 1; w->count[level] == 0; ++level)
+            ;
+        i     = twheel_first_slot(w, level);
+        shift = WHEEL_BITS * (level + 1);
+        w->now = (shift < 64 ? (w->now >> shift) << shift : 0) |
+                 ((unsigned long long) i << (WHEEL_BITS * level));
+
+        for (h = w->head[level][i]; h != -1; h = next) {
+            next = w->node[h].next;
+            twheel_unlink(w, h);
+            twheel_place(w, h);
+        }
+    }
+    return w->head[0][twheel_first_slot(w, 0)];
+}
+
+
+twheel_t *twheel_create(double tick)
+{
+    twheel_t *w = twheel_alloc(NULL, sizeof(twheel_t));
+
+    w->tick         = tick;
+    w->cap          = WHEEL_INIT_CAP;
+    w->free_handles = twheel_alloc(NULL, w->cap * sizeof(int));
+    w->node         = twheel_alloc(NULL, w->cap * sizeof(twheel_node_t));
+    twheel_clear(w);
+    return w;
+}
+
+
+void twheel_destroy(twheel_t *w)
+{
+    free(w->free_handles);
+    free(w->node);
+    free(w);
+}
+
+
+void twheel_clear(twheel_t *w)
+{
+    int level, i;
+
+    w->now         = 0;
+    w->size        = 0;
+    w->num_handles = 0;
+    w->num_free    = 0;
+    for (level = 0; level < WHEEL_LEVELS; ++level) {
+        w->count[level] = 0;
+        for (i = 0; i < WHEEL_SLOTS; ++i)
+            w->head[level][i] = -1;
+        for (i = 0; i < WHEEL_WORDS; ++i)
+            w->map[level][i] = 0;
+    }
+}
+
+
+int twheel_schedule(twheel_t *w, int type, float time)
+{
+    int h;
+
+    if (w->num_free > 0)
+        h = w->free_handles[--w->num_free];
+    else {
+        if (w->num_handles == w->cap) {
+            w->cap *= 2;
+            w->free_handles = twheel_alloc(w->free_handles, w->cap * sizeof(int));
+            w->node         = twheel_alloc(w->node, w->cap * sizeof(twheel_node_t));
+        }
+        h = w->num_handles++;
+    }
+
+    w->node[h].time = time;
+    w->node[h].type = type;
+    twheel_place(w, h);
+    ++w->size;
+    return h;
+}
+
+
+void twheel_cancel(twheel_t *w, int handle)
+{
+    twheel_unlink(w, handle);
+    w->free_handles[w->num_free++] = handle;
+    --w->size;
+}
+
+
+int twheel_pop(twheel_t *w, float *time)
+{
+    int h;
+
+    /* Check to see whether the wheel is empty. */
+    if (w->size == 0)
+        return 0;
+
+    h = twheel_find_min(w);
+    if (twheel_tick_of(w, w->node[h].time) > w->now)
+        w->now = twheel_tick_of(w, w->node[h].time);
+
+    *time = w->node[h].time;
+    twheel_unlink(w, h);
+    w->free_handles[w->num_free++] = h;
+    --w->size;
+    return w->node[h].type;
+}
+
+
+float twheel_peek(twheel_t *w)
+{
+    return w->size > 0 ? w->node[twheel_find_min(w)].time : 1.0e+30;
+}
+
+
+int twheel_size(twheel_t *w)
+{
+    return w->size;
+}
@@ -0,0 +1,13 @@
+/* Header file "twheel.h" to be included by programs using the timing wheel
+   in twheel.c.  See twheel.c for a description of the functions. */
+
+typedef struct twheel twheel_t;
+
+twheel_t *twheel_create(double tick);
+void      twheel_destroy(twheel_t *w);
+void      twheel_clear(twheel_t *w);
+int       twheel_schedule(twheel_t *w, int type, float time);
+void      twheel_cancel(twheel_t *w, int handle);
+int       twheel_pop(twheel_t *w, float *time);
+float     twheel_peek(twheel_t *w);
+int       twheel_size(twheel_t *w);
@@ -0,0 +1,112 @@
+/* Exponential random variates by the ziggurat method (Marsaglia and Tsang,
+   J. Statistical Software 5(8), 2000), drawn from the streams of lcgrand.
+   The exponential density is covered by 256 horizontal strips of equal
+   area.  One 31-bit integer from lcgrandz picks a strip (its low 8 bits)
+   and a point across it (its upper 23 bits); about 99% of the time the
+   point lies under the density and is returned after one multiplication,
+   with no logarithm.  Otherwise the wedge or the tail beyond the last
+   strip is handled exactly, drawing further numbers from the same stream,
+   so the variates are exponential up to the 23-bit resolution of the
+   point.  The header file zigexp.h must be included in the calling
+   program (#include "zigexp.h") before using these functions.
+
+   Usage:
+
+   1. To obtain an exponential random variate with mean "mean" from
+      stream "stream" of lcgrand, execute
+          x = zig_expon(mean, stream);
+
+   2. To obtain one from the stream held by the caller in the lcg_t g
+      (see lcgrand.c), execute
+          x = zig_draw(g, mean);
+
+   3. To obtain a variate with mean 1 from g, as a double, execute
+          x = zig_unit(g);
+      Then mean * x is exactly what zig_draw(g, mean) would have returned,
+      so the scaling can be left to a later time or another thread.
+
+   The tables are set up before main under GCC, so that threads drawing
+   from their own lcg_t only ever read them, and elsewhere on the first
+   call. */
+
+#include <math.h>
+#include "lcgrand.h"
+#include "zigexp.h"
+
+#define ZIG_STRIPS  256                    /* Number of strips. */
+#define ZIG_R       7.69711747013104972    /* Start of the tail. */
+#define ZIG_AREA    3.949659822581572e-3   /* Area of each strip. */
+#define ZIG_SCALE   8388608.0              /* 2^23, range of the point. */
+
+static long   zig_k[ZIG_STRIPS];  /* Point bound below which to accept. */
+static double zig_w[ZIG_STRIPS];  /* Scale from point to x. */
+static double zig_f[ZIG_STRIPS];  /* Density at the strip's lower edge. */
+static int    zig_ready = 0;
+
+
+#if defined(__GNUC__)
+__attribute__((constructor))
+#endif
+static void zig_setup(void)
+{
+    double d = ZIG_R, t = ZIG_R, q = ZIG_AREA / exp(-ZIG_R);
+    int    i;
+
+    zig_k[0] = (long) (d / q * ZIG_SCALE);
+    zig_k[1] = 0;
+    zig_w[0] = q / ZIG_SCALE;
+    zig_w[ZIG_STRIPS - 1] = d / ZIG_SCALE;
+    zig_f[0] = 1.0;
+    zig_f[ZIG_STRIPS - 1] = exp(-d);
+
+    for (i = ZIG_STRIPS - 2; i >= 1; --i) {
+        d = -log(ZIG_AREA / d + exp(-d));
+        zig_k[i + 1] = (long) (d / t * ZIG_SCALE);
+        t = d;
+        zig_f[i] = exp(-d);
+        zig_w[i] = d / ZIG_SCALE;
+    }
+    zig_ready = 1;
+}
+
+
+double zig_unit(lcg_t *g)
+{
+    long   z, j;
+    int    i;
+    double x;
+
+    if (!zig_ready)
+        zig_setup();
+
+    for (;;) {
+        z = lcg_drawz(g);
+        i = z & (ZIG_STRIPS - 1);
+        j = z >> 8;
+        x = j * zig_w[i];
+
+        /* The point lies inside the rectangle wholly under the density. */
+        if (j < zig_k[i])
+            return x;
+
+        /* The base strip: return a point of the tail beyond ZIG_R. */
+        if (i == 0)
+            return ZIG_R - log(lcg_draw(g));
+
+        /* A wedge: accept the point if it lies under the density. */
+        if (zig_f[i] + lcg_draw(g) * (zig_f[i - 1] - zig_f[i]) < exp(-x))
+            return x;
+    }
+}
+
+
+float zig_draw(lcg_t *g, float mean)
+{
+    return mean * zig_unit(g);
+}
+
+
+float zig_expon(float mean, int stream)
+{
+    return zig_draw(lcgrand_state(stream), mean);
+}
@@ -0,0 +1,7 @@
+/* Header file "zigexp.h" to be included by programs using the ziggurat
+   exponential generator in zigexp.c.  See zigexp.c for a description.
+   lcgrand.h must be included first. */
+
+float  zig_expon(float mean, int stream);
+float  zig_draw(lcg_t *g, float mean);
+double zig_unit(lcg_t *g);